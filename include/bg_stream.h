@@ -0,0 +1,41 @@
+#ifndef BG_STREAM_H
+#define BG_STREAM_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// STREAMED BACKGROUNDS
+// ============================================================================
+//
+// Full-screen background art stays compressed on the SD card (.qbg, see
+// tools/img2qbg.py) and is decoded one band of rows at a time. Bands are
+// compressed independently, so any row can be fetched by seeking to its
+// band and decoding that band alone.
+//
+// The last BG_CACHE_BANDS decoded bands are kept in RAM (least recently
+// used goes first). The compositor walks the screen top to bottom in
+// strips, so a full redraw decodes each band once, and dirty-rect restores
+// mostly hit bands that are already cached.
+//
+// Render loop only: bgRow reads the SD card and reuses cache slots.
+//
+
+// Open a .qbg background and allocate its band cache. Replaces any
+// background opened before. Files whose bands hold more than 65535 pixels
+// (band rows x width) are rejected.
+bool bgOpen(const char *path);
+
+// Close the file and free the cache
+void bgClose();
+
+bool bgIsOpen();
+uint16_t bgWidth();
+uint16_t bgHeight();
+
+// Pixels (RGB565) of image row y, decoding its band if it isn't cached.
+// nullptr if y is outside the image or the band can't be read. Only valid
+// until the next bgRow call: copy the row out before asking for another.
+const uint16_t *bgRow(int16_t y);
+
+#endif // BG_STREAM_H
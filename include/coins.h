@@ -3,21 +3,24 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "entity_store.h"
 
 // ============================================================================
 // COIN DATA STRUCTURE
 // ============================================================================
 
+// Per-coin state besides position and velocity (in coinStore's arrays)
 struct Coin {
-    float x, y;
     uint8_t value;
-    bool active;
     unsigned long spawnTime;
-    float floatOffset;  // For bobbing animation
+    float floatOffset;       // For bobbing animation
+    float prevFloatOffset;
 };
 
-// Coin pool
-extern Coin coinPool[MAX_COINS];
+typedef EntityStore<Coin, MAX_COINS> CoinStore;
+
+// Live coins
+extern CoinStore coinStore;
 
 // ============================================================================
 // COIN FUNCTIONS
@@ -26,11 +29,11 @@ extern Coin coinPool[MAX_COINS];
 // Initialize coin system
 void coinsInit();
 
-// Update all coins (floating, expiring)
+// Advance all coins one fixed step (floating, expiring)
 void coinsUpdate(unsigned long deltaTime);
 
-// Spawn a coin at position
-Coin* coinSpawn(float x, float y, uint8_t value);
+// Spawn a coin at position (returns its id, ENTITY_NONE if none left)
+EntityId coinSpawn(float x, float y, uint8_t value);
 
 // Collect coin at screen position (returns value, 0 if none)
 uint8_t coinCollect(int16_t screenX, int16_t screenY);
@@ -38,6 +41,13 @@ uint8_t coinCollect(int16_t screenX, int16_t screenY);
 // Collect all coins in radius
 uint8_t coinCollectRadius(int16_t screenX, int16_t screenY, int16_t radius);
 
+// Collect all coins within radius of the segment (x0,y0)-(x1,y1)
+uint8_t coinCollectPath(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t radius);
+
+// Coin ids within +-radius of a point, filed by position without the
+// bob offset, in id order (candidates only). Returns the count.
+uint16_t coinQuery(float x, float y, float radius, uint16_t* out, uint16_t maxOut);
+
 // Get coin count
 uint8_t coinGetCount();
 
@@ -61,6 +61,67 @@
 #define TARGET_FPS 30
 #define FRAME_TIME_MS (1000 / TARGET_FPS)
 
+// Frame-rate governor (governor.cpp): full rate while the player is
+// interacting or a lot is moving, fewer frames as the tank calms down
+#define GOV_ACTIVE_MS 3000    // Full rate for this long after a tap
+#define GOV_SETTLE_MS 1000    // Calm this long before stepping the rate down
+#define GOV_BUSY_PIXELS 12000 // Redrawn per frame: at least this is busy (TARGET_FPS)
+#define GOV_QUIET_PIXELS 600  // At most this is still (a counter ticking)
+#define GOV_IDLE_FPS 12       // Some movement, not much
+#define GOV_STILL_FPS 3       // Nothing much changing
+
+// Backlight (TFT_BL over LEDC PWM): follows the room light on the LDR and
+// dims when nobody has touched the screen for a while
+#define GOV_BACKLIGHT_CHANNEL 0
+#define GOV_BACKLIGHT_FREQ 5000   // Hz
+#define GOV_BACKLIGHT_MIN 25      // Percent in a dark room
+#define GOV_DIM_MS 60000          // No tap for this long dims the backlight
+#define GOV_DIM_PERCENT 40        // Of the ambient level
+#define GOV_USE_LDR 1             // 0: boards without the LDR stay at full brightness
+#define GOV_LDR_BRIGHT 0          // LDR reading in a bright room (reads higher as it gets darker)
+#define GOV_LDR_DARK 1000         // LDR reading in a dark room
+#define GOV_LDR_SAMPLE_MS 500
+
+// Tasks: input and entity updates run in the update task on core 0;
+// rendering stays in loop() (the Arduino loopTask, core 1). The touch
+// sampler task (touch.cpp) sleeps until the pen goes down and feeds the
+// update task touch events. The save writer task (save_writer.cpp) sleeps
+// until a save is submitted.
+#define UPDATE_TASK_CORE 0
+#define UPDATE_TASK_PRIORITY 2 // Above loopTask (1)
+#define UPDATE_TASK_STACK 8192 // Bytes
+#define TOUCH_TASK_CORE 0
+#define TOUCH_TASK_PRIORITY 3 // Above the update task: samples go out on time
+#define TOUCH_TASK_STACK 4096 // Bytes
+#define SAVE_TASK_CORE 0
+#define SAVE_TASK_PRIORITY 1 // Below the update task: saves wait, steps don't
+#define SAVE_TASK_STACK 4096 // Bytes
+
+// Fixed-step simulation: entities always advance in SIM_DT steps, however
+// fast the renderer runs. Speeds below are per second.
+#define SIM_HZ 60
+#define SIM_TICK_US (1000000UL / SIM_HZ)
+#define SIM_DT (1.0f / SIM_HZ) // Seconds per step
+#define SIM_MAX_STEPS 5        // Steps per wake before dropping time (stall guard)
+
+// Rendering
+#define GFX_STRIP_HEIGHT 16 // Rows per compositing strip (320x16 RGB565 = 10 KB)
+#define DIRTY_MAX_RECTS 32  // Merged dirty rects tracked per frame
+#define DIRTY_FULL_PERCENT 60 // Dirty coverage (% of screen) that triggers a full redraw
+#define ANIM_MIRROR_BYTES 32768 // RAM for pre-flipped animation frames (0: always flip while drawing)
+#define ANIM_SCALED_BYTES 49152 // RAM for growth-stage sized fish frames (0: every stage draws full size)
+#define ANIM_SCALE_SMOOTH 1     // Box filter scaled frames (0: nearest neighbour)
+#define GFX_HW_SCROLL 0         // Drift the tank background with the panel's hardware scroll (art should tile sideways)
+#define GFX_SCROLL_STEP_MS 125  // Time per one-pixel drift step
+
+// Tank background art, streamed from SD (tools/img2qbg.py). Without the
+// file the tank gets the flat water gradient.
+#define TANK_BACKGROUND "/backgrounds/sierra.qbg"
+#define BG_CACHE_BANDS 3 // Decoded bands kept in RAM (16 rows x 320 RGB565 = 10 KB each)
+
+// Spatial queries
+#define GRID_CELL_SIZE 32 // Broadphase cell edge in pixels (10x8 cells)
+
 // Tank dimensions (play area within screen)
 #define TANK_LEFT 0
 #define TANK_TOP 40 // Leave room for UI at top
@@ -73,24 +134,33 @@
 #define MAX_FISH 10 // Max fish on screen at once
 #define FISH_WIDTH 24
 #define FISH_HEIGHT 16
-#define FISH_SPEED_MIN 0.5f
-#define FISH_SPEED_MAX 1.5f
+#define FISH_SPEED_MIN 15.0f   // Pixels per second
+#define FISH_SPEED_MAX 45.0f   // Pixels per second
+#define FISH_STEER_TIME 0.316f // Seconds for velocity to close 63% of the gap to target
 #define FISH_HUNGER_MAX 100    // Hunger meter max value
 #define FISH_HUNGER_RATE 1     // Hunger decrease per second
 #define FISH_STARVE_TIME 30000 // ms until fish dies if not fed
+#define FISH_MAX_STAGES 3      // Growth stages (FishStats::growthStages is at most this)
+#define FISH_STAGE_SCALE 0.3f  // Size added per growth stage (stage 2 is 1.6x)
+#define FISH_TINTS 6           // Colour variants new fish cycle through (0 = art colours)
 
 // Food settings
-#define MAX_FOOD 15          // Max food pellets on screen
-#define FOOD_SIZE 4          // Pellet radius
-#define FOOD_FALL_SPEED 1.0f // Pixels per frame
-#define FOOD_COST 5          // Coins per pellet (later upgrade)
+#define MAX_FOOD 15           // Max food pellets on screen
+#define FOOD_SIZE 4           // Pellet radius
+#define FOOD_FALL_SPEED 30.0f // Pixels per second
+#define FOOD_COST 5           // Coins per pellet (later upgrade)
 
 // Coin settings
 #define MAX_COINS 20          // Max coins on screen
 #define COIN_SIZE 8           // Coin radius
-#define COIN_FLOAT_SPEED 0.3f // How fast coins float up
+#define COIN_FLOAT_SPEED 9.0f // Pixels per second (upward)
+#define COIN_BOB_SPEED 3.0f   // Bob phase, radians per second
 #define COIN_LIFETIME 5000    // ms before coin despawns
 
+// Particle settings (bubbles, sparkles, splashes)
+#define MAX_PARTICLES 48           // Shared by every emitter
+#define PARTICLE_PIXEL_BUDGET 6144 // Sprite pixels drawn per frame; the rest skip the frame
+
 // Economy
 #define STARTING_COINS 50
 #define FISH_COST_BASIC 25  // Cost to buy a rainbow trout
@@ -99,8 +169,30 @@
 #define COIN_VALUE_LARGE 5  // Large fish coin drop
 
 // Touch settings
-#define TOUCH_DEBOUNCE_MS 100  // Minimum ms between touch events
-#define TOUCH_MIN_PRESSURE 200 // Minimum pressure to register touch (increase if phantom touches)
+#define TOUCH_DEBOUNCE_MS 100   // Minimum ms between touch events
+#define TOUCH_MIN_PRESSURE 200  // Minimum pressure to register touch (increase if phantom touches)
+#define TOUCH_MAX_PRESSURE 5000 // Readings above this are noise
+#define TOUCH_SAMPLE_MS 5       // Sampling period while pressed (the driver caches reads for 3 ms)
+#define TOUCH_FILTER_SAMPLES 3  // Position is the median of this many good readings
+#define TOUCH_PRESS_SAMPLES 2   // Good readings in a row before a press counts
+#define TOUCH_RELEASE_SAMPLES 2 // Bad readings in a row (or the IRQ line high) end a press
+#define TOUCH_MOVE_MIN 2        // Pixels moved before another move event
+#define TOUCH_RING_SIZE 32      // Queued touch events (power of two)
+
+// Gestures (gesture.h): taps act on the press; a press that moves turns
+// into a drag that sweeps up coins
+#define GESTURE_DRAG_MIN 10                  // Pixels from the press point before it's a drag
+#define GESTURE_SWEEP_RADIUS (COIN_SIZE * 2) // Coins this close to the drag path are collected
+
+// Save game (save_state.h): the whole tank fits in this many bytes
+// (MAX_FISH + MAX_FOOD + MAX_COINS entities, at most ~40 bytes each)
+#define SAVE_MAX_BYTES 2048
+#define SAVE_AUTOSAVE_MS 5000 // Game time between autosaves
+
+// Shared HSPI bus (spi_bus.h): while a frame goes out, a waiting touch read
+// gets the bus between two strips at most this often
+#define BUS_TOUCH_SLOT_MS 4
+#define BUS_SLOT_TIMEOUT_MS 5 // Renderer takes the bus back if touch doesn't show up
 
 // ============================================================================
 // FISH SPECIES DATA
@@ -125,6 +217,8 @@ struct FishStats
     float speedMult;      // Speed multiplier
     uint8_t growthStages; // How many times they grow
     uint16_t cost;        // Shop cost
+    uint8_t animFrames;   // Frames in the swim cycle
+    uint16_t frameMs;     // Time each frame shows
 };
 
 // Defined in fish.cpp
@@ -154,4 +248,9 @@ enum GameState
 #define DEBUG_TOUCH 1  // Show touch coordinates
 #define DEBUG_FISH 0   // Show fish state info
 
+// Frame profiler (profiler.h): per-phase timing with rolling min/avg/p99
+#define DEBUG_PROFILER 1         // Time input/sim/clear/draw/UI/push phases
+#define DEBUG_PROFILER_OVERLAY 0 // Show the phase stats over the tank
+#define DEBUG_PROFILER_STREAM 0  // Send them as binary packets over Serial (tools/prof_stream.py)
+
 #endif // CONFIG_H
@@ -0,0 +1,44 @@
+#ifndef DIRTY_RECTS_H
+#define DIRTY_RECTS_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// DIRTY REGION TRACKING
+// ============================================================================
+//
+// Collects the screen areas that changed during a frame. Rects are clipped
+// to the screen and merged with any rect they overlap or touch as they are
+// added. Once the dirty area passes DIRTY_FULL_PERCENT of the screen, the
+// list collapses to a single full-screen rect. One strip push per merged
+// rect is cheaper than many small overlapping ones.
+//
+
+struct DirtyRect
+{
+    int16_t x, y;
+    int16_t w, h;
+};
+
+// Start a new frame's list (empty)
+void dirtyReset();
+
+// Mark a screen area as changed
+void dirtyAdd(int16_t x, int16_t y, int16_t w, int16_t h);
+void dirtyAdd(const DirtyRect &r);
+
+// Mark the whole screen as changed
+void dirtyAddAll();
+
+// Whole screen will be redrawn
+bool dirtyIsFull();
+
+// Merged rects for this frame
+uint8_t dirtyCount();
+const DirtyRect &dirtyGet(uint8_t index);
+
+// Total dirty pixels (after merging)
+uint32_t dirtyArea();
+
+#endif // DIRTY_RECTS_H
@@ -0,0 +1,150 @@
+#ifndef ENTITY_STORE_H
+#define ENTITY_STORE_H
+
+#include <Arduino.h>
+#include <string.h>
+
+// ============================================================================
+// ENTITY STORE
+// ============================================================================
+//
+// Fixed-capacity storage for one kind of entity, kept as parallel arrays
+// (structure of arrays). Live entities are packed into rows [0, count)
+// with no gaps, so per-step loops visit only live entities and walk each
+// field as one contiguous run. integrate() is a plain multiply-add over
+// float arrays that the compiler can unroll and vectorise.
+//
+// Removing an entity moves the last row into its place, so rows are not
+// stable. Anything that has to name an entity across a removal (spatial
+// grids, the renderer's dirty tracking, callers keeping a spawned entity)
+// uses its id: a handle in [0, Capacity) that stays put until the entity
+// is removed. Free ids sit on a stack, so spawn and remove are both O(1).
+//
+// Position and velocity live in the packed arrays; everything else a
+// module keeps per entity goes in its Data struct (data[row]), which must
+// be plain data (it is moved with memcpy semantics).
+//
+
+typedef uint16_t EntityId;
+
+// No entity / no row
+#define ENTITY_NONE 0xFFFF
+
+template <typename Data, uint16_t Capacity>
+struct EntityStore
+{
+    // Live rows [0, count)
+    float x[Capacity];
+    float y[Capacity];
+    float prevX[Capacity]; // Position before the last step (render interpolation)
+    float prevY[Capacity];
+    float vx[Capacity]; // Velocity (pixels per second)
+    float vy[Capacity];
+    Data data[Capacity];
+    EntityId id[Capacity]; // Row -> id
+    uint16_t count;
+
+    // Id -> row (ENTITY_NONE while free), and the free ids
+    uint16_t rowOf[Capacity];
+    EntityId freeIds[Capacity];
+    uint16_t freeCount;
+
+    // Drop every entity. Ids are handed out again starting from 0.
+    void clear()
+    {
+        count = 0;
+        freeCount = Capacity;
+        for (uint16_t i = 0; i < Capacity; i++)
+        {
+            rowOf[i] = ENTITY_NONE;
+            freeIds[i] = Capacity - 1 - i;
+        }
+    }
+
+    // Add an entity at rest at (px, py) and return its row (ENTITY_NONE if
+    // the store is full). The caller fills in data[row].
+    uint16_t spawn(float px, float py)
+    {
+        if (freeCount == 0)
+            return ENTITY_NONE;
+
+        EntityId e = freeIds[--freeCount];
+        uint16_t r = count++;
+        id[r] = e;
+        rowOf[e] = r;
+
+        x[r] = prevX[r] = px;
+        y[r] = prevY[r] = py;
+        vx[r] = vy[r] = 0.0f;
+        return r;
+    }
+
+    // Remove the entity in row r. The last row moves into r, so a loop over
+    // rows that removes r has to look at r again.
+    void removeRow(uint16_t r)
+    {
+        uint16_t last = --count;
+        rowOf[id[r]] = ENTITY_NONE;
+        freeIds[freeCount++] = id[r];
+
+        if (r != last)
+        {
+            x[r] = x[last];
+            y[r] = y[last];
+            prevX[r] = prevX[last];
+            prevY[r] = prevY[last];
+            vx[r] = vx[last];
+            vy[r] = vy[last];
+            data[r] = data[last];
+            id[r] = id[last];
+            rowOf[id[r]] = r;
+        }
+    }
+
+    // Remove an entity by id. False if it was already gone.
+    bool remove(EntityId e)
+    {
+        uint16_t r = find(e);
+        if (r == ENTITY_NONE)
+            return false;
+        removeRow(r);
+        return true;
+    }
+
+    // Row of a live entity, or ENTITY_NONE
+    uint16_t find(EntityId e) const
+    {
+        return e < Capacity ? rowOf[e] : ENTITY_NONE;
+    }
+
+    // Save positions for interpolation, then move every live entity by its
+    // velocity over dt seconds
+    void integrate(float dt)
+    {
+        memcpy(prevX, x, count * sizeof(float));
+        memcpy(prevY, y, count * sizeof(float));
+        for (uint16_t r = 0; r < count; r++)
+        {
+            x[r] += vx[r] * dt;
+            y[r] += vy[r] * dt;
+        }
+    }
+
+    // Copy the live rows and their ids from another store, skipping the id
+    // bookkeeping: enough to read or draw the entities (render snapshots),
+    // not to spawn or remove. Costs O(count), not O(Capacity).
+    void copyLive(const EntityStore &src)
+    {
+        count = src.count;
+        memcpy(x, src.x, count * sizeof(float));
+        memcpy(y, src.y, count * sizeof(float));
+        memcpy(prevX, src.prevX, count * sizeof(float));
+        memcpy(prevY, src.prevY, count * sizeof(float));
+        memcpy(vx, src.vx, count * sizeof(float));
+        memcpy(vy, src.vy, count * sizeof(float));
+        memcpy(data, src.data, count * sizeof(Data));
+        memcpy(id, src.id, count * sizeof(EntityId));
+    }
+};
+
+#endif // ENTITY_STORE_H
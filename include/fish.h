@@ -3,19 +3,18 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "entity_store.h"
 
 // ============================================================================
 // FISH DATA STRUCTURE
 // ============================================================================
 
+// Per-fish state besides position and velocity, which live in the
+// store's packed arrays (fishStore.x[row], fishStore.vx[row], ...)
 struct Fish {
-    // Position and movement
-    float x, y;
-    float vx, vy;           // Velocity
     float targetX, targetY; // Where fish wants to go
 
     // State
-    bool active;
     FishSpecies species;
     uint8_t growthStage;    // 0=small, 1=medium, 2=large
 
@@ -32,12 +31,13 @@ struct Fish {
     unsigned long lastCoinDrop;
 
     // Visual
-    uint16_t tint;          // Color tint (for variety)
+    uint16_t tint;          // Colour variant, 0 .. FISH_TINTS - 1 (0 = as drawn)
 };
 
-// Fish pool
-extern Fish fishPool[MAX_FISH];
-extern uint8_t fishCount;
+typedef EntityStore<Fish, MAX_FISH> FishStore;
+
+// Live fish
+extern FishStore fishStore;
 
 // ============================================================================
 // FISH FUNCTIONS
@@ -46,23 +46,38 @@ extern uint8_t fishCount;
 // Initialize fish system
 void fishInit();
 
-// Update all fish (movement, hunger, coins)
+// Advance all fish one fixed step of SIM_DT (movement, hunger, coins).
+// deltaTime is the step in whole ms, for the millisecond timers.
 void fishUpdate(unsigned long deltaTime);
 
-// Spawn a new fish
-Fish* fishSpawn(FishSpecies species, float x, float y);
+// Spawn a new fish (returns its id, ENTITY_NONE if the tank is full)
+EntityId fishSpawn(FishSpecies species, float x, float y);
 
 // Remove a fish (died or sold)
-void fishRemove(Fish* fish);
+void fishRemove(EntityId fish);
 
 // Feed fish - called when food is near
-void fishFeed(Fish* fish);
+void fishFeed(EntityId fish);
 
 // Check if fish is hungry (for visual indicator)
-bool fishIsHungry(Fish* fish);
+bool fishIsHungry(const Fish* fish);
+
+// Size multiplier of a growth stage
+inline float fishStageScale(uint8_t stage) {
+    return 1.0f + stage * FISH_STAGE_SCALE;
+}
+
+// Record the size a species is drawn at in a growth stage (the renderer
+// calls this at load, before the game starts). Until then hit tests use
+// FISH_WIDTH x FISH_HEIGHT scaled by the stage.
+void fishSetDrawSize(FishSpecies species, uint8_t stage, uint16_t width, uint16_t height);
+
+// Get fish at screen position (for tap selection; ENTITY_NONE if none).
+// Tests the box each fish is drawn in.
+EntityId fishGetAt(int16_t screenX, int16_t screenY);
 
-// Get fish at screen position (for tap selection)
-Fish* fishGetAt(int16_t screenX, int16_t screenY);
+// Fish ids within +-radius of a point, in id order (candidates only)
+uint16_t fishQuery(float x, float y, float radius, uint16_t* out, uint16_t maxOut);
 
 // Get count of active fish
 uint8_t fishGetCount();
@@ -3,19 +3,21 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "entity_store.h"
 
 // ============================================================================
 // FOOD DATA STRUCTURE
 // ============================================================================
 
+// Per-pellet state besides position and velocity (in foodStore's arrays)
 struct Food {
-    float x, y;
-    bool active;
     unsigned long spawnTime;
 };
 
-// Food pool
-extern Food foodPool[MAX_FOOD];
+typedef EntityStore<Food, MAX_FOOD> FoodStore;
+
+// Live food
+extern FoodStore foodStore;
 
 // ============================================================================
 // FOOD FUNCTIONS
@@ -24,14 +26,18 @@ extern Food foodPool[MAX_FOOD];
 // Initialize food system
 void foodInit();
 
-// Update all food (falling, being eaten)
+// Advance all food one fixed step (falling, being eaten)
 void foodUpdate(unsigned long deltaTime);
 
-// Drop food at position
-Food* foodDrop(float x, float y);
+// Drop food at position (returns its id, ENTITY_NONE if none left)
+EntityId foodDrop(float x, float y);
 
 // Remove food pellet
-void foodRemove(Food* food);
+void foodRemove(EntityId food);
+
+// Food ids within +-radius of a point, in id order (candidates only: test
+// the real distance and skip ids with no row). Returns the count.
+uint16_t foodQuery(float x, float y, float radius, uint16_t* out, uint16_t maxOut);
 
 // Get food count
 uint8_t foodGetCount();
@@ -50,26 +50,41 @@ extern GameData game;
 // GAME STATE FUNCTIONS
 // ============================================================================
 
-// Initialize game to default state
-void gameStateInit();
+// Initialize game to default state, then restore the saved game if the SD
+// card has one. True if the saved tank came back (fish, food and coins
+// included); false means start a new game.
+bool gameStateInit();
 
 // Change game state with transition
 void gameStateChange(GameState newState);
 
-// Update current state (called each frame)
-void gameStateUpdate();
+// Advance the game clock and play time by one simulation step (called
+// each step; both stand still unless playing)
+void gameStateUpdate(unsigned long deltaTime);
+
+// Game clock in ms: the sum of the step deltas while playing. Gameplay
+// timers (hunger, coin drops, animation, coin lifetime) use it rather than
+// millis(), so they keep pace with motion when steps are dropped.
+unsigned long gameMillis();
 
 // Reset game (new game)
 void gameStateReset();
 
+// Gameplay random numbers, random()-style. Its own xorshift generator
+// rather than random(), so a save can carry its state.
+long gameRandom(long howbig);
+long gameRandom(long howsmall, long howbig);
+uint32_t gameRandomState();
+void gameRandomSetState(uint32_t state);
+
 // ============================================================================
 // SAVE/LOAD (SD Card)
 // ============================================================================
 
-// Save game to SD card
+// Save game to SD card (the whole tank, see save_state.h)
 bool gameSave();
 
-// Load game from SD card
+// Load game from SD card (replaces the live tank only if the save is good)
 bool gameLoad();
 
 // Check if save exists
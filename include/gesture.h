@@ -0,0 +1,50 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// GESTURES
+// ============================================================================
+//
+// Turns the touch event stream into what the game acts on. Most presses
+// are taps, so a press acts the moment the pen goes down (GESTURE_PRESS)
+// instead of when it lifts, and the lift only confirms it (GESTURE_TAP).
+// If the pen travels GESTURE_DRAG_MIN pixels first, the prediction was
+// wrong: GESTURE_DRAG_START tells the game to take back what the press did,
+// then every move is a segment of the drag path (GESTURE_DRAG) until the
+// pen lifts (GESTURE_RELEASE).
+//
+// A press less than TOUCH_DEBOUNCE_MS after the last one is not a tap, but
+// it can still drag.
+//
+
+enum GestureType : uint8_t
+{
+    GESTURE_PRESS = 0,  // Pen down: act on it as a tap now
+    GESTURE_TAP,        // Pen up without dragging: the press stands
+    GESTURE_DRAG_START, // The press became a drag: undo it; first segment
+    GESTURE_DRAG,       // Drag path segment
+    GESTURE_RELEASE     // Pen up after a drag
+};
+
+struct Gesture
+{
+    uint8_t type;
+    int16_t x; // Where the pen is
+    int16_t y;
+    int16_t fromX; // Drag segments: where it was
+    int16_t fromY;
+    uint16_t pressure;
+    uint32_t time; // millis() when sampled
+};
+
+// Update task: the next gesture in the queued touch events (false when
+// there are none)
+bool gesturePoll(Gesture &gesture);
+
+// Is the pen down and dragging? Where it is, if so
+bool gestureDragging(int16_t &x, int16_t &y);
+
+#endif // GESTURE_H
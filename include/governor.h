@@ -0,0 +1,46 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// FRAME-RATE AND BACKLIGHT GOVERNOR
+// ============================================================================
+//
+// A tank where nothing is happening doesn't need 30 frames a second. After
+// each frame the governor picks the frame time for the next one from how
+// much the frame redrew and whether the player tapped recently:
+//
+//   - a tap in the last GOV_ACTIVE_MS, or GOV_BUSY_PIXELS redrawn: TARGET_FPS
+//   - more than GOV_QUIET_PIXELS (slow fish, drifting coins): GOV_IDLE_FPS
+//   - less (a counter ticking, a static screen): GOV_STILL_FPS
+//
+// The rate goes up at once but only steps down after GOV_SETTLE_MS at the
+// lower level, so a scene on the edge doesn't flip between rates. The
+// render loop watches for taps while it waits, so a tap on an idle tank is
+// still answered within a full-rate frame.
+//
+// The backlight (TFT_BL, LEDC PWM) follows the room light on the LDR and
+// dims to GOV_DIM_PERCENT of that after GOV_DIM_MS without a tap. It
+// brightens again on the next tap.
+//
+
+// Take over the backlight pin (call after gfxInit)
+void govInit();
+
+// After each frame: pixels it redrew and the newest tap count
+void govFrameDone(uint32_t now, uint32_t drawnPixels, uint32_t tapCount);
+
+// Milliseconds from one frame to the next at the current rate
+uint16_t govFrameTime();
+
+// Tap count as of the last frame (a different one means a new tap)
+uint32_t govTapCount();
+
+uint8_t govFps();
+
+// Backlight level, percent
+uint8_t govBacklight();
+
+#endif // GOVERNOR_H
@@ -8,9 +8,7 @@
 extern TFT_eSPI tft;
 
 // Forward declarations
-struct Fish;
-struct Food;
-struct Coin;
+struct GameSnapshot;
 
 // ============================================================================
 // GRAPHICS FUNCTIONS
@@ -32,54 +30,67 @@ void gfxEndFrame();
 // ============================================================================
 // GAME RENDERING
 // ============================================================================
+//
+// The playing screen is composited strip by strip: gfxDrawFrame runs the
+// layer functions below once per strip, and they draw into that strip.
+// Call them only through gfxDrawFrame.
+//
 
-// Draw the water tank background
-void gfxDrawTank();
+// Composite and push the parts of the playing screen that changed since
+// the last frame (background, food, fish, coins, particles, UI), strip by
+// strip.
+// Entities and UI values come from the snapshot, not the live pools.
+void gfxDrawFrame(const GameSnapshot &snap);
+
+// Pixels the last gfxDrawFrame redrew (0 after a frame with no changes)
+uint32_t gfxFrameArea();
 
-// Draw a fish
-void gfxDrawFish(Fish *fish);
+// Force the next gfxDrawFrame to redraw the whole screen
+void gfxInvalidate();
 
-// Clear a fish (restore background at its position)
-void gfxClearFish(Fish *fish);
+// Force the next gfxDrawFrame to redraw a screen area
+void gfxInvalidateRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Draw the water tank background
+void gfxDrawTank();
 
-// Clear all fish (call before updating positions)
-void gfxClearAllFish();
+// Draw the fish in a row of the snapshot being composited
+void gfxDrawFish(uint16_t row);
 
 // Draw all fish
 void gfxDrawAllFish();
 
-// Restore background at specific area (dirty rect)
+// Paint the tank background for a screen rect
 void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h);
 
-// Draw a food pellet
-void gfxDrawFood(Food *food);
-
-// Clear a food pellet
-void gfxClearFood(Food *food);
+// Draw the food pellet in a row of the snapshot being composited
+void gfxDrawFood(uint16_t row);
 
 // Draw all food
 void gfxDrawAllFood();
 
-// Clear all food
-void gfxClearAllFood();
-
-// Draw a coin
-void gfxDrawCoin(Coin *coin);
-
-// Clear a coin
-void gfxClearCoin(Coin *coin);
+// Draw the coin in a row of the snapshot being composited
+void gfxDrawCoin(uint16_t row);
 
 // Draw all coins
 void gfxDrawAllCoins();
 
-// Clear all coins
-void gfxClearAllCoins();
+// Draw the particle in a row of the snapshot being composited (skipped if
+// it is over this frame's pixel budget)
+void gfxDrawParticle(uint16_t row);
+
+// Draw all particles
+void gfxDrawAllParticles();
 
 // Draw the UI (coins, level, etc)
 void gfxDrawUI();
 
-// Draw FPS counter (debug)
-void gfxDrawFPS(uint16_t fps);
+// Draw the profiler's per-phase min/avg/p99 over the tank (debug;
+// composited while playing when DEBUG_PROFILER_OVERLAY is set)
+void gfxDrawProfiler();
+
+// Draw FPS counter (debug; composited with the UI while playing)
+void gfxDrawFPS(uint16_t fps, GameState state);
 
 // Draw touch debug crosshair
 void gfxDrawTouchDebug(int16_t x, int16_t y);
@@ -91,7 +102,8 @@ void gfxDrawColorTest();
 // PRIMITIVES (simple shapes for Phase 1)
 // ============================================================================
 
-// These wrap TFT_eSPI functions for consistency
+// These wrap TFT_eSPI functions for consistency. They draw directly to the
+// panel and mark the area for the next composited frame to repaint.
 void gfxFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 void gfxDrawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 void gfxFillCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
@@ -0,0 +1,66 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "entity_store.h"
+
+// ============================================================================
+// PARTICLES
+// ============================================================================
+//
+// Short-lived effects (bubbles, sparkles, splashes) in one fixed pool.
+// Gameplay code fires an emitter at a point; the emitter spawns a small
+// burst with its own speed, spread, lifetime and gravity. Each emitter may
+// only have so many particles alive at once, so spamming taps tops out its
+// share of the pool instead of starving the others.
+//
+// Particles are pure decoration: they use their own random generator, so
+// emitting them never changes the gameplay random() sequence.
+//
+
+enum ParticleKind {
+    PARTICLE_BUBBLE_SM = 0,
+    PARTICLE_BUBBLE_MED,
+    PARTICLE_SPARKLE,
+    PARTICLE_SPLASH,
+    PARTICLE_KIND_COUNT
+};
+
+enum ParticleEmitter {
+    EMIT_FOOD_SPLASH = 0,  // Pellet hitting the water
+    EMIT_FOOD_BUBBLES,     // Trail behind a dropped pellet
+    EMIT_COIN_SPARKLE,     // Coin collected
+    EMIT_FEED_BUBBLES,     // Fish ate
+    EMIT_COUNT
+};
+
+// Per-particle state besides position and velocity (in particleStore's arrays)
+struct Particle {
+    uint8_t kind;
+    uint8_t emitter;
+    uint16_t life;  // Steps left
+};
+
+typedef EntityStore<Particle, MAX_PARTICLES> ParticleStore;
+
+// Live particles
+extern ParticleStore particleStore;
+
+// ============================================================================
+// PARTICLE FUNCTIONS
+// ============================================================================
+
+// Initialize particle system
+void particleInit();
+
+// Advance all particles one fixed step (drifting, fading out)
+void particleUpdate();
+
+// Fire an emitter at a position (returns how many particles it spawned)
+uint8_t particleEmit(ParticleEmitter emitter, float x, float y);
+
+// Get particle count
+uint8_t particleGetCount();
+
+#endif // PARTICLES_H
@@ -0,0 +1,99 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "config.h"
+
+// ============================================================================
+// FRAME PROFILER
+// ============================================================================
+//
+// Scoped probes time each phase of a frame with esp_timer_get_time() (the
+// host build reads std::chrono::steady_clock through the same call, so it
+// measures real host time, not the simulator's virtual clock).
+//
+// Phases can be entered many times per frame (once per strip while
+// compositing) and from either core: input and simulation run in the
+// update task, the rest in the render loop. Probes add into per-phase
+// atomic totals; profFrameEnd() takes the totals as that frame's samples.
+// Simulation time is whatever steps ran since the previous frame.
+//
+// Each phase keeps its last PROF_WINDOW samples, so min/avg/p99 roll with
+// the game instead of averaging over the whole run. profReport() turns
+// them into stats once per second for the overlay and the serial stream.
+//
+// Serial stream packet (little-endian, every profReport):
+//   0xB5 0x50          sync
+//   uint8  version     PROF_STREAM_VERSION
+//   uint8  phases      PROF_PHASE_COUNT
+//   uint32 frame       frames profiled so far
+//   phases x { uint16 min, uint16 avg, uint16 p99 }   microseconds
+//   uint8  check       XOR of every byte after the sync
+// tools/prof_stream.py decodes it.
+//
+
+enum ProfPhase
+{
+    PROF_INPUT = 0, // handleInput: draining touch events (update task)
+    PROF_SIM,       // Entity updates (update task)
+    PROF_CLEAR,     // Background restore under dirty strips
+    PROF_DRAW,      // Food, fish and coin layers
+    PROF_UI,        // Top bar, footer and overlays
+    PROF_PUSH,      // Strip transfers to the panel
+    PROF_PHASE_COUNT
+};
+
+// Rolling stats for one phase, microseconds per frame
+struct ProfStats
+{
+    uint16_t min;
+    uint16_t avg;
+    uint16_t p99;
+};
+
+#define PROF_WINDOW 128       // Frames of history per phase
+#define PROF_STREAM_VERSION 1
+
+// Reset every phase
+void profInit();
+
+// Add time to a phase (any core)
+void profAdd(ProfPhase phase, uint32_t micros);
+
+// Render loop, once per frame: close the frame's samples
+void profFrameEnd();
+
+// Render loop: recompute the stats (and send a stream packet if enabled)
+void profReport();
+
+// Stats from the last profReport
+const ProfStats &profGetStats(ProfPhase phase);
+
+// Short label for a phase ("input", "sim", ...)
+const char *profPhaseName(ProfPhase phase);
+
+// Bumped by every profReport, so the overlay knows when to redraw
+uint32_t profReportCount();
+
+// Times the enclosing scope into a phase
+class ProfScope
+{
+public:
+    explicit ProfScope(ProfPhase phase) : phase(phase), start(esp_timer_get_time()) {}
+    ~ProfScope() { profAdd(phase, (uint32_t)(esp_timer_get_time() - start)); }
+
+private:
+    ProfPhase phase;
+    int64_t start;
+};
+
+#if DEBUG_PROFILER
+#define PROF_CONCAT_(a, b) a##b
+#define PROF_CONCAT(a, b) PROF_CONCAT_(a, b)
+#define PROF_SCOPE(phase) ProfScope PROF_CONCAT(profScope, __LINE__)(phase)
+#else
+#define PROF_SCOPE(phase)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,46 @@
+#ifndef SAVE_STATE_H
+#define SAVE_STATE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// SAVE FORMAT
+// ============================================================================
+//
+// The whole tank in a few hundred bytes: GameData's economy and stats, the
+// gameplay RNG, and every fish, food pellet and coin. Each save also
+// carries a serial number, so the newest of several copies can be found.
+//
+//   "BHSV" version:u8
+//   section*       tag:u8 length:u16 payload
+//   SAVE_END:u8
+//   crc32:u32      over everything before it
+//
+// Numbers are LEB128 varints (zigzag when signed). Positions and speeds are
+// fixed point, 1/16 pixel; timestamps are ages in ms of game time, so a
+// restored tank carries on from gameMillis() at boot. Entity pools are a
+// count, then one record per entity, each with its own length.
+//
+// A reader skips sections it has no tag for, and the bytes after the
+// fields it knows at the end of a section or record, so later versions can
+// add both without breaking older firmware. Multi-byte fixed fields are
+// little-endian.
+//
+
+// Encode the live game into buf. Returns the length, or 0 if it didn't fit.
+size_t saveEncode(uint8_t *buf, size_t cap, uint32_t serial);
+
+// Is this a whole save (magic, section framing, CRC)? Touches nothing live.
+// Its serial goes in *serial (0 if it has none).
+bool saveCheck(const uint8_t *buf, size_t len, uint32_t *serial = nullptr);
+
+// Replace the live game with a save, in one pass over it once saveCheck()
+// passes (false, and nothing changed, if it doesn't). Fish, food and coins
+// that don't fit their stores are dropped.
+bool saveDecode(const uint8_t *buf, size_t len);
+
+// CRC-32 (IEEE 802.3, as zlib), continuing from crc (0 to start)
+uint32_t saveCrc32(uint32_t crc, const uint8_t *data, size_t len);
+
+#endif // SAVE_STATE_H
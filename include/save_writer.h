@@ -0,0 +1,40 @@
+#ifndef SAVE_WRITER_H
+#define SAVE_WRITER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// SAVE WRITER
+// ============================================================================
+//
+// SD writes take tens of milliseconds, so saves go to the card from their
+// own task and the update task never waits on one. The update task encodes
+// a save into saveWriterBuffer() and submits it; the writer task wakes and
+// writes it into whichever A/B slot is older (sdSaveGame).
+//
+// Three buffers rotate through one atomic index, as render snapshots do:
+// the update task fills one, the writer reads another, and the third holds
+// the latest submit. A save submitted while an older one is still waiting
+// replaces it, so a slow card writes only the newest tank and never falls
+// behind.
+//
+
+// Start the writer task (until then, saves are written inline)
+void saveWriterStart();
+
+// Update task: the buffer to encode the next save into (SAVE_MAX_BYTES)
+uint8_t *saveWriterBuffer();
+
+// Update task: hand the buffer's first len bytes to the writer
+void saveWriterSubmit(size_t len);
+
+// Which slot holds the newest save on the card (the writer writes the other)
+void saveWriterSetNewest(uint8_t slot);
+
+// Saves written, replaced before they were written, and failed
+uint32_t saveWriterWrites();
+uint32_t saveWriterCoalesced();
+uint32_t saveWriterFailures();
+
+#endif // SAVE_WRITER_H
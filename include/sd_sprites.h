@@ -4,17 +4,82 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 
+// Default transparent color key (magenta)
+#define SPRITE_KEY_COLOR 0xF81F
+
+/**
+ * @brief A horizontal run of opaque pixels within one sprite row
+ */
+struct SpriteSpan
+{
+    uint16_t x;   // First opaque column
+    uint16_t len; // Number of opaque pixels
+};
+
+// Pixel formats
+#define SPRITE_FMT_RGB565 0    // 16-bit RGB565 LE per pixel (.raw)
+#define SPRITE_FMT_INDEXED4 1  // 4-bit palette indices, two per byte (.i4)
+
+// Entries in a 4bpp palette
+#define SPRITE_PALETTE_SIZE 16
+
 /**
- * @brief Sprite structure for SD card based RGB565 images
+ * @brief Sprite structure for SD card based images
+ *
+ * RGB565 sprites keep one 16-bit pixel each in data. Indexed sprites keep
+ * 4-bit palette indices in indices (rows of (width + 1) / 2 bytes, left
+ * pixel in the high nibble) and expand them through a 16-entry RGB565 LUT
+ * while drawing: a quarter of the RAM and SD reads. The LUT is either the
+ * sprite's own palette or the shared one (spriteSetSharedPalette), so a
+ * palette swap recolours a sprite without a second copy.
+ *
+ * Opaque spans are precomputed at load so transparent draws can push each
+ * run with one address window instead of one drawPixel per pixel.
+ * Row r owns spans[rowSpans[r]] .. spans[rowSpans[r + 1] - 1].
  */
 struct Sprite
 {
     uint16_t width;
     uint16_t height;
-    uint16_t *data;
+    uint16_t *data; // RGB565 pixels (SPRITE_FMT_RGB565), else nullptr
     char *name;
+
+    uint8_t format;          // SPRITE_FMT_*
+    uint8_t *indices;        // Packed indices (SPRITE_FMT_INDEXED4), else nullptr
+    const uint16_t *palette; // LUT for indices: own copy or the shared palette
+
+    SpriteSpan *spans;  // Opaque runs, row by row (nullptr if not built)
+    uint16_t *rowSpans; // height + 1 offsets into spans
+    uint16_t spanKey;   // Transparent color the spans were built for
+
+    bool packed; // Struct and pixels live in the sprite pack (spriteUnload skips it)
+};
+
+/**
+ * @brief Colour remap applied while drawing (palette swap / tint)
+ *
+ * Each channel of a pixel looks up its replacement, already shifted into
+ * place: out = r[red] | g[green] | b[blue]. Any per-channel curve fits,
+ * as does swapping red and blue. 256 bytes in all (not per channel),
+ * shared by every sprite drawn with it, so a tinted fish needs no copy of
+ * its art.
+ *
+ * An RGB565 pixel takes three lookups, not one: a single table indexed by
+ * the whole pixel would be 128 KB per tint. That is accepted for the fish
+ * art, which has hundreds of colours and would lose them as 16-colour
+ * indexed (.i4) sprites. Those take one palette lookup per pixel, tinted
+ * or not.
+ */
+struct SpriteTint
+{
+    uint16_t r[32];
+    uint16_t g[64];
+    uint16_t b[32];
 };
 
+// Sprite pack id (table index), or SPRITE_PACK_NONE
+#define SPRITE_PACK_NONE -1
+
 /**
  * @brief Initialize the sprite management system
  */
@@ -30,6 +95,137 @@ void spriteInit();
  */
 Sprite *spriteLoad(const char *path, uint16_t width, uint16_t height);
 
+/**
+ * @brief Allocate a blank RGB565 sprite in RAM (every pixel the key color)
+ *
+ * For sprites drawn at runtime: fill data, then call spriteBuildSpans.
+ *
+ * @param width Width of the sprite
+ * @param height Height of the sprite
+ * @return Sprite* Pointer to the new sprite, or nullptr on failure
+ */
+Sprite *spriteCreate(uint16_t width, uint16_t height);
+
+/**
+ * @brief Load a 4bpp palette-indexed sprite (.i4, see tools/img2i4.py)
+ *
+ * The size comes from the file header. Files without an embedded palette
+ * draw through the shared palette.
+ *
+ * @param path Path to the .i4 file on SD card
+ * @return Sprite* Pointer to the loaded sprite, or nullptr on failure
+ */
+Sprite *spriteLoadIndexed(const char *path);
+
+/**
+ * @brief Copy columns x .. x + width - 1 of a sprite into a new RAM sprite
+ *
+ * Used to cut frames out of an animation sheet and to pre-flip them. The
+ * copy keeps the source's format (indexed copies get their own palette,
+ * or keep using the shared one) and has its spans built, so it draws
+ * like any loaded sprite and is freed with spriteUnload.
+ *
+ * @param src Source sprite (RAM or packed)
+ * @param x First column to copy
+ * @param width Columns to copy
+ * @param mirror Mirror the copy horizontally
+ * @return Sprite* The copy, or nullptr on failure
+ */
+Sprite *spriteCopyRegion(const Sprite *src, uint16_t x, uint16_t width, bool mirror = false);
+
+/**
+ * @brief Make a resized copy of a sprite in RAM
+ *
+ * For variants built once at load (per-growth-stage fish), never per
+ * frame. RGB565 sprites can be box filtered: each pixel averages the
+ * opaque source pixels it covers. Indexed sprites are always scaled
+ * nearest neighbour and stay indexed. Freed with spriteUnload.
+ *
+ * @param src Source sprite (RAM or packed)
+ * @param width New width
+ * @param height New height
+ * @param smooth Box filter (RGB565 only) instead of nearest neighbour
+ * @return Sprite* The scaled sprite, or nullptr on failure
+ */
+Sprite *spriteScale(const Sprite *src, uint16_t width, uint16_t height, bool smooth = true);
+
+/**
+ * @brief Set the palette used by indexed sprites without their own
+ *
+ * @param lut 16 RGB565 LE colors (copied)
+ */
+void spriteSetSharedPalette(const uint16_t *lut);
+
+/**
+ * @brief Load the shared palette from a .pal file (16 RGB565 LE colors)
+ *
+ * @param path Path to the .pal file on SD card
+ * @return true if all 16 entries were read
+ */
+bool spriteLoadSharedPalette(const char *path);
+
+/**
+ * @brief Load every sprite in a pack file (/assets/pack.bin)
+ *
+ * A pack is one file holding many sprites (see tools/pack_sprites.py):
+ *
+ *   header  "BHPK", uint16 version, uint16 count, uint32 data bytes, uint32 reserved
+ *   table   count x { uint32 name hash, uint16 width, uint16 height,
+ *                     uint8 format, uint8 palette entries (0 or 16),
+ *                     uint16 reserved, uint32 data offset }
+ *   data    RGB565 pixels, or palette + packed indices, each 4-byte aligned
+ *
+ * The table is sorted by name hash (FNV-1a of the sprite's path without
+ * extension, e.g. "/sprites/fish/fish_r_trout"). The whole file is read
+ * with one open and one sequential read into one allocation, and the
+ * sprites point straight into it: no per-sprite open, malloc or copy.
+ * Replaces any pack loaded before.
+ *
+ * @param path Path to the pack on SD card
+ * @return true if the pack loaded
+ */
+bool spritePackLoad(const char *path);
+
+/**
+ * @brief Find a packed sprite by name (binary search on the name hash)
+ *
+ * Resolve names once at load and keep the id or the Sprite pointer.
+ *
+ * @param name Sprite path without extension
+ * @return int16_t Sprite id, or SPRITE_PACK_NONE if not in the pack
+ */
+int16_t spritePackFind(const char *name);
+
+/**
+ * @brief Packed sprite by id (O(1))
+ *
+ * @param id Id from spritePackFind
+ * @return Sprite* The sprite, or nullptr if id is out of range
+ */
+Sprite *spritePackGet(int16_t id);
+
+/**
+ * @brief Sprites in the loaded pack (ids are 0 .. count - 1)
+ */
+uint16_t spritePackCount();
+
+/**
+ * @brief Free the loaded pack and every sprite in it
+ */
+void spritePackUnload();
+
+/**
+ * @brief (Re)build the opaque span table for a transparent color
+ *
+ * Called by spriteLoad for the default key. Draws with a different key
+ * rebuild it on demand.
+ *
+ * @param sprite Pointer to the sprite
+ * @param transparentColor RGB565 color treated as transparent
+ * @return true if the span table is ready
+ */
+bool spriteBuildSpans(Sprite *sprite, uint16_t transparentColor = SPRITE_KEY_COLOR);
+
 /**
  * @brief Unload a sprite and free its RAM
  *
@@ -54,7 +250,7 @@ void spriteDraw(Sprite *sprite, int16_t x, int16_t y);
  * @param y Y coordinate
  * @param transparentColor RGB565 color to skip (default Magenta)
  */
-void spriteDrawTransparent(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor = 0xF81F);
+void spriteDrawTransparent(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor = SPRITE_KEY_COLOR);
 
 /**
  * @brief Draw a sprite with transparency, horizontally flipped
@@ -64,6 +260,42 @@ void spriteDrawTransparent(Sprite *sprite, int16_t x, int16_t y, uint16_t transp
  * @param y Y coordinate (top-left)
  * @param transparentColor RGB565 color to skip
  */
-void spriteDrawTransparentFlip(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor = 0xF81F);
+void spriteDrawTransparentFlip(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor = SPRITE_KEY_COLOR);
+
+/**
+ * @brief Draw a sprite with transparency into an off-screen buffer
+ *
+ * Used by the strip compositor. Coordinates are relative to dst; rows
+ * outside it are skipped without touching their spans.
+ *
+ * @param dst Destination TFT_eSprite (16-bit)
+ * @param sprite Pointer to the sprite
+ * @param x X coordinate within dst (top-left)
+ * @param y Y coordinate within dst (top-left)
+ * @param flip Mirror horizontally
+ * @param transparentColor RGB565 color to skip
+ */
+void spriteDrawTransparentTo(TFT_eSprite &dst, Sprite *sprite, int16_t x, int16_t y,
+                             bool flip = false, uint16_t transparentColor = SPRITE_KEY_COLOR);
+
+/**
+ * @brief Fill a tint: each channel scaled by its gain (clamped), then
+ * lifted toward full by lift (0 = none, 1 = white), optionally with red
+ * and blue swapped
+ */
+void spriteTintBuild(SpriteTint &tint, float rGain, float gGain, float bGain, float lift = 0.0f,
+                     bool swapRB = false);
+
+/**
+ * @brief spriteDrawTransparentTo with every pixel recoloured by a tint
+ *
+ * RGB565 sprites pay three small table reads and two ORs per opaque
+ * pixel. Indexed sprites only remap their 16 palette entries per draw, so
+ * their pixels cost the same as an untinted draw. Uses the default key color.
+ *
+ * @param tint Remap to apply (nullptr draws untinted)
+ */
+void spriteDrawTintedTo(TFT_eSprite &dst, Sprite *sprite, int16_t x, int16_t y,
+                        const SpriteTint *tint, bool flip = false);
 
 #endif // SD_SPRITES_H
@@ -41,11 +41,20 @@ bool sdDeleteFile(const char* path);
 // GAME DATA
 // ============================================================================
 
-// Save game state to /save/game.dat
-bool sdSaveGame(const void* data, size_t len);
+// Saves alternate between two slots, /save/game_a.dat and /save/game_b.dat,
+// so a write that dies halfway leaves the older slot intact. Each is written
+// to /save/game.tmp, flushed, then renamed into place.
+#define SD_SAVE_SLOTS 2
+#define SD_SAVE_TEMP SD_SAVE_SLOTS // sdLoadGame(): a save that never got renamed
 
-// Load game state from /save/game.dat
-bool sdLoadGame(void* data, size_t len);
+// Save game state into a slot (true only if all of it reached the card)
+bool sdSaveGame(uint8_t slot, const void* data, size_t len);
+
+// Load game state from a slot, or SD_SAVE_TEMP (returns bytes read, -1 on error)
+int32_t sdLoadGame(uint8_t slot, void* data, size_t maxLen);
+
+// Is there a file in this slot (or SD_SAVE_TEMP)?
+bool sdSaveExists(uint8_t slot);
 
 // ============================================================================
 // SPRITE LOADING (for later phases)
@@ -0,0 +1,69 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "fish.h"
+#include "food.h"
+#include "coins.h"
+#include "particles.h"
+#include "game_state.h"
+#include "touch.h"
+
+// ============================================================================
+// RENDER SNAPSHOTS
+// ============================================================================
+//
+// The update task (core 0) owns the entity stores and game data; the render
+// loop (core 1) never reads them. After each tick the update task copies
+// everything the renderer draws into a snapshot and publishes it. The
+// renderer always draws the newest published snapshot.
+//
+// Three snapshot buffers rotate through one atomic index: the update task
+// fills one, the renderer reads another, and the third holds the latest
+// publish. Neither side ever waits for the other, so a slow frame push
+// cannot stall the fixed-rate simulation.
+//
+// Entities keep their position from before the last step, so the renderer
+// can draw them between steps (snapshotInterpolate) and motion stays smooth
+// at any frame rate. The picture trails the simulation by up to one step.
+//
+
+struct GameSnapshot
+{
+    // Live rows and ids only (EntityStore::copyLive)
+    FishStore fish;
+    FoodStore food;
+    CoinStore coins;
+    ParticleStore particles;
+
+    GameData game;
+
+    // Most recent tap (tapCount changes on every new tap)
+    TouchPoint tap;
+    uint32_t tapCount;
+    unsigned long tapTime;
+
+    uint32_t tick;       // Update tick that produced this snapshot
+    uint32_t stepMicros; // micros() the last step stands for
+    bool moving;         // Last step moved entities (else nothing to interpolate)
+};
+
+// Reset the buffers (call before either side starts)
+void snapshotInit();
+
+// Update task: record a tap for the renderer's touch markers
+void snapshotNoteTap(TouchPoint tap);
+
+// Update task: copy the current game state out and publish it
+void snapshotPublish(uint32_t stepMicros, bool moving);
+
+// Render loop: newest published snapshot. Stays valid and unchanged until
+// the next call.
+const GameSnapshot &snapshotAcquire();
+
+// Render loop: snap with entities placed where they were at nowMicros,
+// between their previous and current step positions
+void snapshotInterpolate(const GameSnapshot &snap, uint32_t nowMicros, GameSnapshot &out);
+
+#endif // SNAPSHOT_H
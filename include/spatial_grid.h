@@ -0,0 +1,78 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ============================================================================
+// UNIFORM SPATIAL GRID
+// ============================================================================
+//
+// Broadphase for "what is near this point" queries (fish finding food, taps
+// hitting coins or fish). The screen is cut into GRID_CELL_SIZE squares and
+// each live entity's id is filed under the cell holding its position. A
+// query only looks at the cells its radius overlaps, so it costs the same
+// however many entities sit elsewhere in the tank.
+//
+// The grid is rebuilt in one O(n) counting-sort pass (gridBuild) whenever
+// its owner has moved or spawned something since the last query. Removing
+// an entity does not need a rebuild: ids are stable, and callers skip ids
+// that no longer have a row.
+//
+
+#define GRID_COLS ((SCREEN_WIDTH + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE)
+#define GRID_ROWS ((SCREEN_HEIGHT + GRID_CELL_SIZE - 1) / GRID_CELL_SIZE)
+#define GRID_CELLS (GRID_COLS * GRID_ROWS)
+
+struct SpatialGrid
+{
+    uint16_t cellStart[GRID_CELLS + 1]; // Cell c owns items[cellStart[c] .. cellStart[c + 1] - 1]
+    uint16_t *items;                    // Entity ids, grouped by cell
+    uint16_t capacity;                  // Size of items (the store capacity)
+    bool dirty;                         // Positions changed since the last build
+};
+
+// Attach storage (one item per store entry) and mark the grid stale
+void gridInit(SpatialGrid &grid, uint16_t *items, uint16_t capacity);
+
+// Cell holding a point (clamped to the screen)
+static inline uint16_t gridCellOf(float x, float y)
+{
+    int32_t cx = constrain((int32_t)x / GRID_CELL_SIZE, 0, GRID_COLS - 1);
+    int32_t cy = constrain((int32_t)y / GRID_CELL_SIZE, 0, GRID_ROWS - 1);
+    return (uint16_t)(cy * GRID_COLS + cx);
+}
+
+// File every live entity of an EntityStore under its id
+template <typename Store>
+void gridBuild(SpatialGrid &grid, const Store &store)
+{
+    uint16_t *start = grid.cellStart;
+    memset(start, 0, sizeof(grid.cellStart));
+
+    // Count per cell, shifted by one so the prefix sum yields start offsets
+    for (uint16_t r = 0; r < store.count; r++)
+        start[gridCellOf(store.x[r], store.y[r]) + 1]++;
+    for (uint16_t c = 0; c < GRID_CELLS; c++)
+        start[c + 1] += start[c];
+
+    // Fill in row order; start[c] walks up to the next cell's start
+    for (uint16_t r = 0; r < store.count; r++)
+        grid.items[start[gridCellOf(store.x[r], store.y[r])]++] = store.id[r];
+
+    // Undo the walk: shift back so start[c] is cell c's first item again
+    for (uint16_t c = GRID_CELLS; c > 0; c--)
+        start[c] = start[c - 1];
+    start[0] = 0;
+
+    grid.dirty = false;
+}
+
+// Ids filed within the square of +-radius around (x, y), in ascending id
+// order (past maxOut, the lowest maxOut of them). Candidates only:
+// callers still test the real distance and skip ids that were removed
+// since the build. Returns how many were written.
+uint16_t gridQuery(const SpatialGrid &grid, float x, float y, float radius,
+                   uint16_t *out, uint16_t maxOut);
+
+#endif // SPATIAL_GRID_H
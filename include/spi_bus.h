@@ -0,0 +1,56 @@
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// ============================================================================
+// SHARED HSPI BUS
+// ============================================================================
+//
+// The display and the touch controller share HSPI, but they are driven from
+// different cores: the render loop pushes frames on core 1 while the touch
+// sampler reads the XPT2046 on core 0. There is one SPIClass for the bus,
+// TFT_eSPI's, set up once by the display; touch borrows it.
+//
+// Whoever talks on the bus holds this lock. The renderer holds it for a
+// whole frame, but a frame is many strip transfers, and between two of them
+// (with nothing in flight) it hands the bus to a waiting touch read, at most
+// once every BUS_TOUCH_SLOT_MS. So a touch read waits for the current strip,
+// not the whole frame, and never runs during a DMA transfer.
+//
+// Touch runs at SPI_TOUCH_FREQUENCY. Only the clock changes: the display's
+// next transaction sets SPI_FREQUENCY again, the bus is never re-begun.
+//
+
+// Create the lock (call in setup, before any task starts)
+void busInit();
+
+// The bus's SPIClass (valid once the display is initialised)
+SPIClass &busSpi();
+
+// Display: block until the bus is free, then own it
+void busLock();
+
+// Own the bus if it is free right now
+bool busTryLock();
+
+void busUnlock();
+
+// Display, between strips: is a touch read waiting, and is a slot due?
+bool busTouchDue();
+
+// Display, between strips (nothing in flight, CS released): let the waiting
+// touch read run, and own the bus again once it is done
+void busTouchSlot();
+
+// Touch: own the bus at touch speed (waits for the next slot if a frame is
+// going out)
+void busTouchBegin();
+
+void busTouchEnd();
+
+// Touch reads slotted in between strips since boot
+uint32_t busTouchSlots();
+
+#endif // SPI_BUS_H
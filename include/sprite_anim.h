@@ -0,0 +1,78 @@
+#ifndef SPRITE_ANIM_H
+#define SPRITE_ANIM_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+#include "sd_sprites.h"
+
+// ============================================================================
+// SPRITE-SHEET ANIMATION
+// ============================================================================
+//
+// An animation is a sheet on SD: every frame the same size, side by side
+// in one sprite (so it loads, packs and converts like any other sprite).
+// animInit cuts the sheet into one sprite per frame. A one-frame sheet is
+// used as is, with no copy.
+//
+// Drawing a frame mirrored normally reverses each opaque run into a line
+// buffer first. animCacheMirrors builds a pre-flipped copy of every frame
+// instead, while the copies fit in ANIM_MIRROR_BYTES (shared by all
+// animations, first come first served), so mirrored draws become the same
+// straight span copy as unflipped ones. Frames without a copy still draw
+// mirrored the slow way.
+//
+// animScale builds a resized copy of a whole animation once, at load, so
+// differently sized variants (fish growth stages) draw as plain span
+// copies too. Scaled copies share ANIM_SCALED_BYTES; an animation that
+// doesn't fit isn't built and the caller draws another size instead.
+//
+
+#define ANIM_MAX_FRAMES 8
+
+struct SpriteAnim
+{
+    Sprite *sheet; // nullptr while not loaded, and for scaled copies
+    bool scaled;   // Frames count against ANIM_SCALED_BYTES
+    uint8_t frameCount;
+    uint16_t frameWidth;
+    uint16_t height;
+    Sprite *frames[ANIM_MAX_FRAMES];   // frames[0] is the sheet itself when it has one frame
+    Sprite *mirrored[ANIM_MAX_FRAMES]; // Pre-flipped copies (nullptr: flip while drawing)
+};
+
+// Split a sheet into frames of frameWidth (the sheet's width if 0). The
+// animation owns the sheet from here on. False if the sheet is missing
+// or a frame copy fails (the animation is left empty).
+bool animInit(SpriteAnim &anim, Sprite *sheet, uint16_t frameWidth = 0);
+
+// Build mirrored copies of the frames while ANIM_MIRROR_BYTES allows.
+// Returns how many frames have one.
+uint8_t animCacheMirrors(SpriteAnim &anim);
+
+// Resize every frame of src into out (frameWidth x height, box filtered
+// if ANIM_SCALE_SMOOTH). False if it doesn't fit in ANIM_SCALED_BYTES or
+// a frame fails (out is left empty).
+bool animScale(SpriteAnim &out, const SpriteAnim &src, uint16_t frameWidth, uint16_t height);
+
+// Free the frames, mirrors and sheet (packed sheets stay with the pack)
+void animFree(SpriteAnim &anim);
+
+// Frame to show for a running frame counter (wraps around the sheet)
+static inline uint8_t animFrameIndex(const SpriteAnim &anim, uint8_t frame)
+{
+    return anim.frameCount ? frame % anim.frameCount : 0;
+}
+
+// Draw a frame with transparency into dst, top-left at (x, y), optionally
+// mirrored and recoloured
+void animDrawTo(TFT_eSprite &dst, const SpriteAnim &anim, uint8_t frame, int16_t x, int16_t y,
+                bool flip, const SpriteTint *tint = nullptr);
+
+// RAM used by mirror caches so far
+uint32_t animMirrorBytes();
+
+// RAM used by scaled animations so far
+uint32_t animScaledBytes();
+
+#endif // SPRITE_ANIM_H
@@ -1,7216 +0,0 @@
-// bg_delta.png - Auto-generated sprite data
-// Generated by img2code.py
-// Size: 240x240 pixels, 115200 bytes
-
-#ifndef SPRITE_BG_DELTA_H
-#define SPRITE_BG_DELTA_H
-
-#include <Arduino.h>
-
-#define SPRITE_BG_DELTA_WIDTH  240
-#define SPRITE_BG_DELTA_HEIGHT 240
-
-const uint16_t sprite_bg_delta[57600] PROGMEM = {
-    0xB65A, 0xB65A, 0xB67A, 0xBE7A, 0xBE9A, 0xBE9A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB67A, 0xB67A, 0xB69B, 0xB69B,
-    0xB69A, 0xB67A, 0xAE7A, 0xBEBB, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF,
-    0xD77E, 0x9598, 0x8537, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8557, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8D57, 0x8D57,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8557, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D57, 0x8D57,
-    0x8557, 0x8557, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8D57, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8536, 0xA5F9, 0xAE5A,
-    0xAE3A, 0xA63A, 0x8D77, 0x8D57, 0x8537, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8537, 0x9DD8,
-    0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xCF3D, 0xB69B, 0xB67A, 0xB69B, 0xBE9B, 0xB69A, 0xB69B, 0xB69B,
-    0xBEBB, 0xB67B, 0xAE5A, 0xC6FC, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xDFBF, 0xDFBE, 0xCF3D, 0xD77E, 0xDFBE, 0xDFDF,
-    0xDFBE, 0xDFBF, 0xE7DF, 0xC6FC, 0xB67A, 0xBE9B, 0xBE7A, 0xB67A,
-    0xBE7A, 0xBE9A, 0xBE9A, 0xBE7A, 0xBE7A, 0xBE9A, 0xBE7A, 0xBE7A,
-    0xBE7A, 0xBE9B, 0xBE7A, 0xBE7A, 0xBE7A, 0xBE7A, 0xBE7A, 0xB67A,
-    0xB67A, 0xBE7A, 0xBE7A, 0xBE9B, 0xBE9A, 0xBE7A, 0xBE9B, 0xBE9B,
-    0xBE9A, 0xBE7A, 0xBE9B, 0xBE9B, 0xB69B, 0xB69A, 0xB69B, 0xB69B,
-    0xB69A, 0xB67A, 0xB69B, 0xB67A, 0xBEBB, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xC71D, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8D57, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8D57, 0x8557,
-    0x8557, 0x8557, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D57,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8537, 0xB67A, 0xDFBF, 0xE7DF,
-    0xE7DF, 0xDFDF, 0xD75E, 0xCF3D, 0x9DD9, 0x8537, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8537, 0x9DD9, 0xDF9E,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xC6FC,
-    0xB67A, 0xB69B, 0xB69B, 0xBE9B, 0xBE9B, 0xB69B, 0xB69B, 0xBE9B,
-    0xB69B, 0xBEBB, 0xCF3D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xD77E, 0xD77E, 0xBEBB, 0xB69B, 0xB67A, 0xB69B, 0xB69B, 0xCF3D,
-    0xDFBF, 0xCF5D, 0xBEBB, 0xB65A, 0xBE9B, 0xBE9B, 0xB67A, 0xB67A,
-    0xBE9A, 0xBE9A, 0xB67A, 0xBE7A, 0xBE9B, 0xBE7A, 0xB67A, 0xBE7A,
-    0xBE9B, 0xBE7A, 0xB65A, 0xBE7A, 0xBE9B, 0xB67A, 0xB65A, 0xB67A,
-    0xAE39, 0xB67A, 0xBE7A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A,
-    0xBE7A, 0xBE9A, 0xBE9A, 0xB69A, 0xBE9A, 0xBE9A, 0xB69B, 0xB69A,
-    0xB69A, 0xB69A, 0xB69B, 0xBE9B, 0xAE5A, 0xD75E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7BF, 0xD77E, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8537, 0x9DD8, 0xCF1D, 0xE7DF, 0xDFBF, 0xDF9F,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBE, 0xA5F9, 0x8537, 0x8557,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x95B8, 0xDF9E, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xBEDC, 0xAE5A,
-    0xB69B, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB69A, 0xB69B,
-    0xB69B, 0xBEBB, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67B, 0xB69B,
-    0xC6BB, 0xB67A, 0xB67A, 0xBE9B, 0xB67A, 0xBE9A, 0xB67A, 0xB67A,
-    0xB67A, 0xBE9A, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xB67A, 0xB67A,
-    0xBE7B, 0xBE7A, 0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A,
-    0x8516, 0xA5F9, 0xBE9A, 0xB67A, 0xBE9A, 0xBE9A, 0xB67A, 0xBE7A,
-    0xB67A, 0xB67A, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB69A,
-    0xB69A, 0xB69A, 0xB69B, 0xBE9B, 0xB67A, 0xC6FC, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xCF1D, 0xCF1D, 0xC71C, 0xCF5D,
-    0xDFBE, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xBEDC, 0x7D16, 0x8537, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8537, 0x8537, 0x8537, 0x8537, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8557, 0x8D57, 0x8D57, 0x8D37, 0x8D57, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D57,
-    0x8557, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8537, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57,
-    0x8D57, 0x8537, 0x8D77, 0xD75E, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xE7FF, 0xBEDC, 0x8D77, 0x9DB8,
-    0x8536, 0x8D77, 0x8D57, 0x8D78, 0x8516, 0xB69B, 0xE7FF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC71C, 0xB67A, 0xB69B,
-    0xB67B, 0xC6FC, 0xCF1D, 0xC6FC, 0xC71C, 0xCF3D, 0xCF5D, 0xC6DC,
-    0xBEBB, 0xCF1D, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC71C, 0xB67A,
-    0xBE9B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xBE9B, 0xBE9B,
-    0xB67A, 0xB69A, 0xBE9B, 0xBE9B, 0xBE7A, 0xB67A, 0xBE7A, 0xBE7B,
-    0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0x7CF6, 0x9DD8, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A,
-    0xBE7A, 0xB67A, 0xB67A, 0xBE9A, 0xB67A, 0xB67A, 0xB69B, 0xB69A,
-    0xB69A, 0xB67A, 0xB69B, 0xB69B, 0xB67B, 0xBE9B, 0xD77E, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC, 0xAE5A, 0xB67A, 0xB67A, 0xB69A,
-    0xBEDB, 0xCF5D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xAE5A, 0x9DD8, 0x8D57, 0x8557, 0x8D57, 0x8537,
-    0x8516, 0x8D57, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x8537, 0x8537,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8537, 0xBEDC, 0xE7DF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xCF3D, 0xDF9E, 0xC6FC, 0xBEDC, 0xCF1D, 0xD75E, 0xDF7E,
-    0xA619, 0x8516, 0x8557, 0x8537, 0x9598, 0xD77E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xBEBB, 0xBEBB, 0xBEDC,
-    0xC71C, 0xE7DF, 0xDFBF, 0xE7BF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDF9E,
-    0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xC6FC, 0xB67A, 0xBE9B,
-    0xB67A, 0xB69B, 0xB69B, 0xB67B, 0xB69B, 0xB67A, 0xB69A, 0xBE7B,
-    0xBE9A, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xB67A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xB67A,
-    0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB67A,
-    0x8537, 0x8557, 0x95B8, 0xB65A, 0xBE9A, 0xB67A, 0xB67A, 0xBE9A,
-    0xB67A, 0xBE7A, 0xBE9B, 0xB69A, 0xB69A, 0xB69A, 0xB69B, 0xB69B,
-    0xB69A, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB67A, 0xB67A, 0xC6FC,
-    0xCF1D, 0xD75D, 0xDFBF, 0xDF9E, 0xC71C, 0xBEBB, 0xBEBB, 0xB69B,
-    0xB67A, 0xB67A, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xBEDC, 0x8557, 0x8537, 0xA619,
-    0xBEBB, 0xC6FC, 0xE7DF, 0xDFDF, 0xE7DF, 0xDFDF, 0xC6FC, 0x9DF9,
-    0x8D57, 0x8537, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8537, 0x8537,
-    0x8537, 0x8537, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x8557,
-    0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8557, 0x8557, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8557, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8537, 0x8537,
-    0x8537, 0x8537, 0xCF3D, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF,
-    0xC6FC, 0xB67A, 0xB69B, 0xB65A, 0xAE5A, 0xB67A, 0xBEBC, 0xC6DC,
-    0xD77E, 0xBEDC, 0xBEBC, 0x95B8, 0xAE5A, 0xE7DF, 0xDFBE, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xC71C, 0xB69B, 0xD77E,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xE7BF, 0xBEBB, 0xB67B, 0xB69B,
-    0xB67A, 0xB69B, 0xB69B, 0xB67A, 0xB67A, 0xB69B, 0xB69B, 0xB67A,
-    0xB67A, 0xB69B, 0xB67A, 0xB67A, 0xBE7A, 0xBE9B, 0xB67A, 0xB67A,
-    0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xBE9A, 0xBE7A, 0xB65A, 0xB67A,
-    0xBE9A, 0xB67A, 0xB65A, 0xB67A, 0xBE7B, 0xB65A, 0xB67A, 0xB67A,
-    0xAE3A, 0x8516, 0x8557, 0xA619, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xBE7A, 0xB69A, 0xB67A, 0xB69A, 0xBE9A, 0xB69A, 0xB69A,
-    0xB69A, 0xB69A, 0xB69A, 0xB69A, 0xB69B, 0xBE9B, 0xB67A, 0xB67A,
-    0xB67A, 0xAE5A, 0xBEDC, 0xCF3D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xCF1D, 0xB69B, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0x9DF9, 0xAE5A, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xCF3D, 0x8D77, 0x8537, 0x8D57, 0x8D57, 0x8537, 0x9DF9, 0xBEFC,
-    0xCF3D, 0x9598, 0x7D16, 0x8537, 0x8557, 0x8537, 0x8537, 0x8557,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8537, 0x8D57, 0xA619, 0xA63A,
-    0xA63A, 0x8D57, 0xB67B, 0xDFDF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xB69B, 0xB67B, 0xB69B, 0xB69B, 0xB67B, 0xB69B, 0xAE5A, 0xCF5D,
-    0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF, 0xB69B, 0xDF9E, 0xE7BF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xC71C, 0xDF9F, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6DC, 0xCF3D, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xBEBB, 0xB67A, 0xB69B,
-    0xB67B, 0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xAE3A, 0xB65A, 0x9DD8, 0x7CF6, 0x95B8, 0xB67A, 0xB67A, 0xB67A,
-    0xBE7A, 0xB67A, 0xB69A, 0xB69A, 0xB67A, 0xB69A, 0xB69B, 0xBE9A,
-    0xB69A, 0xBE9A, 0xBE9B, 0xBE9B, 0xB69B, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xB69B, 0xB67A, 0xAE5A, 0xC6FC, 0xD79E, 0xCF3D, 0xCF3D,
-    0xDF9F, 0xD77E, 0xBEBB, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC, 0xCF3D, 0xE7DF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xCF3D, 0x8D57, 0x8537, 0x8D57, 0x8537, 0x9DB8, 0x9DB8,
-    0xAE5A, 0xCF1D, 0xAE5A, 0x9598, 0x8D78, 0xA619, 0xA5F9, 0x8D77,
-    0x8537, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8557, 0x8557, 0x8D77, 0xC6FC, 0xE7DF, 0xE7DF,
-    0xE7FF, 0xB69B, 0x9DF9, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xB69B,
-    0xB67A, 0xBE9B, 0xBE9B, 0xB69B, 0xB67A, 0xAE5A, 0xCF3D, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xD77E, 0xD77E,
-    0xE7DF, 0xC6DC, 0xAE5A, 0xBEBB, 0xB67B, 0xCF1D, 0xD75D, 0xB6BB,
-    0xC6FC, 0xDFBF, 0xDFBF, 0xDFBF, 0xCF3D, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xE7BF, 0xD77E, 0xB67A, 0xB67A, 0xB69A, 0xB69B,
-    0xB69B, 0xB67B, 0xBE9A, 0xBE9B, 0xB69B, 0xB69A, 0xB69A, 0xBE9B,
-    0xB67A, 0xB67A, 0xBE7A, 0xBE9B, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xB67A, 0xBE7A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A,
-    0x8D57, 0xAE39, 0xB67B, 0x9DD9, 0x8516, 0xA5F9, 0xA5F9, 0xAE59,
-    0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xB69A, 0xBE9B,
-    0xB69A, 0xB69A, 0xBE9B, 0xBE9B, 0xB69A, 0xB69A, 0xB69B, 0xB69A,
-    0xB69A, 0xB69B, 0xB69A, 0xB67A, 0xB67A, 0xB69B, 0xBEBB, 0xAE5A,
-    0xBEBB, 0xC6FC, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xC71C, 0x8D57, 0x8537, 0x8D57, 0x8537, 0x8537,
-    0x8516, 0x9598, 0xBEBB, 0xD73D, 0xAE39, 0xB69B, 0xCF3D, 0xAE3A,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8557, 0xBEBC, 0xD77E, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xBEDB, 0xAE39,
-    0xB67A, 0xBE9B, 0xBE9B, 0xBE9B, 0xB69B, 0xCF3D, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xBEBB, 0xBEBB,
-    0xC6DC, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB69B,
-    0xD79E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xD77E,
-    0xCF5D, 0xC71D, 0xC6FC, 0xB67A, 0xB67A, 0xB69B, 0xB69A, 0xB69A,
-    0xB67A, 0xB67A, 0xB69B, 0xBE7A, 0xBE7A, 0xB67A, 0xB69A, 0xB67A,
-    0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xBE7A, 0xBE7A, 0xBE7A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A,
-    0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xBE7A,
-    0x7CF6, 0x9DD8, 0xB67A, 0xB67A, 0xA5F9, 0x9577, 0x95B8, 0xA5F9,
-    0xBEBB, 0xBE7A, 0xB67A, 0xB69A, 0xB69A, 0xBE9B, 0xB69B, 0xB69A,
-    0xB69A, 0xBE9B, 0xBE9B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B,
-    0xB69B, 0xB69B, 0xB69B, 0xB67A, 0xB69B, 0xB69B, 0xBE9B, 0xB69B,
-    0xB67A, 0xAE5A, 0xCF1D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xE7DF, 0xBEDC, 0x8536, 0x8D57, 0x8D57, 0x8D57,
-    0x8D77, 0x8D57, 0x8537, 0x9598, 0x8D77, 0x7D16, 0x8537, 0x8D57,
-    0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57,
-    0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8537, 0x8D77, 0xDF9F, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xBEDC, 0xBEDC,
-    0xAE5A, 0xB69B, 0xBEBB, 0xAE5A, 0xC6DC, 0xE7DF, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xC71C, 0xB67A, 0xB69B, 0xB69A,
-    0xB67A, 0xB67A, 0xB69B, 0xB67A, 0xBEDC, 0xCF3D, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xD77E, 0xB69B, 0xB67A,
-    0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE9B, 0xB67B, 0xB67A,
-    0xB67A, 0xBE7B, 0xB67A, 0xB65A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A,
-    0xBE7A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB67A,
-    0xBE7A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB63A, 0xB65A, 0xB65A,
-    0x7D16, 0x9598, 0xB65A, 0xAE39, 0xB67A, 0xA5F9, 0x8D57, 0x8D77,
-    0xA5F9, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB69A, 0xB69A,
-    0xB69A, 0xBE9A, 0xB69A, 0xB69A, 0xB69B, 0xB69B, 0xB69A, 0xB67A,
-    0xB69A, 0xB69B, 0xB69A, 0xB67A, 0xB69B, 0xBE9B, 0xB69A, 0xB67A,
-    0xBE9B, 0xB69B, 0xB67A, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xD75E, 0xCF5D, 0xC71C, 0xB69B, 0xCF3D, 0xBEBB,
-    0xCF1D, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xE7DF, 0xB67B, 0x8537, 0x8D57, 0x8D57,
-    0x8537, 0x8537, 0x8D57, 0x8537, 0x8537, 0x8557, 0x8537, 0x8537,
-    0x8537, 0x8D57, 0x8537, 0x8D57, 0x8557, 0x8537, 0x8D57, 0x8537,
-    0x8557, 0x8D57, 0x8537, 0x8D57, 0x8537, 0x8557, 0x8D57, 0x8537,
-    0x8D57, 0x8557, 0x8537, 0x8D57, 0x8537, 0x8D57, 0x8557, 0x8537,
-    0x8D57, 0x8537, 0x8557, 0x8D57, 0x8537, 0x8D57, 0x8537, 0x8557,
-    0x8D57, 0x8537, 0x8D57, 0x8557, 0x8537, 0x8D57, 0x8537, 0x8557,
-    0x8557, 0x8537, 0x8D57, 0x8537, 0x8557, 0x8557, 0x8537, 0x8D57,
-    0x8537, 0x8557, 0x8D57, 0x8537, 0x8D57, 0x8557, 0x8537, 0x8D57,
-    0x8537, 0x8D57, 0x8557, 0x8537, 0x8D57, 0x8537, 0x8557, 0x8D57,
-    0x8537, 0x8D57, 0x8557, 0x8557, 0x8D57, 0x8537, 0x8D57, 0x8D57,
-    0x8537, 0x8557, 0x8D77, 0xD79E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xD77E, 0xB69B, 0xBE9B, 0xC6DC, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xCF3D, 0xB67A, 0xBE9B, 0xB69B, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xBE9B, 0xD79E, 0xE7DF, 0xE7DF, 0xDF9E,
-    0xBEBB, 0xD77E, 0xE7DF, 0xDFBF, 0xD77E, 0xCF3D, 0xD77E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD77E, 0xBEDB, 0xB67A, 0xB67A, 0xB67A,
-    0xBE9B, 0xBE9B, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xBE7A, 0xB67A, 0xB65A, 0xB67A, 0xBE7A, 0xB67A, 0xB65A,
-    0xB65A, 0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xAE19, 0x8D57,
-    0x7D16, 0x9DD8, 0xB639, 0xAE39, 0xAE39, 0xB67A, 0xA5F9, 0x7D16,
-    0x8D77, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xBE9B, 0xBE7A,
-    0xB69A, 0xB69A, 0xBE9A, 0xB69B, 0xB69A, 0xB69B, 0xBE9B, 0xB67A,
-    0xB67A, 0xB69A, 0xBE9B, 0xBE9B, 0xB65A, 0xB67A, 0xB67A, 0xAE5A,
-    0xB65A, 0xBEBB, 0xBE9B, 0xCF3D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xCF3D, 0xAE39, 0xAE39, 0xB67A, 0xB67A, 0xB67A,
-    0xAE5A, 0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC, 0x7CF6, 0x9DB8, 0x8D57,
-    0xB67A, 0xC6FC, 0xA619, 0x8D98, 0x8537, 0x8517, 0x8537, 0x9DD8,
-    0x95B8, 0x8537, 0x9DD8, 0x8D57, 0x8D77, 0x9DD9, 0x8536, 0x9DD8,
-    0x8D77, 0x8D57, 0x9DD8, 0x8537, 0x95B8, 0x9598, 0x8537, 0xA5F9,
-    0x8537, 0x9598, 0x9DD9, 0x8536, 0x9DD9, 0x8D57, 0x8D77, 0x9DD9,
-    0x8516, 0x9DB8, 0x9578, 0x8537, 0x9DD9, 0x8537, 0x95B8, 0x9598,
-    0x8537, 0x9DF9, 0x8537, 0x9598, 0x9DB8, 0x8517, 0x9DD9, 0x8D77,
-    0x8D77, 0x9DD8, 0x8537, 0x9DB8, 0x8D57, 0x8D77, 0x9DD9, 0x8536,
-    0x9DD9, 0x8D77, 0x8557, 0x9DD8, 0x8537, 0x9598, 0x95B8, 0x8537,
-    0x9DD9, 0x8D77, 0x8D57, 0x9DD9, 0x8517, 0x95B8, 0x95B8, 0x8537,
-    0x9DD9, 0x8537, 0x9598, 0x95B8, 0x8516, 0x9DF9, 0x8D57, 0x8D57,
-    0x9DD9, 0x8537, 0x8D77, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xC71C,
-    0xC71D, 0xC6DC, 0xBE9B, 0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xCEFC, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xD77E, 0xE7DF, 0xD79E, 0xC6FC, 0xBEBB,
-    0xBEBB, 0xB69A, 0xD77E, 0xCF1D, 0xAE5A, 0xCF3D, 0xB67A, 0xD77E,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xC71D, 0xAE39, 0xB67A, 0xB69B, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xBE7A, 0xBE9B,
-    0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB65A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xAE3A, 0x8516, 0x7D16,
-    0x7D16, 0x8536, 0x9DB8, 0xB65A, 0xB65A, 0xAE39, 0xB65A, 0xA619,
-    0x8D98, 0x9577, 0x8557, 0xA619, 0xBE9A, 0xB65A, 0xB67A, 0xBE9B,
-    0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xB67A, 0xB67A, 0xB69B, 0xB69A,
-    0xB67A, 0xB69B, 0xB69B, 0xC6FC, 0xCF3D, 0xC6DC, 0xCF3D, 0xC6FC,
-    0xBE9B, 0xB67A, 0xCF1D, 0xDF9E, 0xD77E, 0xD77E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xD77E, 0xB67A, 0xB69B, 0xBE9B, 0xBE9B,
-    0xB67B, 0xB69B, 0xD79E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xCF3D, 0x95B8, 0xA5F9, 0xCF3D,
-    0xE7DF, 0xE7FF, 0xDFBF, 0xDF9E, 0xCF3D, 0x9DD8, 0x8537, 0x9578,
-    0x8D77, 0x8D77, 0x8D77, 0x8D57, 0x8D77, 0x8D78, 0x8D57, 0x8D77,
-    0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77,
-    0x8D77, 0x8D77, 0x8D77, 0x8D57, 0x8D77, 0x8D77, 0x8D77, 0x8D77,
-    0x8D77, 0x8D77, 0x8D77, 0x8D57, 0x8D77, 0x8D57, 0x8D77, 0x8D77,
-    0x8D57, 0x8D77, 0x8D57, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77,
-    0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D57, 0x8D77, 0x9577, 0x8D57,
-    0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D57,
-    0x8D77, 0x8D77, 0x8D57, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D57,
-    0x8D77, 0x8D77, 0x8D57, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8D77,
-    0x8D77, 0x8D57, 0x8537, 0xA619, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7BF, 0xDF9E, 0xB69B, 0xBEDC, 0xAE5A, 0xAE5A,
-    0xAE3A, 0xB67A, 0xB67A, 0xD75E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC, 0xB67A, 0xB69A, 0xB67A,
-    0xB69B, 0xB67A, 0xCF3D, 0xDFBF, 0xDFBF, 0xD77E, 0xAE5A, 0xB69B,
-    0xBE9B, 0xB69B, 0xAE3A, 0xB67A, 0xDF9E, 0xE7DF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xCF3D, 0xBE9B, 0xBEBB, 0xB67A, 0xB67B, 0xB69B,
-    0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB67A,
-    0xB65A, 0xB65A, 0xBE7A, 0xBE7A, 0xA5F9, 0x8516, 0x8516, 0x8D57,
-    0x8D77, 0x8D77, 0x7D16, 0x9DB8, 0xAE39, 0xB65A, 0xB65A, 0xAE3A,
-    0xB67A, 0xA5F9, 0x8537, 0xA5D8, 0xBE9A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB69A, 0xB69A, 0xB69A, 0xB67A, 0xB67A, 0xB69A,
-    0xBEBB, 0xB69B, 0xBEDB, 0xB67A, 0xBEDC, 0xDFBF, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBE, 0xBEBB, 0xB67A, 0xB69B, 0xB67B, 0xBEDC, 0xDFBF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xE7DF, 0xD79E, 0xB67A, 0xB67B, 0xBE9B,
-    0xB69B, 0xB67A, 0xB67A, 0xCF3D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xA619, 0xD77E, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xE7FF, 0xC71C, 0x9DD8, 0x8D57,
-    0x8D77, 0xA5F9, 0x8516, 0x95B8, 0x95B8, 0x8537, 0xA5F9, 0x8536,
-    0x95B8, 0x9DB8, 0x8516, 0xA5F9, 0x8D57, 0x8D77, 0x9DD9, 0x8516,
-    0xA5F9, 0x8D77, 0x8D57, 0x9DF9, 0x8516, 0x9DB8, 0x95B8, 0x8537,
-    0xA619, 0x8557, 0x9598, 0x9DB8, 0x8516, 0xA5F9, 0x8D57, 0x8D77,
-    0x9DB8, 0x8516, 0x9DD9, 0x9577, 0x8D37, 0xA5F9, 0x8516, 0x9DB8,
-    0x9598, 0x8537, 0xA5F9, 0x8516, 0x9DB8, 0x9598, 0x8536, 0xA5F9,
-    0x8536, 0x9598, 0x9DD8, 0x7D16, 0x9DD8, 0x9578, 0x8557, 0xAE19,
-    0x8537, 0x9DD9, 0x9598, 0x8536, 0xA5F9, 0x8557, 0x8D77, 0x9DD8,
-    0x8537, 0xA5F9, 0x8D77, 0x8D57, 0xA619, 0x8517, 0x95B8, 0x95B8,
-    0x8537, 0x9DD9, 0x9578, 0xD75E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xBEBB, 0xB69B, 0xAE5A, 0xB69B, 0xD79E,
-    0xD75E, 0xD75E, 0xCF5D, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xD77E, 0xD77E, 0xC6FC, 0xB67A, 0xB67B, 0xB69B, 0xB67A,
-    0xB69A, 0xBEBB, 0xD77E, 0xDFDF, 0xDFBF, 0xDFBF, 0xC6DC, 0xB67A,
-    0xB67A, 0xB65A, 0xC71C, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xCF5D, 0xDF9E, 0xC6FC, 0xBEDB, 0xB69B, 0xB69A,
-    0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xB67A, 0xB65A, 0xB65A,
-    0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB65A, 0xB65A,
-    0xB67A, 0xAE3A, 0x95B8, 0x9598, 0x8516, 0x8537, 0x7D16, 0x9DB8,
-    0x9DD8, 0xBE9B, 0xA619, 0x8557, 0x7CF5, 0x9597, 0xB65A, 0xB65A,
-    0xB65A, 0xBE9B, 0xB65A, 0xA5D8, 0xAE39, 0xBE9B, 0xBE9B, 0xB65A,
-    0xB67A, 0xBE9A, 0xB69A, 0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67A,
-    0xBE9B, 0xCF3D, 0xCF3D, 0xDFBF, 0xC6FC, 0xD77E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xC6FC, 0xD77E, 0xC71C, 0xBEBB,
-    0xBE9B, 0xBEDB, 0xBEBB, 0xCF5D, 0xE7DF, 0xCF5D, 0xB67A, 0xB69B,
-    0xBE9B, 0xB69B, 0xB67A, 0xBEBB, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xC6DC, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0x9597, 0x9DD8,
-    0x95B8, 0x9577, 0xA5F9, 0x8537, 0x9577, 0x9DD9, 0x7CF6, 0x9DD8,
-    0x8D57, 0x8537, 0xA619, 0x8516, 0x95B8, 0x9598, 0x8537, 0xA5F9,
-    0x7D16, 0x9DB8, 0x9DF9, 0x7CF6, 0xA5F9, 0x8D57, 0x8D77, 0xA5F9,
-    0x7CF6, 0x9DD8, 0x8D77, 0x8537, 0xA5F9, 0x7D16, 0x9DD8, 0x9598,
-    0x8537, 0xA619, 0x8516, 0x9598, 0x9DB8, 0x7D16, 0xA5F9, 0x8537,
-    0x9577, 0x9DD9, 0x7CF6, 0xA5F9, 0x8537, 0x8D77, 0x9DD8, 0x7CF6,
-    0x9DD9, 0x8D57, 0x8536, 0xA5F9, 0x8516, 0x9598, 0x9598, 0x8516,
-    0x8537, 0x7D16, 0x9598, 0xA5F9, 0x7CF6, 0x9598, 0x8D77, 0x8516,
-    0x9DB8, 0x7CF6, 0x95B8, 0x95B8, 0x8516, 0x8557, 0x8537, 0x8D77,
-    0x9DD8, 0x7CF6, 0xB67B, 0xE7DF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xBEBB, 0xAE5A, 0xBEBB, 0xC6FC, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xCF1D, 0xC6DC, 0xCF1C,
-    0xBEBB, 0xB69B, 0xBE9B, 0xB65A, 0xB67A, 0xB69A, 0xB67B, 0xB67A,
-    0xBE9B, 0xB67A, 0xB69B, 0xBEDC, 0xDF9E, 0xE7DF, 0xB69B, 0xAE5A,
-    0xB67A, 0xD75D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xC6DB, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xBE9B,
-    0xBE9B, 0xB67A, 0xBE9B, 0xBE9A, 0xBE9A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xA5F9, 0x9DD8,
-    0x9DD8, 0x8D57, 0x7CD6, 0x8516, 0x9598, 0x7D16, 0x9DB8, 0x8516,
-    0x8536, 0xA5F9, 0xBE7A, 0xAE3A, 0x95B8, 0x7D16, 0x8D57, 0xB67A,
-    0xBE9B, 0xB65A, 0xAE5A, 0xAE19, 0x9DD8, 0x9DD8, 0xAE5A, 0xB65A,
-    0xAE39, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xB67A,
-    0xB67A, 0xBE9B, 0xCF3D, 0xCF1D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xCF3D, 0xB69A,
-    0xB67A, 0xB67A, 0xAE5A, 0xBEBB, 0xDFBF, 0xDFBF, 0xB69B, 0xB67A,
-    0xB69B, 0xB69B, 0xAE5A, 0xB67A, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7BF, 0xCF3D, 0xB67A, 0xB67A, 0xCF1D, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC71C, 0x9577,
-    0x9DD8, 0x9DB8, 0x8D57, 0x9DB8, 0x9DB8, 0x8537, 0x9DD8, 0x9577,
-    0x9598, 0x95B8, 0x8557, 0x9DD8, 0x8D57, 0x8D57, 0x9DD8, 0x8537,
-    0x9DD9, 0x8D77, 0x8D57, 0x9DD8, 0x8537, 0x95B8, 0x95B8, 0x8537,
-    0x9DD9, 0x8D57, 0x8D77, 0x9DD8, 0x8537, 0x9DD8, 0x8D77, 0x8D57,
-    0x9DD8, 0x8536, 0x9DB8, 0x9598, 0x8D57, 0xA5F9, 0x8536, 0x9598,
-    0x9598, 0x8D57, 0xA5D9, 0x8D36, 0x9DB8, 0x9DB8, 0x8537, 0x9DD9,
-    0x8D57, 0x9598, 0x9DD8, 0x9577, 0x9DB8, 0x8D57, 0x95B7, 0xA5F9,
-    0xA619, 0xB67A, 0x9598, 0x8D57, 0x9DD8, 0x95B8, 0x9DB8, 0xAE3A,
-    0xAE5A, 0xAE5A, 0x9DD8, 0x8D57, 0x9DD8, 0x9598, 0x8D77, 0x9577,
-    0x9DD8, 0xB6BB, 0xC71D, 0xE7DF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xBEBB, 0xC6FC, 0xC6DC, 0xB69B, 0xE7DF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xC6FC, 0xBEBB, 0xBE9B, 0xB67A,
-    0xB67A, 0xBE9B, 0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67A,
-    0xBEBB, 0xBE9B, 0xB67A, 0xAE5A, 0xCF3D, 0xC6DC, 0xBEDC, 0xAE7A,
-    0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD75E, 0xC6FC, 0xAE5A, 0xB65A, 0xAE5A,
-    0xA619, 0x9DD8, 0xB65A, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xA619,
-    0xA619, 0xAE39, 0xAE19, 0xAE19, 0x9DD8, 0xB65A, 0xBE7A, 0xBE7B,
-    0xB67A, 0xB65A, 0xB65A, 0xB65A, 0x9598, 0x8516, 0x7D16, 0x7CF6,
-    0x8D57, 0x95B8, 0xA5F9, 0x9DB8, 0x8D57, 0x9DD8, 0x8D57, 0x9DB8,
-    0x8537, 0x8536, 0x9DD8, 0xB69A, 0xBEBB, 0xA639, 0x7CF6, 0x8537,
-    0xA619, 0xB65A, 0xAE19, 0xAE39, 0xB65A, 0x8D77, 0x9597, 0xB65A,
-    0xAE39, 0x9DB8, 0xA5F8, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB67A,
-    0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB69B, 0xDF9E, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xB69B,
-    0xB69B, 0xBEBB, 0xBE9B, 0xB67A, 0xDF9E, 0xDFBE, 0xB69A, 0xB67A,
-    0xB69B, 0xB69B, 0xAE5A, 0xBEBB, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xCF3D, 0xCF3D, 0xB67A, 0xB6BB,
-    0xD77E, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xCF1D, 0x8D77,
-    0x9597, 0x95B8, 0x8D57, 0x9DB8, 0x95B8, 0x8D77, 0x9598, 0x9598,
-    0x95B8, 0x9598, 0x9598, 0x9597, 0x9598, 0x9597, 0x9598, 0x9598,
-    0x9598, 0x8D77, 0x95B8, 0x9597, 0x9598, 0x9597, 0x8D77, 0x9598,
-    0x8D78, 0x9598, 0x9598, 0x9577, 0x9578, 0x9598, 0x9597, 0x9598,
-    0x9598, 0x9598, 0x9598, 0x9577, 0x9598, 0x9577, 0x9598, 0x9598,
-    0x9577, 0x9597, 0x9578, 0x9577, 0x9598, 0x9598, 0x9598, 0x9597,
-    0x9598, 0x9598, 0x9598, 0x9DB8, 0x9577, 0xB67A, 0xD75D, 0xDFBF,
-    0xE7DF, 0xE7FF, 0xC71C, 0x9DD8, 0x8D77, 0x9DD8, 0xCF5D, 0xE7FF,
-    0xE7DF, 0xE7FF, 0xDFBF, 0xAE5A, 0x9597, 0x9DB8, 0x9DD8, 0x9DF8,
-    0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF,
-    0xCF3D, 0xBEDC, 0xE7FF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFDF, 0xDFBF, 0xD79E, 0xC71C, 0xBEBB, 0xB67A, 0xBE9B, 0xB67A,
-    0xB69B, 0xB67B, 0xB67B, 0xB67A, 0xB67A, 0xB67B, 0xB67B, 0xB67A,
-    0xB67A, 0xB67A, 0xC6FC, 0xD77D, 0xDFBE, 0xCF3D, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xBEBB, 0xBEDB, 0xBEBB,
-    0xC6FC, 0xD79E, 0xD79E, 0xB67A, 0xAE3A, 0xAE5A, 0xAE5A, 0xAE39,
-    0xA619, 0xAE39, 0xAE19, 0xA5F9, 0xAE39, 0xA5F9, 0x9DD9, 0xA5F9,
-    0x9DB8, 0x9577, 0x8D57, 0x9597, 0x9597, 0x8D57, 0x9577, 0x9DD8,
-    0x95B8, 0x9577, 0x9DB8, 0xA5D8, 0x9578, 0x8D57, 0x8536, 0x8516,
-    0x8537, 0x8516, 0x8516, 0x8536, 0x8516, 0x8537, 0x8D57, 0x9598,
-    0xA619, 0xA619, 0x9577, 0x9598, 0x9598, 0x9598, 0x9598, 0x9598,
-    0x8537, 0x8537, 0x8536, 0x95B8, 0xA619, 0xB67A, 0x9DB8, 0x8537,
-    0x8516, 0xAE5A, 0xBE7A, 0xB67A, 0xAE39, 0xA619, 0xB65A, 0xAE19,
-    0xAE5A, 0xAE39, 0x9DD8, 0xA5F8, 0xB67A, 0xB65A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xBEBB, 0xD79E, 0xDF9E,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC,
-    0xB67A, 0xB69A, 0xB67A, 0xAE5A, 0xBE9B, 0xC6FC, 0xB67A, 0xB69B,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xD77E, 0xE7DF, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xBEBB,
-    0xAE5A, 0xB69B, 0xC71C, 0xDF9E, 0xDF9E, 0xE7DF, 0xB69B, 0xA619,
-    0xAE5A, 0x9597, 0xA619, 0x9597, 0x8D77, 0x95B8, 0x8D77, 0x9598,
-    0x9598, 0x8D77, 0x9DB8, 0x8D77, 0x95B8, 0x9598, 0x8D77, 0x9DB8,
-    0x8D57, 0x8D77, 0x9DD8, 0x8D57, 0x9DD8, 0x8D77, 0x8D57, 0x9DD8,
-    0x8537, 0x95B8, 0x9598, 0x8D57, 0x9DB8, 0x8D57, 0x9597, 0x9DB8,
-    0x8D57, 0x9DB8, 0x8D57, 0x9597, 0x9DB8, 0x8D57, 0xA5D8, 0x8D77,
-    0x9577, 0x9DB8, 0x8D57, 0x9DB8, 0x9597, 0x9577, 0x9DD8, 0x8536,
-    0x9DB8, 0x9597, 0x8D77, 0x9597, 0xB67A, 0xE7FF, 0xDFBF, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xE7FF, 0xCF3D, 0x9DD8, 0xD75E, 0xDFDF, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xDFBE, 0xE7FF, 0xA619, 0x9DF9, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xCF3D, 0xD79E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E,
-    0xC6FC, 0xBEBB, 0xDFBF, 0xCF3D, 0xBEDC, 0xCF1D, 0xBEBB, 0xB67A,
-    0xB67A, 0xBE7A, 0xB69A, 0xB69A, 0xB69A, 0xB69B, 0xBEBB, 0xBEBB,
-    0xB69B, 0xCF3D, 0xE7DF, 0xDFBF, 0xDFBE, 0xE7BF, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xC71C, 0xAE3A, 0xB67A, 0xB67A,
-    0xB67A, 0xB69B, 0xB65A, 0xAE39, 0xAE3A, 0xAE5A, 0xAE3A, 0xAE39,
-    0xAE3A, 0xA5F9, 0x9DD8, 0xA5F9, 0xAE19, 0x8D77, 0x8D57, 0x8516,
-    0x8D57, 0x9598, 0x9DB8, 0xA5F9, 0xA5F9, 0xA619, 0xAE19, 0xAE39,
-    0xAE19, 0xAE19, 0xAE19, 0xAE39, 0xB65A, 0xA619, 0x9DB8, 0x9DB8,
-    0x9598, 0x9DB8, 0x9DB8, 0xAE19, 0xA619, 0xAE3A, 0xA619, 0x9598,
-    0x8D77, 0x9DB8, 0x8D57, 0x8D77, 0x9DB8, 0x8D57, 0x9598, 0x8D77,
-    0x8D77, 0x8557, 0x8537, 0x8537, 0x8536, 0x9DD8, 0xAE5A, 0x9DD8,
-    0x8D77, 0x9598, 0xA5F9, 0xAE39, 0xAE5A, 0x8D77, 0x9DD8, 0xAE39,
-    0xAE3A, 0xB67A, 0xB67A, 0x95B8, 0xA619, 0xBE9B, 0xB67A, 0xB67A,
-    0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xBEBB, 0xB67A, 0xBEDB,
-    0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xC6DC, 0xBE9A, 0xB65A, 0xB65A, 0xAE7A, 0xBEDC, 0xC6FC, 0xCF3D,
-    0xCF3D, 0xC6FC, 0xC6FC, 0xD77E, 0xD77D, 0xD75D, 0xCF3D, 0xC6FC,
-    0xC71C, 0xDF9E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBE,
-    0xC71C, 0xB69B, 0xB65A, 0xB67A, 0xCF3D, 0xDFBF, 0xD77E, 0xDFBF,
-    0xDF9E, 0xD77D, 0xDF9E, 0xCF3D, 0xA619, 0x8D57, 0x9DB8, 0x9577,
-    0x95B8, 0x9598, 0x9577, 0x9597, 0x9597, 0x9597, 0x9DB8, 0x8D77,
-    0x9DD8, 0x9597, 0x9597, 0x9577, 0x9577, 0x95B8, 0x9598, 0x9597,
-    0x95B8, 0x9597, 0x9597, 0x9D98, 0x9597, 0x9DB8, 0x9597, 0x9597,
-    0x9DB8, 0x9597, 0x95B8, 0x9597, 0x9598, 0x9DB8, 0x9577, 0x9DB8,
-    0x95B8, 0x9597, 0x9DB8, 0x9597, 0x9DB8, 0x9DB8, 0x9598, 0x9DB8,
-    0x9597, 0x9DB8, 0x9597, 0xBEBB, 0xDFBE, 0xDFBE, 0xDF9E, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xDFBE, 0xDF9E, 0xC6FC, 0xDFBF, 0xDFBE, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBE, 0xE7DF, 0xCF3D, 0xCF5D, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFDF, 0xE7DF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDF9E, 0xC6FC, 0xBEBB,
-    0xAE5A, 0xC6FC, 0xDF9E, 0xB69A, 0xB69B, 0xCF3D, 0xBEBB, 0xB67A,
-    0xBE9B, 0xBE9B, 0xB67A, 0xB67A, 0xBEBB, 0xB69B, 0xAE5A, 0xD77D,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xBEBB, 0xBEBB, 0xBE9B, 0xB67A, 0xB69B,
-    0xB69A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB65A, 0xB67A, 0xB67A,
-    0xA619, 0xA619, 0xB65A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xAE5A,
-    0xAE3A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A,
-    0xB65A, 0xAE5A, 0xAE19, 0xAE39, 0xAE3A, 0xB67A, 0xBE9B, 0xBE9A,
-    0xB67A, 0xB65A, 0xAE3A, 0xAE19, 0x9DD8, 0x9DD8, 0x8537, 0x8516,
-    0x9DD8, 0x8D77, 0x9DB8, 0x9598, 0x9577, 0x9DB8, 0x8D57, 0x9DB8,
-    0xA5F9, 0x9DD8, 0x8D77, 0x8557, 0x8537, 0x7D16, 0x8D77, 0x9DD8,
-    0x9DD8, 0x9DD8, 0x9DB8, 0x9DD8, 0x9DD8, 0x95B8, 0xA619, 0xAE59,
-    0xAE19, 0xA619, 0xAE5A, 0xB65A, 0xA5F8, 0xA619, 0xBE9B, 0xB67A,
-    0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB65A, 0xB65A, 0xB69A, 0xB67A,
-    0xB67A, 0xBEBB, 0xB67A, 0xCF1D, 0xDFBF, 0xE7DF, 0xDFBF, 0xC71C,
-    0xB69B, 0xB67A, 0xB67A, 0xB67A, 0xAE5A, 0xBEBB, 0xDFBF, 0xDFBF,
-    0xDFBE, 0xD75E, 0xC71C, 0xBEBB, 0xB67A, 0xB69A, 0xAE5A, 0xBEBB,
-    0xB67A, 0xBEBB, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFDF, 0xDF9E, 0xCF5D, 0xBEDB, 0xBEDB, 0xDFBF, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xDFBF, 0xE7DF, 0xDFBF, 0xBE9B, 0x9DB8, 0x9598,
-    0x9598, 0x95B8, 0x9DB8, 0x9DD8, 0x95B8, 0x9597, 0x9597, 0x95B8,
-    0x9DB8, 0x9DB8, 0x95B8, 0x9598, 0x9DB8, 0x9DB8, 0x9598, 0x9DD8,
-    0x9598, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8,
-    0x9DB8, 0x9DB8, 0x9DD8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8,
-    0x9DB8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DB8, 0x9DB8, 0xA5D8,
-    0x9DD8, 0x9DB8, 0xB67A, 0xDFBF, 0xDFBE, 0xDFBE, 0xE7BF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xD77E, 0xBEFC, 0xC71D, 0xBEBB, 0xB69B, 0xB69A, 0xBEBB,
-    0xD77D, 0xC6FC, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xB67A, 0xB67A,
-    0xB69A, 0xBE9B, 0xB67A, 0xB67A, 0xB67A, 0xCF3D, 0xD77E, 0xDFBF,
-    0xDFBE, 0xDFBE, 0xDFBF, 0xDFBF, 0xD79E, 0xD75E, 0xDF9F, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xD77E, 0xAE5A, 0xAE5A, 0xB67A, 0xB67A, 0xBE9B,
-    0xBE9A, 0xB65A, 0xB65A, 0xBE9B, 0xBE9B, 0xAE39, 0x8D57, 0x9598,
-    0x8D77, 0x9DD8, 0xAE5A, 0xAE39, 0xAE39, 0xB65A, 0xB67A, 0xB65A,
-    0xB63A, 0xB65A, 0xB65A, 0xB65A, 0xAE39, 0xB65A, 0xB65A, 0xA5F9,
-    0x8D77, 0x9DD8, 0x8D77, 0x8D57, 0x9577, 0x9DB8, 0x9DB7, 0x9597,
-    0x9577, 0x8D77, 0x9598, 0x95B8, 0x8D77, 0x9598, 0x8D77, 0x9598,
-    0x9598, 0x9DD8, 0x9DD8, 0x9DB8, 0x95B8, 0x9597, 0x9DB8, 0x95B8,
-    0x9DD9, 0x9DD8, 0x9DB8, 0x95B8, 0x9598, 0x9598, 0x9598, 0x9DD8,
-    0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DB8, 0xA619, 0xB67A, 0xB67A,
-    0xAE5A, 0xA619, 0xAE39, 0xB67A, 0xB67A, 0x9577, 0xA619, 0xB69A,
-    0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xAE5A, 0xAE5A, 0xB65A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xC71C, 0xBEDB, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xAE5A, 0xC6FC, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xCF3D, 0xB67A, 0xBEBB, 0xD77E,
-    0xD75D, 0xB67B, 0xBEBB, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xCF5D, 0xC6FC, 0xD77E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xBEBB, 0x9597,
-    0x9DD8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x95B8, 0x9DD8, 0x9597,
-    0x9DB8, 0x9597, 0x9DD8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8,
-    0x9DB8, 0x9DB8, 0x9DB8, 0x9598, 0x9598, 0x9DB8, 0x9DB8, 0x9DB8,
-    0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9598, 0x9DB8, 0x9DB8,
-    0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DD8, 0x9DD8, 0x9577,
-    0x9DB8, 0xA5F9, 0xD77E, 0xDFBF, 0xDFBE, 0xDFDF, 0xCF3D, 0xC6DC,
-    0xC71D, 0xC71C, 0xC6FC, 0xD77E, 0xE7DF, 0xDFBE, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xD77E, 0xD77E, 0xDFBF, 0xBEDB,
-    0xC6DC, 0xB69A, 0xB67A, 0xBEBB, 0xB67A, 0xB65A, 0xBE9B, 0xCF1C,
-    0xCF1C, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xBE9B, 0xB69A, 0xBEBB, 0xCF3D, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xD79E, 0xD75D, 0xBEBB, 0xB67A, 0xBEBB, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xCF5D, 0xBEBB, 0xB69B, 0xB69A, 0xB67A, 0xAE5A,
-    0xAE39, 0xB65A, 0xB67A, 0xAE19, 0x9DD8, 0xA5F9, 0x8D57, 0x95B8,
-    0xAE19, 0xAE39, 0xAE39, 0xAE39, 0xAE5A, 0xAE5A, 0xAE3A, 0xAE39,
-    0xAE3A, 0xAE3A, 0xAE5A, 0xB65A, 0xB67A, 0xB65A, 0xAE39, 0xA619,
-    0x9DD8, 0xA5F9, 0x9DD9, 0x8557, 0x8D77, 0x9DB8, 0x9577, 0x9598,
-    0x9598, 0x9DB8, 0xA5F9, 0x9DB8, 0x95B8, 0x9DB8, 0x9DB8, 0x9DB8,
-    0x9DD8, 0x9DD8, 0x9DB8, 0x9DB8, 0x9598, 0x9DB8, 0x9DB8, 0x95B8,
-    0x9DD9, 0x9DD9, 0x9DD8, 0x9DD8, 0x9DD8, 0xA5F9, 0x9DD8, 0x9DD8,
-    0xA5F8, 0x9DF9, 0x9DD8, 0x9DD9, 0xA5F9, 0x9598, 0x95B8, 0x9DB8,
-    0xAE39, 0xB69A, 0xB65A, 0xB65A, 0xB67A, 0xB65A, 0xA619, 0xAE39,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xBE9B, 0xB67A, 0xAE5A, 0xB67A, 0xBE9B,
-    0xB69B, 0xB67A, 0xB67A, 0xB69B, 0xC6FC, 0xBEDB, 0xCF3D, 0xCF3D,
-    0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xCF5D, 0xB69A, 0xDF7E,
-    0xE7DF, 0xDFBE, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xCF3D, 0xC71C, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xC6DC, 0x9597,
-    0x9DD8, 0x9DB8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0xA619, 0x95B8,
-    0x9DB8, 0x9597, 0xA5F9, 0x9DB8, 0xA5F8, 0x9DB8, 0x9DD8, 0x9DB8,
-    0x9DB8, 0x9DB8, 0x9DD8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DB8, 0x9DD8,
-    0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DB8, 0x9DD8, 0x9DB8,
-    0x9DB8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DB8, 0xAE3A, 0xBEBB, 0xAE5A,
-    0xCF3D, 0xDFBF, 0xDFBE, 0xDF9E, 0xDFDF, 0xC71C, 0xAE5A, 0xB67A,
-    0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xDFBF, 0xE7DF, 0xCF1D, 0xAE3A,
-    0xCF3D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xB69B, 0xBEBB, 0xBEBB, 0xB67A,
-    0xB69A, 0xBE9B, 0xBEDB, 0xB69B, 0xB67A, 0xBE9B, 0xBEBB, 0xC6FC,
-    0xC6BB, 0xB67A, 0xBE9B, 0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xB67A,
-    0xB67A, 0xB69B, 0xB67A, 0xCF1D, 0xE7BF, 0xDFBF, 0xDF9E, 0xCF5D,
-    0xCF3D, 0xD77E, 0xC6BC, 0xC6DB, 0xBEBB, 0xBEBB, 0xB69A, 0xC6DC,
-    0xCF3D, 0xCF5D, 0xCF5D, 0xC6FC, 0xD75D, 0xBE9B, 0xAE3A, 0xAE19,
-    0xA619, 0xAE39, 0xB65A, 0x9D98, 0x9DD8, 0xAE39, 0xAE39, 0xB65A,
-    0xB65A, 0xAE39, 0xAE5A, 0xB65A, 0xAE5A, 0xAE59, 0xB65A, 0xB65A,
-    0xB65A, 0xB67A, 0xBE9A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A,
-    0xA5F9, 0x8D77, 0x8D77, 0x9598, 0xA5F9, 0x9DD8, 0x9DB8, 0x9DD8,
-    0x9DB8, 0x9DD8, 0x9DD8, 0x95B8, 0x9598, 0x9DB8, 0x9DD8, 0x9DD8,
-    0x9DD8, 0x9DD8, 0x9DD8, 0x9DB8, 0x9DB8, 0x9DD8, 0x9DD8, 0x9DD8,
-    0x9DD8, 0x9DD9, 0x9DD9, 0x9DF9, 0x9DD8, 0x9DF8, 0x9DF9, 0x9DF9,
-    0xA5F9, 0x9DD8, 0xA5F9, 0xA5F9, 0x9DF9, 0x9DF9, 0x95B8, 0x9598,
-    0x8D77, 0xA619, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xA5F9,
-    0xA5F9, 0xB65A, 0xAE5A, 0xB67A, 0xBE9B, 0xB69A, 0xB67A, 0xB67A,
-    0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xBE9A, 0xB69B, 0xB67A, 0xB67A,
-    0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xC6DC, 0xBE9B, 0xB65A, 0xB65A,
-    0xB65A, 0xC6FC, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xD77E, 0xD77E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xD79E, 0xDFBF,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD77E, 0xB69B, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC, 0xAE39, 0xA5F8,
-    0x9DB8, 0x9DD8, 0x9DD8, 0x9DF8, 0x9DF8, 0x9DD8, 0x95B8, 0x9DB8,
-    0xA5F9, 0x9DD8, 0x9DB8, 0xA5F9, 0xA5F9, 0x9DB8, 0x9DD8, 0xA5D8,
-    0xA5D8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DB8, 0x9DD8, 0xA5D8,
-    0x9DD8, 0x9DB8, 0x9DD8, 0xA5D8, 0x9DD8, 0x9DB8, 0x9DD8, 0x9DD8,
-    0x9DB8, 0x9DD8, 0x9DB8, 0xA5F8, 0xC6DB, 0xCF3D, 0xD75E, 0xE7DF,
-    0xDFDF, 0xDFBE, 0xDFBE, 0xDFDF, 0xD77E, 0xB67A, 0xB69B, 0xB67A,
-    0xB69B, 0xBE9B, 0xB69B, 0xB69B, 0xD75E, 0xCF5D, 0xB69B, 0xAE5A,
-    0xC6FC, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xD79E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xE7DF, 0xCF5D, 0xB67A, 0xB67A, 0xC6FC, 0xD77E,
-    0xBEBB, 0xBE9B, 0xBE9B, 0xB67A, 0xBE7B, 0xBEBB, 0xBEBB, 0xB69A,
-    0xBE9A, 0xBE9B, 0xBE9B, 0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xB67A,
-    0xBE9B, 0xBE9B, 0xB67A, 0xC6FC, 0xDF9E, 0xDFBF, 0xC6DC, 0xB65A,
-    0xB69A, 0xBE9B, 0xB67A, 0xB67A, 0xBEBB, 0xBE9A, 0xB69B, 0xB69A,
-    0xB67A, 0xB65A, 0xB67A, 0xC6FC, 0xCEFC, 0xB65A, 0xBE9B, 0xB67A,
-    0xB67A, 0xB67A, 0xA5F8, 0xB65A, 0xBE7A, 0xAE5A, 0xB67A, 0xB67A,
-    0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB65A, 0xB67A, 0xB69A, 0xB67A,
-    0xB67A, 0xB65A, 0xAE19, 0xA619, 0x8D57, 0x9DD8, 0xA619, 0x9598,
-    0x8537, 0x7D16, 0x8557, 0xA5F9, 0xA5F8, 0xA5F9, 0x9DB8, 0x9DB8,
-    0x9DD8, 0x9598, 0x95B8, 0x9DF9, 0xA5F9, 0xA5F9, 0x9DD9, 0x9DD8,
-    0x9DD9, 0x9DD9, 0x9DD8, 0x9DF9, 0x9DF9, 0x9DD8, 0x9DD8, 0x9DF9,
-    0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0xA619, 0xA619, 0xA619, 0xA5F9,
-    0xA619, 0xA5F9, 0xA5F9, 0xA619, 0xA619, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DD8, 0x9DD8, 0xA619, 0xB65A, 0xB65A, 0xAE5A, 0xAE39, 0xA5F9,
-    0x9DD8, 0x8D57, 0x95B8, 0xAE5A, 0x9DB8, 0xA5F8, 0xBE7A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xB67A,
-    0xB67A, 0xB69B, 0xB69B, 0xB67A, 0xB69A, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xB67B, 0xAE5A, 0xC6FC, 0xDFBF, 0xD77E, 0xD79E, 0xD77E, 0xD79E,
-    0xE7DF, 0xDFBF, 0xE7BF, 0xD75D, 0xBEBB, 0xB67A, 0xB65A, 0xC6FC,
-    0xC6FC, 0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF, 0xE7BF, 0xC71C, 0xA619,
-    0xAE39, 0x9DD8, 0xA5F8, 0xA5F8, 0xAE39, 0xC6FC, 0xC6FC, 0xAE5A,
-    0x9DB8, 0xA5F9, 0xA5F9, 0xA5F8, 0xA5F9, 0xA5F8, 0xA619, 0xA5F9,
-    0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F8, 0xA5F8, 0xA5F8, 0xA5F9,
-    0xA5F8, 0xA5F8, 0xA5F9, 0xA5F9, 0xA5D8, 0xA5D8, 0xA5D8, 0x9DD8,
-    0x9DB8, 0x9DB8, 0x9597, 0xC6DC, 0xE7DF, 0xE7DF, 0xDFBE, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xAE5A, 0xB69B, 0xCF3D, 0xC6FC,
-    0xBEBB, 0xAE7A, 0xC6FC, 0xD75D, 0xD79E, 0xD77E, 0xCF1C, 0xB69B,
-    0xB67A, 0xCF5D, 0xDFBF, 0xDFBF, 0xDFBF, 0xC6FC, 0xBEDB, 0xC6DC,
-    0xC6FC, 0xBEBB, 0xD77E, 0xD77E, 0xAE39, 0xBE9B, 0xE7FF, 0xCF1D,
-    0xBEBB, 0xBE9B, 0xB67A, 0xB67A, 0xB67A, 0xBE9A, 0xBE9B, 0xBE9B,
-    0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xC6FC, 0xD77E, 0xD77E, 0xBEDB, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0x9598, 0xA5F9, 0xB65A,
-    0x8D57, 0x8D37, 0x8536, 0xA5F9, 0xADF9, 0xB65A, 0xB65A, 0xB67A,
-    0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xAE3A, 0xB65A, 0xAE19,
-    0x9DD8, 0x9598, 0x7CF6, 0x8537, 0x9598, 0xA5D8, 0x9DB8, 0x9DB8,
-    0x9DD8, 0xA619, 0xA5F9, 0xA5F9, 0xA5F9, 0xA619, 0x9DF9, 0xA5F9,
-    0xA5F9, 0xA5F9, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0x9DF9,
-    0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0x9DF9,
-    0xA61A, 0xA619, 0xAE39, 0xA619, 0x9DD8, 0xA619, 0xAE3A, 0xA619,
-    0x9DF8, 0xA619, 0xAE3A, 0xAE39, 0xAE3A, 0xA619, 0xA5F9, 0xA619,
-    0xAE39, 0xAE19, 0xAE39, 0xB67A, 0xB67A, 0xAE39, 0xAE39, 0xAE5A,
-    0xB67A, 0x9598, 0x95B8, 0xAE39, 0x84F6, 0x8D36, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A,
-    0xB67A, 0xB67A, 0xB67A, 0xBEBB, 0xB69B, 0xB67A, 0xB67A, 0xB67A,
-    0xC6FC, 0xC71D, 0xD79E, 0xCF1C, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xAE5A, 0xB67A, 0xD77E, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xCF1D, 0xCF3D, 0xDF9F, 0xE7BF, 0xE7BF, 0xD77E, 0xCF1C,
-    0xAE39, 0xB67A, 0xAE3A, 0xA5F8, 0xD77E, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xB69B, 0x9DB8, 0xAE3A, 0xA619, 0xAE19, 0xA619, 0xAE19, 0xA619,
-    0xA619, 0xAE19, 0xA5F9, 0xA619, 0xA5F9, 0xA619, 0xA619, 0xA5F9,
-    0xA5F9, 0xAE19, 0xA5F9, 0xAE19, 0xA5D8, 0xA5D8, 0xA5D8, 0x9DD8,
-    0xAE5A, 0xAE3A, 0xBEBB, 0xDFBF, 0xDFBE, 0xDFBE, 0xDFBE, 0xE7BF,
-    0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xD79E, 0xD77E, 0xD77E, 0xC6DC,
-    0xB67B, 0xBEDC, 0xD77E, 0xC71C, 0xC6DC, 0xCF3D, 0xC6DC, 0xB69B,
-    0xAE5A, 0xB69B, 0xC71D, 0xBEDC, 0xB69B, 0xBE9B, 0xB69A, 0xB67A,
-    0xB67A, 0xBEDC, 0xD77E, 0xD79E, 0xCF1C, 0xBE9B, 0xBEBB, 0xAE39,
-    0xB69A, 0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE7A,
-    0xBE7A, 0xBEBB, 0xBE7A, 0xBE7A, 0xB67A, 0xB65A, 0xB65A, 0xB67A,
-    0xB67A, 0xB67B, 0xCF3D, 0xDFBF, 0xC71C, 0xBE9B, 0xB67A, 0xB67A,
-    0xB65A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB65A,
-    0xB65A, 0xB65A, 0xB639, 0xAE19, 0xAE19, 0xA619, 0x9598, 0x8D57,
-    0x8D57, 0xA5F9, 0xAE19, 0xA5D8, 0xAE19, 0xAE3A, 0xAE3A, 0xB65A,
-    0xB67A, 0xBE9A, 0xB65A, 0xAE39, 0x9DB8, 0x8516, 0x8516, 0x7CF6,
-    0x7CF6, 0x7CD6, 0x9598, 0xA5D9, 0xAE39, 0xAE19, 0xAE19, 0xA619,
-    0xAE39, 0xAE3A, 0xAE19, 0xA619, 0xA619, 0xAE19, 0xA619, 0xA619,
-    0xA619, 0xAE39, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9, 0xA619, 0xA5F9,
-    0xA619, 0xA619, 0xA619, 0xA5F9, 0xA619, 0xA5F9, 0xA619, 0xA619,
-    0xA619, 0xA5F9, 0x9DD8, 0xA619, 0xBEDB, 0xD75D, 0xDF9E, 0xD77E,
-    0xBEBB, 0xA619, 0xA5F9, 0xA619, 0xA619, 0xA619, 0x9DD9, 0x9DD8,
-    0xA619, 0xAE19, 0xAE19, 0xA619, 0xAE39, 0xB65A, 0xB67A, 0xAE5A,
-    0xB65A, 0xBEBB, 0xBEBB, 0xBE9B, 0xB67A, 0xB67A, 0xAE39, 0xAE5A,
-    0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB69A, 0xB67A, 0xB69A, 0xB69A, 0xB69B, 0xBE9A, 0xB67A, 0xB67A,
-    0xB69A, 0xB69A, 0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xBEBB, 0xB67A,
-    0xB65A, 0xB67A, 0xBE9B, 0xB67A, 0xBE9A, 0xB69A, 0xB67A, 0xBE9B,
-    0xB69B, 0xAE5A, 0xB69B, 0xDFBE, 0xD77E, 0xD77E, 0xD77E, 0xDFBF,
-    0xBEDB, 0xB65A, 0xAE39, 0xCF1C, 0xE7DF, 0xDFBF, 0xE7DF, 0xDFBF,
-    0xD77E, 0xDF9E, 0xDF9E, 0xDF9E, 0xE7DF, 0xDFBE, 0xDFBE, 0xDFBF,
-    0xDF9E, 0xB65A, 0xAE19, 0xA5F9, 0xA5F9, 0xA619, 0xA5F9, 0xA619,
-    0xA619, 0xA5F9, 0xA5F8, 0xA619, 0xA5F9, 0xA5F9, 0xA619, 0xA5F8,
-    0x9DB8, 0x9DB8, 0xA5D8, 0xAE19, 0xAE39, 0xB63A, 0xD75D, 0xD75D,
-    0xDFBF, 0xE7DF, 0xE7DF, 0xDFBE, 0xDFBE, 0xDFDF, 0xDFBF, 0xC6DC,
-    0xCF1C, 0xCF1C, 0xD75D, 0xD73D, 0xC71C, 0xC6DB, 0xBEDC, 0xAE3A,
-    0xAE5A, 0xBEDC, 0xB67A, 0xB67A, 0xB69B, 0xBE9B, 0xAE5A, 0xB65A,
-    0xB67A, 0xBE9A, 0xBE7A, 0xBE9A, 0xB65A, 0xAE5A, 0xB67A, 0xB65A,
-    0xB67A, 0xCF3D, 0xBEDB, 0xBEBB, 0xC6FC, 0xC6DC, 0xBEBB, 0xBE7A,
-    0xB65A, 0xB65A, 0xB67A, 0x9DD8, 0xA5F9, 0xB65A, 0xB65A, 0xA619,
-    0xAE3A, 0xA619, 0x9DB8, 0x9DD9, 0x9577, 0xAE39, 0xB67A, 0xB65A,
-    0xBE9B, 0xC6DB, 0xC6DB, 0xB69B, 0xB69B, 0xBE9B, 0xB67A, 0xB67A,
-    0xBE7A, 0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A,
-    0xB67A, 0xAE19, 0xA5F8, 0xAE3A, 0xB65A, 0xB65A, 0xB65A, 0xB67A,
-    0xB67A, 0xB65A, 0xB65A, 0xBE7A, 0xB65A, 0xAE39, 0xB659, 0xB67A,
-    0xB65A, 0x9DB8, 0x8536, 0x8D57, 0x9577, 0x9DB8, 0xA5F9, 0xA5D9,
-    0xA619, 0xAE19, 0xAE39, 0xAE39, 0xA5F9, 0xA619, 0xAE39, 0xA5F9,
-    0xA5D8, 0xA5F9, 0x9DD8, 0xA5F9, 0xA5F9, 0xA619, 0xA5F9, 0xA5F9,
-    0xA5F8, 0x9DB8, 0xA619, 0xB65A, 0xB67A, 0xAE3A, 0xA619, 0xA5F9,
-    0xA5F9, 0xA619, 0xA5F9, 0xA619, 0xB69B, 0xB65A, 0x9DD9, 0x9DF9,
-    0xA5F9, 0x9DD8, 0xAE3A, 0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xD77E, 0xB67A, 0xA5F9, 0xAE19, 0xA619, 0xA619, 0xA619,
-    0xAE19, 0xAE39, 0xAE39, 0xA619, 0xAE39, 0xB67A, 0xAE5A, 0xAE39,
-    0xB65A, 0xAE5A, 0xB65A, 0xB67A, 0xB65A, 0xBE9B, 0xB65A, 0xB67A,
-    0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A, 0xB67A, 0xB65A, 0xB65A,
-    0xBE7A, 0xBEBB, 0xC6BB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xB69B,
-    0xB69A, 0xB69B, 0xCF5D, 0xDF9E, 0xB69B, 0xBE9B, 0xBEBB, 0xCF3D,
-    0xC6FC, 0xBE9B, 0xBEBB, 0xBEDB, 0xD79E, 0xDF9E, 0xD79E, 0xDFBE,
-    0xDFDF, 0xDFBF, 0xD77E, 0xD77E, 0xCF5D, 0xDF9E, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xE7BF, 0xCF1D, 0xBEBB, 0xAE5A, 0xA5F9, 0xAE19, 0xAE39,
-    0xAE19, 0xA5F9, 0xB65A, 0xAE39, 0xA5F9, 0xAE39, 0xAE39, 0xB67A,
-    0xCF1C, 0xC6DC, 0xBEBB, 0xC6BB, 0xDF7E, 0xDF7E, 0xDF7E, 0xDFBF,
-    0xD77E, 0xCF3D, 0xD75D, 0xDF9E, 0xD79E, 0xCF5D, 0xC6DC, 0xB67A,
-    0xB69A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xAE19, 0xA5F8,
-    0xA5F9, 0xA5F9, 0xA5F9, 0xA619, 0xAE39, 0xAE19, 0xAE39, 0xAE39,
-    0xAE3A, 0xAE39, 0xAE19, 0xAE19, 0xAE3A, 0xAE3A, 0xBEBB, 0xCF3D,
-    0xCF3D, 0xC6DC, 0xBE9B, 0xBE9B, 0xB69A, 0xBE9B, 0xBE9A, 0xB659,
-    0xB65A, 0xBE9A, 0x95B8, 0x95B8, 0x9DD8, 0x9597, 0x8D77, 0x8D57,
-    0x9577, 0x8516, 0x9DD9, 0xB6BB, 0xB67A, 0xBEBB, 0xBE9B, 0xBE7A,
-    0xBE9B, 0xBE9B, 0xBE9A, 0xBE7A, 0xB67A, 0xBE9A, 0xB65A, 0xBE7A,
-    0xBE7A, 0xBE7A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB65A, 0xB639, 0xB639, 0xB67A, 0xBE7A, 0xB65A, 0xB67A, 0xBE9B,
-    0xBE7A, 0xB65A, 0xB67A, 0xBE9A, 0xB65A, 0xB67A, 0xB67A, 0xA619,
-    0x7D16, 0x7D16, 0x95B8, 0xA5F9, 0xAE3A, 0xB67A, 0xBE7A, 0xBE7A,
-    0xB67A, 0xB65A, 0xB65A, 0xAE39, 0xAE19, 0xAE19, 0xB65A, 0xAE3A,
-    0xAE39, 0xAE19, 0xAE39, 0xA5F9, 0xA5F9, 0xAE3A, 0xA619, 0xA619,
-    0x9DD8, 0xB65A, 0xD77E, 0xDFBF, 0xDFBF, 0xD79E, 0xAE19, 0x9598,
-    0xA5F9, 0xA5F9, 0xB67A, 0xD79E, 0xDFBF, 0xDFBE, 0xD75D, 0xAE7A,
-    0xAE7A, 0xBE9B, 0xDF9E, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xDFBF, 0xBEBB, 0xB65A, 0xAE19, 0xAE39, 0xB65A,
-    0xB65A, 0xAE39, 0xAE3A, 0xB67A, 0xB67A, 0xAE39, 0xAE5A, 0xB67A,
-    0xAE5A, 0x9DB8, 0x9597, 0xB63A, 0x8D16, 0x9577, 0x9DD8, 0x8D57,
-    0x9577, 0x9DB8, 0x9DB8, 0xA5D8, 0xA5F9, 0xA619, 0xAE39, 0xAE19,
-    0x9DB8, 0x9DB8, 0xAE39, 0xAE19, 0xAE39, 0xAE39, 0xB65A, 0xBEBB,
-    0xB67A, 0xB67A, 0xB67A, 0xBE9A, 0xB69A, 0xB69A, 0xB67B, 0xB69B,
-    0xB67A, 0xB67A, 0xBE7A, 0xBE9B, 0xBE9B, 0xB67A, 0xB69B, 0xB69A,
-    0xB69A, 0xB69A, 0xBEBB, 0xB69B, 0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB,
-    0xDF9E, 0xD77E, 0xD75D, 0xCF1C, 0xBEBB, 0xBEDB, 0xB6BB, 0xBEDC,
-    0xD77E, 0xDFBF, 0xC6DC, 0xC6FC, 0xBEBB, 0xCF5D, 0xDFBF, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xE7BF, 0xDF9E, 0xB65A, 0xA5F8, 0xAE39, 0xAE19,
-    0xAE19, 0xA619, 0xA619, 0xAE5A, 0xA5F9, 0xAE19, 0xAE39, 0xBEDB,
-    0xD77E, 0xC6DB, 0xBEBB, 0xB67A, 0xBEBB, 0xB67A, 0xBE9B, 0xC6DC,
-    0xBEDB, 0xBEBB, 0xC6FC, 0xB69B, 0xA619, 0xA619, 0xA619, 0xAE19,
-    0xA619, 0xA5F9, 0xA5F8, 0xA5F8, 0xA5F9, 0xA5F8, 0x9DD8, 0xA5F9,
-    0xA5D9, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0x9DD8, 0xA5F8, 0xA5D8,
-    0xB65A, 0xB67A, 0xAE5A, 0xAE7A, 0xC6DC, 0xBE9B, 0xCF3D, 0xDF9E,
-    0xC6DC, 0xB65A, 0xB67A, 0xB67A, 0x9DF8, 0xA5D9, 0x9DD8, 0xAE19,
-    0x9DD8, 0x8D77, 0x9598, 0xA5F9, 0xAE3A, 0xB63A, 0xB65A, 0xBE7A,
-    0xBE9B, 0xB65A, 0xBE9B, 0xD75D, 0xCF1D, 0xBE9B, 0xB67A, 0xBE7A,
-    0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xBE7A,
-    0xBE7A, 0xBE7A, 0xBE9A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB63A,
-    0xAE39, 0xB65A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB65A, 0xB65A,
-    0xB65A, 0xBE7A, 0xB65A, 0xAE39, 0xB65A, 0xB65A, 0x8D57, 0x8516,
-    0x8D57, 0xA5F9, 0xB65A, 0xB65A, 0xB65A, 0xB63A, 0xAE39, 0xAE39,
-    0xB65A, 0xAE3A, 0xA619, 0xAE19, 0xA619, 0xA619, 0xAE19, 0xAE39,
-    0xB65A, 0xAE19, 0xA5F9, 0xAE19, 0xA619, 0xA5F9, 0xA5F9, 0xA5F9,
-    0xBE9B, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xD79E, 0xBE9B,
-    0xA5F9, 0xB69B, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFDF, 0xDF9E,
-    0xAE7A, 0xCF3D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xBEBB, 0xB67A, 0xBEBB, 0xB67A, 0xAE5A,
-    0xAE5A, 0xAE3A, 0xAE5A, 0xB67A, 0xAE5A, 0xAE39, 0xAE59, 0xB65A,
-    0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xAE19, 0xA5F9, 0xA619, 0x9DB8,
-    0x7CD5, 0x7CD5, 0x7CF5, 0x9D97, 0xA619, 0xAE19, 0xAE19, 0xAE39,
-    0xAE19, 0xA5F9, 0xA5F9, 0x9DB8, 0x8536, 0x8536, 0x9577, 0x9597,
-    0xA5F9, 0xAE39, 0xAE3A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB,
-    0xBEDC, 0xC6FC, 0xCF1C, 0xC6FC, 0xBEDC, 0xBEFC, 0xBEDB, 0xBEBB,
-    0xCF3D, 0xE7DF, 0xE7FF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xE7BF,
-    0xE7BF, 0xDFBF, 0xE7DF, 0xC6DC, 0xB65A, 0xC6DB, 0xD73D, 0xD75E,
-    0xCF3D, 0xBE9B, 0xAE5A, 0xBE9B, 0xA5F9, 0xAE39, 0xA619, 0xA5D8,
-    0x9DB8, 0xA5F8, 0xAE19, 0xA5D9, 0xA5F9, 0xA5F9, 0xA619, 0xA5F9,
-    0xA5F9, 0xA5F9, 0xA5F9, 0x9DD9, 0x9DD9, 0xA5F9, 0xA5F9, 0xA5F9,
-    0xA5F9, 0xA5F9, 0xA5F9, 0xA619, 0xA619, 0xA619, 0xA619, 0xAE19,
-    0xAE19, 0xA619, 0xA619, 0x9DD8, 0x9DD8, 0xA5F9, 0xA5F9, 0xC6DC,
-    0xD75D, 0xD77E, 0xE7DF, 0xDFBF, 0xC71C, 0xBEBB, 0xAE5A, 0xA619,
-    0xA619, 0x9598, 0x9DB8, 0x9DB8, 0x95B8, 0x9598, 0x8D57, 0x9598,
-    0x9598, 0x8537, 0xA5F9, 0xBE7B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE7A,
-    0xBE7A, 0xBE7A, 0xB65A, 0xAE39, 0xAE19, 0xB65A, 0xB65A, 0xB65A,
-    0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A,
-    0xB65A, 0xB65A, 0xB65A, 0xBE7A, 0xB67A, 0xB65A, 0xB65A, 0xB639,
-    0xAE39, 0xAE19, 0xAE19, 0xB65A, 0xB65A, 0xB67A, 0xB65A, 0xB65A,
-    0xB65A, 0xAE39, 0xAE19, 0xAE19, 0xA5F9, 0x8536, 0x7CD6, 0x8537,
-    0xAE39, 0xAE19, 0xAE19, 0xAE39, 0xAE39, 0xAE19, 0xAE19, 0xAE39,
-    0xAE19, 0xAE3A, 0xAE39, 0xA5F8, 0xB69B, 0xBEDB, 0xB65A, 0xAE39,
-    0xAE39, 0xAE5A, 0xAE3A, 0xA5F9, 0xB67A, 0xCF3D, 0xD75E, 0xCF1D,
-    0xCF3D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF,
-    0xBEBB, 0xCF3D, 0xE7DF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xC71C, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xD79E, 0xC6FC, 0xD75D, 0xDFBF, 0xDFBE, 0xB67A,
-    0xA619, 0xB69B, 0xB69B, 0xAE3A, 0xB69B, 0xD77E, 0xD77E, 0xB69B,
-    0xB69B, 0xBE9B, 0xBE7A, 0xB67A, 0xBE9B, 0xB67A, 0xB69A, 0xBEBB,
-    0xAE39, 0xAE19, 0xB65A, 0xB65A, 0xBE9B, 0xBE9B, 0xB67A, 0xBE7A,
-    0xBE9B, 0xBE9B, 0xB67A, 0xBE9B, 0xBEBB, 0xAE5A, 0xA5F9, 0x9DD8,
-    0xAE39, 0xAE39, 0xAE3A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB67A,
-    0xBE9A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB69A, 0xBE7A, 0xBE9A, 0xBE7A, 0xBE7A, 0xB67A,
-    0xAE5A, 0xAE5A, 0xB65A, 0xAE39, 0xB67A, 0xB69B, 0xB69B, 0xB67A,
-    0xBE9B, 0xC6DC, 0xC6DC, 0xC6FC, 0xC6FC, 0xCF1C, 0xCF1C, 0xCF1C,
-    0xCF1D, 0xC6FC, 0xD77E, 0xD75D, 0xE7BF, 0xEFDF, 0xE7DF, 0xDF7E,
-    0xDF7E, 0xCEFC, 0xDFBE, 0xDFBF, 0xB69B, 0xB67A, 0xBEBB, 0xCF1C,
-    0xC6FC, 0xCF1C, 0xAE3A, 0xA5F9, 0xAE19, 0xA5F9, 0xA619, 0xAE19,
-    0xAE19, 0xA5F9, 0xAE19, 0xA619, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9,
-    0xA5F9, 0xA5F9, 0xA5F9, 0xA619, 0xA619, 0xA5F9, 0xA5F9, 0xAE19,
-    0xAE19, 0xA619, 0xAE19, 0xB67A, 0xC6FC, 0xDF9E, 0xD79E, 0xE7DF,
-    0xD77E, 0xCF3D, 0xD77E, 0xC71D, 0xB69B, 0xBEBB, 0xBEBB, 0xC6FC,
-    0xC6FC, 0xD75D, 0xD75D, 0xC6FC, 0xCF1C, 0xD75D, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xC6DC, 0xC6DC, 0xBEBB, 0xBE7B, 0xBE7A, 0xBE7A, 0xB65A,
-    0xB65A, 0xB67A, 0xBE7A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB639,
-    0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xAE39, 0xAE39,
-    0xAE19, 0xADF9, 0xA619, 0xB65A, 0xB67A, 0xB65A, 0xB65A, 0xBE7A,
-    0xB65A, 0xAE39, 0xAE19, 0xB65A, 0xB67A, 0xAE3A, 0xAE19, 0xA619,
-    0xA5D8, 0x9DD8, 0xA619, 0xA619, 0x8D77, 0x8D57, 0xA5F9, 0xA619,
-    0x9DD8, 0xA5F9, 0xAE39, 0xB65A, 0xAE19, 0xA5F9, 0xB65A, 0xB65A,
-    0xA5F9, 0xAE3A, 0xB65A, 0xC71C, 0xE7DF, 0xDFBF, 0xDFBF, 0xCF3D,
-    0xAE5A, 0xBEBB, 0xBEDB, 0xBEBB, 0xDF9F, 0xE7DF, 0xE7DF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBE, 0xDFDF,
-    0xAE39, 0xB67A, 0xC71C, 0xC6FC, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xCF5D, 0xAE5A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB65A,
-    0xB67A, 0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB65A, 0xB67A, 0xB65A, 0xB67A, 0xBE9B, 0xB65A, 0x8D77, 0xA5F9,
-    0xAE19, 0xAE19, 0xAE3A, 0xB65A, 0xA5F9, 0xAE19, 0xB67A, 0xB67A,
-    0xB67A, 0xB65A, 0xB65A, 0xAE3A, 0xB67A, 0xBE9B, 0xB65A, 0xAE19,
-    0xAE19, 0xA5D8, 0xBE9A, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9A, 0xBE9B,
-    0xBEBB, 0xBE9B, 0xB67A, 0xBE9A, 0xBE9B, 0xBE9B, 0xB67A, 0xB67A,
-    0xB67A, 0xAE39, 0xAE19, 0xAE19, 0xAE5A, 0xB65A, 0xB65A, 0xB65A,
-    0xCF1C, 0xC6FC, 0xBEDC, 0xB67A, 0xCF1C, 0xCF3D, 0xD77E, 0xD75D,
-    0xD73D, 0xD77E, 0xDFBF, 0xE7BF, 0xE7BF, 0xD75E, 0xDF7E, 0xD75E,
-    0xDF7E, 0xD75D, 0xBE9B, 0xBE9B, 0xAE19, 0xA619, 0xAE19, 0xAE19,
-    0xAE19, 0xAE19, 0xAE39, 0xAE39, 0xA5F9, 0xA5F9, 0xA5F9, 0xA5F9,
-    0xAE39, 0xA5F9, 0xAE19, 0xAE19, 0xAE39, 0xAE19, 0xB67A, 0xA5F8,
-    0xAE5A, 0xC6DB, 0xB67A, 0xBE9B, 0xCF3D, 0xCF3D, 0xD79E, 0xD77E,
-    0xC6DC, 0xCF3D, 0xD75D, 0xD73D, 0xD75D, 0xCF5D, 0xDFBF, 0xDFBF,
-    0xCF3D, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xBEBB, 0xC6FC, 0xC6DB,
-    0xC6BB, 0xC6BB, 0xBE9B, 0xBE9A, 0xBE9B, 0xBE9A, 0xBE7A, 0xB67A,
-    0xB65A, 0xB67A, 0xBE7A, 0xB65A, 0xB65A, 0xB65A, 0xB639, 0xB639,
-    0xB63A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xAE39, 0x9DD8,
-    0x9DD8, 0xAE19, 0x8D57, 0x8536, 0xAE39, 0xBE7A, 0xBE9B, 0xA619,
-    0xA5F9, 0xAE3A, 0x9DD8, 0x9DB8, 0xAE19, 0x9DB8, 0x7CF6, 0x8537,
-    0x7D16, 0x9598, 0x8D57, 0x8516, 0x9598, 0xB67A, 0xB67A, 0xB67A,
-    0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xAE5A, 0xAE39, 0xAE3A, 0xAE3A,
-    0xB67A, 0xD75E, 0xC6FC, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xD77E, 0xAE5A, 0xC6FC, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF,
-    0xD77E, 0xD77E, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7DF,
-    0xBEBB, 0xAE3A, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xCF5D, 0xB67A, 0xAE5A, 0xB65A, 0xAE5A, 0xAE5A,
-    0xB65A, 0xB67A, 0xBEBB, 0xB67A, 0xB67A, 0xBE9B, 0xB69A, 0xAE5A,
-    0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB65A, 0xA5D9,
-    0xA5F9, 0xAE19, 0xAE39, 0xA619, 0x8536, 0x7CF6, 0x9598, 0x9DD8,
-    0x8D57, 0x8D57, 0x95B8, 0x8D77, 0x9577, 0x9DB8, 0x8D57, 0x9598,
-    0x8D37, 0x7CD5, 0x9597, 0x9DB8, 0x95B8, 0x9DB8, 0x9DD8, 0x95B8,
-    0x9DF8, 0xAE5A, 0xB67A, 0xB69A, 0xBE9A, 0xBE9A, 0xBE9A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xAE39,
-    0xB67A, 0xB67A, 0xB67A, 0xAE39, 0xAE39, 0xB65A, 0xB65A, 0xB65A,
-    0xB67A, 0xBE9B, 0xBE9B, 0xBEBB, 0xCEFC, 0xBE9B, 0xB67A, 0xB67A,
-    0xAE3A, 0xAE5A, 0xB65A, 0xB65A, 0xAE3A, 0xB67A, 0xB65A, 0xB65A,
-    0xB67A, 0xBE7A, 0xB65A, 0xAE19, 0xB65A, 0xBE9B, 0xCEFC, 0xC6FC,
-    0xD73D, 0xCF3D, 0xCF3D, 0xDF9F, 0xDF7E, 0xD75E, 0xDF9E, 0xD73D,
-    0xC6FC, 0xCF1C, 0xC6FC, 0xD75D, 0xBEDB, 0xB69B, 0xB69B, 0xB6BB,
-    0xB67A, 0xBE9A, 0xBE9B, 0xC6DC, 0xC6DC, 0xBEBB, 0xB69B, 0xB67A,
-    0xAE5A, 0xAE3A, 0xB67A, 0xBE7A, 0xBE7A, 0xB67A, 0xB65A, 0xB65A,
-    0xB65A, 0xBE7A, 0xB67A, 0xBE7A, 0xBE9A, 0xBE9A, 0xBE7A, 0xBE7A,
-    0xBE7A, 0xB67A, 0xBE7A, 0xBE7A, 0xB65A, 0xB65A, 0xB639, 0xB639,
-    0xB63A, 0xB639, 0xB65A, 0xBE5A, 0xB65A, 0xAE39, 0xAE3A, 0xAE19,
-    0xAE19, 0xB639, 0xAE39, 0x8D77, 0x8537, 0x9597, 0xA5D8, 0x8D36,
-    0x8D57, 0x9598, 0x9DB8, 0xAE19, 0xAE39, 0x9DD8, 0x9598, 0x8536,
-    0x8D57, 0x95B8, 0xA5D8, 0x9DB8, 0xB639, 0xB65A, 0xB65A, 0xB65A,
-    0xB67A, 0xB67A, 0xB65A, 0xAE5A, 0xB67A, 0xB65A, 0xAE39, 0xB65A,
-    0xD75D, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F,
-    0xDFBF, 0xCF3D, 0xBEBB, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xD75E, 0xCF3D, 0xCF5D,
-    0xB67A, 0xB67A, 0xC6FC, 0xCF3D, 0xE7BF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBE,
-    0xDFBE, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBE, 0xE7DF, 0xC6FC, 0xB67A, 0xB67A, 0xB69A, 0xCF3D,
-    0xC6FC, 0xCF3D, 0xCF3D, 0xCF1C, 0xCF3D, 0xDFBF, 0xD79E, 0xB69B,
-    0xB69A, 0xB67A, 0xB67A, 0xB69B, 0xBE9B, 0xBE9B, 0xB69B, 0xBE9B,
-    0xB67A, 0xB65A, 0xB65A, 0xB67A, 0xB65A, 0xB67A, 0x9DD8, 0x9598,
-    0xA5F9, 0xA619, 0xA619, 0xA619, 0xAE3A, 0x9598, 0x8536, 0x8D77,
-    0xA619, 0x9DD8, 0x9DB8, 0x95B8, 0x9577, 0x9DB8, 0x9DB8, 0x9DB8,
-    0x9577, 0xA5F8, 0x95B8, 0x9598, 0xAE19, 0xAE5A, 0xB65A, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xBE9B, 0xBE9B, 0xBE9A, 0xB69A, 0xB69B,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB65A, 0xB67A, 0xB69A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xBE9B,
-    0xB67A, 0xB67A, 0xC6DB, 0xCF3D, 0xDF9F, 0xE7DF, 0xDF9E, 0xDFBE,
-    0xC6FC, 0xD77E, 0xDF9E, 0xCF5D, 0xC6FC, 0xC6DC, 0xBEBB, 0xC6DC,
-    0xBEDB, 0xBE9B, 0xCF3D, 0xCF1C, 0xBEBB, 0xBE9B, 0xB69A, 0xB67A,
-    0xB67A, 0xBE9B, 0xBE9B, 0xBE7A, 0xBE7A, 0xBE9A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xBE7A, 0xBE7A, 0xB65A, 0xB67A,
-    0xB67A, 0xBE7A, 0xBE9A, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A,
-    0xBE7A, 0xBE7A, 0xBE7A, 0xBE9A, 0xBE9A, 0xBE7A, 0xB65A, 0xB63A,
-    0xB63A, 0xAE39, 0xA5F9, 0xAE39, 0xB65A, 0x9DB8, 0xAE19, 0xB65A,
-    0xB65A, 0xAE3A, 0xA619, 0xAE39, 0x9DD8, 0xA5D8, 0x9DB8, 0xB65A,
-    0xB67A, 0xAE39, 0xA5D8, 0xAE19, 0xAE39, 0xA5D8, 0x9DD8, 0xAE19,
-    0xB65A, 0xAE19, 0xAE19, 0xB67A, 0xAE19, 0xA619, 0xB65A, 0xB67A,
-    0xB65A, 0xAE5A, 0xB67A, 0xB65A, 0xAE39, 0xAE39, 0xB67A, 0xCF5D,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xDFBF, 0xE7DF, 0xD77E, 0xC71C, 0xB69A, 0xB67A, 0xB67A,
-    0xBEDB, 0xB69B, 0xAE5A, 0xAE39, 0xC6FC, 0xD77E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xDFBF, 0xCF5D, 0xC71C, 0xC71C, 0xCF5D, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xC6FC, 0xC71C, 0xDFBE, 0xDFDF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF, 0xE7DF, 0xCF3D,
-    0xAE5A, 0xB69A, 0xB69A, 0xB69B, 0xBEBB, 0xBEBB, 0xB69B, 0xB67A,
-    0xBE9B, 0xBE9A, 0xBE7A, 0xBE9A, 0xBEBB, 0xC6DB, 0xBEBB, 0xBE9B,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xC6BB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xBEBB, 0xBE9B, 0xBE9B,
-    0xB67A, 0xAE39, 0xA619, 0x8D77, 0x9DD8, 0xAE5A, 0xAE5A, 0xB65A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE9B, 0xB67A, 0xB69A, 0xBE9B,
-    0xB69A, 0xB67A, 0xBE7A, 0xBE9A, 0xBE9A, 0xB67A, 0xBE7A, 0xBE9A,
-    0xB67A, 0xB67A, 0xBE9A, 0xBE9A, 0xBE7A, 0xBE7A, 0xBE9B, 0xBE9A,
-    0xB69A, 0xB67A, 0xB67A, 0xB69A, 0xB67A, 0xB67A, 0xBE9B, 0xB69A,
-    0xB67A, 0xBE9B, 0xD75D, 0xE7BF, 0xDF7E, 0xD75E, 0xC6DB, 0xBEBB,
-    0xC6FC, 0xBEDB, 0xBEBB, 0xB69B, 0xB69A, 0xB67A, 0xB69B, 0xB67A,
-    0xB67A, 0xBEBB, 0xC6DC, 0xBEBB, 0xBE9A, 0xBE7A, 0xBE7A, 0xB67A,
-    0xB67A, 0xB67A, 0xBE9A, 0xBE9A, 0xBE7A, 0xBE7A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A, 0xB65A, 0xB65A,
-    0xB65A, 0xB67A, 0xAE39, 0x9DD8, 0x8D57, 0x9597, 0x9DB8, 0x9597,
-    0x9577, 0x9597, 0x9597, 0x9DB8, 0xA5F9, 0xAE19, 0xB65A, 0xAE3A,
-    0xB65A, 0xAE3A, 0x9DB8, 0x9DB8, 0x9577, 0x9DD8, 0x9DB8, 0x95B8,
-    0x8D57, 0x8D57, 0x9DD8, 0xA5F9, 0xBE7A, 0xBE7A, 0xAE3A, 0xB63A,
-    0xB65A, 0xB65A, 0xB65A, 0xB639, 0xB65A, 0xAE39, 0xAE19, 0xB63A,
-    0xB639, 0xAE39, 0xB63A, 0xB63A, 0xAE39, 0xAE19, 0xB659, 0xB67A,
-    0xAE3A, 0xAE3A, 0xB67A, 0xB67A, 0xA639, 0xAE3A, 0xB69B, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xBEDC,
-    0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xDF9E, 0xC71C, 0xB65A, 0xC6FC, 0xB67A, 0xBEBB,
-    0xCF1D, 0xD75D, 0xCF3D, 0xB69B, 0xAE5A, 0xB65A, 0xB67A, 0xB69B,
-    0xBEBB, 0xB69A, 0xB69B, 0xBEBB, 0xB67A, 0xBEDB, 0xBEDB, 0xD77E,
-    0xDFBF, 0xD75D, 0xC71C, 0xAE5A, 0xAE59, 0xAE39, 0xAE7A, 0xCF5D,
-    0xDFDF, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xD75D, 0xB6BB, 0xB69B, 0xB69B, 0xB69B, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xB69B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBEBB,
-    0xB69B, 0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBE9B, 0xBE9B, 0xB69B, 0xB69B, 0xB69B, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xB69B, 0xB69A, 0xB69B, 0xBE7A,
-    0xB67A, 0xBE9A, 0xB69A, 0xBE9A, 0xBE9A, 0xBE9A, 0xB69A, 0xBE9A,
-    0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE7A,
-    0xB69A, 0xBE9A, 0xBE9A, 0xB67A, 0xBE9A, 0xBE9B, 0xBE9A, 0xBE9A,
-    0xBE9A, 0xBE9A, 0xB69A, 0xB69A, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A,
-    0xB69B, 0xBE9B, 0xBE9B, 0xCF3D, 0xC6DC, 0xBE9B, 0xBEBB, 0xBEDB,
-    0xBEDB, 0xBEBB, 0xBEBB, 0xB69A, 0xBE9B, 0xBEBB, 0xB67A, 0xB67A,
-    0xBE9A, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xB69A, 0xB67A, 0xB67A,
-    0xB65A, 0xAE39, 0x9DD8, 0x9DF9, 0x9DB8, 0xA5F9, 0xA619, 0xAE39,
-    0xAE39, 0x9DB8, 0x9DD8, 0xA5F9, 0x9DD8, 0x9DD8, 0x9DD8, 0xAE19,
-    0xA619, 0xA619, 0x9577, 0x9DB8, 0x9DD8, 0x8D77, 0x8D57, 0x8D57,
-    0x8D57, 0x8D57, 0x8D57, 0x8536, 0x7CF6, 0x8516, 0x8D77, 0x8536,
-    0x8D57, 0x8D77, 0x9577, 0xA619, 0xA5F9, 0x9DD8, 0xA5F9, 0xA619,
-    0xA5F9, 0xA619, 0xB67A, 0xB67A, 0xB65A, 0xBE7A, 0xBE9B, 0xBE7A,
-    0xB65A, 0xB67A, 0xBE7A, 0xB65A, 0xB65A, 0xB67A, 0xB67A, 0xB65A,
-    0xB65A, 0xB67A, 0xB65A, 0xB67A, 0xBEBB, 0xB69B, 0xB67A, 0xCEFC,
-    0xBE7A, 0xAE39, 0xB67A, 0xCF3D, 0xD77E, 0xD77E, 0xCF3D, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xBEBB, 0xC71C, 0xCF1D,
-    0xCF1D, 0xCF3D, 0xC6FC, 0xB69B, 0xB69B, 0xCF3D, 0xE7BF, 0xDFBF,
-    0xDFBE, 0xC71C, 0xB67A, 0xB69A, 0xB67A, 0xB65A, 0xB67A, 0xB67A,
-    0xAE5A, 0xAE39, 0xBEBB, 0xDF9E, 0xD75E, 0xD75D, 0xC6FC, 0xB67A,
-    0xBEDB, 0xBEBB, 0xCF3D, 0xC6FC, 0xBEBB, 0xCF1C, 0xE7BF, 0xDFBF,
-    0xE7DF, 0xCF5D, 0xD75E, 0xBEDB, 0xBE9B, 0xC6DC, 0xB69B, 0xAE7A,
-    0xCF3D, 0xD79E, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xD77E, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xCF1D, 0xCF5D, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFDF, 0xDFBE,
-    0xE7DF, 0xCF3D, 0xAE5A, 0xB69B, 0xBE9B, 0xBE9B, 0xB67A, 0xB67A,
-    0xB69A, 0xB69A, 0xB69B, 0xBE9B, 0xBE9B, 0xB69B, 0xB69B, 0xB69B,
-    0xBE9B, 0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB,
-    0xBE9B, 0xBE9B, 0xB69B, 0xB69B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B,
-    0xB67A, 0xBE9A, 0xBE9B, 0xBE9A, 0xBE9A, 0xBE9B, 0xBEBB, 0xBE9A,
-    0xBE9A, 0xBE9B, 0xBE9B, 0xB67A, 0xBE9A, 0xBEBB, 0xBE9B, 0xBE7A,
-    0xBE9A, 0xBE9B, 0xB69A, 0xB67A, 0xBE9B, 0xBE9B, 0xB69A, 0xB67A,
-    0xBE9B, 0xBE9B, 0xB69A, 0xBE9A, 0xBE9B, 0xBE9A, 0xB69A, 0xBE9A,
-    0xBE9B, 0xB69A, 0xB69A, 0xBE9A, 0xBE9B, 0xBE9A, 0xBE9A, 0xBE9A,
-    0xBE9A, 0xB67A, 0xB67A, 0xB67A, 0xB65A, 0xB67A, 0xB65A, 0xAE39,
-    0xAE39, 0xAE39, 0xAE19, 0xA5F9, 0x9DB8, 0x9DD8, 0x9DB8, 0x8D77,
-    0x8D57, 0x8557, 0x7D36, 0x8557, 0x7CF6, 0x7D16, 0x8D97, 0x9597,
-    0x8536, 0x8516, 0x8536, 0x7CF6, 0x95B8, 0x7D16, 0x7CF6, 0x7D16,
-    0x8537, 0x8536, 0x9598, 0xB67A, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B, 0xB65A, 0xB67B, 0xBE9B, 0xB67A,
-    0xAE3A, 0xB67B, 0xBE9B, 0xC6DB, 0xC6DB, 0xC6BB, 0xC6BB, 0xC6BB,
-    0xC6BB, 0xC6BB, 0xBE7A, 0xBE7A, 0xBE9B, 0xBE7A, 0xB67A, 0xBE9A,
-    0xBE9B, 0xBE7A, 0xB67A, 0xBE7A, 0xBE7A, 0xB67A, 0xB67A, 0xBE7A,
-    0xB67A, 0xB67A, 0xB69A, 0xB69A, 0xBEBB, 0xBEDB, 0xD77E, 0xE7BF,
-    0xDFBE, 0xCF3D, 0xBEDC, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xCF1C, 0xB67A, 0xC6FC, 0xBE9B,
-    0xAE39, 0xB65A, 0xB65A, 0xBEDC, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF,
-    0xCF5D, 0xC71C, 0xC6FC, 0xBE9B, 0xB69A, 0xB69A, 0xB67A, 0xB69B,
-    0xB69A, 0xCF1C, 0xE7BF, 0xDFBF, 0xE7BF, 0xE7DF, 0xCF3D, 0xB67A,
-    0xCF3C, 0xBEBB, 0xB69B, 0xBEDC, 0xBEBB, 0xBEBB, 0xCF1C, 0xCF1C,
-    0xC6FC, 0xCF3D, 0xCF3D, 0xD77E, 0xDF9F, 0xE7DF, 0xCF1D, 0xB69B,
-    0xB69B, 0xB67A, 0xAE5A, 0xAE39, 0xB67A, 0xB69A, 0xAE5A, 0xCF3D,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xC6FC, 0xD77E, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xCF3D, 0xB67A, 0xBE9A, 0xC6DC, 0xC6FC, 0xC6DC,
-    0xB67A, 0xBE9B, 0xB69B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xC6BB, 0xBEBB, 0xBE9B, 0xBEBB, 0xBEDB,
-    0xBEBB, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9B, 0xBEBB,
-    0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xBE7A, 0xBE9A, 0xBE9B, 0xBE9B, 0xB69A, 0xBE9A, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE7A,
-    0xBE9A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9B, 0xBE9A, 0xBE9A,
-    0xBE9A, 0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xAE5A, 0xAE39, 0xB65A,
-    0xAE19, 0x9DD8, 0xA5D8, 0xA5F9, 0x9DD8, 0x9DB8, 0xA619, 0xA619,
-    0xA5F9, 0x9DB8, 0x9DD8, 0xA639, 0xAE3A, 0xAE5A, 0xAE3A, 0xB65A,
-    0xAE39, 0xB65A, 0xA619, 0x9DD8, 0xA5F8, 0xA5F9, 0xAE3A, 0xB67A,
-    0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xB67A, 0xB67A, 0xBE7A, 0xBE7A,
-    0xBE7A, 0xB67A, 0xBE7A, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9B, 0xBEBB,
-    0xBE9B, 0xBE9B, 0xC6BB, 0xBEBB, 0xBEBB, 0xBE9A, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBE9A, 0xBE9A, 0xBE9A, 0xBE9A, 0xB67A, 0xB67A, 0xBE9A,
-    0xB67A, 0xB67A, 0xBE9A, 0xBEBB, 0xD77E, 0xD77E, 0xDFBF, 0xDF9F,
-    0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xC6DB, 0xAE5A, 0xB67A, 0xAE3A, 0xB67A,
-    0xB67A, 0xAE39, 0xC71C, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xBEDC,
-    0xBEDB, 0xBE9B, 0xAE3A, 0xB67A, 0xB69A, 0xB67A, 0xAE5A, 0xCF3D,
-    0xD75D, 0xBEBB, 0xB67A, 0xB69A, 0xBEBB, 0xBE9B, 0xB67A, 0xB67A,
-    0xC6FC, 0xB69B, 0xB67A, 0xBEBB, 0xC6DC, 0xB69B, 0xAE5A, 0xB67A,
-    0xB67A, 0xB67A, 0xAE5A, 0xBEBB, 0xD77E, 0xDF9E, 0xCF3D, 0xC71C,
-    0xBEBB, 0xB69A, 0xBEBB, 0xBE9B, 0xB67A, 0xB67A, 0xB69B, 0xCF1D,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF, 0xD79E, 0xC6DC, 0xBEBB, 0xC6FC,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xCF3D, 0xBEBB, 0xD79E,
-    0xDFDF, 0xD77E, 0xDFBF, 0xDF9E, 0xD77E, 0xD75D, 0xE7DF, 0xE7DF,
-    0xD77E, 0xBEBB, 0xB69B, 0xB69B, 0xBEBB, 0xBE9B, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBE9B, 0xB67A, 0xBE9B, 0xB67A, 0xB67A, 0xBE9B,
-    0xB69A, 0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B,
-    0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9B, 0xBE9A, 0xBEBB,
-    0xBE9B, 0xBE9B, 0xBE9A, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9A, 0xBE9B,
-    0xBE9A, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9A, 0xBEBB, 0xBE9B,
-    0xBE9A, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9A, 0xBEBB, 0xBE9A,
-    0xBE9A, 0xBE9B, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9A, 0xBE9B, 0xBE9B,
-    0xBE9B, 0xBEBB, 0xBE9B, 0xB69A, 0xBE9A, 0xBE9B, 0xBE9A, 0xBEBB,
-    0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9A, 0xBEDB,
-    0xBEBB, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9A, 0xBE9B, 0xBEBB,
-    0xBE9A, 0xB65A, 0xBE7A, 0xBEBB, 0xBEBB, 0xBEBB, 0xC6DB, 0xC6DC,
-    0xCF1C, 0xCEFC, 0xBEBB, 0xBE9B, 0xB67A, 0xBE7A, 0xBE9A, 0xBE9B,
-    0xBE9A, 0xBE7A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A, 0xBE9B, 0xBEBB,
-    0xBE9A, 0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9A, 0xBE9A, 0xBE7A,
-    0xBE7A, 0xBE9A, 0xBE9B, 0xBE9A, 0xBE9B, 0xBE9B, 0xBE9B, 0xBE9A,
-    0xBE9A, 0xBE9A, 0xBE9A, 0xBE7A, 0xB67A, 0xBE9B, 0xC6DB, 0xC6FC,
-    0xCEFC, 0xBE9A, 0xBE9A, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FC, 0xD77E,
-    0xDFDF, 0xDFDF, 0xC6FC, 0xB67A, 0xB67A, 0xAE3A, 0xAE39, 0xAE7A,
-    0xB69A, 0xCF5D, 0xE7DF, 0xDFBF, 0xD77E, 0xDFBF, 0xDF9E, 0xB67A,
-    0xB69A, 0xB67A, 0xAE5A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xB67A, 0xAE5A, 0xB67A, 0xB67A, 0xB65A, 0xB67A, 0xBE9A, 0xB65A,
-    0x9577, 0x9597, 0xB67A, 0xBEBB, 0xB65A, 0xAE5A, 0xB67A, 0xB67A,
-    0xB67A, 0xB67A, 0xB67A, 0xAE3A, 0xAE39, 0xC6FC, 0xBEBB, 0xB69B,
-    0xB65A, 0xB67A, 0xB69B, 0xB67A, 0xAE5A, 0xB65A, 0xB69A, 0xB67A,
-    0xB67A, 0xBEBB, 0xBEDB, 0xB69A, 0xAE39, 0xBE9B, 0xB65A, 0xAE3A,
-    0xCF5D, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xC6FC, 0xDF9E, 0xE7DF, 0xDF9F, 0xCF1D, 0xDFBF, 0xDF9E,
-    0xDFDF, 0xC6FC, 0xCF1C, 0xBEBB, 0xC6FC, 0xBEBB, 0xBEBB, 0xC6DB,
-    0xCEFC, 0xC6DC, 0xCF1C, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF1D, 0xC6FC,
-    0xC6DC, 0xC6DB, 0xC6DB, 0xC6DB, 0xC6DC, 0xC6DB, 0xBE9B, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xB69B, 0xB69B, 0xBEBB, 0xBEBB, 0xBE9B,
-    0xBE9B, 0xBEBB, 0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB, 0xBEBB, 0xB69A,
-    0xBE9B, 0xBEBB, 0xBE9B, 0xBE9B, 0xBE9B, 0xBEBB, 0xB69B, 0xBE9A,
-    0xBEBB, 0xBEBB, 0xBE9B, 0xBE9A, 0xBEBB, 0xBEBB, 0xB69B, 0xBE9B,
-    0xBEBB, 0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB,
-    0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B, 0xB69B, 0xBE9B, 0xBEBB,
-    0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B, 0xBE9B, 0xBEBB, 0xBE9B,
-    0xBEBB, 0xC6DC, 0xBE9B, 0xBE9B, 0xBE9B, 0xC6DC, 0xB69A, 0xBEBB,
-    0xBEBB, 0xC6DB, 0xBE9B, 0xBEBB, 0xBEBB, 0xB67A, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBE9B, 0xBEBB, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xC6DB, 0xBE9A, 0xBEBB, 0xC6DC, 0xBE9B, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xC6BB, 0xC6BB, 0xBEBB, 0xBEBB, 0xBEBB, 0xC6DC, 0xC6DB, 0xBEBB,
-    0xBE9B, 0xC6BB, 0xBEBB, 0xBEBB, 0xC6DC, 0xC6BB, 0xBE9B, 0xBEBB,
-    0xBEBB, 0xC6BB, 0xBEBB, 0xBEBB, 0xC6BB, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xBE9B, 0xC6FC, 0xCF3D, 0xCF3D, 0xCF3D, 0xD75D, 0xE7BF, 0xE7DF,
-    0xE7DF, 0xD77E, 0xC6DC, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F,
-    0xD77E, 0xCF3D, 0xC6FC, 0xBEBB, 0xC6FC, 0xCF5D, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xCF5D, 0xBE9B, 0xAE5A, 0xB65A, 0xB67A, 0xAE3A,
-    0xBEBB, 0xCF3D, 0xDF9E, 0xD77E, 0xA639, 0xAE5A, 0xB67A, 0xAE5A,
-    0xAE5A, 0xB67A, 0xC6DB, 0xB67A, 0xAE3A, 0xAE5A, 0xAE5A, 0xB65A,
-    0xAE39, 0xB67A, 0xBE9B, 0xB67A, 0xB67A, 0xB67A, 0xBE9A, 0xA619,
-    0xAE3A, 0xA5D8, 0x9DB8, 0xA619, 0xAE39, 0xAE5A, 0xB67A, 0xB67A,
-    0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xAE19, 0xAE39, 0xB67A, 0xB65A,
-    0xB65A, 0xB65A, 0xB65A, 0xAE5A, 0xB67A, 0xB67A, 0xB67A, 0xB67A,
-    0xAE5A, 0xAE5A, 0xAE59, 0xAE59, 0xAE39, 0x9DD8, 0xAE39, 0xB67A,
-    0xB67A, 0xBEBB, 0xBEBB, 0xC71C, 0xD77E, 0xE7DF, 0xDFBF, 0xE7DF,
-    0xDF9E, 0xD77E, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xDF9E, 0xC6DC, 0xC71C, 0xC6FC, 0xD75D, 0xBEBB,
-    0xC6DC, 0xBE9B, 0xDF9E, 0xE7BF, 0xE7BF, 0xE7BF, 0xE7BF, 0xE7BF,
-    0xDF9E, 0xD77D, 0xBEDB, 0xC6DC, 0xBEBB, 0xBEDC, 0xBEBB, 0xC6DC,
-    0xBE9B, 0xC6DC, 0xC6DC, 0xBEDC, 0xBEBB, 0xC6DC, 0xC6DB, 0xBEDB,
-    0xBEBB, 0xC6DC, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEDB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xC6DC,
-    0xC6DC, 0xC6DC, 0xC6DC, 0xC6DC, 0xC6DB, 0xC6DB, 0xC6DC, 0xC6DC,
-    0xC6DC, 0xC6DC, 0xC6DC, 0xC6FC, 0xC6DC, 0xC6DB, 0xC6DC, 0xC6DB,
-    0xC6DC, 0xC6DC, 0xC6FC, 0xC6DC, 0xC6DC, 0xC6DB, 0xC6FC, 0xC6DC,
-    0xC6FC, 0xC6FC, 0xCF1C, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6DC, 0xC6FC,
-    0xC6FC, 0xC6DC, 0xC6DC, 0xC6FC, 0xC6DC, 0xC6FC, 0xC6DC, 0xC6DC,
-    0xC6FC, 0xC6FC, 0xC6FC, 0xC6DC, 0xC6FC, 0xC6DC, 0xC6FC, 0xC6DC,
-    0xC6FC, 0xC6FC, 0xC6FC, 0xC6DC, 0xC6DB, 0xC6DC, 0xC6DC, 0xC6DC,
-    0xC6DB, 0xC6DC, 0xC6DC, 0xC6DC, 0xC6DC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xC6DC, 0xC6DB, 0xC6FC, 0xC6DB, 0xC6DC, 0xC6DC, 0xC6DC, 0xBEDB,
-    0xBEBB, 0xC6DC, 0xC6DC, 0xC6DB, 0xC6DC, 0xC6FC, 0xD75D, 0xCF3D,
-    0xCF3D, 0xDF9E, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDF9E,
-    0xE7BF, 0xE7DF, 0xE7DF, 0xD77E, 0xD77E, 0xD77E, 0xDF9E, 0xC6DC,
-    0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB69B, 0xBEBB, 0xC6FC,
-    0xC6FC, 0xBE9B, 0xC6FC, 0xC6DC, 0xB69B, 0xBEBB, 0xC6FC, 0xBEBB,
-    0xBEBB, 0xB67A, 0xBE9B, 0xB69B, 0xAE5A, 0xB67A, 0xB67A, 0xB67A,
-    0xB69B, 0xBEBB, 0xBEBB, 0xBE9B, 0xB67A, 0xB65A, 0xB67A, 0xBE9B,
-    0xB67A, 0xB67A, 0xBE9B, 0xBEBB, 0xB69A, 0xBE9A, 0xBE9A, 0xB69A,
-    0xB67A, 0xC6DB, 0x9557, 0x9DB8, 0xB67A, 0xB65A, 0xAE39, 0xB67A,
-    0xB67A, 0xB65A, 0xB65A, 0xB69A, 0xBEBB, 0xAE5A, 0xAE39, 0xB67A,
-    0xB67A, 0xB65A, 0xAE5A, 0xB67A, 0xB69A, 0xAE5A, 0xB65A, 0xBE9B,
-    0xBE9B, 0xB65A, 0xB67A, 0xB69A, 0xAE59, 0xA619, 0xB67A, 0xB67A,
-    0xB67A, 0xB65A, 0xB67A, 0xB67A, 0xB67A, 0xBEBB, 0xD77E, 0xD77E,
-    0xB67A, 0xB67A, 0xB69B, 0xC6DB, 0xD75D, 0xCF5E, 0xCF5E, 0xD77E,
-    0xD75D, 0xCF5D, 0xD77E, 0xD77E, 0xD75E, 0xDF9E, 0xE7BF, 0xDF9E,
-    0xDF7E, 0xD77E, 0xE7BF, 0xDF9E, 0xD75D, 0xCF3D, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xCF3D, 0xD77E, 0xD77E, 0xD77E,
-    0xD75D, 0xC6FC, 0xCF3D, 0xCF1C, 0xC6DC, 0xC6FC, 0xCF1C, 0xC6FC,
-    0xC6FC, 0xCF1C, 0xCF3D, 0xC6FC, 0xC6FC, 0xC6FC, 0xCF1D, 0xC6FC,
-    0xC6DC, 0xC71C, 0xC6FC, 0xC6DC, 0xC6DC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xC6FC, 0xC6FC, 0xC6FC, 0xC6DC, 0xC6FC, 0xC6FC, 0xC6DC, 0xC6FC,
-    0xC71C, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xC71C, 0xC6FC, 0xC6FC, 0xC71C, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xC71C, 0xC6FC, 0xC6FC, 0xCF1D, 0xC71C, 0xC71C, 0xC6FC, 0xC71C,
-    0xC6FC, 0xC71C, 0xC71C, 0xCF1C, 0xC6FC, 0xCF1C, 0xCF1C, 0xC6FC,
-    0xC71C, 0xC6FC, 0xCF1D, 0xC71C, 0xCF1C, 0xC71C, 0xCF1C, 0xC6FC,
-    0xC71C, 0xCF1C, 0xCF1C, 0xC71C, 0xCF1C, 0xCF1C, 0xC6FC, 0xCF1C,
-    0xC6FC, 0xCF1D, 0xC71C, 0xCF1C, 0xC71C, 0xCF1D, 0xCF1C, 0xCF3D,
-    0xCF1D, 0xCF1D, 0xC71C, 0xCF1C, 0xCF1D, 0xCF1C, 0xCF1D, 0xCF1C,
-    0xCF3D, 0xC71C, 0xCF1D, 0xCF1C, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xBEDB, 0xC6FC, 0xCF1D, 0xD75D, 0xC6FC, 0xB65A,
-    0xBE9B, 0xC6FC, 0xC6FC, 0xAE5A, 0xAE3A, 0xAE39, 0xA619, 0x9DD8,
-    0xA5F8, 0xAE39, 0xAE39, 0xAE5A, 0xAE3A, 0xAE39, 0xA619, 0xA619,
-    0xAE39, 0xAE39, 0xAE19, 0xAE5A, 0xC6FC, 0xBEBB, 0xB67A, 0xBE9B,
-    0xBEBB, 0xB67A, 0xB67A, 0xB69B, 0xB69A, 0xB67A, 0xB65A, 0xB67A,
-    0xBEBB, 0xB69A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xB67A, 0xBE9A,
-    0xBE9A, 0xB67A, 0xB67A, 0xC6FC, 0xC6DB, 0xB67A, 0xB69A, 0xBEDB,
-    0x9598, 0xAE39, 0xB67A, 0xB65A, 0xAE19, 0xA5F9, 0xAE39, 0xB65A,
-    0xAE39, 0xAE19, 0xAE19, 0xB659, 0xAE39, 0xAE19, 0xAE39, 0xB65A,
-    0xB65A, 0xB67A, 0xAE5A, 0xAE59, 0xAE5A, 0xAE5A, 0xAE39, 0xAE19,
-    0xA619, 0xAE5A, 0xA619, 0xA619, 0xA619, 0xAE3A, 0xAE39, 0xAE5A,
-    0xAE5A, 0xAE5A, 0xAE5A, 0xB67A, 0xAE5A, 0xAE3A, 0xAE5A, 0xAE39,
-    0xAE39, 0xB65A, 0xAE5A, 0xB67A, 0xB67A, 0xAE5A, 0xAE5A, 0xA639,
-    0xA619, 0xAE3A, 0xB67B, 0xC6FC, 0xC71D, 0xDF9E, 0xDF7E, 0xE7BF,
-    0xE7BF, 0xE7DF, 0xDF9E, 0xCF1C, 0xBEBB, 0xB67A, 0xC6FC, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xE7BF, 0xDFDF,
-    0xDFBF, 0xCF3D, 0xD77E, 0xD75E, 0xCF3D, 0xC71D, 0xCF3D, 0xC71D,
-    0xC71D, 0xC71C, 0xCF3D, 0xC6FC, 0xC71D, 0xC71C, 0xCF3D, 0xC71C,
-    0xC6FC, 0xC71D, 0xC71D, 0xC6FC, 0xC71C, 0xCF3D, 0xC71D, 0xC6FC,
-    0xC71C, 0xC71D, 0xC71C, 0xC71C, 0xC71C, 0xC73D, 0xC71C, 0xC71C,
-    0xC73D, 0xC73D, 0xC71C, 0xC71C, 0xC71D, 0xC71C, 0xC6FC, 0xC71C,
-    0xC73D, 0xC71C, 0xC71D, 0xC71C, 0xC71D, 0xC71C, 0xC71C, 0xC71C,
-    0xC71D, 0xC6FC, 0xC6FC, 0xC71D, 0xC71D, 0xC71C, 0xC71C, 0xC71D,
-    0xC6FC, 0xC71C, 0xC71C, 0xC71D, 0xC71C, 0xCF3D, 0xC71C, 0xC71C,
-    0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xC6FC,
-    0xC71C, 0xC71C, 0xC71D, 0xC71C, 0xCF1C, 0xCF1C, 0xC71C, 0xC6FC,
-    0xC71C, 0xC71C, 0xC71C, 0xC71C, 0xCF1C, 0xCF1C, 0xC6FC, 0xC71C,
-    0xC71C, 0xCF3D, 0xC71C, 0xC71C, 0xC71C, 0xCF1D, 0xC71C, 0xCF1C,
-    0xCF1C, 0xC71C, 0xC6FC, 0xCF1D, 0xCF1D, 0xC71C, 0xCF1D, 0xC6FC,
-    0xCF1D, 0xC6FC, 0xCF1D, 0xC6FC, 0xC71C, 0xC6FC, 0xBEDC, 0xC6FC,
-    0xC6DC, 0xC6FC, 0xC6FC, 0xBEBB, 0xBEBB, 0xBEDC, 0xBEBB, 0xC6FC,
-    0xC6DC, 0xC6DC, 0xBEBB, 0xC6DC, 0xC6FC, 0xC6DC, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xB67A, 0xAE5A,
-    0xAE39, 0xAE39, 0xAE39, 0xB67A, 0xB67A, 0xAE5A, 0xB65A, 0xAE5A,
-    0xAE5A, 0xAE39, 0xA619, 0xB65A, 0xBE9B, 0xBE9A, 0xBE9B, 0xB67A,
-    0xB69A, 0xB69A, 0xBE9B, 0xBE9B, 0xB67A, 0xB65A, 0xB67A, 0xB67A,
-    0xB69A, 0xBEBB, 0xC6FC, 0xC71C, 0xCEFC, 0xC6FC, 0xC6DC, 0xB67A,
-    0xB67B, 0x9DD9, 0xB67A, 0xB65A, 0xA5F9, 0xA5F9, 0xAE39, 0xAE5A,
-    0xAE19, 0xAE39, 0xAE19, 0xAE3A, 0xA5F8, 0xAE39, 0xB67A, 0xAE39,
-    0xAE5A, 0xB69B, 0xBE9B, 0xB69B, 0xAE5A, 0xB69B, 0xB69B, 0xB67B,
-    0xA619, 0xAE5A, 0xAE5A, 0xAE5A, 0xBEBB, 0xAE5A, 0xA619, 0xAE5A,
-    0xB69B, 0xB67A, 0xB67A, 0xB69B, 0xBE9B, 0xB69A, 0xB67A, 0xB69B,
-    0xB67A, 0xB67A, 0xB65A, 0xAE5A, 0xAE7A, 0xB67A, 0xAE7A, 0xB67A,
-    0xB69B, 0xBE9B, 0xAE5A, 0xBEBB, 0xC6FC, 0xB69B, 0xBEBB, 0xC6DC,
-    0xC6FC, 0xC6DC, 0xBEBB, 0xB67A, 0xB67B, 0xBEBB, 0xB69B, 0xB69B,
-    0xC6FC, 0xBEDC, 0xC6FC, 0xBEDC, 0xBEDC, 0xBEBB, 0xBEBC, 0xC6FC,
-    0xCF1D, 0xCF3D, 0xDF9E, 0xDFBF, 0xDFBF, 0xD77E, 0xD77E, 0xD75E,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xC73D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xC73D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xC73D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xC71D, 0xCF3D, 0xCF3D, 0xC73D, 0xCF3D, 0xC73D, 0xCF3D,
-    0xC71D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC73D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xC71D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF1D, 0xC71C,
-    0xC71D, 0xCF3D, 0xC73D, 0xC71D, 0xCF3D, 0xCF3D, 0xC71D, 0xC71C,
-    0xCF3D, 0xCF3D, 0xC71D, 0xCF3D, 0xCF3D, 0xCF1D, 0xC71C, 0xCF3D,
-    0xCF1D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF1D, 0xC71D, 0xCF3D, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC71C, 0xC71C, 0xC6FC,
-    0xC6FC, 0xC6FC, 0xC6FC, 0xC71C, 0xC6FC, 0xBEDB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBE9B, 0xB69B, 0xBEFC, 0xC6FC, 0xC6FC, 0xC6FC, 0xBEDC,
-    0xC6FC, 0xC6DC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6DC, 0xBEDC, 0xC6FC,
-    0xC6FC, 0xC71C, 0xC71C, 0xC71C, 0xCF1D, 0xCF1C, 0xCF3D, 0xCF1C,
-    0xCF3D, 0xCF1C, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6DC, 0xC6FC,
-    0xCF1D, 0xCF1D, 0xC71C, 0xCF1C, 0xCF3D, 0xC71D, 0xC71C, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC6DC, 0xCF1C, 0xCF1D,
-    0xBEBB, 0xC6DC, 0xC6FC, 0xBEBB, 0xBEBC, 0xBEDC, 0xBEBB, 0xC6DC,
-    0xCF3D, 0xD73D, 0xDF9E, 0xDF7E, 0xDF7E, 0xD75E, 0xD73D, 0xCF1D,
-    0xC6FC, 0xCF3D, 0xD75D, 0xCF1D, 0xD75D, 0xD73D, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xBEBB, 0xBE9B, 0xC6DC, 0xBEBC, 0xBEDC,
-    0xBE9B, 0xBEDC, 0xC6DC, 0xBEDC, 0xBEDC, 0xC6FC, 0xC71C, 0xC71D,
-    0xCF5D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC73D,
-    0xCF3D, 0xC73D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC73D, 0xCF3D,
-    0xC73D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC73D,
-    0xCF3D, 0xC73D, 0xCF3D, 0xC73D, 0xCF3D, 0xC73D, 0xCF3D, 0xC73D,
-    0xC73D, 0xC73D, 0xCF3D, 0xC73D, 0xC73D, 0xCF3D, 0xC73D, 0xC73D,
-    0xC73D, 0xCF3D, 0xCF3D, 0xC73D, 0xCF3D, 0xCF5D, 0xC71D, 0xC71D,
-    0xC73D, 0xCF3D, 0xC71D, 0xC71D, 0xCF3D, 0xCF1D, 0xCF1D, 0xC71D,
-    0xCF3D, 0xCF1D, 0xC71D, 0xCF1D, 0xCF3D, 0xC71D, 0xC73D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF3D,
-    0xCF1D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1C,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD77D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1D,
-    0xCF3D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF1D, 0xCF1C, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xC71D, 0xCF3D, 0xC73D, 0xC71D, 0xCF1D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD75E, 0xD77E, 0xD77E, 0xD75D,
-    0xD75D, 0xD77E, 0xDFBF, 0xDF9E, 0xDFBF, 0xD77E, 0xD77E, 0xD75E,
-    0xDF9E, 0xC71C, 0xCF3D, 0xC6FC, 0xCF3D, 0xCF1D, 0xCF3D, 0xD73D,
-    0xCF1D, 0xC6FC, 0xC6DC, 0xC6FC, 0xCF1D, 0xD75D, 0xD77E, 0xE7DF,
-    0xD75D, 0xD77E, 0xD77E, 0xDF7E, 0xD75D, 0xD77E, 0xDF7E, 0xDF7E,
-    0xD75E, 0xD75D, 0xD75E, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xC71D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xC73D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xC73D, 0xC73D, 0xCF3D, 0xC73D, 0xCF3D, 0xCF3D, 0xC73D, 0xCF1D,
-    0xC73D, 0xCF3D, 0xC73D, 0xC71D, 0xC73D, 0xCF3D, 0xC73D, 0xC71D,
-    0xC73D, 0xCF3D, 0xC71D, 0xC71D, 0xCF3D, 0xCF3D, 0xC71D, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xC71D, 0xCF3D, 0xCF3D, 0xC71D, 0xC71D, 0xCF3D,
-    0xCF3D, 0xC71D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF1D, 0xC71D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF1C, 0xCF1D, 0xCF3D, 0xCF3D, 0xC71D,
-    0xCF1D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF1C,
-    0xCF3D, 0xCF1C, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF1C, 0xCF3D, 0xCF1D,
-    0xCF3D, 0xCF1D, 0xCF1C, 0xCF1D, 0xCF3D, 0xCF1D, 0xC71C, 0xCF1D,
-    0xCF1C, 0xC71C, 0xC71C, 0xCF3D, 0xCF1D, 0xC71D, 0xCF1D, 0xCF3D,
-    0xCF3D, 0xC71C, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1C, 0xCF3D, 0xCF1D,
-    0xCF1D, 0xCF1D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF1C, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF1C, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF1D, 0xC71D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xDF9E, 0xDF9E, 0xD75E, 0xD77E,
-    0xC6DC, 0xC6DC, 0xBEDC, 0xAE5A, 0xB67A, 0xA619, 0xA639, 0xB67A,
-    0xB67B, 0xA619, 0xA619, 0xAE3A, 0xAE3A, 0xAE3A, 0xB67B, 0xBE9B,
-    0xB69B, 0xAE5A, 0xA639, 0xAE3A, 0xA63A, 0xAE5A, 0xB6BB, 0xC6FC,
-    0xC6FC, 0xC6FC, 0xC6FC, 0xBEDC, 0xBEBB, 0xBEDC, 0xC6FC, 0xBEDC,
-    0xBEDC, 0xC71C, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xC73D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF3D,
-    0xCF1D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF1D, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xD75E, 0xC6FC, 0xB69B, 0xB67A,
-    0xAE39, 0xAE5A, 0xAE39, 0x9DF9, 0x9DD8, 0xAE3A, 0xB67A, 0xB67A,
-    0xAE5A, 0xAE3A, 0xAE3A, 0xAE3A, 0xAE19, 0xA5F9, 0xA5F9, 0x9DF9,
-    0xA619, 0xAE3A, 0xB67A, 0xAE39, 0xA639, 0xA63A, 0xA63A, 0xA63A,
-    0xB67B, 0xB69B, 0xBE9B, 0xB69B, 0xB69B, 0xB69B, 0xBEBB, 0xBE9B,
-    0xBEDC, 0xCF1D, 0xCF1D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF1D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD73D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xD73D, 0xCF3D, 0xCF3D, 0xD73D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xD75D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xD75D,
-    0xC71C, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF1D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF1C, 0xD75D, 0xCF5D, 0xCF3D, 0xCF3D, 0xD77E, 0xCF3D, 0xCF1C,
-    0xCF3D, 0xD75D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF1D,
-    0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xC71C, 0xC71C, 0xC6FC, 0xBEBB, 0xBEDB, 0xBEBB,
-    0xBE9B, 0xB69B, 0xB69B, 0xBEBB, 0xC6FC, 0xB67B, 0xA5F9, 0xA63A,
-    0xB67B, 0xBEDC, 0xC6DC, 0xBE9B, 0xB67B, 0xBE9B, 0xC6FC, 0xBEBC,
-    0xBEBC, 0xB69B, 0xBEBB, 0xBEBB, 0xC6FC, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD75D, 0xCF3D, 0xD75E,
-    0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xC73D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF3D, 0xCF5E, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF5D, 0xCF1D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xD75E, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xD75D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D,
-    0xCF1D, 0xCF5D, 0xD75D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD75D, 0xCF1D,
-    0xCF1D, 0xD75D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF1D,
-    0xD75D, 0xD73D, 0xCF3D, 0xCF1C, 0xD75D, 0xD75D, 0xCF1D, 0xCF1C,
-    0xD75D, 0xCF3D, 0xCF1D, 0xCF3D, 0xD75D, 0xCF5D, 0xCF1C, 0xD77E,
-    0xCF3D, 0xCF5D, 0xCF1C, 0xD75D, 0xCF5D, 0xCF3D, 0xD75D, 0xD75D,
-    0xCF5D, 0xCF1D, 0xCF3D, 0xD75D, 0xCF5D, 0xCF1D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xD75D, 0xCF3D,
-    0xD77E, 0xD77E, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xD75D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xD75D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xD75E,
-    0xC73D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xD75D, 0xCF5D, 0xD75E,
-    0xD77E, 0xD75D, 0xD75D, 0xD75E, 0xD79E, 0xD77E, 0xD75D, 0xCF1D,
-    0xCF3D, 0xD75D, 0xCF3D, 0xD75D, 0xD75D, 0xD75E, 0xD77E, 0xD75D,
-    0xD77E, 0xD75D, 0xCF3D, 0xD75D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5E, 0xCF5D,
-    0xD77E, 0xCF5D, 0xCF7E, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5E, 0xCF5D,
-    0xCF7E, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF7E, 0xCF3D, 0xCF5E,
-    0xCF5D, 0xCF5E, 0xCF5D, 0xCF5D, 0xCF7E, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5E, 0xCF5D, 0xD79E, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5E,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF5E, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5E, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5E, 0xCF3D, 0xCF5D,
-    0xD75D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xD75E,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xD75D, 0xD75D, 0xD75D, 0xCF3D, 0xD75D,
-    0xCF5D, 0xCF5D, 0xD77E, 0xD75D, 0xD75D, 0xCF3D, 0xD75E, 0xCF3D,
-    0xD75D, 0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD75D, 0xCF3D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xD75D, 0xCF5D, 0xD75D, 0xCF5D, 0xCF3D,
-    0xD75E, 0xD75D, 0xCF3D, 0xD75D, 0xD75D, 0xCF5D, 0xD75D, 0xD73D,
-    0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xD75D, 0xCF3D, 0xCF5D, 0xCF3D, 0xD75D,
-    0xD77E, 0xD77E, 0xCF5D, 0xD75D, 0xD75D, 0xD75D, 0xD75D, 0xD75D,
-    0xD75D, 0xD75D, 0xD75D, 0xD75D, 0xD77E, 0xD75D, 0xD75D, 0xD75D,
-    0xD75D, 0xD75D, 0xD75D, 0xD75D, 0xD77E, 0xD77E, 0xD77E, 0xD77D,
-    0xD75D, 0xD75D, 0xD77E, 0xD77D, 0xD75D, 0xD77E, 0xD77E, 0xD79E,
-    0xD75D, 0xD77E, 0xD75E, 0xCF5D, 0xCF5D, 0xD77E, 0xCF5D, 0xCF5D,
-    0xD77E, 0xCF5D, 0xCF5D, 0xCF5D, 0xD75E, 0xCF5D, 0xD75D, 0xD75D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xD75D, 0xCF5D, 0xD75D,
-    0xD77E, 0xD75D, 0xCF5D, 0xCF5D, 0xCF5D, 0xD75D, 0xD75D, 0xCF5D,
-    0xCF3D, 0xD75D, 0xD77E, 0xD75E, 0xD77E, 0xD75D, 0xD77E, 0xCF5D,
-    0xCF5D, 0xD77E, 0xCF5D, 0xD77E, 0xD77E, 0xCF5D, 0xD77E, 0xD75D,
-    0xD77E, 0xCF5D, 0xD77E, 0xCF5D, 0xCF7D, 0xD75D, 0xD77D, 0xCF7D,
-    0xD77E, 0xD77E, 0xCF5D, 0xCF7E, 0xCF7E, 0xD75D, 0xCF7E, 0xD77E,
-    0xD77E, 0xD77E, 0xCF7E, 0xD77E, 0xCF5E, 0xD77E, 0xCF5D, 0xD77E,
-    0xCF7E, 0xCF7E, 0xCF5E, 0xCF7D, 0xD77E, 0xCF7E, 0xD77E, 0xD77E,
-    0xCF7E, 0xCF7E, 0xCF7D, 0xD79E, 0xCF7E, 0xCF5D, 0xD77E, 0xCF7E,
-    0xCF7E, 0xCF5D, 0xCF7E, 0xCF7E, 0xCF7E, 0xCF7E, 0xCF7D, 0xCF7E,
-    0xCF7E, 0xCF7E, 0xD77E, 0xCF7E, 0xCF5D, 0xCF7E, 0xD77E, 0xD77E,
-    0xCF5D, 0xD77E, 0xCF5E, 0xCF5D, 0xCF7D, 0xD77E, 0xD77E, 0xD77E,
-    0xD77E, 0xD77E, 0xCF7E, 0xCF5D, 0xD77E, 0xD75E, 0xCF7E, 0xCF5D,
-    0xD75D, 0xD77E, 0xCF7E, 0xCF5D, 0xCF5D, 0xD77E, 0xCF5D, 0xCF5E,
-    0xD77E, 0xCF7D, 0xCF7D, 0xD77D, 0xD75E, 0xD75D, 0xCF5D, 0xD75E,
-    0xD77E, 0xCF5D, 0xCF5D, 0xD77E, 0xD77E, 0xD77D, 0xD77E, 0xD77E,
-    0xD77E, 0xD77E, 0xCF5D, 0xD75E, 0xD77E, 0xD77E, 0xD77E, 0xCF5D,
-    0xD75E, 0xD75D, 0xD77E, 0xD77E, 0xD75D, 0xD77E, 0xD77E, 0xD75E,
-    0xD77E, 0xD75D, 0xD77E, 0xD77D, 0xD77E, 0xCF5D, 0xD77E, 0xD75D,
-    0xD77E, 0xD75D, 0xD77E, 0xD75D, 0xD75E, 0xD77E, 0xD77E, 0xDF9E,
-    0xD77E, 0xD77E, 0xD77D, 0xD75D, 0xD75D, 0xD77E, 0xD77E, 0xCF3D,
-    0xD77E, 0xD77E, 0xD75D, 0xD75D, 0xD77E, 0xD75E, 0xD75E, 0xD75E,
-    0xD75D, 0xD77E, 0xD75D, 0xD75E, 0xD75E, 0xD75E, 0xD75D, 0xD77D,
-    0xD75D, 0xD75D, 0xD75D, 0xD75D, 0xCF3D, 0xD75D, 0xD75D, 0xDFBF,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xCF3D, 0xD75D, 0xCF3D, 0xCF5D, 0xCF5D,
-    0xCF3D, 0xD75E, 0xCF3D, 0xCF5D, 0xD75D, 0xD75D, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xD75D, 0xCF3D, 0xD75D, 0xCF5D, 0xDFDF, 0xCF3D, 0xD75D,
-    0xD75D, 0xCF5D, 0xD79E, 0xCF3D, 0xCF5D, 0xD77E, 0xD75D, 0xD77E,
-    0xD77E, 0xCF5D, 0xD75D, 0xCF5D, 0xCF5D, 0xD77E, 0xCF5D, 0xCF3D,
-    0xD75E, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xD75D,
-    0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xCF5D, 0xD77E, 0xDFBF, 0xCF3D, 0xDFBF, 0xCF3D, 0xDFBE, 0xCF3D,
-    0xCF5D, 0xD75D, 0xCF3D, 0xD75E, 0xCF5D, 0xCF3D, 0xD75D, 0xCF5D,
-    0xD75D, 0xCF5D, 0xCF3D, 0xCF3D, 0xD75D, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF5D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5E,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xD75D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF7D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xD77D, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xCF5D, 0xD75D, 0xCF5D, 0xD77E, 0xDF9F, 0xCF3D, 0xDFBF, 0xD75D,
-    0xD77E, 0xD77E, 0xCF5D, 0xCF5D, 0xD77E, 0xCF5D, 0xDF9E, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xD77E, 0xD77E, 0xC71C, 0xDF7E, 0xD75D, 0xD75D,
-    0xCF5D, 0xCF3D, 0xCF5D, 0xCF3D, 0xD75D, 0xCF5D, 0xD77E, 0xCF3D,
-    0xD77E, 0xCF3D, 0xD77E, 0xCF5D, 0xD75D, 0xDF9E, 0xCF3D, 0xDF9E,
-    0xCF3D, 0xDF9E, 0xD75D, 0xCF3D, 0xD77E, 0xCF3D, 0xD75D, 0xCF3D,
-    0xD75D, 0xCF3D, 0xD73D, 0xCF5D, 0xD75D, 0xCF3D, 0xD75D, 0xD75D,
-    0xCF3D, 0xD77E, 0xCF3D, 0xD73D, 0xD75D, 0xCF3D, 0xCF3D, 0xD75D,
-    0xCF3D, 0xD75D, 0xDF9E, 0xDFBF, 0xDF9F, 0xDFBF, 0xD75D, 0xC6DB,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF,
-    0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xDF9E, 0xDF9E, 0xDFBE, 0xDFBE,
-    0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xE7BE,
-    0xDFBE, 0xDFBF, 0xDFBE, 0xDFBE, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xE7DF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7DF,
-    0xE7DF, 0xE7BF, 0xAE38, 0x9555, 0x9575, 0x9D96, 0x7CB2, 0x4B2C,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xDFBE, 0xDFBE, 0xDFBE, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xE7BE, 0xE7DF, 0xEFFF, 0xEFFF, 0xEFFF,
-    0xEFFF, 0xE7FF, 0xEFFF, 0xC6FB, 0xB659, 0xB679, 0xBE9A, 0x9575,
-    0x63CF, 0x6C10, 0x4B2C, 0x3ACA, 0x3ACA, 0x3ACA, 0x42EB, 0x4B2C,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xDFBF, 0xDF9E,
-    0xBEBB, 0xA619, 0xA63A, 0xA63A, 0xA63A, 0xAE3A, 0xA619, 0xBEDB,
-    0xDF9E, 0xD79E, 0xDF9E, 0xE7DF, 0xDFBE, 0xDF9E, 0xDFBE, 0xDFBE,
-    0xE7BE, 0xE7DF, 0xDF9E, 0xDF7D, 0x9D96, 0x84D2, 0x84F3, 0x84F3,
-    0x84F3, 0x84F3, 0x84F3, 0x5B8E, 0x3ACA, 0x42EB, 0x42EB, 0x430B,
-    0x430B, 0x430B, 0x4B2C, 0x4B4C, 0x4B4C, 0x4B4C, 0x4B4C, 0x4B2C,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xDFDF, 0xDFDF, 0xE7DF, 0xD77E, 0xBEBB, 0xA619, 0x8D57,
-    0x8536, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6, 0x74F6, 0x7D16,
-    0x8D77, 0x8D57, 0x95D9, 0x9DF9, 0xC6FC, 0xE7DF, 0xD79E, 0xDF9E,
-    0xD75D, 0xB69A, 0x8514, 0x536D, 0x430B, 0x4B2C, 0x4B0B, 0x42EB,
-    0x42EB, 0x42EB, 0x42EB, 0x4B0B, 0x4B2C, 0x4B4C, 0x4B2C, 0x4B4C,
-    0x4B4C, 0x4B4C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xD77E, 0xCF3D, 0xCF3D,
-    0xCF5D, 0xA619, 0x9598, 0x95D8, 0x9598, 0x7CF6, 0x7D16, 0x8516,
-    0x8517, 0x8537, 0x8537, 0x8537, 0x8536, 0x8536, 0x8537, 0x8537,
-    0x7CF6, 0x7CF6, 0x74D5, 0x6412, 0x7493, 0x6C51, 0x5BAE, 0x7472,
-    0x7CF4, 0x6411, 0x6411, 0x63EF, 0x536D, 0x63CF, 0x536D, 0x4B4C,
-    0x534C, 0x4B4C, 0x534C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xEFFF, 0xEFFF, 0xEFFF,
-    0xEFFF, 0xEFFF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xEFFF,
-    0xE7DF, 0xDF9E, 0xC6DB, 0x9DF8, 0xA619, 0x8D77, 0x7CF6, 0x8516,
-    0x8516, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6, 0x8517, 0x8516, 0x8516,
-    0x8516, 0x8517, 0x8516, 0x8516, 0x8537, 0x8537, 0x7CD4, 0x6C72,
-    0x53AE, 0x536D, 0x4B2C, 0x4B0B, 0x4B4C, 0x4B4D, 0x63F0, 0x6C52,
-    0x6C11, 0x5BCF, 0x5BAF, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C,
-    0x4B4C, 0x4B4C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C, 0x4B2C, 0x4B2C,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFDF, 0xE7DF,
-    0xE7DF, 0xDFBF, 0xDFDF, 0xDF9E, 0xB67A, 0x9576, 0x9D96, 0x9D96,
-    0x9DB6, 0x9576, 0xBE9A, 0xE7DF, 0xDFBE, 0xE7DF, 0xE7FF, 0xE7FF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xDF9E, 0xDF9F, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xDFDF, 0xE7DF, 0xD79E, 0xA5F8,
-    0x8D56, 0x7CD4, 0x7CD5, 0x7CF6, 0x7CF6, 0x7CF6, 0x8516, 0x8516,
-    0x8516, 0x8516, 0x8516, 0x8516, 0x8516, 0x8517, 0x8537, 0x8537,
-    0x8537, 0x8537, 0x8537, 0x8536, 0x74B4, 0x63F0, 0x4B2C, 0x4B2C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x6410, 0x6C52, 0x6410, 0x5BAF, 0x536D,
-    0x4B2C, 0x4B0B, 0x4B0B, 0x4B2C, 0x4B2C, 0x4B4C, 0x4B4C, 0x4B2C,
-    0x4B2C, 0x4B4C, 0x4B4C, 0x4B4C, 0x4B4C, 0x4B2C, 0x4B4C, 0x4B0B,
-    0x42EB, 0x42EB, 0x42EB, 0x3269, 0x42CA, 0x3ACA, 0x42EB, 0x430B,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xE7DF, 0xE7FF, 0xD79E, 0xBEBB,
-    0x8515, 0x8515, 0x7CF4, 0x7CB4, 0x6C52, 0x5B8F, 0x4B4D, 0x430C,
-    0x4B0C, 0x42EB, 0x536D, 0x6C10, 0x5BAE, 0x8D14, 0xC6DB, 0xBE9A,
-    0xC6DB, 0xC6DB, 0xC6DB, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7DF,
-    0xE7DF, 0xD75E, 0xC6FC, 0xC73D, 0x9DD8, 0x8536, 0x7CD5, 0x74B4,
-    0x7CB5, 0x8537, 0x8537, 0x8537, 0x8537, 0x8516, 0x8516, 0x8516,
-    0x8516, 0x8516, 0x84F6, 0x8516, 0x8517, 0x7CF5, 0x7493, 0x74B4,
-    0x6411, 0x538E, 0x538E, 0x5B8E, 0x4B2C, 0x4B2B, 0x4B2C, 0x4B4C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x5BAE, 0x534C, 0x4B0B, 0x4B0B, 0x4B2B,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C, 0x4B4C,
-    0x4B4C, 0x42EB, 0x42CA, 0x42EB, 0x42EB, 0x42EB, 0x3AAA, 0x3269,
-    0x2A28, 0x2A28, 0x2A28, 0x2A28, 0x2A08, 0x2A28, 0x2A48, 0x2A48,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xE7FF, 0xE7DF, 0xA5F8, 0x9556, 0x9597, 0x7493,
-    0x6C52, 0x6C52, 0x6411, 0x6C32, 0x6C52, 0x7473, 0x7452, 0x7473,
-    0x7452, 0x538E, 0x4B2C, 0x430B, 0x42EB, 0x42CB, 0x42EB, 0x430C,
-    0x4B4D, 0x4B2D, 0x536E, 0x8D55, 0x8D75, 0x8D55, 0x9597, 0xAE3A,
-    0xA5F9, 0x8D36, 0x7CD5, 0x7CF6, 0x74B5, 0x74D6, 0x7CF6, 0x8537,
-    0x8537, 0x8536, 0x8536, 0x8516, 0x8516, 0x8516, 0x8516, 0x8516,
-    0x8516, 0x8516, 0x8516, 0x7CF6, 0x63F0, 0x4B4D, 0x4B2C, 0x4B2B,
-    0x4B0B, 0x4B0B, 0x4B2B, 0x4B2B, 0x4B2C, 0x4B4C, 0x4B4C, 0x4B2C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B0B, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2B, 0x3269,
-    0x3AAA, 0x3248, 0x2A48, 0x2A48, 0x2A48, 0x3248, 0x2A28, 0x2A28,
-    0x2A28, 0x2A48, 0x2A28, 0x2A28, 0x2A28, 0x2A28, 0x2A28, 0x2A48,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9F, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7BF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF,
-    0xE7DF, 0xB67A, 0x9597, 0x8D56, 0x6C52, 0x6411, 0x7493, 0x7473,
-    0x7473, 0x7473, 0x7473, 0x7452, 0x7452, 0x7452, 0x6C32, 0x6C32,
-    0x6C32, 0x6C31, 0x63F0, 0x5BCF, 0x5BCF, 0x5BAF, 0x5BCF, 0x538E,
-    0x4B2D, 0x5BCF, 0x6C73, 0x6C52, 0x6432, 0x7494, 0x7CD5, 0x7CF5,
-    0x7CF5, 0x8516, 0x8537, 0x8516, 0x8516, 0x8516, 0x8516, 0x7D16,
-    0x7D16, 0x8516, 0x8516, 0x8516, 0x8537, 0x8D37, 0x8D57, 0x8D37,
-    0x8537, 0x8537, 0x6C73, 0x6431, 0x4B0B, 0x4B2B, 0x430B, 0x4B0B,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C, 0x4B4C, 0x4B4C,
-    0x4B2C, 0x430B, 0x42EB, 0x3AAA, 0x2A28, 0x3249, 0x2A28, 0x2A08,
-    0x2A48, 0x2A48, 0x2A48, 0x2A48, 0x3248, 0x2A48, 0x2A28, 0x2A28,
-    0x2A28, 0x2A28, 0x2A28, 0x2A28, 0x2A48, 0x2A28, 0x2A48, 0x3248,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF,
-    0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xE7FF, 0xDF9E, 0xC71D, 0xCF5D, 0xB67B, 0x8D77, 0x9598, 0x9598,
-    0x8D77, 0xAE5A, 0xD75E, 0xCF3D, 0xCF3D, 0xD75D, 0xAE19, 0x84F5,
-    0x8D35, 0x7493, 0x6412, 0x6C52, 0x7473, 0x7473, 0x7473, 0x7473,
-    0x7473, 0x7473, 0x7473, 0x7453, 0x7473, 0x7473, 0x7452, 0x6C31,
-    0x7473, 0x74B4, 0x74B4, 0x7CB4, 0x7CB4, 0x7CB4, 0x7CF5, 0x7CB4,
-    0x6C73, 0x7CF5, 0x7CF6, 0x8516, 0x8537, 0x8537, 0x8537, 0x8536,
-    0x8537, 0x8516, 0x8516, 0x7D16, 0x7CF6, 0x7D16, 0x8537, 0x8536,
-    0x7D16, 0x8516, 0x8557, 0x8537, 0x7CD5, 0x7452, 0x6C52, 0x7473,
-    0x7CB4, 0x6411, 0x6C31, 0x536D, 0x4B2B, 0x430B, 0x538E, 0x5BCF,
-    0x63F0, 0x4B2B, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C, 0x4B4C, 0x4B4C,
-    0x4B4C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C, 0x42EB, 0x430B, 0x42CA,
-    0x3269, 0x2A48, 0x2A48, 0x2A28, 0x2A28, 0x2A28, 0x2A28, 0x2A28,
-    0x2A28, 0x2A28, 0x2A48, 0x2A48, 0x2A48, 0x2A48, 0x2A28, 0x2A28,
-    0x2A28, 0x2A28, 0x2A48, 0x3248, 0x3269, 0x2A48, 0x3269, 0x2A48,
-    0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xDF9F, 0xDF9F, 0xDF9E, 0xDFBF, 0xBEBC, 0x9DD9,
-    0xA639, 0x9DB8, 0x8516, 0x8516, 0x8516, 0x7CF6, 0x7CF6, 0x7CF6,
-    0x7CF6, 0x7D16, 0x7CF6, 0x7CB5, 0x7473, 0x7C94, 0x7473, 0x6C53,
-    0x6C53, 0x7473, 0x6C52, 0x6C52, 0x7473, 0x6C52, 0x6C52, 0x6C53,
-    0x6C52, 0x7453, 0x7452, 0x7473, 0x7C93, 0x7CB4, 0x7493, 0x7493,
-    0x8535, 0x7473, 0x6C32, 0x7473, 0x7493, 0x7CB4, 0x8516, 0x8537,
-    0x8517, 0x8516, 0x8516, 0x8516, 0x7D16, 0x8516, 0x8516, 0x8516,
-    0x8516, 0x8516, 0x8536, 0x8537, 0x8537, 0x7CF5, 0x6C94, 0x74B4,
-    0x8557, 0x7CD5, 0x5BCF, 0x6431, 0x63F0, 0x6C10, 0x63EF, 0x63F0,
-    0x4B4C, 0x534C, 0x534C, 0x4B2C, 0x534C, 0x7492, 0x6410, 0x5BAE,
-    0x4B0B, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x3AAA, 0x42CA, 0x4B2C,
-    0x4B2C, 0x4B4C, 0x42EB, 0x3269, 0x3269, 0x2A08, 0x2207, 0x2207,
-    0x2A28, 0x2A48, 0x2A28, 0x2A28, 0x2A28, 0x2A28, 0x2A07, 0x2207,
-    0x2A48, 0x3248, 0x3248, 0x2A28, 0x3248, 0x2A28, 0x2A28, 0x2A48,
-    0x3A89, 0x3269, 0x2A48, 0x3269, 0x2208, 0x1A07, 0x2207, 0x19E7,
-    0x8D57, 0xB67B, 0xE7FF, 0xDFDF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7BF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9F, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF, 0xBEBB, 0xBEBB, 0xBEBB,
-    0xBEBB, 0xAE5A, 0x8D77, 0x8D77, 0x8D77, 0x8D77, 0x8536, 0x7D16,
-    0x8516, 0x8516, 0x8537, 0x8536, 0x8537, 0x8516, 0x7CF6, 0x8516,
-    0x7CF6, 0x7CF6, 0x7494, 0x6C73, 0x6C73, 0x7473, 0x7473, 0x7493,
-    0x7493, 0x7473, 0x7473, 0x7473, 0x7473, 0x6C73, 0x6C52, 0x6C53,
-    0x7473, 0x7452, 0x7473, 0x7473, 0x7493, 0x7CB4, 0x8515, 0x7D16,
-    0x7431, 0x73EF, 0x7CF5, 0x7494, 0x7CF5, 0x8516, 0x8536, 0x8516,
-    0x7D16, 0x7D16, 0x7CF6, 0x7D16, 0x8517, 0x8537, 0x8537, 0x8537,
-    0x8537, 0x8D57, 0x8516, 0x6C72, 0x6C72, 0x4B4D, 0x4B6D, 0x5BF0,
-    0x6C72, 0x538E, 0x5BAE, 0x6410, 0x536D, 0x4B2C, 0x536D, 0x4B4C,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x4B2C, 0x4B4C, 0x538D, 0x430B, 0x4B0B,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x42EB, 0x2A28, 0x21E7, 0x2A28, 0x3249,
-    0x2A48, 0x3289, 0x2A48, 0x2207, 0x2A28, 0x2A28, 0x2A28, 0x2A28,
-    0x2A48, 0x2A48, 0x2A48, 0x3268, 0x2A48, 0x3269, 0x3248, 0x2A27,
-    0x2207, 0x2A28, 0x2A28, 0x2A68, 0x3269, 0x3269, 0x3289, 0x2208,
-    0x3269, 0x2207, 0x11C7, 0x19E7, 0x11C7, 0x19E7, 0x11C7, 0x19E7,
-    0x7CD6, 0x7CF6, 0x9598, 0x9598, 0x95B8, 0x9598, 0x95B8, 0x95B8,
-    0x9DB8, 0x9598, 0x9598, 0x95B8, 0x9598, 0xB69B, 0xCF3D, 0xC71C,
-    0xC71D, 0xCF3D, 0xB69B, 0x9DD9, 0xA5F9, 0xA5F9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DD9, 0x9DD9, 0x9DD9, 0x9DD9, 0xC6FD,
-    0xD77E, 0xC71D, 0xD75E, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7FF, 0xDF9F, 0xCF5D, 0xCF5E, 0xCF5D, 0xCF5E, 0xCF5E,
-    0xCF5E, 0xCF5E, 0xCF5D, 0xCF5E, 0xD75E, 0xD75E, 0xCF5D, 0xCF5D,
-    0xCF5D, 0xCF5D, 0xBEBC, 0x95B8, 0x9DD8, 0x95B8, 0x95B8, 0x95B8,
-    0x95B8, 0x95B8, 0x95B8, 0x9DB8, 0x95B8, 0x8516, 0x84F6, 0x7CF6,
-    0x7CF6, 0x7CF6, 0x7D16, 0x7D16, 0x7D16, 0x7D16, 0x8537, 0x8516,
-    0x7CD5, 0x8537, 0x8537, 0x8516, 0x8516, 0x7CF6, 0x8D57, 0x8516,
-    0x7473, 0x7473, 0x7473, 0x7473, 0x6C53, 0x6C53, 0x7494, 0x7CD4,
-    0x7CB4, 0x7493, 0x7493, 0x7473, 0x6C52, 0x6C73, 0x7493, 0x7CD4,
-    0x6411, 0x6C52, 0x7473, 0x7493, 0x7CB5, 0x8516, 0x7CF6, 0x8558,
-    0x638E, 0x6BEF, 0x8D57, 0x8516, 0x8516, 0x8516, 0x8516, 0x8537,
-    0x8536, 0x8516, 0x8536, 0x8536, 0x7CD4, 0x74B4, 0x74B4, 0x7494,
-    0x7CB4, 0x63F0, 0x5BAE, 0x536D, 0x4B6C, 0x430B, 0x42CA, 0x42EB,
-    0x4AEB, 0x4B0B, 0x536D, 0x42EB, 0x42EA, 0x4B0B, 0x4B0B, 0x4B2C,
-    0x4B2C, 0x4B2C, 0x4B4C, 0x534C, 0x4B4C, 0x4B4C, 0x536C, 0x4B4C,
-    0x4B2C, 0x3AAA, 0x3249, 0x2A07, 0x21E7, 0x2A08, 0x21E7, 0x2208,
-    0x3269, 0x3289, 0x4B2B, 0x3AAA, 0x3269, 0x2207, 0x2A48, 0x2A48,
-    0x2A48, 0x3289, 0x42EA, 0x2228, 0x2207, 0x2228, 0x2207, 0x3AA9,
-    0x21E7, 0x0966, 0x11A6, 0x19C7, 0x19E7, 0x2A49, 0x2228, 0x11C7,
-    0x11C7, 0x19C7, 0x19E7, 0x19E7, 0x19E7, 0x19E7, 0x19E7, 0x19E7,
-    0x8537, 0x8537, 0x7D16, 0x7D16, 0x7D16, 0x8517, 0x7CF6, 0x74B5,
-    0x7CD5, 0x8517, 0x8516, 0x7CF6, 0x7CD5, 0x7CF6, 0x7D16, 0x7D16,
-    0x7CF6, 0x7D16, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6,
-    0x7CF6, 0x7CF6, 0x8516, 0x8537, 0x8537, 0x8537, 0x7CF6, 0x8516,
-    0x8536, 0x7D16, 0x8D77, 0x9DD9, 0x9DD9, 0x9DB8, 0xAE7A, 0xC6FC,
-    0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC,
-    0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC,
-    0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC, 0xBEDC,
-    0xBEBC, 0xBEBC, 0xBEBC, 0xBEBC, 0xBEBC, 0xBEBC, 0xBEBC, 0xBEBB,
-    0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B,
-    0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B, 0xB69B,
-    0xB69B, 0xBEBB, 0xA5F9, 0x7D16, 0x8536, 0x8536, 0x8536, 0x8536,
-    0x8536, 0x8536, 0x8516, 0x8516, 0x8516, 0x8516, 0x8516, 0x8516,
-    0x8516, 0x8536, 0x7D16, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6, 0x7CF6,
-    0x7CF6, 0x7D16, 0x7D16, 0x7CF6, 0x8516, 0x8537, 0x8537, 0x8D37,
-    0x8537, 0x8537, 0x8537, 0x8537, 0x8537, 0x7D16, 0x8516, 0x7CF5,
-    0x7492, 0xA5B8, 0x8D57, 0x8D57, 0x9577, 0x8D57, 0x7CB4, 0x7473,
-    0x6C53, 0x7494, 0x7493, 0x7473, 0x7CD4, 0x7CB5, 0x74B4, 0x63F0,
-    0x6C52, 0x7CD4, 0x7CB4, 0x7CB4, 0x7CD4, 0x7CD4, 0x9556, 0x7472,
-    0x6411, 0x84F5, 0x8D56, 0x8516, 0x8516, 0x7D16, 0x8516, 0x7CF5,
-    0x4227, 0x5B2D, 0x8D78, 0x7D16, 0x7D16, 0x7CF6, 0x7D16, 0x7CD5,
-    0x7473, 0x6C32, 0x63F0, 0x5BAF, 0x4B4D, 0x430B, 0x4B2C, 0x430B,
-    0x4B2C, 0x536D, 0x4B2C, 0x3ACA, 0x3AAA, 0x32AA, 0x42EB, 0x4B0B,
-    0x4B2C, 0x4B2C, 0x4B2C, 0x534C, 0x534C, 0x4B2B, 0x4B2C, 0x536C,
-    0x4B2C, 0x534C, 0x4B2C, 0x42CA, 0x4B2B, 0x3ACA, 0x3289, 0x3269,
-    0x3249, 0x2207, 0x21E7, 0x2207, 0x3A89, 0x3AA9, 0x21C6, 0x6B8B,
-    0x842C, 0x63AC, 0x4B6C, 0x536C, 0x534B, 0x4B2B, 0x536B, 0x4B2B,
-    0x2228, 0x2248, 0x2228, 0x11E7, 0x19E7, 0x19E7, 0x11C7, 0x2207,
-    0x2A07, 0x42A9, 0x4AE9, 0x11A6, 0x11C7, 0x2207, 0x2207, 0x19E7,
-    0x19E7, 0x19E7, 0x19E7, 0x19E7, 0x19E7, 0x19E7, 0x19E7, 0x19E7,
-    0x6C52, 0x6C52, 0x6C52, 0x7493, 0x7473, 0x7493, 0x6410, 0x4B2C,
-    0x536D, 0x6C31, 0x7473, 0x8D57, 0x6C52, 0x6C31, 0x8557, 0x7CD5,
-    0x8537, 0x8516, 0x8537, 0x8537, 0x8537, 0x8537, 0x8537, 0x8537,
-    0x8537, 0x8D57, 0x7CB4, 0x6431, 0x6431, 0x6411, 0x74B4, 0x8537,
-    0x8537, 0x8D57, 0x8516, 0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5,
-    0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5, 0x7CD5,
-    0x7CD5, 0x7CD5, 0x7CD5, 0x74D5, 0x7CD5, 0x7CD5, 0x7CD5, 0x74D5,
-    0x74D5, 0x74D5, 0x74D5, 0x74D5, 0x74D5, 0x74D5, 0x74D5, 0x7CD5,
-    0x74D5, 0x7CD5, 0x74D5, 0x7CD5, 0x7CD5, 0x7CD5, 0x74D5, 0x74D5,
-    0x74D5, 0x7CD6, 0x7CD6, 0x74D6, 0x74D5, 0x74D5, 0x74D5, 0x74D5,
-    0x74D5, 0x7CD6, 0x74D6, 0x74D6, 0x74D6, 0x74D6, 0x74D6, 0x7CF6,
-    0x8537, 0x8537, 0x8557, 0x8D78, 0x8557, 0x8558, 0x8557, 0x8D57,
-    0x8557, 0x8557, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8516, 0x7473, 0x6C32, 0x6C52, 0x7473, 0x7CD4, 0x84F5,
-    0x8516, 0x7CB4, 0x7CD5, 0x84F5, 0x9556, 0xA5B7, 0x9D97, 0x8515,
-    0x8D35, 0x8515, 0x7CD4, 0x7493, 0x74B3, 0x6C52, 0x7CB4, 0x8515,
-    0x8D35, 0x9D76, 0x9D76, 0x7CD4, 0x9D96, 0x7C92, 0x7493, 0x9576,
-    0x84F5, 0x6C32, 0x7CD3, 0x9575, 0x5BCF, 0x63EF, 0x6BEF, 0x62E9,
-    0x4289, 0x7CD4, 0x6431, 0x7472, 0x7CB3, 0x7CB3, 0x84F3, 0x4B2C,
-    0x536E, 0x74B3, 0x63F0, 0x538E, 0x538E, 0x5BAF, 0x6C31, 0x42EC,
-    0x62C8, 0x4A06, 0x7493, 0x7CF5, 0x74B4, 0x7CF5, 0x7CF5, 0x6C32,
-    0x7493, 0x7472, 0x5BAE, 0x4B4C, 0x536D, 0x4B4C, 0x42CA, 0x42EB,
-    0x42CA, 0x3AAA, 0x2A48, 0x21E7, 0x1985, 0x21A6, 0x4B0B, 0x536C,
-    0x4B2C, 0x4B0B, 0x29E7, 0x29A6, 0x29C6, 0x2165, 0x2186, 0x2A07,
-    0x430B, 0x42EA, 0x3AAA, 0x3248, 0x3289, 0x3269, 0x42CA, 0x42AA,
-    0x3A89, 0x42EB, 0x3AEA, 0x2207, 0x6BCC, 0xA4EE, 0x944C, 0xA4CC,
-    0xACED, 0xACED, 0x948D, 0x73CC, 0x532B, 0x2A48, 0x3289, 0x1A07,
-    0x19C7, 0x0904, 0x08E4, 0x1124, 0x1124, 0x11A6, 0x3ACA, 0x4B0A,
-    0x2A07, 0x29E7, 0x2A07, 0x11A7, 0x19C7, 0x3247, 0x4AC8, 0x2A48,
-    0x1186, 0x19E7, 0x19E7, 0x19E7, 0x19C7, 0x19C7, 0x19E7, 0x19E7,
-    0x4AEA, 0x4AEA, 0x4AEA, 0x4B0B, 0x42EA, 0x42EA, 0x4AEA, 0x4B0B,
-    0x4B0B, 0x4AEA, 0x4B0B, 0x5B8E, 0x4B2C, 0x4B2C, 0x534D, 0x5BAF,
-    0x8537, 0x8537, 0x7D16, 0x7CD5, 0x7CF5, 0x7CF5, 0x7CF5, 0x7CD5,
-    0x7CF5, 0x7CD5, 0x4B4E, 0x6411, 0x7494, 0x6432, 0x4B6E, 0x63F1,
-    0x7CF5, 0x7CD5, 0x8D36, 0xA5F9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5F9,
-    0xA5F9, 0xA5FA, 0xA5FA, 0xA61A, 0xA5FA, 0xA5FA, 0xA5F9, 0xA5F9,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA5F9,
-    0xA5F9, 0xA5FA, 0xA619, 0xA61A, 0xA619, 0xA5F9, 0xA5F9, 0x9DF9,
-    0x9DF9, 0x9DD8, 0x95B8, 0x95B8, 0x9DD9, 0x9DF9, 0x9DF9, 0x9DD9,
-    0x9DD9, 0x9DB8, 0x9DD8, 0x9DD9, 0x9DD9, 0x9DD8, 0x9DD9, 0x8536,
-    0x6C73, 0x6C73, 0x6C73, 0x6C73, 0x6C53, 0x6C53, 0x6C52, 0x6C52,
-    0x6C73, 0x6C53, 0x6C53, 0x6C53, 0x536E, 0x4B2C, 0x536D, 0x5B8F,
-    0x63F0, 0x5BB0, 0x5BAF, 0x5BD0, 0x5BAF, 0x5BAF, 0x5BAF, 0x536E,
-    0x536E, 0x4B4D, 0x63F0, 0x7472, 0x7472, 0x84B2, 0x63CF, 0x7CB2,
-    0x84F4, 0x538E, 0x5BCF, 0x8D34, 0x5BAF, 0x4B8F, 0x7CD3, 0x7CD3,
-    0x7492, 0x5BAF, 0x4B4C, 0x4B6D, 0x4B6C, 0x432B, 0x5BEE, 0x6C2F,
-    0x53AD, 0x3AEB, 0x434C, 0x4B6C, 0x2AA9, 0x3B2B, 0x4B4B, 0x8C2C,
-    0x2A07, 0x3208, 0x3AA9, 0x5B4B, 0x32A9, 0x4B2A, 0x5B6A, 0x430B,
-    0x3AEB, 0x432C, 0x4B4D, 0x536D, 0x536D, 0x538E, 0x53AF, 0x21E7,
-    0xA512, 0x6B2B, 0x3ACA, 0x5BEF, 0x5BCF, 0x536E, 0x5BAF, 0x5BAF,
-    0x5BAE, 0x3ACB, 0x3A8A, 0x3289, 0x2A48, 0x3269, 0x1985, 0x3228,
-    0x3269, 0x21C6, 0x2A28, 0x2228, 0x52E9, 0x6B28, 0x738A, 0x4B0A,
-    0x536D, 0x42EA, 0x49E6, 0x4A06, 0x5A67, 0x4A06, 0x2943, 0x3185,
-    0x2985, 0x29A5, 0x31E6, 0x4B2B, 0x2228, 0x4AEA, 0x5AA8, 0x2964,
-    0x3185, 0x3185, 0x3185, 0x1924, 0x3227, 0x42A8, 0x842B, 0xACED,
-    0xACCD, 0x9C6B, 0x6B28, 0x3A26, 0x19E7, 0x21E7, 0x2A48, 0x21E6,
-    0x1104, 0x41E6, 0x6AC8, 0x6287, 0x5A88, 0x19A6, 0x2A07, 0x21A5,
-    0x3AA9, 0x21E7, 0x1145, 0x19C7, 0x0966, 0x1944, 0x2185, 0x1124,
-    0x29C6, 0x1165, 0x11A6, 0x11C7, 0x1A08, 0x19E7, 0x19E7, 0x19C7,
-    0x532A, 0x532B, 0x532B, 0x532A, 0x532B, 0x532B, 0x532B, 0x5B2B,
-    0x532B, 0x532B, 0x532A, 0x530A, 0x530A, 0x530A, 0x530A, 0x534C,
-    0x63CE, 0x63EF, 0x536D, 0x534B, 0x534B, 0x4B4B, 0x4B2C, 0x4B2C,
-    0x4B0B, 0x532B, 0x5B6C, 0x6C10, 0x6C10, 0x6C10, 0x6C30, 0x536C,
-    0x4B2B, 0x4B2B, 0x6BEE, 0x9533, 0x8D13, 0x9533, 0x9553, 0x9553,
-    0x9D54, 0x9D74, 0x9D74, 0x9D54, 0x9D74, 0x9D74, 0x9D74, 0x9D74,
-    0x9D74, 0x9D94, 0x9D94, 0x9D74, 0x9D94, 0xA574, 0x9D74, 0xA574,
-    0xAD94, 0xAD94, 0xADB4, 0xADB4, 0xAD94, 0xB5F4, 0xB5F5, 0xB5F5,
-    0xBDF5, 0xB615, 0xB5F5, 0xBE35, 0xB5F5, 0xC697, 0xD6B8, 0xCEB8,
-    0xCED9, 0xEFDE, 0xEFDE, 0xE7DE, 0xCF3C, 0xC6FB, 0xC6FB, 0xBEDB,
-    0xD75D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xBEBB,
-    0x9555, 0x9D96, 0x9575, 0x9575, 0x9575, 0x9555, 0x9D96, 0x9DB6,
-    0x9DB6, 0x9DB6, 0x9D96, 0x9D96, 0x9D75, 0xA5B6, 0x8CD1, 0x6B8B,
-    0x6BAB, 0x73CC, 0x73CC, 0x73EC, 0x73CC, 0x73CC, 0x73CC, 0x73CB,
-    0x73AB, 0x73EC, 0x73EC, 0x73EC, 0x73EC, 0x73EC, 0x6BCB, 0x73EC,
-    0x7C0D, 0x73EC, 0x740D, 0x740D, 0x742D, 0x742D, 0x740C, 0x73EC,
-    0x6BEC, 0x7C0C, 0x7C0C, 0x4B4A, 0x538B, 0x538B, 0x32A9, 0x32A9,
-    0x4B6B, 0x63AB, 0x5B8A, 0x63AB, 0x6C0C, 0x536A, 0x21A5, 0x39E5,
-    0x4AC9, 0x2164, 0x3AC9, 0x534B, 0x5B6B, 0x9CCE, 0xAD0E, 0x8C4C,
-    0x7C2C, 0x6BED, 0x31C6, 0x1924, 0x2165, 0x1924, 0x3A47, 0x2164,
-    0xBDF6, 0x6B4C, 0x10C2, 0x3269, 0x3ACA, 0x2A28, 0x3289, 0x2228,
-    0x32AA, 0x3ACA, 0x5309, 0x6B49, 0x6B6A, 0x5309, 0x3247, 0x1924,
-    0x19A6, 0x21A6, 0x1904, 0x1924, 0x4A47, 0x7369, 0x7349, 0x29C5,
-    0x32AA, 0x3228, 0x5288, 0x6B4B, 0x4A06, 0x630A, 0x6B6C, 0x39C6,
-    0x6AE8, 0x93EB, 0x836A, 0x2165, 0x19E7, 0x21A6, 0x5247, 0x8BCB,
-    0x8BAA, 0x8BAA, 0x93CB, 0x41C5, 0x4A68, 0x2186, 0x3206, 0x4226,
-    0x5AC7, 0x946C, 0x2164, 0x1986, 0x19E7, 0x6329, 0x83CA, 0x7B8A,
-    0x5AC9, 0xBD94, 0xC594, 0xC5B5, 0x6B6B, 0x19E7, 0x1165, 0x1144,
-    0x2144, 0x10C2, 0x0021, 0x29E6, 0x52E8, 0x946C, 0x9CAD, 0x3A67,
-    0x4AE9, 0x1103, 0x532A, 0x42A8, 0x1124, 0x1986, 0x19E7, 0x19E7,
-    0x8C2B, 0x840B, 0x83EB, 0x840B, 0x8C0B, 0x840B, 0x840B, 0x8C2B,
-    0x8C2B, 0x840B, 0x8C0B, 0x840B, 0x840B, 0x840B, 0x8C2B, 0x840B,
-    0x83EA, 0x7BCA, 0x7BCA, 0x83EA, 0x83EA, 0x83CA, 0x83EA, 0x83EA,
-    0x83EA, 0x83EA, 0x7BAA, 0x7389, 0x7389, 0x7BCA, 0x83EA, 0x840B,
-    0x83EA, 0x83EA, 0x840B, 0x7BCA, 0x7BA9, 0x7368, 0x7389, 0x7389,
-    0x7BA9, 0x7BA9, 0x7BA9, 0x73A9, 0x7389, 0x6B68, 0x7369, 0x7389,
-    0x7BA9, 0x7BC9, 0x83EA, 0x83EA, 0x83EA, 0x9C8B, 0x946B, 0x9C6B,
-    0x9C8B, 0x9C8B, 0xA4AC, 0xA48B, 0xA4AC, 0xA4AC, 0xACCC, 0xA4CC,
-    0x8C2B, 0x73CA, 0x73AA, 0x73CA, 0x6BAA, 0x6BAA, 0x73EB, 0x7C2C,
-    0x73EB, 0x8C8E, 0x848E, 0x848F, 0x9553, 0x74D2, 0x7CD2, 0x7471,
-    0xB679, 0xE7FF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xE7FF,
-    0xEFFF, 0xEFFF, 0xEFFF, 0xE7FF, 0xEFFF, 0xF7FF, 0xC6B9, 0xCED8,
-    0xD6F8, 0xD6D8, 0xD6D8, 0xD6D8, 0xD6F9, 0xD6F9, 0xCE76, 0xAD0D,
-    0xACEC, 0xAD0D, 0xAD0D, 0xAD0D, 0xAD0D, 0xACED, 0xACED, 0xACED,
-    0xACEC, 0xACEC, 0xACED, 0xB52E, 0x9CAC, 0x946B, 0xAD0C, 0xACEC,
-    0xAD2D, 0xB54E, 0xB54E, 0xB56E, 0xB54E, 0x94CD, 0x948C, 0x73EB,
-    0x5329, 0x52E8, 0x6BAB, 0x636A, 0x73EB, 0x3A06, 0x39C5, 0x31A5,
-    0x3A87, 0x73CA, 0xA4AC, 0x62C8, 0x5267, 0x6309, 0x21C6, 0x0082,
-    0x6B6B, 0x31E6, 0x430A, 0x3B0A, 0x4B4B, 0x3A68, 0x42A8, 0xAD0E,
-    0xA4CD, 0x31E5, 0x4A26, 0x7349, 0x7308, 0x6AE8, 0x838A, 0x41E5,
-    0x8450, 0x9CAF, 0x7BEA, 0x3A26, 0x21A6, 0x29C7, 0x10E3, 0x1124,
-    0x1144, 0x29E7, 0x948D, 0xB52E, 0xAD0E, 0x63AB, 0x3ACA, 0x3207,
-    0x4A68, 0x73CC, 0x83CB, 0x734A, 0x0020, 0x31A4, 0x39A5, 0x4206,
-    0x29C6, 0x0882, 0x9CCF, 0x94D0, 0x4247, 0x7C2E, 0x9532, 0x1965,
-    0x4206, 0x5AA8, 0x5287, 0x21C6, 0x19E7, 0x1124, 0x2924, 0x5246,
-    0x5206, 0x5246, 0x5A67, 0x41E5, 0x738A, 0x7BAA, 0x946C, 0x8C2B,
-    0x9C6C, 0xA4CC, 0x94AE, 0x2207, 0x11A6, 0x4247, 0x39E5, 0x39E5,
-    0x4247, 0x5AEA, 0x4A89, 0x9D33, 0x430B, 0x19E7, 0x2248, 0x1A07,
-    0x19C6, 0x3268, 0x2A48, 0x73CA, 0xB54D, 0x948C, 0x6BCB, 0x430A,
-    0x3AEA, 0x3AA9, 0x4AA8, 0x31E6, 0x10C3, 0x08A2, 0x08E3, 0x19C7,
-    0x8C0A, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8C0A, 0x8C0A,
-    0x8C0A, 0x8C0A, 0x8BEA, 0x8C0A, 0x8C0A, 0x8C0A, 0x8C0B, 0x8C2B,
-    0x8C2B, 0x8C0B, 0x83EA, 0x83CA, 0x83CA, 0x83CA, 0x83CA, 0x83CA,
-    0x8C0A, 0x8C2B, 0x8C0A, 0x8C0A, 0x942B, 0x944B, 0x944B, 0x944B,
-    0x9C6B, 0x946B, 0x944B, 0x9CAC, 0xA4CC, 0xA4CC, 0x9C8C, 0x946B,
-    0x9CAC, 0x9C8C, 0x9C8C, 0x9C8C, 0xACED, 0x946C, 0x9CAC, 0x9CCD,
-    0xA4ED, 0xA4ED, 0xACED, 0xAD0E, 0xB52E, 0x9CCD, 0x8C6C, 0x8C4C,
-    0x844C, 0x842B, 0x842B, 0x8C4C, 0x8C6C, 0x8C8C, 0x8C4C, 0x9D0F,
-    0x744E, 0x53AE, 0x538D, 0x9DD6, 0xBEFB, 0xB6BA, 0xB6BA, 0xBEBA,
-    0xBEDA, 0xBEBA, 0xB699, 0xB69A, 0xE7DF, 0xEFFF, 0xE7FF, 0xEFFF,
-    0xE7FF, 0xCF1B, 0xCEFA, 0xD71A, 0xD71B, 0xD71B, 0xD71B, 0xD71A,
-    0xCEFA, 0xD73B, 0xA5B5, 0x7C0D, 0xB570, 0xB570, 0x9CAE, 0xA4EF,
-    0xAD51, 0xA530, 0xA551, 0x9CAE, 0x9C6B, 0x9C8B, 0xA4AB, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC,
-    0xA4CC, 0xA4EC, 0x6B69, 0x52E8, 0x4267, 0x3206, 0x7BEA, 0x9C8B,
-    0x948C, 0x738A, 0x41E6, 0x6B08, 0x6349, 0x2A27, 0x5B49, 0x73AA,
-    0x73AA, 0x2A27, 0x5B29, 0xA4CD, 0x18E2, 0x5287, 0xA48C, 0x7B89,
-    0x5287, 0x2A06, 0x8C2C, 0x83CB, 0x52C9, 0x744F, 0x4BAD, 0x11A6,
-    0x21A6, 0x0881, 0x21A5, 0x3247, 0x3A88, 0x29C6, 0x3A67, 0x532A,
-    0x2A47, 0x3207, 0xAD53, 0x83AA, 0x8369, 0x8389, 0x8389, 0x7329,
-    0x31A5, 0x6329, 0x738A, 0x5AE8, 0x4206, 0x3985, 0x5226, 0x7308,
-    0x7B28, 0x5A66, 0x3184, 0x83EB, 0x6B6A, 0x2A28, 0x2A69, 0x1145,
-    0x39C6, 0x49E5, 0x93EC, 0x2923, 0x1061, 0x8C0C, 0x4A27, 0x5267,
-    0x39A5, 0x20E2, 0x9C8D, 0x52E9, 0x1104, 0x1103, 0x3A8A, 0x21E7,
-    0x1165, 0x42AA, 0x19A6, 0x19E7, 0x19E7, 0x19A6, 0x1965, 0x3A47,
-    0x4268, 0x52CA, 0x5AE9, 0xA4CE, 0x944C, 0xA4AC, 0xACED, 0xA4CD,
-    0x842B, 0xACED, 0x73CB, 0x21E6, 0x3A88, 0x3247, 0x3247, 0x3227,
-    0x3227, 0x3247, 0x2207, 0x11C6, 0x1A07, 0x2228, 0x2207, 0x3247,
-    0x430A, 0x4B2A, 0x846D, 0xB54E, 0x9CAC, 0x42E9, 0x32A9, 0x3ACA,
-    0x3B0A, 0x3B0A, 0x21E7, 0x19C6, 0x2A89, 0x2228, 0x1165, 0x08E4,
-    0x83EA, 0x83CA, 0x83CA, 0x83EA, 0x83CA, 0x83CA, 0x83EA, 0x83EA,
-    0x83EA, 0x83CA, 0x83CA, 0x83EA, 0x83EA, 0x83EA, 0x83EA, 0x8C0B,
-    0x8C0A, 0x840A, 0x840A, 0x9CAC, 0xA4CC, 0xA4AC, 0x9CAC, 0xA4CC,
-    0x9C8C, 0x842B, 0x8C2B, 0x8C2B, 0x8C2B, 0x842B, 0x8C2B, 0x8C2B,
-    0x8C4B, 0x8C4C, 0x8C4C, 0x8C4B, 0x7BEB, 0x5309, 0x63AC, 0x740D,
-    0x7C2E, 0x7C4E, 0x7C4E, 0x7C4E, 0x7C6F, 0x7C4E, 0x7C4E, 0x7C4F,
-    0x7C6F, 0x7C6F, 0x7C6F, 0x7C6F, 0x7C6F, 0x4B4C, 0x6410, 0x95D7,
-    0x8D96, 0x8D96, 0x8D96, 0x95B6, 0x9DD7, 0x9DD7, 0x95B6, 0xC71C,
-    0xE7FF, 0xDFDF, 0xD77E, 0xDFBE, 0xE7FF, 0xE7FE, 0xDFDE, 0xDFBD,
-    0xE7DE, 0xE7BE, 0xEFDE, 0xEFDE, 0xDF7D, 0xCF3C, 0xCF1B, 0x8D12,
-    0x8CF1, 0xA4CD, 0xAD0E, 0xA4CC, 0xACCD, 0xACED, 0xACED, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4AC, 0xA4AC, 0xACCC, 0xACCC, 0xACED, 0xBDB2,
-    0xC656, 0xC635, 0xC655, 0xBDB2, 0xACCC, 0xACCC, 0xACCC, 0xACCC,
-    0xACEC, 0xA4CC, 0xACCC, 0xACCC, 0xACEC, 0xAD0D, 0xB50D, 0xAD0D,
-    0xAD0D, 0x9CAC, 0x73AB, 0x2A07, 0x19A6, 0x21E6, 0x532A, 0x842C,
-    0x5AE8, 0x1923, 0x4206, 0x7369, 0x7BAA, 0x536B, 0x63CC, 0x6BEB,
-    0x63AB, 0x5BAC, 0x5B8B, 0x5B29, 0x4A26, 0x7BCA, 0x8C2C, 0x8C0B,
-    0x31E5, 0x10E3, 0x4227, 0x4A26, 0x31C6, 0x2A08, 0x2A89, 0x22CA,
-    0x1145, 0x0000, 0x39A4, 0x62A7, 0x7349, 0x942C, 0x7BAA, 0x21E6,
-    0x0185, 0x6C2F, 0xFFDC, 0x8C2D, 0x4A27, 0x4A26, 0x4A26, 0x6308,
-    0x18C2, 0x0020, 0x42EA, 0x6B2A, 0x6246, 0x8348, 0x49C4, 0x9C2B,
-    0x942B, 0x4A47, 0x10A1, 0x2943, 0x6309, 0x3AA9, 0x2A49, 0x2164,
-    0x6AC7, 0x7328, 0x7308, 0x7349, 0x6B09, 0x5A67, 0x6AE8, 0x8369,
-    0x8389, 0x8369, 0x7B8A, 0x844E, 0x2228, 0x1165, 0x2185, 0x5A88,
-    0x7329, 0x5268, 0x1924, 0x1186, 0x11A6, 0x11A6, 0x4B2A, 0xAD50,
-    0xAD2F, 0xA50F, 0x9CAD, 0xACCD, 0xACED, 0xAD0D, 0x9CAC, 0x4B09,
-    0x2207, 0x63AB, 0x19C6, 0x3247, 0x946C, 0x636A, 0x5B4B, 0x5B6B,
-    0x5B8B, 0x5BAC, 0x32A9, 0x1A07, 0x2228, 0x1A07, 0x3268, 0x532A,
-    0x3288, 0x3AE9, 0x536A, 0x7C2B, 0x7C0B, 0x32A9, 0x3AEA, 0x3AEA,
-    0x3AC9, 0x29C5, 0x2165, 0x3AA9, 0x3AC9, 0x32A9, 0x3AE9, 0x4AC8,
-    0x83EA, 0x83EA, 0x83EA, 0x83EA, 0x8C0B, 0x8C0A, 0x8C2B, 0x946B,
-    0x942B, 0x8C2B, 0x9C6C, 0x9CAC, 0xA4AC, 0x9CAC, 0x944B, 0x8C2B,
-    0x8C2B, 0x8C2B, 0x946B, 0x7C0B, 0x6BAA, 0x6BAA, 0x6BAA, 0x6BAA,
-    0x740D, 0x84D2, 0x84D2, 0x84D2, 0x84D2, 0x84D2, 0x84D2, 0x84D2,
-    0x7CD2, 0x7CD2, 0x7CB2, 0x74B2, 0x6C71, 0x6452, 0xAE7A, 0xD79F,
-    0xD77E, 0xD79E, 0xD79E, 0xD79E, 0xD79E, 0xD79E, 0xD77D, 0xD77D,
-    0xD77D, 0xD79D, 0xD79D, 0xD79D, 0xD77D, 0xD77D, 0xD7BE, 0xE7FF,
-    0xEFFF, 0xE7FF, 0xEFFF, 0xE79B, 0xDF19, 0xDF39, 0xDF39, 0xD6F9,
-    0xD6D8, 0xCEB8, 0x84AF, 0x8CAE, 0xB590, 0xB56F, 0xAD2E, 0xAD0E,
-    0xAD0E, 0xAD0E, 0xAD2F, 0xAD0E, 0xBDB2, 0x94CF, 0x7C0B, 0x9CAC,
-    0x9C8C, 0xB591, 0xBDB2, 0xACED, 0xACED, 0xA4ED, 0xA4ED, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4EC, 0xACED, 0xA4ED, 0xA4ED, 0xA4ED, 0xA4CC,
-    0xA4AC, 0x9C8C, 0x9C8B, 0xA4AC, 0xACED, 0xA4CC, 0xA4CC, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xACED, 0x8C4B, 0x8C4B, 0x7BEB,
-    0x52E8, 0x52E8, 0x52C8, 0x42A8, 0x2A07, 0x2A27, 0x0965, 0x636A,
-    0x3206, 0x42C9, 0x08C3, 0x5287, 0xA4EE, 0x4B09, 0x11A5, 0x0903,
-    0x0904, 0x08E3, 0x0082, 0x4289, 0x63AC, 0x2206, 0x6C0E, 0x73CC,
-    0x1104, 0x1903, 0x0861, 0x10C2, 0x4A27, 0x18E3, 0x3227, 0x2227,
-    0x2A07, 0x18E3, 0x5287, 0x62E8, 0x5287, 0x5267, 0x18E2, 0x0944,
-    0x1207, 0x63CC, 0xAD53, 0x9490, 0x7BEF, 0xBDD4, 0x94B0, 0x19C6,
-    0x2185, 0x2227, 0x84F1, 0xD6B9, 0x3A07, 0x31E6, 0x2185, 0x5AE9,
-    0x52C9, 0x2186, 0x4A47, 0x8C0C, 0x840C, 0x3A68, 0x1944, 0x8389,
-    0x93EA, 0x8BA9, 0x7B89, 0x4AA8, 0x946E, 0x4A27, 0x4A06, 0x8369,
-    0x8BAA, 0x6AE8, 0x3207, 0x3A68, 0x2A48, 0x3AA9, 0x734A, 0x5267,
-    0x5227, 0x41E6, 0x31A5, 0x6B8B, 0x7C2C, 0x7C2C, 0x9CCE, 0x6349,
-    0x9C8C, 0xB50D, 0xACED, 0xACED, 0xA4CD, 0x946C, 0xACED, 0x4B09,
-    0x1A28, 0x19E7, 0x2207, 0x21E7, 0x21E6, 0x3A68, 0x3227, 0x3268,
-    0x4B2A, 0x430A, 0x21E7, 0x2228, 0x2207, 0x1A07, 0x1A07, 0x3288,
-    0x3AC9, 0x42EA, 0x3AC9, 0x4B2A, 0x4B2A, 0x3AC9, 0x42EA, 0x2A27,
-    0x3A06, 0x948D, 0x4AE9, 0x29C6, 0x4AE9, 0x5B6A, 0x948C, 0xAD0D,
-    0xA4CC, 0xA4CC, 0xA4AC, 0xA4CC, 0xACEC, 0xACED, 0xACED, 0xAD0D,
-    0xB52E, 0xBD6F, 0x9CCD, 0x8C6C, 0x8C6C, 0x5B4A, 0x6C0E, 0x7C4F,
-    0x742F, 0x744F, 0x6C0F, 0x9575, 0xAE59, 0xAE38, 0xAE38, 0xA5F8,
-    0xBEDB, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xEFFF, 0xE7BD, 0xDF5B, 0xDF3B,
-    0xDF5B, 0xD73B, 0xD6FA, 0xD71A, 0xD71A, 0xD73A, 0xBDD3, 0xB54F,
-    0xB590, 0xB590, 0xB590, 0xBD91, 0xBDB1, 0xB591, 0xB590, 0xAD50,
-    0x94AE, 0x8CAE, 0x8CAE, 0x842C, 0x7BEA, 0x83EA, 0x840A, 0x840A,
-    0x8C2B, 0x8C4B, 0x948C, 0x8C6C, 0x8C4B, 0x8C4B, 0x8C4B, 0x946B,
-    0xACCC, 0xA4CB, 0x9C8A, 0xA4AB, 0xACCC, 0xAD0D, 0xAD0D, 0xB52D,
-    0xB52D, 0x7C0C, 0x73EC, 0x73CB, 0x6BAA, 0x6BCB, 0x63AB, 0x63AB,
-    0x6BEC, 0x638B, 0x5B6A, 0x5BAB, 0x6BEC, 0x6BCC, 0x6BEB, 0x6BCB,
-    0x6BAB, 0x63AA, 0x63AB, 0x6BAB, 0x6BCB, 0x6BCB, 0x6BCB, 0x6BAA,
-    0x6BAA, 0x63AA, 0x63AA, 0x6BCB, 0x6BEB, 0x534A, 0x4B09, 0x5B6A,
-    0x534A, 0x534A, 0x3A88, 0x5B6A, 0x7C0C, 0x4AC8, 0x4AC8, 0x8C4B,
-    0x73AA, 0x7C0B, 0x73CA, 0x944B, 0xA4ED, 0x948C, 0x944B, 0x946C,
-    0x946D, 0x83EC, 0x738A, 0x73CB, 0x6BCB, 0x6BEC, 0x63AB, 0x638A,
-    0x73CB, 0x5309, 0x3AC9, 0x3227, 0x2964, 0x2124, 0x2144, 0x1965,
-    0x3AC9, 0x4B2A, 0x3288, 0x1A07, 0x3AA8, 0x6B69, 0x6B69, 0x6349,
-    0x5B49, 0x5309, 0x1144, 0x1944, 0x6BAD, 0xB5B4, 0x6BCC, 0x3AC9,
-    0x430A, 0x3ACA, 0x63CE, 0xCEB9, 0x6C30, 0x4B8D, 0x5BCE, 0x1124,
-    0x0041, 0x0882, 0x1081, 0x2103, 0x2124, 0x2144, 0x4207, 0x4A27,
-    0x4A47, 0x5268, 0x5288, 0x42CA, 0x3A89, 0x4289, 0x10A2, 0x1965,
-    0x1903, 0x1904, 0x42A9, 0x4AA9, 0x3A47, 0x844C, 0x946C, 0x7BAA,
-    0x738A, 0x7BCB, 0x52C9, 0x4AA8, 0x638B, 0x5B6B, 0x538B, 0x3AEB,
-    0x4B2B, 0x634A, 0x7BEB, 0x738A, 0x9CAD, 0x4287, 0x5B4A, 0x4AE9,
-    0x2228, 0x2269, 0x2248, 0x2208, 0x2207, 0x21E7, 0x2A27, 0x1985,
-    0x2A47, 0x1965, 0x0041, 0x1104, 0x19C6, 0x2A48, 0x2A68, 0x42E9,
-    0x4B09, 0x3AE9, 0x430A, 0x534A, 0x42E9, 0x430A, 0x3268, 0x2984,
-    0x8C2B, 0x7C2C, 0x3B2A, 0x3289, 0x3A26, 0x73CA, 0x846C, 0x8C6C,
-    0xACED, 0xACEC, 0xACED, 0xACEC, 0xACEC, 0xACEC, 0xACEC, 0xA4CC,
-    0x638A, 0x534A, 0x84B1, 0x9554, 0x9D95, 0xA618, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7FF, 0xE7FF, 0xE7DF, 0xE7FF,
-    0xE7DF, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xD79E, 0xD77E, 0xA5D5, 0x9511, 0x8C4B, 0x944B, 0x9C8C,
-    0x9CAD, 0xAD4F, 0xACCC, 0xACED, 0xAD0D, 0xB50D, 0xB52D, 0xAD0C,
-    0xACEC, 0xACCC, 0xACCC, 0x8C2A, 0x6B69, 0x73AA, 0x7BEA, 0x73EB,
-    0x4B09, 0x42C8, 0x5B6B, 0xA5D5, 0xA5D5, 0xA5B5, 0xA5D5, 0xADF5,
-    0xADF6, 0xA5B6, 0x9DB6, 0xAE38, 0xB679, 0xB658, 0xBE79, 0xBE99,
-    0x8CAF, 0x9510, 0xCEB8, 0xB5B2, 0xA4ED, 0xA4CC, 0x9CAD, 0x9CAD,
-    0x9CAD, 0xA4CD, 0xA4AC, 0x9CAC, 0x9CAC, 0xA4ED, 0x9CAD, 0xAD2F,
-    0xB591, 0x9CEE, 0x9CCE, 0x846E, 0xAD71, 0xA4CD, 0xA4CD, 0xA4CD,
-    0xA4CD, 0xA4AC, 0xA4AC, 0xA4AC, 0x9CAC, 0x946B, 0x946B, 0x946B,
-    0x946B, 0x9C8C, 0x9CAC, 0x9CCD, 0x9CAD, 0xA4CD, 0xA4ED, 0xA4CD,
-    0xAD0D, 0xAD0D, 0xACED, 0xA4ED, 0xACEC, 0xA4CC, 0xAD0D, 0xB50D,
-    0xB52D, 0xA4CD, 0xA4CD, 0x9CCC, 0x6BAA, 0x7C0B, 0x842B, 0x7C0B,
-    0x638A, 0x73EB, 0x6BAB, 0x4309, 0x4309, 0x4B2A, 0x432A, 0x4309,
-    0x4B2A, 0x434A, 0x4B4A, 0x42E9, 0x3288, 0x3288, 0x3227, 0x52E8,
-    0x73EB, 0x7C0B, 0x4B29, 0x63CB, 0x6BAA, 0x948C, 0x842B, 0x6329,
-    0x7BCA, 0x6B8A, 0x3A88, 0x2227, 0x3288, 0x2A47, 0x2A48, 0x3268,
-    0x3268, 0x3289, 0x3289, 0x3268, 0x2A68, 0x2A48, 0x2A48, 0x19A6,
-    0x08C3, 0x1104, 0x1145, 0x19A6, 0x1185, 0x7C4E, 0xC5F4, 0xDF1B,
-    0xD6DA, 0xA533, 0x7C2F, 0x1124, 0x08A3, 0x0000, 0x0861, 0x42C9,
-    0x3A26, 0x4AC9, 0x5329, 0x5B29, 0x6B8A, 0x742C, 0x742C, 0x7C4D,
-    0x7C4D, 0x84AE, 0x534B, 0x2A69, 0x32AA, 0x32AA, 0x2A07, 0x1965,
-    0x1124, 0x08C2, 0x3A88, 0x32A9, 0x42E9, 0x21A6, 0x1124, 0x08C2,
-    0x08A2, 0x1104, 0x1124, 0x0881, 0x08C3, 0x1145, 0x0882, 0x10E3,
-    0x42C9, 0x29E6, 0x1924, 0x2144, 0x3227, 0x530A, 0x5329, 0x532A,
-    0x5BAB, 0x4B6B, 0x430A, 0x3AE9, 0x434B, 0x434B, 0x3A88, 0x7BA9,
-    0x8C4B, 0x3268, 0x3AEA, 0x2A27, 0x1924, 0x2185, 0x2A88, 0x2A88,
-    0xACCC, 0xACEC, 0xACEC, 0xACEC, 0xACEC, 0xACCC, 0xACEC, 0xA4EC,
-    0x7BEB, 0x6BCB, 0x740D, 0x63CE, 0x9DD6, 0x9DD6, 0xBEDB, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBE, 0xDFBF, 0xE7DF, 0xDF9E,
-    0xDF7E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBE, 0xDFBE,
-    0xDF9E, 0xDFBE, 0xC73D, 0x7CD3, 0x7CD2, 0x8D54, 0x5BCE, 0x3248,
-    0x638B, 0x8C8D, 0x842C, 0x842C, 0x844D, 0x73CB, 0x73AA, 0x844C,
-    0x948C, 0x9CAC, 0xA4CC, 0x9C8C, 0x946C, 0x946C, 0x948D, 0x94AD,
-    0x9CED, 0x9CCD, 0xA4EE, 0xB570, 0xAD2E, 0xB56F, 0xB56F, 0xBD6F,
-    0xAD2F, 0x8CCF, 0x8CAF, 0xC656, 0xDEF9, 0xE79C, 0xC6FA, 0xB658,
-    0xA5F6, 0x9DD6, 0xAE38, 0xBE77, 0xCE54, 0xAD0D, 0x8C6C, 0x846C,
-    0x844C, 0xAD0D, 0xB50D, 0xACEC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4AC,
-    0xA4AB, 0xACCC, 0xACEC, 0xACEC, 0xACCC, 0xACCC, 0xACCC, 0xACCC,
-    0xACCC, 0xACCC, 0xACCC, 0xACCC, 0x9C6B, 0x7BA9, 0x83C9, 0x83CA,
-    0x83C9, 0x62C6, 0x62C6, 0x62A6, 0x5A86, 0x5A86, 0x5AA6, 0x6B28,
-    0x944B, 0xA4CD, 0xA4AC, 0xA4CC, 0xA4CD, 0x9C8C, 0x73EB, 0x73EB,
-    0x7C0B, 0x7BEB, 0x73CA, 0x7C0B, 0x7BEB, 0x6BAB, 0x6BAB, 0x7C0B,
-    0x7BEB, 0x6BAA, 0x7C0B, 0x7C0B, 0x73CB, 0x7C0B, 0x7C0B, 0x73EB,
-    0x7C2B, 0x840B, 0x944B, 0x948C, 0x946C, 0x948C, 0x948C, 0x9CAD,
-    0xA4ED, 0xA4ED, 0x946C, 0xA4CD, 0x948D, 0x8C6C, 0x7BEC, 0x6B8B,
-    0x7BEB, 0x840C, 0x73CB, 0x636A, 0x844C, 0x73CA, 0x73CA, 0x73AA,
-    0x7BCA, 0x7BEA, 0x7BEB, 0x844C, 0x844C, 0x8C6D, 0x6BEC, 0x63EC,
-    0x5B8B, 0x4B0A, 0x6BCB, 0x530A, 0x2A48, 0x5B6A, 0x5B29, 0x8CD1,
-    0x94D0, 0x73ED, 0x5B8C, 0x21A5, 0x2A07, 0x3227, 0x4288, 0x7C0C,
-    0x6B8A, 0x6BCB, 0x6BAB, 0x6BEC, 0x6BCB, 0x5B8B, 0x536B, 0x42C9,
-    0x3AA9, 0x3268, 0x19A6, 0x19A6, 0x1965, 0x0882, 0x0021, 0x1944,
-    0x1944, 0x29A6, 0x42CA, 0x1985, 0x0041, 0x0020, 0x0000, 0x0041,
-    0x10C3, 0x0040, 0x0881, 0x10A2, 0x0020, 0x0041, 0x0000, 0x0020,
-    0x1903, 0x1944, 0x10C2, 0x1903, 0x10C2, 0x0020, 0x0020, 0x0881,
-    0x29A5, 0x29E6, 0x08A2, 0x0041, 0x2185, 0x2185, 0x18E2, 0xA4CC,
-    0x7C0B, 0x2A68, 0x2A69, 0x1985, 0x1924, 0x0861, 0x2A27, 0x32CA,
-    0xACEC, 0xACED, 0xACEC, 0xACED, 0xACEC, 0xACED, 0xACEC, 0xACEC,
-    0xB50D, 0xB52D, 0xA4ED, 0x948C, 0x8C4B, 0x73CA, 0x5B8C, 0x7C6F,
-    0x744F, 0x744F, 0x7C6F, 0x7C70, 0x742E, 0x84F3, 0xBE9A, 0xCF3D,
-    0xEFFF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBE,
-    0xDFBE, 0xDF9E, 0xDFBE, 0xE7FF, 0xE7FF, 0xE7FF, 0xCF3D, 0xBEBA,
-    0xCF1C, 0xC6FB, 0xB67A, 0xB67A, 0xBEBA, 0x84F4, 0x326A, 0x42EC,
-    0x640F, 0x640E, 0x6C0E, 0x6C0E, 0x742E, 0x742E, 0x7C4F, 0x7C6F,
-    0x7C6F, 0x7C6F, 0x744F, 0x6C0E, 0x6C0E, 0x4AE9, 0x42A8, 0x73CB,
-    0x946B, 0x8C6B, 0x948C, 0x8C4B, 0x8C2A, 0x94AD, 0x7C0B, 0x6BAA,
-    0x73CA, 0x6BAA, 0x6369, 0x73CA, 0x8C4A, 0x8C4B, 0x948C, 0x948C,
-    0x948C, 0x946C, 0x8C4C, 0x9C8C, 0xACCC, 0xA4CC, 0xA4CC, 0xA4CC,
-    0xACEC, 0xACED, 0xACEC, 0xACEC, 0xACCC, 0xACCC, 0xACCC, 0xAD0D,
-    0xB50D, 0xB52D, 0xB52D, 0xB52D, 0xB52D, 0xB52D, 0xB52E, 0xB54E,
-    0xB52E, 0xA4AC, 0x9C8C, 0x9C6C, 0x9C6C, 0x9C6C, 0x9C8C, 0xB52D,
-    0x9CAC, 0x6349, 0x840A, 0x946C, 0x73CB, 0x94AF, 0xB5D4, 0x844C,
-    0x8C6C, 0xA4CD, 0xA4CC, 0xACCC, 0xACED, 0xAD0D, 0xACED, 0xACED,
-    0xACCD, 0xACED, 0xACED, 0xAD0D, 0xB52E, 0x9D10, 0x94F1, 0x8CD0,
-    0x84B0, 0x7C6F, 0x740E, 0x6BAC, 0xADB5, 0xDF5B, 0xD73B, 0xD73B,
-    0xCEFA, 0xCF1A, 0xD73B, 0xD71B, 0xCF1B, 0xC6FA, 0xBEBA, 0xB679,
-    0xAE58, 0xAE58, 0xB679, 0xBE98, 0x9D11, 0xBDF4, 0xC613, 0xBDF3,
-    0xBDF2, 0xC5F2, 0xC5F3, 0xA4EE, 0xA50E, 0x9CCD, 0x846D, 0x8C8D,
-    0x94AD, 0x8C4C, 0xB50D, 0xA4AC, 0x8C6C, 0x8C6C, 0x946C, 0x842B,
-    0x842B, 0x8C6C, 0x94AC, 0x9CED, 0x9CEE, 0x94AD, 0x7C0B, 0x842B,
-    0x8C4B, 0x842B, 0x8C6B, 0x8C8C, 0x94AD, 0x94AD, 0x94AD, 0x636A,
-    0x52E8, 0x5309, 0x4A67, 0x6329, 0x4247, 0x52C8, 0x4AA8, 0x42C9,
-    0x42C9, 0x3A68, 0x3227, 0x3A67, 0x3227, 0x4AA8, 0x4AA8, 0x3207,
-    0x3228, 0x2A27, 0x4B0A, 0x3A88, 0x3AA9, 0x21C6, 0x21A5, 0x08E2,
-    0x08A2, 0x08A2, 0x2A06, 0x3A88, 0x2A27, 0x29E6, 0x31C6, 0x3A48,
-    0x10C2, 0x0061, 0x08A2, 0x08A2, 0x10C2, 0x0000, 0x39A4, 0x946C,
-    0x4B09, 0x2248, 0x3289, 0x1965, 0x0020, 0x0000, 0x08A2, 0x1124,
-    0xACEC, 0xA4AC, 0xA4CC, 0xA4AC, 0xA4CC, 0xA4AC, 0xA4CC, 0xACEC,
-    0xA4EC, 0xACEC, 0xACED, 0xAD0D, 0xB50D, 0xB50D, 0xA4CC, 0x9CAB,
-    0xA4AC, 0xA4AC, 0xA4AC, 0xA4CC, 0x9CAC, 0x842C, 0x73EB, 0x6BCD,
-    0x742F, 0x742F, 0x63CE, 0x8D34, 0xCF1C, 0xCF3D, 0xCF3D, 0xD79E,
-    0xDFBF, 0xE7DF, 0xDF9E, 0xDF9E, 0xD79E, 0xD77E, 0xDFBF, 0xE7DF,
-    0xE7BF, 0xE7DF, 0xE7FF, 0xE7FF, 0xE7DF, 0xE7DF, 0xE7BE, 0xDFBE,
-    0xDF9E, 0xD79E, 0xD79E, 0xD79E, 0xD79E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xD79E, 0xD79E, 0x9DD7, 0x9596, 0xA5F7,
-    0x9DF7, 0x9DD6, 0xA5F6, 0xA5F6, 0xA5F7, 0xA5D6, 0xA5F6, 0xAE17,
-    0xA5F7, 0xA5F7, 0xA617, 0xA5F7, 0xA5F7, 0xA617, 0xA617, 0x9DB6,
-    0x8D13, 0x5BAE, 0x4B4C, 0x5BAC, 0x740D, 0x73ED, 0x73ED, 0x73ED,
-    0x740D, 0x740D, 0x740D, 0x6BED, 0x52E9, 0x52C8, 0x4A87, 0x39E5,
-    0x39E6, 0x2964, 0x2944, 0x2964, 0x6328, 0x8C2B, 0x946B, 0x946C,
-    0x946C, 0x946C, 0x946B, 0x946C, 0x946B, 0x9C8C, 0x944B, 0x8C0B,
-    0xACED, 0xAD0E, 0xB52E, 0xB52E, 0xB52E, 0xB54F, 0xBD6F, 0xBD4E,
-    0xB54D, 0xAD0D, 0xAD0D, 0xAD0D, 0xB50D, 0xB50D, 0xAD0D, 0xAD0D,
-    0xAD0D, 0xB52D, 0xB54E, 0xB54E, 0xB52E, 0xBDD3, 0xD6D8, 0xDF9D,
-    0xD79D, 0xD77C, 0xDF9C, 0xDF7D, 0xDF9D, 0xE7BD, 0xC635, 0xB5B2,
-    0xBDD3, 0xBDD2, 0xBDD3, 0xBDD3, 0xBDD3, 0xBDF3, 0xBDF2, 0xBDD2,
-    0xBDD2, 0xBDD2, 0xBDD3, 0xBDB2, 0xB5B3, 0xC614, 0xBE14, 0xB5B4,
-    0xB5D3, 0xBDF4, 0xBE14, 0x94AE, 0xA4EE, 0x8C4C, 0x844C, 0x844C,
-    0x842C, 0x948C, 0xACED, 0xA4AC, 0xA4CC, 0xA4CD, 0xA4CC, 0xA4CD,
-    0x9C8B, 0x944B, 0x73EC, 0x740D, 0x6BCB, 0x532A, 0x63AC, 0x6BED,
-    0x740C, 0x6BEC, 0x6BEC, 0x6C0D, 0x63AB, 0x946C, 0xA4AC, 0x9CAD,
-    0x9CCD, 0xA4ED, 0x9CCD, 0x948C, 0x944B, 0x946C, 0x8C2B, 0x844C,
-    0x94AD, 0x9CAD, 0x948D, 0xA4ED, 0xA4EE, 0xA4ED, 0xA4CD, 0x8C2C,
-    0x840B, 0x840B, 0x842B, 0x8C6C, 0x8C6C, 0x8C8D, 0x8C8D, 0x8C6C,
-    0x8C6D, 0x8C8D, 0x8C6C, 0x948D, 0x948D, 0x94AD, 0x7C2C, 0x42E9,
-    0x4B09, 0x534A, 0x534A, 0x5B8B, 0x42C9, 0x31A4, 0x9C8C, 0x73EB,
-    0x3268, 0x3289, 0x21E6, 0x1945, 0x08A2, 0x0000, 0x0000, 0x0000,
-    0xA4AC, 0x944B, 0x9C6B, 0x9C4B, 0x9C8B, 0x9C6B, 0x9C8B, 0xACED,
-    0xACED, 0xACED, 0xACED, 0xACED, 0xACED, 0xACED, 0xACED, 0xACEC,
-    0xA4CC, 0xACED, 0xACED, 0xACED, 0xACED, 0xB50D, 0xB54E, 0xA4AC,
-    0x8C2A, 0x944A, 0x83EA, 0x5B08, 0x6BAB, 0x73EC, 0x73EC, 0x638C,
-    0x84B2, 0xD75C, 0xDFBE, 0xDF9E, 0xDF9E, 0xDF9D, 0xDF9E, 0xDFBF,
-    0xE7BF, 0xE7BF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xE7BF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBE, 0xDFBE, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7BF, 0xE7BF, 0xDFDF, 0xE7DF, 0xEFFF, 0xEFFF, 0xE7FF,
-    0xDFFF, 0xDFFF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xDFDF, 0xDFDF, 0xE7FF, 0xE7FF, 0xE7DF, 0xDFFF, 0xE7FF,
-    0xE7FF, 0xD79E, 0xD77E, 0xD77E, 0xCF5D, 0xCF5E, 0xD75E, 0xD75E,
-    0xD75E, 0xD75E, 0xCF5D, 0xCF5D, 0xC71C, 0xCF3D, 0xBEBB, 0x8D36,
-    0x8D97, 0x7452, 0x6C31, 0x7452, 0x7492, 0x84F2, 0x8513, 0x8D13,
-    0x8CF3, 0x84F3, 0x84F2, 0x84D2, 0x84D2, 0x63EE, 0x1104, 0x0041,
-    0x4A66, 0x62E8, 0x62E8, 0x62E8, 0x6308, 0x6308, 0x62E8, 0x62E8,
-    0x62E8, 0x62E8, 0x5AC7, 0x5AC7, 0x62C7, 0x62E8, 0x62E8, 0x62E8,
-    0x6308, 0x6B08, 0x62E8, 0x5AA7, 0x7B89, 0xA4AB, 0x9C6B, 0x9CAC,
-    0x9CAD, 0xA4CD, 0xA4CE, 0xA4EE, 0xA4EE, 0xA4CD, 0x9C8C, 0x9C8B,
-    0xA48C, 0xA48C, 0xA48B, 0xA48B, 0xA48B, 0xA48B, 0xA48B, 0xB50D,
-    0xB52D, 0xB52D, 0xB52D, 0xB52D, 0xB52D, 0xB54E, 0xB50D, 0x83EA,
-    0x8C4B, 0x8C4B, 0x840A, 0x8C4C, 0x6B8A, 0x73CA, 0x73EB, 0x7C0B,
-    0x7C2C, 0x7C0B, 0x73EC, 0x3AEA, 0x3AC9, 0x3AC9, 0x3AC9, 0x3AC9,
-    0x740D, 0x846F, 0xADD6, 0xC678, 0x8C6D, 0x94F0, 0xC679, 0xDF3C,
-    0xD73C, 0xD73C, 0xCF1C, 0xD73C, 0x9D95, 0x7C70, 0x84D1, 0x84D1,
-    0x84D1, 0x84B1, 0x84B1, 0x84B1, 0x84B1, 0x7C91, 0x7CB1, 0x430A,
-    0x7C0B, 0xAD0D, 0xA4CD, 0xA4CD, 0xA4CD, 0xA4CD, 0xA4CD, 0xA4CD,
-    0xA4CD, 0xA4CD, 0xACED, 0x94CE, 0x9CCE, 0xAD0E, 0xACED, 0xACED,
-    0xACED, 0xACEC, 0xB52D, 0x9C6C, 0x7328, 0x7BA9, 0xACED, 0xACED,
-    0xA4CD, 0xA4ED, 0xA4CD, 0xAD2E, 0x5287, 0x5287, 0x6B8A, 0x3288,
-    0x3289, 0x2A48, 0x1986, 0x1945, 0x0041, 0x0000, 0x0000, 0x0000,
-    0x944B, 0x944B, 0x942B, 0x944B, 0x944B, 0x944B, 0x944B, 0x944B,
-    0x942B, 0x944B, 0x944B, 0x944B, 0x9C6B, 0x9C6B, 0xACED, 0x840A,
-    0x7368, 0x6B48, 0x7369, 0x7BA9, 0x7BA9, 0x8C0A, 0x944B, 0xACEC,
-    0xB50D, 0xB50D, 0xB50D, 0xB50D, 0xACEC, 0xACEC, 0xACEC, 0x9C6B,
-    0x946B, 0xAD0E, 0xB550, 0xAD2F, 0xAD2F, 0xAD2F, 0xB570, 0xC613,
-    0xC5F3, 0xBDD2, 0xB5B2, 0xB5B2, 0xB5B2, 0xB5B1, 0xBDB1, 0xBDB1,
-    0xBDB1, 0xB5B1, 0xAD71, 0x9CF0, 0xC614, 0xBDF3, 0xBDF3, 0xBDF3,
-    0xBDD2, 0xBDB2, 0xBDB2, 0xBDB2, 0xB5B2, 0xBDB2, 0xBDD2, 0xB5B2,
-    0xCEB8, 0xCF1A, 0xCEF9, 0xCEFA, 0xCEF9, 0xCEF9, 0xCEF9, 0xCED9,
-    0xCED9, 0xDFBE, 0xE7DF, 0xDFDF, 0xDFBF, 0xDFBE, 0xDFBE, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xDFDF, 0xE7DF, 0xE7DF, 0xE7BF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xE7BF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xEFFF, 0xEFFF, 0xEFFF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF, 0xE7FF, 0xCF7E, 0xBEDB, 0xBEBB,
-    0xBE9A, 0xB67A, 0xBE9A, 0xBE9A, 0xBE9A, 0xB67A, 0xB65A, 0xB65A,
-    0xB65A, 0xB65A, 0xB659, 0xAE59, 0xAE59, 0xAE19, 0xAE39, 0xB639,
-    0xB639, 0xBE59, 0x6C10, 0x4B0D, 0x4AAA, 0x5AEA, 0x5AEA, 0x52CA,
-    0x52CA, 0x5AEA, 0x5AEA, 0x4A68, 0x3A07, 0x3A07, 0x3A27, 0x2985,
-    0x2985, 0x2985, 0x2985, 0x2165, 0x2965, 0x2985, 0x2965, 0x5287,
-    0x6B28, 0x6B08, 0x6B08, 0x6B08, 0x6B28, 0x6B48, 0x7B89, 0x7BAA,
-    0x7BAA, 0x7369, 0x7369, 0x840C, 0x7C0C, 0x9CAD, 0x948C, 0x9CAD,
-    0x9CCD, 0x9CCE, 0x846C, 0x7C0C, 0x8C6C, 0x8C4C, 0x844C, 0x63AB,
-    0x6BED, 0x7C2E, 0x73EB, 0xAD2E, 0xBD6E, 0xAD0D, 0xA4EE, 0xBD90,
-    0xB570, 0xB56F, 0xB54F, 0xB54F, 0xB570, 0xB590, 0xBD91, 0xBDB1,
-    0xBDB1, 0xB570, 0xCE97, 0xE73B, 0xDF1A, 0xDF1A, 0xDF3A, 0x6BCD,
-    0x5329, 0x6BAB, 0x6BAB, 0x6BAB, 0x63AA, 0x63AA, 0x63AA, 0x63AB,
-    0x63AB, 0x7C0B, 0xAD0D, 0x9CEE, 0x94EE, 0xA50E, 0xB52E, 0xAD0D,
-    0xACCC, 0xA4CC, 0x7349, 0x5AA7, 0x83EA, 0x4A46, 0x2102, 0x8C0B,
-    0xB52D, 0xACEC, 0xBD4E, 0x6B08, 0x4205, 0x4A87, 0x4247, 0x3A88,
-    0x2A89, 0x3289, 0x21C6, 0x1124, 0x1965, 0x0040, 0x0000, 0x0000,
-    0x83C9, 0x83A9, 0x83A9, 0x83C9, 0x83C9, 0x83C9, 0x83C9, 0x83EA,
-    0x83CA, 0x8BEA, 0x83EA, 0x83EA, 0x8BEA, 0x83EA, 0x83EA, 0x8C0B,
-    0x944B, 0x7BCA, 0x6B8A, 0x73AB, 0x6BAA, 0x638A, 0x638A, 0x638A,
-    0x638A, 0x73EB, 0x7BEB, 0x7BCA, 0xA4CC, 0x946B, 0x7C0B, 0x7C2C,
-    0x8C6C, 0xACCC, 0xA48B, 0x8C2A, 0x9C8B, 0xA4AC, 0x840A, 0x83EA,
-    0x942A, 0x9409, 0x942A, 0x9C4A, 0xA4AB, 0x9C6A, 0x8C2A, 0x942A,
-    0x944A, 0x944B, 0x946B, 0x944B, 0x942A, 0x942A, 0x942A, 0x942A,
-    0x942A, 0x944A, 0x944A, 0x9C4A, 0xA4CC, 0xA48B, 0x9C8B, 0x9C6B,
-    0xA4CC, 0xACCC, 0xA4AC, 0x9C6B, 0x9C6B, 0x9C6B, 0x9C6B, 0x9C8C,
-    0x9C6C, 0xAD71, 0xBDD3, 0xBDD3, 0xBDD3, 0xBDD3, 0xBDD2, 0xBDD2,
-    0xB5D2, 0xB5B2, 0xB5B2, 0xBDB2, 0xB5B2, 0xD71A, 0xDF7D, 0xDF7D,
-    0xDF7D, 0xDF7D, 0xDF5C, 0xDF7C, 0xE79D, 0xDF9D, 0xDF7C, 0xD75C,
-    0xD73C, 0xD73B, 0xD75C, 0xD75C, 0xD75C, 0xD75C, 0xD75C, 0xDF7D,
-    0xC677, 0xBDD3, 0xBDF4, 0xB5D3, 0xB5D3, 0xBDF3, 0xBE14, 0xC635,
-    0xC635, 0xC655, 0xC655, 0xC655, 0xC656, 0xDF9D, 0xDFBE, 0xDF9D,
-    0xDFBD, 0xE7BE, 0xE7DE, 0xE7DE, 0xDFDE, 0xE7FF, 0xEFFF, 0xF7FF,
-    0xEFFF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xCF5D, 0xC6FC, 0xCF3D, 0xC6FC, 0x9DB7,
-    0x9DD7, 0x9DD7, 0x9DD7, 0x9DB7, 0x9DD8, 0x9DD8, 0x9DD8, 0x8CF4,
-    0x84D3, 0x8CD3, 0x8CF3, 0x8CF4, 0x8CF3, 0x9534, 0x5B6E, 0x2A09,
-    0x324A, 0x324A, 0x29E8, 0x1124, 0x2184, 0x5287, 0x5AA7, 0x5AC8,
-    0x5AE8, 0x6308, 0x9C6C, 0xACCC, 0x940A, 0x5A87, 0x5A87, 0x7BAA,
-    0x9CCD, 0xAD0E, 0x7C0C, 0x5AE8, 0x5AC8, 0x8C2B, 0x8C2B, 0x5B29,
-    0x5B6A, 0x638A, 0x638A, 0x636A, 0x6369, 0x6369, 0x6369, 0x6369,
-    0x5B49, 0x5B49, 0x5329, 0x7C0B, 0xACED, 0xA4CC, 0xA4AC, 0xA4CC,
-    0xA4CD, 0xA4CD, 0xA4ED, 0xACED, 0xA4ED, 0xA4AC, 0xAD0D, 0x9CAD,
-    0x946C, 0xAD2D, 0xACEC, 0xACCC, 0xB52D, 0xA4AC, 0x4A06, 0x5AA7,
-    0xAD0D, 0x7B89, 0x5AA7, 0x6B69, 0x73AA, 0x52C8, 0x0861, 0x1881,
-    0xACCD, 0x842B, 0x6329, 0x39C5, 0x5B29, 0x532A, 0x42C9, 0x32A8,
-    0x2A07, 0x1965, 0x2207, 0x1124, 0x0041, 0x0000, 0x0000, 0x0000,
-    0x83A9, 0x7B89, 0x83A9, 0x7B89, 0x7BA9, 0x83C9, 0x83A9, 0x7B89,
-    0x7BA9, 0x7B89, 0x7B89, 0x7B89, 0x7B89, 0x7BA9, 0x8C2B, 0x944B,
-    0x9C4B, 0x944B, 0x8C0B, 0x83EA, 0x7BAA, 0x840B, 0x7389, 0x4A86,
-    0x4A86, 0x5AC7, 0x5AE7, 0x5266, 0x5AA6, 0x5AA6, 0x52A7, 0x52A7,
-    0x52A7, 0x5286, 0x5286, 0x5286, 0x5286, 0x5AC7, 0x6348, 0x6349,
-    0x6328, 0x8C0A, 0x8C2A, 0x9C6B, 0xACCC, 0x840A, 0x6307, 0x62E7,
-    0x6307, 0x6308, 0x6B28, 0x6B28, 0x6B08, 0x6307, 0x5A86, 0x5A86,
-    0x5A85, 0x5A85, 0x5AA6, 0x5AA6, 0x8C2B, 0x7389, 0x7BAA, 0x83EA,
-    0xA4AC, 0xACED, 0xACCC, 0x942A, 0x8C0A, 0x944B, 0x944B, 0x944B,
-    0x946C, 0x83EA, 0x9C6B, 0x9C6B, 0x9C8B, 0xA4AC, 0xA4AB, 0xA4AB,
-    0xA4AB, 0xA4AB, 0xA4AB, 0xA4AB, 0xA4AB, 0xA4ED, 0xAD0E, 0xAD0E,
-    0xACEE, 0xACEE, 0xAD0E, 0xAD2E, 0x8C4C, 0x946C, 0x840B, 0x8C4B,
-    0xA4ED, 0xAD0D, 0xA4ED, 0x9CAD, 0xA4ED, 0xAD0E, 0xB52F, 0xB54F,
-    0xB54E, 0xAD0D, 0xAD0C, 0xACEC, 0xACEC, 0xACEC, 0xACEC, 0xACEC,
-    0xACEC, 0xACEC, 0xACEC, 0xACEC, 0xACED, 0xB54F, 0xB52E, 0xB52E,
-    0xAD0E, 0x9CAD, 0x948C, 0x948C, 0x8CCF, 0xB69A, 0xBE99, 0xB659,
-    0xCF1C, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDFBE, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFDF, 0xDFDF, 0xE7DF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xD7BF, 0xD77E,
-    0xD79E, 0xD77E, 0xBEFC, 0xB69A, 0xB69A, 0xAE7A, 0xAE59, 0xB658,
-    0xBE79, 0xADB5, 0x5287, 0x3163, 0x7B89, 0x9CF0, 0x94D0, 0x7BEA,
-    0xB54F, 0x6BAA, 0x7C6F, 0xA4CD, 0x9CAD, 0x7BCA, 0x7BCA, 0x9CED,
-    0x73EB, 0x63AB, 0x6BCB, 0x6BCB, 0x6BAB, 0x6BAB, 0x6BAB, 0x63AB,
-    0x63AA, 0x6BCB, 0x6BCB, 0x7C0B, 0xAD0D, 0xACEC, 0xACCC, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xACCC, 0xB50D, 0x83CA, 0x4A06,
-    0x5A87, 0x946C, 0xB50D, 0xBD4E, 0x8C0B, 0x4226, 0x4AA8, 0x3A26,
-    0x4A66, 0x6B29, 0x4A46, 0x2164, 0x3247, 0x3227, 0x08A2, 0x0020,
-    0x10A1, 0x2143, 0x0040, 0x29E6, 0x2A07, 0x0841, 0x1964, 0x2A06,
-    0x21A6, 0x2A48, 0x1124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x944B, 0x942B, 0x9C6C, 0x9C8C, 0x8C0A, 0x8C0A, 0x9C6B, 0x944B,
-    0x942A, 0x942A, 0x944B, 0x944B, 0x944B, 0x9C6B, 0xB52D, 0xBD4E,
-    0xB52E, 0x9CCD, 0x9CAC, 0x946C, 0x8C2B, 0x842C, 0x6349, 0x5AC7,
-    0x5AC7, 0x5AC8, 0x5AC8, 0x5287, 0x4A87, 0x5287, 0x5287, 0x52A7,
-    0x3A06, 0x4289, 0x4AEB, 0x4AEB, 0x42EB, 0x4AA8, 0x7B68, 0x8C0A,
-    0x83C9, 0x83EA, 0x83EA, 0x83EA, 0x83CA, 0x944B, 0xA48B, 0xB5B3,
-    0xBE37, 0xC6B9, 0xCF1B, 0xC6FB, 0xC71B, 0xBE98, 0x7368, 0x6B07,
-    0x6B07, 0x6AE7, 0x7348, 0x83C9, 0x6307, 0x944B, 0xACED, 0xAD0D,
-    0xACED, 0xACCC, 0xA4CC, 0xACEC, 0xACEC, 0xACEC, 0xACEC, 0xACED,
-    0xACED, 0xB52D, 0xB50D, 0xAD0D, 0xB52E, 0xB52D, 0xB50D, 0xB50D,
-    0xB52D, 0xB54E, 0xBD4E, 0xBD4E, 0xBD4E, 0xB54E, 0xB54D, 0xB52D,
-    0xB52D, 0xB54D, 0xB54D, 0xBD4E, 0xA4CC, 0xA4CC, 0x9C8B, 0xA4CC,
-    0xBD4D, 0xBD4E, 0xB52D, 0xACEC, 0xB50D, 0xAD0D, 0x9CCD, 0x8C4B,
-    0x7B69, 0x7B89, 0x7B89, 0x7BA9, 0x7BAA, 0x7BAA, 0x83AA, 0x7BAA,
-    0x7BAA, 0x7BAA, 0x83AA, 0x83AA, 0x83AA, 0x7B89, 0x7B89, 0x62E7,
-    0x39C4, 0x1923, 0x4289, 0x29C5, 0x4289, 0x4289, 0x4AAA, 0x6BCE,
-    0xB638, 0xE7DF, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDFBE, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xD77E,
-    0xD77E, 0xD79E, 0xD79E, 0xD77E, 0xD7BE, 0xDFBF, 0xDFBF, 0xD79F,
-    0xD79F, 0xDF9F, 0xDFBF, 0xD7BF, 0xD7BF, 0xD7BF, 0xDFBF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xE7FF, 0xD79E, 0xB659, 0xCF1C, 0xCEF9, 0xA52F,
-    0xAD50, 0xB54F, 0xACED, 0xA4AC, 0xA4CC, 0xACEC, 0xAD0D, 0x9C8C,
-    0x73CA, 0x4AE9, 0x3A87, 0x5B08, 0x5AC7, 0x6B49, 0x4A87, 0x6B69,
-    0xA4CC, 0xACED, 0xAD0D, 0xB50D, 0xB50D, 0xB50D, 0xACED, 0xAD0D,
-    0xB50D, 0xB50D, 0xB52D, 0xB50D, 0xACED, 0xACED, 0xACED, 0xAD0D,
-    0xAD0D, 0xAD0D, 0xAD0D, 0xAD0D, 0xAD0E, 0x7369, 0x5AC8, 0x7BCA,
-    0x5B08, 0x31E5, 0x9CAD, 0x83CB, 0x2964, 0x31C5, 0x3A06, 0x39E6,
-    0x1081, 0x2123, 0x0020, 0x10C2, 0x29E6, 0x10C2, 0x0061, 0x0040,
-    0x0020, 0x0000, 0x0000, 0x1944, 0x10E3, 0x1924, 0x2A27, 0x1924,
-    0x21C6, 0x10E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x7BA9, 0x8BEA, 0x83CA, 0x944B, 0x944B, 0x942B, 0xA4CC, 0xACED,
-    0xACED, 0xACED, 0xACED, 0xACED, 0xACED, 0xB50D, 0x840A, 0x6B69,
-    0x6349, 0x3ACA, 0x430B, 0x32A9, 0x8D34, 0xC6FB, 0xBEDB, 0xC6FB,
-    0xCF3C, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3C, 0xCF3C, 0xCF3C, 0xCF3C,
-    0xAE18, 0xCF3D, 0xDFBF, 0xD77D, 0xDF9E, 0x84F3, 0x740D, 0x7389,
-    0x83EA, 0x8C0A, 0x8C0A, 0x8C0A, 0x8C0A, 0x8C0A, 0x948D, 0xBDF3,
-    0xAD71, 0xBDF4, 0xBE55, 0xBE35, 0xBE35, 0xBDF3, 0xACED, 0xACCC,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xAD0D, 0xB52D, 0xB50D, 0xB50D, 0xB52D,
-    0xB54E, 0xB52D, 0xB50D, 0xACED, 0xA4CC, 0xA4CC, 0xA4CD, 0xACED,
-    0xA4ED, 0x9C8C, 0x9C8C, 0x9CAC, 0x944B, 0x8BEA, 0x8C0A, 0x83C9,
-    0x6B48, 0x5266, 0x5266, 0x5AC7, 0x5AC8, 0x5AC8, 0x5AA7, 0x5A87,
-    0x5AA7, 0x5286, 0x5AA7, 0x5AA7, 0x62C7, 0x62E8, 0x62E7, 0x6308,
-    0x62C8, 0x5AA7, 0x5AC7, 0x62C7, 0x6329, 0x29C5, 0x1924, 0x2165,
-    0x10C3, 0x18E3, 0x1904, 0x1904, 0x1924, 0x1924, 0x1924, 0x1924,
-    0x1924, 0x1924, 0x1924, 0x1924, 0x1924, 0x2124, 0x2124, 0x530B,
-    0x84D3, 0x9D75, 0xD77E, 0xA5B7, 0xCF3C, 0xDFBE, 0xDF9E, 0xDFBE,
-    0xE7DF, 0xDF9F, 0xDF9F, 0xDF9F, 0xDF9F, 0xDF9F, 0xDF9F, 0xDFBF,
-    0xDFBE, 0xE7DF, 0xE7DF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFFF, 0xD75D, 0xCEFB, 0xDFDF, 0xCF3C, 0xCEFA, 0xCEFA, 0xCEFA,
-    0xCEFA, 0xCED9, 0xCEB8, 0xC698, 0xC6B8, 0xC698, 0xBE35, 0xBE35,
-    0xBE15, 0xBE15, 0xC656, 0xAD72, 0x6B29, 0x8C2C, 0x9CCD, 0x944B,
-    0x9C6B, 0xA4CC, 0xACED, 0xACEC, 0xA4CC, 0xACCC, 0xA4CC, 0xACED,
-    0x946C, 0x840B, 0x8C6C, 0x9CAD, 0x840B, 0xAD0D, 0x946B, 0x840A,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4AC,
-    0xA4AC, 0xA4AC, 0x9C8C, 0x9CAC, 0x9C8C, 0xA4AC, 0xA4CC, 0x946B,
-    0x7C0B, 0x4AC8, 0x4267, 0x4267, 0x3206, 0x2144, 0x6B8A, 0x18E2,
-    0x10E3, 0x2164, 0x0020, 0x1903, 0x2144, 0x2984, 0x2984, 0x18E3,
-    0x0861, 0x1082, 0x0020, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0061, 0x1124, 0x1965, 0x19A6, 0x0882, 0x0861,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5AA6, 0x7B89, 0x83A9, 0x83C9, 0xA4AC, 0xACED, 0xA4CC, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xA4CC, 0xACCC, 0x9C8C, 0x944B,
-    0x948D, 0xA595, 0xCF1C, 0xCF5D, 0xD79E, 0xDFDF, 0xE7DF, 0xDFBF,
-    0x9575, 0x8534, 0x9575, 0x8D75, 0x8D75, 0x9595, 0x9595, 0x95B6,
-    0x9DB6, 0xBE57, 0xBDF4, 0xA50E, 0xA50F, 0x8C6D, 0xA52F, 0xA4CD,
-    0xA4CC, 0xACCC, 0xACEC, 0xA4CC, 0xACCC, 0xA4AC, 0xA48B, 0xA4AB,
-    0xACEC, 0xACCC, 0xACEC, 0xACEC, 0xAD0C, 0xB52D, 0xB54E, 0xB54E,
-    0xB52D, 0xAD2D, 0xAD2E, 0x948C, 0x8C4B, 0x8C4B, 0x8C4B, 0x6B49,
-    0x52A7, 0x52A7, 0x52A7, 0x39A4, 0x3164, 0x2963, 0x2963, 0x31A4,
-    0x3183, 0x0861, 0x0881, 0x3207, 0x29A6, 0x3A28, 0x3A49, 0x31E8,
-    0x4AEC, 0x42EC, 0x4B4E, 0x4B2E, 0x532E, 0x532E, 0x4B2E, 0x4B4E,
-    0x4AEC, 0x5B8F, 0x4B4E, 0x4B0D, 0x4B0D, 0x532D, 0x7431, 0x5B6F,
-    0x63D0, 0x6C52, 0x5BAF, 0x63F1, 0x74B4, 0x8536, 0x6C73, 0xBEBB,
-    0xDFBF, 0xD7BE, 0xD79E, 0xD77D, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xDFBF, 0xD7BF, 0xD7BF, 0xDF9F, 0xDF9F, 0xDFDF,
-    0xEFFF, 0xEFFF, 0xDFDF, 0xEFFF, 0xE7DE, 0xDFBD, 0xDFBD, 0xDF9D,
-    0xDF9D, 0xDF9D, 0xDF9E, 0xDF9E, 0xDF9D, 0xDF9E, 0xDF9E, 0xDF9D,
-    0xDFBE, 0xB637, 0xB5D4, 0xC634, 0xBE14, 0xBE14, 0xBE14, 0xBE14,
-    0xBE34, 0xB571, 0xA50F, 0xCEB8, 0xAD71, 0x9C6B, 0xAD0D, 0x9C8C,
-    0x948C, 0xA4AC, 0xA4CC, 0xA4AC, 0xA4AC, 0xA4CC, 0xA4AC, 0xA48B,
-    0xA48B, 0xA4AB, 0xACCC, 0xACEC, 0xB52D, 0xB4ED, 0xACCC, 0xACCC,
-    0xA4AC, 0x8C0A, 0x8C0A, 0xA4AC, 0xA4CC, 0xACCC, 0xACED, 0xACEC,
-    0xAD0D, 0xB52D, 0xB50D, 0xB50D, 0xACEC, 0xA4AB, 0xA4CC, 0xACEC,
-    0xA4AC, 0x9C8B, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4CC, 0xACED, 0x840A,
-    0x946C, 0x948C, 0x83EA, 0x8C0B, 0x83EA, 0x83EA, 0x9C8C, 0x5AA7,
-    0x6329, 0x6308, 0x39E5, 0x2964, 0x31A5, 0x52C8, 0x4246, 0x3A06,
-    0x4A67, 0x5287, 0x4A67, 0x5B09, 0x39E5, 0x4A46, 0x5AC8, 0x39E5,
-    0x5267, 0x6309, 0x5AC8, 0x39E5, 0x4A26, 0x3184, 0x2143, 0x4205,
-    0x4205, 0x52C8, 0x5309, 0x4AE8, 0x4AC8, 0x3A05, 0x3184, 0x3184,
-    0x31A4, 0x3184, 0x31A4, 0x2964, 0x2964, 0x2984, 0x2984, 0x2964,
-    0x62C6, 0x62C6, 0x7B68, 0x9C8C, 0x942A, 0xACED, 0xACED, 0xA4ED,
-    0xA4EC, 0xACEC, 0xACED, 0xACED, 0xACED, 0xACED, 0xAD0D, 0xB52D,
-    0xB54E, 0xAD2E, 0xB550, 0xB590, 0x94AE, 0x9D31, 0x94D0, 0x7C4E,
-    0x5309, 0x4AE8, 0x5B09, 0x4AA7, 0x6B89, 0x840A, 0x7BEA, 0x840A,
-    0x840A, 0x9C8B, 0xACEC, 0xACEC, 0xB50C, 0xB52D, 0xAD0C, 0xB52D,
-    0xB52D, 0xACEC, 0xACCC, 0xACEC, 0xACED, 0xB50D, 0xB52D, 0xAD0D,
-    0x946C, 0x6B6A, 0x52C8, 0x4267, 0x3A05, 0x39E5, 0x3A05, 0x3A26,
-    0x3A26, 0x3A46, 0x3A05, 0x0020, 0x08C3, 0x1965, 0x2A08, 0x2A08,
-    0x53AF, 0x7492, 0x6C31, 0x8D35, 0xA5D7, 0x9D55, 0x9535, 0x9D96,
-    0x9D55, 0x9D96, 0xA5B7, 0xB639, 0xBEDB, 0xD79F, 0xD79F, 0xD77E,
-    0xDFBF, 0xE7FF, 0xE7FF, 0xDF9E, 0xE7BE, 0xDF9E, 0xDFBF, 0xEFFF,
-    0xE7DE, 0xEFFF, 0xE7FF, 0xDFDF, 0xDFDF, 0xDFFF, 0xEFFF, 0xC6DA,
-    0xD75C, 0xCF1A, 0xA5D6, 0xDF7C, 0xDF5B, 0xDF5B, 0xD73B, 0xCF1A,
-    0xCEFA, 0xCEFA, 0xB5F5, 0x9D32, 0xD71A, 0xCEF9, 0xD6F9, 0xD6F9,
-    0xD6FA, 0xD6FA, 0xD6FA, 0xCEFA, 0xCEFA, 0xCEFA, 0xCEFA, 0xCEF9,
-    0xCED9, 0xCEF9, 0xCEF9, 0xD6FA, 0xB591, 0xAD0E, 0xAD2E, 0xAD0E,
-    0xAD0E, 0xAD0F, 0xAD2F, 0xB52F, 0xAD2F, 0xAD2F, 0xAD2F, 0xAD2F,
-    0xB54F, 0x9C8C, 0xA48B, 0xACCB, 0xA4AB, 0xA4AB, 0xA4AB, 0xA4AB,
-    0xACAB, 0xACEC, 0xAD0D, 0xACEC, 0xB52E, 0xB52D, 0xB50D, 0xA4EC,
-    0xA4CC, 0xA4CC, 0x7B88, 0x7347, 0x7347, 0x7348, 0x6B07, 0x8C0A,
-    0xACED, 0xA4CC, 0x9C6B, 0xAD0D, 0xB50D, 0xB50D, 0xB50D, 0xAD0D,
-    0xACCD, 0x942B, 0x8BEA, 0x7BA9, 0xACEC, 0xAD0D, 0xACED, 0xACED,
-    0xA4CC, 0x8C2B, 0x842B, 0x840B, 0x5329, 0x63AC, 0x63CD, 0x5B8C,
-    0x63AC, 0x6BED, 0x5286, 0x6307, 0x840A, 0x8C4B, 0x946C, 0x83EA,
-    0x946B, 0x944B, 0x944B, 0x946B, 0x944B, 0x944B, 0x944B, 0x9C8D,
-    0x948D, 0xA4EE, 0xAD0E, 0x9CAD, 0x948D, 0x9C8C, 0x9CAD, 0xA4EE,
-    0x946C, 0x7369, 0x83EA, 0x83CA, 0x7BCA, 0x840B, 0x8C2B, 0x8C2B,
-    0x944B, 0x944B, 0x8C2B, 0x8C2B, 0x946C, 0x8C4B, 0x840B, 0x948C,
-    0x9CAC, 0x9C8C, 0x9C8C, 0x946B, 0x8C2B, 0x8C4B, 0x946C, 0x9C6B,
-    0x944B, 0x944B, 0x946C, 0x6B8A, 0x5309, 0x4AE9, 0x4AC8, 0x4B09,
-    0x62A6, 0x6B27, 0x7348, 0x7B88, 0x7368, 0x7B88, 0x8BE9, 0x7BA9,
-    0x83EA, 0x8BEA, 0x8C0A, 0x942A, 0x942A, 0x940A, 0x942A, 0x944B,
-    0x8C0A, 0x8C2A, 0x9C8B, 0x9C6B, 0x9C6B, 0x8C2A, 0x942A, 0x942A,
-    0xA4CC, 0xAD0D, 0xACED, 0xB52D, 0xB52D, 0xB50D, 0xBD4D, 0x946B,
-    0x5B08, 0x5B08, 0x5B08, 0x5B29, 0x5309, 0x52E8, 0x634A, 0x5B09,
-    0x6328, 0x946B, 0xB50D, 0xACEC, 0xACED, 0xA4CC, 0x842B, 0x4A87,
-    0x08A1, 0x10E3, 0x2186, 0x42CB, 0x4B2E, 0x6410, 0x6410, 0x63F0,
-    0x5B8F, 0x5BAF, 0x534E, 0x63AF, 0x63F0, 0x8535, 0x9E19, 0xB6BB,
-    0xD7DF, 0x9DD7, 0xD75D, 0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7DF, 0xDFBF, 0xDFBF, 0xE7DF,
-    0xE7BF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xEFFF, 0xE7FF, 0xC6FB,
-    0xCF1C, 0xC6FC, 0xCF3B, 0xC675, 0xC655, 0xC675, 0xBE14, 0xAD2F,
-    0xAD4F, 0xAD4E, 0xAD4E, 0xAD2E, 0xAD0D, 0xACEC, 0xACCB, 0xACCB,
-    0xACCC, 0xA4AB, 0xA4AB, 0xACCB, 0xACCB, 0xACCC, 0xACCC, 0xACCC,
-    0xACCC, 0xACCC, 0xACCC, 0xACCC, 0xACCC, 0xACCC, 0xACCC, 0xACCC,
-    0xACEC, 0xB50D, 0xB50D, 0xB50D, 0xB50C, 0xACEC, 0xACEC, 0xACCC,
-    0xACCC, 0xACEC, 0xACCC, 0xA4AC, 0xA4AC, 0xACCC, 0xACCC, 0xA48B,
-    0xA48B, 0xA4AB, 0xA4CC, 0xACED, 0xACED, 0xACCC, 0xA4CC, 0xACED,
-    0xA4CC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC,
-    0x9C8B, 0x9C8B, 0xA4AC, 0xA4AC, 0xA4AC, 0xA4AC, 0xA48B, 0xA4AC,
-    0xACCC, 0xA4AC, 0x942B, 0x9C6B, 0x7368, 0x7368, 0x7368, 0x6B48,
-    0x7369, 0x83EA, 0x83CA, 0x946B, 0x9CAC, 0x9C6B, 0xA4AB, 0xA4AB,
-    0xACED, 0x842B, 0x844C, 0x844C, 0x9510, 0xADF5, 0xADF5, 0x9D52,
-    0x9D51, 0xBE35, 0xA4ED, 0x946C, 0xA4CD, 0xAD0E, 0xB52E, 0xB52E,
-    0xAD0D, 0x8C6C, 0x6349, 0x3A06, 0x39E6, 0x31C6, 0x31A5, 0x31C5,
-    0x39E6, 0x3A06, 0x3A06, 0x4226, 0x31E5, 0x31C5, 0x4226, 0x39E6,
-    0x4A88, 0x638D, 0x5B8D, 0x63EF, 0x63EF, 0x84F2, 0x8D12, 0x9D11,
-    0x9CCF, 0x8C6D, 0xA4CD, 0xA48C, 0x946C, 0x944B, 0x8C0B, 0x73A9,
-    0x73CA, 0x7BEA, 0x8C4B, 0x83EA, 0x842C, 0x8C4C, 0x83EB, 0x73AA,
-    0x73CB, 0x5AC8, 0x3A27, 0x2185, 0x0903, 0x21C6, 0x2206, 0x2A47,
-    0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6, 0x6B07, 0x7B68, 0x7B89,
-    0x83C9, 0x83A9, 0x83A9, 0x83A9, 0x83C9, 0x83CA, 0x83CA, 0x83A9,
-    0x7BA9, 0x7B89, 0x7348, 0x7368, 0x942B, 0x942B, 0x9C4B, 0xA4AC,
-    0xA4AC, 0xA4AC, 0xACEC, 0x8C0A, 0x6B69, 0x5B29, 0x6349, 0x8C8F,
-    0xB659, 0xB659, 0xBEBA, 0xB6BA, 0xB69A, 0xB69A, 0x7491, 0x21A6,
-    0x3A47, 0x6B8A, 0x840B, 0xA4EC, 0xACED, 0x9CAC, 0x8C6C, 0x29E6,
-    0x4289, 0x9596, 0xBEDC, 0xBEFC, 0xB6DB, 0xDFFF, 0xE7FF, 0xEFFF,
-    0xE7FF, 0xE7FF, 0xDFBF, 0xDFDF, 0xCF7E, 0xD79E, 0xCF5D, 0xCF5E,
-    0xD77E, 0xCF3C, 0xDF7E, 0xDF9E, 0xE7DF, 0xE7DF, 0xDF9E, 0xD79E,
-    0xD79E, 0xD79E, 0xD77E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDFDF, 0xB659, 0x84D3, 0x84F3, 0x52EA,
-    0x1944, 0x10E3, 0x31E6, 0x5AC7, 0x52A6, 0x52A6, 0x52A6, 0x5AE8,
-    0x5B08, 0x52C7, 0x5AE7, 0x6308, 0x6B48, 0x840A, 0x8C4B, 0x842B,
-    0x844B, 0x842B, 0x842B, 0x844B, 0x842B, 0x7C0A, 0x7C0A, 0x7C0A,
-    0x7C0B, 0x7C0B, 0x7C0A, 0x840A, 0x842B, 0x840A, 0x842B, 0x8C2B,
-    0x8C4C, 0x946C, 0x944B, 0x8C2B, 0x942B, 0x942B, 0x942B, 0x8C2B,
-    0x942B, 0x8C2B, 0x7B89, 0x7B89, 0x7B89, 0x8BEA, 0x8C0A, 0x83C9,
-    0x7B89, 0x7B68, 0x7B89, 0x7B89, 0x8BEA, 0x83C9, 0x7BA9, 0x83EA,
-    0x6B07, 0x7348, 0x7368, 0x7368, 0x7368, 0x7B89, 0x83C9, 0x7B88,
-    0x7B88, 0x83A9, 0x942A, 0xACEC, 0xACEC, 0xACCC, 0xACCC, 0xACCC,
-    0xACCC, 0xACEC, 0xB50D, 0xA4AC, 0x944B, 0x942B, 0x942B, 0x944B,
-    0x844D, 0x7C70, 0x4AEA, 0x4B0A, 0x5BAD, 0x8490, 0xBDD3, 0xBDD3,
-    0x83CA, 0x8BC9, 0x8C0A, 0x944B, 0x944A, 0x8C0A, 0x8C0A, 0x942A,
-    0x942A, 0x83C9, 0x8C0A, 0x5286, 0x7B69, 0x940A, 0x8BEA, 0x83EA,
-    0x8C0A, 0x8C0A, 0x73AB, 0x740E, 0x8CD1, 0x8470, 0x8CD2, 0x9555,
-    0x9596, 0x9DB7, 0xA5F8, 0xA619, 0xA619, 0xA619, 0xA619, 0x9DF8,
-    0xA67A, 0xBF5D, 0xA679, 0x9DF6, 0xAE16, 0x84D1, 0x7C6F, 0x73CC,
-    0x636B, 0x6BCC, 0x844C, 0x7C0B, 0x73CB, 0x7C0B, 0x6BAA, 0x73CA,
-    0x6BCA, 0x7C0B, 0x638B, 0x1944, 0x1903, 0x1944, 0x1103, 0x1124,
-    0x1103, 0x0021, 0x0861, 0x2103, 0x31A5, 0x52C8, 0x5AC7, 0x5AC7,
-    0x5A85, 0x7348, 0x83C9, 0x83EA, 0x8C0A, 0x8C0A, 0x8BEA, 0x8BEA,
-    0x8BEA, 0x8C0A, 0x8BEA, 0x8BEA, 0x8BEA, 0x8C0A, 0x8C0A, 0x8C0A,
-    0x8C0A, 0x8BEA, 0x83EA, 0x8C0B, 0x9C6B, 0xA4AC, 0xA4CC, 0xACED,
-    0xACED, 0xACED, 0xAD0D, 0x9C8C, 0x946C, 0x842D, 0x5B4B, 0x42A9,
-    0x740F, 0x534D, 0x9DB6, 0xAE18, 0xA617, 0xAE18, 0x7C70, 0x63AD,
-    0x9512, 0x94F0, 0x842B, 0xA4ED, 0xACEC, 0xB50D, 0xA4CC, 0x6BAA,
-    0x8C8E, 0x6BAC, 0x530A, 0x5B4B, 0x532A, 0x42A9, 0xB637, 0xD73A,
-    0xD6F9, 0xD73B, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFDF, 0xEFFF, 0xE7FF, 0xEFFF, 0xC6DB, 0xBEDB, 0xEFFF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xDFDF, 0xDFDF, 0xDF9E, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBE, 0xDF9E, 0xDFDF, 0xC6FB, 0xA5F7, 0xAE38, 0xD73B,
-    0xA5F7, 0x9D96, 0x9D96, 0x9D96, 0x9D96, 0x9576, 0x9576, 0x9576,
-    0x9D96, 0x84B3, 0x534D, 0x326A, 0x42EC, 0x5BAE, 0x3ACB, 0x63CE,
-    0x4B2B, 0x21E7, 0x3248, 0x2A07, 0x2A28, 0x3248, 0x31E7, 0x31E7,
-    0x31E7, 0x29E7, 0x29E7, 0x31E7, 0x2185, 0x31E7, 0x1965, 0x2185,
-    0x1944, 0x2984, 0x31C5, 0x31A4, 0x31A4, 0x39A4, 0x39C4, 0x39A4,
-    0x39A4, 0x39A4, 0x3163, 0x3163, 0x3183, 0x3183, 0x41C4, 0x5245,
-    0x62E7, 0x62E7, 0x5AC7, 0x5AC7, 0x6B08, 0x7368, 0x8C0A, 0x8C2A,
-    0x942B, 0x942B, 0x944B, 0x83EA, 0x7BCA, 0x8C0A, 0x9C6B, 0x944B,
-    0x83CA, 0x6B28, 0x6BAA, 0x5B69, 0x73A9, 0x8C6C, 0x9CAC, 0x9CCC,
-    0x9CCD, 0xA4ED, 0xA4AC, 0xA4CC, 0xB52D, 0xB50D, 0xB50D, 0xB52D,
-    0xAD2E, 0x94AD, 0x8C6D, 0x7C4D, 0x848E, 0xBDF2, 0xB592, 0x9CCF,
-    0x62E7, 0x62A6, 0x62E7, 0x62C6, 0x62C6, 0x62E7, 0x5AA6, 0x5A65,
-    0x5A85, 0x5A86, 0x6B07, 0x6B07, 0x6AE7, 0x62C6, 0x5AA6, 0x62C7,
-    0x5265, 0x62E7, 0x62E7, 0x83C9, 0xBD6F, 0xB52E, 0xB54F, 0xB58F,
-    0xAD91, 0xBE35, 0xB616, 0xBE37, 0xB637, 0xBE78, 0xADD5, 0x63ED,
-    0x63ED, 0x4AC9, 0x4AE9, 0x2A06, 0x52E8, 0x7369, 0x7348, 0x7BA8,
-    0x7389, 0x6B69, 0x5B28, 0x5B29, 0x5308, 0x5B28, 0x6348, 0x5B08,
-    0x6328, 0x7389, 0x52C7, 0x52C8, 0x4A46, 0x4A46, 0x4A45, 0x4A45,
-    0x4A45, 0x4A46, 0x5286, 0x62E7, 0x5AC6, 0x5AA6, 0x5AA6, 0x5AA6,
-    0x7B68, 0x8C0A, 0x8BEA, 0x8C0A, 0x8BEA, 0x8BEA, 0x8BEA, 0x8C0A,
-    0x8C0A, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8C0A, 0x8C0A,
-    0x8BEA, 0x8BEA, 0x83EA, 0x83CA, 0x83A9, 0x7B89, 0x7B89, 0x7368,
-    0x7348, 0x7348, 0x7348, 0x7B88, 0x7B89, 0x83A9, 0xA4CD, 0x944B,
-    0x840B, 0x6308, 0x6B69, 0x6B48, 0x6B28, 0x6B48, 0x73AA, 0x73CA,
-    0xAD2E, 0xB54E, 0xAD0D, 0xACEC, 0xACEC, 0xACEC, 0xAD0D, 0xB52E,
-    0xAD0D, 0xA4CC, 0xA4CC, 0xA4AC, 0xA4CC, 0x9C8C, 0xA4AC, 0xA4CC,
-    0xA4AC, 0xAD0E, 0xBDD3, 0xBDD3, 0xBDF4, 0xC635, 0xBE14, 0x94D1,
-    0x8470, 0x7C70, 0x9D11, 0xA552, 0x636A, 0x638B, 0xB5D4, 0xA552,
-    0xA552, 0x94F1, 0x7430, 0xBE9A, 0xCF5D, 0xDFFF, 0xE7DF, 0xDFDF,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFBF, 0xE7FF, 0xEFFF, 0xEFFF, 0xE7FF,
-    0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF, 0xEFFF, 0xF7FF, 0xEFFF, 0xEFFF,
-    0xEFFF, 0xEFFF, 0xE7DF, 0xCF3D, 0xD7BF, 0xDFBE, 0xC6DB, 0xC6DB,
-    0xC6DB, 0xB67A, 0xC6DB, 0xC6DB, 0xBE9A, 0xD77D, 0xD79E, 0xD77E,
-    0xD77E, 0xD77E, 0xD77E, 0xD77E, 0xC6DB, 0xD75D, 0xB67A, 0x9597,
-    0x7452, 0x3A6A, 0x4B2D, 0x324A, 0x42CC, 0x42EC, 0x4B0C, 0x534D,
-    0x42EC, 0x42EC, 0x4B0C, 0x4B0D, 0x4B0D, 0x4B0D, 0x4B0D, 0x3229,
-    0x42CB, 0x532C, 0x42EB, 0x42EB, 0x10C3, 0x18E3, 0x2984, 0x2984,
-    0x2964, 0x2964, 0x2964, 0x2964, 0x2123, 0x2123, 0x2143, 0x2143,
-    0x2143, 0x10C2, 0x2163, 0x4AE7, 0x29E5, 0x3226, 0x42C7, 0x42E8,
-    0x42C8, 0x42C8, 0x52C7, 0x5AC7, 0x5AC7, 0x6B28, 0x6308, 0x6B28,
-    0x5286, 0x5AE7, 0x52E7, 0x5AE7, 0x7388, 0x6327, 0x7BA9, 0x942A,
-    0x83C9, 0x944B, 0x8C0B, 0xA4AC, 0xACCC, 0xA4AC, 0x944B, 0x942B,
-    0x944B, 0x9C6C, 0xA4ED, 0x9C8C, 0x9C8C, 0x9C8C, 0xA4AC, 0xA4CD,
-    0x9C8C, 0xA48C, 0xACED, 0xB50E, 0xB50D, 0xB52E, 0xACED, 0xA4CC,
-    0x83EA, 0x7B88, 0x5A44, 0x6285, 0x62A5, 0x6285, 0x62A5, 0x62C6,
-    0x62C6, 0x62C6, 0x5266, 0x4205, 0x4226, 0x7B89, 0x83CA, 0x6B49,
-    0x5AE8, 0x52C7, 0x4A25, 0x4205, 0x4205, 0x4205, 0x41E5, 0x41E5,
-    0x41E5, 0x4A25, 0x5AC7, 0x62E7, 0x62C7, 0x62C6, 0x62E6, 0x6AE6,
-    0x62E6, 0x62E6, 0x62C6, 0x5AA6, 0x6B28, 0x6B27, 0x5265, 0x5AA6,
-    0x83C9, 0x83C9, 0x83E9, 0x8BEA, 0x83CA, 0x8BEA, 0x8BEA, 0x8BEA,
-    0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA,
-    0x8BEA, 0x83CA, 0x83CA, 0x8BEA, 0x8BEA, 0x8BEA, 0x83CA, 0x83C9,
-    0x7BA9, 0x83C9, 0x83C9, 0x83E9, 0x83A9, 0x83C9, 0x83C9, 0x942A,
-    0x944B, 0x944B, 0xA4AC, 0x9C8B, 0xA4CC, 0xACEC, 0xACEC, 0xAD0D,
-    0xACCC, 0xACCC, 0xACEC, 0xACEC, 0xACEC, 0xACEC, 0xACED, 0xACED,
-    0xA4CD, 0xB52E, 0xAD0D, 0xAD2D, 0xAD0D, 0xAD0D, 0xACCC, 0xACCC,
-    0xACEC, 0xACED, 0xACEC, 0xACED, 0xACCC, 0xACCC, 0xACAB, 0x9C6A,
-    0x942A, 0x5AC7, 0x942A, 0xA4AB, 0xA4CC, 0xACED, 0x9C6B, 0x83C9,
-    0x944A, 0x9C6B, 0x7BCA, 0x4205, 0x94CF, 0xC6B8, 0xCED9, 0xDF5B,
-    0xD71A, 0xD71A, 0xDF7C, 0xE7FF, 0xDF7C, 0xC677, 0xC677, 0xC677,
-    0xC698, 0xC657, 0xBE36, 0xDF7D, 0xD73C, 0xA595, 0xDF9E, 0xDF9E,
-    0xDF9D, 0xD77D, 0xDF9E, 0xDFDE, 0xDFBE, 0xDFBE, 0xE7FF, 0xE7DF,
-    0xEFFF, 0xEFFF, 0xE7FF, 0xE7BF, 0xE7DF, 0xDF9F, 0xDF9E, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFDF, 0xDFDF, 0xE7DF, 0xDFBF, 0xE7DF, 0xDFBF,
-    0xD79F, 0xD7BF, 0xD7BF, 0xAE9A, 0xC71D, 0xC71D, 0xC71D, 0xC73D,
-    0xC73D, 0xC75D, 0xC75D, 0xC73D, 0xCF5E, 0xB6DC, 0xAEBC, 0xAE9B,
-    0xA63A, 0xA65A, 0xA65A, 0x9E19, 0x9DF8, 0xA618, 0x9597, 0x8D76,
-    0x8D56, 0x9597, 0x9597, 0x9DB7, 0x9DB7, 0x9DB8, 0x95D8, 0x9DD8,
-    0xA619, 0x84F4, 0x428A, 0x428A, 0x3A6A, 0x42CB, 0x42CB, 0x42EB,
-    0x4B0C, 0x29E8, 0x3A49, 0x3A29, 0x2186, 0x3208, 0x29E7, 0x29E8,
-    0x2A08, 0x2A29, 0x21C7, 0x29E8, 0x1986, 0x1965, 0x3A06, 0x41E4,
-    0x4A25, 0x5266, 0x41C4, 0x62C7, 0x9C6B, 0x840A, 0x7369, 0x840A,
-    0x840B, 0x7BAA, 0x8C2B, 0x944B, 0x8C0B, 0x8C0B, 0x83CA, 0x946B,
-    0x944B, 0xA48C, 0xACCC, 0x9C8C, 0x946C, 0x9CAC, 0xA48C, 0x62A6,
-    0x62C6, 0x62A6, 0x6AE7, 0x6AE7, 0x7327, 0x7327, 0x7328, 0x7348,
-    0x62A6, 0x62C6, 0x7327, 0x7BA9, 0x4246, 0x2123, 0x2143, 0x2144,
-    0x29A5, 0x4246, 0x2984, 0x2944, 0x2964, 0x2943, 0x4205, 0x4A26,
-    0x4A06, 0x4225, 0x5B08, 0xA4AC, 0x8BE9, 0x83CA, 0x8BEA, 0x8C0A,
-    0x8C0A, 0x8C0A, 0x9C6C, 0x83C9, 0x9C6B, 0x8C0A, 0x8C0A, 0x9C4B,
-    0x83C9, 0x8BEA, 0x8BEA, 0x8BEA, 0x8BEA, 0x8C0A, 0x8C0A, 0x8C0A,
-    0x8C0A, 0x8C0A, 0x8BEA, 0x8C0A, 0x8BEA, 0x8BEA, 0x8BEA, 0x83E9,
-    0x83CA, 0x8BEA, 0x83EA, 0x8BEA, 0x8BCA, 0x8BEA, 0x940A, 0x940A,
-    0x8C0A, 0x8C2A, 0x8C0A, 0x8C0A, 0x944A, 0x946B, 0x944B, 0x8C2A,
-    0x8C0A, 0x7BC9, 0x7389, 0x7B89, 0x7389, 0x83E9, 0x9C6B, 0x942B,
-    0x8C2A, 0xACED, 0xACCC, 0xA4CC, 0xA4CC, 0x9C8B, 0x83EA, 0x8C0A,
-    0x8C0A, 0xA4AC, 0xACED, 0x9C8C, 0x8C2B, 0x83EA, 0x942A, 0x944B,
-    0x942A, 0x942B, 0x942B, 0x942B, 0x9C6B, 0x944B, 0x8C0A, 0x83A8,
-    0x7B88, 0x7368, 0x6B07, 0x6B07, 0x62C6, 0x7348, 0x7B89, 0x6B07,
-    0x83C9, 0x944B, 0x940A, 0x8BEA, 0x83A9, 0x7348, 0x7368, 0x7348,
-    0x83CA, 0x7BA9, 0x8C2C, 0x948E, 0x8C4C, 0x83A9, 0xA48B, 0x9C8B,
-    0x7B89, 0x83E9, 0xA4AC, 0xB570, 0xAD30, 0x8C0B, 0xB570, 0xB591,
-    0xB590, 0xB570, 0xB590, 0xB570, 0xB591, 0xB5B1, 0xBDB2, 0x7BEC,
-    0xADB5, 0xC679, 0xCF1C, 0xEFFF, 0xDFBF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xD77D, 0xD75C, 0xD75C, 0xD73B, 0xDFBE, 0xE7FF, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xE7DF, 0xE7BF, 0xE7BF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD77D, 0xD75D, 0xD77E,
-    0xD77E, 0xD77E, 0xD79E, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xD79E, 0xD79E, 0xD79E,
-    0xDFBF, 0xE7DF, 0xDFBF, 0xCF3D, 0xC71C, 0xC71D, 0xB69B, 0xBEFC,
-    0xAE9B, 0xC73D, 0xC71D, 0xAE9B, 0x7D36, 0x95F9, 0xA639, 0xAE7A,
-    0xAE5A, 0x95B8, 0x9598, 0xB69B, 0xA619, 0x95B8, 0x7472, 0x7C92,
-    0x5B8E, 0x536F, 0x5BCF, 0x1924, 0x2122, 0x39C4, 0x2963, 0x31A4,
-    0x2963, 0x39E4, 0x5265, 0x4A25, 0x5245, 0x4A05, 0x4205, 0x5A86,
-    0x62C7, 0x7369, 0x6B69, 0x6328, 0x5B49, 0x5B29, 0x8C0B, 0x7BCA,
-    0x7BA9, 0x7B89, 0x83C9, 0x8BEA, 0x83CA, 0x944B, 0x9C6B, 0x9C4B,
-    0x942B, 0x83CA, 0x9C4B, 0x9C4B, 0x7B89, 0x6328, 0x4A87, 0x4226,
-    0x4A66, 0x5AE7, 0x62E7, 0x6B07, 0x6B27, 0x8C0A, 0x7B88, 0x6B06,
-    0x6B07, 0x62C6, 0x5AA6, 0x62E6, 0x83A9, 0x7B68, 0x6B27, 0x7348,
-    0x7348, 0x7368, 0x7368, 0x7B68, 0x7368, 0x7B68, 0x7B68, 0x7B68,
-    0x8C0A, 0x8BEA, 0x83EA, 0x8BEA, 0x83EA, 0x83EA, 0x83CA, 0x7BA9,
-    0x83C9, 0x8BEA, 0x8C2B, 0x8C0A, 0x8C0A, 0x8BEA, 0x8C0A, 0x8C0A,
-    0x8BEA, 0x8BCA, 0x8C0A, 0x8BEA, 0x8BEA, 0x8C0A, 0x83A9, 0x7B89,
-    0x83CA, 0x7BA9, 0x7B89, 0x83C9, 0x83EA, 0x83C9, 0x83EA, 0x83A9,
-    0x7368, 0x83CA, 0x6B28, 0x7BA9, 0x7BA9, 0x83EA, 0x83EA, 0x946B,
-    0x8C0A, 0x942A, 0x83C9, 0x83C9, 0x83C9, 0x7BA9, 0x83CA, 0x8BEA,
-    0x8C0A, 0x83EA, 0x946B, 0x942B, 0x8C0A, 0x9C4B, 0x8BEA, 0x7B68,
-    0x7B48, 0x8389, 0x83A9, 0x83C9, 0x8BEA, 0x83CA, 0x942A, 0x9C6B,
-    0x9C6B, 0x8BEA, 0x62C7, 0x6B28, 0x6B28, 0x7B89, 0x8BEA, 0x940B,
-    0x62E7, 0x4A05, 0x62E7, 0x942A, 0x83A9, 0x8C0A, 0x83AA, 0x7349,
-    0x8BEA, 0x8BEA, 0x83A9, 0x8C0A, 0x8BEA, 0x9C6B, 0xACEC, 0xA4CC,
-    0x9C8B, 0xACED, 0xACED, 0xACCC, 0xACCC, 0xAD0D, 0xACCC, 0x8BE9,
-    0x6B07, 0x7368, 0x942A, 0x944A, 0x944B, 0x8C4A, 0x946B, 0x8C0B,
-    0x8C2B, 0x7BCA, 0x8C8E, 0xBE15, 0xBE14, 0xC634, 0xBE14, 0xBE14,
-    0xB570, 0xAD2E, 0xB54F, 0xACED, 0xBDD2, 0xAD72, 0xA553, 0xDF7D,
-    0xCF3C, 0xD75D, 0xE7DF, 0xE7DF, 0xE7FF, 0xDFBF, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9F, 0xDFBF, 0xDF9E, 0xE7DF, 0xEFFF, 0xDFBE, 0xDFBF, 0xE7DF,
-    0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF, 0xE7BF, 0xDFBF, 0xDF9E, 0xDF9E,
-    0xD79E, 0xDFBF, 0xDFBF, 0xD75E, 0xC6FC, 0xC71C, 0xB6BB, 0xC6FC,
-    0xD73D, 0xCEFC, 0xD73D, 0xA619, 0xB69B, 0xC71C, 0xCF3D, 0xAE7A,
-    0xAE7A, 0xA63A, 0x8D98, 0x8D35, 0x534E, 0x29E9, 0x428B, 0x4AAB,
-    0x4ACC, 0x4ACB, 0x21A7, 0x428A, 0x3A29, 0x3A49, 0x3228, 0x18E4,
-    0x1903, 0x29C5, 0x29A4, 0x29A4, 0x2963, 0x2143, 0x21C5, 0x32A8,
-    0x3247, 0x3A05, 0x942A, 0x8BC9, 0x8C0A, 0x83C9, 0x7348, 0x942A,
-    0xACCC, 0x9C4B, 0xACED, 0xB4ED, 0xA4AC, 0xA48B, 0xA4AC, 0x8C4B,
-    0x944B, 0x944B, 0x9C6B, 0xA48B, 0x940A, 0xACED, 0x8BE9, 0x83C9,
-    0x83CA, 0x8BEA, 0x8BEA, 0x83C9, 0x83A9, 0x7B89, 0x7B88, 0x7B89,
-    0x83C9, 0x7B88, 0x7368, 0x6B07, 0x5A85, 0x5AA6, 0x5AA6, 0x5AA6,
-    0x8C0A, 0x8C0A, 0x7368, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x6AE7, 0x7368, 0x7348, 0x7368, 0x7348, 0x7368, 0x7B68,
-    0x83EA, 0x83EA, 0x83C9, 0x7368, 0x7328, 0x62C7, 0x5266, 0x5266,
-    0x5286, 0x5266, 0x5AA6, 0x62C7, 0x5AA6, 0x5AA6, 0x6B27, 0x62E7,
-    0x62E7, 0x62E7, 0x5AA6, 0x62C6, 0x5AA6, 0x5AA6, 0x7348, 0x83A9,
-    0x7B68, 0x8C0A, 0x9C4B, 0x9C6B, 0x944B, 0x8C4C, 0x8C2B, 0x8C2B,
-    0x8C2B, 0x8C2B, 0x73AA, 0x6B49, 0x5AC8, 0x39C4, 0x10A2, 0x3A49,
-    0x3A6A, 0x3A49, 0x3A69, 0x29A6, 0x29C6, 0x3A28, 0x18E1, 0x4A25,
-    0x4A05, 0x5225, 0x7348, 0x944B, 0x8C2A, 0x9C6B, 0x9C8C, 0x940A,
-    0x83CA, 0x7349, 0x83CA, 0x9C4B, 0x942B, 0x8C0B, 0x83EA, 0x83CA,
-    0x944B, 0xACED, 0xACEC, 0xA4AC, 0xACCC, 0xACCC, 0xACEC, 0xACED,
-    0xACED, 0xACEC, 0xB50D, 0xACEC, 0xACCC, 0xA4CC, 0xACCC, 0x9C6B,
-    0x8C0A, 0x8C0A, 0x8C0A, 0x840A, 0x6B48, 0x83EA, 0x8C0B, 0x6329,
-    0x6349, 0x946C, 0x6328, 0x5AE8, 0x6348, 0x840A, 0x8C2A, 0xA48A,
-    0xACCB, 0xACCB, 0xACCB, 0xACCC, 0xACCB, 0xA48B, 0x842B, 0x6BCC,
-    0x4AC8, 0x844D, 0xCEB7, 0xCED9, 0xC657, 0xE79D, 0xEFFF, 0xE7FF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9F, 0xDFBF, 0xC6DB, 0x9D76, 0xE7BF, 0xDF9E, 0xC6DB,
-    0xDF9E, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDFBE, 0xE7BF, 0xDFBE, 0xDF9E, 0xDF9E,
-    0xDFBE, 0xDF9E, 0xDF7E, 0xCF3D, 0xCF1D, 0xDF7E, 0xE7BF, 0xD75E,
-    0xD77E, 0xD75D, 0xD73D, 0xE7BF, 0xC6FC, 0xBE9B, 0xD73D, 0xDF7E,
-    0xDF9F, 0xCEFC, 0xA5D9, 0xBE9B, 0xA619, 0x9DB7, 0x9DB8, 0x9DB8,
-    0x9D97, 0x532D, 0x31C5, 0x4246, 0x39E5, 0x2143, 0x08C2, 0x1964,
-    0x10E2, 0x5287, 0xACCC, 0xACCC, 0xACCC, 0x9C6B, 0x9C4A, 0xA46B,
-    0xACCC, 0xACED, 0x9C4B, 0x9C6B, 0xA4AC, 0x8C0A, 0x8BE9, 0x8BEA,
-    0x942B, 0x8C0A, 0x940A, 0xA48B, 0xAD0D, 0xA4CC, 0xAD0D, 0xB50E,
-    0xB52E, 0xB52E, 0xBD2E, 0xB52E, 0xB52E, 0xA4AD, 0x9C8C, 0xA4AC,
-    0xACED, 0x9C6C, 0x83C9, 0x6AE7, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x6B27, 0x6B07, 0x62C6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x5AA6, 0x5A85, 0x5AA6, 0x5AA5, 0x5AA6, 0x62C6, 0x5AC6,
-    0x62E7, 0x7348, 0x7348, 0x62A6, 0x62C7, 0x83EA, 0x8C0A, 0x940A,
-    0x942B, 0x942B, 0x7B68, 0x5A86, 0x62C6, 0x62C6, 0x5AA6, 0x62C6,
-    0x62E6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62A6,
-    0x62A6, 0x7B88, 0x6B08, 0x6B08, 0x6308, 0x4AA8, 0x2984, 0x2122,
-    0x2123, 0x1903, 0x29E7, 0x29E8, 0x3A49, 0x84D4, 0x8515, 0xAE9B,
-    0xAEDD, 0xAE9C, 0xAEBC, 0x9E3A, 0xAE7A, 0x95D8, 0x7493, 0x5BD0,
-    0x4B4F, 0x538F, 0x29A6, 0x2123, 0x2123, 0x4A46, 0x5AA7, 0x83AA,
-    0x9C4B, 0x942A, 0x8C0A, 0x83C9, 0x942B, 0x946B, 0xA48C, 0xA4CC,
-    0xA4CC, 0xA4CC, 0xA4CC, 0xAD0D, 0x9C6B, 0x9C6B, 0x9C6C, 0x9C8C,
-    0x9C8C, 0x946B, 0x840B, 0x9C8C, 0xB50D, 0xACEC, 0xB4ED, 0x83EA,
-    0x83CA, 0xA4AC, 0x7BAA, 0x7BCA, 0x948C, 0x9C8C, 0x9CAD, 0x73EB,
-    0x63AB, 0x4B2A, 0x3A89, 0x21C6, 0x430A, 0x4B4B, 0x4B0A, 0x63AB,
-    0x73EC, 0x73EC, 0x73EC, 0x73CB, 0x73EC, 0x6BEC, 0x432A, 0x6BCB,
-    0x844C, 0xAD0D, 0x944B, 0x6B69, 0x52A7, 0x73AC, 0x5B0B, 0x84B2,
-    0xC71C, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xC71C, 0xAE39, 0xDFBF, 0xDFBF, 0xC6DC,
-    0xDF9E, 0xE7DF, 0xDF9E, 0xDF9E, 0xDF9E, 0xE7DF, 0xDFBF, 0xE7DF,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9F,
-    0xDFBF, 0xE7DF, 0xE7FF, 0xE7DF, 0xE7FF, 0xDF7E, 0xCEFC, 0xBEBB,
-    0xDF9E, 0xDF9E, 0xE7BF, 0xE79E, 0xEFDF, 0xEFFF, 0xEFDF, 0xE77D,
-    0x9534, 0xA595, 0xCE98, 0xC656, 0xA552, 0x846E, 0xBDB2, 0xB571,
-    0xB571, 0xB571, 0x83EA, 0x7BA9, 0x7B89, 0x7B89, 0x7BCB, 0x738A,
-    0x6B69, 0xA4ED, 0xB50D, 0xACCC, 0xACCC, 0xACCC, 0xB4ED, 0xA4AC,
-    0xACCC, 0xA4AC, 0x83C9, 0x8BEA, 0x83C9, 0x9C6B, 0x9C6B, 0x9C6B,
-    0xA48C, 0xA4AC, 0x9C8C, 0xA48C, 0xACED, 0xA4CC, 0xACED, 0xA48C,
-    0x9C8C, 0xACCD, 0x944B, 0x9C6B, 0x83CA, 0x6B27, 0x7328, 0x7348,
-    0x7328, 0x7B68, 0x7348, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6,
-    0x7B89, 0x8C0A, 0x8C0A, 0x8C0A, 0x8BEA, 0x8C0A, 0x944A, 0x9C4B,
-    0x942A, 0x83A9, 0x7348, 0x62A6, 0x62C6, 0x6B07, 0x7348, 0x6B48,
-    0x3184, 0x2984, 0x2985, 0x31C6, 0x31C6, 0x2985, 0x2964, 0x2984,
-    0x2985, 0x31C5, 0x31E6, 0x39E6, 0x3A07, 0x31E6, 0x31C6, 0x3A07,
-    0x3A07, 0x39E6, 0x2166, 0x3B0E, 0x4B6F, 0x6C11, 0x63D1, 0x63D1,
-    0x63D0, 0x6C73, 0xAEBC, 0xB6DD, 0xC73E, 0xD7DF, 0xD7DF, 0xCF7F,
-    0xCF7E, 0xCF7E, 0xC77E, 0xCF9F, 0xCFBF, 0xCF9F, 0xD7FF, 0xC79F,
-    0xC79F, 0xBF3D, 0xB69A, 0x6411, 0x3ACC, 0x4A88, 0x62C7, 0x8BEA,
-    0xACED, 0xACEC, 0xA4CC, 0xA4AC, 0xA4CC, 0xACED, 0xACEC, 0xACEC,
-    0xACEC, 0xAD0D, 0xACED, 0x7389, 0x6329, 0x6308, 0x7BAA, 0x9C8C,
-    0x9C8C, 0x6B8A, 0x3A67, 0x636A, 0x844B, 0x8C4B, 0x8C6C, 0x5308,
-    0x5329, 0x5309, 0x4B09, 0x3268, 0x3247, 0x3A67, 0x4B09, 0x3226,
-    0x3247, 0x2207, 0x2185, 0x21E7, 0x21C7, 0x1103, 0x21C6, 0x2A48,
-    0x1965, 0x1145, 0x0903, 0x08C3, 0x10E3, 0x1104, 0x1986, 0x6BCC,
-    0x73EC, 0x6BCC, 0x742F, 0x534D, 0x532C, 0x8492, 0x7C72, 0x7C72,
-    0xBEBA, 0xE7DF, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFFF, 0xDF9E, 0xDFBF, 0xF7FF,
-    0xE79E, 0xD73D, 0xE7DF, 0xDFBF, 0xDFBF, 0xB658, 0xC6BA, 0xB639,
-    0xEFFF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7BF, 0xDF7E,
-    0xCF1C, 0xA5B6, 0x9D33, 0xAD93, 0xA573, 0xA573, 0x73EE, 0x844E,
-    0x9D10, 0xAD51, 0xAD72, 0xAD72, 0xAD51, 0xAD51, 0xA530, 0x9CCE,
-    0x8C2B, 0x8C2A, 0x9C6B, 0x9C4A, 0x9C6B, 0xA4CC, 0xA4AC, 0xA4CC,
-    0xACCC, 0xA4AC, 0xACED, 0xACCC, 0xA4AC, 0x9CAC, 0x5B6A, 0x4B29,
-    0x638A, 0x840B, 0x946C, 0xA4AC, 0x9C8C, 0x9CAC, 0xA4AC, 0xB50D,
-    0xB4ED, 0xACCC, 0xACEC, 0xACCC, 0xA4CC, 0xACCC, 0xACCC, 0xAD0D,
-    0xACED, 0xACED, 0xACED, 0xACED, 0xACEC, 0xA4CC, 0x8C0A, 0x8C0A,
-    0x7B68, 0x7348, 0x62C6, 0x62C6, 0x5AC6, 0x5A86, 0x5AA6, 0x5A86,
-    0x6B07, 0x5AA6, 0x5A85, 0x5AC6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AC6,
-    0x62E7, 0x6B07, 0x6B07, 0x6B07, 0x6B07, 0x6B07, 0x6B07, 0x6B07,
-    0x6AE7, 0x5AA6, 0x5265, 0x6B07, 0x39C5, 0x2103, 0x2102, 0x18E3,
-    0x10A3, 0x4289, 0x42CA, 0x73EE, 0x63AE, 0x63CE, 0x6BEE, 0x6BEE,
-    0x63CE, 0x84B1, 0xA594, 0xA574, 0xA5B4, 0x9533, 0x9D74, 0x9554,
-    0x9574, 0x9533, 0xADF5, 0xB678, 0xBE78, 0xC6B8, 0xC698, 0xC6B8,
-    0xC6B8, 0xBE98, 0xBE77, 0xBE77, 0xC677, 0xBE57, 0xBE57, 0xBE57,
-    0xBE57, 0xBE56, 0xBE36, 0xBE37, 0xBE56, 0xBE36, 0xB636, 0xBE57,
-    0xBE35, 0x7BCB, 0x7BEB, 0xAD2F, 0xA50F, 0xACED, 0xB50D, 0x9C8B,
-    0xA4CC, 0x9C8C, 0x9C8C, 0xACED, 0x9C8C, 0x946C, 0x946C, 0x840B,
-    0x840B, 0x842B, 0x6369, 0x3267, 0x4B0A, 0x534A, 0x532A, 0x536A,
-    0x534A, 0x534A, 0x4309, 0x3AC8, 0x3AC8, 0x3AA8, 0x3AA8, 0x4309,
-    0x2A27, 0x1985, 0x1144, 0x1964, 0x0861, 0x10E3, 0x2A08, 0x1945,
-    0x428A, 0x3A8A, 0x1104, 0x2208, 0x32AB, 0x326A, 0x3ACB, 0x430C,
-    0x328A, 0x5B8E, 0x8CD3, 0x7471, 0x4B0C, 0x430C, 0x7CD3, 0x84F4,
-    0xBEBB, 0x9597, 0xBEBB, 0xCF3D, 0xCF5D, 0xEFFF, 0xEFFF, 0xEFFF,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7DF, 0xDFDF, 0xE7DF, 0xDFDF, 0xE7DF, 0xDFBE, 0xADF7,
-    0xCF1B, 0x7C50, 0xB636, 0xD71A, 0xCED9, 0x844D, 0x9CEF, 0x94D0,
-    0xCEFA, 0xCEB8, 0xCED9, 0xCED8, 0xCED9, 0xD6D9, 0x9D31, 0xB570,
-    0x8C6C, 0x7BA9, 0x83A9, 0x8BE9, 0x7367, 0x7347, 0x6B07, 0x7B88,
-    0x7367, 0x7B88, 0x7B68, 0x7BA8, 0x7B88, 0x7B88, 0x7B68, 0x83C9,
-    0x7368, 0x6B48, 0x6369, 0x5B29, 0x4AE8, 0x42E8, 0x4B08, 0x4B09,
-    0x4B09, 0x4B29, 0x4B29, 0x534A, 0x4309, 0x534A, 0x430A, 0x42EA,
-    0x3AA8, 0x5309, 0x5B4A, 0x5309, 0x42A8, 0x4B09, 0x42C8, 0x7BCA,
-    0xA4AC, 0xACED, 0xA4CC, 0xACCD, 0xACCD, 0xACCD, 0xAD0D, 0x946B,
-    0xA4CC, 0xACED, 0xACEC, 0xACEC, 0xACED, 0xACED, 0xA4CD, 0x9C8C,
-    0xA4AC, 0xA48C, 0xACCC, 0xACED, 0x8C2B, 0x3A05, 0x5B09, 0x4A67,
-    0x4A26, 0x7349, 0x83A9, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5AA6, 0x62A6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5AA6, 0x62E7, 0x6307, 0x5287, 0x738A, 0x7B89, 0x7BA9,
-    0xA4AD, 0xAD0D, 0xA4CC, 0xA4CC, 0x9C6B, 0xACEC, 0xACED, 0xAD0D,
-    0xAD0D, 0xACED, 0xACEC, 0xACEC, 0xACED, 0xA4AC, 0xACED, 0xACCC,
-    0xACCC, 0xA4CC, 0xA4CC, 0xACCC, 0xACCC, 0xA4AC, 0xA4AB, 0xA48B,
-    0xA4AB, 0xA4AB, 0xA4AB, 0xA4AB, 0xA4AB, 0xA4AC, 0xA4AC, 0xA4CC,
-    0xA4AC, 0xA4AB, 0xA4AB, 0xA4AB, 0xA48B, 0xA4AB, 0xA48B, 0xA4AC,
-    0xA4AC, 0xACCC, 0xA4AC, 0xA48B, 0xA4AC, 0x944B, 0x9C8C, 0x7BCA,
-    0x6BAA, 0x6369, 0x6BAA, 0x6BAA, 0x5B69, 0x4AC8, 0x42C8, 0x42E9,
-    0x42C8, 0x3AC8, 0x4309, 0x4309, 0x29E6, 0x21C5, 0x21A5, 0x2185,
-    0x1985, 0x1944, 0x1945, 0x1965, 0x1944, 0x1944, 0x29A6, 0x1945,
-    0x29C7, 0x21A7, 0x3229, 0x21C8, 0x2A09, 0x3AAB, 0x4BB0, 0x7D35,
-    0x6C93, 0x7D35, 0x7D15, 0x8D77, 0x9DD8, 0xC6FC, 0xB69A, 0xBEBB,
-    0xBEBB, 0xD77E, 0xF7FF, 0xE7FF, 0xD79E, 0xC71D, 0xCF5D, 0xD77E,
-    0xE7DF, 0xE7FF, 0xE7DF, 0xE7DF, 0xDFBF, 0xD79E, 0xDF9E, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xE7DF,
-    0xC6BA, 0xE7FF, 0xD73B, 0xB616, 0xC699, 0xDF7D, 0xCEFA, 0xCEB9,
-    0xA552, 0xAD93, 0x8CB1, 0xADD6, 0xBE58, 0xBE78, 0x9CCF, 0x840A,
-    0xAD2F, 0xA4ED, 0x946B, 0xA4ED, 0xA4CC, 0x9C8B, 0xA4CC, 0x9C8B,
-    0x9C6B, 0x9C8B, 0x7BC9, 0x8C0A, 0x83C9, 0x946A, 0x7BA9, 0x83A9,
-    0x942A, 0xA48C, 0x8C0A, 0x83C9, 0x83CA, 0x83CA, 0x83C9, 0x7388,
-    0x8C0A, 0x946B, 0x840A, 0x6B8A, 0x73CB, 0x6B89, 0x946C, 0x5B69,
-    0x3AC8, 0x42E9, 0x3AC9, 0x4309, 0x4309, 0x4309, 0x42E9, 0x42E9,
-    0x42C8, 0x2A06, 0x21A5, 0x2185, 0x21C5, 0x08C2, 0x10C2, 0x10E3,
-    0x10C2, 0x08A2, 0x18E3, 0x21C6, 0x430A, 0x536B, 0x3AE9, 0x638A,
-    0x844C, 0x638A, 0x638A, 0x5B6A, 0x638A, 0x63AB, 0x63CB, 0x7C2B,
-    0x8C6C, 0xA4CD, 0x948C, 0x9CAC, 0x7BEB, 0x7BEA, 0x740B, 0x8C4C,
-    0xACED, 0x9C8C, 0x946C, 0x946C, 0x42E8, 0x1103, 0x08E3, 0x3288,
-    0x1985, 0x29A5, 0x5AC7, 0x52A6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AC6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x942A, 0x8BC9, 0x6B07,
-    0x7B88, 0x942A, 0xA4AC, 0x9C4B, 0x83C9, 0xA48C, 0xA48B, 0xACCC,
-    0x9C6B, 0x944B, 0xA4CC, 0xACCC, 0x946B, 0x8C0A, 0x942B, 0x942A,
-    0x944B, 0x946B, 0xACCC, 0xACCC, 0xACEC, 0xACED, 0xACED, 0xACED,
-    0xA4CC, 0xACCC, 0xACCC, 0xA4CC, 0xA4CC, 0xA4CD, 0xACCC, 0xB50D,
-    0x9C8C, 0x8C4B, 0x840A, 0x946B, 0x946B, 0xA4AC, 0xAD0D, 0xACED,
-    0xAD0D, 0xACED, 0xACEC, 0xA4CC, 0xACED, 0x7BA9, 0x9C8C, 0xA4CC,
-    0x8C6C, 0x6BAA, 0x6BAA, 0x7BEB, 0x636A, 0x638A, 0x5329, 0x4AA8,
-    0x4AC8, 0x2A06, 0x29C5, 0x4287, 0x5308, 0x29E6, 0x29E6, 0x42A8,
-    0x42A8, 0x29A5, 0x2185, 0x2144, 0x0062, 0x1145, 0x3229, 0x2187,
-    0x21A8, 0x42ED, 0x4B2E, 0x4B4E, 0x4B2E, 0x4B2E, 0x6C31, 0x4B4E,
-    0x9596, 0xB69A, 0xCF5D, 0xB65A, 0xB69B, 0xCF3D, 0xBEDC, 0xD79E,
-    0xC71C, 0xCF7E, 0xDFBE, 0xE7FF, 0xE7FF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xE7BF, 0xDF9E, 0xDF9F, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDF9F, 0xDFBE, 0xDFBF, 0xDFBE, 0xDFBF, 0xD79E, 0xD77E,
-    0xE7DF, 0xE7FF, 0xE7FF, 0xDFBF, 0xDF9D, 0x9533, 0xC6FA, 0xB5D5,
-    0x7C2F, 0xD73C, 0x846E, 0x5B49, 0x7C4E, 0x634A, 0x42A7, 0x42C8,
-    0x4266, 0x6B49, 0x83C9, 0x6B48, 0x7368, 0x944A, 0x9C8B, 0xAD0C,
-    0xA4CB, 0x944A, 0x8C2A, 0x9C8B, 0x9C8B, 0x8C0A, 0x942A, 0x9C6B,
-    0x944B, 0xA4CC, 0x942A, 0x83C9, 0x8C0A, 0x8BEA, 0x7368, 0x5AA6,
-    0x7368, 0x7368, 0x7348, 0x62E7, 0x5AA6, 0x6B07, 0x8BEA, 0x6307,
-    0x6B68, 0x6369, 0x5308, 0x42A8, 0x3A88, 0x3A88, 0x636A, 0x3A88,
-    0x3288, 0x3246, 0x2A05, 0x1102, 0x10C2, 0x1903, 0x2144, 0x1923,
-    0x1923, 0x0000, 0x29C7, 0x21A7, 0x3A6A, 0x63D0, 0x63F0, 0x7CD5,
-    0x5BD0, 0x2A29, 0x21A7, 0x2A08, 0x3207, 0x1944, 0x3227, 0x42E9,
-    0x2164, 0x0881, 0x08A2, 0x2984, 0x08A2, 0x08C2, 0x08C2, 0x31A4,
-    0x52A7, 0x4AA8, 0x2A26, 0x5309, 0x634A, 0x840B, 0x6BAA, 0x7C2B,
-    0x6B49, 0x52C7, 0x4266, 0x4287, 0x3A88, 0x3206, 0x3A26, 0x5349,
-    0x6BEB, 0x4266, 0x29A4, 0x52C7, 0x5AA6, 0x62C6, 0x5AC6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62E6, 0x83C9, 0x6B27,
-    0x62E6, 0x6B07, 0x6AE6, 0x62E6, 0x5AA6, 0x5AA6, 0x62A6, 0x62C6,
-    0x62C6, 0x62C6, 0x6B07, 0x6AE7, 0x6B07, 0x6B28, 0x7368, 0x8C0A,
-    0x944B, 0xA4CC, 0xACEC, 0xACCC, 0xA4CC, 0xACCC, 0xACED, 0xACED,
-    0xACED, 0xACED, 0xA4CC, 0xACEC, 0xACEC, 0xACEC, 0xACED, 0x842B,
-    0x9CAC, 0x946B, 0x7C0A, 0x7BC9, 0x8C4B, 0x52E8, 0x5B49, 0x7C2B,
-    0x7C0B, 0xA4ED, 0xB52D, 0xAD2D, 0x7C0B, 0x5B69, 0x73EB, 0x73EB,
-    0x3A67, 0x3A88, 0x21C5, 0x3A47, 0x42A8, 0x2185, 0x18E3, 0x1924,
-    0x29A5, 0x0021, 0x1924, 0x3228, 0x3207, 0x1925, 0x1925, 0x1925,
-    0x29A6, 0x3A8B, 0x324A, 0x3A8B, 0x7C93, 0x8515, 0x5BD1, 0x8D36,
-    0x8515, 0xAE5A, 0xCF5D, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D, 0xCF5D,
-    0xD77E, 0xE7FF, 0xE7BF, 0xE7FF, 0xE7FF, 0xDFDF, 0xDFDF, 0xDFBF,
-    0xDFDF, 0xDFBE, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xC697, 0xD75B, 0xE7BE, 0x94F1,
-    0xD719, 0xB637, 0xD6F9, 0xBDD3, 0x9CCE, 0x946C, 0xA4CD, 0x946B,
-    0x4AA7, 0x4287, 0x4AC7, 0x3247, 0x3247, 0x3A87, 0x5349, 0x5329,
-    0x5349, 0x5329, 0x840B, 0x9C8C, 0x8C2B, 0x7BCA, 0x9C8C, 0x944B,
-    0x8C2A, 0x83EA, 0x7389, 0x7368, 0x83C9, 0x83C9, 0x942A, 0x83EA,
-    0x7BA9, 0x8C0A, 0x944A, 0xA48B, 0x9C8B, 0x944B, 0x7BA9, 0x7BA9,
-    0x7B89, 0x6B07, 0x6B28, 0x7368, 0x6B08, 0x6B08, 0x6307, 0x6B48,
-    0x5286, 0x2963, 0x3A05, 0x3A05, 0x39E6, 0x18E2, 0x0861, 0x0000,
-    0x0882, 0x3A6A, 0x3A8B, 0x3AAB, 0x426A, 0x5B6E, 0x8D14, 0x84D3,
-    0x8514, 0x84D4, 0xA65B, 0xB71E, 0xB6FE, 0xC75F, 0xBF3E, 0xBF1E,
-    0xB6BD, 0xAEBC, 0xAE7B, 0xA63A, 0x8D15, 0x4AEC, 0x42AB, 0x430D,
-    0x3A8B, 0x3A6A, 0x3A6B, 0x42AB, 0x3A8B, 0x3A8B, 0x3A4A, 0x3A4A,
-    0x2985, 0x3184, 0x18E3, 0x3184, 0x62E7, 0x5AA6, 0x5AA6, 0x5AA6,
-    0x5286, 0x5AA6, 0x5AA6, 0x4A66, 0x52A6, 0x5AC7, 0x62E7, 0x5AC6,
-    0x5AA6, 0x62E6, 0x62E7, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AC6,
-    0x5AC6, 0x5AC6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA5,
-    0x7348, 0x7348, 0x7328, 0x6B28, 0x7328, 0x7348, 0x7348, 0x7348,
-    0x7348, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5A86, 0x5AA6,
-    0x62C6, 0x62A6, 0x62C6, 0x6B07, 0x8BEA, 0x8BEA, 0x83EA, 0xA4AC,
-    0x9C8C, 0xA4AC, 0x944B, 0x9C8B, 0xA4CC, 0xACCC, 0xACEC, 0xAD0D,
-    0x9CAC, 0x9C8C, 0xAD0D, 0x946B, 0x8C2B, 0x946C, 0x6BAA, 0x638A,
-    0x5B4A, 0x6BAA, 0x5329, 0x4AE9, 0x5B49, 0x534A, 0x1123, 0x3A26,
-    0x42C8, 0x4267, 0x4AC7, 0x4A87, 0x1943, 0x21A5, 0x2985, 0x2123,
-    0x0020, 0x1903, 0x1966, 0x1945, 0x3A28, 0x1924, 0x1946, 0x3229,
-    0x42CC, 0x430D, 0x4B2E, 0x63F0, 0x6411, 0x4B4E, 0x63F0, 0x63D0,
-    0x6C32, 0xAE5A, 0xB69A, 0x9576, 0x84F4, 0x84F5, 0x84D4, 0xE7DF,
-    0xE7FF, 0xE7DF, 0xDFDF, 0xE7DF, 0xDFDF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xDFBF, 0xDF9E, 0xDFBF, 0xDFBE, 0xDF9E, 0xDF9F, 0xDF9F, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7FF, 0xDF9E, 0xCF1B,
-    0xD73B, 0xBE56, 0xDFDE, 0xC655, 0xB570, 0xAD0E, 0x9CEF, 0x9CCC,
-    0x9CAB, 0x5B07, 0x8C6B, 0x8C2B, 0x944B, 0x7389, 0xA4AC, 0x83A9,
-    0x7BA9, 0x7389, 0x5B08, 0x5B29, 0x6349, 0x6B69, 0x8C0B, 0x7BC9,
-    0x73A9, 0x73CA, 0x5B29, 0x4246, 0x4A67, 0x2184, 0x4A46, 0x7B89,
-    0x62E8, 0x7BCA, 0x7389, 0x73A9, 0x6328, 0x5B08, 0x8C0A, 0x7BA9,
-    0x83C9, 0x83C9, 0x83E9, 0x944B, 0x8C0A, 0x9C6B, 0x944B, 0x7BA9,
-    0x944A, 0x7BA9, 0x8C0A, 0x7B68, 0x7348, 0x7B88, 0x7368, 0x7BA9,
-    0x7348, 0x6B07, 0x83A9, 0x7B68, 0x7369, 0x7328, 0x5266, 0x5A86,
-    0x6B6A, 0x7C70, 0x7C90, 0x84D1, 0x9DB6, 0x536D, 0x6C0E, 0x6C0E,
-    0x6C0F, 0xA618, 0xA639, 0xA5F8, 0xAE39, 0xBF1E, 0xB6FE, 0xB6FE,
-    0xB6FE, 0xBF1E, 0xC75F, 0xB6BC, 0x95B6, 0xA5D7, 0xAE39, 0x7CF4,
-    0x95D7, 0xA65A, 0x9E19, 0xAE7A, 0xB6BB, 0xA5F7, 0x8CB0, 0x94F1,
-    0x6B69, 0x62E7, 0x5AC7, 0x5286, 0x5AA6, 0x5AA6, 0x5AC6, 0x62C6,
-    0x62E6, 0x62E7, 0x62E7, 0x62E7, 0x62E7, 0x62E7, 0x62E7, 0x6307,
-    0x6307, 0x62E6, 0x62E6, 0x62E7, 0x6B07, 0x62E7, 0x62C6, 0x62C6,
-    0x5AC6, 0x5AA6, 0x6307, 0x83C9, 0x7B68, 0x7B68, 0x7368, 0x7327,
-    0x6B07, 0x62E7, 0x6AE7, 0x6AE7, 0x62E7, 0x6B07, 0x6AE7, 0x6AE7,
-    0x5A86, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6, 0x6B28, 0x62C7,
-    0x5A86, 0x6B07, 0x62E7, 0x7348, 0x83C9, 0x83EA, 0x8BEA, 0x944B,
-    0x8C2A, 0x9C6B, 0x8BEA, 0x9C6B, 0xACEC, 0x9C8B, 0xACEC, 0xA4CD,
-    0x6BEB, 0x536A, 0x6BEC, 0x3A88, 0x21E7, 0x1103, 0x0881, 0x10C2,
-    0x1924, 0x21A6, 0x2A07, 0x1104, 0x1903, 0x2164, 0x0861, 0x0882,
-    0x1924, 0x10C3, 0x0082, 0x08C3, 0x10C3, 0x18E4, 0x3209, 0x1925,
-    0x2166, 0x3A6B, 0x4B2E, 0x430D, 0x4B4E, 0x4B0D, 0x3ACC, 0x5BF0,
-    0x9DD8, 0xCF3D, 0xBEDB, 0xD75D, 0xD77E, 0x8514, 0x9D96, 0xBE9A,
-    0xE7DF, 0xE7FF, 0xE7FF, 0xDFBF, 0xCF5D, 0xCF3D, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xCF7E, 0xC73D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xCF3C, 0xCEFA, 0xC635, 0xAD2F,
-    0xA50F, 0x948D, 0x9D0F, 0x948C, 0xA4AC, 0xA4AC, 0x8C2A, 0x8C4B,
-    0x8C0A, 0x7BEB, 0x5B6A, 0x42E8, 0x9CAC, 0x83EA, 0x946C, 0xA4AC,
-    0x944B, 0x8C2B, 0x7389, 0x6328, 0x7368, 0x7B88, 0x83C9, 0x8C0A,
-    0x73A9, 0x6B69, 0x52C8, 0x29A4, 0x2143, 0x39C5, 0x31A4, 0x2123,
-    0x3184, 0x4A46, 0x7B89, 0x6B48, 0x3A25, 0x1923, 0x5AC7, 0x7BC9,
-    0x9C8B, 0xACCC, 0x5286, 0x6308, 0x6B28, 0x946B, 0x9C8C, 0x944B,
-    0xACEC, 0x9C6B, 0x944B, 0x946B, 0x9C8B, 0x9C8B, 0x946B, 0x9C6B,
-    0x8C2A, 0x946B, 0x7BA8, 0x7368, 0x7348, 0x7B89, 0x83C9, 0x83C9,
-    0x7368, 0x7348, 0x7BA9, 0x7368, 0x4A66, 0x4266, 0x4A66, 0x4A65,
-    0x52A6, 0x5AC6, 0x5AA6, 0x5286, 0x52A8, 0x7C91, 0x7C91, 0x7C70,
-    0x8CB1, 0x8490, 0x8490, 0x73AB, 0x5265, 0x7348, 0x62E6, 0x62E7,
-    0x6B28, 0x5AC6, 0x7368, 0x8BEA, 0x83A9, 0x942A, 0x7BA8, 0x62C6,
-    0x62A6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6, 0x62E7, 0x4A45,
-    0x4204, 0x39A3, 0x39A3, 0x39A3, 0x3182, 0x2942, 0x2942, 0x2922,
-    0x2922, 0x39C5, 0x3184, 0x2102, 0x20E2, 0x2984, 0x3A67, 0x3A67,
-    0x5AA6, 0x5AC6, 0x5AA6, 0x8BE9, 0xACEC, 0x83A9, 0x83C9, 0x8BEA,
-    0x8C0A, 0x8BEA, 0x8C0B, 0x8C0A, 0x8C0A, 0x942B, 0x9C6B, 0x9C6C,
-    0x83A9, 0x83C9, 0x83C9, 0x7B89, 0x62C6, 0x6B07, 0x7B68, 0x62C6,
-    0x5AA6, 0x6B07, 0x6B27, 0x83C9, 0xACED, 0xACED, 0xACED, 0xACED,
-    0xACED, 0xACEC, 0xACEC, 0xA4AC, 0x7368, 0x6BAA, 0x846C, 0x3AE9,
-    0x2A27, 0x29E6, 0x1985, 0x2A08, 0x2165, 0x1925, 0x1925, 0x29A7,
-    0x4AEC, 0x42EC, 0x42CC, 0x3A8B, 0x3A8B, 0x42AC, 0x42CC, 0x42EC,
-    0x4B2D, 0x4B2D, 0x7472, 0x4B4E, 0x5BD0, 0x63F0, 0x5B8F, 0x8515,
-    0x9DB7, 0xD77E, 0xC71D, 0xB67A, 0xB639, 0xC6BB, 0x9DB7, 0xD77E,
-    0xE7FF, 0xDFDF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD77E, 0xDF9E,
-    0xDFBF, 0xDF9E, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xD79E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xB637, 0x9511, 0x9CEE, 0x8C6B, 0x8C6C,
-    0x4AA7, 0x2164, 0x3183, 0x5AE7, 0x7389, 0x842A, 0x83EA, 0x6B89,
-    0x73A9, 0x4AC8, 0x534B, 0x4B2A, 0x946C, 0x7C0B, 0x5349, 0x5B08,
-    0x6349, 0x946C, 0x8C2A, 0x8C2B, 0x840A, 0x7BCA, 0x944B, 0x9C6B,
-    0x83EA, 0x7389, 0x83EA, 0x7C0B, 0x7C2C, 0x7C2B, 0x8C6C, 0x7BEA,
-    0x7348, 0x7369, 0x7BCA, 0x73A9, 0x73AA, 0x5B08, 0x08C1, 0x3A66,
-    0x7BA9, 0xACEC, 0x5AA7, 0x7B8A, 0x7389, 0x7389, 0x7BA9, 0x41E4,
-    0x738A, 0x6B69, 0x6328, 0x944A, 0x946B, 0x9CCC, 0x9C6B, 0x7BA9,
-    0x6B48, 0xACEC, 0x7BA9, 0x9C8B, 0x7389, 0x6307, 0x83A9, 0x8C0A,
-    0x944A, 0x7BA9, 0x7BA9, 0x7B89, 0x6B28, 0x6307, 0x7B89, 0x7B89,
-    0x7BA9, 0x7BA9, 0x8C0A, 0x7389, 0x6B49, 0x3A67, 0x42A7, 0x4AA7,
-    0x6307, 0x62E6, 0x7347, 0x6B27, 0x7369, 0x7368, 0x7368, 0x7BC9,
-    0x7389, 0x7389, 0x8C0A, 0x83C9, 0x7BA8, 0x944A, 0x6B07, 0x62C6,
-    0x62C6, 0x62A6, 0x5AA6, 0x5A86, 0x5AA6, 0x39E5, 0x2122, 0x0000,
-    0x3186, 0x634D, 0x5B0D, 0x52CC, 0x5AEC, 0x5AEC, 0x5AEC, 0x52CB,
-    0x632D, 0x8CD4, 0x10A3, 0x18E2, 0x2943, 0x31A5, 0x3AA8, 0x3A87,
-    0x62E7, 0x62C6, 0x5285, 0x7368, 0x942A, 0x7B89, 0x8BEA, 0x942A,
-    0x942A, 0x942B, 0x7389, 0x6B28, 0x7348, 0x7B89, 0x6B27, 0x7348,
-    0x7348, 0x83C9, 0xACCC, 0xA4AC, 0xA48C, 0x946B, 0x8C0A, 0x942A,
-    0x942A, 0x9C4B, 0xA4AC, 0x9C8C, 0xACCC, 0xA4CC, 0xACCC, 0xACEC,
-    0xA4CC, 0x9C8B, 0xA4CC, 0x6B89, 0x73CA, 0x4B2A, 0x1985, 0x21A6,
-    0x10A2, 0x10E4, 0x532D, 0x5B6E, 0x63F0, 0x63F0, 0x63D0, 0x6C10,
-    0x7492, 0x74B3, 0x8D55, 0xB67A, 0x9DB7, 0x9D97, 0xC6DB, 0xBE9A,
-    0xB67A, 0xB69A, 0xC6FC, 0x9597, 0xBE7A, 0xAE39, 0xB659, 0xDF9E,
-    0xE7FF, 0xDF9E, 0xDFBF, 0xDFDF, 0xE7DF, 0xE7DF, 0xE7FF, 0xDFBF,
-    0xDF9E, 0xDF9E, 0xDFBE, 0xDFBF, 0xDF9E, 0xDFBE, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xEFFF, 0xADB4, 0x4226, 0x5309, 0x3AA9, 0x21E6,
-    0x4B2B, 0x42EA, 0x6BAB, 0x5B6B, 0x63AB, 0x7C2C, 0x3A68, 0x3207,
-    0x4AE9, 0x1944, 0x3207, 0x4B2A, 0x3A47, 0x4288, 0x52E8, 0x1944,
-    0x1985, 0x3206, 0x42A8, 0x4B09, 0x3267, 0x21E6, 0x4AC8, 0x6349,
-    0x7349, 0x6328, 0x4AC8, 0x5B49, 0x5B8A, 0x3AC8, 0x4309, 0x3AA8,
-    0x4AE8, 0x4AE8, 0x4AC8, 0x6B68, 0x7C0A, 0x7C0A, 0x6349, 0x6B69,
-    0x5AC7, 0x7369, 0x6328, 0x4A66, 0x4246, 0x4A67, 0x5AA7, 0x4A05,
-    0x4246, 0x6B69, 0x9CCC, 0x8C2A, 0x42A7, 0x63AA, 0x9C8B, 0x52A7,
-    0x4266, 0x7389, 0x7BCA, 0xA4AB, 0x6B48, 0x3A46, 0x8C4B, 0x8C2B,
-    0x8C4B, 0x948C, 0x9CAB, 0x8C0A, 0x6B48, 0x7BA9, 0x7368, 0x83C9,
-    0x83C9, 0x7BA9, 0x7BEA, 0x5329, 0x3AA8, 0x42E9, 0x42E9, 0x4309,
-    0x4B09, 0x6B69, 0x7B89, 0x6B49, 0x6B69, 0x6B28, 0x7B89, 0x6B48,
-    0x7389, 0x7BC9, 0x7389, 0x6B69, 0x7368, 0x62E6, 0x3183, 0x2943,
-    0x2963, 0x2143, 0x2123, 0x1903, 0x2103, 0x2123, 0x0041, 0x0861,
-    0x2165, 0x4228, 0x9D15, 0xA556, 0x8CB3, 0x8CD3, 0x9D35, 0x840E,
-    0x840D, 0x6329, 0x4205, 0x6B07, 0x7368, 0x7348, 0x7327, 0x6B27,
-    0x2943, 0x52C7, 0x6308, 0x4225, 0x7368, 0x8BEA, 0x6B28, 0x6B48,
-    0x62E7, 0x52A7, 0x52A7, 0x4A66, 0x4246, 0x62E7, 0x83EA, 0x7348,
-    0x83CA, 0x7368, 0x7347, 0x6B47, 0x7B88, 0x8C0A, 0x8C0A, 0x942A,
-    0x83A9, 0x83EA, 0x942B, 0x8C0A, 0xA48C, 0x9C6B, 0x944B, 0x944B,
-    0xA4AC, 0x9C8B, 0xACED, 0x6349, 0x73EB, 0x3A67, 0x0000, 0x2A08,
-    0x32CC, 0x538E, 0x63EF, 0x7451, 0x9D96, 0x9534, 0xA5B6, 0x9D34,
-    0xBE9A, 0xCF3C, 0xDFFF, 0xDFDF, 0xDFDF, 0xE7DF, 0xE7DF, 0xE7DF,
-    0xDFDF, 0xDFDF, 0xD79E, 0xE7DF, 0xE7DF, 0xE7DF, 0xE7FF, 0xDFBF,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xA5D8, 0x7472, 0xC6FC, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xC6BA, 0x3A49, 0x0062, 0x29E7, 0x21A6,
-    0x1104, 0x1944, 0x2165, 0x1103, 0x1103, 0x10E3, 0x1924, 0x1924,
-    0x1924, 0x10C2, 0x0000, 0x08A2, 0x1944, 0x10E3, 0x3A06, 0x3227,
-    0x08C2, 0x08E3, 0x1144, 0x19C6, 0x1944, 0x1944, 0x2A48, 0x21E6,
-    0x4288, 0x63CC, 0x2247, 0x2A88, 0x3B2A, 0x4B4A, 0x4309, 0x3AC9,
-    0x3AA8, 0x3AA8, 0x5B4A, 0x638A, 0x63AB, 0x5B6A, 0x636A, 0x73CB,
-    0x42A8, 0x52C8, 0x5308, 0x42A8, 0x42C9, 0x3207, 0x31A5, 0x29C5,
-    0x5B29, 0x6B69, 0x73A9, 0x4AA7, 0x3247, 0x5B8B, 0x42C8, 0x2143,
-    0x2984, 0x3205, 0x5329, 0x5B49, 0x4AC8, 0x4AC8, 0x8C4B, 0x6BAA,
-    0x3AC8, 0x6BCA, 0x7BE9, 0x840A, 0x8C0A, 0xB52D, 0x6B68, 0x9CAC,
-    0xA48B, 0x73A9, 0x3A87, 0x5B49, 0x6BCA, 0x3AA8, 0x536A, 0x534A,
-    0x3AE9, 0x4B09, 0x4AE9, 0x42C8, 0x5309, 0x4AC8, 0x840B, 0x6B8A,
-    0x5B49, 0x5349, 0x42E8, 0x4B09, 0x4AC8, 0x2164, 0x29C6, 0x4AC8,
-    0x42C9, 0x3AA9, 0x3AC9, 0x3AA9, 0x3AA9, 0x3AC9, 0x3AA9, 0x3AC9,
-    0x3AE9, 0x2A06, 0x29E6, 0x52EA, 0x4288, 0x42A9, 0x21A5, 0x52E8,
-    0x4A66, 0x52A7, 0x5AE8, 0x52C7, 0x42A7, 0x42A7, 0x4287, 0x4287,
-    0x10A2, 0x10C2, 0x31E5, 0x31E5, 0x6B49, 0x4267, 0x3A46, 0x52A7,
-    0x4A87, 0x4A66, 0x39E5, 0x0000, 0x0000, 0x10A2, 0x5AC7, 0x5AE7,
-    0x7348, 0x83EA, 0x7BA9, 0x83EA, 0x7368, 0x7348, 0x7368, 0x83CA,
-    0x83A9, 0x7B89, 0x7B89, 0x7368, 0x83C9, 0x83EA, 0x8BEA, 0x8BEA,
-    0x9C8C, 0xACEC, 0xACCC, 0xAD0D, 0xA4ED, 0x8C2B, 0x738A, 0x42C9,
-    0x4B0A, 0x9575, 0xD75C, 0xC6FB, 0xCF1C, 0xADF6, 0xADF6, 0xDF7D,
-    0xDF9E, 0xD77D, 0xD77E, 0xDFBE, 0xD79E, 0xD77E, 0xDFBE, 0xDFBF,
-    0xD79E, 0xD79E, 0xD79E, 0xDF9E, 0xDF9E, 0xDFBE, 0xDF9E, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF,
-    0xE7DF, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xCF3D, 0xC6DC, 0xD79E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xE7FF, 0xBEDB, 0x7CF4, 0x6C93, 0x5BD0,
-    0x42EC, 0x42EC, 0x534E, 0x1125, 0x1125, 0x1925, 0x10E4, 0x1925,
-    0x1946, 0x1125, 0x29C7, 0x29C7, 0x2186, 0x1966, 0x1966, 0x1966,
-    0x1945, 0x21A6, 0x1965, 0x0021, 0x0000, 0x0000, 0x08A2, 0x1944,
-    0x29C6, 0x21C6, 0x29E6, 0x1985, 0x21C5, 0x2184, 0x4267, 0x1903,
-    0x1924, 0x08A2, 0x3A27, 0x29C6, 0x29E7, 0x21C6, 0x3247, 0x31E6,
-    0x29A5, 0x3227, 0x1923, 0x2164, 0x2165, 0x2985, 0x0000, 0x29E7,
-    0x29C6, 0x10A2, 0x1103, 0x3A88, 0x3206, 0x3226, 0x4B0A, 0x2164,
-    0x39E6, 0x4267, 0x3A48, 0x3268, 0x430A, 0x42E9, 0x6B8A, 0x52E8,
-    0x3226, 0x840B, 0x7BEA, 0x9C6B, 0xA4CC, 0x7388, 0x6368, 0x8C2A,
-    0xA4AB, 0x946B, 0x6369, 0x6348, 0x9CCC, 0x3AC8, 0x3AE9, 0x42E8,
-    0x5329, 0x4B09, 0x42E9, 0x4AE9, 0x4AE9, 0x5309, 0x42C8, 0x3AC8,
-    0x3AC9, 0x3AC9, 0x3AE9, 0x3AC9, 0x3AA9, 0x42C9, 0x3AE9, 0x3AC9,
-    0x3AC9, 0x3AC9, 0x3AE9, 0x3AE9, 0x32A9, 0x3A88, 0x42C9, 0x32A9,
-    0x3288, 0x3AC9, 0x432A, 0x3AE9, 0x3B09, 0x3AE9, 0x42E9, 0x3AE9,
-    0x3AE9, 0x3AC9, 0x3AC9, 0x32A8, 0x3A68, 0x3267, 0x21E6, 0x19C6,
-    0x31C5, 0x18E2, 0x10C2, 0x39E6, 0x2144, 0x3206, 0x4246, 0x4226,
-    0x2124, 0x18E3, 0x29A7, 0x63F1, 0x3209, 0x0000, 0x0000, 0x18E2,
-    0x39E5, 0x52A8, 0x4A87, 0x6308, 0x9C6B, 0xA48B, 0x8C0A, 0x8C0A,
-    0x8C0A, 0x8C0A, 0x942A, 0x83E9, 0x7B68, 0x7B89, 0x7B88, 0x7B89,
-    0x8C2A, 0xACED, 0xACED, 0xACED, 0xACEC, 0xACEC, 0xA4CC, 0x9C8C,
-    0xACCC, 0x7BCB, 0x6B8A, 0x6309, 0x8CD0, 0x8CB0, 0x7C2D, 0xD73C,
-    0xD75D, 0xE7FF, 0xDF9E, 0x9512, 0xD75D, 0xD79E, 0x8D13, 0xC6DB,
-    0xC71C, 0xD7BE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E,
-    0xE7BF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBE, 0xDFBE,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xB67A,
-    0xC6FC, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF,
-    0xDFBE, 0xDF9E, 0xE7DF, 0xE7DF, 0xDFBE, 0xDFBF, 0xDFDF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFDF, 0xDFDF, 0xCF3D,
-    0xBEBA, 0xAE19, 0xA5F8, 0xAE59, 0x6451, 0x4B8E, 0x4B6E, 0x432D,
-    0x538E, 0x53AF, 0x7CB3, 0x434E, 0x432E, 0x7CB3, 0x4B6E, 0x3B2E,
-    0x3AED, 0x536E, 0x4B6E, 0x3A6A, 0x3249, 0x3249, 0x3228, 0x29C7,
-    0x21A7, 0x29E8, 0x21A7, 0x08C3, 0x0882, 0x0062, 0x0062, 0x0862,
-    0x10C3, 0x0882, 0x0882, 0x0861, 0x10E3, 0x1925, 0x2A08, 0x08C3,
-    0x0882, 0x1104, 0x10A3, 0x0882, 0x0882, 0x08A3, 0x10E4, 0x1925,
-    0x1924, 0x10E4, 0x1904, 0x2165, 0x2145, 0x10E3, 0x2123, 0x10A2,
-    0x2103, 0x0041, 0x0000, 0x10A2, 0x2164, 0x2A47, 0x21A5, 0x2144,
-    0x29A5, 0x3226, 0x73CA, 0x7BC9, 0x73A9, 0x8C4B, 0x7BEA, 0x6389,
-    0x7BEA, 0x8C0A, 0x8C2A, 0x7BC9, 0x73CA, 0x5349, 0x4B09, 0x7C0A,
-    0x8C4B, 0x6369, 0x5B69, 0x7BEA, 0x6B8A, 0x7C0A, 0x94AC, 0x73EA,
-    0x3AE8, 0x5B8A, 0x534A, 0x3AC8, 0x5B6A, 0x5B6A, 0x3288, 0x3AC9,
-    0x3AA9, 0x3AC9, 0x3AC9, 0x3AE9, 0x3267, 0x3A26, 0x6BAA, 0x5349,
-    0x4287, 0x29E6, 0x42C9, 0x5349, 0x4B09, 0x4309, 0x3AC9, 0x3AE9,
-    0x4309, 0x534A, 0x3AE9, 0x32C9, 0x4309, 0x4309, 0x3AE9, 0x3AE9,
-    0x4205, 0x4247, 0x2943, 0x2984, 0x31A5, 0x18E3, 0x2943, 0x5AE9,
-    0x4227, 0x8CF3, 0x9555, 0x7CB2, 0x8D34, 0x63AE, 0x534E, 0x10E4,
-    0x0000, 0x0000, 0x0000, 0x2144, 0x6B69, 0x840B, 0x73CB, 0x636A,
-    0x7BAA, 0x9CAC, 0x946B, 0x944B, 0x9C6B, 0x942A, 0x83C9, 0x83C9,
-    0x8C0A, 0x9C6B, 0x9C8B, 0x9C6B, 0x9C8B, 0xACCC, 0xACED, 0xA4AC,
-    0x9C6B, 0xA4AB, 0x8BE9, 0x7B68, 0x62C6, 0x5265, 0x4A24, 0x738B,
-    0x842C, 0x846E, 0x7C2E, 0x634A, 0x73ED, 0x94F1, 0x5286, 0x5AC8,
-    0x6B6A, 0x9532, 0xD75C, 0xD75C, 0xD75C, 0xD75D, 0xE7FF, 0xEFFF,
-    0xDF9E, 0xE7DF, 0xE7FF, 0xE7DF, 0xDFBF, 0xDFBF, 0xD7BE, 0xDFBF,
-    0xDFFF, 0xD77D, 0xD75D, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFDF, 0xDFBF, 0xDFBF, 0xAE39,
-    0xBEBB, 0xD75D, 0xDF9E, 0xDFBF, 0xDFBF, 0xE7DF, 0xDF9D, 0xDFBF,
-    0xDFDF, 0xE7FF, 0xDFBF, 0xDFDF, 0xE7FF, 0xDF9E, 0xC6FB, 0xE7FF,
-    0xDFBE, 0xD75D, 0xA5D7, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xD79E, 0xD77D, 0xE7DF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xB679, 0xA5F7, 0xADF8, 0xADF8,
-    0xADD7, 0x9535, 0xB659, 0xAE39, 0x9596, 0x9535, 0x9D96, 0xBE9A,
-    0x7431, 0x7431, 0x7C92, 0x8D35, 0x7D15, 0x53CF, 0x6411, 0x8514,
-    0xB67A, 0x9596, 0x6411, 0x6C52, 0x4B6E, 0x4B4E, 0x4B6E, 0x538F,
-    0x42EC, 0x84F3, 0x5B8F, 0x538F, 0x4B4E, 0x538F, 0x4B6E, 0x5BAF,
-    0x430D, 0x430D, 0x6C31, 0x3ACC, 0x3AEC, 0x430D, 0x430D, 0x430D,
-    0x432E, 0x432D, 0x430D, 0x3AEC, 0x3AAC, 0x328B, 0x21A7, 0x21A7,
-    0x21A7, 0x21A7, 0x29C8, 0x29C8, 0x29C8, 0x10C3, 0x0882, 0x08A2,
-    0x10A2, 0x1985, 0x3A47, 0x42C8, 0x42E9, 0x4B09, 0x3A87, 0x3A88,
-    0x3A46, 0x83EA, 0x83C9, 0x8C0A, 0x73A9, 0x842B, 0x840A, 0x944B,
-    0x6B68, 0x7BEA, 0x6328, 0xA4CC, 0x9CAC, 0x9C8B, 0xA4CC, 0xB52D,
-    0x6BAA, 0x6BAA, 0x842B, 0x6B8A, 0x5B29, 0x636A, 0x5309, 0x3AA8,
-    0x4B09, 0x3AC9, 0x532A, 0x6BAA, 0x63AA, 0x6BCB, 0x5349, 0x73CA,
-    0x5B49, 0x52E9, 0x638A, 0x638A, 0x5B6A, 0x3AC9, 0x63AA, 0x4B29,
-    0x4B29, 0x5329, 0x42E9, 0x32C9, 0x4B4A, 0x534A, 0x5B8A, 0x4B29,
-    0x5286, 0x5266, 0x4A46, 0x5AC7, 0x5286, 0x5287, 0x62E7, 0x6B28,
-    0x6B27, 0x6B49, 0x6B29, 0x5286, 0x5AC7, 0x5B29, 0x7CB3, 0x95D9,
-    0x536F, 0x428A, 0x0861, 0x18E3, 0x0881, 0x10C2, 0x1924, 0x1923,
-    0x4A46, 0x52C8, 0x5B09, 0x6349, 0x5AC7, 0x7BCA, 0x83EA, 0x8C0A,
-    0x944A, 0x942A, 0x8C0A, 0x83EA, 0x83EA, 0x7389, 0x6B89, 0x5308,
-    0x4247, 0x6329, 0x83EA, 0x942B, 0x8C0A, 0x7348, 0x62C7, 0x7327,
-    0x6B27, 0x62E6, 0x7368, 0x8C0A, 0x7368, 0x8BC9, 0x7B89, 0x4A45,
-    0x5A85, 0x6B27, 0x7BAA, 0x840B, 0x7BCA, 0x8C6D, 0xADB4, 0xADB5,
-    0x73EE, 0x846F, 0xADB5, 0xD75D, 0xE7BF, 0xDF9E, 0xDFDF, 0xB617,
-    0xADF6, 0x8CB0, 0x7C0D, 0xB637, 0xBE99, 0xBE99, 0xBE78, 0xD75D,
-    0xE7FF, 0xDFBE, 0xE7DF, 0xE7FF, 0xCF1B, 0xD73B, 0xDFBE, 0xE7FF,
-    0xE7DF, 0xAD72, 0xD6FA, 0xE7FF, 0xDF9E, 0xCEB8, 0xA4EF, 0xAE16,
-    0xBE78, 0xA594, 0xD77C, 0xCF1A, 0xBEBA, 0xBEB9, 0x8CD0, 0xBE99,
-    0xCF3C, 0x9533, 0x7C71, 0xDF7D, 0xD75D, 0xC677, 0xD71B, 0xDFBF,
-    0xDF9F, 0xDFDF, 0xDFBF, 0xD79E, 0xDFBF, 0xD79E, 0xA573, 0xE7BE,
-    0xDFBE, 0xD77E, 0xD79E, 0xDFBE, 0xD75D, 0xCF1C, 0xEFFF, 0xE7DF,
-    0xEFFF, 0xDF9E, 0xDF9F, 0xE7FF, 0xDFDF, 0xBE9B, 0xBE9A, 0xEFFF,
-    0xE7FF, 0xCEFC, 0xBE9A, 0xE7BF, 0xD75E, 0xC71C, 0xCF3D, 0xDFBF,
-    0xE7FF, 0xE7DF, 0xAE18, 0xAE18, 0xBE9A, 0xC6FC, 0xCF1C, 0xBE9A,
-    0x8D14, 0xDF9E, 0xC6DB, 0xBE9A, 0x8D15, 0x5BD0, 0xA639, 0xC6FB,
-    0x5BD0, 0x8515, 0x8D55, 0x53AF, 0x6C52, 0x6C31, 0x6C31, 0x538F,
-    0x538F, 0x63F0, 0x5BAF, 0x63F0, 0x63F0, 0x6C31, 0x536F, 0x4B4E,
-    0x432E, 0x53B0, 0x432E, 0x434F, 0x436F, 0x3ACC, 0x430D, 0x3ACC,
-    0x3229, 0x2186, 0x1925, 0x1903, 0x10A2, 0x1944, 0x3289, 0x1924,
-    0x10A2, 0x7369, 0x5B08, 0x3A68, 0x4A87, 0x73AA, 0x7369, 0x6B28,
-    0x5AE8, 0x8C2B, 0x840A, 0x5B48, 0x944B, 0x9CAC, 0x840A, 0x8C4A,
-    0x7BCA, 0x8C4B, 0x840B, 0x6B69, 0x8C6C, 0x6349, 0x8C4C, 0x5329,
-    0x6BAA, 0x7BEB, 0x7C0B, 0x842B, 0x842B, 0x638A, 0x5B8A, 0x7C2B,
-    0x638A, 0x7BEB, 0x5B6A, 0x636A, 0x42E9, 0x3AE9, 0x638A, 0x5B6A,
-    0x3AE9, 0x3AC9, 0x3AE9, 0x3AC9, 0x4B29, 0x4B29, 0x4B29, 0x3AE9,
-    0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x62C6, 0x62E6, 0x62C6, 0x7348,
-    0x62E7, 0x62A6, 0x5AA6, 0x5AC6, 0x5AA6, 0x5285, 0x39E4, 0x7CF4,
-    0xAEDD, 0xA67B, 0x8D77, 0x7453, 0x536E, 0x6C11, 0x3A29, 0x31E7,
-    0x3A27, 0x0020, 0x0881, 0x0020, 0x0000, 0x4AA7, 0x4AA7, 0x6308,
-    0x942A, 0x944B, 0x8C0A, 0x83EA, 0x6B48, 0x4267, 0x2206, 0x3268,
-    0x2164, 0x21E6, 0x7369, 0x83C9, 0x8BEA, 0x8BEA, 0x8BEA, 0x9C4B,
-    0x9C6C, 0x9C8C, 0xACED, 0xB50D, 0xB4ED, 0xACCC, 0x9C4B, 0x9C4B,
-    0xA48B, 0xACEC, 0xACCC, 0xACCC, 0xACCC, 0xACCC, 0x942A, 0x942A,
-    0x944B, 0x9C6B, 0x7B88, 0x7BCB, 0x842D, 0x840C, 0x7BEC, 0x738A,
-    0x62E7, 0x5AA7, 0x83A9, 0x62E8, 0x6B48, 0x7389, 0x842B, 0x948D,
-    0x9CCF, 0x844D, 0x7C2D, 0xADF6, 0x948E, 0x7BAA, 0x94CF, 0x840C,
-    0xBDB1, 0xAD2E, 0xAD4F, 0xC613, 0xBDD1, 0xAD0D, 0xA4CC, 0xA50E,
-    0xA4CC, 0x944A, 0xB54F, 0xAD0D, 0x8C6D, 0x946C, 0x8C4B, 0x6328,
-    0x9D32, 0x8CB0, 0x7C4F, 0x8CB0, 0x9532, 0xAD2E, 0x94F1, 0xE7DF,
-    0xDFBF, 0xC6B9, 0xBE78, 0xEFFF, 0xBE78, 0xCED9, 0xAD92, 0xB5F6,
-    0xDF7C, 0xBE35, 0xD75C, 0xADF6, 0xEFFF, 0xE7BF, 0xE7DF, 0xE7DF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xD79E, 0xDFBE, 0xDFBF, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7DF, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xE7DF, 0xE7DF, 0xE7DF, 0xDFDF, 0xE7DF, 0xE7DF,
-    0xEFFF, 0xDFBF, 0xE7DF, 0xEFFF, 0xDF7E, 0xB69A, 0xCF7E, 0xCF5D,
-    0x9DD8, 0x9596, 0xDF9E, 0xA5F7, 0xAE18, 0xBE7A, 0xC6DB, 0xB639,
-    0xC6DB, 0xC6DB, 0x9DB7, 0xA618, 0xAE5A, 0xD79E, 0xC6FC, 0x8D35,
-    0xB69A, 0x9D96, 0x9D96, 0x7CD4, 0x7493, 0x9556, 0x74B3, 0x3B0E,
-    0x3B2E, 0x3B0E, 0x430D, 0x21A7, 0x2166, 0x0861, 0x0020, 0x0000,
-    0x0000, 0x2943, 0x31C5, 0x0882, 0x21A5, 0x4AC8, 0x6308, 0x2103,
-    0x5AE8, 0x4246, 0x73AA, 0x42A8, 0x844C, 0x5AE7, 0x6B89, 0x7BEA,
-    0x3A46, 0x52A7, 0x9CCD, 0x73AA, 0x5B08, 0x944B, 0x7BCA, 0x6369,
-    0x638A, 0x5B6A, 0x6BCA, 0x73EA, 0x5349, 0x5B6A, 0x63AA, 0x5B6A,
-    0x4309, 0x42E9, 0x42E9, 0x4B2A, 0x32A8, 0x3AC9, 0x32A9, 0x3AC9,
-    0x3AE9, 0x3AE9, 0x3AC9, 0x3AE9, 0x536A, 0x5349, 0x42C8, 0x3AC9,
-    0x5AA6, 0x62C6, 0x5AA6, 0x62C6, 0x62E7, 0x62E7, 0x83A8, 0x8BE9,
-    0x62C6, 0x62C7, 0x62E7, 0x52A7, 0x52E8, 0x4A87, 0x4225, 0x29A6,
-    0x95D9, 0x9E3B, 0xA65B, 0xAE9C, 0xAE9C, 0xA63A, 0xAE7B, 0xA63B,
-    0x8D98, 0x84F5, 0x63F1, 0x4B4E, 0x530D, 0x18E4, 0x1104, 0x2144,
-    0x41E5, 0x7B69, 0x7328, 0x4A25, 0x7BAA, 0x7369, 0x5B08, 0x4225,
-    0x2964, 0x5AC7, 0x942B, 0x8BEA, 0x83CA, 0x7B89, 0x83C9, 0x8C0A,
-    0x9C4B, 0xB4ED, 0xACEC, 0xACCC, 0xA4AC, 0xACAC, 0xACED, 0xACCC,
-    0xACCC, 0xA48C, 0x83C9, 0x9C4B, 0x9C8B, 0x9C6B, 0xA4AC, 0x9C6B,
-    0x9C4B, 0x942B, 0x83EA, 0x8BEA, 0x8C0A, 0x7B88, 0x83A9, 0x9C8B,
-    0x944B, 0x83CA, 0x944B, 0x942B, 0x9C6B, 0x9C6B, 0x83C9, 0x8C09,
-    0x6B27, 0x6B47, 0x6B48, 0x8BE9, 0x8C09, 0x83E9, 0x942A, 0x9C4A,
-    0xACCC, 0xACCC, 0x9C6B, 0xA4CC, 0x9C8B, 0xACED, 0x9C8B, 0x9C8B,
-    0xA4CC, 0xACEC, 0xA4AB, 0xA4CC, 0xACED, 0x8C0A, 0x9C8B, 0x944B,
-    0x946B, 0x6B48, 0x6307, 0x83A9, 0x5AE7, 0x73AA, 0x73CB, 0xA551,
-    0x846E, 0x94AD, 0x7C0B, 0x7450, 0x6BCB, 0x5B69, 0x844B, 0x94AD,
-    0xB5F5, 0x94CF, 0xB658, 0x9D32, 0xD71B, 0xEFFF, 0xC6BA, 0xCEFB,
-    0xDFDF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xBF1C, 0x7CB3, 0xAE19, 0xE7FF,
-    0xDFBF, 0xD79E, 0xE7DF, 0xDF7E, 0xCF3D, 0xE7BF, 0xDFBF, 0xE7DF,
-    0xE7DF, 0xDFBF, 0xDFBE, 0xD79E, 0xDF9E, 0xD79E, 0xDFBF, 0xDF9F,
-    0xE7DF, 0xE7BF, 0xE7DF, 0xDF9F, 0xE7DF, 0xC6FC, 0x9576, 0x9D97,
-    0x9DB7, 0x74B3, 0x3ACC, 0x432E, 0x430D, 0x29E8, 0x2187, 0x29E8,
-    0x1966, 0x0021, 0x0000, 0x2923, 0x31A5, 0x0020, 0x2943, 0x2103,
-    0x4A67, 0x0881, 0x1965, 0x10E3, 0x3206, 0x3206, 0x42A7, 0x73CA,
-    0x3A47, 0x2164, 0x4A67, 0x42A8, 0x7BEB, 0xA4AB, 0x946C, 0x73AA,
-    0x6BAA, 0x3AC9, 0x4B09, 0x5B6A, 0x4B4A, 0x42E9, 0x3AC9, 0x3AE9,
-    0x3AC9, 0x32A9, 0x4309, 0x4B09, 0x32A8, 0x3AC9, 0x3AC9, 0x3AE9,
-    0x3AC9, 0x4309, 0x538A, 0x32C9, 0x3AE9, 0x4309, 0x3AE9, 0x3AE9,
-    0x62C6, 0x5AA6, 0x62E6, 0x4A25, 0x3184, 0x4A45, 0x6B28, 0x4A86,
-    0x4A46, 0x2964, 0x4226, 0x52A7, 0x29A5, 0x4247, 0x39E6, 0x1082,
-    0x7CF5, 0xA67B, 0x9E1A, 0x9E1A, 0xA63A, 0xA63A, 0xA63A, 0xA63B,
-    0xA65B, 0xAE7C, 0xAEBD, 0xAEDD, 0xAEDD, 0xB69C, 0x8515, 0x530C,
-    0x31C7, 0x5AA7, 0x7B69, 0x5245, 0x9C8C, 0x8BEA, 0x9C6B, 0x83C9,
-    0x83CA, 0x7B89, 0x7B89, 0x7B69, 0x83C9, 0x8BEA, 0x83C9, 0x83C9,
-    0x83A9, 0x8BE9, 0x83A9, 0x8BEA, 0x8C0A, 0x940A, 0x940A, 0x8C0A,
-    0x942B, 0x9C4B, 0x8BEA, 0x8C0A, 0x83C9, 0x7BA9, 0x83A9, 0x7BA9,
-    0x6B48, 0x7369, 0x7BA9, 0x83CA, 0x7BCA, 0x7BA9, 0x83CA, 0x7389,
-    0x5AE7, 0x6B49, 0x8BEA, 0x942A, 0x942A, 0x7B88, 0x944A, 0xA4AC,
-    0x9C8B, 0x9C8B, 0xACEC, 0x9C8C, 0xA4EC, 0xA4CC, 0x83E9, 0x83C9,
-    0x83EA, 0x8BEA, 0x7BA9, 0x83C9, 0x8BE9, 0x8BE9, 0x83A9, 0x83C9,
-    0x7B88, 0x7B89, 0x83C9, 0x8C0A, 0x7BA9, 0x7369, 0x8C0A, 0x8C4B,
-    0x9C8C, 0x9CAC, 0x944B, 0xA4AC, 0x946B, 0x73A9, 0x6BAA, 0x73A9,
-    0x73C9, 0x8C2A, 0x8C4A, 0x52E7, 0x5B28, 0x7C0A, 0x7BC9, 0x7BC9,
-    0x6328, 0x3A26, 0x4267, 0x3205, 0x52E9, 0xC677, 0xADB4, 0xBE98,
-    0xDFFF, 0xD79E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xCF7E, 0xC6FC, 0xCF5D, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9E, 0xDFBF,
-    0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xDFBF, 0xE7FF,
-    0xEFFF, 0xCF5D, 0x84F4, 0x5B8F, 0x3AED, 0x432E, 0x432E, 0x434F,
-    0x432E, 0x3ACD, 0x42CC, 0x3208, 0x2986, 0x1925, 0x10E4, 0x0020,
-    0x1081, 0x0041, 0x0020, 0x0000, 0x0020, 0x10C2, 0x6B8A, 0x7B89,
-    0x4AA8, 0x10C3, 0x2923, 0x3A68, 0x638A, 0x6B89, 0x5B49, 0x42E9,
-    0x3AA8, 0x842B, 0x9CAC, 0x5B6A, 0x63CB, 0x42C8, 0x5B6A, 0x3AC9,
-    0x3AA8, 0x32A9, 0x32A9, 0x3AC9, 0x3AC9, 0x3AC9, 0x3AC9, 0x32C9,
-    0x3AC9, 0x3AE9, 0x4309, 0x3AC9, 0x3AE9, 0x3AC9, 0x3AC9, 0x3AC9,
-    0x62C6, 0x62C6, 0x62C6, 0x5265, 0x4205, 0x5AA6, 0x6B28, 0x5266,
-    0x5286, 0x5AA6, 0x73A9, 0x4A66, 0x39E5, 0x3A06, 0x1903, 0x1924,
-    0x84F5, 0xAE9C, 0xA65B, 0xA67B, 0xAE7C, 0xAE7B, 0xAE7C, 0xA67B,
-    0xA67B, 0xA65B, 0x95B8, 0x8D77, 0x8515, 0x638E, 0x530B, 0x3183,
-    0x7B89, 0x9C6C, 0x9C6C, 0x8BEA, 0x9C8B, 0x942A, 0x9C8C, 0xA4AC,
-    0x944B, 0x9C6B, 0x83EA, 0x7348, 0x7BA9, 0x8C0A, 0x940A, 0x9C6B,
-    0x942A, 0x7B89, 0x7BA9, 0x7B68, 0x83C9, 0x83C9, 0x83C9, 0x83C9,
-    0x83C9, 0x7BA9, 0x83CA, 0x83C9, 0x83A9, 0x7348, 0x7B89, 0x6B48,
-    0x6328, 0x6B69, 0x5AE8, 0x52C8, 0x6328, 0x7B89, 0x83AA, 0x6328,
-    0x7389, 0x7BCA, 0x9C8C, 0xBD2D, 0xACCC, 0xA4AC, 0x8C2A, 0x8C2A,
-    0xA4AB, 0x942A, 0x9CAB, 0x6B28, 0x9C6B, 0x8C0A, 0x8BEA, 0x8C0A,
-    0x83C9, 0x83EA, 0x7BA9, 0x7BC9, 0x7BC9, 0x83EA, 0x840A, 0x83EA,
-    0x7BC9, 0x83C9, 0x7389, 0x7368, 0x7369, 0x83EA, 0x83CA, 0x7368,
-    0x840A, 0x7BEA, 0x6B89, 0x6369, 0x7BCA, 0x83EA, 0x52E8, 0x5B29,
-    0x6B89, 0x4AC8, 0x5B09, 0x6369, 0x5329, 0x5B49, 0x42A8, 0x4AE9,
-    0x6B8A, 0x740B, 0x7BEB, 0x842C, 0x7C2B, 0x5BAB, 0x42C9, 0xAE17,
-    0xE7FF, 0xDFBF, 0xDFDF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDF9E, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFDF, 0xA5F8, 0x6C11, 0x7CD4, 0xB639, 0x4B4E,
-    0x432E, 0x4B4F, 0x3AED, 0x430D, 0x4B2E, 0x4B4E, 0x4B2D, 0x3AAB,
-    0x326A, 0x3249, 0x328A, 0x324A, 0x29E8, 0x1082, 0x0841, 0x31C5,
-    0x31E5, 0x0000, 0x52A7, 0x08A1, 0x4247, 0x42A8, 0x5B6A, 0x3AC9,
-    0x4B29, 0x8C2B, 0xAD0D, 0x5B29, 0x5B6A, 0x5B49, 0x8C2B, 0x5B28,
-    0x842B, 0x5349, 0x3AC9, 0x32C9, 0x3AC9, 0x3AC9, 0x4309, 0x4B09,
-    0x4309, 0x3AC9, 0x3AC9, 0x3AE9, 0x3AE9, 0x3AE9, 0x3AE9, 0x3AC9,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62E6, 0x62C6, 0x5AA6, 0x62C7,
-    0x5AA6, 0x7368, 0x944A, 0x6B48, 0x83EA, 0x0000, 0x530C, 0xAE9C,
-    0x9DF9, 0x9576, 0x7430, 0x6BCD, 0x73EE, 0x73EE, 0x73EE, 0x846F,
-    0x8470, 0x9534, 0x52C9, 0x62E8, 0x5AC8, 0x5266, 0x6B07, 0x6B08,
-    0x7368, 0x5245, 0x6B08, 0xACCC, 0xA4AB, 0xB4ED, 0x8C2B, 0x6369,
-    0x6B69, 0x9C6B, 0x9C8C, 0x9C6B, 0x946B, 0x6349, 0x9C6C, 0x83CA,
-    0x8C2B, 0x8C0A, 0x9C6B, 0x8BE9, 0x83C9, 0x8C0A, 0x8C0A, 0x8C0A,
-    0x8BE9, 0x8BEA, 0x83C9, 0x83A9, 0x7348, 0x7348, 0x5B29, 0x4AC8,
-    0x52E8, 0x4267, 0x3206, 0x29C6, 0x4A88, 0x52A8, 0x4A87, 0x52E8,
-    0x52C8, 0x4267, 0x4A87, 0x7BC9, 0x942B, 0x5AC7, 0x52C8, 0x8C2B,
-    0xA4CC, 0x9CCC, 0x946B, 0x83EA, 0xA4AC, 0xA4CB, 0xAD0C, 0xACEC,
-    0x944A, 0x83EA, 0x73A9, 0x7BA9, 0x6B69, 0x6B69, 0x6349, 0x6349,
-    0x6B89, 0x73CA, 0x5B29, 0x7BCA, 0x6349, 0x73CA, 0x738A, 0x634A,
-    0x534A, 0x534A, 0x5BAB, 0x4B0A, 0x3A26, 0x4288, 0x3226, 0x29E6,
-    0x29C6, 0x2A07, 0x19A6, 0x1965, 0x21E7, 0x19A6, 0x42EA, 0x3248,
-    0x3248, 0x3227, 0x10E3, 0x3A47, 0x3227, 0x2208, 0x3ACA, 0x9533,
-    0xC71C, 0xADF7, 0x9554, 0xB67A, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD77E, 0xCF1C,
-    0xE7FF, 0xDF9E, 0xC6DB, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9F, 0xDFBF, 0xDF9E, 0xD75D, 0xDF7E, 0xEFFF, 0xC6FC,
-    0x9DB7, 0x9576, 0x7472, 0x4B2E, 0x3AAC, 0x42ED, 0x3AEC, 0x430D,
-    0x432E, 0x434E, 0x432E, 0x432E, 0x3ACC, 0x3209, 0x2A09, 0x29E7,
-    0x1924, 0x31E7, 0x2165, 0x0041, 0x2144, 0x3226, 0x73EB, 0x42E9,
-    0x7C0B, 0x8C6B, 0x6369, 0x5B29, 0x8C4C, 0x9C8B, 0xA4CC, 0x840A,
-    0x840A, 0x8C4B, 0x5B49, 0x5B8A, 0x4B09, 0x3AC8, 0x73EB, 0x6BAA,
-    0x534A, 0x32A9, 0x3AE9, 0x3AE9, 0x3B09, 0x3B09, 0x3AE9, 0x3AE9,
-    0x62C6, 0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6, 0x6B48, 0x4A66,
-    0x62E7, 0x8C2A, 0x7388, 0x7BA9, 0x6B69, 0x5AE8, 0x8C2C, 0x9CF0,
-    0x6B6B, 0x5286, 0x5AA6, 0x7327, 0x62E6, 0x7348, 0x5AA6, 0x8388,
-    0x6307, 0x7389, 0x8C0A, 0x9C8B, 0x942B, 0x944B, 0xB50D, 0x940A,
-    0x8C2B, 0x6B08, 0x7368, 0x9C8B, 0xACCC, 0x8C2A, 0x5329, 0x42E9,
-    0x7389, 0x840A, 0x8C4B, 0x83EA, 0x7BCA, 0x73AA, 0x5AC7, 0x42C8,
-    0x5B29, 0x6B48, 0x944B, 0x942A, 0x7389, 0x52E7, 0x8C4A, 0x6348,
-    0x7BC9, 0x944A, 0x7389, 0x7369, 0x6B48, 0x7389, 0x42C8, 0x42E9,
-    0x2164, 0x1944, 0x2185, 0x2185, 0x3206, 0x3206, 0x4267, 0x3A27,
-    0x3A47, 0x4AA8, 0x6329, 0x6B48, 0x6308, 0x6308, 0x4267, 0x29A5,
-    0x4267, 0x3A68, 0x5AE8, 0x8C0B, 0x7389, 0x8C4B, 0x8C4B, 0x73EB,
-    0x73CB, 0x6BAA, 0x4AE9, 0x5B29, 0x5B29, 0x6B8A, 0x6369, 0x6B8A,
-    0x6369, 0x73CA, 0x5329, 0x4B09, 0x3248, 0x1104, 0x2165, 0x1944,
-    0x21C7, 0x1965, 0x1965, 0x1965, 0x08A2, 0x08C3, 0x1924, 0x1924,
-    0x0861, 0x4AA8, 0x29A5, 0x1903, 0x2164, 0x4AA7, 0x2185, 0x0062,
-    0x10C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29E7, 0x7491,
-    0xA5F7, 0x6BEF, 0x84D3, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xD73C, 0x5B0C,
-    0x6B8E, 0x7C51, 0x7410, 0xDFDF, 0xDFBF, 0xE7DF, 0xEFFF, 0xE7FF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7FF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BF, 0xDFBF, 0xDF9E, 0xDFDF,
-    0xDFBF, 0xCF5D, 0xC6FC, 0x7CB3, 0x84F4, 0x7CB3, 0x6C11, 0x5BAF,
-    0x432D, 0x3AED, 0x4B6E, 0x328B, 0x5BB0, 0x53AF, 0x32AC, 0x42EC,
-    0x3229, 0x4B2C, 0x534B, 0x42EA, 0x5B4A, 0x3A88, 0x3288, 0x42C9,
-    0x5308, 0x73AA, 0x73CA, 0x73CA, 0x7C0B, 0xA4AC, 0x840A, 0x944B,
-    0x9CAC, 0x8C4B, 0x7BEB, 0x638A, 0x73EB, 0x4B09, 0x534A, 0x42E9,
-    0x3AC9, 0x32A9, 0x3AC9, 0x3AE9, 0x2A27, 0x2A06, 0x32A9, 0x3AE9,
-    0x62C6, 0x5AA6, 0x7347, 0x83E9, 0x5286, 0x6AE7, 0x944B, 0x4246,
-    0x4A87, 0x52A7, 0x4205, 0x7BAA, 0x8C2B, 0x7BCA, 0x5286, 0x944A,
-    0x7348, 0x7369, 0x6308, 0x7369, 0x83EA, 0x8C2A, 0x83E9, 0xACEC,
-    0x9C8B, 0x944B, 0x9C8C, 0x6B69, 0xB50D, 0x944B, 0x8C0A, 0xA48B,
-    0xACCC, 0x7BCA, 0xA4AC, 0x7BA9, 0x7BA9, 0x6308, 0x3227, 0x3A87,
-    0x83EA, 0x42A7, 0x5B6A, 0x7BA9, 0x4246, 0x6369, 0x31A5, 0x2A27,
-    0x2A26, 0x4AE9, 0x5329, 0x4B08, 0x42E8, 0x3AC8, 0x5329, 0x3288,
-    0x3AC8, 0x42C7, 0x42C8, 0x4AE8, 0x3205, 0x3A46, 0x4AA7, 0x5B49,
-    0x3288, 0x3A88, 0x2A06, 0x3A67, 0x5308, 0x5AE8, 0x4205, 0x39E5,
-    0x840B, 0x8C4B, 0x9CAC, 0x7BEA, 0x6B8A, 0x73AA, 0x39E5, 0x0840,
-    0x0000, 0x0041, 0x18E3, 0x52E8, 0x3A68, 0x4AC9, 0x3A68, 0x0904,
-    0x3A88, 0x3227, 0x3227, 0x2A07, 0x21C6, 0x1985, 0x1965, 0x29E7,
-    0x1144, 0x19A6, 0x1965, 0x0061, 0x0061, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x0020, 0x0000, 0x10C3,
-    0x0020, 0x0840, 0x2943, 0x5246, 0x2103, 0x2944, 0x29A5, 0x29E7,
-    0x1966, 0x2A4A, 0x222A, 0x2A4A, 0x21E8, 0x326A, 0x32AB, 0xB679,
-    0xE7DF, 0xB639, 0xC6DB, 0xE7DF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7BE,
-    0x7C30, 0x9535, 0xF7FF, 0xDF9E, 0xE7DF, 0x9514, 0x94F4, 0x52CB,
-    0xC69A, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7DF,
-    0xA596, 0xCF3D, 0xE7FF, 0xDFDF, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9F, 0xDF9E, 0xDF9F, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xE7DF, 0xCF3D, 0xDF9E, 0xDF7E, 0xDF7E, 0x9576,
-    0xBEBB, 0x7CB3, 0x9D97, 0x5BAF, 0x4B4E, 0xA5D8, 0x5BAF, 0x3AAB,
-    0x5B8E, 0x4B2B, 0x6BCC, 0x63AB, 0x8C8C, 0x842B, 0x842B, 0x946B,
-    0x9CAC, 0x9C6B, 0x946B, 0x842B, 0x6349, 0x8C4B, 0x8C2A, 0xACED,
-    0x946B, 0x842B, 0x42E9, 0x4B29, 0x42E9, 0x3AC9, 0x3AA8, 0x32A8,
-    0x4B29, 0x6BAA, 0x3AC9, 0x3AE9, 0x2A27, 0x3267, 0x4309, 0x3B09,
-    0x62C6, 0x62C6, 0x944A, 0x7BA8, 0x5AA6, 0x7368, 0x6307, 0x52A7,
-    0x0061, 0x3A06, 0x2123, 0x8C0B, 0x7389, 0x31E5, 0x5B08, 0x9C8C,
-    0x9C6B, 0x946B, 0x7BCA, 0x7389, 0x83EA, 0x7BA9, 0x83C9, 0x7389,
-    0xA4AC, 0xA4AC, 0x9C8B, 0x6B69, 0x8C2B, 0x83CA, 0x5266, 0x73A9,
-    0x83EA, 0x6328, 0x6B48, 0x62E7, 0x7BCA, 0x4AA7, 0x4247, 0x2184,
-    0x6328, 0x2A47, 0x3226, 0x5B6A, 0x3287, 0x32A8, 0x21A5, 0x21A5,
-    0x1924, 0x2185, 0x3288, 0x3268, 0x3288, 0x3247, 0x32A8, 0x3AC8,
-    0x3A87, 0x3A87, 0x3A67, 0x3A87, 0x1943, 0x10E2, 0x08A2, 0x3226,
-    0x3267, 0x3268, 0x430A, 0x42E9, 0x3226, 0x29C5, 0x29C5, 0x2185,
-    0x29E6, 0x5B08, 0x4A87, 0x4A87, 0x4226, 0x2123, 0x5AE8, 0x7389,
-    0x2103, 0x1082, 0x29C6, 0x4AE9, 0x5309, 0x5B4A, 0x31C5, 0x10A2,
-    0x0840, 0x0020, 0x0861, 0x10A1, 0x0881, 0x08A2, 0x10E3, 0x1924,
-    0x0861, 0x0041, 0x0040, 0x0041, 0x0041, 0x0882, 0x0882, 0x0040,
-    0x10E3, 0x29E7, 0x21A7, 0x29A7, 0x29E8, 0x2A29, 0x2209, 0x2A29,
-    0x2A29, 0x21E8, 0x19A7, 0x1946, 0x2A09, 0x328C, 0x2A8C, 0x330D,
-    0x2A8C, 0x434F, 0x436F, 0x4B90, 0x53AF, 0x9596, 0x8D35, 0xBEBB,
-    0xEFFF, 0xEFFF, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF,
-    0xEFFF, 0xE7FF, 0xDF9E, 0xDFBF, 0xE7DF, 0xCEDB, 0x7410, 0x9D75,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7FF,
-    0x4AAA, 0x6BCF, 0xD73D, 0xCF3D, 0xEFFF, 0xE7FF, 0xDF9F, 0xDF9F,
-    0xDFBE, 0xDF9E, 0xDFBF, 0xE7FF, 0xDFBF, 0xDF9E, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xE7BF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xC71C, 0xBEBB, 0xB67A, 0x8D56, 0x538E,
-    0x94F1, 0x63AC, 0x5B4A, 0x73CB, 0x73CA, 0xA4CC, 0xACEC, 0x9CAB,
-    0xA4AB, 0xA4CC, 0x73A9, 0x8C2B, 0x73CA, 0x7BEA, 0x948C, 0x8C6C,
-    0x8C4B, 0x9CAC, 0x6BCA, 0x63CB, 0x32C9, 0x3AC9, 0x3AC9, 0x3AC9,
-    0x42E8, 0x6B48, 0x4AE8, 0x3288, 0x29E6, 0x3AA8, 0x4AE8, 0x3247,
-    0x62C6, 0x5AA6, 0x7368, 0x62E7, 0x7BA9, 0x7BA9, 0x5AC7, 0x6328,
-    0x31E5, 0x6B49, 0x4246, 0x6B49, 0x83EB, 0x83EA, 0x9C8C, 0xBD4E,
-    0x83EA, 0x7389, 0x83EA, 0x7389, 0x8C0A, 0x8C0A, 0x83EA, 0x3246,
-    0x6B69, 0x7369, 0x8C6B, 0x840B, 0x4A66, 0x83EB, 0x4A46, 0x4287,
-    0x4287, 0x4288, 0x2984, 0x6349, 0x5B49, 0x3247, 0x4267, 0x31E6,
-    0x1123, 0x2A47, 0x1123, 0x3288, 0x3288, 0x2A27, 0x1964, 0x1124,
-    0x1924, 0x0881, 0x10C2, 0x08A2, 0x1924, 0x08A2, 0x1103, 0x1923,
-    0x10C2, 0x10C2, 0x0881, 0x08A2, 0x29A5, 0x1924, 0x10E3, 0x29C6,
-    0x29E6, 0x1944, 0x3227, 0x1103, 0x10E3, 0x0061, 0x08A1, 0x2164,
-    0x0882, 0x3A06, 0x0861, 0x0000, 0x0000, 0x0000, 0x0020, 0x0861,
-    0x18E2, 0x2123, 0x2964, 0x4247, 0x4206, 0x4205, 0x3163, 0x2943,
-    0x4A25, 0x5B08, 0x5308, 0x41E4, 0x2943, 0x0840, 0x0000, 0x0000,
-    0x0020, 0x0882, 0x29A6, 0x29A7, 0x324A, 0x3AAB, 0x2A29, 0x21C7,
-    0x21A7, 0x21A7, 0x2A09, 0x21C8, 0x2229, 0x330E, 0x3B4E, 0x3B2E,
-    0x332F, 0x3B70, 0x332E, 0x3B2E, 0x438F, 0x32CD, 0x6452, 0x5BF1,
-    0x7CD4, 0xC6FC, 0xB659, 0xBE9A, 0xCF1C, 0xDFBF, 0xDF9E, 0xD77E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xC6DB, 0xA5F8, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xF7FF, 0xEFFF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xE7FF,
-    0x530C, 0x2103, 0x31A5, 0x31A6, 0x7C51, 0x9535, 0xE7DF, 0xE7FF,
-    0xE7FF, 0xEFFF, 0xE7DF, 0xB618, 0xD79E, 0xDFBF, 0xDF9F, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xD77D, 0xD75D, 0xD77E, 0xCF3C, 0xDF9D, 0xBE9A, 0x9533, 0x94CE,
-    0x9CAC, 0x844B, 0x844B, 0x842B, 0x7BEA, 0x9CAC, 0x9CAC, 0x7BCA,
-    0x842B, 0x840A, 0x7BEA, 0x840A, 0x5B49, 0x73CA, 0x842B, 0x5B6A,
-    0x4AC8, 0x4B08, 0x5B8A, 0x4309, 0x32C9, 0x42E9, 0x42E9, 0x3AC8,
-    0x3AC8, 0x52A7, 0x5AA7, 0x3A06, 0x52A7, 0x3A46, 0x3A25, 0x4246,
-    0x62C6, 0x6B07, 0x62E7, 0x7368, 0x8C0A, 0x6B27, 0x7347, 0xAD0D,
-    0x8C2B, 0x7BEB, 0x4AC8, 0x6B89, 0x6B8A, 0x840B, 0x738A, 0x9C6C,
-    0x5AE7, 0x5B28, 0x8C4B, 0x6B69, 0x8C2B, 0x83EA, 0x6328, 0x4B09,
-    0x21C5, 0x5B28, 0x5B89, 0x3AC9, 0x29C5, 0x3A47, 0x39E5, 0x2164,
-    0x3247, 0x3A88, 0x1923, 0x3247, 0x3288, 0x2185, 0x2164, 0x29E6,
-    0x10E3, 0x1944, 0x1903, 0x29E6, 0x1944, 0x1964, 0x0881, 0x0081,
-    0x0861, 0x1081, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0041,
-    0x3A06, 0x0841, 0x0841, 0x0882, 0x0862, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x10C3, 0x1903, 0x2145, 0x1925, 0x3249, 0x326A,
-    0x3249, 0x2124, 0x29E7, 0x3A8B, 0x1987, 0x1104, 0x2186, 0x1125,
-    0x31E6, 0x532A, 0x536B, 0x3A48, 0x29A7, 0x3228, 0x3228, 0x3A49,
-    0x324A, 0x2A08, 0x21C7, 0x1945, 0x2A08, 0x430C, 0x6452, 0x5C11,
-    0x6411, 0x6C72, 0x432D, 0x6452, 0x6472, 0x5BF1, 0x6431, 0x84F4,
-    0x6C93, 0x3AED, 0x8D14, 0xAE18, 0x8D14, 0xAE38, 0xCF5D, 0xCF3D,
-    0xDFBF, 0xE7DF, 0xE7DF, 0xE7FF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFDF, 0xCF1C, 0xB65A, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xE7FF, 0xBEBB, 0x7C72, 0xE7FF,
-    0x9D96, 0x5288, 0x5A66, 0x41E5, 0x1081, 0x2103, 0x4A89, 0x52AA,
-    0x8C91, 0xB617, 0x5B2D, 0x31C7, 0xDFBF, 0xD79E, 0xDFBF, 0xE7FF,
-    0xEFFF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xD79D, 0xBE14, 0x9D53, 0xCED9, 0xAD2E, 0xB590, 0xACEC, 0xACEC,
-    0xAD0C, 0xAD0C, 0xA4EC, 0xAD0D, 0xA4EC, 0x946B, 0x7BEA, 0x946B,
-    0x83EA, 0x8C2B, 0x73AA, 0x73CA, 0x6B8A, 0x6B89, 0x844C, 0x6BAA,
-    0x3206, 0x2A47, 0x08C2, 0x3A67, 0x536A, 0x5B49, 0x5329, 0x3AE9,
-    0x42A8, 0x5AC7, 0x5AA7, 0x5AC7, 0x5AC7, 0x5AC7, 0x5AC7, 0x5AC7,
-    0x5AA6, 0x83EA, 0x5A85, 0x7B88, 0x7368, 0x5265, 0x7B88, 0xA4CC,
-    0x8C0A, 0x5B08, 0x5B09, 0x6B69, 0x840B, 0x4205, 0x2103, 0x6B28,
-    0x31A4, 0x6B8A, 0x6389, 0x42C7, 0x5B49, 0x2943, 0x31E6, 0x29A5,
-    0x29E6, 0x2984, 0x3A67, 0x10E3, 0x1944, 0x3247, 0x3205, 0x1964,
-    0x2164, 0x3227, 0x1903, 0x3268, 0x29C6, 0x0020, 0x0861, 0x18E3,
-    0x0000, 0x0040, 0x10C3, 0x0041, 0x0882, 0x08A2, 0x0000, 0x0000,
-    0x0000, 0x0860, 0x1081, 0x0000, 0x0841, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0841, 0x1903, 0x1924, 0x1924, 0x2186, 0x2186, 0x2186,
-    0x21A6, 0x3A6A, 0x31E8, 0x2165, 0x1925, 0x29C7, 0x31E7, 0x29C7,
-    0x29C7, 0x2186, 0x3208, 0x4AEB, 0x42CC, 0x5BD0, 0x432D, 0x436E,
-    0x53CF, 0x428A, 0x4B6E, 0x432E, 0x7CD4, 0x8515, 0x3B2E, 0x5BD0,
-    0x6C52, 0x84F4, 0x8D35, 0x63F0, 0x8D14, 0xBE9A, 0x9555, 0x84F4,
-    0x9D96, 0x7CD3, 0x84F4, 0x7C92, 0xAE39, 0xCF1C, 0xDFBF, 0xDFBF,
-    0xE7DF, 0xE7DF, 0xBE9A, 0xDFDF, 0xDFDF, 0xDFBF, 0xC6DB, 0xDF9E,
-    0xDF9E, 0xC6BA, 0xDF5D, 0xD71C, 0xBE7A, 0xEFFF, 0xDF9E, 0xDF9F,
-    0xDF9E, 0xDF9E, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF, 0xE7FF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBE, 0xC698, 0xDFBF, 0xDFDF, 0xDFBE, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xE7FF, 0xDFDF,
-    0xD79E, 0xD79E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xC6DB, 0x6C10, 0xEFFF,
-    0x7C72, 0x08E4, 0x0883, 0x1082, 0x2123, 0x5266, 0x5245, 0x5265,
-    0x5AA7, 0x39A5, 0x0000, 0x2986, 0xE7DF, 0xDFBF, 0xBEBA, 0x6BCF,
-    0x6BCF, 0xD73D, 0xE7FF, 0xE79E, 0xCED9, 0xE7FF, 0xD73C, 0xC697,
-    0xBDF3, 0x9CAD, 0x8C4C, 0xA50F, 0x9C8A, 0x9C6A, 0x7BC9, 0xA4CC,
-    0x948B, 0x8C4B, 0xA4EC, 0x842A, 0x842A, 0x948C, 0x5B69, 0x842B,
-    0x6B8A, 0x6B8A, 0x5B29, 0x638A, 0x6BAA, 0x7C0B, 0x534A, 0x42E9,
-    0x5B8A, 0x3AC9, 0x3288, 0x5329, 0x6BCA, 0x4AE8, 0x3AA8, 0x4B09,
-    0x6369, 0x5AC7, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA7,
-    0x62C7, 0x83E9, 0x944A, 0xAD0D, 0x840A, 0x6307, 0xACCC, 0x944B,
-    0x6B69, 0x4A86, 0x7BCA, 0x7BEA, 0x6B49, 0x5287, 0x62E8, 0x942B,
-    0x7B89, 0x4287, 0x3AA7, 0x42E8, 0x3AA8, 0x2984, 0x3A47, 0x0040,
-    0x3A88, 0x10C2, 0x21A6, 0x0882, 0x10A2, 0x3267, 0x3A47, 0x1984,
-    0x10E2, 0x10E3, 0x0861, 0x1903, 0x0882, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x08C2, 0x1965,
-    0x1145, 0x1945, 0x1965, 0x1104, 0x21A6, 0x2166, 0x1945, 0x2166,
-    0x1945, 0x21A6, 0x18E4, 0x10C3, 0x0882, 0x10A3, 0x1925, 0x08A2,
-    0x1925, 0x1966, 0x10E4, 0x08E4, 0x1104, 0x1966, 0x1945, 0x1966,
-    0x3ACB, 0x21E8, 0x29E8, 0x6C10, 0xB639, 0x6C51, 0x6C31, 0x7472,
-    0x7472, 0x538F, 0x3B0D, 0x8D35, 0xE7DF, 0xD77D, 0x5BD0, 0xCF5D,
-    0xB69A, 0x7CD3, 0x8D55, 0xCF5D, 0xD79E, 0xE7FF, 0xE7DF, 0xDFBF,
-    0xE7DF, 0xE7BF, 0xE7DF, 0xDF9E, 0xE7DF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDFBE, 0xE7FF, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFDF, 0xDFBF,
-    0xDF9E, 0xE7DF, 0xDFBF, 0xE7BF, 0xE7DF, 0xDF9E, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xD75C, 0xDFBF, 0xDFDF, 0xD73B, 0xDF9E, 0xD77D,
-    0xD7BE, 0xDFBF, 0xDFBF, 0xCF1B, 0xDF7D, 0xE7DF, 0xAE18, 0xDF9E,
-    0xDF7D, 0xDF9E, 0xDF9E, 0xBE15, 0xCF1B, 0xCEFB, 0xE7FF, 0xDFBE,
-    0xDFDF, 0xDFDF, 0xCEFA, 0xD77D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0x5B2C, 0xA5D7, 0xCF3D,
-    0xDFDF, 0xE7FF, 0xE7FF, 0xE7FF, 0xDFDF, 0xE7DF, 0xE7DF, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xEFFF, 0x7410, 0x5B4D, 0xFFFF,
-    0x534E, 0x536E, 0x74B3, 0x1987, 0x08E5, 0x1925, 0x10C3, 0x0861,
-    0x0840, 0x0861, 0x0000, 0x8471, 0xDF7E, 0xD79E, 0xD77E, 0xBE79,
-    0xC6BA, 0xCEB9, 0xDF5C, 0xCE97, 0xB570, 0xCEB8, 0xAD71, 0xA4AC,
-    0xACCB, 0x946B, 0x946B, 0x9C6B, 0x9C8B, 0x946B, 0x83EA, 0x8C4B,
-    0x8C4B, 0x842B, 0x73CA, 0x73EB, 0x7BEA, 0x73EA, 0x73AA, 0x7BEA,
-    0x6369, 0x5B49, 0x7BCA, 0x842B, 0x5329, 0x3AC8, 0x3AC9, 0x32C9,
-    0x32A8, 0x3AC9, 0x3AC9, 0x3AC8, 0x32A8, 0x3AC9, 0x32A9, 0x3AC9,
-    0x5B8B, 0x4AE8, 0x6B49, 0x62C7, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA7,
-    0x6B27, 0xACED, 0x944B, 0x840A, 0x6348, 0x7BA9, 0xACED, 0x83EA,
-    0x7BCA, 0x52A7, 0x62E8, 0x73CA, 0x5287, 0x41E6, 0x62E8, 0x7B69,
-    0x4A46, 0x29A5, 0x4B49, 0x3A66, 0x31E5, 0x29C5, 0x2A26, 0x0000,
-    0x08A2, 0x0041, 0x3227, 0x1924, 0x0000, 0x10E3, 0x0881, 0x1103,
-    0x0040, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0041,
-    0x08A3, 0x29C7, 0x29A7, 0x2166, 0x2187, 0x1966, 0x29C7, 0x3229,
-    0x29E8, 0x2A09, 0x2A29, 0x21E8, 0x1945, 0x10E4, 0x10E4, 0x1945,
-    0x10E4, 0x2A08, 0x3AAB, 0x42EC, 0x5B8E, 0x29E8, 0x3AAB, 0x42CB,
-    0x42AB, 0x4B0C, 0x536E, 0x534E, 0x7472, 0x7CB3, 0x430D, 0x5BD0,
-    0x63F0, 0x6C51, 0x8D35, 0xAE39, 0xDFDF, 0xBEBB, 0xCF1D, 0xCF1C,
-    0xAE59, 0xC6FB, 0xB67A, 0xE7FF, 0xDFBF, 0xE7DF, 0xC6FC, 0xDF9E,
-    0xCF7D, 0xBEDB, 0xC73D, 0xDFDF, 0xDFBF, 0xD79E, 0xDF9E, 0xDFBF,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBE,
-    0xDFBF, 0xDFBE, 0xDF9E, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE, 0xDFBE,
-    0xDFBF, 0xD79E, 0xDF9E, 0xDF9E, 0xDF9E, 0xE7BF, 0xE7DF, 0xCF3C,
-    0xC71B, 0xD77D, 0xADF4, 0xCEFA, 0xDFBE, 0xCEB8, 0xBE35, 0xBE35,
-    0xDF9E, 0xCF1B, 0xD79D, 0xBE15, 0xC613, 0xE7BD, 0x84B3, 0x9D53,
-    0xD6F7, 0xC6FB, 0x9D53, 0xC656, 0xCF3B, 0x9510, 0xB617, 0xE79D,
-    0xC6B8, 0xCF5C, 0xB636, 0xD75C, 0xDFBF, 0xDFBF, 0xD77D, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0x39E7, 0x2943, 0x6B6B,
-    0x5B0B, 0x3A28, 0x3A28, 0x636E, 0xD73D, 0xCF1C, 0xD73D, 0xE7FF,
-    0xE7FF, 0xDFFF, 0xE7FF, 0xDFDF, 0xEFFF, 0x4ACB, 0x63AF, 0xEFFF,
-    0x8D15, 0xBEDB, 0xE7FF, 0xAE39, 0x6411, 0x4B0D, 0x1146, 0x1126,
-    0x1966, 0x1945, 0x2145, 0x94F3, 0x6BCF, 0x8472, 0xC6FA, 0xC675,
-    0xBDD2, 0xB56F, 0xB570, 0xAD2E, 0xA4AB, 0x9C8B, 0xA4EC, 0xA4EC,
-    0xA4CC, 0x9C8B, 0x840A, 0x9C8B, 0x6328, 0x5B29, 0x83EA, 0x7BEA,
-    0x9CAC, 0x6B69, 0x8C4B, 0x948C, 0x842B, 0x73A9, 0xA4CD, 0x5328,
-    0x5B29, 0x7BEB, 0x7BEA, 0x5329, 0x32A8, 0x3AC9, 0x3AC9, 0x3AC9,
-    0x3AC9, 0x32A8, 0x4B29, 0x73CA, 0x5B69, 0x4B29, 0x534A, 0x3AE9,
-    0x32A9, 0x4B29, 0x6BAA, 0x52A7, 0x4A46, 0x62E7, 0x4A45, 0x5286,
-    0x8BEA, 0x946B, 0xA4CC, 0x8C2B, 0x7389, 0xAD0D, 0x9C8C, 0x7BC9,
-    0x948D, 0x4267, 0x3184, 0x5B29, 0x6349, 0x3A26, 0x6B28, 0x6308,
-    0x0881, 0x0861, 0x2184, 0x2184, 0x2184, 0x1923, 0x2144, 0x0000,
-    0x39A5, 0x5267, 0x2103, 0x0840, 0x10A2, 0x0020, 0x08E3, 0x08C3,
-    0x08A3, 0x08E3, 0x08C3, 0x08A3, 0x10E4, 0x1925, 0x2166, 0x2166,
-    0x1925, 0x1104, 0x2146, 0x29C8, 0x536E, 0x2166, 0x1104, 0x1966,
-    0x1125, 0x29C8, 0x1987, 0x534E, 0x7451, 0x3A8A, 0x21A7, 0x4B0C,
-    0x4B2D, 0x84D3, 0xC6FB, 0x7493, 0xB67A, 0x84F4, 0xB69A, 0x9576,
-    0xA5F8, 0xB659, 0xA5B7, 0xB638, 0xE7DF, 0xE7DF, 0x6C31, 0xCF1C,
-    0xB679, 0x7CD3, 0xD79E, 0xE7FF, 0xDF9F, 0xE7DF, 0xDFDF, 0xE7DF,
-    0xE7FF, 0xE7DF, 0xE7FF, 0xDF9F, 0xDFBF, 0xDFBE, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xDFBF, 0xDF9E, 0xDFBE, 0xDFBF, 0xDFBE, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xE7FF, 0xDFBE, 0xE7DF, 0xDFBF, 0xDFBE, 0xD79E,
-    0x9DB5, 0xD77D, 0xDFBF, 0xDFBF, 0xDF7D, 0xCEB8, 0xD6F9, 0xC676,
-    0x9D73, 0xA5B4, 0xBE35, 0xB590, 0xC656, 0xBE13, 0xBDF2, 0xCE97,
-    0xDF7C, 0xAD70, 0xADB3, 0xCE75, 0xCE54, 0xDF3A, 0xD71B, 0xA593,
-    0xA550, 0xB616, 0xA553, 0xB591, 0xC698, 0xA551, 0x9D31, 0xDF5C,
-    0xC634, 0xADB3, 0xB5D4, 0xD75B, 0xDFBF, 0xDFFF, 0xC697, 0xCEFA,
-    0xDFDF, 0xDF9E, 0xDFBF, 0xDF9E, 0xE7FF, 0xA596, 0x3185, 0x4A25,
-    0x2923, 0x3184, 0x39C4, 0x39A5, 0x10A2, 0x0861, 0x2124, 0x73EF,
-    0xADB4, 0xBE36, 0x7C30, 0x9535, 0xD75D, 0x4AAB, 0xC6FC, 0xDFBF,
-    0xDFDF, 0xD7BE, 0xD79E, 0xE7DF, 0xEFFF, 0xCF1C, 0x9D97, 0x7CB3,
-    0x430E, 0x430D, 0xA596, 0x7430, 0xC656, 0xC633, 0xA54F, 0x946A,
-    0xB52D, 0xA4CC, 0x948B, 0x8C6B, 0x8C2B, 0xA4CD, 0x7BEA, 0x7BEA,
-    0x944B, 0x946B, 0x7BCA, 0x9C8B, 0x73A9, 0x4B08, 0x6369, 0x7BEA,
-    0x5AE7, 0x5AE7, 0x946B, 0x7BCA, 0x52E8, 0x6369, 0x5329, 0x42E9,
-    0x534A, 0x4309, 0x4B4A, 0x3B09, 0x3B09, 0x3AE9, 0x3AE9, 0x3AC9,
-    0x3AC9, 0x32A8, 0x4B29, 0x6BAA, 0x638A, 0x4B09, 0x6BCB, 0x6BCA,
-    0x638A, 0x73EB, 0x7BEA, 0x6369, 0x7BAA, 0x6B28, 0x6B28, 0x4225,
-    0x946B, 0x83CA, 0xA4AC, 0xAD0D, 0x8C2A, 0x946B, 0x8C2A, 0x948C,
-    0x6B48, 0xA4AC, 0x8C4C, 0x42A7, 0x636A, 0x3206, 0x6B6A, 0x2964,
-    0x0020, 0x0000, 0x0040, 0x1964, 0x10C2, 0x10A2, 0x5267, 0x4A05,
-    0x20E2, 0x10A2, 0x0020, 0x2103, 0x5247, 0x4A47, 0x634A, 0x5AE9,
-    0x52A8, 0x4A88, 0x31E7, 0x21C7, 0x2A29, 0x326A, 0x322A, 0x21C8,
-    0x29E8, 0x2A09, 0x21C8, 0x536E, 0xCEFC, 0x84B3, 0x9DB7, 0x7492,
-    0x84F4, 0xB639, 0x7CB3, 0xC6FC, 0xE7FF, 0xC6FC, 0x84D3, 0xAE18,
-    0x9DB7, 0xD75D, 0xF7FF, 0xBE9A, 0xCF3D, 0xDFBF, 0xE7FF, 0x9DD8,
-    0xC71C, 0xDFDF, 0xCF1C, 0xDF9E, 0xDFBE, 0xDFBE, 0xC6DB, 0xE7BF,
-    0xE7FF, 0xBEBB, 0xD77E, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xE7DF, 0xD75C, 0xC6DA, 0xDFDF, 0xBE57,
-    0xB616, 0xE7DF, 0xB658, 0xE7DF, 0xCEFA, 0xD73C, 0xDFBF, 0xDFDF,
-    0xB615, 0xCED9, 0xCF3C, 0xD77D, 0xDFDF, 0xCE96, 0xC5D1, 0xBDF3,
-    0xAD71, 0xBE35, 0xB590, 0xAD0D, 0xAD2F, 0x946B, 0xA4CD, 0xCE55,
-    0xD6F8, 0xA50E, 0xAD50, 0xB54F, 0xA50F, 0xCE97, 0xD6B7, 0xC655,
-    0x8C6C, 0xB5D3, 0x8470, 0xBDD3, 0xA530, 0x8C6D, 0x8C8F, 0xAD51,
-    0x7C0B, 0xAD92, 0xB5B2, 0xA531, 0xE7FF, 0xCF5D, 0x9D11, 0xCEB8,
-    0xCF3C, 0xDFDF, 0xD79E, 0xDF9E, 0xDF9E, 0xD75D, 0x4B4D, 0x0000,
-    0x2103, 0x4A26, 0x41E5, 0x39C5, 0x3164, 0x41E5, 0x6AE8, 0x8BEB,
-    0x4A25, 0x2102, 0x0000, 0x6BAF, 0x9DB7, 0x5B4E, 0xDFDF, 0xD79F,
-    0xDFBF, 0xD79E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xF7FF, 0xBE79,
-    0xBE57, 0xDF19, 0x8C70, 0x2145, 0x5287, 0x5287, 0x6B69, 0x6B49,
-    0x6B89, 0x6369, 0x6BAA, 0x7C0B, 0x52C8, 0x6B49, 0x5308, 0x6B8A,
-    0x842B, 0x6BAA, 0x6BA9, 0x8C2B, 0x73CA, 0x4AE8, 0x5B49, 0x5308,
-    0x4AC8, 0x52E8, 0x4267, 0x29E5, 0x29C5, 0x3206, 0x21A5, 0x3267,
-    0x3288, 0x3267, 0x21C5, 0x3AA9, 0x3AA9, 0x3AC9, 0x430A, 0x3AC9,
-    0x3AC9, 0x3AE9, 0x3AC9, 0x3AA8, 0x3AC9, 0x3AC9, 0x3AE9, 0x4B29,
-    0x4B29, 0x4309, 0x73EB, 0x636A, 0x6BAA, 0x7BEB, 0x6369, 0x946B,
-    0x6B68, 0x73CA, 0x8C2A, 0xACEC, 0xA4CC, 0x9CCC, 0x7BEA, 0x840A,
-    0x8C2B, 0x946C, 0x4AE8, 0x3A46, 0x4AA7, 0x10E3, 0x0861, 0x2144,
-    0x1923, 0x18E3, 0x3206, 0x42A8, 0x0861, 0x0020, 0x18E2, 0x3184,
-    0x31A4, 0x3185, 0x41E5, 0x2923, 0x1081, 0x18C2, 0x2923, 0x2103,
-    0x3184, 0x4205, 0x4A26, 0x736A, 0x39E6, 0x534D, 0x7CB3, 0x8D35,
-    0x7452, 0x328B, 0x6C52, 0x63F1, 0xBE9A, 0x8D14, 0xBE9A, 0x8D55,
-    0xF7FF, 0xE7DF, 0xEFFF, 0xE7DF, 0xDF9F, 0xDFDF, 0xE7FF, 0xE7FF,
-    0xC6FC, 0xD77E, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xD79E, 0xE7FF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xD77D, 0xE7FF, 0xCEB8, 0xBE15, 0xEFFF, 0xADF6,
-    0x9532, 0xE7DF, 0xAD92, 0xD6F9, 0xBE36, 0xCED9, 0xDF9E, 0xC698,
-    0xD73A, 0xAD72, 0xCE97, 0x9510, 0x7C91, 0xD6B6, 0xB56E, 0x73EA,
-    0x844C, 0xB5B2, 0x7BCA, 0xA4ED, 0x7389, 0x62E7, 0xA4CC, 0x948C,
-    0x8C6D, 0x9C8C, 0x946B, 0x9C8B, 0x6348, 0xA551, 0x9CAD, 0x842B,
-    0x840A, 0x8C8D, 0x9CF0, 0xA531, 0x636C, 0xAD2E, 0x94CE, 0x7C0C,
-    0x4AA7, 0x948C, 0x7BEB, 0x6B69, 0xD73B, 0xD77D, 0x846E, 0xCE97,
-    0xAD92, 0x8CCF, 0xCEFA, 0xE7FF, 0xA595, 0xA5D7, 0x32AB, 0x2186,
-    0x0000, 0x0000, 0x0820, 0x1081, 0x18E2, 0x20E2, 0x20E2, 0x18C2,
-    0x0000, 0x0862, 0x31E8, 0xDF9E, 0x9555, 0x6BF0, 0xFFFF, 0xCF1B,
-    0xC6DB, 0xEFFF, 0xDF7C, 0xA532, 0x94D0, 0xA531, 0x73AB, 0x5AC8,
-    0x6B08, 0x83A9, 0x5AA6, 0x4A05, 0x41C4, 0x39C4, 0x2923, 0x2102,
-    0x2143, 0x4A88, 0x31E5, 0x31C5, 0x3A05, 0x4246, 0x3A47, 0x4267,
-    0x3206, 0x19C5, 0x3226, 0x7BCA, 0x2964, 0x31E6, 0x2185, 0x0881,
-    0x29A5, 0x0000, 0x18E3, 0x0881, 0x1925, 0x1925, 0x10C3, 0x1904,
-    0x1904, 0x1925, 0x10A3, 0x0861, 0x0020, 0x0020, 0x0061, 0x10C2,
-    0x2185, 0x2A06, 0x2A47, 0x3B09, 0x3AE9, 0x3AE9, 0x3AE9, 0x3AE9,
-    0x3AC9, 0x32C9, 0x4309, 0x3AC9, 0x3AC8, 0x4B09, 0x3AC8, 0x42E9,
-    0x6368, 0x8C4B, 0x7BA9, 0xACED, 0x73CA, 0x6BA9, 0x7BEA, 0x2943,
-    0x942B, 0x7C0B, 0x3267, 0x31E5, 0x52E8, 0x1944, 0x0000, 0x29A5,
-    0x1903, 0x0000, 0x0040, 0x3A06, 0x3208, 0x0862, 0x0000, 0x0000,
-    0x0020, 0x0840, 0x18C2, 0x2923, 0x2123, 0x3184, 0x39A5, 0x3184,
-    0x41E5, 0x5AA7, 0x39A4, 0x18E2, 0x0020, 0x8CF4, 0xD77D, 0xCF5D,
-    0x9DD7, 0x5BAF, 0xDFBE, 0x8D35, 0xBEDB, 0x9555, 0xE7DF, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xE7FF, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDF9E,
-    0xDFDF, 0xCED9, 0xC697, 0xD71A, 0xB5D3, 0xBE57, 0xCEFA, 0xE77C,
-    0x94F0, 0xC71A, 0xA4EE, 0xBE34, 0xB5D3, 0xBE14, 0xC635, 0xBDF4,
-    0xCE98, 0xACED, 0xBE13, 0x52E6, 0x638B, 0xCE75, 0x73E9, 0x944B,
-    0x840A, 0x7BEA, 0x6328, 0x9CAC, 0x944B, 0x83CA, 0xA4AC, 0x7BA9,
-    0x7389, 0x8C2B, 0x840A, 0x8C4B, 0x73A9, 0x738B, 0x5286, 0x8C4B,
-    0x73EA, 0x5328, 0xB5B1, 0x842C, 0x4A87, 0x7BCA, 0x5AE8, 0x3A26,
-    0x4AE8, 0x6349, 0x6B69, 0x7C0B, 0x94F1, 0x73EE, 0x63AB, 0x846E,
-    0x7BEA, 0x4266, 0x84B0, 0xCEB9, 0xAD94, 0xCEFA, 0xD73A, 0x8D55,
-    0x6C31, 0x5BF0, 0x53CF, 0x11A7, 0x0882, 0x0840, 0x0840, 0x0841,
-    0x0861, 0x4A67, 0x842E, 0x8C4E, 0x632A, 0x4A68, 0x6B6D, 0x5AC7,
-    0x4A66, 0x8C6F, 0x840B, 0x83C9, 0x83CA, 0x7348, 0x5244, 0x5A86,
-    0x5A85, 0x5A65, 0x62C6, 0x6AE6, 0x6B07, 0x6B07, 0x5AC6, 0x5AA6,
-    0x4A25, 0x39A4, 0x3184, 0x3163, 0x4A25, 0x4A66, 0x2964, 0x1081,
-    0x18C1, 0x2943, 0x39C4, 0x8C0A, 0x6B48, 0x6328, 0x4205, 0x41E5,
-    0x3184, 0x2123, 0x39C5, 0x41E5, 0x3164, 0x4A47, 0x5B6E, 0x6C13,
-    0x6414, 0x9599, 0xA5D9, 0x5B90, 0x5B4F, 0x428B, 0x426A, 0x0041,
-    0x0000, 0x1923, 0x21C5, 0x3288, 0x3AC9, 0x3AC9, 0x3AA8, 0x3A88,
-    0x32A8, 0x3AC9, 0x3288, 0x32C9, 0x3AC9, 0x32C9, 0x32C9, 0x32A9,
-    0x6B89, 0x9CAC, 0x842B, 0x73A9, 0x6389, 0x6B8A, 0x73AA, 0x5AA7,
-    0x5287, 0x42C8, 0x3247, 0x29C5, 0x21C5, 0x10A2, 0x0000, 0x0882,
-    0x08A2, 0x10C3, 0x10A3, 0x10E4, 0x1925, 0x2146, 0x3209, 0x3229,
-    0x10E4, 0x10E4, 0x0021, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x6B8E, 0xE7BF, 0xE7BF, 0xE7FF,
-    0x8D15, 0xA619, 0xDFDF, 0xD79E, 0xD7BF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xE7DF, 0xE7DF, 0xEFFF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F,
-    0xDFBF, 0xD75D, 0xB618, 0xE7DF, 0xDFDF, 0xE7DF, 0xDFBE, 0xDFBE,
-    0xDFDF, 0xCED9, 0xBE34, 0xBE14, 0xBDF4, 0xCED8, 0xA572, 0xDF7C,
-    0xB637, 0xCEFA, 0x94AE, 0xB591, 0x842B, 0x6B68, 0x8CAF, 0xC5F2,
-    0x842B, 0x946B, 0x8C4B, 0x840A, 0x8C8C, 0xAD4F, 0x4AE7, 0x9CAC,
-    0x5B08, 0x5349, 0x7C2B, 0x946B, 0x9CCC, 0x83EA, 0x6B28, 0x8C2B,
-    0x52C7, 0x62E8, 0x8C6C, 0x52C8, 0x5AC7, 0x4205, 0x52A7, 0x7BC9,
-    0x73EB, 0x536A, 0x9CAC, 0x4AA7, 0x532A, 0x31C5, 0x5B29, 0x5309,
-    0x94AD, 0x6349, 0x638A, 0x8C8C, 0x4246, 0x3205, 0x5349, 0x6BAA,
-    0x52E9, 0x2184, 0x4AC7, 0x3A26, 0x4226, 0x29A5, 0x6B69, 0x534C,
-    0x9D96, 0xA595, 0x9D74, 0x7C2E, 0x948D, 0xA4CD, 0xA4CD, 0x946C,
-    0x7349, 0x5285, 0x49E3, 0x49E3, 0x5245, 0x5225, 0x41E4, 0x5A86,
-    0x5245, 0x20E1, 0x39A4, 0x2103, 0x39A4, 0x5AA7, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x62A6, 0x62A6, 0x5AA6, 0x62A6, 0x62C6, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x62C6, 0x62C6, 0x6B07, 0x7348, 0x7368, 0x7BA9, 0x7BAA,
-    0x83CA, 0x8C2A, 0x8C2A, 0x8C2A, 0x8C0A, 0x83E9, 0x944B, 0x942A,
-    0x9C6C, 0x942B, 0x83EA, 0x83C9, 0x7368, 0x83C9, 0x83EA, 0x73EE,
-    0x7410, 0x7C71, 0xA5F8, 0xB69C, 0xAE7C, 0xAE7C, 0xA5FA, 0x5BD0,
-    0x4B0D, 0x1924, 0x1103, 0x1944, 0x3268, 0x2A67, 0x2A27, 0x21C5,
-    0x21E6, 0x3288, 0x21E6, 0x21A5, 0x2A47, 0x2A47, 0x2A47, 0x32A8,
-    0x73C9, 0x842B, 0x6389, 0x5B48, 0x5B69, 0x73EB, 0x3164, 0x31E5,
-    0x29E6, 0x3247, 0x3A87, 0x29C5, 0x29E6, 0x0061, 0x0000, 0x0841,
-    0x10A3, 0x3229, 0x29C8, 0x29E8, 0x42AC, 0x5B8F, 0x5B4E, 0x63B0,
-    0x7C92, 0x638F, 0x42AC, 0x29C9, 0x31E9, 0x1946, 0x1946, 0x10C4,
-    0x10C3, 0x10E4, 0x0020, 0x52CB, 0xF7FF, 0xDF9E, 0xDF9F, 0xE7BF,
-    0xC6FC, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xDF9E, 0xE7FF, 0xEFFF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0x5B0C, 0xB618, 0xE79E, 0xADD7,
-    0xD77E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xE7DF, 0xDF9E, 0x8CF3, 0xB659, 0xCEB9, 0xBE36, 0xDF3C, 0xB637,
-    0xDFDF, 0xD73B, 0xBDB1, 0x94AF, 0xB5D3, 0xA530, 0xAD92, 0xC675,
-    0xBDF3, 0x9CCE, 0x842B, 0x840B, 0x842B, 0x946C, 0x5B4A, 0x844C,
-    0x8C2A, 0x8C2A, 0x948B, 0x9CCC, 0x840A, 0x840A, 0x5308, 0x73AA,
-    0x5B29, 0x7C0B, 0x9CAC, 0x8C4B, 0x7BEA, 0x6349, 0x6B69, 0x7BEB,
-    0x42E9, 0x6369, 0x9C8C, 0x3205, 0x4A87, 0x4AA7, 0x4A87, 0x6B28,
-    0x9CAD, 0x5B49, 0x6328, 0x3A26, 0x638A, 0x6BAA, 0x5B4A, 0x4AC9,
-    0x52C8, 0x3A06, 0x29A4, 0x73EB, 0x2164, 0x4AA7, 0x4287, 0x1903,
-    0x3A47, 0x31E5, 0x3A06, 0x0000, 0x39C5, 0x1081, 0x3184, 0x3162,
-    0x4A24, 0x5A65, 0x83C9, 0xBD4E, 0xBD6F, 0xAD0D, 0xA4AC, 0x8C0A,
-    0x8C0A, 0x7BA9, 0x7B89, 0x7B68, 0x7348, 0x7368, 0x62C6, 0x5A86,
-    0x5AA6, 0x39A4, 0x39A4, 0x39A4, 0x3164, 0x2964, 0x4A05, 0x62C6,
-    0x5AA6, 0x62A6, 0x62C6, 0x62E7, 0x62E6, 0x6AE6, 0x7348, 0x6B07,
-    0x6B07, 0x6B07, 0x6B07, 0x83C9, 0x8C0A, 0x8C0A, 0x942A, 0x8C0A,
-    0x8C0A, 0x8BEA, 0x8C0A, 0x8C0A, 0x8C0A, 0x8BEA, 0x8C2A, 0x8C2A,
-    0x8C0A, 0x9C6B, 0x8C0A, 0x7BA8, 0x7BA9, 0x83C9, 0x8BE9, 0x83C8,
-    0x7B88, 0x7BA8, 0x6B69, 0x8C6E, 0x94F1, 0x8CD2, 0x7C92, 0xA63A,
-    0xB6BD, 0x7CB4, 0x29C7, 0x2145, 0x1965, 0x2A07, 0x2207, 0x3268,
-    0x3289, 0x3AEA, 0x3AEA, 0x3268, 0x32A9, 0x3288, 0x2A47, 0x2A68,
-    0x7BEA, 0x7C0A, 0x6BAA, 0x5B89, 0x2A26, 0x6369, 0x5AA7, 0x29E5,
-    0x3A87, 0x21C5, 0x3A87, 0x0881, 0x0020, 0x0020, 0x0020, 0x29A7,
-    0x3A29, 0x42CC, 0x4AED, 0x3A8C, 0x5B6F, 0x7C52, 0x7C72, 0xA5D8,
-    0xEFFF, 0xE7FF, 0xC6FC, 0xAE19, 0xAE39, 0xAE39, 0x534E, 0x3A4A,
-    0x2187, 0x29C8, 0x2187, 0x1925, 0x9D97, 0xEFFF, 0xDF9E, 0xDFBF,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xEFFF,
-    0xE7FF, 0xF7FF, 0xA576, 0x6B8E, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFDF, 0xCEDB, 0x4229, 0x31C7, 0x5B2C,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC698,
-    0xCED9, 0xE7FF, 0xE7DF, 0xB5F6, 0x94D0, 0x9CEF, 0xDF1A, 0xC698,
-    0xC6B9, 0xB5F3, 0x9C8C, 0x3A66, 0x8C4C, 0x7BC9, 0x6328, 0xB56F,
-    0x946B, 0x3A66, 0x5329, 0x5B28, 0x5B29, 0x5B29, 0x5B28, 0x6B69,
-    0x8C4B, 0x8C4B, 0x73CA, 0x73CA, 0x73A9, 0x944B, 0x944B, 0x840B,
-    0x6B8A, 0x73AA, 0x7BCA, 0x7C0A, 0x946C, 0x7389, 0x73A9, 0x31E5,
-    0x3267, 0x4A87, 0x6307, 0x73CA, 0x946B, 0x6B69, 0x6B69, 0x7BA9,
-    0x5AE8, 0x4A88, 0x4A26, 0x4A87, 0x946C, 0x6369, 0x1985, 0x3A47,
-    0x1104, 0x0000, 0x08A2, 0x3A88, 0x2144, 0x18C2, 0x0861, 0x0840,
-    0x3184, 0x3184, 0x2943, 0x5A87, 0x5286, 0x6B08, 0x8C0A, 0x8C0A,
-    0x6B07, 0x6B27, 0x83A9, 0x7B89, 0x83CA, 0x944B, 0xA4AC, 0xA4AC,
-    0xACCD, 0xACED, 0xACCD, 0xACED, 0xACED, 0x9C8C, 0x8BEA, 0x83A9,
-    0x62E7, 0x62C7, 0x5AA6, 0x62C6, 0x5AA6, 0x5A86, 0x62A6, 0x62A6,
-    0x5AA6, 0x62A6, 0x5A85, 0x7BA9, 0x83A9, 0x7BA9, 0x944B, 0x8C2A,
-    0x8C2A, 0x83EA, 0x942B, 0x8BEA, 0x8C0A, 0x942A, 0x8C0A, 0x8BEA,
-    0x8BEA, 0x8BEA, 0x83C9, 0x83E9, 0x8C0A, 0x942A, 0x8C2A, 0x8C0A,
-    0x8BEA, 0x7389, 0x83EA, 0x8BEA, 0x8C0A, 0x8BEA, 0x8BE9, 0x8C0A,
-    0x944B, 0x8C2A, 0x8C2B, 0x7388, 0x8C2A, 0x7BC9, 0x6B69, 0x5B2B,
-    0x4B0D, 0x6C11, 0x6C12, 0x5B8F, 0x5B6F, 0x2125, 0x0882, 0x0040,
-    0x0881, 0x1103, 0x10E3, 0x1103, 0x10C2, 0x2185, 0x21C6, 0x3268,
-    0x6389, 0x7C0A, 0x73CA, 0x3AE8, 0x19A4, 0x4AC8, 0x2984, 0x29E5,
-    0x3227, 0x10E3, 0x3226, 0x0000, 0x0020, 0x10E4, 0x1904, 0x3209,
-    0x42AC, 0x4AED, 0x534E, 0x63D1, 0xADF8, 0x6BF0, 0x9535, 0xCF3D,
-    0xDFBF, 0xD79E, 0xDFDF, 0xE7FF, 0xE7FF, 0xE7FF, 0xD77D, 0xBE9A,
-    0x7C72, 0x4ACC, 0x322B, 0x326C, 0x2A09, 0xCEDB, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0x9535,
-    0x9D55, 0x7410, 0x4AAB, 0xB638, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xE7FF, 0x8CF3, 0x7C31, 0xEFFF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xCF1B,
-    0xADB3, 0xBE78, 0xDF7D, 0xA552, 0x842D, 0x946C, 0xC614, 0xA531,
-    0x8CAE, 0x9C8B, 0x946B, 0x73CA, 0x9C8C, 0x6308, 0x31E5, 0x9CAE,
-    0x73AA, 0x42C8, 0x5B29, 0x7BEA, 0x52E8, 0x4AC7, 0x73CA, 0x7BCA,
-    0x6349, 0x6BCA, 0x5B28, 0x7BCA, 0x73EA, 0x842B, 0x5AC7, 0x4AE8,
-    0x5B49, 0x6B48, 0x73A9, 0x73EB, 0x6349, 0x6308, 0x4A66, 0x0861,
-    0x3226, 0x5AE9, 0x4205, 0x6B89, 0x844B, 0x6369, 0x6B89, 0x9CAC,
-    0x3A46, 0x2A06, 0x31A4, 0x08A2, 0x2985, 0x2164, 0x3A67, 0x4267,
-    0x1903, 0x1903, 0x3A06, 0x29A5, 0x4247, 0x7369, 0x7B89, 0x7369,
-    0x83EA, 0x8C0A, 0x942B, 0x944B, 0x942B, 0x944B, 0x9C4B, 0xA4AC,
-    0x8C0A, 0x83EA, 0x7348, 0x7348, 0x6B07, 0x62C7, 0x6AE7, 0x7368,
-    0x7348, 0x7348, 0x6B07, 0x7348, 0x8C0A, 0x944B, 0x9C6B, 0x942A,
-    0x83EA, 0x83CA, 0x62E7, 0x5A85, 0x62C6, 0x62C6, 0x5AA6, 0x6B07,
-    0x7348, 0x6B27, 0x83A9, 0x6B07, 0x62C6, 0x62E6, 0x62C6, 0x62E6,
-    0x62E6, 0x5AC6, 0x5AA6, 0x5AA6, 0x5A86, 0x62E7, 0x7BA9, 0x8BE9,
-    0x8C0A, 0x83E9, 0x83C9, 0x83C9, 0x8C2A, 0x944B, 0x7BC9, 0x6308,
-    0x5B28, 0x42C8, 0x42A7, 0x6369, 0x6B69, 0x6349, 0x6349, 0x5B28,
-    0x4AA7, 0x3A26, 0x3246, 0x2184, 0x3A26, 0x3A67, 0x21E5, 0x1902,
-    0x2165, 0x428B, 0x63D0, 0x7CF5, 0x6C73, 0x6C12, 0x5B8F, 0x3208,
-    0x3208, 0x2165, 0x0882, 0x1904, 0x31E8, 0x3A49, 0x10E4, 0x10C3,
-    0x6BCA, 0x8C4B, 0xA4CC, 0x7C2B, 0x2184, 0x2985, 0x10A2, 0x29C5,
-    0x29A5, 0x0841, 0x0861, 0x0000, 0x2166, 0x29C8, 0x1105, 0x42CC,
-    0x9556, 0x6C11, 0xB65A, 0x63D0, 0xC6FC, 0x9535, 0xAE18, 0xEFFF,
-    0xDF9E, 0xDFBF, 0xDFBE, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFDF,
-    0xEFFF, 0xD77E, 0xB659, 0xB67A, 0x9D97, 0xCEFC, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xE7DF, 0x9535,
-    0x39E7, 0x1082, 0x9D75, 0xEFFF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xE7FF, 0xDF9F,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xEFFF,
-    0xBE35, 0x740D, 0xAD52, 0x7BC9, 0x83C9, 0x9C6B, 0xB570, 0x7389,
-    0x842B, 0x9C8B, 0x9C8C, 0x7389, 0xACED, 0x52C7, 0x5B08, 0x6328,
-    0x6349, 0x5B29, 0x6BAA, 0x946B, 0x7BEA, 0x7BEA, 0x6B69, 0x73A9,
-    0x5B08, 0x29A4, 0x5B29, 0x8C6C, 0x5308, 0x4AE8, 0x5B28, 0x3267,
-    0x6369, 0x7BCA, 0x6349, 0x5B29, 0x5B08, 0x6B29, 0x4226, 0x0041,
-    0x3A06, 0x5267, 0x4A46, 0x4AC8, 0x2A06, 0x4266, 0x4266, 0x3A27,
-    0x10C2, 0x08A2, 0x0840, 0x1924, 0x1965, 0x1964, 0x1903, 0x1082,
-    0x18E2, 0x3A06, 0x31A4, 0x2984, 0x5AC7, 0x62C6, 0x62E7, 0x6B07,
-    0x6AE6, 0x6AE6, 0x62E6, 0x62E6, 0x62E7, 0x7327, 0x6B07, 0x7327,
-    0x9C6B, 0xA48C, 0x946B, 0x9C4B, 0x942A, 0x83CA, 0x7348, 0x7B89,
-    0x7368, 0x62E7, 0x6B27, 0x83EA, 0x9C6B, 0x8C0A, 0x7B89, 0x83CA,
-    0x83CA, 0x8C0A, 0x7B69, 0x7368, 0x7369, 0x7348, 0x6B28, 0x62E7,
-    0x7B89, 0x7348, 0x7368, 0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6,
-    0x5AC6, 0x5AC6, 0x5AA6, 0x5AA6, 0x5AC6, 0x7368, 0x8C0A, 0x8BEA,
-    0x8BEA, 0x9C6B, 0x942A, 0x7B89, 0x52C7, 0x4A66, 0x31E5, 0x1984,
-    0x2A06, 0x1103, 0x1985, 0x19A5, 0x10E3, 0x1903, 0x1103, 0x0881,
-    0x1964, 0x21E6, 0x1103, 0x10E3, 0x08C2, 0x08A2, 0x1925, 0x3A6A,
-    0x8D15, 0xA61A, 0x7494, 0x8536, 0x7D16, 0x8536, 0x9DD9, 0x8D77,
-    0x9577, 0x74B4, 0x7494, 0x6C53, 0x74B5, 0x6C33, 0x5BB0, 0x63B0,
-    0x42C8, 0x6389, 0xB54D, 0x8C6B, 0x3267, 0x3267, 0x2A06, 0x1923,
-    0x1903, 0x0000, 0x0000, 0x10A3, 0x3A4A, 0x4B0E, 0x5B8F, 0x7452,
-    0xDF7D, 0x9DB7, 0xCF5E, 0xB69A, 0xDFDF, 0xBEBB, 0xCF1C, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xDFBF, 0xE7FF, 0xE7FF, 0xEFFF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7DF, 0xE7DF, 0xCF3D,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF,
-    0xDFBF, 0xDF9E, 0xD77E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xDF9E, 0xB679, 0xAE17,
-    0x9D53, 0x73CC, 0x5B08, 0x83EA, 0x8C4B, 0x6328, 0x8C0A, 0x6B69,
-    0x6349, 0x9C8B, 0x9CAC, 0x83CA, 0x9C6C, 0x8C0A, 0x6328, 0x2984,
-    0x840A, 0x6B49, 0x6B69, 0x6349, 0x7BEA, 0x946B, 0x52C7, 0x5AE8,
-    0x39C4, 0x3A05, 0x3227, 0x4B4B, 0x3247, 0x2184, 0x5B49, 0x3246,
-    0x4B29, 0x4A87, 0x2964, 0x29A5, 0x31C4, 0x18E2, 0x0861, 0x0041,
-    0x0020, 0x0000, 0x0882, 0x10E3, 0x19A5, 0x2A06, 0x4267, 0x3206,
-    0x21A5, 0x1923, 0x0020, 0x2964, 0x2963, 0x31E6, 0x10C2, 0x18C2,
-    0x39E5, 0x4226, 0x39E5, 0x4226, 0x4225, 0x5AA6, 0x62C6, 0x5AC6,
-    0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62A6, 0x5AA6,
-    0x6B07, 0x7B68, 0x7348, 0x7348, 0x7328, 0x7B89, 0x7B89, 0x7B89,
-    0x8C0B, 0x942B, 0x942B, 0x8C2B, 0x7BA9, 0x6B28, 0x5265, 0x6B28,
-    0x5266, 0x4A45, 0x5265, 0x5A86, 0x5AA6, 0x62E7, 0x5A86, 0x5A86,
-    0x5A86, 0x5A86, 0x5A65, 0x5A86, 0x5AA6, 0x5A86, 0x62C6, 0x7348,
-    0x7348, 0x62E6, 0x7368, 0x6B27, 0x83C9, 0x83EA, 0x7BA9, 0x7BA9,
-    0x5AE7, 0x4A87, 0x52A7, 0x4A67, 0x21A5, 0x29C6, 0x08A2, 0x0881,
-    0x0882, 0x0000, 0x0842, 0x0042, 0x0021, 0x0041, 0x0021, 0x18E4,
-    0x3229, 0x29C7, 0x08A3, 0x3229, 0x4B4E, 0x63F1, 0x6412, 0xA63A,
-    0xAE5B, 0xA5F9, 0x9DF9, 0x95D8, 0x95B8, 0x8D77, 0x7CF5, 0x7CF6,
-    0x8D77, 0x8D57, 0x74F6, 0x7D16, 0x74B5, 0x7494, 0x7CF6, 0x8516,
-    0x42E8, 0x842B, 0x8C4B, 0x842B, 0x29E5, 0x3267, 0x3A88, 0x10C2,
-    0x0841, 0x0000, 0x0000, 0x2146, 0x3209, 0x3AAC, 0x536F, 0x84B4,
-    0xEFFF, 0xE7FF, 0xDFBF, 0xDFDF, 0xDF9E, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xEFFF, 0xEFDF, 0x6BF0, 0x84B3,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xEFFF, 0x9DB6, 0xBEBA, 0xD79E, 0x740D,
-    0x6BCD, 0x7BEA, 0x3A66, 0x7BCA, 0x6B89, 0x42A8, 0x6349, 0x840B,
-    0x6349, 0x7BCA, 0xA4AC, 0x7BA9, 0x6328, 0x944B, 0x4246, 0x4205,
-    0x9C4B, 0xA48C, 0x944B, 0x52E7, 0x3A87, 0x8C2B, 0x840A, 0x4226,
-    0x1081, 0x7BC9, 0x1081, 0x21C6, 0x00A2, 0x3206, 0x10E2, 0x3A25,
-    0x434A, 0x10E2, 0x18C2, 0x18E2, 0x2164, 0x1903, 0x0861, 0x2207,
-    0x3288, 0x2A27, 0x4288, 0x31A5, 0x4A66, 0x52C7, 0x5AC7, 0x6AE7,
-    0x5AE7, 0x62E7, 0x5286, 0x5A86, 0x5286, 0x5286, 0x5286, 0x5AC7,
-    0x5AC7, 0x52A7, 0x5AC7, 0x62C7, 0x5AA6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5A85, 0x5AA6, 0x5A86, 0x5AC6, 0x41E4, 0x2943, 0x5A86,
-    0x5AA6, 0x5286, 0x5A86, 0x5AA6, 0x62C7, 0x6B08, 0x6B48, 0x83C9,
-    0x7B88, 0x7348, 0x7BAA, 0x7BA9, 0x83EA, 0x8C0A, 0x7B89, 0x7BA9,
-    0x7BA9, 0x7B68, 0x83EA, 0x7368, 0x7B89, 0x7BA9, 0x7B89, 0x83C9,
-    0x8BEA, 0x83EA, 0x8C0A, 0x8C09, 0x8C2A, 0x7389, 0x3A05, 0x2143,
-    0x2144, 0x1924, 0x0861, 0x0861, 0x0020, 0x1904, 0x29C8, 0x2167,
-    0x21A8, 0x2187, 0x4B0D, 0x6C53, 0x63D0, 0x42ED, 0x4B2E, 0x6412,
-    0x8516, 0x8537, 0x7494, 0x7CF6, 0x95B8, 0xAE5A, 0xA619, 0xA63A,
-    0xA5F9, 0xA61A, 0xA5F9, 0x9E19, 0xA61A, 0xA619, 0x8D57, 0x9598,
-    0x7CD5, 0x7CD5, 0x7CD5, 0x8536, 0x7CF6, 0x7CF6, 0x8D57, 0x8D57,
-    0x6389, 0x7C2B, 0x840A, 0x844B, 0x4266, 0x2A06, 0x3A67, 0x0861,
-    0x0000, 0x0000, 0x2166, 0x29C8, 0x42AC, 0x84D4, 0x84F4, 0x9556,
-    0xE7DF, 0xDF9E, 0xDFBF, 0xDF9E, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBE, 0x94F4, 0x5B2C, 0x2986, 0x94F4, 0xEFFF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xE7FF, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9E, 0xE7DF, 0xC6B9, 0xBE35, 0xDFDF, 0x84D3, 0xCF1B, 0xA572,
-    0x5B28, 0x73CA, 0x4AA7, 0x4266, 0x5309, 0x4A66, 0x6B8A, 0x7BEB,
-    0x8C2B, 0x52C8, 0x73AA, 0x83CA, 0x5286, 0x8C2B, 0x4267, 0x6B69,
-    0xA48C, 0xA4AC, 0x7348, 0x7BCA, 0x1123, 0x5B08, 0x7389, 0x3A67,
-    0x2984, 0x6B28, 0x29E6, 0x08C2, 0x2963, 0x6329, 0x0000, 0x4205,
-    0x3A26, 0x1081, 0x0000, 0x1081, 0x2102, 0x3184, 0x18E2, 0x3A06,
-    0x4A86, 0x52A6, 0x5AC7, 0x62C7, 0x62A6, 0x62A6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5A86, 0x5286, 0x5AA6, 0x6B07,
-    0x83CA, 0x8BEA, 0x7BA9, 0x7BA9, 0x83A9, 0x83A9, 0x7B89, 0x7BA9,
-    0x7BA9, 0x7368, 0x6B27, 0x62E7, 0x5AA6, 0x5AA6, 0x5AA6, 0x6B07,
-    0x6AE7, 0x6B07, 0x62C6, 0x5AA6, 0x62E6, 0x5A86, 0x5265, 0x62C6,
-    0x5A86, 0x5A86, 0x62E7, 0x6B28, 0x62E7, 0x7348, 0x83CA, 0x7B88,
-    0x8C2A, 0x8C0A, 0x942A, 0x942A, 0x83E9, 0x7B88, 0x8BEA, 0x8BEA,
-    0x83C9, 0x8BEA, 0x942B, 0x7BA9, 0x7348, 0x7348, 0x62C6, 0x6B28,
-    0x83C9, 0x8C0A, 0x944B, 0x7BA9, 0x62E7, 0x3164, 0x0040, 0x18E3,
-    0x0882, 0x1903, 0x31A5, 0x2124, 0x4249, 0x4268, 0x5B6C, 0x5B6C,
-    0x532C, 0x6C11, 0x8516, 0x9598, 0xA5F9, 0x9DD8, 0x9DD9, 0x8D57,
-    0x9DF9, 0xA61A, 0x9DD9, 0x9DF9, 0xA61A, 0xA619, 0xA63A, 0x9DF9,
-    0xAE7B, 0x7C73, 0x5B8F, 0xAE5A, 0x9DF9, 0x9E19, 0xA61A, 0xA63A,
-    0x8D77, 0x7CF5, 0x7CF6, 0x7CF5, 0x8536, 0x8D57, 0x8D57, 0x8516,
-    0x5349, 0x5B68, 0xA4CC, 0x9CAC, 0x73CA, 0x29E5, 0x1103, 0x0000,
-    0x0000, 0x2986, 0x6BF0, 0x7472, 0x7452, 0xC6DB, 0xBE9A, 0xE7DF,
-    0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBE, 0xE7DF, 0xCF1C, 0x7C30, 0x7C30, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDF9E, 0x8D14, 0xB6BB, 0xD77E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xDFDF, 0xADD5, 0xB617, 0x84B2, 0x846E, 0xB5D3,
-    0x636A, 0x3205, 0x7BAA, 0x21A4, 0x3A47, 0x6349, 0x4AC7, 0x4AE8,
-    0x840A, 0x52C8, 0x3A67, 0x942B, 0x942B, 0xAD0D, 0x52C7, 0x4AA7,
-    0x7389, 0xBD2D, 0x83EA, 0x73CA, 0x6B69, 0x7389, 0x5B28, 0x3A67,
-    0x73AA, 0x7BCA, 0x434A, 0x3AA8, 0x7369, 0x3164, 0x10C2, 0x39E5,
-    0x3184, 0x4A26, 0x31A4, 0x5AA7, 0x5AA6, 0x5A86, 0x5A86, 0x5AA6,
-    0x4A05, 0x5265, 0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x7348, 0x6B28, 0x7368, 0x8BEA, 0x8C0A,
-    0x942A, 0xA48C, 0x9C8C, 0x944B, 0x942B, 0x8BEA, 0x83EA, 0x7348,
-    0x6B07, 0x8BEA, 0x83EA, 0x6307, 0x5AA6, 0x62C6, 0x83A9, 0x8C0A,
-    0x8C2A, 0x8C0A, 0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x62E6, 0x62C6,
-    0x62C6, 0x5A85, 0x6B27, 0x942A, 0x940A, 0x942A, 0x940A, 0x8C0A,
-    0x8C2A, 0x8C0A, 0x8C0A, 0x8C0A, 0x83C9, 0x83E9, 0x83C9, 0x83C9,
-    0x83C9, 0x83C9, 0x62A6, 0x5AA6, 0x5A86, 0x5A86, 0x5AA6, 0x5AA6,
-    0x6307, 0x6B07, 0x7368, 0x62C6, 0x41E4, 0x6308, 0x73AA, 0x840B,
-    0x5B08, 0x6B69, 0x7B89, 0x6B48, 0x8C2C, 0x7389, 0x5286, 0x5286,
-    0x5286, 0x52E8, 0x84D3, 0x84F4, 0x95B8, 0xA619, 0xA5F9, 0xA63A,
-    0x9DFA, 0x9E1A, 0x9E1A, 0x9E1A, 0x9E1A, 0x9DF9, 0x9DD9, 0xA63A,
-    0xB67B, 0x42AC, 0x7473, 0xAE5B, 0x9DF9, 0x9E1A, 0x9DF9, 0x9DF9,
-    0xA61A, 0x9DD9, 0x95B8, 0x95B8, 0x9DFA, 0xA61A, 0xA61A, 0xA63A,
-    0x42E8, 0x73CA, 0x8C4B, 0x8C4B, 0x7C0B, 0x29C5, 0x4AC8, 0x0840,
-    0x10C3, 0x5B6E, 0x7C93, 0x8D35, 0x9DB7, 0xB67A, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xEFFF, 0xEFFF, 0xEFFF,
-    0xE7FF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xEFFF, 0xEFFF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xC71C, 0xD77E, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xE7FF, 0x9513, 0x8490, 0xD75D, 0xADD6, 0x6BCC,
-    0x5AE7, 0x31C5, 0x52A7, 0x3205, 0x3226, 0x42E8, 0x7C0B, 0x73A9,
-    0x7BCA, 0x3A67, 0x4AA8, 0x942B, 0x944B, 0x6B69, 0x7BCA, 0x29C5,
-    0x5329, 0x944B, 0x73A9, 0x7BEA, 0x8C0B, 0x944B, 0x73AA, 0x5B29,
-    0x6B69, 0xA4CC, 0x42A7, 0x4AC8, 0x7369, 0x2102, 0x3A26, 0x18E2,
-    0x6308, 0x5266, 0x2943, 0x41E4, 0x4205, 0x3184, 0x39A4, 0x5245,
-    0x5AA6, 0x4A45, 0x6B07, 0x5AA6, 0x41E4, 0x5265, 0x62C6, 0x5A86,
-    0x5AA6, 0x62C6, 0x7B89, 0x8BEA, 0x8BEA, 0x8C0A, 0x83E9, 0x8BEA,
-    0x8BEA, 0x8C0A, 0x83CA, 0x83A9, 0x83A9, 0x6AE7, 0x62C6, 0x62C6,
-    0x62A6, 0x5AA6, 0x62C6, 0x5AA6, 0x5AA6, 0x62E7, 0x7368, 0x62E6,
-    0x62C6, 0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x7348, 0x83C9, 0x8BE9, 0x942B, 0x944B, 0x942B, 0x8C0A,
-    0x8BEA, 0x8BEA, 0x8C0A, 0x8C2B, 0x946B, 0x8C0A, 0x7368, 0x83C9,
-    0x8BEA, 0x62C6, 0x5A86, 0x5AA6, 0x5AA6, 0x5AA6, 0x5A86, 0x5A86,
-    0x5285, 0x5285, 0x5A86, 0x62C6, 0x6B27, 0x6B48, 0x6307, 0x7BA9,
-    0x7368, 0x83CA, 0x83C9, 0x83C9, 0x944B, 0x944C, 0x6B28, 0x6328,
-    0x5AC7, 0x5AC7, 0x5AC7, 0x5AE8, 0x6BCD, 0x7C71, 0x9598, 0xA61A,
-    0x9E19, 0x9E1A, 0x9E1A, 0x9DFA, 0xA63A, 0x9577, 0x3A4A, 0xA5F9,
-    0x6C11, 0x29C8, 0xA61A, 0xA61A, 0xA61A, 0x9DFA, 0x9E19, 0x9E19,
-    0x9DF9, 0xA619, 0xA619, 0x9DF9, 0x9598, 0x8D35, 0x8D35, 0x84D3,
-    0x5349, 0x842B, 0x840A, 0x73CA, 0x73EB, 0x73CA, 0x52C8, 0x0860,
-    0x3A06, 0x428A, 0x7CB3, 0x6C11, 0xBE9B, 0xE7FF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6FB, 0xA5F8, 0xAE18, 0xAE18,
-    0xA5F8, 0xCF5D, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDF9E, 0xDF9E,
-    0xDFBE, 0xDF9E, 0xE7FF, 0x9D96, 0x638D, 0xC6DB, 0xCF3C, 0x4AC8,
-    0x6368, 0x2123, 0x1124, 0x31E5, 0x5B6A, 0x2206, 0x5B49, 0x7BA9,
-    0x6369, 0x3A67, 0x3A47, 0x6329, 0x8C2B, 0x4286, 0x6328, 0x6B69,
-    0x3A67, 0x944B, 0x5B28, 0x73AA, 0x7BA9, 0x944B, 0x6B48, 0x7BCA,
-    0x73AA, 0x8C2B, 0x7369, 0x4246, 0x6B6A, 0x39E4, 0x7BAA, 0x2123,
-    0x5AA7, 0x4A25, 0x39E5, 0x5AA6, 0x4A26, 0x18C2, 0x3184, 0x5AA7,
-    0x5AA7, 0x4225, 0x4A45, 0x6B28, 0x5286, 0x62E7, 0x5265, 0x62E6,
-    0x62A6, 0x8C0A, 0x8C0A, 0xA4AC, 0x944B, 0x944B, 0x8C0A, 0x83A9,
-    0x7368, 0x62E7, 0x5A65, 0x62E7, 0x62E7, 0x62C6, 0x62E7, 0x62E7,
-    0x6AE7, 0x6B07, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x62E7, 0x62E7, 0x62E7, 0x62E6, 0x62C6, 0x62C6, 0x62C6,
-    0x7347, 0x9C6B, 0x942A, 0x8BEA, 0x7BA9, 0x7368, 0x6B07, 0x62E6,
-    0x62C6, 0x6307, 0x6B07, 0x6B27, 0x7348, 0x6B07, 0x62C6, 0x62E6,
-    0x6B07, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AC6, 0x7B88, 0x83C9, 0x7348,
-    0x7348, 0x62C6, 0x6B27, 0x944B, 0x8C2A, 0x7389, 0x7388, 0x9CAC,
-    0x942B, 0x7348, 0x7348, 0x8C0A, 0x7BA9, 0x5286, 0x7B89, 0x5AA7,
-    0x4A66, 0x52A7, 0x5AC7, 0x5AC7, 0x4A65, 0x5B4B, 0x7CB2, 0x6C10,
-    0x84F5, 0xAE5B, 0x9DF9, 0x9E1A, 0x9DF9, 0xA63A, 0x7C94, 0x29A8,
-    0x0001, 0x5B4E, 0x9556, 0xA619, 0x9E19, 0x9DF9, 0x9E19, 0x9DF9,
-    0xA61A, 0x84F4, 0x740F, 0x7C2F, 0x7CB3, 0x740F, 0x5286, 0x4A65,
-    0x5B6A, 0x73CA, 0x946B, 0x6349, 0x73CA, 0x8C6C, 0x4A25, 0x18C2,
-    0x7BEB, 0x3A8A, 0xCF1C, 0xAE39, 0x63F0, 0xC6DB, 0xE7DF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xBEBB, 0x9576, 0x9D96, 0x9596,
-    0x9576, 0xCF3D, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xBE9B,
-    0xD75E, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xE7FF,
-    0xDFDF, 0xDFBE, 0xDFDF, 0xEFFF, 0x8491, 0x742F, 0x7C90, 0x534A,
-    0x42C8, 0x42A8, 0x21C5, 0x21A5, 0x3226, 0x2184, 0x29E5, 0x4A87,
-    0x3A46, 0x5B6A, 0x31C5, 0x2A26, 0x6BAA, 0x5B08, 0x3267, 0x6BCA,
-    0x5308, 0x7369, 0x8C2B, 0x52E8, 0x7BCA, 0x942B, 0xA4AC, 0x9C8B,
-    0x6BAA, 0x6B69, 0x5B28, 0x6349, 0x6329, 0x6B69, 0x8C2B, 0x5AE8,
-    0x7BA9, 0x5266, 0x5AA7, 0x6B48, 0x5AC7, 0x2964, 0x5287, 0x6308,
-    0x4A26, 0x5266, 0x5245, 0x7369, 0x4205, 0x52A6, 0x4A45, 0x7369,
-    0x5AA7, 0x8C2B, 0x7BA9, 0x8BEA, 0x8C0A, 0x7368, 0x7327, 0x7327,
-    0x8BEA, 0x8BEA, 0x7BA9, 0x83A9, 0x83A9, 0x83A9, 0x83A9, 0x83E9,
-    0x83C9, 0x8C0A, 0x62E7, 0x5AA6, 0x62E6, 0x5AA6, 0x39A4, 0x41E5,
-    0x39C4, 0x3163, 0x4205, 0x39C4, 0x39C4, 0x6B07, 0x83C9, 0x8C0A,
-    0x9C8B, 0x9C8B, 0x7B68, 0x6B27, 0x5286, 0x5A85, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6, 0x5AA6,
-    0x5AA6, 0x62C6, 0x5AA6, 0x5AA6, 0x62C6, 0x7368, 0x83C9, 0x8C0A,
-    0x7BA9, 0x7368, 0x7388, 0x8C0A, 0x944A, 0x840A, 0x5308, 0x5AE7,
-    0x944B, 0x8C0A, 0x83CA, 0x7BAA, 0x6B48, 0x6308, 0x39E5, 0x0041,
-    0x2164, 0x0041, 0x2164, 0x4267, 0x3A06, 0x2164, 0x4288, 0x31E7,
-    0x534E, 0xAE7B, 0x9DF9, 0x9E1A, 0x9DF9, 0x9E1A, 0x8D56, 0x534E,
-    0x6C32, 0x8515, 0x7473, 0xA63A, 0x9E1A, 0xA63A, 0x9E19, 0x9DF9,
-    0xAE7C, 0x6BEF, 0x4A45, 0x5AE8, 0x5AE9, 0x52C7, 0x5286, 0x5286,
-    0x5349, 0x5329, 0x8C4B, 0x842B, 0x8C6B, 0x9CAC, 0x62C7, 0x1902,
-    0x6B6A, 0x1125, 0x9555, 0xDF9E, 0xC6FC, 0xCF5D, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xEFFF, 0xEFFF, 0xEFFF,
-    0xEFFF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7DF, 0xB67A, 0x6C31,
-    0xB67A, 0xDFDF, 0xEFFF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xA5D6, 0x84F1,
-    0xB659, 0xE7FF, 0xCF3D, 0x7C92, 0x7450, 0x9D95, 0x29A6, 0x29E6,
-    0x3AC8, 0x21C5, 0x2A06, 0x29E6, 0x1964, 0x29C5, 0x2A06, 0x08A2,
-    0x3A88, 0x3AA7, 0x29C5, 0x21A5, 0x5329, 0x3A26, 0x1964, 0x42C8,
-    0x6349, 0x5286, 0x9C8C, 0x4287, 0x73AA, 0x840A, 0x8C4B, 0x8C4B,
-    0x840A, 0x8C2B, 0x6B49, 0x52E8, 0x6B69, 0x6B8A, 0x840B, 0x7389,
-    0x8C2B, 0x5B08, 0x6B69, 0x62E7, 0x7BA9, 0x52C7, 0x6308, 0x62E7,
-    0x5AC7, 0x5286, 0x738A, 0x4AE8, 0x52C7, 0x6308, 0x5B08, 0x52C7,
-    0x6B28, 0x6348, 0x5AE7, 0x31C4, 0x6B48, 0x52A6, 0x62E6, 0x5AC6,
-    0x6B27, 0x8C0A, 0x942B, 0x83C9, 0x83A9, 0x83C9, 0x83A9, 0x83C9,
-    0x83A9, 0x83C9, 0x7B88, 0x62C6, 0x62E6, 0x4205, 0x3184, 0x4205,
-    0x5286, 0x41E5, 0x5266, 0x5266, 0x5266, 0x5AC6, 0x6B48, 0x62E7,
-    0x62E6, 0x5AA6, 0x5AA6, 0x5A86, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AC6,
-    0x62C6, 0x5AC6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AC6, 0x5AC6, 0x62C6, 0x5AC6, 0x62C6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5AC6, 0x62C6, 0x7348, 0x6B69, 0x3A67, 0x21A5, 0x6369,
-    0x7369, 0x6B29, 0x4226, 0x2144, 0x2164, 0x29C6, 0x29E6, 0x3227,
-    0x3A47, 0x0861, 0x0000, 0x0020, 0x0020, 0x0882, 0x29A5, 0x10C2,
-    0x2187, 0xAE3A, 0xA61A, 0xA61A, 0x9E1A, 0x9E1A, 0x95B8, 0xA63A,
-    0xA65B, 0xA61A, 0xA63A, 0x9DF9, 0x9DD8, 0x84F4, 0x9DF9, 0xA63A,
-    0x84B3, 0x4AA8, 0x4224, 0x4A66, 0x4205, 0x5265, 0x5286, 0x5286,
-    0x636A, 0x5B29, 0x840A, 0x73AA, 0x9CAD, 0x7B89, 0x4205, 0x2123,
-    0x946C, 0x2123, 0x2986, 0xBEBB, 0xEFFF, 0xDFBF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDF9E, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xE7FF,
-    0xE7FF, 0xC71C, 0x9D96, 0xC71C, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDF9E, 0xB659, 0xAE38,
-    0xCF3C, 0xDFBF, 0xCF5D, 0xAE38, 0x9D96, 0x6C10, 0x5B4D, 0x0061,
-    0x08A2, 0x1144, 0x1985, 0x1103, 0x10C2, 0x3227, 0x3227, 0x0861,
-    0x29A5, 0x1923, 0x1923, 0x2184, 0x3226, 0x4246, 0x2963, 0x5309,
-    0x42C8, 0x4A87, 0x3206, 0x4AE9, 0x4226, 0x6369, 0x3AC8, 0x5B69,
-    0x83EA, 0x83EA, 0x6B69, 0x6329, 0x4AA7, 0x840B, 0x840B, 0x83CA,
-    0x6B8A, 0x3268, 0x6349, 0x7B89, 0x83EA, 0x3AA8, 0x4AC7, 0x52A7,
-    0x7BCA, 0x52E8, 0x52E8, 0x32A9, 0x5308, 0x5AE7, 0x5B48, 0x5B69,
-    0x5AA6, 0x4AE8, 0x52E8, 0x3A26, 0x39E5, 0x52A6, 0x6B07, 0x62C6,
-    0x5AA6, 0x6B07, 0x83EA, 0x83EA, 0x83EA, 0x83CA, 0x8BEA, 0x83EA,
-    0x8BEA, 0x8C2A, 0x83EA, 0x5AC6, 0x5AC6, 0x62C6, 0x62E6, 0x5AC6,
-    0x5AA6, 0x62C6, 0x5AC6, 0x62C6, 0x62C6, 0x5AC6, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5AA6, 0x5AC6, 0x5AA6,
-    0x5A86, 0x62C6, 0x5AC6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AC6,
-    0x5AC6, 0x62C6, 0x5AC6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x5AC6, 0x4A25, 0x39C4, 0x2103, 0x0881, 0x2164, 0x29C6,
-    0x1944, 0x10C2, 0x2165, 0x29C6, 0x0041, 0x08C2, 0x08C2, 0x1103,
-    0x10E2, 0x0040, 0x1904, 0x08A2, 0x0000, 0x2164, 0x2166, 0x4AEC,
-    0x84D4, 0xA5F9, 0xA63A, 0xA61A, 0xA63A, 0xA61A, 0x9E19, 0x9DF9,
-    0x9DF9, 0x9DF9, 0xA63A, 0xAE9C, 0x84D2, 0x634A, 0xA63A, 0x7C93,
-    0x7BAB, 0x8C0B, 0x5286, 0x18E2, 0x2943, 0x39C4, 0x3184, 0x41E4,
-    0x5329, 0x6389, 0x840B, 0x6369, 0x948C, 0x62E7, 0x5287, 0x7B8A,
-    0xA4CC, 0x6328, 0x1903, 0x6BCE, 0xB639, 0xDF7C, 0xC6B8, 0xC6D9,
-    0xD75C, 0xDFDF, 0xDFBE, 0xD77D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E,
-    0xDFDF, 0xC6DC, 0x8D15, 0xC6DB, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xE7FF,
-    0xE7DF, 0xDF9E, 0xDFBF, 0xDFDF, 0x6C71, 0x7471, 0x636E, 0x08A2,
-    0x1903, 0x0041, 0x0041, 0x0000, 0x0000, 0x1944, 0x2185, 0x1965,
-    0x0881, 0x0020, 0x0020, 0x10C2, 0x21A5, 0x4267, 0x3A05, 0x3A67,
-    0x5B6A, 0x5267, 0x1124, 0x5B6A, 0x2963, 0x52E8, 0x430A, 0x1144,
-    0x6329, 0x6B48, 0x5B29, 0x7BEA, 0x6328, 0x52A7, 0x73AA, 0x5B29,
-    0x3AC9, 0x42E9, 0x6329, 0x7389, 0x7BEA, 0x3267, 0x3AC8, 0x7369,
-    0x3A05, 0x52E8, 0x4267, 0x3288, 0x4B08, 0x4AC7, 0x4AE7, 0x6369,
-    0x2963, 0x32A8, 0x3247, 0x29A5, 0x0020, 0x4A45, 0x6B07, 0x6307,
-    0x62E7, 0x62E7, 0x62E6, 0x5A86, 0x5AA6, 0x62C6, 0x62E7, 0x6B27,
-    0x6B27, 0x6B27, 0x62E6, 0x62C6, 0x5AC6, 0x5AA6, 0x5AA6, 0x5AC6,
-    0x62E6, 0x5AA6, 0x5266, 0x5266, 0x5A86, 0x5AA6, 0x5AC6, 0x5AA6,
-    0x5AA6, 0x62C6, 0x62C6, 0x62E7, 0x6B07, 0x5AA6, 0x5246, 0x39A4,
-    0x2923, 0x5AA6, 0x5A86, 0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x5AC6, 0x5AA6, 0x62C6, 0x62C6, 0x5AC6, 0x5AA6,
-    0x5AA6, 0x5AC6, 0x2123, 0x2944, 0x10A2, 0x1904, 0x4289, 0x3207,
-    0x10C3, 0x08A2, 0x08A2, 0x0861, 0x10C3, 0x08A2, 0x2165, 0x0061,
-    0x0020, 0x0061, 0x08A2, 0x1945, 0x3208, 0x1945, 0x3A4A, 0xA61A,
-    0xAE5B, 0xA5F9, 0x9DD8, 0x9DF9, 0x9DB8, 0x9DB8, 0xA61A, 0x9DF9,
-    0x9E19, 0x9DF9, 0x6BCE, 0x63CE, 0x7C4F, 0x6329, 0x530B, 0x18E2,
-    0x62E7, 0x4205, 0x2923, 0x2963, 0x3164, 0x2963, 0x2123, 0x2923,
-    0x4AE8, 0x73EA, 0x7C0A, 0x7C0A, 0x7C0A, 0x7BEA, 0x6B69, 0xACEC,
-    0x948C, 0x636A, 0x4205, 0x39E5, 0x3A49, 0xD739, 0x9CCE, 0xC6B8,
-    0xC677, 0xDFDF, 0xC676, 0xC656, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFDF, 0xEFFF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDFBE, 0xDFBF, 0xC71C, 0x9575, 0xC6FB, 0x84B2, 0x3228,
-    0x4ACB, 0x10C3, 0x10E4, 0x1904, 0x0861, 0x0020, 0x1944, 0x0041,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x08C2, 0x2185, 0x29C5, 0x29E6,
-    0x3A67, 0x738A, 0x10C2, 0x5309, 0x39E5, 0x29A4, 0x3A68, 0x0081,
-    0x5AE8, 0x73A9, 0x3247, 0x52A7, 0x73CA, 0x4AA7, 0x4B09, 0x2A68,
-    0x2207, 0x73CB, 0x5B09, 0x2A06, 0x5B69, 0x3A88, 0x42E9, 0x7348,
-    0x3184, 0x4226, 0x10A2, 0x3247, 0x3206, 0x29E6, 0x1903, 0x4A46,
-    0x1902, 0x42E9, 0x29A5, 0x10C2, 0x0861, 0x39C5, 0x3183, 0x3184,
-    0x3184, 0x39C4, 0x39C4, 0x39C4, 0x5AA6, 0x62C7, 0x6307, 0x62E7,
-    0x62E7, 0x5286, 0x5AA6, 0x62C6, 0x5AC6, 0x5AA6, 0x5AC6, 0x62E7,
-    0x5245, 0x5286, 0x4205, 0x39E5, 0x4225, 0x5286, 0x5AC6, 0x62E7,
-    0x52A6, 0x29A4, 0x4266, 0x4205, 0x39A4, 0x4225, 0x31A4, 0x2103,
-    0x0840, 0x41E5, 0x41C4, 0x5A86, 0x5AA6, 0x5AA6, 0x62C6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x5AA6,
-    0x5AA6, 0x5AA6, 0x5266, 0x5286, 0x2144, 0x2A29, 0x3AAA, 0x29C7,
-    0x10C4, 0x1905, 0x42CC, 0x3229, 0x4B0C, 0x42EC, 0x42CB, 0x534D,
-    0x5BB0, 0x538F, 0x4B6E, 0x536F, 0x5BAF, 0x63F1, 0x9577, 0x9DD9,
-    0x9E1A, 0x9597, 0x7CB3, 0x7473, 0x63F1, 0x84D4, 0xAE3A, 0x9DF9,
-    0xA619, 0x84B2, 0x4205, 0x4A24, 0x5287, 0x39C4, 0x39C4, 0x4A26,
-    0x2943, 0x10A2, 0x2102, 0x2963, 0x3164, 0x2963, 0x2964, 0x10A2,
-    0x7C0A, 0x842A, 0x842A, 0x8C4B, 0x7BEA, 0x946B, 0x8C4B, 0xA4CC,
-    0x948B, 0x6B89, 0x6B48, 0x7369, 0x1902, 0x9CCD, 0x948D, 0xAD70,
-    0xBE13, 0xD75C, 0xB5F3, 0xDF7C, 0xDFDF, 0xDFBF, 0xDFBE, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBE, 0xDFBF, 0xDFDF, 0xB679, 0x7451, 0x63EF, 0x6410, 0x7472,
-    0x7C71, 0x1945, 0x29A6, 0x2165, 0x1945, 0x1945, 0x08A2, 0x1904,
-    0x0041, 0x0000, 0x0000, 0x0020, 0x0000, 0x10E2, 0x3226, 0x10E2,
-    0x1964, 0x6329, 0x21A4, 0x3267, 0x3A46, 0x2144, 0x1944, 0x0061,
-    0x2164, 0x4B49, 0x32A8, 0x19A5, 0x5B49, 0x4286, 0x42E9, 0x2207,
-    0x10E3, 0x4AE9, 0x2A27, 0x3288, 0x3206, 0x1103, 0x3A67, 0x5287,
-    0x2923, 0x18E2, 0x0841, 0x31E6, 0x18E2, 0x0000, 0x18C2, 0x2964,
-    0x10A1, 0x2164, 0x18E2, 0x31A4, 0x3164, 0x39C5, 0x2943, 0x2943,
-    0x2943, 0x2923, 0x2964, 0x3184, 0x3184, 0x39A4, 0x39C4, 0x31A4,
-    0x4205, 0x4205, 0x4205, 0x62C6, 0x5AC6, 0x62C6, 0x5245, 0x39A4,
-    0x3164, 0x4A66, 0x3A26, 0x3A67, 0x42C7, 0x4AA7, 0x3A87, 0x29A4,
-    0x29C5, 0x21A5, 0x2184, 0x1923, 0x1923, 0x4A66, 0x5286, 0x4205,
-    0x2963, 0x62E7, 0x62C7, 0x62C6, 0x5AA6, 0x62C6, 0x62C6, 0x62E7,
-    0x6B07, 0x62C6, 0x5A86, 0x5265, 0x62C6, 0x62C6, 0x5AA6, 0x5AA6,
-    0x62C6, 0x62C6, 0x62C6, 0x5265, 0x2123, 0x5B6D, 0x6C72, 0x6431,
-    0x7493, 0x9DD8, 0x7493, 0x8D56, 0x9DD8, 0x9DF9, 0xA63A, 0xAE5A,
-    0xA63A, 0x9DD9, 0x9DF9, 0x9DF9, 0xA5F9, 0x9DF9, 0xA61A, 0x9E1A,
-    0x9DF9, 0x9DF9, 0x9E19, 0x95B8, 0xA619, 0xAE3A, 0x9DF9, 0xAE5A,
-    0x5B4C, 0x41E4, 0x5266, 0x39C5, 0x4205, 0x4A25, 0x6308, 0x41E5,
-    0x2944, 0x18C2, 0x31A4, 0x2944, 0x2944, 0x3164, 0x2123, 0x0000,
-    0x9CCB, 0xA4CB, 0x840A, 0x5308, 0x840B, 0x6BA9, 0x8C4B, 0xA4CC,
-    0x842B, 0x6369, 0x73A9, 0x8C2A, 0x7368, 0x7348, 0x83EA, 0x62E8,
-    0x840C, 0xC6D9, 0xBE55, 0xBE14, 0xCEFA, 0xD73C, 0xE7FF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF, 0xDFDF, 0xDFBE,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0x9D96, 0xBEDB, 0x63AE, 0x6BF0,
-    0x326A, 0x326A, 0x21C7, 0x21A7, 0x1945, 0x21A7, 0x1945, 0x10E3,
-    0x21A6, 0x21A6, 0x0882, 0x0000, 0x0000, 0x10C2, 0x1944, 0x10C2,
-    0x2164, 0x19A5, 0x638A, 0x3A26, 0x2184, 0x0020, 0x1944, 0x0020,
-    0x08C2, 0x3AC9, 0x1143, 0x2A27, 0x4B29, 0x21A5, 0x3247, 0x2A47,
-    0x10E3, 0x29E6, 0x1964, 0x2A06, 0x1923, 0x18E3, 0x3288, 0x1102,
-    0x0000, 0x0000, 0x0000, 0x10A1, 0x0000, 0x0020, 0x39C5, 0x39A4,
-    0x39C5, 0x4205, 0x39A4, 0x39C4, 0x39A4, 0x39A4, 0x3164, 0x2944,
-    0x39A4, 0x39A4, 0x3184, 0x2963, 0x3984, 0x41C5, 0x2963, 0x2102,
-    0x3183, 0x5266, 0x5AA6, 0x5286, 0x5266, 0x5A86, 0x4205, 0x3164,
-    0x4205, 0x3A05, 0x4A87, 0x3A87, 0x3A67, 0x2143, 0x1964, 0x1984,
-    0x1943, 0x3267, 0x2A06, 0x52C7, 0x5AE7, 0x62E7, 0x62E6, 0x62C6,
-    0x62E7, 0x41E4, 0x2102, 0x39C4, 0x62E7, 0x4A25, 0x2123, 0x3183,
-    0x2963, 0x18C2, 0x1081, 0x0020, 0x2102, 0x2963, 0x5AA6, 0x62C6,
-    0x62E7, 0x62E6, 0x62E6, 0x62C6, 0x5AC7, 0x5A86, 0x6B8C, 0x4269,
-    0x9596, 0xA5F8, 0x6C11, 0xAE5A, 0xAE5B, 0x8D77, 0x8D35, 0x8515,
-    0x7C93, 0xAE5A, 0x8D76, 0x9D97, 0xA5F9, 0x9DF9, 0x7CB3, 0x7C92,
-    0x95B8, 0xA63A, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DD8, 0xAE5A, 0x8D35,
-    0x3184, 0x5A86, 0x39C4, 0x2923, 0x39A4, 0x18E2, 0x2123, 0x10A2,
-    0x18E3, 0x0861, 0x3184, 0x2944, 0x3164, 0x10A2, 0x0000, 0x0000,
-    0x8C4B, 0x9CAB, 0x8C4B, 0x3266, 0x6B69, 0x842B, 0x5B69, 0x948C,
-    0x5B28, 0x6369, 0x842B, 0x52C7, 0x83EA, 0x8BEA, 0x83C9, 0x6B08,
-    0x39C5, 0x2165, 0x8C6F, 0xC677, 0xAD72, 0xDF7C, 0xCEFB, 0xDF9E,
-    0xDFBF, 0xDFDF, 0xDFBE, 0xDFBF, 0xD75C, 0xB5B3, 0xBE77, 0xE7FF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xE7FF, 0xBEFB, 0x8514, 0x8D14, 0x63F0,
-    0x3AAC, 0x328B, 0x3AAC, 0x328B, 0x328A, 0x21A7, 0x2145, 0x10C3,
-    0x08A2, 0x19A6, 0x1985, 0x1904, 0x0020, 0x0000, 0x0000, 0x0041,
-    0x10E3, 0x1985, 0x5309, 0x4287, 0x1943, 0x0000, 0x21A5, 0x10E2,
-    0x10E2, 0x3AC9, 0x0000, 0x1903, 0x430A, 0x1984, 0x2A27, 0x21C5,
-    0x1123, 0x1944, 0x10A2, 0x0861, 0x1924, 0x1924, 0x2A27, 0x10E2,
-    0x10A1, 0x0040, 0x18E3, 0x0000, 0x18A2, 0x20E2, 0x39A4, 0x3184,
-    0x3184, 0x3184, 0x3184, 0x31A4, 0x3184, 0x3184, 0x3184, 0x3164,
-    0x3164, 0x3184, 0x3984, 0x39A4, 0x31A4, 0x3184, 0x3184, 0x39C4,
-    0x39A4, 0x2943, 0x2943, 0x2923, 0x2943, 0x4A25, 0x5AC7, 0x5266,
-    0x62E7, 0x4205, 0x5287, 0x4AA7, 0x0020, 0x0000, 0x0000, 0x0040,
-    0x10C2, 0x1944, 0x0881, 0x3206, 0x52A7, 0x62C7, 0x62E7, 0x62E7,
-    0x62E7, 0x62C7, 0x2103, 0x2923, 0x39A4, 0x18C2, 0x0000, 0x0000,
-    0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x3164, 0x5AA6,
-    0x4205, 0x5286, 0x5AA6, 0x3184, 0x4A45, 0x62E7, 0x5265, 0x5265,
-    0x5AC7, 0x52A7, 0x5287, 0x7C2F, 0x6BCE, 0x636C, 0x3A28, 0x4269,
-    0x5AE9, 0x5B6D, 0x6BCD, 0x52C9, 0x7C50, 0x7C70, 0x3A48, 0x7BAB,
-    0x8CF2, 0x8D55, 0xA63A, 0xA63A, 0xA63A, 0xAE5B, 0x9597, 0x4268,
-    0x41E4, 0x39C4, 0x3183, 0x2963, 0x3184, 0x2103, 0x10A2, 0x0020,
-    0x0000, 0x0841, 0x0820, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x73EA, 0x73EA, 0x6BA9, 0x3A66, 0x6369, 0x6B89, 0x6369, 0x73CA,
-    0x6369, 0x52E8, 0x6B8A, 0x6B89, 0x8C2B, 0x8C0A, 0x7B89, 0x8C2A,
-    0x4B08, 0x3A47, 0x2944, 0x7BEE, 0x94F1, 0xF7FF, 0xB5D4, 0xDF7C,
-    0xD75D, 0xC657, 0xBE35, 0xD77D, 0xCF1A, 0xB5B2, 0xBE15, 0xDF9E,
-    0xDF5D, 0xE7DF, 0xE7DF, 0xD75D, 0x8471, 0xE7DF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xCF1C, 0xD77E, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xCF5D, 0x7CD3, 0xA5F8, 0xD77E, 0xBE9A,
-    0x538F, 0x538F, 0x3ACC, 0x3ACC, 0x3AEC, 0x3AAB, 0x29E8, 0x21A7,
-    0x21E7, 0x21C7, 0x0882, 0x1924, 0x10A2, 0x2145, 0x10A2, 0x0000,
-    0x0000, 0x0020, 0x3A68, 0x29C5, 0x0020, 0x0000, 0x1103, 0x21A5,
-    0x0020, 0x2185, 0x0861, 0x0000, 0x2A07, 0x29C6, 0x2A27, 0x1984,
-    0x1985, 0x1103, 0x0000, 0x0000, 0x0861, 0x10E3, 0x0861, 0x0861,
-    0x2103, 0x10A2, 0x2944, 0x2123, 0x3184, 0x3184, 0x39A4, 0x31A4,
-    0x2943, 0x2943, 0x31A4, 0x39A4, 0x3184, 0x3164, 0x39A4, 0x39C5,
-    0x31A4, 0x3184, 0x39E5, 0x4205, 0x2943, 0x2103, 0x2944, 0x2102,
-    0x2922, 0x3164, 0x31A4, 0x41E5, 0x5286, 0x62C7, 0x7348, 0x5A86,
-    0x7348, 0x8BEA, 0x8C0A, 0x83CA, 0x5266, 0x5AC7, 0x4A46, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0923, 0x19A4, 0x1903, 0x1902,
-    0x1902, 0x2102, 0x18C2, 0x10A2, 0x0041, 0x0944, 0x1984, 0x39C5,
-    0x5286, 0x5266, 0x5245, 0x5245, 0x4A45, 0x5266, 0x5246, 0x5246,
-    0x41E4, 0x5266, 0x4A05, 0x3163, 0x39C4, 0x5AA6, 0x5AC6, 0x5AA6,
-    0x5A86, 0x62A6, 0x62E6, 0x5265, 0x41E4, 0x5AA5, 0x41E4, 0x4A25,
-    0x5AA6, 0x4204, 0x5AA6, 0x5245, 0x4A46, 0x4225, 0x0840, 0x4A46,
-    0x5266, 0x634B, 0x534D, 0x532C, 0x5B6D, 0x5B2C, 0x31C6, 0x2103,
-    0x3184, 0x2123, 0x39A4, 0x31A4, 0x2964, 0x18E3, 0x2943, 0x0840,
-    0x0841, 0x20E3, 0x10A2, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x5B49, 0x7C0A, 0x6369, 0x5B49, 0x6B89, 0x5B28, 0x52E7, 0x73A9,
-    0x6369, 0x4AC8, 0x42A7, 0x842B, 0x5B08, 0x8C4B, 0x5266, 0x7348,
-    0x8C6B, 0x8C2B, 0x2943, 0x7369, 0x6309, 0x5B2C, 0xAD94, 0xB638,
-    0xC657, 0x8C4E, 0xBE14, 0xD75C, 0xC677, 0xCE97, 0xC656, 0xCED9,
-    0xC657, 0xE7BE, 0xE7FF, 0x9D55, 0x9D55, 0xDFDF, 0xDF9E, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xD79E, 0xEFFF, 0x8CB2, 0x5B2C, 0xEFFF,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xD75D, 0xC6FC, 0xE7FF, 0xDFBF, 0xE7FF,
-    0x63F0, 0x5BD0, 0x6C31, 0x4B4E, 0x328B, 0x3ACC, 0x328B, 0x1986,
-    0x1986, 0x2A08, 0x2A08, 0x2186, 0x1925, 0x29E8, 0x3249, 0x1904,
-    0x0881, 0x0000, 0x29E6, 0x3207, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x1923, 0x0861, 0x0000, 0x0881, 0x10A2, 0x21C6, 0x21C5,
-    0x21C5, 0x1103, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x3184, 0x39C5, 0x3184, 0x4205, 0x4A26, 0x31A4,
-    0x3164, 0x2944, 0x2964, 0x39C4, 0x39A4, 0x39A5, 0x39C5, 0x39A5,
-    0x39A5, 0x2103, 0x2102, 0x10A1, 0x41E4, 0x39C3, 0x0861, 0x2125,
-    0x31A6, 0x4A47, 0x39C5, 0x5286, 0x7388, 0x6B27, 0x5AA6, 0x4205,
-    0x5266, 0x4A45, 0x4A45, 0x6B08, 0x6B28, 0x8C0A, 0x8C0A, 0x7349,
-    0x41E5, 0x3184, 0x39A4, 0x4205, 0x4B08, 0x3AA7, 0x3206, 0x4266,
-    0x4A87, 0x4205, 0x41E4, 0x4225, 0x3184, 0x4267, 0x5B29, 0x6B07,
-    0x6B07, 0x6B27, 0x6B27, 0x7327, 0x7327, 0x7307, 0x6B07, 0x6B07,
-    0x6B07, 0x6B07, 0x6AE7, 0x6B07, 0x4A25, 0x5A86, 0x62C6, 0x5AA6,
-    0x5AA6, 0x62C6, 0x5AC6, 0x62C6, 0x62E6, 0x62C6, 0x62E6, 0x62C6,
-    0x62C6, 0x62E7, 0x62C6, 0x62E7, 0x62E7, 0x5265, 0x4A46, 0x5286,
-    0x73AA, 0x5AC7, 0x39A4, 0x4204, 0x41E4, 0x5245, 0x39C4, 0x0041,
-    0x0000, 0x0020, 0x18E2, 0x0861, 0x0841, 0x0040, 0x20E3, 0x0840,
-    0x0861, 0x0840, 0x3164, 0x18C2, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x42E7, 0x8C6B, 0x840A, 0x73EA, 0x6389, 0x7389, 0x4245, 0x6308,
-    0x6B69, 0x6369, 0x42A7, 0x73AA, 0x4AA7, 0x944B, 0x7B89, 0x6348,
-    0x842B, 0xA4CC, 0xA48C, 0x9C6C, 0x6B28, 0x2123, 0x4227, 0x4A88,
-    0x73CD, 0x634A, 0x9CCF, 0xCE96, 0xBDB1, 0xB571, 0xB591, 0xBDD3,
-    0xCE98, 0x9CEF, 0xD719, 0x94F3, 0xCEFC, 0xE7FF, 0xDFDF, 0xC6B8,
-    0xCED9, 0xE7FF, 0xDFBF, 0xD79E, 0xEFFF, 0x8492, 0x31A6, 0xE7FF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xE7DF, 0xDF9F, 0xD79E, 0x8D14,
-    0xAE18, 0x84D3, 0x2A4A, 0x7451, 0x7492, 0x2209, 0x4B4E, 0x4B4D,
-    0x1986, 0x21A6, 0x2165, 0x1945, 0x2A08, 0x1104, 0x10C3, 0x21A6,
-    0x1965, 0x21A7, 0x1945, 0x2186, 0x1925, 0x1924, 0x1925, 0x1945,
-    0x0861, 0x0020, 0x0000, 0x0041, 0x10C3, 0x0861, 0x29E6, 0x2A07,
-    0x1944, 0x0882, 0x0020, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0840, 0x2943, 0x39A5, 0x41E5, 0x39E5, 0x39C5,
-    0x4205, 0x41E5, 0x39C4, 0x3184, 0x10A2, 0x18C2, 0x18C2, 0x0020,
-    0x0040, 0x0000, 0x0000, 0x0000, 0x6B8C, 0x9D75, 0x7452, 0xA61A,
-    0x84F5, 0x10A2, 0x0840, 0x2103, 0x4A25, 0x3164, 0x3184, 0x41E5,
-    0x39A4, 0x3184, 0x2943, 0x2943, 0x39A4, 0x6B27, 0x83A9, 0x8C2A,
-    0x62E7, 0x62E7, 0x6307, 0x6B27, 0x8BE9, 0x7348, 0x6B07, 0x6B07,
-    0x6B07, 0x6B07, 0x6B07, 0x6B27, 0x7348, 0x5225, 0x39A3, 0x41C4,
-    0x3163, 0x3163, 0x3984, 0x39A4, 0x39C4, 0x39A4, 0x3983, 0x3163,
-    0x3142, 0x3183, 0x5266, 0x62E7, 0x6B07, 0x62E6, 0x62C6, 0x62E6,
-    0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62A6, 0x5AC6, 0x5AA6, 0x5AA6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62E7, 0x62E6, 0x7BA9,
-    0x7BAA, 0x6B48, 0x62C7, 0x4A45, 0x5266, 0x4205, 0x39A4, 0x2103,
-    0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0841, 0x0020, 0x0000, 0x18A2, 0x1081, 0x0020,
-    0x4B08, 0x7C0A, 0x842A, 0x6B89, 0x63A9, 0x6BAA, 0x5308, 0x39C4,
-    0x6B89, 0x946C, 0x5AE7, 0x6328, 0x5308, 0x83EA, 0x944B, 0x83EA,
-    0x5B49, 0x842B, 0x9C8C, 0x7389, 0x62E8, 0x6329, 0x5286, 0x6B27,
-    0x4248, 0x6309, 0x94AD, 0xC58E, 0xA4ED, 0x52A7, 0xB592, 0xBDD3,
-    0xE79D, 0xA4AC, 0xB592, 0xB5F6, 0xE7DF, 0xADB5, 0xBE99, 0xD6F9,
-    0xCE97, 0xDF7D, 0xC677, 0xDFBF, 0xE7FF, 0x8CB2, 0x9534, 0xE7FF,
-    0xDF9E, 0xDFDF, 0xE7FF, 0xDF9F, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9E, 0xDFBF, 0xD77E, 0xAE39,
-    0xE7DF, 0xCEFB, 0x5B8F, 0x7472, 0x5BD0, 0x3ACC, 0x84F4, 0x8CF4,
-    0x08C3, 0x4B4D, 0x5BCF, 0x2A29, 0x430C, 0x3A8B, 0x1945, 0x1125,
-    0x1124, 0x1966, 0x29E8, 0x29E8, 0x29C7, 0x29E8, 0x2186, 0x10E3,
-    0x0020, 0x0882, 0x10A2, 0x10E4, 0x1945, 0x08A2, 0x1903, 0x0861,
-    0x2165, 0x2145, 0x3229, 0x3229, 0x1924, 0x2123, 0x2103, 0x3185,
-    0x2103, 0x2143, 0x31A5, 0x2123, 0x0020, 0x0000, 0x0820, 0x0861,
-    0x2923, 0x2923, 0x2944, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x18E2, 0x2964, 0x73AD, 0x9514, 0x9556, 0x9556, 0x7452,
-    0x1904, 0x0000, 0x1061, 0x2123, 0x2943, 0x0841, 0x1081, 0x3184,
-    0x3184, 0x3163, 0x3184, 0x4205, 0x6B28, 0x6B07, 0x6B27, 0x7B89,
-    0x62C6, 0x62E7, 0x62E7, 0x5AA6, 0x41E4, 0x39C3, 0x3983, 0x4204,
-    0x5246, 0x5286, 0x5AA6, 0x3163, 0x1080, 0x0041, 0x2166, 0x2186,
-    0x1945, 0x42CC, 0x74D5, 0x6C94, 0x74D5, 0x5390, 0x4B4E, 0x6432,
-    0x3A6A, 0x10C4, 0x1081, 0x2943, 0x5266, 0x62E6, 0x62C6, 0x4A45,
-    0x5265, 0x62C6, 0x5AA6, 0x5AA6, 0x62A6, 0x5AA6, 0x62A6, 0x62C6,
-    0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x62C6, 0x5AA6,
-    0x31A4, 0x4A46, 0x5AA6, 0x5266, 0x4A05, 0x3184, 0x3184, 0x39C5,
-    0x2123, 0x18C2, 0x2102, 0x1081, 0x1081, 0x0861, 0x0861, 0x0861,
-    0x0861, 0x1081, 0x1081, 0x1081, 0x2103, 0x39C4, 0x3184, 0x2943,
-    0x4AE8, 0x840A, 0x840A, 0x73EA, 0x740A, 0x73CA, 0x6B89, 0x39E5,
-    0x6369, 0x9C8C, 0x83CA, 0x6B69, 0x6349, 0x7BCA, 0xA4AC, 0xA48C,
-    0x5B49, 0x73CA, 0x73A9, 0x73AA, 0x62E7, 0x4A87, 0x6328, 0x8C0A,
-    0x1081, 0x7369, 0x83EA, 0xC5AF, 0x7BEA, 0x4225, 0xA50F, 0xB54F,
-    0x94AF, 0x948C, 0x9CAE, 0x9D74, 0xDFDF, 0xADB4, 0xC698, 0xBE15,
-    0xBDF3, 0xD73B, 0xB591, 0xD73B, 0xD79E, 0x2985, 0xAE18, 0xE7FF,
-    0xE7DF, 0xC69A, 0xA5B7, 0xE7FF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7FF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF,
-    0xDFBF, 0xB659, 0xBEBA, 0xCF3C, 0x6C52, 0x6411, 0x9D96, 0x7CB2,
-    0x29E8, 0x84D3, 0x8514, 0x3ACB, 0x2186, 0x08C3, 0x0882, 0x1125,
-    0x2A29, 0x08C3, 0x1104, 0x1965, 0x2186, 0x2A08, 0x29C8, 0x2145,
-    0x2166, 0x2186, 0x10E4, 0x1945, 0x29E8, 0x2186, 0x2186, 0x2166,
-    0x2145, 0x1904, 0x2145, 0x2187, 0x2965, 0x3184, 0x2944, 0x18C2,
-    0x4A47, 0x4206, 0x4226, 0x3164, 0x0000, 0x0861, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20E2,
-    0x5266, 0x62E7, 0x7BEC, 0xBE7A, 0x4A8A, 0x0861, 0x0861, 0x0000,
-    0x0000, 0x10A2, 0x3164, 0x3184, 0x4A26, 0x39A4, 0x39C4, 0x5246,
-    0x62E7, 0x62E7, 0x6B27, 0x83C9, 0x9C6B, 0x9C6B, 0x83E9, 0x7BA9,
-    0x62E7, 0x2122, 0x3184, 0x18E2, 0x18E4, 0x534E, 0x534E, 0x1925,
-    0x0000, 0x0000, 0x0000, 0x3A4A, 0x5B8F, 0x6C32, 0x9E1A, 0x8DD9,
-    0x8D98, 0x8D98, 0x4B2D, 0x534B, 0x63AC, 0x5B8C, 0x63AC, 0x6BED,
-    0x73ED, 0x5B09, 0x4205, 0x5AA7, 0x5AA6, 0x5AA6, 0x62E6, 0x41E4,
-    0x4A25, 0x62C6, 0x5AA6, 0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x62C6,
-    0x5AA6, 0x5AA6, 0x5A86, 0x5AA6, 0x5AC6, 0x62C6, 0x6AE7, 0x6B07,
-    0x4A25, 0x18E2, 0x2964, 0x2143, 0x18E2, 0x31A5, 0x31A4, 0x39C4,
-    0x39C5, 0x39C4, 0x39C5, 0x39E5, 0x41E5, 0x39E5, 0x39C4, 0x39C5,
-    0x39A4, 0x39A5, 0x41E5, 0x41E5, 0x39A4, 0x2963, 0x3184, 0x39C5,
-    0x5308, 0x73AA, 0x7BEA, 0x4AC8, 0x6389, 0x6389, 0x6369, 0x39C5,
-    0x52E8, 0x944B, 0x4A66, 0x6349, 0x840A, 0x73A9, 0x946B, 0xA4CC,
-    0x6349, 0x5B69, 0x73CA, 0x73A9, 0x6B69, 0x5B29, 0x6B69, 0xA4AC,
-    0x5AE7, 0x9C8C, 0x6B28, 0xA4CD, 0x6B48, 0x5AA7, 0x944B, 0xA4AB,
-    0x8C0A, 0xB5B3, 0x8C2B, 0xB616, 0x9574, 0xBE16, 0xC677, 0x94AE,
-    0xAD72, 0xAE16, 0xA572, 0xC698, 0xD77E, 0x5AEA, 0xD71B, 0xDFBE,
-    0xEFFF, 0x636D, 0x8450, 0xDF7C, 0xD79E, 0xDFBF, 0xD79E, 0xADD4,
-    0xDF9E, 0xDFBF, 0xE7DF, 0xE7FF, 0xE7DF, 0xDFBF, 0xDF9E, 0xBE79,
-    0xD77D, 0xDFBF, 0xDF9E, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9F, 0xDF9E,
-    0xDFBF, 0xD75D, 0xDF9E, 0xE7FF, 0x8D14, 0xAE59, 0xD73D, 0x7CD3,
-    0x536E, 0x7CB3, 0x5BF0, 0x7CB3, 0x534D, 0x21C8, 0x21C8, 0x2A09,
-    0x21C8, 0x1945, 0x1104, 0x08A3, 0x1945, 0x2186, 0x10E3, 0x2A08,
-    0x2A08, 0x29E8, 0x2186, 0x3209, 0x21A7, 0x29E8, 0x29C8, 0x2166,
-    0x1925, 0x2987, 0x29A7, 0x2166, 0x2145, 0x0882, 0x08A3, 0x08A3,
-    0x0000, 0x0020, 0x0861, 0x1966, 0x1925, 0x2186, 0x1104, 0x08C3,
-    0x10E4, 0x10E4, 0x0041, 0x0041, 0x18C2, 0x5266, 0x5A87, 0x62E7,
-    0x6B07, 0x4A25, 0x73CD, 0x5B2D, 0x0861, 0x0020, 0x0000, 0x0020,
-    0x10A2, 0x3184, 0x3164, 0x3164, 0x5AC7, 0x62E7, 0x62E7, 0x5AC6,
-    0x5AA6, 0x5A85, 0x5AA6, 0x62E6, 0x5A86, 0x6B48, 0x83E9, 0x8C0A,
-    0x7BCA, 0x63AF, 0x8557, 0x7D36, 0x8577, 0x8DFA, 0x5BF1, 0x538F,
-    0x63F1, 0x42CC, 0x42AB, 0x6411, 0xA6BC, 0x9E5B, 0x9E5B, 0x6C52,
-    0x2103, 0x31C6, 0x2923, 0x5A85, 0x7368, 0x39A4, 0x39A4, 0x4A24,
-    0x4204, 0x4A25, 0x4A46, 0x4A25, 0x6B27, 0x7BA9, 0x6B07, 0x6B07,
-    0x6B07, 0x5AA6, 0x5AA6, 0x62C6, 0x62C6, 0x5AA6, 0x62A6, 0x5AA6,
-    0x5AA6, 0x62E6, 0x41E5, 0x2923, 0x62E6, 0x5A86, 0x41E4, 0x3A05,
-    0x532B, 0x7C71, 0xADF8, 0x7C71, 0x7C72, 0xA5B7, 0x4228, 0x41E5,
-    0x39C4, 0x41E5, 0x39A4, 0x39A4, 0x39A4, 0x39A4, 0x39A4, 0x39A4,
-    0x3184, 0x3184, 0x39A4, 0x39A4, 0x3184, 0x3184, 0x39A4, 0x3184,
-    0x6BA9, 0x6369, 0x8C4B, 0x5308, 0x4AE8, 0x6BAA, 0x6B89, 0x4205,
-    0x5309, 0x73AA, 0x52C7, 0x52A7, 0x4A66, 0x5309, 0x4AE8, 0x840A,
-    0x73CA, 0x42C8, 0x7BEA, 0x6B69, 0x7BCA, 0x5286, 0x7389, 0xACCC,
-    0x6B89, 0x9CAC, 0xAD0D, 0x6308, 0x2922, 0x9C6C, 0x8C2B, 0x9C6B,
-    0x946C, 0xB572, 0x8C4C, 0x8C8F, 0x6BEC, 0xB615, 0xB636, 0x848E,
-    0x8CD0, 0x8CF1, 0x744F, 0xADD5, 0xAE17, 0x94D1, 0xB5B4, 0xDF9D,
-    0xCEFC, 0x6BAD, 0xDF7C, 0xC676, 0xCF1B, 0xCF3C, 0xDF9D, 0xA551,
-    0xDF7D, 0xE7FF, 0xB639, 0x9535, 0xCEFB, 0xE7DF, 0xCEFB, 0x5AEA,
-    0xD75D, 0xD7BF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9E, 0xDFBF, 0xC6FC, 0xD77E, 0xEFFF, 0x7CB3,
-    0x9555, 0xA5B7, 0xA5B7, 0xC6BB, 0x84F4, 0x5BCF, 0x6C51, 0x4B4E,
-    0x42EC, 0x84D3, 0x2A08, 0x3ACB, 0x4B2D, 0x2A08, 0x3208, 0x42CB,
-    0x21E7, 0x3AAB, 0x3AAB, 0x21A7, 0x2A08, 0x2A49, 0x2166, 0x1104,
-    0x29A7, 0x29C8, 0x1945, 0x1904, 0x2166, 0x326A, 0x3249, 0x42AB,
-    0x29C7, 0x0021, 0x0000, 0x0883, 0x08A3, 0x08C3, 0x10E4, 0x1104,
-    0x21C8, 0x29C8, 0x1904, 0x3A07, 0x5267, 0x5266, 0x39C4, 0x39E5,
-    0x4205, 0x20E2, 0x4A47, 0x41E4, 0x62C7, 0x2923, 0x5246, 0x4A26,
-    0x5246, 0x41E5, 0x39C4, 0x3184, 0x4205, 0x39C4, 0x62C6, 0x5A86,
-    0x5AA6, 0x6B07, 0x6B07, 0x8C0A, 0x7BA9, 0x6B07, 0x83EA, 0x942B,
-    0x7388, 0x5B4B, 0x9E19, 0x63EF, 0x42A9, 0x7491, 0x5B8E, 0x63EF,
-    0x8D97, 0x95B7, 0x6C92, 0x7CD3, 0x534D, 0x29A6, 0x532C, 0x5B0A,
-    0x39A4, 0x41E5, 0x4205, 0x41E5, 0x31A4, 0x31A4, 0x41E5, 0x39E5,
-    0x39C4, 0x3184, 0x3184, 0x4A26, 0x7328, 0x5AA7, 0x4205, 0x5A86,
-    0x62C6, 0x4205, 0x5246, 0x5A86, 0x5AA6, 0x62C6, 0x62C6, 0x6B07,
-    0x5AA7, 0x738C, 0x9CB1, 0x39A5, 0x5AA6, 0x5265, 0x31A5, 0x8CF4,
-    0xADF8, 0x6BD0, 0x7C73, 0x8D57, 0x7C94, 0x3A09, 0x0020, 0x10A2,
-    0x5B09, 0x7BAA, 0x4A46, 0x2963, 0x39A4, 0x39C4, 0x39A4, 0x3164,
-    0x3184, 0x39A4, 0x31A4, 0x3184, 0x39C4, 0x39C4, 0x3184, 0x3164,
-    0x6369, 0x6369, 0x948B, 0x844B, 0x7C2B, 0x73EA, 0x6328, 0x2103,
-    0x4A67, 0x5267, 0x6329, 0x6B69, 0x31A5, 0x42A8, 0x42A8, 0x6349,
-    0x39C4, 0x29E5, 0x4AA8, 0x6B89, 0x844B, 0x6328, 0x6328, 0x9CAC,
-    0x7C0A, 0x73AA, 0xBD2D, 0x942B, 0x4205, 0xACCC, 0xA4AC, 0x4A46,
-    0x4205, 0x7C0B, 0x7389, 0x5266, 0x7BEC, 0xB636, 0x742E, 0x7C0B,
-    0x742D, 0x4287, 0x5308, 0x8CD2, 0x636C, 0x7C2E, 0x84B0, 0x84D0,
-    0x7C2E, 0xA573, 0xADF6, 0x846F, 0xCED8, 0xC698, 0xC6BA, 0xBE57,
-    0xE7DF, 0xE7DF, 0xC6BA, 0x9534, 0x7C51, 0xE7FF, 0xCF1B, 0xB637,
-    0xDFBF, 0xE7FF, 0xA5D7, 0xB659, 0xE7FF, 0xDF9E, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xE7DF, 0xDF9E, 0xE7DF, 0x9576,
-    0xD77E, 0xB659, 0xA5F8, 0xD75E, 0x6C10, 0x7451, 0xD77D, 0x6411,
-    0x3AEC, 0x8D14, 0x538E, 0x538E, 0x84F3, 0x21E8, 0x3249, 0x3AAA,
-    0x3269, 0x2A6A, 0x432D, 0x4AEC, 0x7CB3, 0x63F0, 0x2A29, 0x42AB,
-    0x3229, 0x3A8B, 0x428B, 0x29E8, 0x3AEC, 0x42CB, 0x4227, 0x31A6,
-    0x29A6, 0x5AE9, 0x62C9, 0x5AA8, 0x4247, 0x2124, 0x2963, 0x31C5,
-    0x0000, 0x0000, 0x2103, 0x3184, 0x0861, 0x2984, 0x31E5, 0x4247,
-    0x3A26, 0x52A7, 0x62E7, 0x6B28, 0x62E7, 0x6B07, 0x4205, 0x3163,
-    0x39C4, 0x4A25, 0x39A4, 0x3184, 0x4A26, 0x6307, 0x5AC6, 0x5AC6,
-    0x7388, 0x83EA, 0x6B27, 0x8C0A, 0xA4CC, 0xACEC, 0xB50D, 0xB52D,
-    0x83C9, 0x62E7, 0x5B08, 0x62E6, 0x62C6, 0x62C6, 0x62E6, 0x6328,
-    0x7C0B, 0x6B48, 0x31E6, 0x4A88, 0x39C4, 0x4225, 0x39E4, 0x5266,
-    0x4225, 0x41E5, 0x3184, 0x39C5, 0x39E5, 0x3184, 0x39A4, 0x39E5,
-    0x39C5, 0x39E5, 0x39E5, 0x39C4, 0x3184, 0x2943, 0x2923, 0x3164,
-    0x3184, 0x39C4, 0x39C5, 0x3184, 0x4A25, 0x4A45, 0x2123, 0x3163,
-    0x39E6, 0x4A8A, 0x18C3, 0x0861, 0x3983, 0x634B, 0x9D76, 0x4249,
-    0x1082, 0x0000, 0x1146, 0x2A6B, 0x10C4, 0x1904, 0x0041, 0x2A49,
-    0x63ED, 0x6B69, 0x39C4, 0x2943, 0x31A4, 0x39A4, 0x3184, 0x3164,
-    0x39A4, 0x31A4, 0x3184, 0x3184, 0x39C5, 0x39C5, 0x31A4, 0x3184,
-    0x5B28, 0x6369, 0x8C4B, 0x842A, 0x7BEA, 0x7BEA, 0x6B69, 0x41E5,
-    0x2103, 0x31A4, 0x4A66, 0x5286, 0x31A4, 0x3A26, 0x4AA8, 0x4AA7,
-    0x2944, 0x4247, 0x29A5, 0x4A87, 0x4287, 0x5309, 0x73CA, 0x7BEA,
-    0x7BEA, 0x73CA, 0xACCC, 0x9C8B, 0x6B48, 0xA4AC, 0x8C6B, 0x3A06,
-    0x39C5, 0x6329, 0x4A46, 0x83EB, 0x6349, 0x4247, 0x4246, 0x73EA,
-    0x4AC8, 0x3A05, 0x73CA, 0x6BCB, 0x73CB, 0x638B, 0x5BAB, 0x6BEC,
-    0x52E9, 0x9511, 0x9511, 0x530A, 0xD73A, 0xB5F5, 0xBE57, 0xD71B,
-    0xDFBE, 0xDF9F, 0xDF7D, 0xC6B9, 0x94F2, 0xE7FF, 0xB5F5, 0xCF1B,
-    0xDFFF, 0x9D95, 0x6BAE, 0xD73D, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFBF, 0xDF9E, 0xD79E, 0xDF9F, 0x7C72, 0x9D96, 0xDF9E, 0x8D35,
-    0x8535, 0x9DB7, 0x7451, 0x7CB3, 0xB69A, 0x5BF0, 0x4B4D, 0x3ACB,
-    0x4B4D, 0x3AEC, 0x538E, 0xB659, 0x538E, 0x84D3, 0x3ACB, 0x7431,
-    0x5BAF, 0x536E, 0x9535, 0x432D, 0x3AEC, 0x31A6, 0x4A06, 0x5287,
-    0x62E8, 0x2923, 0x18C2, 0x2103, 0x39C5, 0x5AA8, 0x83AB, 0x83CB,
-    0x4206, 0x39C5, 0x41E5, 0x39C5, 0x0861, 0x2185, 0x4287, 0x31E6,
-    0x3A06, 0x4A46, 0x4206, 0x39C5, 0x5286, 0x5286, 0x2944, 0x3164,
-    0x39A4, 0x41E5, 0x39C5, 0x3184, 0x2943, 0x39C5, 0x39E5, 0x4A46,
-    0x5286, 0x4A45, 0x3183, 0x4225, 0x6B48, 0x7B89, 0x83EA, 0x7B89,
-    0x5AC7, 0x6B49, 0x5266, 0x6B07, 0x5AC6, 0x6B27, 0x5286, 0x4205,
-    0x944B, 0x7BA9, 0x5286, 0x5266, 0x4A25, 0x7BCA, 0x2963, 0x39C5,
-    0x5266, 0x4A46, 0x2123, 0x2964, 0x31A4, 0x31A5, 0x2964, 0x3184,
-    0x39A5, 0x39E5, 0x39E5, 0x2984, 0x3184, 0x39A5, 0x3184, 0x3184,
-    0x31A4, 0x4205, 0x39E5, 0x39E5, 0x39C5, 0x4205, 0x2103, 0x0000,
-    0x29C8, 0x1925, 0x0842, 0x1905, 0x2986, 0x536E, 0x31E8, 0x0000,
-    0x0000, 0x0021, 0x1987, 0x222B, 0x2167, 0x3A49, 0x21A6, 0x3226,
-    0x3226, 0x2984, 0x2143, 0x31A4, 0x31C4, 0x31A4, 0x31A4, 0x31C5,
-    0x31A4, 0x31A4, 0x31C4, 0x39E5, 0x1902, 0x1943, 0x29E5, 0x29A4,
-    0x6349, 0x5308, 0x4A66, 0x7BC9, 0x6BC9, 0x6BAA, 0x7C0A, 0x8C6C,
-    0x3A06, 0x4288, 0x7389, 0x3184, 0x4226, 0x4226, 0x6349, 0x6B69,
-    0x31C5, 0x4267, 0x2123, 0x4246, 0x29C5, 0x42C9, 0x6369, 0x52C7,
-    0x8C2B, 0x6B89, 0x8C4B, 0x6B89, 0xA4CC, 0x7C0B, 0x5B49, 0x4226,
-    0x2923, 0x4A66, 0x4205, 0x62C7, 0x18E2, 0x31A4, 0x5287, 0x7C0B,
-    0x5349, 0x3A05, 0x8C4B, 0x4AC7, 0x39E5, 0x73EC, 0x534B, 0x744F,
-    0x3A26, 0x73AB, 0x5B0B, 0x5B2B, 0xAD71, 0xBE35, 0xB5D5, 0x7C0F,
-    0xD79E, 0xDFFF, 0xC6FB, 0xB615, 0xA572, 0xDFBE, 0xADB3, 0xC6D9,
-    0xD71B, 0x4268, 0x638D, 0xF7FF, 0xD77E, 0xDFBE, 0xDFBF, 0xDF9E,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xC6DB, 0xDFDF, 0xE7FF, 0xAE59,
-    0x8D35, 0xC6FC, 0x8514, 0xA618, 0x9DD7, 0x4B4E, 0xCF3C, 0x5BCF,
-    0x7C93, 0x8CF4, 0x5B8E, 0xAE38, 0x5BCF, 0x6C51, 0x2A49, 0x6BF0,
-    0x7C92, 0x63CF, 0xB659, 0xA5F8, 0x536E, 0x2145, 0x5A67, 0x5287,
-    0x5288, 0x5AC8, 0x6B29, 0x5247, 0x3144, 0x0000, 0x0000, 0x20E2,
-    0x3164, 0x5287, 0x6B29, 0x6308, 0x6B49, 0x6B49, 0x52A7, 0x52A7,
-    0x2143, 0x2964, 0x1904, 0x1904, 0x6B08, 0x39C4, 0x39E5, 0x2944,
-    0x3164, 0x39A4, 0x39A4, 0x41E5, 0x39C4, 0x3184, 0x2964, 0x2943,
-    0x3184, 0x39C5, 0x39A4, 0x2963, 0x31A4, 0x4205, 0x39E5, 0x3184,
-    0x3184, 0x3184, 0x3164, 0x41E5, 0x3184, 0x5AA7, 0x5286, 0x18E3,
-    0x6B08, 0x6B08, 0x18E2, 0x39E5, 0x39E5, 0x5267, 0x4206, 0x3184,
-    0x4A66, 0x39E5, 0x29A4, 0x39E5, 0x29A4, 0x4206, 0x39C5, 0x2944,
-    0x31C5, 0x31C4, 0x31A4, 0x39E5, 0x31A4, 0x31A4, 0x3184, 0x39E5,
-    0x39C5, 0x31A4, 0x4A46, 0x7369, 0x31A4, 0x31A4, 0x39E5, 0x4A46,
-    0x31C6, 0x2144, 0x31C5, 0x4A47, 0x5B09, 0x532B, 0x2985, 0x2123,
-    0x3185, 0x2965, 0x2165, 0x4227, 0x39E5, 0x4226, 0x3184, 0x5286,
-    0x2963, 0x31C4, 0x39E5, 0x39E5, 0x31A4, 0x39E5, 0x3A26, 0x2184,
-    0x29E6, 0x21A4, 0x31E5, 0x29C5, 0x10C2, 0x1124, 0x1964, 0x21C5,
-    0x5286, 0x52A7, 0x2143, 0x3206, 0x52E8, 0x6BAA, 0x6BCA, 0x740B,
-    0x5349, 0x5329, 0x5286, 0x2184, 0x3226, 0x3A26, 0x6BAA, 0x5AE8,
-    0x31C5, 0x4227, 0x18E2, 0x4AA7, 0x3A46, 0x5309, 0x6B69, 0x5AE7,
-    0x7BCA, 0x52C8, 0x5B29, 0x6B89, 0xA4EC, 0x5B49, 0x73EA, 0x6B49,
-    0x31E5, 0x52A7, 0x7BEB, 0x5266, 0x29C5, 0x31E5, 0x4A46, 0x842B,
-    0x5B49, 0x7389, 0xA4ED, 0x3226, 0x0020, 0x840C, 0x4AEA, 0x3A27,
-    0x73AA, 0x4226, 0x4225, 0x8CD0, 0xAD4F, 0x8C6D, 0xADD5, 0x73EF,
-    0xCEFB, 0xCEFA, 0xA5B4, 0xADB3, 0x9CEE, 0xB5B2, 0x8C6C, 0xC6B9,
-    0xA510, 0x840D, 0xC6BB, 0xE7DF, 0x742F, 0xC71C, 0xDFDF, 0xE7FF,
-    0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDFBF, 0xE7DF, 0xD79E, 0xDFDF, 0x9DB7,
-    0xB6BA, 0xEFFF, 0xAE39, 0x9576, 0xA5F8, 0x4B4E, 0xEFFF, 0x9555,
-    0x6410, 0x9D96, 0x5BAF, 0xC71C, 0x8D14, 0x8D35, 0x63F0, 0x9D96,
-    0x7C92, 0x538E, 0x9D96, 0xD73D, 0x84F4, 0x1904, 0x20C2, 0x4206,
-    0x4206, 0x39E6, 0x39E6, 0x52A8, 0x5AC8, 0x4A47, 0x5267, 0x4206,
-    0x0820, 0x0840, 0x10A1, 0x20E2, 0x4A26, 0x4A25, 0x4A06, 0x62C8,
-    0x83AA, 0x83CA, 0x4247, 0x4A48, 0x7BCA, 0x2963, 0x29C6, 0x2A27,
-    0x42A7, 0x5308, 0x5AA7, 0x52A7, 0x4246, 0x39C5, 0x2923, 0x2964,
-    0x2944, 0x3184, 0x39A4, 0x39C5, 0x41E5, 0x39C5, 0x39C5, 0x4205,
-    0x41E5, 0x39A4, 0x2123, 0x31A4, 0x31A4, 0x4A46, 0x8C2B, 0x4226,
-    0x39C5, 0x6308, 0x31A4, 0x5287, 0x39A5, 0x3184, 0x83CA, 0x4A66,
-    0x39E5, 0x31C5, 0x31E5, 0x6B69, 0x31C5, 0x52E8, 0x31C5, 0x2984,
-    0x3A05, 0x2143, 0x39E5, 0x4226, 0x39E5, 0x2984, 0x39E5, 0x4226,
-    0x39C5, 0x2144, 0x4A25, 0x62E7, 0x2943, 0x3184, 0x3184, 0x5286,
-    0x4225, 0x39E5, 0x39E5, 0x39C4, 0x41E4, 0x31A4, 0x3184, 0x31A4,
-    0x39E5, 0x31A4, 0x2964, 0x5286, 0x4205, 0x2984, 0x2123, 0x39C4,
-    0x3A26, 0x31C5, 0x31A4, 0x3184, 0x31A4, 0x3A26, 0x29E5, 0x1164,
-    0x2247, 0x21E6, 0x08A2, 0x1103, 0x0881, 0x1944, 0x0061, 0x21E6,
-    0x3184, 0x41E5, 0x3A26, 0x3A27, 0x3184, 0x39E5, 0x4205, 0x31A4,
-    0x5AE8, 0x52C8, 0x7C0B, 0x29C5, 0x6B68, 0x73CB, 0x6369, 0x52C7,
-    0x2185, 0x2964, 0x31C5, 0x52A7, 0x5287, 0x842B, 0x6369, 0x4A87,
-    0x52C8, 0x5B29, 0x3267, 0x5329, 0x5B29, 0x52E8, 0xACEC, 0x7BCA,
-    0x6369, 0x6369, 0x7C0B, 0x6B69, 0x4AC7, 0x42A7, 0x52A7, 0x5308,
-    0x63AA, 0x7BEA, 0x948C, 0x3AA7, 0x4246, 0x5AC8, 0x31C5, 0x2964,
-    0x5AE8, 0x2984, 0x7BA9, 0x6B6B, 0x9CAD, 0x52A6, 0x3A47, 0x6BAD,
-    0x8C6E, 0xA4EE, 0xBE36, 0x6BCB, 0x6B88, 0xA551, 0x94CD, 0xC6B8,
-    0x83EB, 0xA531, 0xE7DF, 0xD79E, 0x9533, 0xCF5D, 0xE7FF, 0x9D96,
-    0xBEBA, 0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF, 0xCF5D,
-    0xDFDF, 0xDFDF, 0xBEDB, 0xB659, 0xDF9E, 0xCF3D, 0xDFBF, 0xE7DF,
-    0xEFFF, 0xB659, 0x7472, 0xBEBB, 0xAE59, 0x7C92, 0xE7FF, 0xDFBE,
-    0xC6DB, 0x7452, 0xD73D, 0xE7BE, 0x63CF, 0x0062, 0x0000, 0x0841,
-    0x2103, 0x3164, 0x4A06, 0x4A27, 0x4A26, 0x4206, 0x39E6, 0x4A26,
-    0x6B29, 0x6B28, 0x5AC8, 0x39E5, 0x3184, 0x39A5, 0x39A4, 0x4A26,
-    0x41C5, 0x7389, 0x4A26, 0x0020, 0x10A2, 0x1924, 0x10E3, 0x2207,
-    0x3AC9, 0x3A67, 0x3226, 0x2A26, 0x21C5, 0x2184, 0x29A5, 0x3A88,
-    0x3206, 0x2123, 0x29C5, 0x3A26, 0x31C5, 0x2984, 0x31A4, 0x39E5,
-    0x39C4, 0x31A4, 0x3164, 0x5AC7, 0x4226, 0x2943, 0x7B89, 0x8C0B,
-    0x4205, 0x6308, 0x9C8C, 0x6B08, 0x4A46, 0x2143, 0x7369, 0x6B28,
-    0x31E5, 0x73AA, 0x39E5, 0x8C4B, 0x31C5, 0x73AA, 0x4246, 0x3A67,
-    0x73AA, 0x1903, 0x31C5, 0x31C5, 0x31C5, 0x4226, 0x31C5, 0x31E5,
-    0x5AE8, 0x2964, 0x5266, 0x4A46, 0x1903, 0x4246, 0x39E5, 0x39C5,
-    0x31C4, 0x39E5, 0x39C5, 0x3184, 0x3184, 0x31C5, 0x31A5, 0x31A4,
-    0x31A4, 0x31C5, 0x39E5, 0x3A05, 0x3184, 0x3184, 0x3184, 0x3184,
-    0x3A05, 0x3A05, 0x31A4, 0x31A4, 0x2184, 0x3267, 0x2A06, 0x21A5,
-    0x19C6, 0x2A47, 0x1924, 0x1103, 0x10E3, 0x0861, 0x0000, 0x0000,
-    0x39A4, 0x3984, 0x3A67, 0x3A67, 0x3984, 0x3164, 0x3164, 0x3164,
-    0x3184, 0x3164, 0x6B29, 0x52E8, 0x8C4A, 0x6B88, 0x73AA, 0x8C2A,
-    0x7389, 0x3A26, 0x3206, 0x6308, 0x2102, 0x73CA, 0x636A, 0x31C5,
-    0x52A7, 0x7BA9, 0x7C2B, 0x6BAA, 0x3A05, 0x4226, 0x7BCA, 0x7BC9,
-    0x842B, 0x52A7, 0x6B69, 0x73EA, 0x844B, 0x5B28, 0x3A66, 0x5308,
-    0x7BEB, 0x73AA, 0x638A, 0x3AA7, 0x9C8C, 0x6B08, 0x6308, 0x7369,
-    0x4287, 0x5308, 0xA4CD, 0x18C1, 0x83C9, 0x6308, 0x1923, 0x84B1,
-    0x9511, 0xAD2F, 0xC677, 0x4AC8, 0x52C7, 0x94F1, 0x9CEE, 0xB5D3,
-    0xACEC, 0xA572, 0xDF9E, 0xC6FB, 0xCF5D, 0xDFFF, 0x9534, 0x7410,
-    0xD73D, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFDF, 0xE7DF, 0xDFBF, 0xDFBF, 0xE7DF, 0xC6BB,
-    0xB67A, 0xCF1C, 0x9556, 0xEFFF, 0x7CB3, 0xAE59, 0xDFFF, 0xD7BE,
-    0xE7DF, 0xE7BF, 0xE7DF, 0xE7DF, 0x9DB7, 0x4AEC, 0x10C3, 0x10A3,
-    0x0000, 0x0000, 0x0820, 0x2923, 0x41C5, 0x4A06, 0x5267, 0x5A87,
-    0x4A47, 0x4247, 0x2145, 0x31C5, 0x5AC8, 0x4247, 0x5287, 0x5AC7,
-    0x2984, 0x2985, 0x1082, 0x0000, 0x0020, 0x0882, 0x0841, 0x1103,
-    0x2A47, 0x1964, 0x2A06, 0x1103, 0x4287, 0x4AC8, 0x2A06, 0x2A47,
-    0x32A8, 0x3247, 0x32A8, 0x3268, 0x2206, 0x21C5, 0x29A4, 0x2143,
-    0x31A5, 0x3184, 0x18C2, 0x4A46, 0x5AC7, 0x10A2, 0x2943, 0x6B08,
-    0x2963, 0x7BAA, 0x8C0A, 0x2943, 0x7BCA, 0x4A66, 0x31A4, 0x8C2B,
-    0x3A05, 0x7C0B, 0x73A9, 0xACEC, 0x4225, 0x6B89, 0x4A67, 0x4287,
-    0x73AA, 0x2144, 0x2964, 0x4A67, 0x6328, 0x3A05, 0x31E5, 0x4267,
-    0x6349, 0x4246, 0x3A06, 0x39E5, 0x1923, 0x4A86, 0x6308, 0x5AE8,
-    0x29A4, 0x31C5, 0x31C5, 0x31C5, 0x31A4, 0x39E5, 0x3A05, 0x39E5,
-    0x31A5, 0x39E5, 0x39E5, 0x31A5, 0x3184, 0x39E5, 0x39E5, 0x31A4,
-    0x31A4, 0x29A4, 0x3A06, 0x2123, 0x10C2, 0x21C5, 0x2A47, 0x1924,
-    0x1924, 0x0881, 0x0861, 0x2185, 0x1944, 0x0020, 0x0000, 0x0000,
-    0x39E5, 0x5AE8, 0x42A8, 0x4288, 0x62E7, 0x41C4, 0x3184, 0x3163,
-    0x41C5, 0x3184, 0x5AA7, 0x5266, 0x5266, 0x31A4, 0x5266, 0x9CAC,
-    0x73A9, 0x3A67, 0x31C5, 0x6B69, 0x5AC7, 0x73CA, 0x6BAB, 0x3A05,
-    0x4205, 0x4A67, 0x63AB, 0x6369, 0x4A67, 0x31C5, 0x39E5, 0x83EA,
-    0x7C0B, 0x3183, 0x7389, 0x7BCA, 0x7C0A, 0x73CA, 0x73C9, 0xACEC,
-    0x8C0A, 0x73AA, 0x42C7, 0x42C7, 0x946B, 0x944B, 0x7BA9, 0x6328,
-    0x6BAA, 0x8C4C, 0x8C2B, 0x2122, 0x944B, 0x5AE8, 0x0040, 0x6BCD,
-    0x9D30, 0x7BCC, 0x7C30, 0x4AC7, 0x73A9, 0x744F, 0x8C8C, 0x948D,
-    0x4A65, 0xB5D4, 0xA5D7, 0x73ED, 0x9D95, 0xCF3D, 0x9534, 0xDFDF,
-    0xDFDF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7DF, 0xB639,
-    0xA5D7, 0xCF3C, 0x8515, 0xEFFF, 0x7472, 0xBEDB, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E, 0xE7FF, 0x9D97, 0x31E8, 0x2166,
-    0x1105, 0x10E4, 0x10E4, 0x0041, 0x0000, 0x0841, 0x10A1, 0x2102,
-    0x2943, 0x3164, 0x5AC8, 0x62E8, 0x4A47, 0x4206, 0x4A46, 0x5287,
-    0x5A87, 0x2964, 0x0020, 0x0000, 0x0020, 0x0020, 0x0861, 0x08A1,
-    0x3247, 0x2206, 0x1103, 0x0000, 0x3184, 0x4246, 0x2184, 0x3288,
-    0x3AA8, 0x3AA8, 0x3288, 0x32A8, 0x5B8A, 0x3A87, 0x29E5, 0x1944,
-    0x2164, 0x1903, 0x4A26, 0x3184, 0x7369, 0x39C5, 0x4205, 0x9C6B,
-    0x5286, 0x4A66, 0x946B, 0x4A46, 0x6B69, 0x7389, 0x4225, 0x7B89,
-    0x6B48, 0x7BEA, 0x73EA, 0xACEC, 0x3A05, 0x6BA9, 0x83EA, 0x3A66,
-    0x6B89, 0x4267, 0x2144, 0x4A67, 0x83EA, 0x4246, 0x2184, 0x6308,
-    0x6B48, 0x4A87, 0x21A5, 0x4A87, 0x39E5, 0x31E5, 0x39E5, 0x6329,
-    0x31C5, 0x31A5, 0x31C5, 0x31C5, 0x39E5, 0x3205, 0x3A25, 0x4A86,
-    0x31E5, 0x31C5, 0x39E5, 0x2984, 0x2984, 0x39E5, 0x39C4, 0x39C4,
-    0x31A4, 0x0861, 0x0020, 0x0020, 0x0000, 0x1924, 0x3A67, 0x0020,
-    0x0881, 0x0000, 0x0000, 0x10C2, 0x0881, 0x0020, 0x0000, 0x0000,
-    0x4AC8, 0x42A8, 0x4288, 0x5B29, 0x73A9, 0x39E5, 0x5AC7, 0x52A7,
-    0x4225, 0x3183, 0x62E7, 0x5286, 0x2944, 0x2944, 0x39A4, 0xA48B,
-    0x5AA6, 0x31C5, 0x31A4, 0x4226, 0x4205, 0x62C7, 0x7BCA, 0x3163,
-    0x83A9, 0x2943, 0x2A26, 0x5B29, 0x6308, 0x31A4, 0x62E7, 0x946B,
-    0x7389, 0x7BCA, 0x942A, 0x73A9, 0x7C2B, 0x7C0A, 0xACEC, 0xB50C,
-    0x8C0A, 0x73AA, 0x4B08, 0x6BCA, 0x944B, 0xACCC, 0x73CA, 0x3246,
-    0x7C0B, 0x6BCA, 0x6B8A, 0x2102, 0x5AE8, 0x5B49, 0x3A47, 0x4225,
-    0x6308, 0x10A1, 0x5B2B, 0x42A7, 0x7C0A, 0x2226, 0x844B, 0x73AA,
-    0x10E1, 0xADD4, 0xA5F6, 0x6BED, 0x9D53, 0x8CD1, 0xC6DB, 0xDFFF,
-    0xD79E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xE7DF,
-    0xE7FF, 0xD79E, 0xD77E, 0xDFDF, 0x9DD7, 0xCF1C, 0xDFDF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xD77E, 0x9DB7,
-    0x7C93, 0x6C31, 0x42EC, 0x29E9, 0x1967, 0x08C4, 0x0082, 0x0041,
-    0x0000, 0x0000, 0x0861, 0x0840, 0x20E2, 0x3164, 0x2943, 0x2103,
-    0x2964, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0040,
-    0x0861, 0x1965, 0x10C3, 0x0020, 0x1944, 0x3267, 0x2A06, 0x21E6,
-    0x3A06, 0x5B08, 0x42A7, 0x4287, 0x6B49, 0x6B49, 0x3A67, 0x73EB,
-    0x21C5, 0x1944, 0x7BAA, 0x3A05, 0x7389, 0x4A46, 0x5287, 0x62E7,
-    0xAD0C, 0x73A9, 0xA4EC, 0x7388, 0x942A, 0xAD0D, 0x6308, 0x6B28,
-    0x83CA, 0x4225, 0x6BCA, 0xA4AB, 0x39E5, 0x6BA9, 0x840A, 0x3A67,
-    0x73CA, 0x6349, 0x39C5, 0x5AE8, 0x6348, 0x4226, 0x2984, 0x6308,
-    0x5AE8, 0x4AA8, 0x29C5, 0x6B69, 0x4A66, 0x29C5, 0x31A5, 0x5AE8,
-    0x29A4, 0x31E5, 0x31E5, 0x3A26, 0x31E5, 0x3226, 0x3A26, 0x52A7,
-    0x3205, 0x29A5, 0x5AE8, 0x5AA7, 0x2984, 0x39C5, 0x31A4, 0x39E4,
-    0x4205, 0x2963, 0x0020, 0x0000, 0x0000, 0x0020, 0x52A7, 0x0840,
-    0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6369, 0x5309, 0x42A8, 0x5B29, 0x8C4B, 0x6BAA, 0x7C4B, 0x6BCA,
-    0x63AA, 0x6BAA, 0x7369, 0x31A4, 0x5266, 0x8C0A, 0x5AC7, 0x8C2A,
-    0x7C0A, 0x3A05, 0x31A5, 0x3184, 0x3184, 0x4A46, 0x6B28, 0x5AC7,
-    0xB52D, 0x7BCA, 0x3A67, 0x4A46, 0x7369, 0x5286, 0xB52D, 0x83E9,
-    0x944B, 0x7BCA, 0xA4AC, 0x8C2A, 0x8C4B, 0x948C, 0x948B, 0xA4CC,
-    0x840A, 0x6369, 0x42C8, 0x73CA, 0xACED, 0xB4ED, 0x73EA, 0x3AA8,
-    0x42C8, 0x42A7, 0x6B6A, 0x4205, 0x52E8, 0x3AC8, 0x638A, 0x7369,
-    0x7BCA, 0x3A05, 0x73AB, 0x6B68, 0x7BEA, 0x2226, 0x7C0A, 0x52E8,
-    0x4A87, 0x6B69, 0x9D12, 0x9553, 0x740D, 0xBE35, 0xDFDF, 0xD75D,
-    0xE7FF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDFDF, 0xBE98, 0xCF1C,
-    0xDFBF, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xDFBF, 0xDFBF, 0xDF9E, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9E, 0xDFBF, 0xDFDF,
-    0xCF5D, 0xCF3D, 0xC6FC, 0xCEFC, 0x84B4, 0x534E, 0x42EC, 0x326A,
-    0x1925, 0x10C3, 0x0021, 0x0041, 0x0021, 0x0000, 0x0000, 0x0020,
-    0x1924, 0x0882, 0x08A2, 0x1924, 0x0020, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x0000, 0x10C2, 0x29E6, 0x1985, 0x32A9,
-    0x1964, 0x6308, 0x6B49, 0x0861, 0x31A5, 0x6B49, 0x31E5, 0x8C6C,
-    0x5B08, 0x3205, 0x73AA, 0x5AE7, 0x840A, 0x5AC7, 0x8C0A, 0x8C0A,
-    0x5AA7, 0x5AE7, 0x944B, 0x6B07, 0x946B, 0x8C6B, 0x840B, 0x944B,
-    0x8BE9, 0x5AC8, 0x6369, 0x8C0A, 0x31A4, 0x6B89, 0x8C4B, 0x29C5,
-    0x31A4, 0x6349, 0x4226, 0x6B49, 0x4AA7, 0x3206, 0x2144, 0x7389,
-    0x4A87, 0x4287, 0x6328, 0x29A4, 0x31C5, 0x31C5, 0x2964, 0x62E8,
-    0x31C5, 0x3A05, 0x39E5, 0x3A05, 0x31A4, 0x3A26, 0x4287, 0x5B08,
-    0x3226, 0x2A06, 0x4AA7, 0x5AE8, 0x2984, 0x39C5, 0x39A4, 0x3184,
-    0x39A4, 0x4225, 0x3184, 0x18C2, 0x10A2, 0x2943, 0x4A06, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x6389, 0x5B49, 0x4AE9, 0x6349, 0x8C4B, 0x6369, 0x5B49, 0x63AA,
-    0x63AA, 0x7C2B, 0x5B48, 0x4A66, 0x9C6B, 0x9C8B, 0x4AA7, 0x6B69,
-    0x6BCA, 0x740B, 0x31A4, 0x3184, 0x62E8, 0x83EA, 0x5AC7, 0x7BA9,
-    0xA4CC, 0x7389, 0x4246, 0x18E2, 0x7369, 0x6B27, 0xB50C, 0xA4AB,
-    0x946B, 0x7BA9, 0x944B, 0x7BA9, 0x9C6B, 0x73CA, 0x6369, 0x946C,
-    0x6BAA, 0x42C8, 0x3267, 0x6B89, 0xAD0D, 0x842B, 0x5B28, 0x73EB,
-    0x42A8, 0x5308, 0x7BAA, 0x5286, 0x73AA, 0x3AA8, 0x5308, 0x8C2B,
-    0x73CA, 0x7BEB, 0x9CAC, 0x83EA, 0x42E8, 0x3287, 0x946B, 0x52C7,
-    0x4A87, 0x7348, 0x8CD0, 0x8D33, 0x4AC8, 0xB615, 0x9596, 0xB618,
-    0xCF1C, 0xD75D, 0xDF9F, 0xD79E, 0xDFBF, 0xCEFB, 0xC6B9, 0xDFDF,
-    0xDFBF, 0xDFDF, 0xDFDF, 0xDFBF, 0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xE7DF, 0xE7DF,
-    0xE7DF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xD79E, 0xD77E,
-    0xB67A, 0xAE3A, 0xAE3A, 0xB69B, 0xBEBB, 0xB69B, 0x9DF9, 0x7CD5,
-    0x538F, 0x3AAD, 0x326B, 0x21C8, 0x2166, 0x10A2, 0x10A3, 0x0000,
-    0x0000, 0x10E4, 0x1945, 0x3A8A, 0x2187, 0x10A3, 0x0882, 0x0861,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1944,
-    0x1964, 0x4246, 0x83EB, 0x18C2, 0x31A5, 0x7B8A, 0x39E5, 0x3184,
-    0xA4ED, 0x6B69, 0x73A9, 0xA4ED, 0x8C6B, 0x6B89, 0x5286, 0xACEC,
-    0x5266, 0x4226, 0x5AC7, 0x8C2A, 0x9C8B, 0x8C4B, 0x846B, 0x8C0A,
-    0x7348, 0x5AE8, 0x3A87, 0x7389, 0x31A4, 0x7C0B, 0x840A, 0x6308,
-    0x6B49, 0x6B6A, 0x4246, 0x5287, 0x3A46, 0x5B6A, 0x31A4, 0x7369,
-    0x4226, 0x52E8, 0x73AA, 0x4A87, 0x29A5, 0x31C5, 0x29A5, 0x4247,
-    0x2984, 0x2984, 0x3184, 0x2984, 0x2984, 0x3A46, 0x3A27, 0x3206,
-    0x3267, 0x5B2A, 0x3A67, 0x3206, 0x4226, 0x5286, 0x39C5, 0x31A4,
-    0x39E5, 0x39E5, 0x39C5, 0x31A5, 0x2984, 0x62E8, 0x4A26, 0x0861,
-    0x2123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x638A, 0x5B69, 0x3288, 0x5B49, 0x948B, 0x4AE8, 0x42E8, 0x9CAC,
-    0x6BA9, 0x6BCA, 0x6B89, 0x842A, 0x840A, 0x946B, 0x6349, 0x73AA,
-    0x5B28, 0x7BEA, 0x8C0A, 0x73CA, 0x740B, 0x840A, 0x52C7, 0x946B,
-    0xACCC, 0x8C2B, 0x5329, 0x840B, 0x83EA, 0x8C0A, 0x7368, 0xB50C,
-    0x9C6B, 0x840A, 0x946B, 0x83EA, 0x6B68, 0x6B89, 0x948C, 0x7389,
-    0x4AC7, 0x6BAA, 0x3206, 0x4225, 0xA4ED, 0x6348, 0x842B, 0x6369,
-    0x3A87, 0x7BCA, 0x9C8C, 0x62E8, 0x5B29, 0x4AE9, 0x7BEB, 0x946B,
-    0x73CA, 0x6349, 0x73CA, 0x7BEA, 0x42E8, 0x42A7, 0x83EA, 0x3A05,
-    0x4246, 0x5AE7, 0x738A, 0x5B49, 0x532A, 0x9D32, 0x84D2, 0xA5B4,
-    0x8CD2, 0xA63A, 0xAE5A, 0xA63A, 0xA619, 0x9512, 0xBE9A, 0xC6FC,
-    0xC6FC, 0xC71D, 0xC6FC, 0xD77E, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xE7DF, 0xDFDF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9F, 0xDFBF, 0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDF9F,
-    0xD79E, 0xD79E, 0xDF9E, 0xDFBF, 0xDFBF, 0xDFBF, 0xC71D, 0xBEDC,
-    0xBEDC, 0xD77E, 0xDF9F, 0xD79E, 0xD79E, 0xD79E, 0xDFBF, 0xD77E,
-    0xBEDB, 0xC6DC, 0xBEBB, 0xBE9B, 0xB67A, 0x9DF9, 0x9DF9, 0xA63A,
-    0x9E19, 0x7473, 0x6C53, 0x4AED, 0x29E8, 0x10C4, 0x426A, 0x3A29,
-    0x4A8B, 0x63AF, 0x29E8, 0x2A2A, 0x3AED, 0x2187, 0x2166, 0x3229,
-    0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0041, 0x0841, 0x736A, 0x3164, 0x0000, 0x18C2, 0x7349, 0x2963,
-    0x5AE8, 0x8C4B, 0x73A9, 0xACED, 0x842B, 0x7BCA, 0x4A66, 0xA4EC,
-    0x7B89, 0x6308, 0x31C4, 0x8C09, 0xACEC, 0x844B, 0x8C6B, 0x6328,
-    0x7348, 0x9C8B, 0x3A87, 0x8C2B, 0x62E8, 0x4A66, 0x840A, 0x6328,
-    0x840B, 0x31E5, 0x29E6, 0x7369, 0x3A67, 0x4B08, 0x5AC8, 0x7368,
-    0x8C0A, 0x4246, 0x638A, 0x62E8, 0x4A46, 0x39E5, 0x3267, 0x3A68,
-    0x2985, 0x4205, 0x3184, 0x2944, 0x31A4, 0x3A87, 0x29E6, 0x1965,
-    0x3247, 0x5AE8, 0x2143, 0x29C5, 0x52A6, 0x5AA6, 0x2984, 0x4205,
-    0x5AC7, 0x31A4, 0x31A4, 0x31A4, 0x31C5, 0x3A26, 0x5287, 0x31A4,
-    0x4A66, 0x2103, 0x18E2, 0x0841, 0x0861, 0x3184, 0x10A2, 0x0000,
-    0x6348, 0x4287, 0x5329, 0x6B89, 0x8C4A, 0x7C2A, 0x5B49, 0x946B,
-    0x6369, 0x636A, 0x6389, 0x73CA, 0x8C4B, 0x9C8B, 0x6B89, 0x840A,
-    0x7BCA, 0x4AE8, 0xA4CC, 0x73A9, 0x5B69, 0x6BAA, 0x6B89, 0x73C9,
-    0x9C8B, 0x946B, 0x4AC7, 0xA4AC, 0x6B48, 0x842A, 0x6B27, 0xBD4D,
-    0x946B, 0xA4AB, 0x83EA, 0x942B, 0x7BCA, 0x6328, 0x8C4B, 0x6328,
-    0x4AA7, 0x840B, 0x31A4, 0x7389, 0xA4AC, 0x946B, 0x944B, 0x42C8,
-    0x3206, 0x52C7, 0x8BEA, 0x1923, 0x3247, 0x6349, 0x7BEA, 0x942B,
-    0x73A9, 0x73A9, 0x4B08, 0x5309, 0x5B49, 0x5B08, 0x5AE8, 0x1923,
-    0x4A87, 0x4A66, 0x5266, 0x5B07, 0x536B, 0x84F3, 0x84B1, 0xADD5,
-    0xD75E, 0xC71D, 0xBEDC, 0xC71D, 0xADF7, 0xA594, 0xCF3D, 0xBEBC,
-    0xA5F9, 0xA63A, 0xBEBB, 0xC71D, 0xCF5E, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xD75E, 0xD77E, 0xC71D, 0xC71D, 0xD77E, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBE, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDF9F, 0xDF9F, 0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xD79E, 0xC71D,
-    0xA639, 0x9DD8, 0xD77E, 0xE7DF, 0xDFBF, 0xDFBF, 0xD77E, 0xCF5D,
-    0xB67B, 0xB69B, 0xBEBC, 0xBEBC, 0xBEBB, 0xD77E, 0xE7BF, 0xE7DF,
-    0xC71D, 0xB67A, 0xB69B, 0xB69B, 0xB67B, 0xA61A, 0x9DF9, 0x9DF9,
-    0xA61A, 0x8D56, 0x9598, 0x7CB4, 0x8D37, 0x8D57, 0xA61A, 0xBEDC,
-    0xBE9B, 0xB638, 0x7431, 0x5B8F, 0x6BF0, 0x21A7, 0x3AAB, 0x322A,
-    0x29C8, 0x29C8, 0x2166, 0x18E3, 0x0000, 0x0000, 0x0020, 0x0020,
-    0x0000, 0x0000, 0x10A1, 0x62C9, 0x0000, 0x1081, 0x6308, 0x844C,
-    0x3A25, 0x7BCA, 0x52A6, 0x8C6B, 0x52E7, 0xA4CD, 0x6328, 0x840A,
-    0xBD2C, 0x7389, 0x3A66, 0x840A, 0x840A, 0x8C4B, 0x842B, 0x6B48,
-    0x7368, 0x942B, 0x4246, 0x9C8C, 0x7348, 0x18E2, 0x6B28, 0x3A06,
-    0x4AC7, 0x42A8, 0x3226, 0x83EA, 0x42A7, 0x3A87, 0x4A86, 0x7389,
-    0x9C6B, 0x10E3, 0x636A, 0x6308, 0x6B69, 0x7389, 0x42A8, 0x3AA8,
-    0x42A8, 0x83CA, 0x39C4, 0x39E5, 0x3206, 0x3267, 0x2A06, 0x52E9,
-    0x4309, 0x634A, 0x2164, 0x3205, 0x31C4, 0x39E4, 0x31A4, 0x4205,
-    0x6B49, 0x2144, 0x2984, 0x31C5, 0x29A5, 0x31C5, 0x4A87, 0x29C4,
-    0x4A66, 0x4A46, 0x3A05, 0x31A4, 0x2964, 0x4A66, 0x31A4, 0x2123,
-    0x4A46, 0x0881, 0x5309, 0x6B89, 0x52E7, 0x840A, 0x842B, 0x7BEA,
-    0x4AE8, 0x6B8A, 0x5B69, 0x73EA, 0x73EA, 0x7BEA, 0x6368, 0x8C2A,
-    0x840A, 0x5308, 0x9CCD, 0x6B48, 0x842B, 0x4AC7, 0x6328, 0x946B,
-    0xACAB, 0x8C2A, 0x73CA, 0x8C2B, 0x6B48, 0x7389, 0x6348, 0x842A,
-    0x944A, 0x9C8C, 0x6328, 0x73AA, 0x6B89, 0x7BAA, 0xA4AC, 0x5AA7,
-    0x39E5, 0x52A8, 0x4205, 0xA4CD, 0x6B28, 0xA48B, 0x6328, 0x42A8,
-    0x29A5, 0x4AC8, 0x2163, 0x31C5, 0x8C4C, 0x6329, 0x4A66, 0x946B,
-    0x52A7, 0x73AA, 0x4B09, 0x21A5, 0x5B08, 0x4A46, 0x2123, 0x29A5,
-    0x4A67, 0x31A5, 0x3A26, 0x4246, 0x4AA8, 0x6BEE, 0x6BAD, 0x84B2,
-    0xAE5B, 0xA5F9, 0x9DD9, 0x9DF9, 0xA574, 0x9D74, 0x9DFA, 0xAE3A,
-    0xAE3A, 0xAE5A, 0xAE3A, 0xA63A, 0xA5F9, 0x9DF9, 0x9DF9, 0x9DD9,
-    0xA63A, 0xAE5A, 0xBEBC, 0xBEBC, 0xCF5D, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9F, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDF9F, 0xDF9F,
-    0xDF9F, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E,
-    0xCF5E, 0xD77E, 0xCF1D, 0xAE7B, 0xCF5E, 0xCF5E, 0xD77E, 0xD77E,
-    0xD77E, 0xB6BC, 0xA63A, 0xAE5B, 0xB69B, 0xBEBB, 0xB67B, 0xB67A,
-    0xAE3A, 0x9DD9, 0x9DF9, 0x9DD9, 0x9DD9, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0xA63A, 0xA61A, 0xA63A, 0xA61A, 0xAE5B, 0x8D56, 0x5BCF,
-    0x6C30, 0x42AA, 0x63AE, 0x7C51, 0xA575, 0x7C71, 0x5BAF, 0x3ACB,
-    0x326A, 0x29E8, 0x2166, 0x18E4, 0x10C3, 0x0061, 0x0020, 0x0020,
-    0x0000, 0x0020, 0x0020, 0x6B2A, 0x0820, 0x62E9, 0x52A8, 0x5B49,
-    0x6B49, 0x7BCA, 0x52C7, 0x7BCA, 0x6BAA, 0x6B89, 0x6B68, 0x6369,
-    0x6B48, 0x7BC9, 0x5B28, 0x73A9, 0x840A, 0x944B, 0x7BCA, 0x7BA9,
-    0x39C4, 0x5287, 0x29A4, 0x4A87, 0x83EA, 0x2964, 0x5266, 0x5B08,
-    0x73AA, 0x73CA, 0x83CA, 0x4A66, 0x42C8, 0x3AA8, 0x5286, 0x5AE7,
-    0x73A9, 0x4AA7, 0x4AE8, 0x5287, 0x52C8, 0x6B69, 0x73CA, 0x3A68,
-    0x3A26, 0x7BA9, 0x4246, 0x3226, 0x21C5, 0x21A5, 0x2164, 0x6BAA,
-    0x3247, 0x4A87, 0x31E5, 0x31E5, 0x29A5, 0x31E5, 0x29A4, 0x4246,
-    0x6B69, 0x2184, 0x31C5, 0x29C5, 0x2184, 0x4267, 0x5B29, 0x1964,
-    0x6308, 0x4A46, 0x29C5, 0x31C5, 0x39E5, 0x31A4, 0x2984, 0x31C5,
-    0x4246, 0x10A1, 0x3A26, 0x6328, 0x52C7, 0x73A9, 0x6369, 0x7BEB,
-    0x3A67, 0x638A, 0x5B49, 0x5329, 0x4AE8, 0x5B28, 0x5B48, 0x840A,
-    0x73A9, 0x6369, 0x4AA8, 0x3A05, 0x6328, 0x3A66, 0x5B08, 0xACCC,
-    0x944B, 0x7BC9, 0x73A9, 0x7BC9, 0x9C6B, 0x5B08, 0x73A9, 0x8C4B,
-    0x8C2A, 0x6B08, 0x4AC8, 0x31E5, 0x6308, 0x8C0A, 0xACED, 0x4A46,
-    0x39E6, 0x2143, 0x83CA, 0x7B89, 0x4206, 0x940A, 0x4226, 0x29E6,
-    0x1964, 0x430A, 0x1143, 0x73AA, 0x6B69, 0x1923, 0x6349, 0x5AE8,
-    0x42A8, 0x31E5, 0x2A27, 0x3AA8, 0x5B08, 0x2143, 0x2985, 0x2984,
-    0x39C5, 0x1903, 0x3A27, 0x2185, 0x52C8, 0x842E, 0x29A6, 0xB638,
-    0xCF1C, 0xB67A, 0xD75D, 0xCF1D, 0x8CF2, 0xBE9B, 0xA5F8, 0x8D55,
-    0xCF1D, 0xCF3D, 0xCF3D, 0xCF3D, 0xD79F, 0xD79E, 0xD79F, 0xD7BF,
-    0xD79F, 0xD7BF, 0xE7FF, 0xE7FF, 0xE7DF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF, 0xDFBF,
-    0xDFBF, 0xDF9E, 0xDF9F, 0xDF9E, 0xDF9E, 0xDF9F, 0xDFBF, 0xC71D,
-    0xB69B, 0xBEDC, 0xBEDC, 0xB6BB, 0xBEDC, 0xBEDC, 0xB69B, 0xB6BB,
-    0xB6BC, 0xB69B, 0xAE9B, 0xB69C, 0xA61A, 0x9DD9, 0x9DF9, 0x9DF9,
-    0xA5F9, 0xA619, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5F9, 0x9DFA,
-    0x9DFA, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA61A, 0x9597, 0x21E8,
-    0x8D56, 0x9556, 0x5BAF, 0x4B2D, 0x742E, 0x21C5, 0x1104, 0x1104,
-    0x1104, 0x2186, 0x2A27, 0x3AE9, 0x3A88, 0x1945, 0x0882, 0x0000,
-    0x0020, 0x1904, 0x0841, 0x5287, 0x7B8A, 0x0881, 0x41E5, 0x62C7,
-    0x738A, 0x7BEA, 0x83EB, 0x31E5, 0x5B49, 0x6BAA, 0x8C2B, 0x42A8,
-    0x31C4, 0x9C6B, 0x6B28, 0x4A66, 0x6369, 0x946B, 0x5308, 0x738A,
-    0x7369, 0x2103, 0x4288, 0x29E5, 0x7C0A, 0x6328, 0x7BA9, 0x8C2B,
-    0x7BEA, 0x7389, 0x62E8, 0x5287, 0x42C8, 0x4AC8, 0x6308, 0x31C5,
-    0x6328, 0x5308, 0x4AC8, 0x7B89, 0x5287, 0x4226, 0x4A67, 0x3A06,
-    0x10E3, 0x5287, 0x4AA7, 0x52A7, 0x10E2, 0x3A06, 0x10A2, 0x634A,
-    0x3247, 0x3A05, 0x4A87, 0x29A5, 0x29A4, 0x29A5, 0x29A5, 0x31E5,
-    0x6329, 0x29A5, 0x29C5, 0x31C5, 0x29E5, 0x3A26, 0x4A87, 0x1964,
-    0x946C, 0x5AC7, 0x1964, 0x29A5, 0x31E5, 0x31C5, 0x31A4, 0x31C4,
-    0x6308, 0x2943, 0x4AA7, 0x5AE8, 0x52C6, 0x6B89, 0x42A7, 0x6369,
-    0x4288, 0x638A, 0x7BEA, 0x7C0A, 0x4288, 0x2164, 0x5B69, 0x842B,
-    0x6369, 0x6369, 0x1923, 0x2964, 0x7BCA, 0x4B09, 0x73EB, 0xA4CC,
-    0x6348, 0x7BCA, 0x73A9, 0xA4CC, 0x8C2A, 0x3205, 0x5B08, 0x7BEA,
-    0x6B48, 0x31A3, 0x5B49, 0x10C2, 0x4205, 0x4A46, 0x9C8C, 0x4A66,
-    0x2164, 0x2984, 0x7B8A, 0x3184, 0x6308, 0x7B69, 0x2185, 0x29E6,
-    0x1984, 0x42E9, 0x5B09, 0x4287, 0x2A67, 0x1964, 0x7C0B, 0x2184,
-    0x3247, 0x2164, 0x3206, 0x3205, 0x73CA, 0x29E6, 0x1964, 0x4226,
-    0x2943, 0x1103, 0x3206, 0x29E6, 0x52C8, 0x638C, 0x638E, 0x8D75,
-    0x6BEF, 0x9DD8, 0x9DF9, 0xA61A, 0x84D1, 0x95F9, 0x63EF, 0xA5D8,
-    0xA61A, 0xA5F9, 0xA5F9, 0xA619, 0xAE5A, 0xA61A, 0xBEDC, 0xCF5E,
-    0xCF5D, 0xCF5D, 0xB67B, 0xBEBB, 0xCF5D, 0xCF3D, 0xCF3D, 0xCF3D,
-    0xCF3D, 0xCF3D, 0xCF3D, 0xB6BB, 0xA619, 0xA5F9, 0xB69B, 0xCF5D,
-    0xD77E, 0xDFBF, 0xDFBF, 0xBEBC, 0xC71D, 0xDFBF, 0xDF9E, 0xDFBF,
-    0xDFBF, 0xCF5E, 0xCF3D, 0xD75D, 0xD75D, 0xC6FC, 0xBEDC, 0xA63A,
-    0xA63A, 0xAE5A, 0xAE7B, 0xB67B, 0xA61A, 0x9DF9, 0x9DF9, 0xA5F9,
-    0xA5F9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5FA, 0xA5FA,
-    0xA5FA, 0x9DFA, 0x9DFA, 0xA619, 0x9DF9, 0x9DF9, 0xA63A, 0x6C32,
-    0x9577, 0xAE5B, 0xA65A, 0xAE5B, 0x6C30, 0x42AA, 0x1944, 0x4ACB,
-    0x4ACB, 0x532C, 0x32A8, 0x42E9, 0x2A07, 0x2186, 0x0882, 0x10E3,
-    0x10C3, 0x18E4, 0x0882, 0x10C2, 0xA4AD, 0x31E5, 0x4246, 0x6AE8,
-    0x4A67, 0x5AE8, 0xA4ED, 0x29C5, 0x6B69, 0x6B48, 0x5308, 0x2A06,
-    0x5287, 0x9C6B, 0x4A46, 0x31E5, 0x29A4, 0x7BA9, 0x5308, 0x3227,
-    0x6B08, 0x4A46, 0x3247, 0x3A46, 0x7C0B, 0x7BEA, 0x944A, 0x8C0A,
-    0x6308, 0x840B, 0x31C5, 0x5287, 0x4AC8, 0x4AC8, 0x6B49, 0x10C2,
-    0x83EB, 0x5308, 0x5309, 0x8C2B, 0x3184, 0x4226, 0x52A7, 0x2984,
-    0x2185, 0x29E6, 0x31C5, 0x7BCA, 0x2984, 0x3A47, 0x2964, 0x73AA,
-    0x5349, 0x4267, 0x4A46, 0x2184, 0x29A5, 0x18E2, 0x2984, 0x3A26,
-    0x7BCA, 0x31A5, 0x31C5, 0x31E5, 0x3205, 0x3A26, 0x4267, 0x21C5,
-    0x5AE8, 0x4267, 0x21C5, 0x29E5, 0x31C5, 0x39E5, 0x31E5, 0x29A4,
-    0x6B49, 0x2984, 0x4247, 0x31A4, 0x4A87, 0x6308, 0x6369, 0x4287,
-    0x42A8, 0x52E9, 0x840A, 0x842A, 0x3A27, 0x1923, 0x5308, 0x8C4B,
-    0x7C0A, 0x4A87, 0x29A4, 0x4226, 0x7389, 0x3267, 0x6BCA, 0x7349,
-    0x4A46, 0x5308, 0x5B28, 0x8C2B, 0x5B08, 0x4AA7, 0x62E8, 0x7BAA,
-    0x6348, 0x7348, 0x39C5, 0x3247, 0x31A4, 0x7369, 0x83C9, 0x29C5,
-    0x3227, 0x29A4, 0x4247, 0x3A06, 0x6308, 0x3164, 0x3227, 0x2185,
-    0x4267, 0x73EB, 0x4A66, 0x2206, 0x3288, 0x21E6, 0x21E6, 0x21E6,
-    0x1965, 0x2102, 0x4AA8, 0x29C6, 0x2143, 0x1103, 0x21C6, 0x5309,
-    0x1923, 0x3A48, 0x1944, 0x29A5, 0x31C5, 0x2143, 0x4AC9, 0x4AE9,
-    0x8D35, 0xAE3B, 0xA63A, 0x84B4, 0x6BCE, 0x8535, 0x6C0F, 0xA63A,
-    0x9DF9, 0xA5F9, 0x9DFA, 0xA5F9, 0xA5F9, 0x9DD9, 0x9DD9, 0x9DD9,
-    0x9DF9, 0x9DF9, 0xA5F9, 0xA63A, 0xA639, 0xA63A, 0xAE3A, 0xA63A,
-    0xA61A, 0xAE5A, 0xC71D, 0xC71D, 0xC6FC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xD75E, 0xDFBF, 0xDF9E, 0xDFBF, 0xDF9F, 0xDFBF, 0xDFBF, 0xDF9E,
-    0xDF9E, 0xC71D, 0xC6FC, 0xC71D, 0xCF1D, 0xC6DC, 0xCF5D, 0xBEFC,
-    0xBEDC, 0xBEBC, 0xBEBC, 0xBEDC, 0xC6DC, 0xC6DC, 0xC6FC, 0xBEBB,
-    0xA61A, 0xA61A, 0xA63A, 0xA63A, 0xA61A, 0xA5F9, 0x9DFA, 0x9DFA,
-    0x9DFA, 0x9DFA, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA61A, 0x95D9,
-    0x7CD5, 0xA61A, 0x9DF9, 0x9DD9, 0xA61A, 0x84F5, 0x7C93, 0x7CD4,
-    0x6C32, 0x7431, 0x428A, 0x3A6A, 0x29A7, 0x42AA, 0x638E, 0x7C2D,
-    0x31E6, 0x1986, 0x3A69, 0x1103, 0x6329, 0x52C8, 0x2143, 0x6B29,
-    0x3A26, 0x39C5, 0x7BAA, 0x2144, 0x7BA9, 0x62E7, 0x42C8, 0x3A46,
-    0x6BAA, 0x73AA, 0x4A66, 0x5309, 0x3A06, 0x5266, 0x638A, 0x3247,
-    0x3184, 0x8C4B, 0x5B49, 0x42A7, 0x6B8A, 0x8C4B, 0x83EA, 0x942B,
-    0x62E8, 0x8C4B, 0x18E2, 0x4226, 0x7BCA, 0x52C8, 0x39E5, 0x18C2,
-    0x2123, 0x5B09, 0x6369, 0x6308, 0x5AE8, 0x3A47, 0x52E8, 0x736A,
-    0x3A47, 0x3AC8, 0x4AC7, 0x6B29, 0x1903, 0x2143, 0x31C5, 0x73CA,
-    0x5B28, 0x4246, 0x6B49, 0x29C5, 0x29E6, 0x29A4, 0x6329, 0x3A47,
-    0x8C2C, 0x31C5, 0x31E5, 0x31E5, 0x29C5, 0x52C7, 0x5AE8, 0x21A4,
-    0x2144, 0x636A, 0x21E6, 0x3227, 0x39E5, 0x31E5, 0x31A4, 0x2984,
-    0x3A26, 0x29C5, 0x3A47, 0x31C5, 0x4A67, 0x31C4, 0x7BEA, 0x52E8,
-    0x3A06, 0x2984, 0x8C6B, 0x73C9, 0x29E6, 0x31A4, 0x3A46, 0x5B08,
-    0x6B89, 0x4267, 0x4267, 0x29C5, 0x4A87, 0x42C8, 0x4AC8, 0x4246,
-    0x5AC7, 0x42A7, 0x42C8, 0x6B69, 0x52E8, 0x4226, 0x5287, 0x5AE8,
-    0x4A86, 0x942A, 0x2122, 0x3AA8, 0x2184, 0x4A67, 0x6B69, 0x29C5,
-    0x2185, 0x31E5, 0x3A67, 0x29E5, 0x4AA8, 0x10E2, 0x3268, 0x1103,
-    0x7BAA, 0x8C0A, 0x3A46, 0x2A26, 0x1943, 0x3AA8, 0x21C5, 0x2207,
-    0x10E3, 0x2143, 0x4AC8, 0x21E6, 0x1924, 0x21A5, 0x2A47, 0x3AA8,
-    0x1964, 0x29E6, 0x10E3, 0x4287, 0x5287, 0x31A5, 0x31C5, 0x742F,
-    0x9E1A, 0x95B9, 0xAE7B, 0x6C11, 0x7451, 0x7470, 0x8514, 0xA61A,
-    0x9DF9, 0x9DF9, 0x9DD8, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5F9, 0xA5F9,
-    0xA619, 0x9DF9, 0xAE3A, 0xAE5A, 0xC6DC, 0xC6FC, 0xC6FC, 0xC6FC,
-    0xC6FC, 0xC6FC, 0xCF1D, 0xCF3D, 0xDFDF, 0xE7FF, 0xE7FF, 0xE7DF,
-    0xDFDF, 0xDFBF, 0xE7BF, 0xDFBF, 0xDFBF, 0xDFBF, 0xD79E, 0xD79E,
-    0xD79E, 0xD77E, 0xCF3D, 0xCF5D, 0xCF3D, 0xDFBF, 0xE7DF, 0xDFDF,
-    0xE7FF, 0xCF3D, 0xC6FC, 0xC71D, 0xCF1D, 0xC71D, 0xC71C, 0xBEDC,
-    0xB69B, 0xBEFC, 0xC6FC, 0xC6FC, 0xB69B, 0xA61A, 0x9DFA, 0x9DFA,
-    0x9DFA, 0xA5FA, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA63A, 0x9598,
-    0x63F1, 0xA63A, 0x9DF9, 0x9DF9, 0x9DF9, 0xA63A, 0xA63A, 0xA63A,
-    0xA65A, 0xAE7B, 0xA5D9, 0x5B6F, 0x84D4, 0x9555, 0x4AAA, 0x4A87,
-    0x73AB, 0x2A07, 0x42C9, 0x5AE9, 0x08C2, 0x7BCA, 0x2143, 0x4206,
-    0x52C8, 0x2985, 0x52C8, 0x29A4, 0x4A87, 0x6B48, 0x4AA7, 0x2143,
-    0x4AC8, 0x4AE9, 0x738A, 0x3A46, 0x29C5, 0x10E2, 0x6B49, 0x4267,
-    0x4226, 0x6B69, 0x844C, 0x73EA, 0x7C0B, 0x6B8A, 0x5B08, 0x9CAC,
-    0x39A4, 0x6B69, 0x18E2, 0x2964, 0x5AC7, 0x52C8, 0x18C2, 0x6B49,
-    0x0881, 0x3A06, 0x840B, 0x4A86, 0x6329, 0x4287, 0x636A, 0x6328,
-    0x840B, 0x21E6, 0x6B89, 0x6B08, 0x1944, 0x2164, 0x2984, 0x4AC7,
-    0x3A05, 0x4AA8, 0x8C4C, 0x4267, 0x1944, 0x3A47, 0x5B08, 0x2184,
-    0x52E8, 0x31E5, 0x29C5, 0x29E5, 0x2184, 0x52A7, 0x62E8, 0x2984,
-    0x2944, 0x6B8A, 0x21E6, 0x29E5, 0x3A25, 0x31E5, 0x31C5, 0x31C5,
-    0x39E6, 0x29A5, 0x31C5, 0x39C5, 0x4A87, 0x31E5, 0x6BAA, 0x4A87,
-    0x31E6, 0x1103, 0x7C2B, 0x7BEA, 0x3247, 0x52A7, 0x3226, 0x52A7,
-    0x6B8A, 0x29C6, 0x4226, 0x5AC8, 0x4A66, 0x4AE8, 0x3AA8, 0x3205,
-    0x83C9, 0x3A26, 0x4309, 0x4AA7, 0x4A87, 0x2164, 0x73AA, 0x6B29,
-    0x31E5, 0x6B49, 0x1102, 0x42C8, 0x1924, 0x29A5, 0x6BAA, 0x3267,
-    0x1103, 0x42A8, 0x29A5, 0x29A5, 0x2164, 0x29E6, 0x2A07, 0x4226,
-    0x6B49, 0x4A66, 0x4267, 0x2A06, 0x1123, 0x5349, 0x42C8, 0x19C6,
-    0x0061, 0x3247, 0x1103, 0x2A06, 0x2A06, 0x10E3, 0x3A88, 0x1984,
-    0x1103, 0x10E3, 0x1144, 0x5B8B, 0x4A26, 0x2165, 0x4246, 0x9533,
-    0xC73D, 0xAE3A, 0xAE7B, 0x6C32, 0x846F, 0x744F, 0x8D76, 0xA61A,
-    0x9E19, 0x84D2, 0x7471, 0xA65B, 0xA61A, 0xA5F9, 0x9DF9, 0x9E19,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DD9, 0x9DF9,
-    0x9DF9, 0x9DD9, 0x9DF9, 0xBEBB, 0xCF3D, 0xCF5D, 0xCF5D, 0xCF3D,
-    0xCF3D, 0xCF5D, 0xCF3D, 0xAE5A, 0xA61A, 0xA63A, 0xB69B, 0xB69B,
-    0xB69B, 0xAE5A, 0xAE3A, 0xAE5A, 0xAE7B, 0xC6FD, 0xCF5E, 0xBEBC,
-    0xAE5A, 0xB69B, 0xB69B, 0xB67B, 0xBEBB, 0xD75E, 0xCF7E, 0xCF5E,
-    0xC6FC, 0xBEBC, 0xA619, 0x9DF9, 0x9DF9, 0xA5FA, 0x9DFA, 0x9DFA,
-    0x9DFA, 0x9E1A, 0x9DF9, 0x9DF9, 0x9E19, 0x9DF9, 0xAE7B, 0x7494,
-    0x3A8C, 0xAE5B, 0x9DF9, 0x9DF9, 0x9E19, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0x9DF9, 0xA63A, 0x9576, 0x9597, 0x9DB6, 0x5B8E, 0x4226,
-    0x52C8, 0x6B8A, 0x00A2, 0x6308, 0x52C8, 0x5B07, 0x6348, 0x4A87,
-    0x3A06, 0x1944, 0x83EB, 0x6308, 0x2984, 0x942B, 0x6328, 0x10C2,
-    0x4AA8, 0x3206, 0x6308, 0x29A4, 0x3A47, 0x2164, 0x6308, 0x3184,
-    0x3A06, 0x2964, 0x5AE8, 0x52C7, 0x6308, 0x7BEB, 0x5287, 0x8C2B,
-    0x5AE7, 0x6329, 0x1903, 0x4A67, 0x31E5, 0x6B69, 0x4226, 0x7BA9,
-    0x29A5, 0x4287, 0x4AA7, 0x4AA7, 0x52C8, 0x2164, 0x6308, 0x52C7,
-    0x83CA, 0x0040, 0x5308, 0x6B08, 0x6308, 0x3A26, 0x73A9, 0x52A7,
-    0x29C5, 0x3A26, 0x7BC9, 0x6B28, 0x10C2, 0x4AE9, 0x6309, 0x29A5,
-    0x52C7, 0x5B08, 0x29C5, 0x31E5, 0x2184, 0x4A66, 0x5287, 0x2984,
-    0x2964, 0x6B6A, 0x3206, 0x21A5, 0x3206, 0x29C5, 0x31C4, 0x31C5,
-    0x1081, 0x2123, 0x3A06, 0x2964, 0x3A26, 0x0881, 0x4287, 0x31A5,
-    0x31C5, 0x10E3, 0x6349, 0x73AA, 0x3247, 0x52C7, 0x3A26, 0x10C2,
-    0x29A5, 0x3227, 0x4226, 0x2123, 0x31A4, 0x4B09, 0x1984, 0x5AE8,
-    0x4A26, 0x29E5, 0x3AA8, 0x73AA, 0x4A87, 0x21E6, 0x5B49, 0x2964,
-    0x1965, 0x10E3, 0x10E2, 0x29A5, 0x10E3, 0x3A26, 0x6349, 0x2A27,
-    0x2184, 0x4267, 0x18E2, 0x3A47, 0x0861, 0x1103, 0x21A5, 0x5267,
-    0x2964, 0x4287, 0x10E2, 0x2A06, 0x21C5, 0x4309, 0x3AE9, 0x21A5,
-    0x1923, 0x3288, 0x1924, 0x2A27, 0x2185, 0x08A2, 0x3A88, 0x10E3,
-    0x21C6, 0x0041, 0x1985, 0x2A07, 0x10A2, 0x1123, 0x3A46, 0x7C91,
-    0x9DD8, 0xB69A, 0xAE7B, 0x7452, 0x5B2D, 0x6C11, 0xA63A, 0x9DF9,
-    0x9597, 0x5B6C, 0x9596, 0x7C90, 0x744F, 0x95B7, 0xA61A, 0x9DF9,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9E19, 0x9E19, 0x9DF9, 0x9DF9, 0xA619,
-    0xA619, 0xA619, 0xA619, 0xA619, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5F9,
-    0x9DF9, 0x9DF9, 0xA61A, 0xBEDC, 0xC6FC, 0xC71D, 0xD79E, 0xD79E,
-    0xD79E, 0xD79E, 0xDF9E, 0xBEBB, 0xAE3A, 0x9DD9, 0x95D9, 0x95D9,
-    0x9DD9, 0x9DD9, 0x9DD9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA5FA, 0xA5FA, 0xA5FA,
-    0x9DFA, 0x9DFA, 0x9DF9, 0x9DF9, 0x9DF9, 0xA61A, 0x9597, 0x3A6B,
-    0x7CD5, 0xA63A, 0x9DF9, 0xA5FA, 0xA619, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0xA5F9, 0xA619, 0x9DD8, 0x6C30, 0x8D34, 0x6CB4, 0x638B,
-    0x6369, 0x8C6D, 0x4AA8, 0x5AE8, 0x7BCA, 0x52A6, 0x9CCD, 0x3206,
-    0x73CB, 0x08A1, 0x62C7, 0x6308, 0x0881, 0x840B, 0x7BAA, 0x2984,
-    0x6BAA, 0x29A4, 0x6B29, 0x2143, 0x29C5, 0x10E2, 0x5AA7, 0x31C6,
-    0x10C2, 0x10A2, 0x31A4, 0x73AA, 0x2163, 0x5AE8, 0x7389, 0x4A66,
-    0x6369, 0x6349, 0x1923, 0x52A7, 0x29A4, 0x6B69, 0x1102, 0x6308,
-    0x29C5, 0x3AC8, 0x3A26, 0x73AA, 0x840B, 0x2102, 0x5287, 0x5B08,
-    0x83CA, 0x0020, 0x42A7, 0x8C2A, 0x7348, 0x3A05, 0x7389, 0x7348,
-    0x31E5, 0x6B69, 0x8C2A, 0x62E7, 0x2964, 0x3A87, 0x636A, 0x31E5,
-    0x8C2B, 0x9C6B, 0x29A4, 0x3206, 0x2184, 0x5287, 0x6308, 0x1923,
-    0x4206, 0x7BCA, 0x3A67, 0x1964, 0x4287, 0x3A05, 0x31C4, 0x31A4,
-    0x10A2, 0x2964, 0x4226, 0x2123, 0x4247, 0x1923, 0x5309, 0x2164,
-    0x10E3, 0x29C6, 0x52C8, 0x5308, 0x3A88, 0x5AE8, 0x2964, 0x1903,
-    0x2144, 0x52E9, 0x4AA7, 0x2964, 0x5AC8, 0x3206, 0x4247, 0x2123,
-    0x1103, 0x3268, 0x2A67, 0x6349, 0x39C5, 0x1185, 0x3288, 0x1923,
-    0x1965, 0x10E3, 0x2164, 0x1923, 0x3288, 0x4B09, 0x31E5, 0x1985,
-    0x3267, 0x1123, 0x3163, 0x6B69, 0x0020, 0x1924, 0x29A5, 0x1903,
-    0x18C2, 0x3A26, 0x10E3, 0x29E6, 0x1123, 0x3AA9, 0x21C6, 0x08A2,
-    0x2185, 0x1123, 0x08A2, 0x2185, 0x1103, 0x0882, 0x1924, 0x1103,
-    0x0861, 0x0000, 0x08A2, 0x0041, 0x0000, 0x3248, 0x7CB2, 0x8515,
-    0x8536, 0x95B8, 0xA63A, 0x7452, 0x4ACC, 0x6C11, 0xAE5A, 0xA5F9,
-    0x7CD3, 0x6C72, 0x7CB2, 0x7CB2, 0x9596, 0x9DF9, 0xA619, 0x9E19,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DD9, 0x9DF9,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9E19, 0xA61A, 0xA61A,
-    0xA61A, 0xA619, 0xA61A, 0xAE5A, 0xAE5A, 0xA65A, 0xA63A, 0xA63A,
-    0xA63A, 0xA63A, 0xBEBB, 0xB69B, 0xAE7B, 0xB69B, 0xB6BB, 0xBEBB,
-    0xBEBB, 0xBEBB, 0xBEBB, 0xA61A, 0xA61A, 0x9E19, 0x9E19, 0x9E19,
-    0xA5F9, 0x9E19, 0xA619, 0xA619, 0xA619, 0xA619, 0xA5FA, 0xA619,
-    0xA61A, 0x9E1A, 0x9DFA, 0x9E19, 0x9DF9, 0xAE5B, 0x7473, 0x5B8F,
-    0xAE9C, 0x9DF9, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0xA61A, 0xA63A, 0x9DD8, 0x8D55, 0x8512, 0x7CF4, 0xA5B5,
-    0x7C0B, 0x4246, 0x73AA, 0x31C5, 0x62E8, 0x5B28, 0x840B, 0x4287,
-    0x4AC8, 0x10E3, 0x4246, 0x842B, 0x3267, 0x6B69, 0x6B49, 0x3184,
-    0x6BCB, 0x4AA7, 0x8C2B, 0x29E5, 0x21C5, 0x10E2, 0x736A, 0x2103,
-    0x29A5, 0x0041, 0x1923, 0x4AA8, 0x1923, 0x3185, 0x4A46, 0x31E5,
-    0x5308, 0x6369, 0x5AE8, 0x5AC7, 0x4287, 0x4B09, 0x1964, 0x5AE8,
-    0x2164, 0x3A88, 0x3206, 0x6BAA, 0x7C0B, 0x2102, 0x4226, 0x39E5,
-    0x5AC7, 0x3184, 0x3A46, 0x946B, 0x6307, 0x4246, 0x4287, 0x6308,
-    0x3A05, 0x6349, 0x9CAC, 0x62E7, 0x41E4, 0x6369, 0x3247, 0x3A06,
-    0x7BA9, 0x9C6B, 0x2143, 0x6B8A, 0x29A4, 0x3A06, 0x73AA, 0x4246,
-    0x4246, 0x5B29, 0x3A67, 0x29C5, 0x6349, 0x6B49, 0x29A4, 0x2164,
-    0x2103, 0x2964, 0x4205, 0x3184, 0x52A7, 0x2184, 0x6BAA, 0x4A87,
-    0x2984, 0x1944, 0x73AA, 0x52E8, 0x52E8, 0x52E8, 0x3A46, 0x4247,
-    0x62E8, 0x4AA7, 0x52A8, 0x1903, 0x3206, 0x08C2, 0x3206, 0x0020,
-    0x1964, 0x2A06, 0x3268, 0x4AA7, 0x3A06, 0x21C6, 0x3A88, 0x21A5,
-    0x2A27, 0x3A87, 0x2144, 0x3A26, 0x21C5, 0x3A47, 0x3227, 0x1144,
-    0x2A27, 0x2185, 0x4A06, 0x3A06, 0x1964, 0x08A2, 0x3A26, 0x18C2,
-    0x2123, 0x21A5, 0x1103, 0x10C2, 0x3227, 0x1985, 0x1964, 0x1103,
-    0x10E3, 0x0061, 0x08C2, 0x1965, 0x1103, 0x10E3, 0x10E3, 0x1944,
-    0x0020, 0x0000, 0x0000, 0x0040, 0x21C7, 0x5BF0, 0x9597, 0xA639,
-    0x9E19, 0x9DD9, 0xA65B, 0x6C31, 0x4AAB, 0x6BD0, 0xAE3A, 0xAE5A,
-    0x63CF, 0x6C31, 0xAE9C, 0xA61A, 0xA61A, 0x9E19, 0x9DF9, 0x9E19,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA63A, 0xB69B, 0xA63A,
-    0x9DF9, 0x9E19, 0x9DF9, 0x9DF9, 0x9DF9, 0x9E19, 0xA61A, 0xA5FA,
-    0xA619, 0xA619, 0x9E19, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DFA, 0x9E1A,
-    0x9DF9, 0xA619, 0xAE5B, 0xB69B, 0xB67B, 0xB67B, 0xB67B, 0xB67B,
-    0xB69B, 0xB69B, 0xB67B, 0xA61A, 0x9E19, 0x9E19, 0xA619, 0xA619,
-    0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619,
-    0xA61A, 0xA61A, 0x9DF9, 0x9DF9, 0x9DF9, 0xA65A, 0x7CD5, 0x2A09,
-    0x9DD8, 0xA61A, 0x9DFA, 0x9DFA, 0x9DFA, 0xA5FA, 0x9DF9, 0x9DF9,
-    0xA61A, 0x9577, 0x8D35, 0xA63B, 0x95B7, 0x8D10, 0x6C0E, 0xADD6,
-    0xA510, 0x4267, 0x29C5, 0x2164, 0x2984, 0x52C8, 0x6B49, 0x2144,
-    0x42C9, 0x2A26, 0x2184, 0x840A, 0x4B29, 0x2A06, 0x5B08, 0x2143,
-    0x5B6A, 0x2184, 0x6349, 0x4309, 0x21E6, 0x2985, 0x946D, 0x1081,
-    0x3226, 0x0881, 0x21A5, 0x4AE9, 0x2164, 0x5329, 0x42A7, 0x1943,
-    0x3267, 0x3206, 0x6328, 0x4AC7, 0x5B8A, 0x3A67, 0x3226, 0x7369,
-    0x1924, 0x3AA9, 0x29C5, 0x4AA8, 0x4266, 0x18E2, 0x1922, 0x6B69,
-    0x39E5, 0x4A67, 0x29C4, 0x7BA9, 0x7BC9, 0x52A7, 0x10E2, 0x7BCA,
-    0x52E7, 0x42A7, 0x8C4B, 0x62C7, 0x3143, 0x6BAA, 0x19A5, 0x7389,
-    0x6B49, 0x5B08, 0x3267, 0x73AA, 0x31C5, 0x31E6, 0x31E5, 0x6349,
-    0x5B08, 0x52C7, 0x4A66, 0x5B49, 0x3246, 0x6B8A, 0x5287, 0x2164,
-    0x0000, 0x0861, 0x31A4, 0x5266, 0x4A46, 0x3184, 0x6349, 0x31E5,
-    0x3A26, 0x1923, 0x73CA, 0x4AC8, 0x6349, 0x4A88, 0x4AA8, 0x83EA,
-    0x7BCA, 0x29E5, 0x3A47, 0x0061, 0x1985, 0x4288, 0x3A47, 0x1985,
-    0x1924, 0x21C6, 0x21E6, 0x31A4, 0x3226, 0x2A06, 0x3247, 0x3288,
-    0x2185, 0x31E6, 0x1903, 0x29A5, 0x1944, 0x2185, 0x1123, 0x21C5,
-    0x21C6, 0x18E3, 0x2984, 0x1103, 0x2A06, 0x10C2, 0x3A26, 0x0020,
-    0x0020, 0x1944, 0x1103, 0x0000, 0x29E6, 0x0861, 0x2185, 0x0041,
-    0x0040, 0x0061, 0x1965, 0x1985, 0x0061, 0x29E6, 0x0040, 0x0000,
-    0x0000, 0x0841, 0x10C3, 0x0061, 0x1986, 0x2A08, 0x1944, 0x5B4A,
-    0x9596, 0x8D77, 0x5BCE, 0x21C6, 0x4B0B, 0x4288, 0x534C, 0x9DD8,
-    0x9DB8, 0x63D0, 0x9DD9, 0xA61A, 0x9DF9, 0x9E19, 0x9E19, 0x9DF9,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9E19, 0x9DF9, 0xAE5A, 0xBEDC, 0xAE7B,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5FA, 0x9E19,
-    0xA619, 0xA619, 0xA619, 0x9E19, 0xA619, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9E19, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA619, 0x9DFA, 0x9DF9, 0x9DF9, 0xA63A, 0x84F5, 0x21C8,
-    0x9DB8, 0xA61A, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DF9,
-    0xA61A, 0x9576, 0x7430, 0x6C31, 0x9DD8, 0x848E, 0x5B4A, 0x846E,
-    0xCE56, 0xAD72, 0x4287, 0x1985, 0x3A67, 0x31E6, 0x3A06, 0x29A5,
-    0x3206, 0x4329, 0x08E2, 0x31C4, 0x6369, 0x4267, 0x6308, 0x2123,
-    0x42A8, 0x29E5, 0x3A26, 0x10E3, 0x3268, 0x10A2, 0x6B49, 0x18E2,
-    0x3267, 0x1984, 0x0882, 0x5B49, 0x4A66, 0x5309, 0x63AB, 0x3206,
-    0x3A87, 0x3246, 0x3A46, 0x3AA8, 0x4B09, 0x31C5, 0x3A88, 0x6349,
-    0x2185, 0x2A06, 0x2184, 0x1944, 0x4267, 0x2143, 0x1923, 0x6349,
-    0x4A86, 0x2984, 0x0861, 0x6308, 0x5AE7, 0x4226, 0x18C2, 0x7BCA,
-    0x6328, 0x3A67, 0x6369, 0x5A87, 0x3163, 0x62E7, 0x0041, 0x7389,
-    0x7BCA, 0x7BEB, 0x4B09, 0x3A26, 0x1964, 0x636A, 0x4A67, 0x4A66,
-    0x6328, 0x4266, 0x5AA7, 0x840B, 0x1164, 0x636A, 0x52C8, 0x2984,
-    0x0841, 0x10E3, 0x18C2, 0x4A46, 0x2943, 0x2963, 0x6369, 0x29A4,
-    0x2985, 0x4A87, 0x6328, 0x6329, 0x4AA8, 0x4287, 0x7BEA, 0x948C,
-    0x4288, 0x21E6, 0x2185, 0x2164, 0x738A, 0x5AE8, 0x29A5, 0x10E3,
-    0x10E3, 0x21A6, 0x1985, 0x1943, 0x5329, 0x2184, 0x2A47, 0x2184,
-    0x2164, 0x1944, 0x2165, 0x10E3, 0x08A2, 0x1964, 0x08C2, 0x21E6,
-    0x21C5, 0x1944, 0x1923, 0x21A5, 0x31E6, 0x29C6, 0x1903, 0x0000,
-    0x10E3, 0x2164, 0x10A2, 0x0881, 0x2185, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0020, 0x0061, 0x0040, 0x0020, 0x08A2, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x1925, 0x10A2, 0x0861, 0x1945, 0x3A8B, 0x5B6D,
-    0x5BD0, 0x7D15, 0x8535, 0x5BD0, 0x6432, 0x6C73, 0x9577, 0xA5F9,
-    0xAE5A, 0x9DB8, 0x6C32, 0x8536, 0xA63A, 0x9DF9, 0x9DF9, 0x9DF9,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DD9, 0x9DF9,
-    0xA619, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DFA, 0x9DFA, 0x9DFA, 0x9E19,
-    0x9E19, 0x9E19, 0xA619, 0x9E19, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA619, 0xA619, 0xA61A, 0xA619, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0xA61A, 0x9E1A, 0x9E1A, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA619, 0xA619, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0x9E1A, 0x9DFA, 0x9DF9, 0xA65A, 0x7CB4, 0x4B2E,
-    0xA63A, 0x9DFA, 0xA5FA, 0x9DFA, 0xA5FA, 0xA5FA, 0x9DF9, 0x9DF9,
-    0x9DF9, 0xA63A, 0x9597, 0x52EA, 0xAE39, 0x9D74, 0x6BAB, 0x6B69,
-    0xC636, 0xAD51, 0x3A05, 0x428A, 0x3A48, 0x19A5, 0x2A06, 0x3A47,
-    0x1923, 0x3AE9, 0x08C2, 0x2164, 0x3A26, 0x0020, 0x2103, 0x2985,
-    0x4287, 0x29A4, 0x31C5, 0x0041, 0x3247, 0x0020, 0x5AA7, 0x2122,
-    0x3268, 0x1964, 0x0000, 0x52E8, 0x4A66, 0x1124, 0x3226, 0x1944,
-    0x3A67, 0x4B29, 0x4AC8, 0x21A5, 0x4AC8, 0x2984, 0x1944, 0x5B09,
-    0x1964, 0x0000, 0x2185, 0x29C6, 0x2144, 0x08A2, 0x2A06, 0x1943,
-    0x4AC8, 0x4A67, 0x4A67, 0x6308, 0x4246, 0x4A46, 0x2943, 0x4267,
-    0x7389, 0x4AA7, 0x5309, 0x5267, 0x2922, 0x83C9, 0x18A2, 0x5B08,
-    0x73AA, 0x6328, 0x5B09, 0x6B69, 0x1923, 0x63AA, 0x4A46, 0x39A4,
-    0x5AA7, 0x2943, 0x62C7, 0x842B, 0x21C5, 0x6329, 0x42A8, 0x29C5,
-    0x10A2, 0x10C2, 0x18C2, 0x62E8, 0x2103, 0x29A4, 0x5B49, 0x3A26,
-    0x18C2, 0x4A67, 0x73CA, 0x6349, 0x52E8, 0x738A, 0x8C4B, 0x5B29,
-    0x2185, 0x1104, 0x0881, 0x7BCB, 0x31C4, 0x2185, 0x0061, 0x0040,
-    0x6B6A, 0x29C5, 0x1985, 0x2984, 0x73EB, 0x1985, 0x32A8, 0x0881,
-    0x1103, 0x1103, 0x1944, 0x0881, 0x1103, 0x08C3, 0x1965, 0x1144,
-    0x2164, 0x2185, 0x08A2, 0x21A5, 0x0840, 0x2185, 0x0882, 0x0000,
-    0x08A2, 0x2184, 0x18E2, 0x0861, 0x0881, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1945, 0x2186, 0x29E8,
-    0x1904, 0x1904, 0x0882, 0x1905, 0x1925, 0x63F1, 0x9577, 0xAE5B,
-    0xA61A, 0x9DF9, 0xA65B, 0x6C32, 0x4B0D, 0x6412, 0x8D57, 0xA63A,
-    0x9DF9, 0xA63A, 0x9DF9, 0x9597, 0xA61A, 0x9DF9, 0x9DF9, 0x9DFA,
-    0x9DFA, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5FA, 0xA5FA,
-    0xA5FA, 0xA5FA, 0xA5FA, 0xA5FA, 0xA5FA, 0xA619, 0xA619, 0x9E19,
-    0xA619, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0x9E1A, 0x9E1A, 0x9E1A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA619, 0xA5FA, 0x9DFA, 0x9DF9, 0xA61A, 0x95B8, 0x9598,
-    0xA61A, 0x9DF9, 0x9DFA, 0x9DFA, 0x9DFA, 0xA5FA, 0x9DF9, 0x9DF9,
-    0x9DF9, 0x9DF9, 0xA619, 0x84F4, 0x7CB3, 0xB659, 0x6BAB, 0x3A46,
-    0xB593, 0xAD31, 0x0860, 0x4ACA, 0x4289, 0x1103, 0x3226, 0x3A26,
-    0x10E3, 0x3247, 0x1123, 0x21A5, 0x29C5, 0x2123, 0x10C2, 0x29C5,
-    0x2185, 0x1923, 0x1924, 0x2185, 0x2A27, 0x0082, 0x4A06, 0x2943,
-    0x1103, 0x2A27, 0x0861, 0x2123, 0x3A26, 0x1944, 0x3267, 0x2164,
-    0x1103, 0x4288, 0x31E5, 0x0061, 0x29E6, 0x2964, 0x10E2, 0x3206,
-    0x2185, 0x1944, 0x1944, 0x2185, 0x0021, 0x18E2, 0x1923, 0x10E3,
-    0x1964, 0x6349, 0x7BAA, 0x5AC7, 0x3A05, 0x5B09, 0x7BAA, 0x3A47,
-    0x52C7, 0x73AA, 0x3A05, 0x2143, 0x10A1, 0x7B89, 0x2923, 0x4A67,
-    0x83EB, 0x39E5, 0x52A7, 0x7389, 0x31A4, 0x948D, 0x4226, 0x41E5,
-    0x8BEA, 0x0020, 0x62C7, 0x8C6C, 0x4B29, 0x6B6A, 0x5309, 0x2164,
-    0x0000, 0x4A27, 0x18A2, 0x7349, 0x10A1, 0x4225, 0x5B6A, 0x29A5,
-    0x3184, 0x83EA, 0x7BCA, 0x52E8, 0x840B, 0x6308, 0x738A, 0x5309,
-    0x29C6, 0x0882, 0x6B49, 0x4A87, 0x0000, 0x0020, 0x2144, 0x83EB,
-    0x8C6C, 0x1923, 0x08A2, 0x2164, 0x4288, 0x1164, 0x3288, 0x10C2,
-    0x2185, 0x1903, 0x10C2, 0x0041, 0x1965, 0x1124, 0x0882, 0x1965,
-    0x0000, 0x1103, 0x10E3, 0x29E6, 0x1923, 0x10A2, 0x0041, 0x0000,
-    0x10C2, 0x0881, 0x0000, 0x0000, 0x0000, 0x0841, 0x0021, 0x0041,
-    0x0021, 0x10A2, 0x1945, 0x08A2, 0x0061, 0x08C3, 0x1925, 0x10C3,
-    0x1925, 0x1904, 0x2166, 0x3229, 0x3A4A, 0x6C32, 0x7452, 0xA5F9,
-    0x9DD9, 0x9DF9, 0x9DF9, 0x9598, 0x42CC, 0x538F, 0x534E, 0xAE5B,
-    0x9DF9, 0xA619, 0xA61A, 0xA63A, 0xA619, 0x9DFA, 0x9DFA, 0x9DFA,
-    0x9DFA, 0x9DFA, 0x9DFA, 0x9DF9, 0x9DFA, 0x9DFA, 0x9DFA, 0xA5FA,
-    0xA619, 0xA5FA, 0xA619, 0xA619, 0xA619, 0xA619, 0x9E1A, 0xA61A,
-    0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA61A, 0xA619, 0xA619,
-    0x9E1A, 0xA5FA, 0xA61A, 0x9E19, 0x9E19, 0x9DF9, 0xA61A, 0xA61A,
-    0x9DF9, 0x9DF9, 0x9DF9, 0x9DFA, 0x9DFA, 0x9DF9, 0x9E19, 0x9E19,
-    0x9E19, 0x9E19, 0xA61A, 0x9DB8, 0x63CE, 0xADF8, 0x744F, 0x21E5,
-    0x6309, 0xB590, 0x4267, 0x29A6, 0x638D, 0x10A2, 0x21A5, 0x29C5,
-    0x10E2, 0x21E6, 0x08A2, 0x21A5, 0x31C5, 0x2964, 0x10C2, 0x29C5,
-    0x2185, 0x2144, 0x10C3, 0x1944, 0x2A07, 0x0082, 0x18A2, 0x5A67,
-    0x0061, 0x2A07, 0x0041, 0x1102, 0x3A26, 0x1903, 0x29A5, 0x2144,
-    0x1924, 0x2984, 0x2984, 0x0062, 0x3226, 0x2964, 0x0861, 0x29A5,
-    0x1944, 0x10C2, 0x1965, 0x31C5, 0x1902, 0x52C8, 0x10C2, 0x2164,
-    0x21C6, 0x73CA, 0xA4CC, 0x5308, 0x3206, 0x29A4, 0x6B48, 0x42A7,
-    0x3A05, 0x7BCA, 0x6308, 0x5287, 0x39E5, 0x83EA, 0x62E7, 0x0861,
-    0x2943, 0x4A26, 0x6308, 0x6B69, 0x29A4, 0x842B, 0x4225, 0x2123,
-    0x7B89, 0x0841, 0x5A87, 0x7C0B, 0x4B29, 0x4287, 0x52A7, 0x31C5,
-    0x0000, 0x5267, 0x1081, 0x83EB, 0x2122, 0x7369, 0x6BCB, 0x10C2,
-    0x6B49, 0x7389, 0x7BCA, 0x7BAA, 0x6349, 0x5B09, 0x5B08, 0x4267,
-    0x2185, 0x4246, 0x3A47, 0x1103, 0x0000, 0x0881, 0x736A, 0x6B49,
-    0x2A06, 0x0020, 0x0000, 0x1124, 0x2206, 0x1964, 0x3288, 0x1103,
-    0x1103, 0x0881, 0x0041, 0x0040, 0x1964, 0x1104, 0x0882, 0x1965,
-    0x0000, 0x0861, 0x1923, 0x29E6, 0x29A5, 0x0040, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1925, 0x1904, 0x1945,
-    0x1945, 0x1945, 0x3A8A, 0x21C7, 0x29C8, 0x0062, 0x21C8, 0x1966,
-    0x0061, 0x0021, 0x1925, 0x2187, 0x1904, 0x4AED, 0x63F1, 0x7CB4,
-    0xB67B, 0xA61A, 0x9DF9, 0x9DD9, 0x532E, 0x7CB4, 0x63D0, 0xAE5A,
-    0x9DF9, 0xA61A, 0x9E19, 0xA619, 0xA619, 0x9E1A, 0x9E1A, 0x9E1A,
-    0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9E1A,
-    0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0x9E1A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0x9E19,
-    0xA61A, 0x9DFA, 0x9DFA, 0x9DF9, 0xA5F9, 0xA5F9, 0x9DF9, 0x9DF9,
-    0xA619, 0xA5F9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9E19, 0xA619, 0xA5F9,
-    0x9DF9, 0xA619, 0x9DF9, 0xA65B, 0x6C30, 0x9534, 0x740E, 0x3246,
-    0x5AE8, 0xAD50, 0x31C5, 0x10E3, 0x7CB2, 0x52C8, 0x29A5, 0x3A47,
-    0x1103, 0x1124, 0x0020, 0x10C2, 0x2964, 0x2964, 0x0041, 0x1943,
-    0x21A5, 0x2164, 0x0841, 0x1903, 0x2164, 0x1103, 0x18C2, 0x5A87,
-    0x0040, 0x29C6, 0x0881, 0x1943, 0x42A8, 0x18E3, 0x10A2, 0x2185,
-    0x29E6, 0x31E6, 0x2143, 0x0000, 0x3A68, 0x29A4, 0x0000, 0x1103,
-    0x21A5, 0x1103, 0x21A5, 0x29A5, 0x5B08, 0x738A, 0x52A7, 0x18E3,
-    0x2A06, 0x42C8, 0x8C4B, 0x7BEA, 0x3206, 0x0881, 0x62C7, 0x3A26,
-    0x3A46, 0x73A9, 0x9CAC, 0x7389, 0x31A4, 0x7389, 0x7369, 0x0020,
-    0x0041, 0x4A26, 0x6308, 0x73CA, 0x2984, 0x8C0A, 0x6369, 0x08E3,
-    0x5AE7, 0x1984, 0x3164, 0x5308, 0x5B6A, 0x3206, 0x2144, 0x4267,
-    0x0000, 0x31A5, 0x10A1, 0x7BAA, 0x2123, 0x6B49, 0x31C5, 0x0000,
-    0x6B29, 0x3A05, 0x7BAA, 0x840A, 0x5B28, 0x6329, 0x39C5, 0x3A27,
-    0x3A27, 0x4AC8, 0x1964, 0x1985, 0x0000, 0x7B8A, 0x39C5, 0x1103,
-    0x1944, 0x0000, 0x0000, 0x2144, 0x2185, 0x21A5, 0x21C6, 0x08A1,
-    0x21A5, 0x0020, 0x0000, 0x0041, 0x1965, 0x1104, 0x0861, 0x10E3,
-    0x0000, 0x0861, 0x10E3, 0x21A5, 0x0040, 0x0020, 0x18E3, 0x1903,
-    0x10C2, 0x10C2, 0x10C2, 0x10C2, 0x0020, 0x0061, 0x18E4, 0x10A3,
-    0x0882, 0x10A3, 0x1946, 0x2A08, 0x1904, 0x0882, 0x21A7, 0x29E8,
-    0x1925, 0x1925, 0x2166, 0x2186, 0x10C3, 0x5B6F, 0x9DD9, 0x536F,
-    0x6C11, 0x9577, 0xA61A, 0xA5F9, 0x42CC, 0x9DD8, 0x6C73, 0x9577,
-    0xA63A, 0x9DF9, 0xA619, 0xA619, 0xA619, 0x9E1A, 0x9E1A, 0x9DFA,
-    0x9E1A, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0xA5FA, 0x9DFA,
-    0x9E1A, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0x9E1A, 0xA619,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0x9E19,
-    0x9DFA, 0x9DFA, 0xA61A, 0xA61A, 0xA63A, 0xA61A, 0xA619, 0xA619,
-    0xA5F9, 0xA61A, 0xA63A, 0xA63A, 0x9E1A, 0xA61A, 0xA61A, 0x84B2,
-    0x7C70, 0x7C90, 0x7C70, 0x9DB8, 0x9576, 0x6BEF, 0x63EF, 0x31E6,
-    0x3206, 0x7C0D, 0x31E5, 0x29E7, 0x74B1, 0x5B09, 0x2184, 0x42A8,
-    0x08C2, 0x0000, 0x0020, 0x0000, 0x0000, 0x0040, 0x0000, 0x08A2,
-    0x2185, 0x1923, 0x0041, 0x0040, 0x1943, 0x29C5, 0x20E2, 0x5AA7,
-    0x0020, 0x3206, 0x3227, 0x10C2, 0x3226, 0x10C2, 0x0000, 0x1924,
-    0x21A5, 0x31C5, 0x2123, 0x0020, 0x2185, 0x29A5, 0x0041, 0x2184,
-    0x21A5, 0x42A8, 0x3AA8, 0x1124, 0x21C6, 0x8C4C, 0x7369, 0x31A5,
-    0x29A5, 0x3267, 0x73CA, 0x7349, 0x4AA8, 0x0881, 0x5266, 0x1903,
-    0x1944, 0x5B08, 0x9C8C, 0x5AE8, 0x736A, 0x4267, 0x5A87, 0x0861,
-    0x2143, 0x7369, 0x942A, 0x83CA, 0x2143, 0x7348, 0x4AC7, 0x1103,
-    0x6B08, 0x3205, 0x0841, 0x4AC8, 0x63AA, 0x4247, 0x3A06, 0x42A7,
-    0x0000, 0x18E3, 0x4247, 0x7389, 0x31A4, 0x7BCA, 0x4287, 0x0000,
-    0x52A7, 0x7369, 0x840B, 0x73AA, 0x5B29, 0x6309, 0x10A2, 0x10A2,
-    0x5288, 0x29C6, 0x3247, 0x3A46, 0x52A7, 0x5AC8, 0x0000, 0x0881,
-    0x0040, 0x0000, 0x20E2, 0x5287, 0x0040, 0x1964, 0x1923, 0x2184,
-    0x1924, 0x0000, 0x0000, 0x0861, 0x1965, 0x1924, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x10C2, 0x1985, 0x2185, 0x0881, 0x2123, 0x2964,
-    0x1924, 0x2185, 0x3288, 0x3268, 0x21C5, 0x2185, 0x1985, 0x1945,
-    0x2166, 0x2186, 0x2187, 0x21A7, 0x1925, 0x2146, 0x21A7, 0x21E8,
-    0x2187, 0x21C8, 0x29E9, 0x2187, 0x4AED, 0x42CC, 0x8536, 0xA63A,
-    0x6BF1, 0x8D36, 0xA63A, 0xAE3A, 0x6C53, 0x74B4, 0x9DD8, 0x6C73,
-    0xA61A, 0x9E19, 0xA619, 0xA619, 0xA619, 0xA619, 0xA5FA, 0xA619,
-    0x9E1A, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9E1A, 0x9E1A,
-    0x9E1A, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA5F9,
-    0x9DFA, 0xA61A, 0x95B8, 0x7D16, 0x8516, 0x9DD9, 0xA61A, 0xA619,
-    0xA619, 0x8556, 0x74F5, 0x6432, 0x9597, 0x9597, 0x9DB7, 0xA619,
-    0xA5F8, 0xA619, 0xAE5A, 0xA61A, 0x9DB7, 0x5B4C, 0x84F4, 0x1124,
-    0x1944, 0x31A5, 0x1943, 0x2A06, 0x7C6F, 0x3A47, 0x0000, 0x0061,
-    0x08C3, 0x0882, 0x0000, 0x0020, 0x0021, 0x0000, 0x0041, 0x0041,
-    0x0020, 0x0000, 0x0861, 0x0861, 0x1923, 0x2124, 0x20E2, 0x62C8,
-    0x0020, 0x1903, 0x3A88, 0x0020, 0x3A06, 0x10C2, 0x1903, 0x1924,
-    0x0041, 0x1903, 0x2144, 0x0021, 0x1924, 0x3227, 0x1964, 0x10E3,
-    0x10E3, 0x21E6, 0x31E6, 0x10A1, 0x2965, 0x4A47, 0x7BAA, 0x73AB,
-    0x2143, 0x3247, 0x6BCB, 0x7369, 0x4AC8, 0x10E3, 0x4206, 0x2124,
-    0x2185, 0x2164, 0x7BEB, 0x6308, 0x5AE8, 0x10C2, 0x4226, 0x0020,
-    0x0040, 0x31A4, 0x942A, 0x9C6B, 0x4225, 0x5287, 0x7349, 0x39E5,
-    0x5AC7, 0x840A, 0x0020, 0x39C5, 0x6BCB, 0x2184, 0x6B49, 0x5349,
-    0x0000, 0x31A4, 0x73CB, 0x5B29, 0x3A05, 0x946C, 0x5B09, 0x0881,
-    0x6B29, 0x7389, 0x5B28, 0x29C5, 0x6349, 0x4A46, 0x0000, 0x39C5,
-    0x3A27, 0x1144, 0x52E8, 0x8C6C, 0x4AC9, 0x0000, 0x10C3, 0x0000,
-    0x0000, 0x1081, 0x7BAA, 0x2143, 0x08A2, 0x1944, 0x0000, 0x08A2,
-    0x10C2, 0x0000, 0x0000, 0x0020, 0x1903, 0x0882, 0x0861, 0x10A2,
-    0x1103, 0x1944, 0x1903, 0x1944, 0x1923, 0x0081, 0x10C3, 0x0882,
-    0x21A6, 0x08A2, 0x10C2, 0x21A5, 0x1984, 0x1964, 0x1943, 0x1924,
-    0x08A3, 0x1904, 0x0882, 0x1905, 0x2166, 0x10E4, 0x10E4, 0x21A7,
-    0x21A7, 0x3A6B, 0x1966, 0x1966, 0x4B2E, 0x7CF5, 0x534F, 0x9DFA,
-    0xA63B, 0xA63A, 0x9DF9, 0xA63A, 0x9DD9, 0x7494, 0xA61A, 0x9DD9,
-    0xA619, 0x9DF9, 0xA619, 0xA619, 0xA619, 0xA619, 0xA5F9, 0xA619,
-    0xA619, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DFA, 0x9E1A, 0x9E1A,
-    0x9E1A, 0xA5FA, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0x9DD9, 0x95B8, 0x95D8, 0x9DF9, 0xA619, 0xA619,
-    0xA619, 0x9DD9, 0x95B8, 0x9598, 0x9597, 0x7430, 0x84B2, 0xA5F9,
-    0xA63A, 0x9576, 0x6C10, 0x9DD8, 0x8515, 0x4B0B, 0x6C73, 0x31E7,
-    0x10A2, 0x0041, 0x3227, 0x10C2, 0x10A2, 0x10C2, 0x10E3, 0x0021,
-    0x1945, 0x0882, 0x0000, 0x10C3, 0x1104, 0x08A3, 0x10C3, 0x08A2,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x0861, 0x20E2, 0x5AA8,
-    0x10A2, 0x0040, 0x3267, 0x1923, 0x1903, 0x0861, 0x18E3, 0x08A2,
-    0x08A2, 0x18E2, 0x2143, 0x0861, 0x0882, 0x29E6, 0x29C6, 0x0000,
-    0x08E3, 0x0904, 0x18E2, 0x840B, 0x18C2, 0x0000, 0x6B28, 0x946C,
-    0x4AA7, 0x3268, 0x3267, 0x840B, 0x31E6, 0x3A47, 0x39E5, 0x10C2,
-    0x3206, 0x1103, 0x5AE8, 0x7BAA, 0x6308, 0x18C2, 0x2943, 0x0881,
-    0x0861, 0x4205, 0x73AA, 0x83EA, 0x5A87, 0x5AA7, 0xACCC, 0x7348,
-    0x7B89, 0x944B, 0x0841, 0x2102, 0x6BCB, 0x1944, 0x6B49, 0x42C8,
-    0x0000, 0x4205, 0x844C, 0x3206, 0x3A05, 0x73EB, 0x08A2, 0x5AC8,
-    0x4A46, 0x4226, 0x4B09, 0x3226, 0x6329, 0x1903, 0x0020, 0x6B49,
-    0x2185, 0x2184, 0x8C2B, 0x3A87, 0x1124, 0x0000, 0x0861, 0x0020,
-    0x41E6, 0x6B6A, 0x4A67, 0x0020, 0x10E3, 0x1924, 0x0040, 0x0000,
-    0x1903, 0x42C9, 0x29C5, 0x10E2, 0x0040, 0x10C2, 0x18E3, 0x1923,
-    0x29C5, 0x3206, 0x2164, 0x0000, 0x0000, 0x0041, 0x10E4, 0x0000,
-    0x1945, 0x10A3, 0x10A2, 0x21A5, 0x42E8, 0x4329, 0x4329, 0x3248,
-    0x21A7, 0x3209, 0x10C3, 0x29A8, 0x2187, 0x1925, 0x324A, 0x5BAF,
-    0x3209, 0x326B, 0x63D0, 0x4B0D, 0x42ED, 0x7494, 0x63D1, 0x84F5,
-    0xA61A, 0x9DF9, 0x9DF9, 0x9DF9, 0xAE3A, 0x7494, 0x9598, 0xA63A,
-    0x9E19, 0xA5FA, 0xA619, 0xA619, 0xA619, 0xA619, 0xA619, 0xA61A,
-    0xA61A, 0x9DFA, 0xA61A, 0xA5FA, 0x9E1A, 0x9E1A, 0x9E1A, 0x9E1A,
-    0x9DF9, 0x9DF9, 0xA61A, 0xA5F9, 0xA619, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0x9DF9, 0xA5FA, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A, 0x9E19, 0x9DF9,
-    0x74B2, 0x7C4C, 0x848E, 0x5B4B, 0x7470, 0x7450, 0x6C72, 0x42CA,
-    0x3228, 0x1944, 0x3226, 0x2184, 0x0882, 0x2985, 0x4288, 0x1966,
-    0x1986, 0x2185, 0x21A6, 0x1966, 0x1124, 0x1965, 0x0062, 0x08A3,
-    0x0021, 0x0862, 0x0061, 0x0861, 0x0882, 0x0861, 0x20E2, 0x5287,
-    0x0000, 0x0020, 0x0861, 0x0882, 0x0000, 0x0000, 0x0000, 0x0061,
-    0x1985, 0x2123, 0x2964, 0x2165, 0x1923, 0x0861, 0x1964, 0x0881,
-    0x3227, 0x4267, 0x1082, 0x2103, 0x5AE8, 0x1903, 0x1903, 0x9CCD,
-    0x73EA, 0x3267, 0x2A27, 0x7BEB, 0x3247, 0x5B29, 0x5AC8, 0x2985,
-    0x29E6, 0x1944, 0x4A46, 0x7BCA, 0x4206, 0x2124, 0x2144, 0x10A2,
-    0x634A, 0x5AC7, 0x842B, 0x6B07, 0x6B28, 0x2103, 0xA48C, 0x9C8B,
-    0x6328, 0x8C0A, 0x2944, 0x4A46, 0x740B, 0x1984, 0x6B48, 0x42C8,
-    0x0000, 0x18C2, 0x8C4B, 0x4A87, 0x3A06, 0x6BCB, 0x0040, 0x4A67,
-    0x1902, 0x5309, 0x29E6, 0x4266, 0x7BEB, 0x0061, 0x18C2, 0x39E5,
-    0x0000, 0x5AE9, 0x5B29, 0x3A67, 0x0000, 0x0841, 0x0000, 0x2944,
-    0x6B09, 0x0881, 0x1103, 0x0841, 0x0861, 0x1923, 0x29A5, 0x0882,
-    0x10C2, 0x1103, 0x29E6, 0x1944, 0x0861, 0x2184, 0x2184, 0x29A5,
-    0x29A5, 0x2984, 0x1903, 0x0020, 0x0000, 0x0841, 0x18E4, 0x0882,
-    0x1926, 0x29A7, 0x0882, 0x10C3, 0x21A6, 0x1924, 0x1924, 0x2A28,
-    0x2187, 0x1966, 0x322A, 0x29C8, 0x2187, 0x1925, 0x2A09, 0x538F,
-    0x10C4, 0x42CC, 0x95B8, 0x53B0, 0x5BB0, 0x6C53, 0x8D16, 0x5BB0,
-    0xA61A, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5F9, 0xA61A, 0xA619,
-    0xA619, 0xA5FA, 0xA61A, 0xA619, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0x9DFA, 0xA61A, 0xA61A, 0x9E1A, 0x9E1A, 0x9E1A, 0x9DFA,
-    0xA65B, 0xA65B, 0x9DFA, 0xA619, 0xA619, 0xA619, 0xA61A, 0xA619,
-    0xA619, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA619, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9E19,
-    0xA619, 0x9E19, 0x9E19, 0x9DF9, 0xA5F9, 0x9DF9, 0x9DF9, 0xA63A,
-    0x8535, 0x7CB0, 0x9554, 0x8CD1, 0x8D13, 0x7472, 0x7CD4, 0x42EC,
-    0x21E8, 0x2186, 0x3269, 0x4B0C, 0x21A5, 0x4288, 0x3A69, 0x10E4,
-    0x1945, 0x1925, 0x1104, 0x0061, 0x29C5, 0x3A06, 0x31E5, 0x3206,
-    0x2144, 0x10C3, 0x1925, 0x2186, 0x21A6, 0x1965, 0x31C5, 0x5267,
-    0x0000, 0x0840, 0x2124, 0x0861, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x1124, 0x29E6, 0x2984, 0x3248, 0x08A2, 0x0881, 0x29A5, 0x0061,
-    0x3227, 0x5AE8, 0x1082, 0x0000, 0x2964, 0x39E5, 0x0882, 0x5B09,
-    0x6BAA, 0x5B6A, 0x3A26, 0x5B09, 0x6B8A, 0x1903, 0x5AC8, 0x31E5,
-    0x3226, 0x2A06, 0x18E2, 0x946C, 0x52A7, 0x2103, 0x6B4A, 0x31C5,
-    0x4A67, 0x840B, 0x6B69, 0x62E7, 0x7BEB, 0x4206, 0xA48B, 0xA4AC,
-    0x4266, 0x7BAA, 0x31C5, 0x62E8, 0x5AC8, 0x0881, 0x6B49, 0x3AC8,
-    0x0041, 0x10A1, 0x6B69, 0x6349, 0x3A06, 0x73CB, 0x1103, 0x62C8,
-    0x39C4, 0x52E9, 0x21A5, 0x5AE8, 0x4288, 0x1944, 0x736A, 0x2964,
-    0x39C5, 0x4AC8, 0x4287, 0x1903, 0x0000, 0x1903, 0x31A5, 0x41E6,
-    0x0000, 0x2944, 0x18E2, 0x0000, 0x0000, 0x0000, 0x0020, 0x0862,
-    0x0861, 0x0000, 0x1104, 0x1944, 0x3206, 0x29C6, 0x0082, 0x1104,
-    0x0021, 0x10E3, 0x1925, 0x1925, 0x1945, 0x2165, 0x2166, 0x10C3,
-    0x29A7, 0x2166, 0x29A7, 0x322A, 0x3229, 0x2187, 0x29A8, 0x320A,
-    0x29A8, 0x29C8, 0x2A09, 0x2187, 0x29C7, 0x10C3, 0x1945, 0x6411,
-    0x4B0D, 0x4AED, 0x9E1A, 0x7CB4, 0x42CC, 0x7CB4, 0x9DB8, 0x84F5,
-    0x95B8, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A,
-    0xA5FA, 0xA619, 0xA5F9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA619, 0xA619,
-    0xA619, 0xA619, 0xA5F9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA63A,
-    0x6C31, 0x73F0, 0xB65A, 0x9DFA, 0xA61A, 0xA619, 0xA619, 0xA619,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619,
-    0xA5FA, 0xA61A, 0xA63A, 0xA63A, 0xA63A, 0xA61A, 0x9DF9, 0x9DF9,
-    0xA619, 0x9E19, 0xA619, 0xA5F9, 0x9DF9, 0xA61A, 0x95B8, 0x7D16,
-    0x7D16, 0x8557, 0x8D77, 0x8D98, 0x8D56, 0x530D, 0x7431, 0x10E4,
-    0x21A7, 0x1986, 0x3A8B, 0x74F5, 0x2A08, 0x1924, 0x2166, 0x10E4,
-    0x3209, 0x322A, 0x2187, 0x1925, 0x3227, 0x4267, 0x29C5, 0x2964,
-    0x1924, 0x10A2, 0x1924, 0x1124, 0x1945, 0x0000, 0x20E2, 0x5247,
-    0x0000, 0x0020, 0x2144, 0x2164, 0x0000, 0x0000, 0x0020, 0x0020,
-    0x0882, 0x08A2, 0x2164, 0x29E6, 0x0000, 0x08A1, 0x2985, 0x0000,
-    0x0041, 0x1103, 0x18E2, 0x0000, 0x18C2, 0x5AA8, 0x0000, 0x0840,
-    0x83EB, 0x42C8, 0x842B, 0x3A05, 0x7BEB, 0x2943, 0x31A5, 0x4266,
-    0x2164, 0x3247, 0x31A4, 0x842B, 0x6B89, 0x2102, 0x4A66, 0x4A46,
-    0x6B49, 0x7BCA, 0x7BCA, 0x946C, 0x6349, 0x5AA7, 0x9C8C, 0xA4AC,
-    0x6B48, 0x4226, 0x5AA7, 0x5AE8, 0x10C2, 0x0000, 0x73CA, 0x3AA7,
-    0x2144, 0x10C2, 0x3A26, 0x6B8A, 0x3A46, 0x73AA, 0x3A26, 0x4206,
-    0x5266, 0x3A67, 0x42A8, 0x6349, 0x29E6, 0x52C8, 0x5AA7, 0x4205,
-    0x5B09, 0x1984, 0x4AC8, 0x0861, 0x0000, 0x39A4, 0x944C, 0x0881,
-    0x10A2, 0x4226, 0x0020, 0x0020, 0x0000, 0x0000, 0x0882, 0x10E4,
-    0x0862, 0x0000, 0x0882, 0x08A3, 0x08A3, 0x1925, 0x08A2, 0x1105,
-    0x29C6, 0x42E9, 0x4309, 0x42E9, 0x4309, 0x42E9, 0x4309, 0x21A6,
-    0x1926, 0x1925, 0x29C8, 0x1905, 0x1925, 0x29E8, 0x2187, 0x2A09,
-    0x29E9, 0x29E9, 0x326A, 0x324A, 0x5BAF, 0x3A6B, 0x2187, 0x42ED,
-    0x6C53, 0x3209, 0x8557, 0x74B5, 0x4B4E, 0x5BF1, 0x7493, 0xA5F9,
-    0x9598, 0x8D78, 0x8D77, 0x8D57, 0x8D57, 0x8D77, 0x9DF9, 0xA61A,
-    0xA61A, 0xA5F9, 0xA63A, 0xAE5A, 0xAE7B, 0xA61A, 0x9DFA, 0xA5FA,
-    0xA5F9, 0x9DF9, 0xA61A, 0xAE7B, 0xAE5B, 0xA63A, 0xAE7B, 0x84F5,
-    0x4269, 0x7BCE, 0xC679, 0xA61A, 0x9E19, 0xA619, 0xA61A, 0xA619,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0x95B8, 0x7CF5, 0x74D5, 0x74D5, 0x6CB5, 0x74F5, 0x9E19,
-    0x9E19, 0xA619, 0xA619, 0x9DF9, 0xA61A, 0x9DD8, 0x8D57, 0x7CF5,
-    0x6453, 0x74D4, 0x7D15, 0x8536, 0x7CD4, 0x638F, 0x8493, 0x3A4A,
-    0x42ED, 0x3AEC, 0x3A8B, 0x6C73, 0x3AAB, 0x3A8A, 0x1965, 0x1966,
-    0x2A09, 0x2A29, 0x1946, 0x2167, 0x1926, 0x1946, 0x1926, 0x2986,
-    0x3A67, 0x3A46, 0x3247, 0x10E3, 0x21A6, 0x21A6, 0x31A5, 0x4A06,
-    0x10E3, 0x29A5, 0x2164, 0x1924, 0x1924, 0x0861, 0x0000, 0x1924,
-    0x29A5, 0x0840, 0x0061, 0x10C2, 0x18C2, 0x0020, 0x0020, 0x0000,
-    0x10A2, 0x08A2, 0x39A5, 0x5267, 0x0000, 0x736A, 0x2923, 0x0000,
-    0x4226, 0x6369, 0x840B, 0x6B8A, 0x5B29, 0x2964, 0x2964, 0x8C6D,
-    0x29A5, 0x21A5, 0x7389, 0x840A, 0x73AA, 0x5286, 0x2964, 0x39E5,
-    0x6B49, 0x5AC8, 0x5B29, 0xAD0D, 0xA4CD, 0x5AA7, 0x7369, 0x944B,
-    0x8C0A, 0x29C5, 0x6B28, 0x5B28, 0x0000, 0x0000, 0x6349, 0x32A7,
-    0x2185, 0x29E6, 0x39E5, 0x73CB, 0x4287, 0x4A66, 0x4287, 0x0881,
-    0x41C5, 0x3A67, 0x5309, 0x5309, 0x1144, 0x6329, 0x10C2, 0x5287,
-    0x1923, 0x2207, 0x42A8, 0x0861, 0x0000, 0x5AC7, 0x4A46, 0x0000,
-    0x2944, 0x0861, 0x0000, 0x0020, 0x0000, 0x0041, 0x1904, 0x0862,
-    0x0000, 0x10A2, 0x1925, 0x1905, 0x1105, 0x08A3, 0x0041, 0x1905,
-    0x2165, 0x21A5, 0x29E6, 0x29A5, 0x2184, 0x1924, 0x29C7, 0x29C7,
-    0x2167, 0x2166, 0x1925, 0x1925, 0x324A, 0x3AAB, 0x1926, 0x324A,
-    0x29C8, 0x21A7, 0x63F1, 0x42CC, 0x5BAF, 0x29E9, 0x3A8B, 0x3A8B,
-    0x6CB4, 0x42ED, 0x5BD0, 0x95B8, 0x9598, 0x8D57, 0x8D57, 0x8D57,
-    0x8D57, 0x8536, 0x8557, 0x8557, 0x8537, 0x8537, 0x9DF9, 0xA61A,
-    0xA61A, 0x9DF9, 0xAE3A, 0xB67B, 0xB69B, 0xA61A, 0x9DFA, 0x9DF9,
-    0x9DF9, 0xA63A, 0x9597, 0x532D, 0x6BF0, 0x73CF, 0x842F, 0x4B0D,
-    0x2166, 0x9DB8, 0xA63A, 0xA5F9, 0xA619, 0xA61A, 0xA61A, 0x9E1A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA63A, 0x9598, 0x8D77, 0x9597, 0x8D57, 0x8D57, 0x9DF9, 0x9DF9,
-    0x9DF9, 0xA619, 0x9E19, 0xA5F9, 0xA61A, 0x9598, 0x8D77, 0x8557,
-    0x6C94, 0x6453, 0x6453, 0x6C94, 0x3A6A, 0x63F0, 0x324A, 0x3A8B,
-    0x3A8B, 0x6432, 0x42CD, 0x6431, 0x21A8, 0x3AAB, 0x21C7, 0x21A7,
-    0x1946, 0x2166, 0x21A8, 0x21A8, 0x2167, 0x2187, 0x29C8, 0x29E8,
-    0x29A6, 0x29E6, 0x1965, 0x08A2, 0x1945, 0x2187, 0x31A6, 0x4A26,
-    0x0000, 0x0862, 0x10C3, 0x1924, 0x21A6, 0x10A2, 0x0000, 0x08A2,
-    0x3A26, 0x18E2, 0x0041, 0x0881, 0x6B29, 0x0020, 0x0000, 0x0000,
-    0x0020, 0x0000, 0x0000, 0x5267, 0x0840, 0x3184, 0x736A, 0x0861,
-    0x4206, 0x8C4C, 0x6B69, 0x844C, 0x31C5, 0x39C5, 0x0000, 0x73AA,
-    0x6349, 0x1965, 0x39E5, 0x844C, 0x8C4B, 0x7369, 0x39C5, 0x5266,
-    0x5AC8, 0x6349, 0x6BAA, 0x7BCA, 0xA4CD, 0x4204, 0x6B48, 0x9C8C,
-    0x83EA, 0x1144, 0x5AC7, 0x5B28, 0x1081, 0x0000, 0x6B6A, 0x2226,
-    0x2144, 0x2A07, 0x39E5, 0x844C, 0x4AC8, 0x42A8, 0x3AC9, 0x10E2,
-    0x18C2, 0x2185, 0x4246, 0x4267, 0x29A6, 0x3A47, 0x08C2, 0x5AC8,
-    0x29C6, 0x3AA8, 0x2185, 0x1103, 0x18C2, 0x6B29, 0x0840, 0x0020,
-    0x4A47, 0x18C2, 0x0882, 0x0882, 0x0000, 0x1924, 0x21A6, 0x1924,
-    0x0882, 0x1904, 0x2146, 0x10E4, 0x29E8, 0x10E4, 0x1925, 0x2146,
-    0x1926, 0x1926, 0x1946, 0x2187, 0x1926, 0x2167, 0x1967, 0x1926,
-    0x2187, 0x29A8, 0x1925, 0x1925, 0x324A, 0x324B, 0x1946, 0x3209,
-    0x538F, 0x4B2E, 0x6C94, 0x3ACC, 0x6411, 0x21A8, 0x5390, 0x42CD,
-    0x4B2E, 0x6432, 0x4B4F, 0x6CB4, 0x6CB4, 0x8536, 0x8536, 0x8536,
-    0x8556, 0x8536, 0x9DD8, 0xAE5A, 0xA63A, 0xA63A, 0xA61A, 0xA61A,
-    0xA619, 0xA61A, 0x9DFA, 0x9DF9, 0x9DD9, 0x9DF9, 0x9E19, 0xA5F9,
-    0xA619, 0x9E19, 0x95B8, 0x4AAB, 0x2986, 0x4207, 0x5A47, 0x4A49,
-    0x3A4A, 0x4B2E, 0xAE3A, 0xA5F9, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0x9E1A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0x9DF9, 0xA63A, 0x9DD9, 0x9DD9, 0xAE5A, 0xA63A, 0xA61A, 0xA5FA,
-    0xA5F9, 0xA619, 0xA619, 0xA5F9, 0x9DF9, 0xA61A, 0xA5F9, 0x8556,
-    0x74B5, 0x6453, 0x6C94, 0x6432, 0x21C8, 0x6411, 0x3AAC, 0x5BD0,
-    0x6452, 0x6431, 0x3A8B, 0x7D36, 0x324A, 0x1105, 0x08C4, 0x2187,
-    0x1925, 0x42AC, 0x29A8, 0x29A8, 0x322A, 0x2A09, 0x29C8, 0x29C8,
-    0x21A8, 0x29E9, 0x2A09, 0x2187, 0x29A8, 0x1967, 0x4A69, 0x5AA8,
-    0x08A3, 0x1946, 0x2166, 0x21A7, 0x29C8, 0x21A7, 0x1966, 0x2186,
-    0x1925, 0x10E3, 0x1944, 0x1944, 0x5A88, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0020, 0x0000, 0x3184, 0x6B28, 0x2943, 0xBD6F, 0x3184,
-    0x2965, 0x6B69, 0x52C7, 0x73EB, 0x08C2, 0x73AA, 0x1902, 0x5B08,
-    0x8C6C, 0x19A5, 0x52E8, 0xAD0E, 0x7BA9, 0x9C8C, 0x2963, 0x7348,
-    0x73AA, 0x6BCA, 0x842B, 0x52E8, 0x73AA, 0x39E4, 0x5308, 0x83EA,
-    0x7BCA, 0x29C5, 0x5AA8, 0x5B29, 0x1903, 0x0000, 0x4287, 0x2226,
-    0x3247, 0x21C6, 0x31E5, 0x52C8, 0x52E9, 0x21C6, 0x21A6, 0x5B09,
-    0x2963, 0x08E3, 0x3A68, 0x2165, 0x3A06, 0x3206, 0x10C2, 0x2144,
-    0x29E6, 0x1103, 0x2165, 0x29C6, 0x5286, 0x6369, 0x0000, 0x2964,
-    0x4A47, 0x1082, 0x1905, 0x320A, 0x10E4, 0x0041, 0x0020, 0x0882,
-    0x0862, 0x0862, 0x1904, 0x0882, 0x21A7, 0x2166, 0x1925, 0x1925,
-    0x29E9, 0x3209, 0x2187, 0x2187, 0x21A8, 0x21A8, 0x29E9, 0x2187,
-    0x2187, 0x322A, 0x29E9, 0x2146, 0x29C8, 0x29E9, 0x2166, 0x3229,
-    0x74B5, 0x6CB4, 0x74D5, 0x3A8B, 0x6453, 0x5390, 0x42CC, 0x5BF1,
-    0x6C32, 0x7D36, 0x6C94, 0x74D5, 0x95D8, 0xAE5A, 0xAE3A, 0xAE5A,
-    0xAE5A, 0xAE5A, 0xAE5A, 0xAE3A, 0x9DF9, 0x9DF9, 0xA619, 0xA61A,
-    0xA619, 0x9DFA, 0x9DFA, 0x9DFA, 0x9DF9, 0x9DF9, 0x9E19, 0xA61A,
-    0x9DD8, 0x8D77, 0x6C94, 0x74B4, 0x29E9, 0x2987, 0x2987, 0x3A29,
-    0x3209, 0x536F, 0xAE5A, 0xA5F9, 0xA619, 0xA619, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA61A, 0xA61A, 0x9E1A,
-    0xA61A, 0xA61A, 0xA63A, 0xA61A, 0xA61A, 0xA619, 0x9E19, 0xA61A,
-    0x8536, 0x74B5, 0x6CB4, 0x6C94, 0x9598, 0xA63A, 0x9E19, 0xA619,
-    0xA5F9, 0xA5F9, 0xA5F9, 0x9DF9, 0x9DF9, 0xA61A, 0xA5F9, 0x9DB8,
-    0xA619, 0x9DB8, 0x74F5, 0x536F, 0x4B6F, 0x6493, 0x328B, 0x6453,
-    0x7516, 0x5BD0, 0x2A4A, 0x7D36, 0x324A, 0x1104, 0x2187, 0x2A09,
-    0x3ACC, 0x5BD0, 0x1966, 0x3A8C, 0x2A09, 0x324A, 0x322A, 0x29E8,
-    0x322A, 0x2A09, 0x3209, 0x29E9, 0x29C8, 0x21C9, 0x3208, 0x5288,
-    0x21A7, 0x29C9, 0x2187, 0x2187, 0x21A8, 0x21C8, 0x2187, 0x1966,
-    0x1986, 0x1986, 0x0020, 0x0840, 0x736A, 0x3164, 0x2943, 0x2944,
-    0x39E6, 0x5267, 0x5267, 0x5AC8, 0x946C, 0x4A26, 0x62E9, 0x6B6A,
-    0x1104, 0x7BEB, 0x6B28, 0x6B8A, 0x0040, 0x7C0B, 0x4A86, 0x29A4,
-    0x9CAC, 0x73CA, 0x6349, 0xA4ED, 0x6307, 0xA4AC, 0x4205, 0x4A45,
-    0x9C6B, 0x7389, 0x9CAC, 0x6369, 0x842B, 0x7389, 0x2206, 0x73CA,
-    0x5AE7, 0x42A8, 0x2184, 0x4267, 0x1903, 0x0000, 0x08C2, 0x2247,
-    0x2A48, 0x2A06, 0x21A5, 0x31E5, 0x6329, 0x10E3, 0x21A6, 0x4AA8,
-    0x10A1, 0x2144, 0x42A9, 0x2185, 0x52E9, 0x10E3, 0x2964, 0x5AC8,
-    0x4A67, 0x31A5, 0x29C6, 0x52E9, 0x6B69, 0x3267, 0x0041, 0x4A87,
-    0x3207, 0x0861, 0x2185, 0x2165, 0x1945, 0x1104, 0x0882, 0x10A3,
-    0x10E4, 0x1905, 0x2167, 0x10E4, 0x1945, 0x10A3, 0x0882, 0x21A7,
-    0x1966, 0x29A8, 0x21A7, 0x29E9, 0x1946, 0x2166, 0x29E9, 0x2A09,
-    0x1946, 0x3A8B, 0x3A8B, 0x29A8, 0x42ED, 0x42CC, 0x3209, 0x29C8,
-    0x6C94, 0x6474, 0x74D5, 0x42CC, 0x6432, 0x6453, 0x4B6F, 0x7D16,
-    0x8536, 0x74B5, 0x5C53, 0x7CF6, 0x8536, 0x8516, 0x8536, 0x8536,
-    0x8536, 0x8536, 0x7D16, 0x7CF5, 0x6C94, 0x6C94, 0x9DF9, 0xA619,
-    0xA619, 0x9E1A, 0x9E1A, 0xA5FA, 0xA63A, 0xA63A, 0xA619, 0xA619,
-    0xA619, 0xA61A, 0xA61A, 0x7494, 0x5390, 0x3ACD, 0x42CD, 0x4B50,
-    0x3ACE, 0x8D77, 0xA619, 0x9DF9, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA61A,
-    0x9DF9, 0x95B8, 0x95B8, 0x9DB9, 0xA61A, 0xA63A, 0xA63A, 0xA63A,
-    0xA61A, 0x9DF9, 0x9DD9, 0xA61A, 0xAE5A, 0xAE3A, 0xA63A, 0xA63A,
-    0xA63A, 0xA63A, 0xA61A, 0x9DF9, 0x9DFA, 0x8D77, 0x8536, 0x8D77,
-    0x8516, 0x8536, 0x6412, 0x3ACC, 0x6CB4, 0x432E, 0x3A8B, 0x6CD5,
-    0x6CB4, 0x74D5, 0x430E, 0x6453, 0x42AC, 0x29E9, 0x326A, 0x42CC,
-    0x328B, 0x5BF1, 0x5B4E, 0x74B4, 0x29E9, 0x42ED, 0x3A8B, 0x324A,
-    0x326B, 0x2187, 0x21C8, 0x21E9, 0x1105, 0x326B, 0x1946, 0x3186,
-    0x29C8, 0x4B2E, 0x31E8, 0x29C7, 0x3208, 0x5B0B, 0x62E9, 0x634A,
-    0x6B49, 0x6329, 0x5AA7, 0x6B29, 0x4A26, 0x4206, 0x4206, 0x4A27,
-    0x2925, 0x18C4, 0x20E4, 0x0843, 0x5A88, 0x41E6, 0x0001, 0x6329,
-    0x4226, 0x18A1, 0x5287, 0x4A66, 0x18E3, 0x5B49, 0x73CA, 0x2A05,
-    0x52A6, 0xB54E, 0x3A04, 0x8C0B, 0x7348, 0x7369, 0x73AA, 0x2943,
-    0x8BEA, 0x8BEA, 0x73AA, 0x6B89, 0x6349, 0x7389, 0x0943, 0x5B6A,
-    0x4A66, 0x638A, 0x2185, 0x4247, 0x5287, 0x0020, 0x0020, 0x1184,
-    0x2A27, 0x4AA8, 0x0061, 0x4205, 0x52A8, 0x21C7, 0x2A07, 0x1944,
-    0x0000, 0x4206, 0x4AE9, 0x3206, 0x5309, 0x10E3, 0x52A7, 0x5AE8,
-    0x4AC8, 0x0882, 0x10A2, 0x4AA8, 0x52A7, 0x1165, 0x1986, 0x2985,
-    0x29A5, 0x3206, 0x5309, 0x5309, 0x4AE9, 0x42A9, 0x3209, 0x3209,
-    0x29C9, 0x21A8, 0x324A, 0x3209, 0x21A7, 0x21A7, 0x29E9, 0x2A09,
-    0x2167, 0x1946, 0x21A7, 0x324A, 0x3A8B, 0x3209, 0x3A6B, 0x324A,
-    0x42AC, 0x3ACC, 0x3209, 0x21A7, 0x6412, 0x42ED, 0x538F, 0x1966,
-    0x6CB4, 0x6494, 0x6C94, 0x6C73, 0x6C94, 0x6CB4, 0x6CB5, 0x6453,
-    0x5C33, 0x5C53, 0x6453, 0x5C33, 0x6453, 0x74B4, 0x8D77, 0x8557,
-    0x8556, 0x8536, 0x9598, 0x9DF9, 0xA5F9, 0xA61A, 0xA63A, 0xA61A,
-    0x9DF9, 0x9DD9, 0x9DD9, 0x9DF9, 0x8557, 0x8D77, 0xA61A, 0xA619,
-    0x9E19, 0xA619, 0x9DFA, 0x9598, 0x9DB8, 0x9DD9, 0x9DD9, 0x9DB8,
-    0x21C9, 0x428B, 0x6C32, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9DF9, 0x9E1A,
-    0x9598, 0x8516, 0x7D16, 0x9DD9, 0x9DD9, 0x8557, 0x8D77, 0x7CF5,
-    0x74F5, 0x6473, 0x5C32, 0x6CB4, 0x8536, 0x8557, 0x8557, 0x8D57,
-    0x8D57, 0x8516, 0x95B8, 0x8D77, 0x6473, 0x8D77, 0x9DF9, 0x9DD8,
-    0x8536, 0x8D97, 0x6432, 0x7493, 0x9E19, 0x3AAB, 0x5BAF, 0x8D98,
-    0x6CB4, 0x74D5, 0x6452, 0x5390, 0x2187, 0x536F, 0x3A8B, 0x5B6F,
-    0x4B4E, 0x5BD0, 0x2104, 0x4AAA, 0x73CD, 0x8470, 0x7C30, 0x5B6E,
-    0x7451, 0x3A4A, 0x534D, 0x5B2C, 0x52CA, 0x6BAD, 0x634B, 0x6B4A,
-    0x632A, 0x7BCD, 0x5267, 0x4A47, 0x5AA8, 0x41E7, 0x2925, 0x2945,
-    0x3165, 0x3145, 0x2124, 0x2104, 0x0001, 0x0000, 0x1083, 0x0863,
-    0x18C5, 0x18C5, 0x20E5, 0x31A8, 0x5ACA, 0x6B6B, 0x31A8, 0x2125,
-    0x5AC8, 0x1081, 0x736A, 0x31E5, 0x31C5, 0x52E8, 0x5AE8, 0x3A87,
-    0x3A26, 0x9CAC, 0x4A45, 0x52C8, 0x6308, 0x3183, 0x946C, 0x2963,
-    0x6AE8, 0x940A, 0x7389, 0x738A, 0x4AC7, 0x4A66, 0x0081, 0x740B,
-    0x5AE7, 0x42A7, 0x2184, 0x2123, 0x5AC8, 0x0020, 0x0000, 0x0020,
-    0x1923, 0x5B09, 0x1924, 0x5246, 0x6329, 0x3248, 0x2165, 0x29A6,
-    0x0000, 0x4205, 0x5B49, 0x6B8A, 0x3A26, 0x39E5, 0x5AE8, 0x5AE7,
-    0x5309, 0x0882, 0x0861, 0x4A87, 0x4A46, 0x0862, 0x10C3, 0x0881,
-    0x0000, 0x10E3, 0x1924, 0x1903, 0x1965, 0x2186, 0x1926, 0x21A8,
-    0x29C8, 0x2A09, 0x2A0A, 0x21A8, 0x29C8, 0x29E8, 0x1925, 0x1946,
-    0x21A7, 0x29C8, 0x2187, 0x29E9, 0x4B2E, 0x42CC, 0x3209, 0x29E9,
-    0x6C73, 0x324A, 0x42ED, 0x430D, 0x5BD1, 0x322A, 0x5BD1, 0x42CC,
-    0x5BD1, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB4,
-    0x74D5, 0x74B5, 0x74D5, 0x74D5, 0x6C74, 0x6C94, 0x6C74, 0x6C74,
-    0x6474, 0x6453, 0x74B5, 0x7D16, 0x7D16, 0x7D16, 0x7CF5, 0x8536,
-    0x8D77, 0x7D16, 0x8516, 0x8D77, 0x9DD9, 0x9DF9, 0xAE3A, 0xA63A,
-    0xA63A, 0xA61A, 0x9DFA, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xAE5A,
-    0x8515, 0x63F1, 0x9598, 0xA63A, 0xA619, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9DF9, 0x8536, 0x7D16,
-    0x74D5, 0x74B5, 0x74D5, 0x74D5, 0x6494, 0x5C33, 0x6453, 0x6453,
-    0x6C74, 0x7D16, 0x9DD9, 0x95B8, 0x74F5, 0x95B8, 0x95B8, 0x95B8,
-    0x95B8, 0x9598, 0x95B8, 0x9598, 0x8557, 0x8D97, 0x8536, 0x8536,
-    0x8536, 0x8536, 0x74D5, 0x7D16, 0x74F5, 0x5C32, 0x74B4, 0x7D16,
-    0x6CB4, 0x6CB4, 0x6CB4, 0x74D5, 0x42EC, 0x42ED, 0x322A, 0x3A8B,
-    0x5BF1, 0x5BF1, 0x1083, 0x20E4, 0x39C5, 0x4226, 0x3185, 0x4A47,
-    0x6B4B, 0x6B4A, 0x6B4B, 0x3185, 0x39C6, 0x39A6, 0x3185, 0x2944,
-    0x2944, 0x2965, 0x18C5, 0x10A4, 0x20C6, 0x20E6, 0x10A4, 0x0842,
-    0x1082, 0x5289, 0x738B, 0x73AC, 0x4AA9, 0x0882, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0882, 0x4A67, 0x73AA, 0x3A07, 0x31C6,
-    0x52A8, 0x4227, 0x52A7, 0x840B, 0x6328, 0x4246, 0x6308, 0x52E8,
-    0x21E6, 0x73AA, 0x6329, 0x19A5, 0x840B, 0x5286, 0x7BCA, 0x5B49,
-    0x1902, 0x83A9, 0x5AA6, 0x5AC7, 0x73AA, 0x18C2, 0x0061, 0x7C2B,
-    0x6328, 0x21A5, 0x21A5, 0x2103, 0x4A46, 0x0841, 0x0000, 0x0000,
-    0x10A2, 0x29C6, 0x3268, 0x6308, 0x6328, 0x3248, 0x1944, 0x2185,
-    0x0882, 0x5267, 0x6308, 0x5B29, 0x21A5, 0x7349, 0x2963, 0x5287,
-    0x2A06, 0x1103, 0x2144, 0x5B09, 0x2143, 0x0861, 0x1924, 0x3A88,
-    0x1924, 0x2187, 0x21A7, 0x1926, 0x1946, 0x2166, 0x2166, 0x10C4,
-    0x29E9, 0x2A0A, 0x29E9, 0x1946, 0x29E8, 0x3209, 0x1105, 0x2166,
-    0x29A7, 0x3209, 0x3A8B, 0x29E9, 0x3A8C, 0x538F, 0x29E9, 0x324A,
-    0x74B5, 0x5BF2, 0x5C12, 0x4B4F, 0x326B, 0x53B0, 0x6453, 0x6432,
-    0x53B0, 0x6CB4, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6474, 0x74D5,
-    0x8536, 0x7D36, 0x7D16, 0x7CF6, 0x6C74, 0x6C94, 0x6C94, 0x6C94,
-    0x6C74, 0x6C74, 0x6474, 0x6453, 0x6473, 0x6473, 0x6473, 0x6C94,
-    0x8557, 0x8557, 0x8557, 0x8557, 0x8557, 0x7D36, 0x74F6, 0x74F6,
-    0x74F6, 0x74F6, 0x9DD9, 0x9DF9, 0xA5F9, 0xA619, 0xA619, 0xA619,
-    0xA63A, 0xAE7B, 0xA61A, 0x9E19, 0xA61A, 0xA61A, 0xA61A, 0x9E1A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A,
-    0x9598, 0x8536, 0x8557, 0x8536, 0x7D16, 0x7D36, 0x8557, 0x8D77,
-    0x8D77, 0x8D57, 0x8D57, 0x8557, 0x8557, 0x8557, 0x8556, 0x8536,
-    0x8556, 0x8D57, 0x7CF6, 0x6C74, 0x8D77, 0x9597, 0x8D57, 0x8556,
-    0x8557, 0x8557, 0x7D16, 0x74D5, 0x74B4, 0x8D77, 0x8557, 0x8536,
-    0x7CF6, 0x6C94, 0x6CB4, 0x74B5, 0x4B2E, 0x42AC, 0x5390, 0x3A8C,
-    0x53B0, 0x74B4, 0x2187, 0x18E4, 0x31C6, 0x2964, 0x4227, 0x4A47,
-    0x2103, 0x0861, 0x0000, 0x0000, 0x0000, 0x1083, 0x39E7, 0x5AEA,
-    0x634B, 0x52EB, 0x10A4, 0x0022, 0x10A4, 0x10A3, 0x0020, 0x0000,
-    0x0000, 0x0861, 0x31C5, 0x5AE9, 0x8C8E, 0x842D, 0x5288, 0x2944,
-    0x1061, 0x18C2, 0x2103, 0x4A26, 0x5AE8, 0x6308, 0x39E6, 0x39E5,
-    0x4246, 0x3A07, 0x4AE9, 0x946C, 0xA4AC, 0x4AC8, 0x6B8A, 0x9CAC,
-    0x2164, 0x738A, 0x844B, 0x2A26, 0x9CCD, 0xA4CD, 0x7389, 0x8C4B,
-    0x4246, 0x83C9, 0x5AC7, 0x4AA7, 0x7C0B, 0x39E5, 0x0881, 0x4226,
-    0x7B8A, 0x2123, 0x2165, 0x18C2, 0x52A8, 0x1923, 0x0000, 0x0000,
-    0x0861, 0x2165, 0x2207, 0x5B29, 0x3A06, 0x2207, 0x21C6, 0x3A27,
-    0x1124, 0x5266, 0x4A25, 0x4B09, 0x1103, 0x4A26, 0x2963, 0x5AE8,
-    0x1965, 0x1966, 0x2186, 0x3A26, 0x29E8, 0x08A3, 0x1103, 0x3206,
-    0x1925, 0x29A8, 0x1946, 0x1925, 0x29C8, 0x2187, 0x29E8, 0x1926,
-    0x3A8B, 0x29C8, 0x3ACC, 0x3AAC, 0x29E8, 0x29E9, 0x3A4A, 0x42AC,
-    0x3209, 0x21A8, 0x5BB0, 0x5390, 0x322A, 0x3ACC, 0x538F, 0x21A8,
-    0x74B4, 0x538F, 0x42ED, 0x6CB4, 0x6412, 0x6CB4, 0x6C94, 0x6C94,
-    0x6CB4, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494,
-    0x6473, 0x6474, 0x6474, 0x6473, 0x6473, 0x6473, 0x6453, 0x6453,
-    0x6C74, 0x6C74, 0x6C94, 0x6474, 0x6473, 0x6473, 0x6473, 0x6473,
-    0x6453, 0x6453, 0x6453, 0x6453, 0x74B4, 0x7D16, 0x7D16, 0x7D16,
-    0x7D16, 0x7D36, 0x9DF9, 0xA61A, 0xA61A, 0xA63A, 0xA63A, 0xA61A,
-    0xA61A, 0x9DF9, 0x9E19, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA619, 0x9E19, 0x9E19,
-    0xA619, 0xA61A, 0xA61A, 0xA61A, 0x9E1A, 0xA5F9, 0xA619, 0xA5F9,
-    0xA61A, 0xA61A, 0x9DF9, 0xA61A, 0x8557, 0x8557, 0x74D5, 0x6C94,
-    0x74B4, 0x6473, 0x6473, 0x6473, 0x6453, 0x6453, 0x6453, 0x6453,
-    0x6453, 0x6453, 0x6C74, 0x6C94, 0x74D5, 0x7CF5, 0x7CF5, 0x74D5,
-    0x8557, 0x8D77, 0x6C73, 0x6453, 0x8536, 0x8516, 0x7D15, 0x8556,
-    0x6CB4, 0x6C94, 0x74F5, 0x5390, 0x4B2E, 0x4B2E, 0x4B4F, 0x5C12,
-    0x5C12, 0x7D15, 0x3A6A, 0x2945, 0x39A6, 0x2104, 0x0882, 0x31A5,
-    0x630A, 0x62E9, 0x5267, 0x4A46, 0x5266, 0x18E2, 0x2923, 0x7B8A,
-    0x9C8D, 0xA4EE, 0x7BAA, 0x2123, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x5267, 0xB54F, 0x946D, 0x6B69,
-    0x8C2C, 0x5AC8, 0x62E9, 0x2124, 0x4227, 0x5AE8, 0x2964, 0x4226,
-    0x4A66, 0x3207, 0x3AC9, 0x638A, 0x5B08, 0x73CB, 0x3AA8, 0x534A,
-    0x5AE8, 0x4246, 0x9CCD, 0x5B49, 0x5329, 0x9CAC, 0x52A6, 0x9C8B,
-    0x6328, 0x5AC7, 0x2963, 0x3A47, 0x6B29, 0x738A, 0x1123, 0x0020,
-    0x6B4A, 0x5287, 0x10E3, 0x0000, 0x3A06, 0x2144, 0x0000, 0x0000,
-    0x0000, 0x39C5, 0x21E6, 0x7BEA, 0x3164, 0x08C3, 0x2A08, 0x2144,
-    0x1904, 0x62E8, 0x41E5, 0x4288, 0x10C2, 0x4A47, 0x0881, 0x2123,
-    0x21A5, 0x0882, 0x1944, 0x4A67, 0x21C8, 0x08A3, 0x2165, 0x2185,
-    0x10E4, 0x1966, 0x1105, 0x6B4A, 0x4ACA, 0x1946, 0x1946, 0x3209,
-    0x4B0D, 0x10E4, 0x3A6B, 0x53B0, 0x1946, 0x1946, 0x42CC, 0x4B0E,
-    0x42CD, 0x1926, 0x6432, 0x53B0, 0x326B, 0x4B2E, 0x5390, 0x324B,
-    0x74D5, 0x6C73, 0x6432, 0x6CB4, 0x6CB4, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x7D16, 0x7D16, 0x7D16, 0x7CF5,
-    0x6C94, 0x6C74, 0x6C74, 0x74D5, 0x8516, 0x7D16, 0x8D97, 0xA619,
-    0xA5F9, 0xA619, 0xA619, 0xA619, 0xAE5A, 0xAE5A, 0x9DF9, 0xA61A,
-    0x9E1A, 0x9DF9, 0x95D8, 0x95D8, 0x95B8, 0x8D78, 0x8D98, 0x95B9,
-    0x8557, 0x9DF9, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA619, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA63A, 0xA63A, 0xA63A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x8536, 0x7D16, 0x8516, 0x8516,
-    0x8516, 0x74D5, 0x5C33, 0x6474, 0x6CB5, 0x74D5, 0x6C94, 0x6473,
-    0x6C74, 0x6C94, 0x6C74, 0x6C74, 0x6474, 0x6C74, 0x6C74, 0x6C74,
-    0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x8536, 0x9597, 0x8D77, 0x8D77,
-    0x8D77, 0x8557, 0x8D77, 0x9597, 0x9597, 0x9597, 0x8557, 0x74F5,
-    0x6C74, 0x6C94, 0x6CB4, 0x4B4F, 0x6432, 0x326B, 0x6412, 0x6CB5,
-    0x6C94, 0x74B4, 0x5BD0, 0x18E4, 0x2946, 0x2966, 0x2966, 0x2925,
-    0x20E4, 0x20E4, 0x31A5, 0x41E6, 0x7BAA, 0x6B29, 0x2123, 0x2943,
-    0x62E8, 0xACED, 0xB52E, 0xB54E, 0x62C7, 0x3164, 0x3184, 0x3164,
-    0x41E6, 0x5AA8, 0x5AA8, 0x5AC8, 0x62E8, 0x39C5, 0x18C3, 0x2924,
-    0x41E5, 0x18C3, 0x18E5, 0x20E5, 0x5268, 0x4A46, 0x5287, 0x3A26,
-    0x52C8, 0x1903, 0x3AA8, 0x4B2A, 0x4AA7, 0x6B49, 0x8CAD, 0x2227,
-    0x6BAA, 0x73EB, 0x5B29, 0x840B, 0x3287, 0x8C8C, 0x5AE7, 0x83EA,
-    0x83CA, 0x29C5, 0x2143, 0x3A67, 0x2964, 0x4246, 0x29E6, 0x0881,
-    0x4A47, 0x5287, 0x1964, 0x0000, 0x2964, 0x1923, 0x0000, 0x0000,
-    0x0000, 0x5AE8, 0x29E5, 0x7389, 0x0020, 0x10C2, 0x29A6, 0x4226,
-    0x0020, 0x4227, 0x2943, 0x42A8, 0x29A5, 0x4267, 0x0000, 0x0000,
-    0x21A5, 0x3206, 0x29A5, 0x4A66, 0x29E7, 0x0041, 0x10E3, 0x1924,
-    0x2124, 0x4A89, 0x3A28, 0x5B2A, 0x3A69, 0x2187, 0x5AEA, 0x3209,
-    0x6473, 0x3229, 0x29E9, 0x42ED, 0x2187, 0x2187, 0x3AAC, 0x4B2E,
-    0x74B4, 0x3A8B, 0x5BF2, 0x6473, 0x53B0, 0x4B6F, 0x5390, 0x432E,
-    0x6C94, 0x6C53, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6494, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6494, 0x6C94, 0x7D16, 0x8536, 0x8536, 0x7D16,
-    0x6C94, 0x6C94, 0x6474, 0x74F5, 0x8D57, 0x8557, 0x8556, 0x7D16,
-    0x7CF5, 0x7D16, 0x7CF6, 0x7D16, 0x7CF5, 0x6CB4, 0x5C33, 0x6453,
-    0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x7D16, 0x8537, 0x8537, 0x95B8,
-    0x8516, 0x9DF9, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA61A, 0x9DF9, 0x7D16, 0x7D16, 0x8536,
-    0x9DF9, 0xA61A, 0x9E1A, 0x9E1A, 0x9E19, 0xA619, 0xA619, 0xA619,
-    0xAE3A, 0xA5F9, 0x8D57, 0x8557, 0x6C94, 0x6474, 0x6C94, 0x6CB4,
-    0x6C94, 0x6C94, 0x7CF5, 0x8D77, 0x8557, 0x6CB4, 0x6C74, 0x6C74,
-    0x6C74, 0x6C74, 0x6473, 0x6473, 0x6473, 0x6473, 0x6474, 0x6474,
-    0x6C94, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x74D5, 0x74D5,
-    0x6C94, 0x6C94, 0x6C94, 0x53B0, 0x6432, 0x3ACC, 0x74B5, 0x6473,
-    0x6C94, 0x6C94, 0x74B4, 0x29C8, 0x18A4, 0x2966, 0x2966, 0x2146,
-    0x2987, 0x2967, 0x1906, 0x2926, 0x20E5, 0x2105, 0x2104, 0x39C5,
-    0x41E6, 0x49E5, 0x4205, 0x41E5, 0x4A26, 0x4A26, 0x4A27, 0x5267,
-    0x39A6, 0x2905, 0x2925, 0x2104, 0x2125, 0x39C7, 0x3187, 0x20E6,
-    0x736B, 0x5288, 0x18E5, 0x10A4, 0x4206, 0x2964, 0x5287, 0x2984,
-    0x5AE8, 0x18C1, 0x73CB, 0x5B49, 0x73CA, 0x3A05, 0x842B, 0x5329,
-    0x3AA8, 0x94CD, 0x5B49, 0x638A, 0x3288, 0x4AA7, 0x6349, 0x31E5,
-    0x7BAA, 0x52E8, 0x2143, 0x3A47, 0x3A26, 0x5246, 0x5309, 0x08A2,
-    0x18C2, 0x5267, 0x29C6, 0x0861, 0x1923, 0x2185, 0x0000, 0x0000,
-    0x0000, 0x5AA7, 0x52A7, 0x5287, 0x0000, 0x08C2, 0x2185, 0x3A26,
-    0x0020, 0x0062, 0x3184, 0x5309, 0x4266, 0x4267, 0x0000, 0x0020,
-    0x1965, 0x42EA, 0x29E6, 0x4A26, 0x10E3, 0x1925, 0x0882, 0x2123,
-    0x62E9, 0x6B8C, 0x52CA, 0x1946, 0x21C9, 0x3208, 0x8C6D, 0x42EB,
-    0x6CB5, 0x3A8B, 0x3A8B, 0x4B0D, 0x322A, 0x3A6B, 0x6411, 0x3AAC,
-    0x74B5, 0x6C73, 0x6C74, 0x6C94, 0x5C32, 0x432E, 0x6C73, 0x6C94,
-    0x4B6F, 0x5BD1, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x6C94, 0x6494, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6473, 0x6473, 0x6473, 0x6473,
-    0x6494, 0x6C94, 0x6C94, 0x6494, 0x6473, 0x6473, 0x6453, 0x7CF5,
-    0x8536, 0x8536, 0x8516, 0x7D16, 0x7D16, 0x8536, 0x8557, 0x8556,
-    0xA619, 0xAE3A, 0xA61A, 0xA61A, 0xA63A, 0xA63A, 0xA63A, 0xA61A,
-    0xAE3A, 0xA61A, 0xA619, 0xA61A, 0xA61A, 0x9E19, 0xA61A, 0xA61A,
-    0xA61A, 0x9E1A, 0x9E1A, 0xA619, 0xA619, 0xA61A, 0xA61A, 0xA61A,
-    0xA61A, 0xA61A, 0xA61A, 0xA619, 0x9E19, 0x95D9, 0x95D9, 0x9DD9,
-    0xA619, 0xA619, 0x9DF9, 0xA61A, 0xA61A, 0xA63A, 0xA63A, 0x9DF9,
-    0x8D77, 0x8D77, 0xA61A, 0xAE5A, 0xA61A, 0xA61A, 0xA61A, 0xA619,
-    0xA619, 0xA619, 0x8557, 0x74B4, 0x74D5, 0x6C94, 0x6C94, 0x6C94,
-    0x6C74, 0x6CB4, 0x8536, 0x8536, 0x8536, 0x74D5, 0x6473, 0x6C94,
-    0x7D36, 0x7D36, 0x8557, 0x8536, 0x6C94, 0x8536, 0x8556, 0x8557,
-    0x6CB4, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x6C94,
-    0x6C94, 0x6C74, 0x6CB5, 0x4B4E, 0x18C4, 0x3166, 0x2946, 0x39C8,
-    0x31A7, 0x2987, 0x2966, 0x3167, 0x3168, 0x41A8, 0x41A8, 0x3147,
-    0x3967, 0x3987, 0x3967, 0x3966, 0x3946, 0x2925, 0x18E5, 0x2105,
-    0x2947, 0x3168, 0x3167, 0x3188, 0x2967, 0x3165, 0x4A27, 0x2925,
-    0x3164, 0x5AE8, 0x0841, 0x0000, 0x41E6, 0x5AC8, 0x4A26, 0x10A1,
-    0x52A7, 0x4A46, 0x4A87, 0x42C9, 0x3A67, 0x3A05, 0x5B09, 0x6B8A,
-    0x29E6, 0x52E8, 0x8C6C, 0x6BAA, 0x2A27, 0x4267, 0x52E8, 0x0061,
-    0x5267, 0x6BAA, 0x10E2, 0x1943, 0x5309, 0x5266, 0x5309, 0x08E3,
-    0x1081, 0x4A26, 0x10E3, 0x0881, 0x1923, 0x29E6, 0x0881, 0x0000,
-    0x0020, 0x4A67, 0x6B6A, 0x2103, 0x0000, 0x0882, 0x1944, 0x3A06,
-    0x0061, 0x08A3, 0x2964, 0x4AE9, 0x4246, 0x31C5, 0x0000, 0x0000,
-    0x1965, 0x2A27, 0x21A5, 0x4205, 0x1944, 0x1945, 0x10C4, 0x52A8,
-    0x6B49, 0x3228, 0x5B6D, 0x322A, 0x2188, 0x3A28, 0x8C6D, 0x2186,
-    0x6453, 0x3A6B, 0x4B4E, 0x7D16, 0x4B2E, 0x324B, 0x6C94, 0x538F,
-    0x7494, 0x6C74, 0x6C94, 0x6C74, 0x6C74, 0x6C94, 0x6C74, 0x6474,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C74, 0x6CB4, 0x42CC, 0x5BF1, 0x6CB4, 0x6494, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x74F5,
-    0x8536, 0x9DD9, 0x9DF9, 0x9DF9, 0x9DF9, 0x9DF9, 0xA5F9, 0xA5F9,
-    0x9DF9, 0x9DB8, 0x74D5, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x7CF5,
-    0x8516, 0x8516, 0x8536, 0x8536, 0x7D16, 0x8D78, 0xA61A, 0x9DF9,
-    0x8557, 0x8536, 0x8516, 0x8516, 0x9DF9, 0xA61A, 0xA619, 0xA619,
-    0xA61A, 0xA61A, 0xA61A, 0xA619, 0xA61A, 0xA63A, 0xAE3A, 0xA63A,
-    0xA63A, 0xA61A, 0xA63A, 0x95B8, 0x7D16, 0x6CB4, 0x74B4, 0x74B5,
-    0x6453, 0x6453, 0x74B5, 0x74D5, 0x7CF5, 0x7CF5, 0x74F5, 0x74F5,
-    0x74F5, 0x74D5, 0x6474, 0x6474, 0x6494, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6CB4, 0x7D16, 0x7CF5, 0x7D16, 0x6CB5, 0x6494, 0x6CB4,
-    0x74B5, 0x74F5, 0x6C94, 0x6C73, 0x6C94, 0x6C74, 0x6473, 0x6473,
-    0x6C74, 0x6C74, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C74, 0x74D5, 0x42CC, 0x1062, 0x18C4, 0x18E4,
-    0x41C7, 0x39C8, 0x41E7, 0x2986, 0x31A6, 0x41E6, 0x3187, 0x3187,
-    0x41E8, 0x31A7, 0x41C7, 0x3966, 0x3146, 0x2945, 0x2125, 0x2145,
-    0x2145, 0x1082, 0x0841, 0x0862, 0x0862, 0x0000, 0x39A5, 0x41E5,
-    0x0841, 0x39E5, 0x0000, 0x0000, 0x3164, 0x6B09, 0x4206, 0x0881,
-    0x31C5, 0x4A46, 0x10A2, 0x5B2A, 0x3A47, 0x5287, 0x41E5, 0x4A46,
-    0x0841, 0x5AC8, 0x4A66, 0x948D, 0x3206, 0x1923, 0x52E8, 0x08E3,
-    0x31A4, 0x738A, 0x1103, 0x1103, 0x42A8, 0x2144, 0x3A88, 0x0881,
-    0x0000, 0x41E5, 0x2184, 0x1103, 0x10C2, 0x29C6, 0x0882, 0x0000,
-    0x0000, 0x52A7, 0x7BEB, 0x18E3, 0x0000, 0x0000, 0x3164, 0x39C5,
-    0x0081, 0x1104, 0x3183, 0x4AC8, 0x4267, 0x3184, 0x0000, 0x0000,
-    0x29A5, 0x73CB, 0x1923, 0x62E8, 0x29E6, 0x1966, 0x1104, 0x5AC8,
-    0x52A9, 0x428A, 0x3A4A, 0x2187, 0x21A8, 0x4ACB, 0x94AE, 0x2164,
-    0x5BD1, 0x42ED, 0x4B2E, 0x74D5, 0x4B4F, 0x2A0A, 0x74B4, 0x6C94,
-    0x6C73, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6473, 0x6C74, 0x6C74,
-    0x6474, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C74, 0x74D5, 0x29C7, 0x3A69, 0x74F5, 0x6474, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6C94, 0x6494, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6474,
-    0x6473, 0x6473, 0x6473, 0x6473, 0x6453, 0x6453, 0x5C33, 0x6433,
-    0x6433, 0x6473, 0x8536, 0x8557, 0x8557, 0x8D57, 0x8537, 0x9DD8,
-    0xAE3A, 0xA619, 0xA61A, 0xA61A, 0x9DFA, 0x9DFA, 0x9DFA, 0xA619,
-    0xAE3A, 0xAE3A, 0xAE3A, 0xA63A, 0xA63A, 0xA63A, 0xA63A, 0x9E19,
-    0x95B9, 0x9DF9, 0x9E19, 0xA61A, 0x8D77, 0x8516, 0x8536, 0x8516,
-    0x8537, 0x8D57, 0x8D57, 0x8D57, 0x8577, 0x8557, 0x7CF6, 0x6453,
-    0x6C94, 0x6C74, 0x6474, 0x6474, 0x6474, 0x6474, 0x6474, 0x6474,
-    0x6474, 0x6474, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494,
-    0x6C94, 0x6494, 0x6473, 0x6473, 0x6473, 0x6494, 0x6494, 0x6CB5,
-    0x7CF6, 0x8536, 0x74B4, 0x6C74, 0x6C74, 0x6C74, 0x6C94, 0x6C94,
-    0x6C94, 0x5C12, 0x432E, 0x6CB4, 0x6C74, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x53B0, 0x0000, 0x0020, 0x0000,
-    0x0861, 0x1082, 0x10A2, 0x18E2, 0x18C2, 0x18C2, 0x18A2, 0x10C3,
-    0x18C2, 0x18C2, 0x18C2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x41E5,
-    0x10C3, 0x6329, 0x4246, 0x0020, 0x0020, 0x4A26, 0x2923, 0x4206,
-    0x10A1, 0x5287, 0x1081, 0x4A87, 0x3248, 0x31C5, 0x5267, 0x7B8A,
-    0x10A2, 0x6B29, 0x31A4, 0x3185, 0x6B29, 0x10E2, 0x52C8, 0x1104,
-    0x21A5, 0x5AA7, 0x3247, 0x10E3, 0x0020, 0x1903, 0x21C6, 0x08A2,
-    0x0000, 0x31A5, 0x29A4, 0x29C5, 0x0881, 0x29E6, 0x0000, 0x0000,
-    0x0020, 0x62E8, 0x7C0B, 0x10C2, 0x0000, 0x0000, 0x5247, 0x39A5,
-    0x1124, 0x10E3, 0x7BCA, 0x73AA, 0x7369, 0x5AA8, 0x0000, 0x0841,
-    0x5AE8, 0x52A7, 0x31A5, 0xAD2F, 0x5B09, 0x19A7, 0x42A9, 0x5287,
-    0x4A69, 0x5B4C, 0x3229, 0x42EC, 0x19A8, 0x6C10, 0x94AE, 0x636C,
-    0x6C32, 0x6C73, 0x6C73, 0x6C94, 0x6453, 0x432E, 0x6C73, 0x6C94,
-    0x74B5, 0x6C94, 0x6C93, 0x7C92, 0x6C93, 0x6494, 0x6C74, 0x6C74,
-    0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C74, 0x74D5, 0x31E8, 0x10C2, 0x6452, 0x6C94, 0x6494,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6494, 0x6494, 0x6494, 0x6474, 0x6CB4, 0x8536, 0x7D16,
-    0x7D16, 0x6C94, 0x74B4, 0x74D5, 0x74D5, 0x74D5, 0x74D5, 0x74B5,
-    0x74B4, 0x74B4, 0x6C74, 0x6453, 0x6453, 0x6453, 0x6453, 0x6453,
-    0x8516, 0x8D57, 0x8D57, 0x8D57, 0x8D57, 0x8557, 0x8D57, 0x8557,
-    0x7CF6, 0x95B8, 0xA63A, 0xA61A, 0xA619, 0xA5F9, 0x9DF9, 0xA5F9,
-    0x9598, 0x8516, 0x8537, 0x7CF5, 0x6C94, 0x6C94, 0x6494, 0x6453,
-    0x6453, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494,
-    0x6474, 0x6473, 0x6C94, 0x6C94, 0x6C74, 0x6C74, 0x6C94, 0x6C74,
-    0x6C74, 0x6473, 0x5C32, 0x6C94, 0x6C74, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C73, 0x6CB5, 0x42ED, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0020, 0x0882, 0x08A3, 0x0882, 0x0883,
-    0x10A3, 0x10C3, 0x10C4, 0x2146, 0x2146, 0x29A8, 0x2166, 0x632A,
-    0x3185, 0x2943, 0x4A67, 0x2164, 0x0040, 0x4206, 0x3164, 0x4A46,
-    0x0000, 0x2103, 0x2144, 0x1923, 0x3227, 0x2164, 0x3A27, 0x4A67,
-    0x1081, 0x5287, 0x31C5, 0x1123, 0x5AE8, 0x4226, 0x62E8, 0x1944,
-    0x08C2, 0x4225, 0x4266, 0x29A5, 0x10A2, 0x1103, 0x10A2, 0x21A5,
-    0x0020, 0x2944, 0x39E6, 0x29A5, 0x08A2, 0x2185, 0x0000, 0x0000,
-    0x2984, 0x5AA7, 0x6BAA, 0x10E3, 0x0000, 0x0000, 0x4206, 0x4227,
-    0x29E6, 0x08A2, 0x73CB, 0x8C4B, 0x7BAA, 0x4A46, 0x0000, 0x18E2,
-    0x736A, 0x2103, 0x3A06, 0x9CAC, 0x6B6A, 0x3228, 0x73CC, 0x83EA,
-    0x3207, 0x6C10, 0x4A89, 0x7C91, 0x3AEE, 0x52EA, 0x9CAE, 0x634B,
-    0x4AED, 0x74D5, 0x6C73, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C73,
-    0x5BB0, 0x6C94, 0x6C73, 0x846F, 0x6C93, 0x6C94, 0x6C94, 0x6494,
-    0x6494, 0x6CB4, 0x3A8B, 0x6412, 0x6CB4, 0x6C94, 0x6C94, 0x6C52,
-    0x6C52, 0x6474, 0x6CB5, 0x42CC, 0x0020, 0x5BF1, 0x6CB5, 0x6C74,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB4, 0x7D16, 0x7CF6,
-    0x74F6, 0x6C94, 0x6C74, 0x6C74, 0x6C94, 0x6C94, 0x6C74, 0x6C74,
-    0x6C94, 0x6453, 0x8536, 0x9DF9, 0x95D8, 0x9DD8, 0x95B8, 0x95B8,
-    0x9598, 0x9598, 0x8D78, 0x8557, 0x8557, 0x8557, 0x8536, 0x8D77,
-    0x9DD9, 0x9598, 0x9598, 0x95B8, 0xA5F9, 0x9598, 0x9DB8, 0x8516,
-    0x6C94, 0x74B4, 0x74D5, 0x74D5, 0x7CD5, 0x74F5, 0x74F5, 0x7CF6,
-    0x7D16, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6C74,
-    0x6C94, 0x6CB4, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6432, 0x2146, 0x10A3, 0x2146, 0x0882,
-    0x0041, 0x0861, 0x0000, 0x0000, 0x0020, 0x0021, 0x0020, 0x0000,
-    0x0862, 0x2125, 0x1904, 0x2166, 0x29A7, 0x29C8, 0x29C8, 0x29E9,
-    0x3209, 0x29E9, 0x29C8, 0x2187, 0x2167, 0x1905, 0x0841, 0x18A2,
-    0x4206, 0x1061, 0x2122, 0x2143, 0x1903, 0x41E5, 0x3184, 0x4226,
-    0x0041, 0x4206, 0x18E3, 0x1903, 0x4AC9, 0x1944, 0x1985, 0x4246,
-    0x10A1, 0x4A26, 0x5AE8, 0x4AA8, 0x29A5, 0x5AA8, 0x41E5, 0x5B09,
-    0x08E3, 0x1081, 0x7BAA, 0x52C8, 0x3A06, 0x1103, 0x0000, 0x2185,
-    0x08A2, 0x0020, 0x29C5, 0x2984, 0x08A2, 0x2A06, 0x0020, 0x0000,
-    0x29A5, 0x52A7, 0x6BAA, 0x1123, 0x18C2, 0x0000, 0x41E6, 0x4227,
-    0x1965, 0x2963, 0x636A, 0x4A87, 0x6B49, 0x52A7, 0x0861, 0x6308,
-    0x5AA7, 0x0020, 0x6B29, 0x8C2B, 0x6349, 0x4A87, 0x7BCB, 0x5AA7,
-    0x5AE9, 0x3208, 0x5B0A, 0x7C91, 0x326B, 0x634B, 0x94D0, 0x5AE9,
-    0x4B0D, 0x74D5, 0x6C94, 0x6C94, 0x6C94, 0x6C73, 0x6473, 0x74B3,
-    0x530C, 0x5BF1, 0x84D2, 0x8490, 0x6494, 0x6C94, 0x6C94, 0x6494,
-    0x6474, 0x74D5, 0x3249, 0x534E, 0x74D5, 0x6C74, 0x74D5, 0x534E,
-    0x4269, 0x74D5, 0x6494, 0x6C73, 0x10A2, 0x428A, 0x6CD5, 0x6C74,
-    0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473, 0x6474,
-    0x6474, 0x6474, 0x6C94, 0x6C94, 0x6C94, 0x6474, 0x6473, 0x6473,
-    0x6474, 0x6474, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473, 0x6453,
-    0x6453, 0x6474, 0x7CF6, 0x8D57, 0x8557, 0x8536, 0x8536, 0x8536,
-    0x8536, 0x8536, 0x7CF5, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6474,
-    0x6CB4, 0x8557, 0x8536, 0x8D77, 0x95B8, 0x8D77, 0x9597, 0x9598,
-    0x95B8, 0xA619, 0xA5F9, 0xA61A, 0x9DD9, 0x8536, 0x8536, 0x8536,
-    0x7D16, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x5BF1, 0x5C12, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C74, 0x7CF6, 0x3A8B, 0x0883, 0x31E8, 0x322A, 0x29C8,
-    0x2146, 0x2187, 0x18E4, 0x10C3, 0x1946, 0x2187, 0x2987, 0x2987,
-    0x29C8, 0x29C8, 0x29C8, 0x29A8, 0x29C8, 0x2167, 0x1946, 0x10E4,
-    0x0882, 0x10E4, 0x10A3, 0x0882, 0x0041, 0x0841, 0x0882, 0x0041,
-    0x632A, 0x4247, 0x6329, 0x3206, 0x4AC8, 0x6349, 0x3206, 0x4AA9,
-    0x2985, 0x636B, 0x2943, 0x10C2, 0x2A07, 0x2A07, 0x21E7, 0x31E5,
-    0x31A4, 0x52A7, 0x31A4, 0x4247, 0x2984, 0x3A06, 0x3984, 0x7BAA,
-    0x21A6, 0x0020, 0x62E8, 0x4267, 0x5AE8, 0x1103, 0x0041, 0x3227,
-    0x08A2, 0x0020, 0x3226, 0x1943, 0x1903, 0x2185, 0x10C2, 0x0000,
-    0x2184, 0x52A7, 0x6BAA, 0x1944, 0x2164, 0x1903, 0x738A, 0x39E6,
-    0x1104, 0x4A46, 0x6B8A, 0x3A26, 0x62E7, 0x842B, 0x1923, 0x7B8A,
-    0x2102, 0x39E5, 0x62E8, 0x7389, 0x946B, 0x840A, 0x9CAC, 0x4A47,
-    0x8C4E, 0x2165, 0x6BEE, 0x6C51, 0x29E8, 0x8C4D, 0x7C4F, 0x4268,
-    0x8491, 0x6C94, 0x7492, 0x7492, 0x6CB4, 0x6C31, 0x5BF0, 0x8D13,
-    0x842E, 0x3ACB, 0x94F0, 0x84D2, 0x6C94, 0x6C94, 0x6C94, 0x6C93,
-    0x7CB2, 0x6CB4, 0x5BF1, 0x3A6A, 0x74B4, 0x6C74, 0x6CB4, 0x5BD0,
-    0x18E3, 0x5BD0, 0x6CD5, 0x6C94, 0x2985, 0x2145, 0x6CB4, 0x6494,
-    0x6C94, 0x6C94, 0x6C74, 0x6494, 0x6C93, 0x6C73, 0x6C94, 0x6C94,
-    0x6C94, 0x8536, 0x8557, 0x8557, 0x8557, 0x8557, 0x8D77, 0x8536,
-    0x7CF5, 0x7CF6, 0x6C74, 0x6C94, 0x6494, 0x6C94, 0x7494, 0x6C94,
-    0x6474, 0x74F5, 0x8557, 0x8556, 0x8557, 0x8557, 0x8557, 0x8537,
-    0x8557, 0x6C94, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473,
-    0x6453, 0x6453, 0x6473, 0x6C74, 0x6C73, 0x6C74, 0x6C74, 0x6474,
-    0x6CB4, 0x7CF5, 0x74B5, 0x74D5, 0x6C94, 0x8D77, 0x95B8, 0x9598,
-    0x74B4, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6473, 0x6453, 0x6473,
-    0x6473, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB4,
-    0x3AAC, 0x3AAC, 0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x6C74, 0x6C74,
-    0x6C74, 0x6CB5, 0x6432, 0x2187, 0x29C8, 0x29E9, 0x2187, 0x21A7,
-    0x29C8, 0x21A8, 0x2187, 0x1946, 0x21A8, 0x21A7, 0x1925, 0x10A3,
-    0x1904, 0x10E4, 0x08A3, 0x0883, 0x1083, 0x08A3, 0x2187, 0x1946,
-    0x1946, 0x3A8C, 0x3ACD, 0x3ACD, 0x3ACD, 0x4B2D, 0x534E, 0x42EE,
-    0x532E, 0x6BCE, 0x5B4C, 0x42A9, 0x3268, 0x5B29, 0x3A27, 0x29E7,
-    0x29A7, 0x6BAB, 0x62C7, 0x31E6, 0x21A5, 0x32C9, 0x1985, 0x31E5,
-    0x3A26, 0x83EA, 0x4A46, 0x6329, 0x4226, 0x5287, 0x2943, 0x5B09,
-    0x1103, 0x0020, 0x4A47, 0x4226, 0x29A5, 0x29C5, 0x0020, 0x21A5,
-    0x1964, 0x0000, 0x2A06, 0x1943, 0x1103, 0x10E2, 0x10C2, 0x0000,
-    0x2164, 0x5AC7, 0x6BAA, 0x2184, 0x31C5, 0x1923, 0x9C8C, 0x31A5,
-    0x08C3, 0x4A66, 0x6B8A, 0x4AA7, 0x62E7, 0x948C, 0x6349, 0x5267,
-    0x0000, 0x6308, 0x6308, 0x6B28, 0x9CAC, 0x52C8, 0x842C, 0x4A26,
-    0x8C4D, 0x4269, 0x6C92, 0x5C32, 0x63AE, 0x9CCE, 0x8C2C, 0x4248,
-    0x742F, 0x6C94, 0x7C71, 0x8491, 0x6C94, 0x7493, 0x7CB2, 0x8CD1,
-    0x8CD2, 0x3A69, 0x846F, 0x7D15, 0x4AEC, 0x6432, 0x6CB5, 0x74B4,
-    0x9512, 0x6C73, 0x5C12, 0x10C3, 0x5BD0, 0x6CB5, 0x6473, 0x74D5,
-    0x3A29, 0x29A6, 0x74D5, 0x74F5, 0x428B, 0x2165, 0x6CD5, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x5B4C, 0x63CF, 0x6CB4, 0x6C94,
-    0x6C94, 0x74F5, 0x7D16, 0x7D15, 0x7D15, 0x7D16, 0x7D16, 0x74F5,
-    0x74F5, 0x74F5, 0x6C74, 0x6C94, 0x6494, 0x6C94, 0x7494, 0x6C94,
-    0x6474, 0x74D5, 0x7D16, 0x7D16, 0x7D16, 0x7D16, 0x7CF6, 0x7D15,
-    0x7CF5, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x6C74, 0x6C94,
-    0x6C94, 0x6474, 0x6C74, 0x6474, 0x6C94, 0x6473, 0x6453, 0x6473,
-    0x6474, 0x6474, 0x6453, 0x7CF5, 0x9598, 0x7CF5, 0x6494, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x74B5, 0x74B5, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C74, 0x74B5, 0x42AC, 0x1105, 0x29E9, 0x2167, 0x10C4, 0x10E4,
-    0x10E4, 0x10A3, 0x10C4, 0x1905, 0x1926, 0x1905, 0x10A4, 0x10A3,
-    0x0882, 0x1946, 0x322A, 0x2A0A, 0x322A, 0x3ACD, 0x4B4F, 0x4B4F,
-    0x4B4F, 0x432F, 0x430F, 0x430F, 0x3B0E, 0x430D, 0x534C, 0x3AAC,
-    0x42CC, 0x73ED, 0x5B6D, 0x5B6C, 0x2A28, 0x3206, 0x42C9, 0x31E7,
-    0x29A6, 0x634B, 0x2963, 0x3A06, 0x1103, 0x2A47, 0x1965, 0x1944,
-    0x1984, 0x6B29, 0x39E5, 0x31A4, 0x39E5, 0x5267, 0x31C5, 0x2207,
-    0x10C2, 0x10C3, 0x3164, 0x6B49, 0x2164, 0x3206, 0x0000, 0x1923,
-    0x3A87, 0x0020, 0x21A5, 0x1964, 0x1943, 0x1103, 0x1103, 0x0000,
-    0x29E6, 0x5AC7, 0x6BCA, 0x21A5, 0x4247, 0x1944, 0x8C2B, 0x5AC8,
-    0x10C2, 0x5287, 0x844C, 0x6309, 0x52A7, 0x9CAC, 0x946C, 0x18C2,
-    0x10C2, 0x6B69, 0x62E7, 0x7348, 0x9CAC, 0x6BAA, 0x634A, 0x2144,
-    0x948E, 0x4268, 0x7CB2, 0x3A89, 0x6B8B, 0xAD0E, 0x6B08, 0x4248,
-    0x530A, 0x6432, 0x84B1, 0x84D1, 0x6C94, 0x6C94, 0x8CB0, 0x8C90,
-    0x84D2, 0x5B4B, 0x4ACA, 0x7D15, 0x3208, 0x63D0, 0x74D5, 0x6C51,
-    0x742F, 0x8CF2, 0x5C11, 0x0841, 0x5BAF, 0x6CB5, 0x6C74, 0x74D5,
-    0x4B0D, 0x0840, 0x5B6E, 0x74F5, 0x42CC, 0x5B4C, 0x6C52, 0x6432,
-    0x6C94, 0x6C94, 0x6CB5, 0x536F, 0x2124, 0x6C52, 0x6C94, 0x6C94,
-    0x6C94, 0x6474, 0x6473, 0x6C51, 0x6473, 0x6474, 0x6473, 0x6494,
-    0x6C74, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6C94,
-    0x6C94, 0x6474, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473, 0x6473,
-    0x6474, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6CB4, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6473, 0x6453, 0x6453, 0x6453, 0x6C74, 0x6453,
-    0x4B90, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6453, 0x6453, 0x6453, 0x6453, 0x6453, 0x6453, 0x6453,
-    0x6C94, 0x538F, 0x10C3, 0x10C4, 0x0862, 0x0883, 0x08A3, 0x324A,
-    0x326B, 0x42ED, 0x4B4F, 0x3AEE, 0x42EE, 0x430F, 0x42EE, 0x2A2A,
-    0x4B2F, 0x430F, 0x430F, 0x430F, 0x430F, 0x430E, 0x430E, 0x3AEE,
-    0x42EE, 0x430E, 0x430E, 0x430E, 0x432F, 0x2A0A, 0x5B2A, 0x5B4B,
-    0x3249, 0x6BAC, 0x534D, 0x638D, 0x2A28, 0x29A5, 0x3247, 0x29C7,
-    0x3A28, 0x636B, 0x10C2, 0x10A2, 0x1103, 0x1985, 0x2A27, 0x08A2,
-    0x21A5, 0x5AC7, 0x1903, 0x10E2, 0x3A06, 0x4206, 0x3A26, 0x21E6,
-    0x10E2, 0x1103, 0x2943, 0x7389, 0x1964, 0x3A67, 0x10C2, 0x1103,
-    0x42E9, 0x0881, 0x1103, 0x10E3, 0x1964, 0x08C2, 0x2185, 0x0000,
-    0x2A06, 0x39E5, 0x73EB, 0x08C2, 0x2985, 0x2184, 0x840B, 0x6329,
-    0x10E3, 0x5AC8, 0x6BAA, 0x2984, 0x6B49, 0x8C2B, 0x52A7, 0x0000,
-    0x5286, 0x944B, 0x5286, 0x83EA, 0x83CA, 0x5B09, 0x536C, 0x3207,
-    0x8C2D, 0x4268, 0x6C0E, 0x31A4, 0x9C8D, 0xACCE, 0x39E5, 0x538F,
-    0x5BD0, 0x4AED, 0x7C91, 0x742F, 0x6CB4, 0x6CB3, 0x8CB0, 0x94CF,
-    0x9CF1, 0x840B, 0x3248, 0x7D15, 0x42CB, 0x3208, 0x7D16, 0x6C30,
-    0x63CE, 0x846F, 0x6C93, 0x3208, 0x538F, 0x6CD6, 0x4B6F, 0x5BD1,
-    0x7CF5, 0x3207, 0x18E3, 0x6C93, 0x6C73, 0x63AE, 0x532C, 0x6411,
-    0x6CB4, 0x6C94, 0x74D5, 0x29A6, 0x0841, 0x6412, 0x6CB4, 0x6C94,
-    0x6C94, 0x6CD5, 0x4B2E, 0x3A6A, 0x6CD5, 0x6C94, 0x6CB4, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C73,
-    0x6C73, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6C74, 0x6C94,
-    0x6C94, 0x6494, 0x6494, 0x6494, 0x6494, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C74, 0x6C94, 0x5BF2, 0x4B90, 0x5390, 0x4B90, 0x5BF1, 0x6C74,
-    0x6433, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6453, 0x53B0, 0x53B1, 0x53B1, 0x53B1, 0x53D1, 0x4B90, 0x32CE,
-    0x3AEE, 0x2A2A, 0x0041, 0x3A6C, 0x430E, 0x430E, 0x430F, 0x432F,
-    0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x21A8,
-    0x3AAD, 0x430F, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42ED,
-    0x430F, 0x430E, 0x42EE, 0x430E, 0x430E, 0x42EE, 0x21A7, 0x73CC,
-    0x532B, 0x42EB, 0x4ACB, 0x4AAA, 0x3207, 0x0881, 0x29E6, 0x1125,
-    0x4268, 0x52A8, 0x08A2, 0x08A2, 0x0882, 0x1103, 0x3247, 0x0881,
-    0x0040, 0x62E8, 0x31A4, 0x10A2, 0x4A47, 0x1923, 0x29C6, 0x2A07,
-    0x1964, 0x08C2, 0x3164, 0x7389, 0x2184, 0x2164, 0x1923, 0x0020,
-    0x3A88, 0x0881, 0x1103, 0x21A5, 0x1944, 0x08A2, 0x2185, 0x0000,
-    0x29C5, 0x39C5, 0x6BCB, 0x10E2, 0x2964, 0x2184, 0x8C0B, 0x5AE8,
-    0x29A5, 0x738A, 0x52C7, 0x4246, 0x4A86, 0x840B, 0x52E8, 0x0000,
-    0x6308, 0x944B, 0x5287, 0xA4AC, 0x7368, 0x5B4A, 0x3269, 0x3A28,
-    0x846F, 0x530A, 0x2A27, 0x6349, 0xAD0E, 0x942C, 0x4269, 0x6C94,
-    0x6411, 0x4ACB, 0x73EE, 0x534C, 0x7515, 0x84B1, 0x7471, 0x8CB0,
-    0xA511, 0x840C, 0x42AA, 0x7D16, 0x6C52, 0x29A6, 0x6C31, 0x7451,
-    0x538D, 0x636A, 0x74D4, 0x5BF0, 0x740F, 0x74D3, 0x6432, 0x4B2D,
-    0x7D15, 0x534D, 0x2124, 0x6C93, 0x6CB4, 0x4AA9, 0x63AE, 0x6C94,
-    0x6C74, 0x6CB4, 0x6C73, 0x2124, 0x31E8, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x7516, 0x29E8, 0x29C7, 0x74F5, 0x6494, 0x6C94, 0x6C94,
-    0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB4, 0x6BEE,
-    0x3A28, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6494, 0x6CB4, 0x5C11, 0x326A, 0x6C94, 0x6C94, 0x6C94,
-    0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB5, 0x53B0, 0x430D,
-    0x6CD5, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6CB4, 0x74D5, 0x74D5, 0x74D5, 0x7CF5, 0x74B5, 0x74B5, 0x6C94,
-    0x6C74, 0x6432, 0x5390, 0x6474, 0x6C94, 0x6CB4, 0x6C94, 0x6474,
-    0x6453, 0x53D1, 0x432F, 0x3AEE, 0x3AEE, 0x3ACE, 0x432F, 0x29C9,
-    0x324B, 0x4330, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACC, 0x4AE9,
-    0x3A8A, 0x42ED, 0x4B2E, 0x432E, 0x430E, 0x430E, 0x326B, 0x29C8,
-    0x52E9, 0x2A28, 0x5B09, 0x21A5, 0x10E3, 0x1082, 0x2A07, 0x0040,
-    0x4247, 0x1081, 0x0000, 0x0881, 0x10E3, 0x0000, 0x2A07, 0x08A2,
-    0x0000, 0x3184, 0x4A47, 0x0000, 0x2964, 0x1924, 0x10E3, 0x2A27,
-    0x21E6, 0x2123, 0x41E5, 0x6308, 0x08A1, 0x1964, 0x1123, 0x08A2,
-    0x2185, 0x1944, 0x0041, 0x21C6, 0x1964, 0x10E2, 0x1964, 0x0000,
-    0x3206, 0x39C4, 0x634A, 0x0061, 0x39C5, 0x3A05, 0x942B, 0x5AE8,
-    0x21A5, 0x6B6A, 0x39C5, 0x5287, 0x2963, 0x7C0B, 0x3A47, 0x2964,
-    0x5AE7, 0x942A, 0x4A66, 0x8C4B, 0x7BC9, 0x73EC, 0x19A6, 0x4AEB,
-    0x5B8E, 0x5B4B, 0x532A, 0x840B, 0x5246, 0x7B69, 0x636C, 0x6452,
-    0x6410, 0x5B6D, 0x94CF, 0x5B4B, 0x538F, 0x8CD1, 0x742F, 0x84B1,
-    0x94D1, 0x946E, 0x29C6, 0x6432, 0x74B4, 0x1903, 0x4AA9, 0x7CB2,
-    0x534D, 0x6B6A, 0x74F4, 0x53AF, 0x632A, 0x9512, 0x8535, 0x428A,
-    0x4AEB, 0x7CD3, 0x532C, 0x74B3, 0x7494, 0x52C9, 0x6C10, 0x6CB4,
-    0x6C74, 0x6C94, 0x4B0D, 0x0000, 0x4B0D, 0x6CD5, 0x6473, 0x6C94,
-    0x6C94, 0x74B4, 0x29A6, 0x534E, 0x6CD5, 0x6474, 0x6C94, 0x6452,
-    0x6C73, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB4, 0x4289,
-    0x3A49, 0x74D5, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x2A09, 0x53B0, 0x6CB5, 0x6C94,
-    0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6473, 0x6CD5, 0x3A6A, 0x3A8B,
-    0x74F5, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6CB4, 0x6C94, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6473,
-    0x6453, 0x53F2, 0x4B70, 0x4B90, 0x4B90, 0x3ACE, 0x430F, 0x53B1,
-    0x4B90, 0x4B70, 0x4B90, 0x4B70, 0x4B70, 0x4B90, 0x53B1, 0x53B1,
-    0x53B1, 0x432F, 0x3ACE, 0x3ACE, 0x3ACD, 0x3AEE, 0x42EE, 0x1946,
-    0x326B, 0x430C, 0x42CB, 0x430B, 0x430B, 0x5B8D, 0x4B2D, 0x430D,
-    0x326A, 0x3A8A, 0x29A6, 0x3A8A, 0x430E, 0x430E, 0x4B2F, 0x29C8,
-    0x1925, 0x2A08, 0x3A88, 0x3248, 0x0041, 0x0000, 0x0881, 0x0882,
-    0x1923, 0x08A1, 0x08A2, 0x1103, 0x1103, 0x0020, 0x1903, 0x0020,
-    0x0000, 0x0861, 0x4206, 0x0861, 0x0020, 0x2144, 0x10C2, 0x1964,
-    0x3267, 0x1944, 0x2164, 0x4A87, 0x0000, 0x10E2, 0x29A5, 0x10C2,
-    0x08C2, 0x2165, 0x0000, 0x1123, 0x2A06, 0x21C5, 0x21C5, 0x10C2,
-    0x4AE9, 0x39E5, 0x52C8, 0x0881, 0x4A26, 0x3A05, 0x840B, 0x6329,
-    0x3A26, 0x7BCA, 0x2164, 0x5AC8, 0x5266, 0x94AC, 0x1964, 0x52A8,
-    0x7BEA, 0x8C2A, 0x52A7, 0x842B, 0x7369, 0x63CC, 0x21C6, 0x4AAA,
-    0x3A27, 0x1124, 0x6369, 0xACED, 0x3A06, 0x634A, 0x4289, 0x53D0,
-    0x3228, 0x530B, 0x94F0, 0x42A8, 0x29E8, 0x6BEE, 0x63AD, 0x84F4,
-    0x9D10, 0x94CF, 0x4A46, 0x53B0, 0x8556, 0x5B0A, 0x4A88, 0x5BAE,
-    0x4B0D, 0x738A, 0x7CD3, 0x6C73, 0x42CA, 0x9D12, 0x8D34, 0x6C51,
-    0x5B0A, 0x7493, 0x7C70, 0x7451, 0x74D5, 0x4AEB, 0x536D, 0x6CB4,
-    0x6CB4, 0x42EC, 0x42AA, 0x31E7, 0x6C73, 0x6C94, 0x6C94, 0x6474,
-    0x6CB5, 0x53AF, 0x10C2, 0x6C73, 0x6CB4, 0x6C94, 0x638D, 0x5B4C,
-    0x6C93, 0x6494, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6CB5, 0x5BD0, 0x0000,
-    0x42CB, 0x74F5, 0x6C74, 0x6C94, 0x6C94, 0x6494, 0x6494, 0x6C94,
-    0x6C94, 0x6C94, 0x6C74, 0x74D5, 0x4B0D, 0x53B0, 0x6CD5, 0x6C73,
-    0x4B0D, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x10C3, 0x42CC,
-    0x74D5, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x5C12,
-    0x4B70, 0x4B70, 0x4B50, 0x4B70, 0x4B70, 0x53B1, 0x53D1, 0x53B1,
-    0x53B1, 0x5390, 0x4B90, 0x4B90, 0x4B90, 0x4B90, 0x4BB1, 0x53B1,
-    0x53B1, 0x53B1, 0x53B1, 0x53B1, 0x6412, 0x430F, 0x3AEE, 0x3AAD,
-    0x42EE, 0x42AA, 0x3A89, 0x42EA, 0x4B2B, 0x3A89, 0x3AAC, 0x3AEE,
-    0x430E, 0x3ACD, 0x3A8C, 0x3ACD, 0x430E, 0x430E, 0x432F, 0x328C,
-    0x322A, 0x326B, 0x2A09, 0x3AAA, 0x29E7, 0x0021, 0x10E3, 0x31E6,
-    0x3206, 0x530A, 0x4288, 0x3247, 0x21A5, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x4226, 0x18C2, 0x0000, 0x10E3, 0x1964, 0x1964,
-    0x3247, 0x1943, 0x2984, 0x4AA7, 0x0040, 0x0000, 0x29C5, 0x18E3,
-    0x0881, 0x1964, 0x0000, 0x1944, 0x1964, 0x2185, 0x2A47, 0x1964,
-    0x42A8, 0x2943, 0x5AE9, 0x2984, 0x41E5, 0x31A5, 0x6329, 0x6329,
-    0x4A87, 0x8C4B, 0x4267, 0x5288, 0x5286, 0x948C, 0x29A5, 0x4A67,
-    0x840A, 0x7BA9, 0x6B89, 0x7389, 0x5AE7, 0x42E9, 0x19A6, 0x1904,
-    0x0020, 0x0903, 0x638A, 0x83EA, 0x4287, 0x4AE9, 0x21E8, 0x6C71,
-    0x2163, 0x3A06, 0x738B, 0x3A68, 0x31E7, 0x52EA, 0x638D, 0x7471,
-    0xAD31, 0x94D0, 0x5B2A, 0x4B4E, 0x6C51, 0x73EC, 0x52A7, 0x4B4D,
-    0x4B2D, 0x738A, 0x84F3, 0x6452, 0x532B, 0x8CF3, 0x84F3, 0x74B4,
-    0x6BCD, 0x7492, 0x73CD, 0x532C, 0x7D15, 0x5B4B, 0x63EF, 0x6C94,
-    0x74B4, 0x4B0B, 0x5B2B, 0x6C30, 0x6CB4, 0x6C94, 0x6C94, 0x6494,
-    0x6CB5, 0x4B2D, 0x0881, 0x6452, 0x6CB4, 0x7492, 0x31C5, 0x5BD0,
-    0x6CB5, 0x6494, 0x6C94, 0x6C94, 0x6494, 0x6C94, 0x6473, 0x5C11,
-    0x6CB4, 0x6494, 0x6C94, 0x6C94, 0x6494, 0x6CB5, 0x5BAF, 0x0861,
-    0x5BB0, 0x6CB5, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6494, 0x6C94,
-    0x6CB4, 0x6C94, 0x6C94, 0x74D5, 0x42ED, 0x538F, 0x74D5, 0x6C94,
-    0x10E4, 0x42EC, 0x74D5, 0x6C74, 0x6C94, 0x6CB4, 0x10C3, 0x42CC,
-    0x74D5, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6CB4, 0x6CB4, 0x6CB4, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x6CB4, 0x6CB4,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x6C94, 0x6C94, 0x6C94,
-    0x6CB4, 0x6CB4, 0x6C94, 0x6C94, 0x6CB4, 0x6CB4, 0x6C94, 0x6CB4,
-    0x6CB4, 0x6CB5, 0x6CD5, 0x74B5, 0x74D5, 0x6C94, 0x6453, 0x6453,
-    0x6474, 0x6C74, 0x6473, 0x6453, 0x6453, 0x6453, 0x6453, 0x5BF2,
-    0x5C12, 0x5BF2, 0x4B50, 0x4B70, 0x5390, 0x430E, 0x3ACD, 0x3A8C,
-    0x430F, 0x3B0E, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x430E, 0x430E, 0x430E, 0x430E, 0x430E, 0x430E,
-    0x432F, 0x29C9, 0x328B, 0x21A7, 0x21C7, 0x10E4, 0x08A2, 0x10E4,
-    0x0882, 0x2186, 0x0082, 0x0061, 0x08C3, 0x08C3, 0x1903, 0x0882,
-    0x10A2, 0x0841, 0x2944, 0x39C6, 0x0000, 0x0040, 0x1103, 0x1943,
-    0x1944, 0x1903, 0x31C5, 0x3206, 0x10E2, 0x0000, 0x1924, 0x2185,
-    0x0861, 0x2185, 0x0020, 0x1984, 0x08C2, 0x1944, 0x1964, 0x1944,
-    0x52C8, 0x4205, 0x52C8, 0x2984, 0x3184, 0x2984, 0x6B69, 0x52A7,
-    0x4246, 0x8C4B, 0x42A8, 0x2984, 0x6328, 0x5B49, 0x2144, 0x4A47,
-    0x83EB, 0x6348, 0x948C, 0x31E5, 0x52C8, 0x21C5, 0x08C3, 0x1104,
-    0x1104, 0x2A06, 0x8C4C, 0x4267, 0x6349, 0x5B2A, 0x2A49, 0x4B6C,
-    0x52A8, 0x4205, 0x946C, 0x4287, 0x31C5, 0x8C8D, 0x534B, 0x538D,
-    0xA510, 0x8C4E, 0x4A87, 0x3249, 0x6C72, 0x9CCE, 0x5AC8, 0x3AEC,
-    0x4B2D, 0x39C6, 0x84F3, 0x2186, 0x4247, 0x7CF4, 0x74B3, 0x74D4,
-    0x3A69, 0x5B8E, 0x73EE, 0x530C, 0x7CF5, 0x4289, 0x63EF, 0x6C94,
-    0x74D4, 0x4289, 0x5B2B, 0x5BAF, 0x53B0, 0x6CB4, 0x6CB4, 0x6C94,
-    0x6C94, 0x5B8E, 0x5B4D, 0x6C94, 0x6CD4, 0x52C9, 0x3A49, 0x6CB4,
-    0x6474, 0x6C94, 0x6C94, 0x6C94, 0x6C74, 0x6CB4, 0x5BF1, 0x3A6B,
-    0x74D5, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x74B4, 0x3A07, 0x1081,
-    0x6C73, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x5C10,
-    0x5B8E, 0x6CB4, 0x6C73, 0x6CD5, 0x4B4E, 0x21A7, 0x6C94, 0x6C94,
-    0x18E3, 0x3A8B, 0x74D5, 0x6C74, 0x6CB4, 0x6C52, 0x4AAA, 0x6452,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x6453,
-    0x5C12, 0x53B1, 0x4B90, 0x5390, 0x4B90, 0x6453, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x5C32, 0x4B70, 0x4B90,
-    0x4B90, 0x4B90, 0x5390, 0x5390, 0x5390, 0x5390, 0x5390, 0x4B90,
-    0x5390, 0x4B90, 0x5BF2, 0x5C33, 0x53B1, 0x53D1, 0x53B1, 0x53B1,
-    0x4B90, 0x4B90, 0x4B90, 0x4B90, 0x53B0, 0x4B70, 0x3ACE, 0x3AEE,
-    0x3AEE, 0x3B0E, 0x430F, 0x430F, 0x3B0E, 0x3B0E, 0x3B0E, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3ACE, 0x3ACE, 0x3ACD, 0x3AEE, 0x3AAD, 0x1905,
-    0x3AAC, 0x3B0E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x430E, 0x2187, 0x3A8B, 0x2A09, 0x21E8, 0x10C3, 0x29C8, 0x2187,
-    0x2187, 0x29E9, 0x1925, 0x1925, 0x1966, 0x10A3, 0x29C6, 0x3A68,
-    0x2185, 0x0020, 0x0020, 0x2944, 0x0000, 0x0000, 0x1103, 0x08A2,
-    0x1943, 0x0081, 0x2984, 0x31E5, 0x10C2, 0x0000, 0x0041, 0x1964,
-    0x0000, 0x21A5, 0x0041, 0x08A2, 0x1944, 0x1944, 0x0881, 0x29C6,
-    0x4AE8, 0x4A46, 0x3A67, 0x2985, 0x1903, 0x3A68, 0x6349, 0x4205,
-    0x5266, 0x6369, 0x3289, 0x3206, 0x83EA, 0x5349, 0x10E3, 0x2964,
-    0x73AA, 0x5B08, 0x8C4C, 0x1964, 0x5B08, 0x4AE9, 0x0924, 0x2186,
-    0x0082, 0x4A87, 0x944C, 0x3A67, 0x63AB, 0x29E6, 0x1104, 0x2A48,
-    0x52E9, 0x6328, 0x6B69, 0x4AC8, 0x4288, 0x9CAD, 0x4AEA, 0x4B6C,
-    0xA4CF, 0x842D, 0x5AE8, 0x430C, 0x7492, 0x8C6E, 0x29E6, 0x3AED,
-    0x42EC, 0x29A6, 0x8D35, 0x428A, 0x2985, 0x8D35, 0x84F3, 0x84F2,
-    0x3A49, 0x534E, 0x8C90, 0x5B0A, 0x6C72, 0x4AA9, 0x63CF, 0x6C94,
-    0x6C52, 0x2986, 0x638D, 0x5B8D, 0x4B0C, 0x74F5, 0x6432, 0x6C73,
-    0x6CB4, 0x4B2D, 0x6C72, 0x6C94, 0x6CB4, 0x4A89, 0x42CC, 0x6CD5,
-    0x6494, 0x6C52, 0x6C72, 0x6C94, 0x6C74, 0x6CB4, 0x5C12, 0x3A8B,
-    0x74B5, 0x6C74, 0x6C74, 0x6C94, 0x6C74, 0x74B4, 0x2124, 0x2145,
-    0x6C93, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6CD5, 0x53B0,
-    0x10A2, 0x5BF0, 0x6CB4, 0x6CB4, 0x6C73, 0x3209, 0x6C73, 0x6C74,
-    0x1904, 0x2145, 0x6C74, 0x6C94, 0x7494, 0x29A6, 0x534D, 0x74F5,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C74,
-    0x6474, 0x6474, 0x6C94, 0x6C74, 0x6C94, 0x6CB4, 0x6CB4, 0x6CB5,
-    0x6CB5, 0x6CB4, 0x6CB4, 0x6CB4, 0x6CB5, 0x6CB4, 0x6C94, 0x6C94,
-    0x6C74, 0x6C74, 0x6C74, 0x6C94, 0x6C74, 0x6C74, 0x6C74, 0x6C74,
-    0x6C74, 0x6474, 0x6C94, 0x6432, 0x53B1, 0x53D1, 0x53B1, 0x5C13,
-    0x6C94, 0x6474, 0x6474, 0x6474, 0x6474, 0x6C74, 0x6C94, 0x6C94,
-    0x6CB4, 0x6C74, 0x5C12, 0x5C12, 0x5C12, 0x5BF2, 0x5BF2, 0x5BF2,
-    0x5C12, 0x4B70, 0x3ACE, 0x3AEE, 0x3AEE, 0x3ACE, 0x432F, 0x2187,
-    0x324A, 0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430E, 0x432E, 0x432E, 0x430D, 0x42ED, 0x42EC, 0x4B2D,
-    0x2186, 0x1946, 0x326A, 0x1105, 0x2A09, 0x2186, 0x29E9, 0x1925,
-    0x1946, 0x322A, 0x0862, 0x08A2, 0x0020, 0x0020, 0x0000, 0x0000,
-    0x0862, 0x1103, 0x1103, 0x0061, 0x18E2, 0x0000, 0x1964, 0x0881,
-    0x1944, 0x0881, 0x10C2, 0x2984, 0x0841, 0x0000, 0x0000, 0x29E6,
-    0x08A2, 0x2185, 0x10E2, 0x0881, 0x1923, 0x10E2, 0x1103, 0x10E3,
-    0x4AE9, 0x39E5, 0x1923, 0x31C5, 0x0861, 0x3A88, 0x4AA7, 0x4A46,
-    0x5286, 0x6BAA, 0x21E7, 0x29A4, 0x944B, 0x5309, 0x0882, 0x4A26,
-    0x636A, 0x5AE8, 0x4A87, 0x00A2, 0x6349, 0x6BEC, 0x19E7, 0x1144,
-    0x0860, 0x946C, 0x6308, 0x1164, 0x73CB, 0x2144, 0x0000, 0x5288,
-    0x1081, 0x73A9, 0x29E5, 0x5B29, 0x7C2C, 0x7389, 0x2123, 0x6B8A,
-    0x7BAA, 0x4206, 0x52A7, 0x3A8A, 0x3A28, 0x6329, 0x3A27, 0x430D,
-    0x430C, 0x4B0B, 0x84F4, 0x6C72, 0x31E7, 0x8CD3, 0x7C50, 0x6C0E,
-    0x4269, 0x29A6, 0x8CB0, 0x5B2A, 0x6C52, 0x530B, 0x63CF, 0x6CB5,
-    0x536E, 0x18A1, 0x73CC, 0x636C, 0x536D, 0x5390, 0x534E, 0x6CB4,
-    0x6C73, 0x6C31, 0x6C73, 0x6494, 0x6C94, 0x530B, 0x6411, 0x6C94,
-    0x6CD5, 0x5BEF, 0x5BCF, 0x6CB5, 0x6C74, 0x6C74, 0x6CB4, 0x3AAB,
-    0x5BD0, 0x6CB5, 0x6C94, 0x6C74, 0x6C74, 0x74D5, 0x29C7, 0x42CB,
-    0x74F5, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x74B4,
-    0x2986, 0x3229, 0x7516, 0x6C94, 0x6C93, 0x3A6A, 0x6C73, 0x6C73,
-    0x18E3, 0x18C3, 0x6C73, 0x6CB5, 0x6411, 0x29C7, 0x74B4, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6473, 0x5C12, 0x6432, 0x6433, 0x6433, 0x6433, 0x6433,
-    0x6433, 0x6433, 0x6433, 0x6453, 0x6433, 0x6433, 0x6432, 0x5C32,
-    0x6453, 0x53B1, 0x53B1, 0x6473, 0x4B70, 0x4B2F, 0x4B50, 0x4B50,
-    0x4B50, 0x4B50, 0x4B4F, 0x430E, 0x3ACE, 0x3ACE, 0x3ACE, 0x430F,
-    0x4B70, 0x4B50, 0x4B50, 0x4B50, 0x4B4F, 0x4B4F, 0x434F, 0x4B4F,
-    0x4B4F, 0x432F, 0x3AEE, 0x3AEE, 0x3ACE, 0x3ACD, 0x3ACE, 0x3ACE,
-    0x3ACD, 0x4B4F, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x430F, 0x2A2A,
-    0x2167, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x430D, 0x4288, 0x3A47, 0x3A47, 0x3A47, 0x4B0A, 0x3207, 0x42A9,
-    0x1965, 0x2A4A, 0x42ED, 0x1925, 0x2A09, 0x29E8, 0x322A, 0x1946,
-    0x1926, 0x29E9, 0x10C3, 0x1904, 0x10E4, 0x08A2, 0x10E3, 0x2186,
-    0x1985, 0x1964, 0x2184, 0x1923, 0x4226, 0x0881, 0x0020, 0x0020,
-    0x0040, 0x0000, 0x0000, 0x0840, 0x0000, 0x0000, 0x0000, 0x1923,
-    0x10C2, 0x08A2, 0x29A5, 0x0881, 0x1103, 0x1103, 0x08A2, 0x0000,
-    0x31E6, 0x39E5, 0x4268, 0x29A5, 0x0881, 0x3289, 0x4AA7, 0x5AE8,
-    0x5286, 0x6349, 0x0903, 0x4267, 0x83EA, 0x4266, 0x0020, 0x3A26,
-    0x52E8, 0x738A, 0x2984, 0x31A5, 0x946C, 0x29A5, 0x21E7, 0x08E3,
-    0x1103, 0x8C4C, 0x7BEB, 0x21C5, 0x73AA, 0x3185, 0x10A2, 0x52C8,
-    0x10A2, 0x52C8, 0x29E5, 0x29A5, 0xA52F, 0x7369, 0x2942, 0x6B68,
-    0x6B49, 0x39C5, 0x52A7, 0x2A28, 0x4248, 0x83CA, 0x3A27, 0x2A08,
-    0x42CA, 0x5AE9, 0x7C92, 0x74D5, 0x3AAB, 0x534D, 0x6C0F, 0x5BCF,
-    0x3A49, 0x4A67, 0x8C8F, 0x52C9, 0x6411, 0x6C10, 0x42CA, 0x6C93,
-    0x3229, 0x41E5, 0x7C91, 0x5BAF, 0x5B8D, 0x4AEC, 0x536F, 0x74D5,
-    0x6C74, 0x532C, 0x6C52, 0x6474, 0x6CB4, 0x530B, 0x6432, 0x74D5,
-    0x6432, 0x42EC, 0x6C93, 0x6C94, 0x6C94, 0x6C74, 0x74F5, 0x3A6A,
-    0x31E8, 0x6452, 0x430D, 0x6C94, 0x6C74, 0x74B4, 0x5B6D, 0x4B0D,
-    0x74D5, 0x6C94, 0x6C94, 0x6C94, 0x6CB4, 0x6C94, 0x6C73, 0x74F5,
-    0x3A29, 0x2124, 0x6C74, 0x6CB4, 0x6C94, 0x3209, 0x6432, 0x6C94,
-    0x42AB, 0x1903, 0x6C73, 0x6CB5, 0x5BD0, 0x324A, 0x74D5, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6433, 0x53D1, 0x5BF2, 0x5BF2, 0x432F, 0x3AEE, 0x430E,
-    0x3AEE, 0x3AEE, 0x3B0E, 0x5BD1, 0x5390, 0x53D1, 0x5C12, 0x5BF2,
-    0x432F, 0x432F, 0x430F, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x3AEE,
-    0x3ACE, 0x3ACE, 0x3ACE, 0x42EE, 0x3AEE, 0x42EE, 0x42EE, 0x3AEE,
-    0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE,
-    0x3ACE, 0x3AEE, 0x42EE, 0x3AEE, 0x430F, 0x5BD1, 0x430F, 0x3AEE,
-    0x3AEE, 0x5390, 0x430F, 0x3ACE, 0x3AEE, 0x3AEE, 0x430E, 0x328C,
-    0x1105, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x42ED, 0x2A0A, 0x29E9, 0x21C8, 0x29E9, 0x3ACD, 0x3ACD, 0x42ED,
-    0x2187, 0x3AED, 0x2A0A, 0x2A09, 0x29E9, 0x326B, 0x21C8, 0x2A09,
-    0x1946, 0x2187, 0x10C3, 0x0000, 0x10C3, 0x2185, 0x2A07, 0x2A47,
-    0x2A47, 0x3267, 0x1963, 0x1902, 0x39E5, 0x18E2, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0040, 0x0881, 0x0861, 0x0000, 0x1123,
-    0x08C2, 0x0041, 0x2144, 0x08A2, 0x1903, 0x1103, 0x10C2, 0x0000,
-    0x29C6, 0x4247, 0x3A06, 0x2185, 0x1924, 0x3288, 0x4AA8, 0x62E8,
-    0x52A7, 0x4288, 0x1984, 0x6389, 0x5B28, 0x3268, 0x1985, 0x3A47,
-    0x6329, 0x62E8, 0x0041, 0x39A4, 0x946C, 0x1103, 0x1965, 0x21A5,
-    0x2A48, 0x6369, 0x844C, 0x2A27, 0x5AE8, 0x0840, 0x8C2B, 0x3A26,
-    0x2123, 0x6369, 0x21C5, 0x08E3, 0x9CEF, 0x73CA, 0x4247, 0x29A4,
-    0x4A67, 0x2103, 0x7369, 0x3207, 0x5B2A, 0x9C6B, 0x4267, 0x1144,
-    0x3248, 0x31E6, 0x538E, 0x6CB5, 0x538E, 0x5B6D, 0x6C0F, 0x5BAE,
-    0x63EF, 0x4AA9, 0x83CB, 0x5AC8, 0x6411, 0x63EF, 0x4ACA, 0x6452,
-    0x52C9, 0x8C6C, 0x6410, 0x7450, 0x5B2A, 0x534D, 0x7494, 0x6C94,
-    0x6C72, 0x530C, 0x6452, 0x6494, 0x63F0, 0x73EE, 0x5BF0, 0x6473,
-    0x53D0, 0x5BAF, 0x6CB4, 0x6C74, 0x6C94, 0x6C94, 0x74D5, 0x42AB,
-    0x18C2, 0x63EF, 0x4B2D, 0x6CB5, 0x6C94, 0x6C94, 0x532C, 0x6C93,
-    0x6C94, 0x6C94, 0x6C94, 0x6C94, 0x6410, 0x6C73, 0x6C94, 0x6CB4,
-    0x6431, 0x1082, 0x5BAF, 0x74D5, 0x6C74, 0x29A7, 0x6411, 0x6CB5,
-    0x536E, 0x2124, 0x6C73, 0x6CB4, 0x5BD0, 0x3229, 0x74B4, 0x6C93,
-    0x6C94, 0x6C94, 0x74B5, 0x536E, 0x5BD0, 0x6CB5, 0x6C94, 0x6C94,
-    0x6C94, 0x6C94, 0x74D5, 0x7CF5, 0x7D15, 0x74F5, 0x74D5, 0x74D5,
-    0x74D5, 0x6CB5, 0x74D5, 0x6432, 0x53D1, 0x6453, 0x7D16, 0x74B5,
-    0x6C74, 0x5BF2, 0x5391, 0x3AEE, 0x3ACE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x42EE, 0x42EE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3ACD, 0x3ACD, 0x3ACD, 0x3ACE, 0x430E, 0x432F, 0x430E, 0x3AEE,
-    0x3AEE, 0x3ACD, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x2A2B,
-    0x1126, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430F, 0x432F, 0x432F, 0x430F, 0x3AEE, 0x430E, 0x3A8B,
-    0x29E9, 0x432E, 0x326B, 0x29E9, 0x2A2A, 0x3AAC, 0x2166, 0x42CC,
-    0x1946, 0x2187, 0x10C3, 0x1904, 0x10A3, 0x10C3, 0x10E4, 0x10E4,
-    0x1104, 0x08C2, 0x08C3, 0x0000, 0x31C5, 0x0020, 0x0000, 0x0020,
-    0x0020, 0x0000, 0x0000, 0x1923, 0x21A5, 0x1965, 0x0020, 0x0020,
-    0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x08A2, 0x0861, 0x0000,
-    0x3267, 0x52E9, 0x2943, 0x08A2, 0x1924, 0x32A9, 0x4AA8, 0x5AE8,
-    0x39E5, 0x2A06, 0x1103, 0x7BA9, 0x52E8, 0x2A47, 0x5B2A, 0x42A8,
-    0x6B69, 0x39C5, 0x0841, 0x39E6, 0x52C8, 0x1103, 0x0040, 0x532A,
-    0x1985, 0x7BEB, 0x6308, 0x0924, 0x634A, 0x0000, 0x8C0A, 0x3A46,
-    0x6B6A, 0x6349, 0x2A67, 0x0903, 0x6B29, 0x7C4D, 0x6B8B, 0x2184,
-    0x3A48, 0x2143, 0x83EB, 0x2164, 0x738B, 0xA4CD, 0x4267, 0x19A6,
-    0x3289, 0x4AA7, 0x536D, 0x6452, 0x6431, 0x52E9, 0x636B, 0x29E6,
-    0x5BAF, 0x534C, 0x8BEB, 0x5AC8, 0x6BF0, 0x6C10, 0x532B, 0x6410,
-    0x6B4A, 0x8C4C, 0x6410, 0x532B, 0x73AB, 0x7472, 0x6C94, 0x6452,
-    0x6B6B, 0x5B0A, 0x6432, 0x6C94, 0x63CF, 0x73EC, 0x42EC, 0x4B6E,
-    0x5C10, 0x6C72, 0x6C92, 0x6C94, 0x6C73, 0x6C74, 0x6C74, 0x6C10,
-    0x10A2, 0x4B0C, 0x5B8F, 0x538F, 0x74D5, 0x7493, 0x42AA, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x6452, 0x6410, 0x6C72, 0x6C51, 0x6C72,
-    0x6C73, 0x530C, 0x29C7, 0x6C73, 0x6C73, 0x29C7, 0x6432, 0x6CB5,
-    0x536E, 0x39E6, 0x6C73, 0x6CB4, 0x5BAF, 0x3209, 0x74B4, 0x6C94,
-    0x6C94, 0x6C94, 0x6C94, 0x5B0A, 0x6C30, 0x6C94, 0x6C74, 0x6C94,
-    0x6CB4, 0x6C94, 0x5C12, 0x4B70, 0x4B70, 0x4B90, 0x4B90, 0x4B70,
-    0x4B70, 0x4B50, 0x4B50, 0x4B50, 0x4B50, 0x4B4F, 0x432F, 0x3AEE,
-    0x3B0E, 0x432F, 0x430E, 0x432F, 0x434F, 0x4BF1, 0x4BD0, 0x43B0,
-    0x53F1, 0x4B90, 0x3AAD, 0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x430F,
-    0x4B4F, 0x4B4F, 0x4B4F, 0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430F, 0x19A8,
-    0x29E9, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x2187,
-    0x324B, 0x430E, 0x326B, 0x2187, 0x42CD, 0x3A8C, 0x10E4, 0x2187,
-    0x21A8, 0x10E4, 0x2146, 0x29C7, 0x0882, 0x1905, 0x2A09, 0x29C8,
-    0x29A8, 0x1105, 0x29E8, 0x10A3, 0x2985, 0x10E3, 0x10C3, 0x1104,
-    0x1904, 0x21C6, 0x29E6, 0x21C6, 0x1103, 0x08A3, 0x10C3, 0x0000,
-    0x0000, 0x0040, 0x10E3, 0x10A2, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x2A47, 0x4226, 0x39C5, 0x0000, 0x0861, 0x19A5, 0x4AC8, 0x5287,
-    0x0000, 0x2A07, 0x0061, 0x4A66, 0x29C5, 0x42C9, 0x4226, 0x31E5,
-    0x6B69, 0x2103, 0x0861, 0x4246, 0x4A67, 0x0882, 0x2123, 0x4AC8,
-    0x1923, 0x8C2B, 0x2103, 0x2984, 0x5AE8, 0x3184, 0x6B69, 0x3247,
-    0x94AD, 0x29C5, 0x32A8, 0x1964, 0x5A86, 0x7C2C, 0x5B2A, 0x18C2,
-    0x2984, 0x4AA7, 0x8C4C, 0x0861, 0x10A1, 0x7B69, 0x3A05, 0x42C9,
-    0x42AA, 0x10A2, 0x7C4D, 0x7C91, 0x534D, 0x39E5, 0x52A7, 0x29E6,
-    0x4B0C, 0x532D, 0x738A, 0x62E8, 0x738A, 0x4B0B, 0x2984, 0x52C9,
-    0x6B6B, 0x7C0C, 0x5C10, 0x29A6, 0x5AE9, 0x6C51, 0x6CB4, 0x42ED,
-    0x532B, 0x5B2B, 0x5C11, 0x324A, 0x3A6A, 0x5B2B, 0x42CB, 0x4B8F,
-    0x4B4E, 0x74D3, 0x740D, 0x638C, 0x5BAE, 0x6CB4, 0x5BAF, 0x6410,
-    0x2186, 0x42AA, 0x4AEC, 0x4B0D, 0x7D36, 0x4B0C, 0x4AEC, 0x74D5,
-    0x6C93, 0x6411, 0x6C94, 0x5BAE, 0x5BCE, 0x6C50, 0x6C71, 0x6C73,
-    0x6431, 0x74B4, 0x29C8, 0x4B2E, 0x74D5, 0x42CB, 0x4B4E, 0x74D5,
-    0x5BD0, 0x2165, 0x6432, 0x74F5, 0x4B0C, 0x534D, 0x6C94, 0x6432,
-    0x6C93, 0x6C94, 0x7451, 0x52C8, 0x6C51, 0x6C94, 0x6C94, 0x6453,
-    0x4B70, 0x5C12, 0x53B0, 0x4B90, 0x5BF1, 0x53D1, 0x53B1, 0x5BD1,
-    0x4B4F, 0x53B1, 0x53B1, 0x53B1, 0x53B1, 0x53B1, 0x53B1, 0x53B1,
-    0x5BF2, 0x6C94, 0x6C74, 0x6C74, 0x6C74, 0x6473, 0x6453, 0x5C53,
-    0x5412, 0x53F2, 0x53D1, 0x53D1, 0x53D1, 0x53B1, 0x53B1, 0x430E,
-    0x3AEE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x3ACE, 0x432F,
-    0x4B90, 0x4B90, 0x5391, 0x4B4F, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x3AAD, 0x2188,
-    0x3ACD, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430F, 0x2A2A, 0x29E9,
-    0x430E, 0x42EE, 0x1105, 0x320A, 0x42EE, 0x29C8, 0x1946, 0x1946,
-    0x3AAC, 0x1945, 0x322A, 0x1946, 0x0882, 0x1905, 0x29E9, 0x21C8,
-    0x2166, 0x0021, 0x08A3, 0x1925, 0x2145, 0x0862, 0x1925, 0x1904,
-    0x0020, 0x0041, 0x08A2, 0x10E3, 0x10C3, 0x10C3, 0x0000, 0x0000,
-    0x0000, 0x0841, 0x1944, 0x10E3, 0x0000, 0x0041, 0x0020, 0x0000,
-    0x2A27, 0x2144, 0x2103, 0x0881, 0x0020, 0x10E3, 0x29A5, 0x10C2,
-    0x10E3, 0x1944, 0x2963, 0x5AC8, 0x1103, 0x638B, 0x4205, 0x3A06,
-    0x31A5, 0x0882, 0x2103, 0x52A7, 0x39E5, 0x0881, 0x3A06, 0x1924,
-    0x31A5, 0x7BEB, 0x0000, 0x4205, 0x31E5, 0x5AE8, 0x52E8, 0x2227,
-    0x94AD, 0x42A7, 0x4AE8, 0x6329, 0x5A87, 0x5B09, 0x736A, 0x18C2,
-    0x2123, 0x3184, 0x83EB, 0x1081, 0x39C5, 0x5AC7, 0x3A06, 0x4AC9,
-    0x2144, 0x18E2, 0x52E9, 0x8C70, 0x31E6, 0x52C8, 0x52C8, 0x29C6,
-    0x29C6, 0x29E7, 0x4267, 0x946C, 0x7348, 0x2185, 0x4268, 0x83EB,
-    0x6309, 0x6BED, 0x3269, 0x4A88, 0x5B0A, 0x6431, 0x53B0, 0x10E4,
-    0x73EE, 0x52C9, 0x5BF1, 0x534D, 0x5BAF, 0x52A8, 0x4B0C, 0x5BCF,
-    0x5BD0, 0x7CD3, 0x6BAC, 0x4AEA, 0x6C52, 0x4B2E, 0x42CB, 0x6C93,
-    0x530B, 0x63CF, 0x4AEC, 0x534E, 0x8556, 0x3A8B, 0x4B4E, 0x74F6,
-    0x63F0, 0x3A69, 0x6CB4, 0x63EE, 0x63CE, 0x6431, 0x744F, 0x6C94,
-    0x6C31, 0x74D4, 0x5B8F, 0x3A8B, 0x7D16, 0x534E, 0x42AB, 0x74F5,
-    0x74D4, 0x42AB, 0x6432, 0x6C93, 0x3A29, 0x6410, 0x4B0D, 0x4B2D,
-    0x6C94, 0x74B4, 0x532B, 0x31C5, 0x6431, 0x74D5, 0x6C94, 0x6C94,
-    0x6C74, 0x6C94, 0x74B5, 0x74D5, 0x74F5, 0x4B90, 0x434F, 0x5BF1,
-    0x430E, 0x430E, 0x432F, 0x432F, 0x432F, 0x432F, 0x432F, 0x432F,
-    0x432F, 0x430E, 0x430F, 0x430F, 0x430E, 0x430E, 0x430E, 0x430E,
-    0x430F, 0x432F, 0x432F, 0x432F, 0x432F, 0x432F, 0x430F, 0x3ACE,
-    0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x3AEE, 0x3ACE,
-    0x3ACD, 0x3ACE, 0x3ACE, 0x3ACE, 0x42EE, 0x3AEE, 0x3AEE, 0x42EE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3ACD, 0x3ACD,
-    0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x1946, 0x3A8C,
-    0x430E, 0x430E, 0x10C3, 0x29C8, 0x322A, 0x2166, 0x2186, 0x29C8,
-    0x430E, 0x29E9, 0x324B, 0x2187, 0x2187, 0x10E4, 0x29C8, 0x29C8,
-    0x1946, 0x10A3, 0x3229, 0x0882, 0x1925, 0x08A3, 0x3209, 0x2166,
-    0x10C3, 0x10E4, 0x10A3, 0x10A3, 0x0882, 0x10E4, 0x0861, 0x0882,
-    0x0000, 0x0000, 0x0000, 0x10A2, 0x10C3, 0x0000, 0x0020, 0x0000,
-    0x08A2, 0x21E7, 0x10E3, 0x1965, 0x2144, 0x2164, 0x10E3, 0x1103,
-    0x1924, 0x0882, 0x3184, 0x52E8, 0x1903, 0x5309, 0x3A06, 0x4267,
-    0x18E2, 0x2185, 0x3206, 0x5AE8, 0x18E2, 0x31E6, 0x3206, 0x1124,
-    0x2165, 0x4288, 0x1103, 0x5AA7, 0x3A66, 0x39E5, 0x4226, 0x42C8,
-    0x7BEB, 0x3A47, 0x4AA8, 0x52A7, 0x62E8, 0x4A66, 0x8C0B, 0x3184,
-    0x4205, 0x41E5, 0x6B28, 0x2943, 0x2123, 0x5AC7, 0x39C5, 0x4247,
-    0x18C2, 0x6349, 0x1124, 0x738B, 0x4A66, 0x4247, 0x4288, 0x3206,
-    0x3227, 0x1124, 0x4267, 0x944C, 0x7BAA, 0x21C6, 0x3A68, 0x7BAA,
-    0x4A67, 0x7C2D, 0x1103, 0x4B0B, 0x4247, 0x6C52, 0x42CC, 0x2165,
-    0x52EB, 0x3A48, 0x5C11, 0x42EC, 0x6C52, 0x4A67, 0x534D, 0x530B,
-    0x6C72, 0x7C70, 0x73CD, 0x6411, 0x6411, 0x29E8, 0x5BD0, 0x74B3,
-    0x4AEB, 0x5B8F, 0x7450, 0x4ACA, 0x74F5, 0x3A8B, 0x4B2D, 0x7D16,
-    0x42CC, 0x538F, 0x7C92, 0x6BCD, 0x6C73, 0x63CE, 0x7C4E, 0x6C94,
-    0x6BEE, 0x7472, 0x5B6E, 0x2986, 0x74D5, 0x534E, 0x3A28, 0x6C73,
-    0x6453, 0x428A, 0x6C52, 0x6C72, 0x2164, 0x63F0, 0x31E7, 0x6C31,
-    0x6474, 0x6C31, 0x4A46, 0x532D, 0x6C73, 0x53B1, 0x4B4F, 0x4B50,
-    0x4B50, 0x4B50, 0x4B4F, 0x434F, 0x432F, 0x3AEE, 0x432F, 0x4B90,
-    0x3AEE, 0x53D2, 0x6433, 0x5C13, 0x6433, 0x430E, 0x3AEE, 0x3AEE,
-    0x3ACE, 0x432F, 0x6433, 0x6433, 0x432F, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x4B70,
-    0x4B70, 0x4B70, 0x4B70, 0x4B70, 0x4B70, 0x42EE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE, 0x42EE,
-    0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x430E, 0x3ACD, 0x324B,
-    0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACD, 0x3A8C, 0x430E,
-    0x430F, 0x326B, 0x10E4, 0x3AAC, 0x326B, 0x29E8, 0x2187, 0x3A8B,
-    0x430E, 0x324B, 0x1946, 0x2187, 0x29C8, 0x0883, 0x29E9, 0x29C8,
-    0x2187, 0x0882, 0x18E4, 0x10A3, 0x10E4, 0x10E4, 0x29E9, 0x10C4,
-    0x10E4, 0x1925, 0x0041, 0x0020, 0x08A3, 0x2186, 0x10C3, 0x1904,
-    0x0000, 0x0841, 0x0000, 0x08A2, 0x10C3, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x29E7, 0x1965, 0x1144, 0x31C5, 0x29A5, 0x1103, 0x1924,
-    0x0040, 0x0881, 0x4A67, 0x31C5, 0x2143, 0x4A88, 0x1923, 0x31A5,
-    0x18E2, 0x2184, 0x4AC8, 0x4AA8, 0x2184, 0x4267, 0x31C5, 0x08C3,
-    0x10C2, 0x4246, 0x1903, 0x39C5, 0x42C8, 0x840B, 0x1080, 0x83EB,
-    0x5AA7, 0x08A2, 0x6B49, 0x6B29, 0x5A87, 0x5AE8, 0x6B29, 0x2964,
-    0x4A66, 0x4A66, 0x7348, 0x3163, 0x08A1, 0x5287, 0x20E2, 0x2964,
-    0x1081, 0x5AC8, 0x08E3, 0x5286, 0x8C0A, 0x4288, 0x5B09, 0x6308,
-    0x3A47, 0x19A5, 0x4AA8, 0x62A7, 0x7BCA, 0x1944, 0x20E2, 0x5AA8,
-    0x2944, 0x842D, 0x10E3, 0x328A, 0x6B4A, 0x52C9, 0x3229, 0x4AEB,
-    0x4ACA, 0x52C8, 0x3AAB, 0x10E4, 0x42CB, 0x73AB, 0x1902, 0x536E,
-    0x6C93, 0x5B4B, 0x638D, 0x7471, 0x4269, 0x538F, 0x6410, 0x742F,
-    0x6BAE, 0x5BAF, 0x7C71, 0x3A07, 0x7CF5, 0x3A6A, 0x4B2D, 0x74F5,
-    0x42AC, 0x5BD1, 0x6C0E, 0x4B0B, 0x74D5, 0x4ACA, 0x740E, 0x6C94,
-    0x5B8E, 0x538F, 0x7C50, 0x4A48, 0x5BD0, 0x326B, 0x29A6, 0x432E,
-    0x432E, 0x29C7, 0x4B2D, 0x5390, 0x3207, 0x4AEB, 0x1925, 0x42ED,
-    0x4B70, 0x42CB, 0x428A, 0x4B70, 0x432F, 0x3AEE, 0x42EE, 0x53B1,
-    0x53B1, 0x430F, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x3ACE, 0x3ACE,
-    0x3AEE, 0x4B70, 0x432F, 0x430F, 0x430F, 0x42EE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x430E, 0x430E, 0x42EE, 0x3AEE, 0x42EE, 0x3AEE,
-    0x430E, 0x3ACD, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x53B1,
-    0x53B1, 0x53B1, 0x53B0, 0x53B1, 0x5390, 0x42EE, 0x3AEE, 0x42EE,
-    0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x3AEE, 0x3ACD, 0x3ACE,
-    0x3ACE, 0x3ACD, 0x3ACD, 0x3ACE, 0x3ACD, 0x430E, 0x29E9, 0x1926,
-    0x4B4F, 0x430F, 0x432F, 0x432F, 0x432F, 0x430E, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x3AEE,
-    0x430E, 0x3ACD, 0x2146, 0x42EE, 0x29E9, 0x29C8, 0x3A8C, 0x2A0A,
-    0x430E, 0x2A2A, 0x1966, 0x29E9, 0x29C8, 0x1105, 0x322A, 0x29C8,
-    0x21A7, 0x0841, 0x0000, 0x10A3, 0x1905, 0x1925, 0x322A, 0x2166,
-    0x1925, 0x1946, 0x10E4, 0x0861, 0x0882, 0x29C8, 0x10A3, 0x10C3,
-    0x0000, 0x0861, 0x0020, 0x10C3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x10C2, 0x1924, 0x1924, 0x10C2, 0x31E5, 0x1103, 0x2165,
-    0x0861, 0x2164, 0x31C5, 0x1944, 0x2964, 0x2964, 0x10A2, 0x10A2,
-    0x39E6, 0x2184, 0x3206, 0x3A26, 0x31C5, 0x18E2, 0x29E6, 0x0000,
-    0x31E5, 0x42C8, 0x10E3, 0x0861, 0x2A47, 0x6349, 0x1080, 0x6B49,
-    0x31A4, 0x4267, 0x9C8C, 0x83AA, 0x7349, 0x5287, 0x4A26, 0x3184,
-    0x39C4, 0x4A46, 0x5AC7, 0x2102, 0x10C2, 0x4A67, 0x2103, 0x2123,
-    0x1081, 0x5287, 0x2A48, 0x5AC7, 0xA48B, 0x31E6, 0x636A, 0x6308,
-    0x4205, 0x0000, 0x3226, 0x41E5, 0x52C8, 0x08E3, 0x39E5, 0x3184,
-    0x10E2, 0x73AB, 0x0840, 0x0861, 0x5AE9, 0x31A5, 0x08A2, 0x3A68,
-    0x2123, 0x6B49, 0x31C5, 0x0000, 0x42CC, 0x740D, 0x2144, 0x5BF1,
-    0x6C93, 0x5B4C, 0x42EB, 0x532B, 0x3229, 0x3A69, 0x4B0B, 0x6C50,
-    0x63AE, 0x5B6C, 0x638D, 0x3208, 0x6C73, 0x2965, 0x4AEC, 0x74D5,
-    0x4B2D, 0x53D0, 0x638C, 0x4B0B, 0x6432, 0x5B6C, 0x6BED, 0x4BD1,
-    0x4B4E, 0x5B8E, 0x6BEF, 0x31C6, 0x324A, 0x326B, 0x2986, 0x4B2E,
-    0x4B2F, 0x29C8, 0x3AAC, 0x42CD, 0x3A07, 0x4227, 0x29E9, 0x3ACE,
-    0x3AAD, 0x4289, 0x42ED, 0x3AAC, 0x42AC, 0x430E, 0x430E, 0x4B4F,
-    0x432F, 0x430E, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE,
-    0x42EE, 0x3AEE, 0x3AEE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x430E,
-    0x29C8, 0x1946, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACE,
-    0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x42EE, 0x3AEE,
-    0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x3ACE, 0x3AEE, 0x4B90, 0x53B1,
-    0x53B1, 0x53B1, 0x53B1, 0x53B1, 0x53B1, 0x5BF1, 0x4B6F, 0x5B90,
-    0x6432, 0x5390, 0x53B1, 0x53B1, 0x53D1, 0x4B70, 0x3ACE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE,
-    0x42EE, 0x42EE, 0x1946, 0x42ED, 0x328C, 0x21A8, 0x430F, 0x322A,
-    0x324B, 0x4B4F, 0x29E9, 0x324A, 0x29E9, 0x2A09, 0x2A09, 0x2167,
-    0x2187, 0x1905, 0x1904, 0x1946, 0x10E4, 0x1946, 0x324B, 0x1946,
-    0x10E4, 0x2167, 0x1925, 0x08A2, 0x10A3, 0x21A7, 0x10C3, 0x10C3,
-    0x0000, 0x0000, 0x0000, 0x10E4, 0x0000, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x2165, 0x1924, 0x1944, 0x0882, 0x2984, 0x29A5, 0x1944,
-    0x1903, 0x29A5, 0x31A5, 0x2A07, 0x2144, 0x1903, 0x1103, 0x10C3,
-    0x31E6, 0x2164, 0x0020, 0x5287, 0x1923, 0x10C2, 0x1103, 0x39C5,
-    0x2185, 0x2207, 0x08C3, 0x5246, 0x3A46, 0x1964, 0x2984, 0x4226,
-    0x1144, 0x5309, 0x5AA7, 0x4A46, 0xA4CD, 0x39C5, 0x52A7, 0x4226,
-    0x1923, 0x5AC7, 0x29E5, 0x1186, 0x2984, 0x5AE9, 0x0841, 0x2144,
-    0x1061, 0x5287, 0x21A5, 0x3A05, 0x83C9, 0x1102, 0x4AE9, 0x62E8,
-    0x41E5, 0x0061, 0x2A27, 0x5286, 0x6B49, 0x08A2, 0x2103, 0x0040,
-    0x1985, 0x6BAB, 0x0841, 0x18E2, 0x83EB, 0x1924, 0x0020, 0x5B09,
-    0x2984, 0x7369, 0x4226, 0x0000, 0x534E, 0x52E9, 0x4269, 0x6C93,
-    0x6C30, 0x634A, 0x4B4D, 0x636B, 0x5B8E, 0x3248, 0x532C, 0x6430,
-    0x4B6F, 0x4267, 0x5B09, 0x5B2B, 0x53B0, 0x29A5, 0x7430, 0x42ED,
-    0x4B4E, 0x6452, 0x636A, 0x4289, 0x5BF1, 0x530A, 0x7C4F, 0x5C33,
-    0x53B1, 0x4268, 0x538E, 0x2166, 0x29E8, 0x3A6B, 0x2966, 0x430E,
-    0x4B2F, 0x29C8, 0x42CD, 0x3A8C, 0x2944, 0x4A47, 0x324A, 0x3ACE,
-    0x532C, 0x52EA, 0x3ACC, 0x2186, 0x3A49, 0x430E, 0x42EE, 0x42EE,
-    0x430E, 0x430E, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x29C7,
-    0x0840, 0x322A, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE,
-    0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACD, 0x432F,
-    0x4B70, 0x4B50, 0x53B1, 0x6C74, 0x6C74, 0x6474, 0x74D5, 0x74F5,
-    0x6C94, 0x6453, 0x6473, 0x6453, 0x6473, 0x6433, 0x4B70, 0x53B1,
-    0x430E, 0x3ACE, 0x3ACE, 0x3AEE, 0x3ACE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x2188, 0x3AAD, 0x42EE, 0x3A8C, 0x3AEE, 0x326C,
-    0x328C, 0x434F, 0x29E9, 0x29E8, 0x1925, 0x320A, 0x3AAD, 0x29E9,
-    0x2167, 0x21A8, 0x2146, 0x2166, 0x08A3, 0x1105, 0x324B, 0x10E4,
-    0x1925, 0x29A8, 0x2187, 0x2146, 0x29C8, 0x1946, 0x10E4, 0x1904,
-    0x0000, 0x0000, 0x0000, 0x10E4, 0x0000, 0x0020, 0x10E3, 0x0041,
-    0x0000, 0x0000, 0x0020, 0x10E3, 0x0061, 0x0040, 0x2984, 0x1103,
-    0x2185, 0x2164, 0x4247, 0x29C6, 0x2143, 0x2144, 0x0882, 0x2123,
-    0x3A27, 0x08A2, 0x31A4, 0x4A87, 0x1944, 0x0061, 0x52A7, 0x41E5,
-    0x08C3, 0x2A69, 0x00A2, 0x2944, 0x4287, 0x4AE9, 0x536B, 0x52E8,
-    0x3248, 0x6349, 0x6307, 0x4A87, 0x62E8, 0x52A7, 0x6B49, 0x29A5,
-    0x1944, 0x7369, 0x2964, 0x08A2, 0x2123, 0x5267, 0x0000, 0x2144,
-    0x1081, 0x62A7, 0x0881, 0x4287, 0x83E9, 0x11A5, 0x4AE9, 0x5AA7,
-    0x5266, 0x0861, 0x2206, 0x6B08, 0x7389, 0x1103, 0x2984, 0x0881,
-    0x2A27, 0x4287, 0x0841, 0x3184, 0x4AA8, 0x2185, 0x0040, 0x5AE8,
-    0x39E5, 0x3A68, 0x29E6, 0x0000, 0x3A8B, 0x4226, 0x3A68, 0x6C94,
-    0x6BCD, 0x6B69, 0x5BF0, 0x844D, 0x4AEA, 0x4288, 0x5BAE, 0x6431,
-    0x534D, 0x39E5, 0x5B09, 0x3207, 0x3ACC, 0x4AA9, 0x7C90, 0x3208,
-    0x430D, 0x6C72, 0x73AA, 0x3A48, 0x5BB0, 0x2144, 0x7470, 0x53AE,
-    0x5BAF, 0x4289, 0x5B8E, 0x29A7, 0x29A7, 0x3A6B, 0x2966, 0x4B4E,
-    0x4B4F, 0x29E8, 0x42ED, 0x3A8C, 0x29C6, 0x2144, 0x3A6B, 0x3ACD,
-    0x5B6C, 0x52EA, 0x324B, 0x3A6A, 0x42AA, 0x42CC, 0x42ED, 0x3ACE,
-    0x63D0, 0x4B4F, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EF, 0x430E,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x3A6B, 0x0000,
-    0x21A7, 0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430E, 0x53B1, 0x53D1, 0x53B1, 0x53D1, 0x53D1, 0x53D1,
-    0x53B1, 0x53B1, 0x53D1, 0x53D1, 0x53D1, 0x53B1, 0x4B90, 0x4B90,
-    0x3B0E, 0x32AD, 0x432F, 0x53B1, 0x53B1, 0x53B1, 0x432F, 0x3AAD,
-    0x3AEE, 0x42EE, 0x3AEE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430F, 0x324B, 0x2A0A, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430F, 0x322A, 0x2186, 0x1945, 0x2A0A, 0x3ACE, 0x322A,
-    0x21A8, 0x1905, 0x2167, 0x3A4B, 0x0882, 0x1946, 0x322A, 0x0862,
-    0x10E4, 0x21A8, 0x2167, 0x1946, 0x29C8, 0x1946, 0x10E4, 0x1904,
-    0x0000, 0x0862, 0x0021, 0x1905, 0x0000, 0x0020, 0x1924, 0x0861,
-    0x0020, 0x0000, 0x0861, 0x0000, 0x0000, 0x0881, 0x31A5, 0x1944,
-    0x2185, 0x10C2, 0x29C5, 0x1103, 0x1903, 0x2123, 0x0020, 0x3184,
-    0x31C5, 0x10A1, 0x73AA, 0x08A2, 0x0861, 0x6308, 0x4A26, 0x0000,
-    0x21A6, 0x1A07, 0x10E2, 0x31E5, 0x5B4B, 0x2184, 0x1185, 0x3A47,
-    0x3A47, 0x7BAA, 0x31C5, 0x638A, 0x6B49, 0x6308, 0x62C7, 0x1903,
-    0x1944, 0x4A67, 0x0020, 0x08A2, 0x0861, 0x4A26, 0x1124, 0x2165,
-    0x0040, 0x4226, 0x0000, 0x5B28, 0x944A, 0x0944, 0x5B4A, 0x18E2,
-    0x41E5, 0x18E2, 0x19A5, 0x62E8, 0x8BEA, 0x10E2, 0x2984, 0x0861,
-    0x3289, 0x31E6, 0x39A4, 0x6B29, 0x5B08, 0x29E6, 0x1903, 0x5B09,
-    0x31C5, 0x2164, 0x2164, 0x2964, 0x2186, 0x10A1, 0x3A69, 0x6CB4,
-    0x52EB, 0x738A, 0x5C10, 0x844D, 0x52C8, 0x534D, 0x6431, 0x5BCF,
-    0x4247, 0x18C2, 0x3A06, 0x73AB, 0x0061, 0x4206, 0x6B49, 0x0041,
-    0x4B6F, 0x6C51, 0x8C4C, 0x4ACA, 0x432E, 0x530B, 0x7471, 0x4A67,
-    0x846E, 0x636B, 0x31E6, 0x3A4A, 0x2145, 0x324A, 0x2986, 0x740E,
-    0x742F, 0x29E9, 0x42ED, 0x42AA, 0x4ACA, 0x29A7, 0x42AC, 0x3AEE,
-    0x63AD, 0x4289, 0x21C8, 0x3A6A, 0x4AC9, 0x3ACC, 0x42EE, 0x42EE,
-    0x536F, 0x322A, 0x430E, 0x3AEE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x3AAD, 0x328C,
-    0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x10C2, 0x2145,
-    0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430E, 0x432F, 0x432F, 0x432F, 0x432F, 0x432F, 0x42EE,
-    0x3ACD, 0x3ACE, 0x3ACE, 0x3ACD, 0x42EE, 0x5390, 0x5390, 0x4B90,
-    0x53B1, 0x53B1, 0x53B1, 0x432F, 0x432F, 0x432F, 0x430F, 0x42EE,
-    0x430E, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x29E9, 0x10C4, 0x21A8, 0x430E, 0x2A2A, 0x29E9,
-    0x3ACD, 0x2187, 0x21A8, 0x3A8C, 0x2187, 0x322A, 0x29C8, 0x2166,
-    0x2167, 0x29A7, 0x2167, 0x1946, 0x29E9, 0x1926, 0x10E4, 0x10E4,
-    0x0000, 0x0882, 0x10E4, 0x2187, 0x10A3, 0x10A3, 0x29C7, 0x0041,
-    0x10A2, 0x0882, 0x08A2, 0x1924, 0x0020, 0x0861, 0x2123, 0x31E6,
-    0x1965, 0x10E3, 0x29A5, 0x0061, 0x2964, 0x2164, 0x0882, 0x4247,
-    0x18E2, 0x52A7, 0x39E5, 0x0020, 0x4205, 0x62E8, 0x0000, 0x08A2,
-    0x19C6, 0x3A67, 0x8C4C, 0x52A8, 0x1144, 0x0000, 0x31C4, 0x52A8,
-    0x2943, 0x5AC8, 0x29A4, 0x5B08, 0x3A05, 0x6B69, 0x5266, 0x3227,
-    0x1123, 0x10C2, 0x0000, 0x08A2, 0x2123, 0x41C4, 0x10E3, 0x52C9,
-    0x0840, 0x2984, 0x0000, 0x4A87, 0x942A, 0x0081, 0x4A67, 0x3184,
-    0x39E5, 0x4206, 0x1985, 0x4226, 0xA48C, 0x2984, 0x08A2, 0x10A2,
-    0x29C6, 0x29C5, 0x4A25, 0x6329, 0x4AA8, 0x3A67, 0x08A1, 0x4226,
-    0x29A5, 0x3206, 0x2184, 0x638B, 0x2964, 0x10C2, 0x29A5, 0x5BAF,
-    0x31E6, 0x73AB, 0x3AAA, 0x5B2A, 0x630A, 0x430C, 0x430C, 0x42AA,
-    0x2164, 0x10C2, 0x3A89, 0x7BEC, 0x0000, 0x39E5, 0x4225, 0x2187,
-    0x5C12, 0x6451, 0x5B09, 0x4AC9, 0x5B4C, 0x4B0B, 0x63EF, 0x3A06,
-    0x848E, 0x5B6C, 0x4A88, 0x532C, 0x29E8, 0x29E8, 0x2145, 0x634C,
-    0x740F, 0x21A7, 0x3AAC, 0x31C7, 0x4268, 0x3209, 0x42ED, 0x328C,
-    0x63AD, 0x2165, 0x2A4B, 0x3A49, 0x4AEB, 0x3AAD, 0x3ACD, 0x3AAC,
-    0x532E, 0x2A09, 0x430E, 0x3ACE, 0x3AEE, 0x42EE, 0x42EE, 0x430F,
-    0x3AED, 0x3AAC, 0x42EE, 0x3AEE, 0x3AEE, 0x430F, 0x324B, 0x21C9,
-    0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x326B, 0x08A2, 0x3A8C,
-    0x430F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x42EE, 0x430E, 0x3AEE, 0x430F, 0x4B70, 0x4B90, 0x4B70,
-    0x4B70, 0x4B70, 0x4B4F, 0x3AEE, 0x3ACD, 0x3ACD, 0x3ACD, 0x3ACE,
-    0x3ACE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x430E, 0x4B70, 0x4B70, 0x4B4F, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x21A8, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x430E, 0x328C, 0x1966, 0x324A, 0x21A8, 0x432F, 0x326C, 0x328C,
-    0x2A0A, 0x1925, 0x29C8, 0x324A, 0x1925, 0x322A, 0x1905, 0x29E8,
-    0x1925, 0x2146, 0x21A7, 0x21A8, 0x21A8, 0x08A3, 0x2187, 0x2166,
-    0x0000, 0x1946, 0x2167, 0x2187, 0x0883, 0x1925, 0x2145, 0x0000,
-    0x0000, 0x1103, 0x0020, 0x2165, 0x1103, 0x0020, 0x0881, 0x29A5,
-    0x1964, 0x1964, 0x29E6, 0x0040, 0x2964, 0x2164, 0x0881, 0x4A87,
-    0x31C5, 0x39C5, 0x0020, 0x18E2, 0x7BAA, 0x18C2, 0x0000, 0x1903,
-    0x5B29, 0x6308, 0x39C4, 0x0000, 0x00A2, 0x4A47, 0x6B49, 0x432A,
-    0x5BAC, 0x5267, 0x3183, 0x73A9, 0x5B29, 0x7BCA, 0x18C1, 0x21C5,
-    0x1944, 0x10A2, 0x0000, 0x0000, 0x1081, 0x39E5, 0x1923, 0x31A4,
-    0x5287, 0x0020, 0x0000, 0x1944, 0x7BEA, 0x2963, 0x39E4, 0x5AC8,
-    0x3A06, 0x5AC8, 0x3A26, 0x18E2, 0x940B, 0x3184, 0x0000, 0x31A4,
-    0x4287, 0x0881, 0x62E8, 0x7BCB, 0x0881, 0x29E6, 0x1923, 0x10E2,
-    0x3A47, 0x29A5, 0x2185, 0x3A47, 0x0861, 0x2123, 0x2984, 0x3A48,
-    0x2985, 0x7C0C, 0x31E6, 0x4AA9, 0x7BEB, 0x5B2A, 0x3A69, 0x3A27,
-    0x5B28, 0x39C4, 0x3ACA, 0x634A, 0x10C3, 0x4A88, 0x2943, 0x324A,
-    0x5C53, 0x6C72, 0x2985, 0x5B09, 0x842C, 0x42EB, 0x4B6D, 0x39E5,
-    0x8C8E, 0x4B0A, 0x6349, 0x4B0B, 0x29E8, 0x3229, 0x1904, 0x42CB,
-    0x63CE, 0x2166, 0x326B, 0x52EB, 0x3184, 0x1925, 0x42CC, 0x5B4B,
-    0x8CAF, 0x3AAC, 0x21A8, 0x42AB, 0x4AEC, 0x328C, 0x6BEF, 0x4268,
-    0x3A6A, 0x4B4F, 0x3AAD, 0x5B8E, 0x432E, 0x3AEE, 0x430E, 0x430E,
-    0x29E9, 0x326B, 0x430F, 0x3AEE, 0x3AEE, 0x430F, 0x324B, 0x29E9,
-    0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x4B2E, 0x31E7, 0x3A8B, 0x430E,
-    0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x432F, 0x3AAC, 0x324B, 0x430E,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACE, 0x3ACE, 0x3ACE,
-    0x3ACE, 0x3ACE, 0x3ACE, 0x3AEE, 0x53B1, 0x53D1, 0x53D1, 0x53B1,
-    0x53D1, 0x4B4F, 0x3AEE, 0x432F, 0x432F, 0x432F, 0x432F, 0x42EE,
-    0x3AEE, 0x430F, 0x53B1, 0x53B1, 0x4B90, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3A8C, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x430E, 0x328C, 0x2187, 0x322A, 0x21A8, 0x430E, 0x2A0A, 0x2A2A,
-    0x3A8C, 0x21C8, 0x42EE, 0x21A8, 0x1925, 0x3AAD, 0x10E4, 0x3209,
-    0x2187, 0x1904, 0x29E9, 0x21E9, 0x2188, 0x10C3, 0x29E9, 0x29E9,
-    0x0000, 0x1905, 0x1966, 0x1926, 0x10E4, 0x1905, 0x1925, 0x0000,
-    0x0000, 0x0881, 0x2185, 0x0000, 0x2185, 0x08A2, 0x0841, 0x21C6,
-    0x1985, 0x0882, 0x3268, 0x1964, 0x1902, 0x2164, 0x0881, 0x4246,
-    0x5AE8, 0x1061, 0x0000, 0x5AE9, 0x41E5, 0x0000, 0x1081, 0x7BCA,
-    0x5287, 0x0000, 0x0000, 0x4A05, 0x5B08, 0x52A8, 0x0020, 0x1986,
-    0x3A06, 0x62E8, 0x4266, 0x73C9, 0x6B69, 0x6308, 0x10A1, 0x2184,
-    0x42A9, 0x0040, 0x0000, 0x0000, 0x0000, 0x2184, 0x3A67, 0x08C2,
-    0x63AB, 0x3184, 0x0000, 0x1965, 0x6BEB, 0x39C4, 0x31C4, 0x52C7,
-    0x10A1, 0x6B29, 0x5287, 0x10A2, 0x4205, 0x3A06, 0x0020, 0x7B89,
-    0x4AA7, 0x0061, 0x4A25, 0x52C8, 0x0000, 0x1924, 0x29A5, 0x2184,
-    0x42A8, 0x2985, 0x2185, 0x29C6, 0x0840, 0x4A67, 0x4246, 0x3184,
-    0x1923, 0x8C8F, 0x3A48, 0x4288, 0x6329, 0x73CB, 0x2185, 0x3A27,
-    0x5AE8, 0x5286, 0x4B2C, 0x6B8A, 0x1903, 0x4A67, 0x10A1, 0x29C7,
-    0x5BF0, 0x6410, 0x6349, 0x3A26, 0x840B, 0x6C0C, 0x3A69, 0x3207,
-    0x94CE, 0x6B8A, 0x6329, 0x7C2E, 0x29E8, 0x3229, 0x10E4, 0x4AEC,
-    0x94AF, 0x29A6, 0x2A09, 0x3207, 0x31E7, 0x29E8, 0x63AE, 0x842C,
-    0x846F, 0x2A2A, 0x3229, 0x636B, 0x3A6A, 0x3AAB, 0x530B, 0x3A49,
-    0x3ACD, 0x3ACD, 0x5B6D, 0x6BCE, 0x3AEE, 0x430E, 0x434F, 0x21C8,
-    0x21A8, 0x434F, 0x3AEE, 0x42EE, 0x3AEE, 0x430F, 0x324B, 0x29E9,
-    0x430F, 0x3AEE, 0x3AEE, 0x3B0E, 0x4AEC, 0x31E7, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AEE, 0x432F, 0x3229, 0x29A7, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x432F, 0x432F, 0x432F, 0x432F,
-    0x432F, 0x430E, 0x3AEE, 0x53D1, 0x5BF2, 0x5BF2, 0x5BD1, 0x430E,
-    0x3AEE, 0x3AEE, 0x3ACD, 0x3ACD, 0x3ACD, 0x3AEE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AAD, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x322A, 0x21C8, 0x432F, 0x3AAD, 0x21E9,
-    0x4B2F, 0x29E9, 0x432F, 0x322A, 0x2167, 0x326B, 0x1946, 0x430E,
-    0x324B, 0x1925, 0x21A8, 0x29E9, 0x21A8, 0x10C4, 0x29E9, 0x1946,
-    0x10C4, 0x1905, 0x2187, 0x2187, 0x10C4, 0x2166, 0x1925, 0x0000,
-    0x0000, 0x0000, 0x29C6, 0x0861, 0x0000, 0x1924, 0x0000, 0x10E3,
-    0x10E3, 0x0000, 0x3A88, 0x1964, 0x2123, 0x2123, 0x0020, 0x6B69,
-    0x62E8, 0x0000, 0x0861, 0x4226, 0x0020, 0x0000, 0x7BAA, 0x5AC7,
-    0x0000, 0x0020, 0x62C8, 0x840B, 0x3A26, 0x0000, 0x0861, 0x19A6,
-    0x1081, 0x4206, 0x21A5, 0x4AC7, 0x7389, 0x5B08, 0x3A05, 0x2184,
-    0x1903, 0x10A2, 0x0020, 0x0841, 0x10A2, 0x2984, 0x3A26, 0x0061,
-    0x3A87, 0x7369, 0x0840, 0x1124, 0x5B6A, 0x7349, 0x4A46, 0x52C7,
-    0x10A1, 0x5AA7, 0x3A06, 0x21A5, 0x0882, 0x21A6, 0x18E3, 0x5287,
-    0x532A, 0x08C2, 0x4A25, 0x3184, 0x0020, 0x2185, 0x1964, 0x3A47,
-    0x4288, 0x3A06, 0x1903, 0x10E3, 0x2944, 0x4A47, 0x2144, 0x1081,
-    0x1103, 0x538C, 0x3227, 0x4AE9, 0x4A87, 0x4A67, 0x42A9, 0x3208,
-    0x5B08, 0x39C4, 0x3269, 0x6B6A, 0x18E2, 0x5287, 0x0000, 0x18C2,
-    0x4B2C, 0x3269, 0x7BCA, 0x18E2, 0x4A67, 0x842A, 0x4A65, 0x19A6,
-    0x94CE, 0x840B, 0x4246, 0x7C4E, 0x29C7, 0x29E8, 0x2187, 0x21A7,
-    0x73CC, 0x29A6, 0x29A7, 0x1904, 0x4269, 0x31E8, 0x6329, 0x73EC,
-    0x7C2E, 0x1946, 0x42CA, 0x73CB, 0x3A49, 0x5B4B, 0x29C7, 0x3A8B,
-    0x534D, 0x532C, 0x73CD, 0x6BCE, 0x3AEE, 0x430E, 0x432F, 0x2187,
-    0x324B, 0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x432F, 0x324B, 0x29E9,
-    0x432F, 0x3AEE, 0x3AEE, 0x430E, 0x4249, 0x324A, 0x430E, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x42EE, 0x324A, 0x0020, 0x2187, 0x432F, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x21C8, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3ACD, 0x3AAD, 0x3AEE, 0x3AEE, 0x432F,
-    0x324B, 0x1946, 0x432F, 0x29C9, 0x29C8, 0x3A8C, 0x1946, 0x430E,
-    0x328C, 0x2167, 0x2187, 0x29C8, 0x1966, 0x1105, 0x29E9, 0x1905,
-    0x2187, 0x2187, 0x10E4, 0x1925, 0x1905, 0x2167, 0x1925, 0x10C4,
-    0x0000, 0x0000, 0x1964, 0x0040, 0x0000, 0x08A2, 0x10C2, 0x0041,
-    0x21A5, 0x0000, 0x29C5, 0x2184, 0x2103, 0x2123, 0x0000, 0x7BCA,
-    0x2123, 0x0000, 0x31C5, 0x18E3, 0x0000, 0x5AA8, 0x5AA7, 0x0000,
-    0x0861, 0x6B49, 0x4AC8, 0x08E3, 0x08A2, 0x08A2, 0x1903, 0x1985,
-    0x31C5, 0x4A87, 0x21C6, 0x3A67, 0x7389, 0x5309, 0x2984, 0x1924,
-    0x0020, 0x0861, 0x1903, 0x0020, 0x1082, 0x0861, 0x31C5, 0x0040,
-    0x3226, 0x3A06, 0x5287, 0x21E6, 0x5349, 0x840A, 0x52A7, 0x31C5,
-    0x1081, 0x5287, 0x4A67, 0x7369, 0x2165, 0x1985, 0x39E5, 0x2123,
-    0x21C6, 0x08E3, 0x4A05, 0x2963, 0x0000, 0x1985, 0x29C5, 0x31C5,
-    0x4AA8, 0x29A5, 0x31C6, 0x1903, 0x10E2, 0x2985, 0x2143, 0x2123,
-    0x1985, 0x3227, 0x29A5, 0x3A27, 0x3A26, 0x2185, 0x4AC9, 0x1903,
-    0x4A87, 0x39E5, 0x1965, 0x6B6A, 0x2122, 0x5AC7, 0x2164, 0x18E2,
-    0x8C2B, 0x3A67, 0x6B69, 0x2143, 0x1924, 0x5AE7, 0x73A9, 0x08E4,
-    0x5AE8, 0x7C0C, 0x4288, 0xA50F, 0x3207, 0x3209, 0x21A7, 0x18E3,
-    0x73AB, 0x2186, 0x29E7, 0x08A2, 0x1924, 0x2985, 0x52C9, 0x5B4B,
-    0x7C0E, 0x21A7, 0x534C, 0x4AC9, 0x5B2B, 0x4267, 0x1967, 0x42CC,
-    0x6B8A, 0x7C0D, 0x73ED, 0x6BCE, 0x3AEE, 0x434F, 0x42ED, 0x2187,
-    0x432F, 0x3ACE, 0x5B8E, 0x534E, 0x3AEE, 0x432F, 0x326B, 0x2A0A,
-    0x432F, 0x3AEE, 0x3AEE, 0x532D, 0x3A29, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3B0E, 0x3ACD, 0x0020, 0x1925, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3B0E, 0x42EE, 0x42EE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x432F, 0x432F, 0x42EE,
-    0x3AEE, 0x3AEE, 0x2A0A, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E,
-    0x21A8, 0x3A6B, 0x430E, 0x3A8C, 0x3ACD, 0x3A6B, 0x1946, 0x432F,
-    0x3AAC, 0x21C8, 0x29E9, 0x10A3, 0x2187, 0x2187, 0x29A8, 0x0862,
-    0x21A8, 0x2188, 0x08A3, 0x1946, 0x1946, 0x1967, 0x1925, 0x326B,
-    0x0000, 0x0000, 0x21C6, 0x1965, 0x0000, 0x0020, 0x21C6, 0x0000,
-    0x2185, 0x0041, 0x10E2, 0x2185, 0x2123, 0x18E2, 0x10A1, 0x6308,
-    0x0000, 0x10C2, 0x4247, 0x0000, 0x4A47, 0x4226, 0x0000, 0x3164,
-    0x6B29, 0x4A87, 0x1103, 0x1124, 0x21C6, 0x1103, 0x0882, 0x2207,
-    0x42C9, 0x5287, 0x21A5, 0x29C5, 0x29E6, 0x08A2, 0x1985, 0x0041,
-    0x0000, 0x0000, 0x2984, 0x39C5, 0x0861, 0x0000, 0x29A5, 0x0000,
-    0x3A06, 0x0861, 0x83AA, 0x52C8, 0x3A46, 0x8C0A, 0x5287, 0x4226,
-    0x1081, 0x5AA7, 0x1923, 0x9C4C, 0x1903, 0x1985, 0x10A1, 0x5AA7,
-    0x21A5, 0x1103, 0x62E8, 0x2943, 0x10E3, 0x1944, 0x3A47, 0x29C5,
-    0x3A68, 0x2185, 0x29C6, 0x21A5, 0x0041, 0x2164, 0x4246, 0x39E5,
-    0x21A5, 0x1944, 0x18E3, 0x31E5, 0x52A7, 0x4267, 0x5B4A, 0x1944,
-    0x3205, 0x7BAA, 0x0861, 0x4226, 0x18E2, 0x83C9, 0x3184, 0x1081,
-    0x9C8B, 0x4A87, 0x4A87, 0x73AA, 0x2185, 0x2143, 0x636A, 0x0904,
-    0x5AA6, 0x6B8A, 0x4268, 0xAD2E, 0x52EA, 0x3A08, 0x29C8, 0x52EA,
-    0x842B, 0x1965, 0x29C7, 0x10A2, 0x0000, 0x3184, 0x73EC, 0x3A89,
-    0x636B, 0x21A7, 0x5B2B, 0x530A, 0x52C8, 0x1944, 0x324A, 0x29E9,
-    0x52A8, 0x4AEB, 0x7C0D, 0x740E, 0x430E, 0x3ACC, 0x1986, 0x42ED,
-    0x430E, 0x430E, 0x740E, 0x534E, 0x3AEE, 0x432F, 0x326B, 0x2187,
-    0x430E, 0x3AEE, 0x430E, 0x3A28, 0x3AAC, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x432F, 0x29E9, 0x1104, 0x42ED, 0x430E, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x432F, 0x5BF2, 0x5BF2, 0x432F,
-    0x3AEE, 0x42EE, 0x3AAD, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3A8C,
-    0x21A8, 0x42EE, 0x3ACD, 0x3AEE, 0x430E, 0x21A8, 0x21C8, 0x434F,
-    0x326B, 0x21C8, 0x3ACD, 0x10A3, 0x2187, 0x2146, 0x1925, 0x0883,
-    0x326B, 0x29C8, 0x10A3, 0x2187, 0x2167, 0x2167, 0x1925, 0x3AAD,
-    0x0000, 0x0000, 0x08C2, 0x29E7, 0x0000, 0x0861, 0x2A07, 0x0881,
-    0x0861, 0x21C6, 0x1923, 0x2144, 0x1902, 0x1944, 0x5B29, 0x4205,
-    0x0000, 0x52C9, 0x1081, 0x0861, 0x3A06, 0x0000, 0x3184, 0x6B6A,
-    0x2164, 0x08C3, 0x1965, 0x19A5, 0x21A5, 0x0881, 0x0041, 0x21E6,
-    0x21E6, 0x2164, 0x3206, 0x08A2, 0x21C6, 0x1103, 0x3289, 0x0061,
-    0x0000, 0x0020, 0x10A2, 0x39E5, 0x18E3, 0x0000, 0x0040, 0x0861,
-    0x2985, 0x0841, 0x41C4, 0x83AA, 0x4226, 0x7BAA, 0x4A66, 0x6329,
-    0x10C2, 0x6B49, 0x1103, 0x6B29, 0x5267, 0x1165, 0x10A2, 0x62E8,
-    0x2164, 0x1924, 0x39E5, 0x41E5, 0x1944, 0x08A2, 0x2164, 0x1924,
-    0x29C6, 0x2185, 0x29C6, 0x29C6, 0x1944, 0x29C5, 0x3A26, 0x1081,
-    0x2185, 0x1964, 0x0882, 0x3184, 0x5AA7, 0x4AA8, 0x5309, 0x1103,
-    0x29C5, 0xA4CD, 0x20E2, 0x39E6, 0x3183, 0x8C2A, 0x20E2, 0x0861,
-    0x5B2A, 0x29E6, 0x3A06, 0x6308, 0x62E8, 0x2143, 0x842B, 0x3A67,
-    0x6B48, 0x6B69, 0x3A27, 0xAD2E, 0x3A69, 0x1904, 0x3A07, 0x5B09,
-    0x946C, 0x39E6, 0x29C7, 0x0000, 0x0841, 0x6B29, 0x5B4B, 0x4AEB,
-    0x636B, 0x3A27, 0x5B2A, 0x73EC, 0x4A87, 0x1986, 0x430D, 0x2187,
-    0x52C9, 0x2A29, 0x5288, 0x6BAD, 0x432E, 0x2A08, 0x2186, 0x4B2F,
-    0x3AEE, 0x4B4E, 0x740F, 0x3ACD, 0x4B2E, 0x432F, 0x3ACD, 0x1925,
-    0x3ACD, 0x42EE, 0x4B0C, 0x3A28, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3ACD, 0x2145, 0x3AAC, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACE, 0x3ACE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x432F, 0x1946,
-    0x322A, 0x42EE, 0x3AEE, 0x3ACD, 0x430E, 0x29C9, 0x3ACD, 0x432F,
-    0x21A8, 0x21A8, 0x3A6C, 0x1905, 0x324B, 0x2187, 0x2146, 0x1946,
-    0x42EE, 0x320A, 0x18E4, 0x29C8, 0x29E9, 0x2167, 0x1946, 0x3A8C,
-    0x0000, 0x0000, 0x0020, 0x29C6, 0x0040, 0x0000, 0x0881, 0x1944,
-    0x0061, 0x2A07, 0x1924, 0x2123, 0x10A2, 0x2A06, 0x5B2A, 0x1081,
-    0x18E3, 0x4267, 0x0000, 0x3A47, 0x10E3, 0x2123, 0x6B8A, 0x10E2,
-    0x0000, 0x1965, 0x1985, 0x10C2, 0x1944, 0x2A68, 0x2227, 0x2A68,
-    0x1985, 0x1944, 0x3206, 0x1944, 0x29E7, 0x10E3, 0x2A68, 0x1944,
-    0x0000, 0x0040, 0x10C2, 0x10A1, 0x2985, 0x0000, 0x0882, 0x1103,
-    0x31C5, 0x2144, 0x0020, 0x6B29, 0x738A, 0x4247, 0x4A86, 0x5B08,
-    0x1164, 0x5B29, 0x21C5, 0x39E5, 0x62E8, 0x19C6, 0x10A2, 0x62C8,
-    0x2123, 0x1985, 0x18E2, 0x62A7, 0x1924, 0x0041, 0x1965, 0x3A47,
-    0x4247, 0x1945, 0x2185, 0x4246, 0x4205, 0x3A67, 0x4247, 0x1082,
-    0x2A27, 0x1123, 0x0881, 0x6329, 0x4A46, 0x1903, 0x4A67, 0x4AA7,
-    0x0903, 0x6308, 0x2943, 0x2144, 0x6B69, 0x62E8, 0x0000, 0x39C5,
-    0x3A67, 0x29A5, 0x39E5, 0x6308, 0x5AC7, 0x2963, 0x6B08, 0x6B69,
-    0x6328, 0x7369, 0x3207, 0x946D, 0x4AA9, 0x0000, 0x6328, 0x5309,
-    0x3A27, 0x10A2, 0x2A08, 0x0000, 0x1081, 0x6328, 0x08E3, 0x42AA,
-    0x5B09, 0x7BCA, 0x3AA9, 0x7C0C, 0x29A5, 0x29E8, 0x3ACD, 0x2964,
-    0x73EC, 0x3228, 0x4A66, 0x6BEE, 0x4B2E, 0x29A6, 0x2A09, 0x4B2E,
-    0x3AAC, 0x42CC, 0x6BEF, 0x3ACD, 0x7C2F, 0x538F, 0x3ACD, 0x29A7,
-    0x3ACD, 0x432E, 0x4289, 0x3209, 0x430F, 0x42EE, 0x3AEE, 0x3AEE,
-    0x430E, 0x31E8, 0x3A8C, 0x430F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x326B, 0x1925, 0x0882,
-    0x3A8C, 0x42EE, 0x3ACD, 0x42EE, 0x3A8C, 0x10E4, 0x3ACD, 0x432F,
-    0x322A, 0x2A0A, 0x29C9, 0x29E9, 0x2A0A, 0x1926, 0x29A8, 0x2167,
-    0x4B4F, 0x322A, 0x1905, 0x29E9, 0x21A8, 0x29E9, 0x324B, 0x430E,
-    0x0000, 0x0000, 0x0020, 0x2A27, 0x0061, 0x0000, 0x0000, 0x21E6,
-    0x10C2, 0x21A5, 0x2164, 0x2144, 0x0000, 0x4AA8, 0x31A5, 0x0000,
-    0x29C6, 0x08A2, 0x1903, 0x3A26, 0x08A2, 0x3227, 0x1964, 0x10C2,
-    0x0020, 0x1944, 0x0881, 0x08C2, 0x21E6, 0x2207, 0x2207, 0x1964,
-    0x1124, 0x08A2, 0x3227, 0x10C2, 0x1945, 0x21C6, 0x2207, 0x21E7,
-    0x0000, 0x0000, 0x18E3, 0x1903, 0x4A67, 0x1903, 0x0882, 0x10E3,
-    0x29A5, 0x3A27, 0x0082, 0x5AC8, 0x940A, 0x31A5, 0x5AE8, 0x2185,
-    0x2A27, 0x3A27, 0x21C5, 0x1903, 0x5AA7, 0x3A47, 0x0021, 0x39A4,
-    0x4205, 0x19A6, 0x0861, 0x4205, 0x10C2, 0x10C3, 0x21C6, 0x3A26,
-    0x2964, 0x2123, 0x52A7, 0x2984, 0x10E3, 0x1944, 0x52C8, 0x3A27,
-    0x21A6, 0x0861, 0x1903, 0x5B29, 0x4226, 0x2164, 0x2123, 0x4A67,
-    0x08E3, 0x6349, 0x3184, 0x52E9, 0x52A7, 0x10A2, 0x0841, 0x6328,
-    0x3226, 0x3A26, 0x2163, 0x632A, 0x4226, 0x5AC7, 0x41E5, 0x8C2B,
-    0x6B48, 0xA4AB, 0x4288, 0x73AB, 0x6308, 0x2943, 0x6B4A, 0x3A48,
-    0x1966, 0x0020, 0x3248, 0x10A2, 0x0841, 0x4246, 0x2184, 0x29E8,
-    0x4206, 0x6329, 0x636B, 0x4AA8, 0x10E3, 0x2A08, 0x29C8, 0x3184,
-    0x7C2D, 0x4ACA, 0x8C4C, 0x52C9, 0x42AA, 0x2165, 0x1104, 0x430D,
-    0x3A8A, 0x4AA9, 0x536F, 0x3AEE, 0x7C4F, 0x5BAF, 0x2A0A, 0x0882,
-    0x42ED, 0x534D, 0x31C6, 0x3A6B, 0x430E, 0x3A8C, 0x3ACE, 0x430F,
-    0x3A6A, 0x2A09, 0x430E, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x432F, 0x21A7, 0x0842, 0x3ACD,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x432F, 0x2A0A, 0x1946, 0x432F, 0x3AEE,
-    0x3ACD, 0x42EE, 0x1925, 0x3A6C, 0x29E9, 0x1946, 0x3A8C, 0x2167,
-    0x432F, 0x3A8C, 0x2187, 0x3A6B, 0x2A0A, 0x42ED, 0x3AAC, 0x430E,
-    0x0000, 0x0000, 0x0000, 0x2A07, 0x08A2, 0x0000, 0x10C2, 0x2A27,
-    0x1944, 0x0861, 0x3248, 0x2144, 0x0000, 0x4A87, 0x3184, 0x0861,
-    0x29C6, 0x0861, 0x4AA8, 0x10A1, 0x08C2, 0x1985, 0x1965, 0x10C2,
-    0x0000, 0x0000, 0x2165, 0x2185, 0x0061, 0x0861, 0x1924, 0x21C6,
-    0x2A27, 0x2206, 0x2A06, 0x1964, 0x2185, 0x1103, 0x21A6, 0x2A28,
-    0x0000, 0x0000, 0x2144, 0x31C5, 0x0861, 0x4247, 0x29A5, 0x10E3,
-    0x2185, 0x3206, 0x1165, 0x4AE9, 0xA48C, 0x5AE8, 0x52E8, 0x1943,
-    0x3247, 0x1923, 0x3AA8, 0x10E3, 0x5287, 0x31C5, 0x08A2, 0x41E5,
-    0x4205, 0x19A6, 0x0861, 0x4A46, 0x18E2, 0x19A6, 0x1965, 0x2985,
-    0x2164, 0x3A26, 0x4266, 0x3A06, 0x1903, 0x0061, 0x5B09, 0x39E6,
-    0x21A6, 0x0000, 0x3A47, 0x4287, 0x1923, 0x2144, 0x1903, 0x6B29,
-    0x29A5, 0x6309, 0x2123, 0x4AC8, 0x4A67, 0x0000, 0x2144, 0x31C5,
-    0x3AA8, 0x42A7, 0x31E5, 0x6B8B, 0x2964, 0x7348, 0x5AC7, 0x6B49,
-    0x7B89, 0xACEC, 0x4AC9, 0x8C8D, 0x7369, 0x8C2B, 0x2143, 0x21C7,
-    0x3227, 0x10A1, 0x6349, 0x2122, 0x0000, 0x1943, 0x5B4A, 0x10E3,
-    0x4A46, 0x52C8, 0x5AE9, 0x3A47, 0x2164, 0x21C6, 0x0040, 0x4226,
-    0x532B, 0x73CB, 0x6349, 0x31A5, 0x3A06, 0x29E6, 0x21C7, 0x4B2D,
-    0x29C7, 0x5AC8, 0x6BEF, 0x3AEE, 0x63AE, 0x536F, 0x2A0A, 0x0882,
-    0x430E, 0x52CA, 0x31A6, 0x3ACD, 0x432F, 0x1946, 0x42ED, 0x42AC,
-    0x29A7, 0x42ED, 0x430E, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3ACD, 0x2187, 0x3A8C, 0x430E,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x430F, 0x324B, 0x29E9, 0x432F, 0x3AEE,
-    0x3B0E, 0x42EE, 0x2167, 0x42EE, 0x430E, 0x29C8, 0x3A6B, 0x1967,
-    0x432F, 0x326C, 0x21C8, 0x324B, 0x29C8, 0x29C9, 0x3A8C, 0x430F,
-    0x0000, 0x0000, 0x0000, 0x1924, 0x10C2, 0x0000, 0x1103, 0x2A06,
-    0x1964, 0x0000, 0x3248, 0x1944, 0x0000, 0x5AC8, 0x2103, 0x1903,
-    0x10C2, 0x2123, 0x39E6, 0x0000, 0x1924, 0x1944, 0x1103, 0x0000,
-    0x0861, 0x10C3, 0x08A2, 0x0000, 0x0041, 0x3268, 0x2185, 0x1103,
-    0x1985, 0x19A5, 0x08A2, 0x1944, 0x21A5, 0x0861, 0x1965, 0x2A68,
-    0x08C2, 0x1965, 0x1924, 0x2944, 0x10C2, 0x3A46, 0x3A05, 0x0881,
-    0x2A27, 0x52E8, 0x2206, 0x1985, 0x6308, 0xA4AC, 0x6B49, 0x1943,
-    0x3268, 0x1923, 0x432A, 0x1103, 0x39C5, 0x5287, 0x00A2, 0x41E5,
-    0x7BAA, 0x19A6, 0x10A2, 0x41E6, 0x0861, 0x1985, 0x2A07, 0x4288,
-    0x31E5, 0x2165, 0x3A47, 0x39E5, 0x29A5, 0x10E3, 0x4205, 0x5AA7,
-    0x2165, 0x0020, 0x29E6, 0x3A26, 0x2984, 0x31A5, 0x08A2, 0x4A46,
-    0x31E5, 0x6308, 0x1081, 0x5287, 0x2123, 0x0020, 0x3A27, 0x0040,
-    0x3AA8, 0x4267, 0x2944, 0x7BEB, 0x4A26, 0x7368, 0x5AC7, 0x7349,
-    0x9C4B, 0x5AC7, 0x42E9, 0x7C0B, 0x6B68, 0x4A66, 0x29E7, 0x2A08,
-    0x4288, 0x5286, 0x7BCA, 0x2123, 0x08A2, 0x4267, 0x3206, 0x0020,
-    0x7BCB, 0x6B8A, 0x3A26, 0x1103, 0x10E3, 0x21A6, 0x08A1, 0x5B08,
-    0x42A9, 0x948C, 0x7BEA, 0x31A5, 0x39E6, 0x2144, 0x4269, 0x5B8E,
-    0x3229, 0x3A27, 0x4AEC, 0x432E, 0x6BAD, 0x538F, 0x2A0A, 0x2167,
-    0x4B4E, 0x3A07, 0x29E8, 0x432F, 0x21A7, 0x21A7, 0x4B0C, 0x31A5,
-    0x324B, 0x42EE, 0x3A8C, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3ACD, 0x1967, 0x29E9, 0x430E, 0x3ACE, 0x324B, 0x3A6C, 0x1966,
-    0x432F, 0x324B, 0x2187, 0x3ACD, 0x324B, 0x322A, 0x3ACD, 0x430E,
-    0x0000, 0x0000, 0x0000, 0x1924, 0x08C2, 0x0000, 0x1103, 0x0861,
-    0x2185, 0x0000, 0x3268, 0x1944, 0x0861, 0x4267, 0x0020, 0x4247,
-    0x2984, 0x31C5, 0x0000, 0x08A2, 0x2185, 0x0861, 0x0000, 0x0020,
-    0x2185, 0x0861, 0x0000, 0x0861, 0x2185, 0x1103, 0x0020, 0x10E3,
-    0x10E3, 0x1924, 0x1985, 0x1985, 0x1964, 0x1924, 0x0882, 0x3269,
-    0x29C6, 0x29E6, 0x2985, 0x0020, 0x1903, 0x3A47, 0x4226, 0x2144,
-    0x29A5, 0x4266, 0x1103, 0x1965, 0x2963, 0x8C2B, 0x52A7, 0x2164,
-    0x3247, 0x10C2, 0x2A06, 0x0881, 0x10E3, 0x6B29, 0x08C2, 0x39C4,
-    0x6B29, 0x21A5, 0x0861, 0x0000, 0x31A4, 0x1061, 0x10C2, 0x29A5,
-    0x4267, 0x2144, 0x2184, 0x3A47, 0x2144, 0x0000, 0x39C5, 0x7369,
-    0x2944, 0x0840, 0x29A5, 0x3A05, 0x3184, 0x6328, 0x1123, 0x4205,
-    0x6B49, 0x52C7, 0x1081, 0x62C8, 0x0000, 0x2144, 0x31E6, 0x08A2,
-    0x3A88, 0x4226, 0x1061, 0x7BCA, 0x8C0A, 0x4225, 0x6329, 0x4A45,
-    0x9C4B, 0x62C7, 0x3A47, 0x4288, 0x6327, 0x2143, 0x3A69, 0x29A6,
-    0x2123, 0x6308, 0x5AA7, 0x0020, 0x2164, 0x5B08, 0x10C2, 0x0000,
-    0x73AA, 0x52E8, 0x3A47, 0x1985, 0x1924, 0x2185, 0x10E2, 0x6349,
-    0x6BAB, 0x948C, 0x7BEB, 0x5B08, 0x530A, 0x1104, 0x4A88, 0x530B,
-    0x29C7, 0x42A9, 0x4AEC, 0x4B0E, 0x8C6E, 0x63CF, 0x2A0A, 0x21A8,
-    0x534D, 0x2965, 0x3AAD, 0x42EE, 0x10E4, 0x42ED, 0x4A89, 0x10A2,
-    0x3ACD, 0x29E9, 0x2188, 0x430F, 0x3AEE, 0x430E, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E,
-    0x3AAC, 0x10C4, 0x42EE, 0x3AEE, 0x3AEE, 0x430F, 0x326C, 0x2167,
-    0x4B2F, 0x2167, 0x2A0A, 0x430E, 0x3AEE, 0x432F, 0x42EE, 0x42EE,
-    0x0000, 0x0000, 0x0000, 0x1924, 0x08A2, 0x0040, 0x1944, 0x0000,
-    0x2185, 0x10C2, 0x10E3, 0x1944, 0x10C2, 0x1944, 0x10E2, 0x3A67,
-    0x39E5, 0x0861, 0x0000, 0x2A07, 0x08A2, 0x0000, 0x0020, 0x1944,
-    0x0041, 0x0000, 0x3206, 0x29C6, 0x0041, 0x10C2, 0x1924, 0x10E3,
-    0x0000, 0x10E3, 0x2A27, 0x0861, 0x1924, 0x2185, 0x1944, 0x3289,
-    0x0881, 0x10C2, 0x4226, 0x2103, 0x0882, 0x31E6, 0x2144, 0x3A47,
-    0x1923, 0x3A06, 0x08A2, 0x1964, 0x39C4, 0x8C4B, 0x4266, 0x39E5,
-    0x1923, 0x0000, 0x2185, 0x0000, 0x0881, 0x5AC8, 0x29A5, 0x39C5,
-    0x2123, 0x2164, 0x0881, 0x0020, 0x3184, 0x0020, 0x1944, 0x0000,
-    0x1923, 0x21C5, 0x1923, 0x29E6, 0x29A5, 0x2123, 0x10A1, 0x5A87,
-    0x2944, 0x0840, 0x31A5, 0x0861, 0x18E2, 0x4A67, 0x1944, 0x0861,
-    0x5AE8, 0x4A88, 0x2144, 0x2123, 0x0020, 0x4A88, 0x1081, 0x2144,
-    0x6328, 0x7349, 0x0861, 0x7389, 0x6307, 0x31E5, 0x3A26, 0x52A7,
-    0xAC8B, 0xACCC, 0x2123, 0x31A5, 0x5AC7, 0x2103, 0x3207, 0x31E6,
-    0x20E2, 0x5AC8, 0x41E5, 0x08A3, 0x2165, 0x52E8, 0x0881, 0x2144,
-    0x632A, 0x4AC9, 0x31E6, 0x21A6, 0x10C3, 0x10E3, 0x1123, 0x4266,
-    0x3A46, 0x31C5, 0x4247, 0x9CAC, 0x5B6A, 0x0062, 0x31A6, 0x4269,
-    0x0082, 0x636C, 0x6BCE, 0x530B, 0x7C0C, 0x4B4E, 0x322A, 0x29E9,
-    0x3A4A, 0x10C2, 0x430E, 0x3A6B, 0x1926, 0x430E, 0x4248, 0x1904,
-    0x4B4F, 0x21A8, 0x322A, 0x432F, 0x3ACD, 0x29E9, 0x2A2A, 0x430E,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x42EE,
-    0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3ACD,
-    0x1925, 0x326B, 0x430E, 0x3AEE, 0x3AEE, 0x430E, 0x326C, 0x1946,
-    0x4B2F, 0x2167, 0x3A8C, 0x430E, 0x2188, 0x3AAD, 0x430F, 0x42EE,
-    0x0000, 0x0000, 0x0000, 0x1944, 0x08C2, 0x0040, 0x1965, 0x0000,
-    0x10C2, 0x21C6, 0x1944, 0x1944, 0x1924, 0x1944, 0x3A47, 0x4AC8,
-    0x18E3, 0x0000, 0x2164, 0x2164, 0x0000, 0x0000, 0x2185, 0x08A2,
-    0x0040, 0x2185, 0x2144, 0x0020, 0x1081, 0x10A2, 0x0020, 0x0040,
-    0x0041, 0x2A07, 0x1944, 0x0020, 0x2185, 0x2164, 0x21C5, 0x3AA9,
-    0x10C2, 0x1903, 0x31C5, 0x4A88, 0x0861, 0x1923, 0x0061, 0x42C9,
-    0x31E6, 0x29A5, 0x0000, 0x2165, 0x4A87, 0x6B69, 0x4266, 0x7BCA,
-    0x2164, 0x1103, 0x2185, 0x0040, 0x0000, 0x4226, 0x2943, 0x4246,
-    0x31A4, 0x2164, 0x0840, 0x1081, 0x2103, 0x0000, 0x2184, 0x0841,
-    0x1103, 0x21E6, 0x21A5, 0x1965, 0x1923, 0x31A5, 0x0860, 0x5A87,
-    0x2964, 0x0861, 0x2985, 0x0000, 0x10A2, 0x4287, 0x10E2, 0x0861,
-    0x52A7, 0x10E2, 0x29A5, 0x2123, 0x0000, 0x4AC8, 0x0861, 0x1124,
-    0x52E7, 0x4A25, 0x0861, 0x4246, 0x39C4, 0x7389, 0x5AC7, 0x4A66,
-    0xACCC, 0xACCB, 0x39C4, 0x6B49, 0x6B29, 0x0840, 0x4268, 0x31E6,
-    0x2122, 0x5AC7, 0x39E5, 0x1966, 0x1903, 0x52C7, 0x0020, 0x31E7,
-    0x3207, 0x2164, 0x0040, 0x1965, 0x10C3, 0x10E3, 0x2984, 0x6B8A,
-    0x3206, 0x21A5, 0x31E5, 0x948C, 0x3A26, 0x10E3, 0x1924, 0x3208,
-    0x0082, 0x534C, 0x5B8D, 0x52E9, 0x73AC, 0x536E, 0x2165, 0x29E9,
-    0x1925, 0x10E4, 0x4B2E, 0x1946, 0x2A09, 0x536E, 0x39C6, 0x29E9,
-    0x4B2F, 0x21A8, 0x3AAD, 0x42EE, 0x2188, 0x21C8, 0x42EE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E, 0x3AAC,
-    0x21A8, 0x3AEE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AAD, 0x324B,
-    0x430E, 0x29C8, 0x3AAD, 0x3AEE, 0x1905, 0x3A8C, 0x430F, 0x42EE,
-    0x0000, 0x0000, 0x0000, 0x10C2, 0x0881, 0x0041, 0x1964, 0x0000,
-    0x0020, 0x3268, 0x19A5, 0x1985, 0x29E6, 0x1103, 0x21E6, 0x21A5,
-    0x0020, 0x0061, 0x3268, 0x0881, 0x0000, 0x1964, 0x1924, 0x0020,
-    0x1944, 0x1103, 0x0000, 0x0000, 0x2964, 0x0000, 0x0000, 0x0861,
-    0x2185, 0x10C2, 0x0861, 0x0020, 0x10A2, 0x29A5, 0x2185, 0x32A9,
-    0x1944, 0x1944, 0x1903, 0x4AA8, 0x1903, 0x10E3, 0x10C2, 0x2185,
-    0x31E6, 0x31C5, 0x0040, 0x2A27, 0x2185, 0x6329, 0x52C8, 0x840B,
-    0x2984, 0x2A07, 0x0881, 0x1104, 0x0061, 0x39A4, 0x41E5, 0x18E2,
-    0x4227, 0x2964, 0x10C2, 0x2944, 0x3184, 0x0882, 0x08C2, 0x2164,
-    0x08A2, 0x19A5, 0x2A27, 0x0861, 0x10E3, 0x2964, 0x0840, 0x4226,
-    0x4AA8, 0x0861, 0x2144, 0x0000, 0x0861, 0x29A5, 0x29A5, 0x1103,
-    0x6308, 0x41E5, 0x2143, 0x2143, 0x10A2, 0x18E3, 0x10A2, 0x29E6,
-    0x5B08, 0x3163, 0x29C5, 0x39E6, 0x3184, 0x6B08, 0x6B47, 0x52E8,
-    0x6B49, 0xBD0C, 0x83C9, 0x6329, 0x18A2, 0x0040, 0x634A, 0x31C5,
-    0x2122, 0x6B69, 0x39C5, 0x1104, 0x18E2, 0x52E8, 0x0040, 0x29C6,
-    0x2164, 0x4205, 0x1082, 0x1944, 0x10C2, 0x10E3, 0x4246, 0x6349,
-    0x29C5, 0x3207, 0x0861, 0x5B08, 0x3247, 0x1965, 0x1945, 0x0841,
-    0x0883, 0x3A6A, 0x6BAC, 0x3A69, 0x42EC, 0x636D, 0x10C3, 0x21A7,
-    0x10C3, 0x3A4A, 0x4B4F, 0x2187, 0x29E9, 0x5B0B, 0x2923, 0x324A,
-    0x324B, 0x2167, 0x42CD, 0x1946, 0x3AAC, 0x432F, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E,
-    0x432F, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x432F,
-    0x324B, 0x29C9, 0x4350, 0x324B, 0x29E9, 0x430F, 0x3AEE, 0x3AEE,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x1965, 0x0000,
-    0x0040, 0x3268, 0x1984, 0x1965, 0x08A2, 0x08A2, 0x2A27, 0x1964,
-    0x0000, 0x2185, 0x10C3, 0x0000, 0x2185, 0x1924, 0x0000, 0x1903,
-    0x0861, 0x0000, 0x0861, 0x2124, 0x0000, 0x0000, 0x2103, 0x4247,
-    0x0000, 0x18E3, 0x10A2, 0x0000, 0x0861, 0x29A5, 0x08A2, 0x3AC9,
-    0x08A2, 0x10A2, 0x1903, 0x2164, 0x1103, 0x10C2, 0x10E3, 0x1103,
-    0x4226, 0x2984, 0x1903, 0x2A07, 0x10E3, 0x5AC7, 0x4267, 0x52C7,
-    0x31A5, 0x29C6, 0x10A2, 0x08C3, 0x0082, 0x18E3, 0x6308, 0x0840,
-    0x5267, 0x29A5, 0x3207, 0x31A5, 0x3984, 0x0082, 0x2164, 0x1924,
-    0x0020, 0x21E6, 0x21E6, 0x10E3, 0x10C3, 0x31C5, 0x1081, 0x29C5,
-    0x3A47, 0x0020, 0x18E3, 0x0000, 0x0000, 0x2144, 0x10E2, 0x10C2,
-    0x2943, 0x5246, 0x18E3, 0x18E2, 0x18E3, 0x0020, 0x1903, 0x2144,
-    0x4246, 0x18C2, 0x4AA8, 0x4206, 0x2102, 0x4A46, 0x52C7, 0x52C8,
-    0x2143, 0xA48B, 0x6B49, 0x634A, 0x10A1, 0x0020, 0x6329, 0x2123,
-    0x2102, 0x7BEB, 0x10A1, 0x0862, 0x4205, 0x4245, 0x1124, 0x3249,
-    0x0841, 0x4205, 0x10A2, 0x0000, 0x0861, 0x1924, 0x31E5, 0x2984,
-    0x31E6, 0x21A6, 0x1923, 0x6B6A, 0x3267, 0x10E3, 0x10C3, 0x0000,
-    0x10E4, 0x29C7, 0x83EA, 0x4AC9, 0x430D, 0x5AE9, 0x0882, 0x2166,
-    0x0020, 0x42CD, 0x326B, 0x2146, 0x42AB, 0x4206, 0x0862, 0x42AD,
-    0x2167, 0x3209, 0x21C8, 0x324B, 0x432F, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x430E,
-    0x326B, 0x29E9, 0x430F, 0x42EE, 0x430F, 0x42EE, 0x42EE, 0x3AEE,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x1964, 0x0000,
-    0x0020, 0x3288, 0x10E2, 0x0040, 0x0000, 0x1985, 0x21A6, 0x0000,
-    0x0861, 0x2A07, 0x0000, 0x1924, 0x3247, 0x0020, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x10A1, 0x31C5, 0x0000, 0x0000, 0x2103, 0x2123,
-    0x0020, 0x29A5, 0x0000, 0x1081, 0x39C5, 0x1923, 0x3A88, 0x430A,
-    0x0882, 0x10A2, 0x1903, 0x31E6, 0x2144, 0x0000, 0x08A2, 0x1104,
-    0x4247, 0x1903, 0x0861, 0x3267, 0x0881, 0x4A25, 0x31C5, 0x52A7,
-    0x31C5, 0x10E3, 0x0881, 0x0882, 0x0041, 0x0000, 0x5267, 0x18C2,
-    0x5AA8, 0x31E6, 0x2185, 0x2943, 0x39A4, 0x0041, 0x21C5, 0x1924,
-    0x0000, 0x2A06, 0x29C6, 0x1124, 0x10E3, 0x29C5, 0x0861, 0x21A5,
-    0x42C8, 0x0841, 0x0000, 0x0000, 0x0000, 0x2984, 0x2103, 0x2943,
-    0x10A1, 0x4206, 0x0000, 0x0000, 0x0000, 0x0000, 0x1904, 0x0861,
-    0x5267, 0x1081, 0x5B28, 0x4205, 0x18A1, 0x6308, 0x4287, 0x6B8A,
-    0x1923, 0x7BC9, 0x4AE9, 0x6B8A, 0x2103, 0x0840, 0x5AE8, 0x0000,
-    0x2123, 0x73AB, 0x0881, 0x10C3, 0x5AA7, 0x6307, 0x1966, 0x29E8,
-    0x0000, 0x10A1, 0x10C2, 0x0000, 0x10C2, 0x1103, 0x1964, 0x1923,
-    0x3A48, 0x1104, 0x2123, 0x7C0B, 0x10E2, 0x0000, 0x0000, 0x0000,
-    0x10E4, 0x3208, 0x83EB, 0x4289, 0x4B2D, 0x6B29, 0x0882, 0x1945,
-    0x1905, 0x4B4F, 0x29E9, 0x1946, 0x5B4C, 0x20E2, 0x2187, 0x4B2F,
-    0x21A7, 0x2167, 0x324B, 0x432F, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE,
-    0x42EE, 0x42EE, 0x42EE, 0x42EE, 0x3AEE, 0x3AEE, 0x3AEE, 0x3AEE
-};
-
-#endif // SPRITE_BG_DELTA_H
@@ -1,7216 +0,0 @@
-// bg_sierra.png - Auto-generated sprite data
-// Generated by img2code.py
-// Size: 240x240 pixels, 115200 bytes
-
-#ifndef SPRITE_BG_SIERRA_H
-#define SPRITE_BG_SIERRA_H
-
-#include <Arduino.h>
-
-#define SPRITE_BG_SIERRA_WIDTH  240
-#define SPRITE_BG_SIERRA_HEIGHT 240
-
-const uint16_t sprite_bg_sierra[57600] PROGMEM = {
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CE, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CE, 0x31CE, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CE, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x29AD,
-    0x29AD, 0x41EE, 0x49EE, 0x41EE, 0x41EE, 0x41EE, 0x41EE, 0x41EE,
-    0x41EE, 0x39CE, 0x29AD, 0x29AD, 0x29AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x29CD, 0x31CD, 0x39CE,
-    0x39CE, 0x622F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A70, 0x522F, 0x39CD, 0x39CE, 0x39CE, 0x31CD, 0x29AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x41CD, 0x6A50,
-    0x6A50, 0x624F, 0x622F, 0x6A2F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F,
-    0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x41CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x29AD,
-    0x39CD, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x39CD, 0x29AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x4A0E, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A2F, 0x6A2F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x626F, 0x39CE, 0x29AD, 0x31CD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x29AD, 0x31AD, 0x31AD, 0x29AC, 0x4A0E, 0x5A2F,
-    0x5A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x6A4F,
-    0x6A70, 0x624F, 0x624F, 0x4A0E, 0x29AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x29AD, 0x298D, 0x41EE,
-    0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x624F, 0x6A4F, 0x624F, 0x624F,
-    0x6A4F, 0x624F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F,
-    0x6A6F, 0x624F, 0x41EE, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x29AD,
-    0x29AD, 0x39CD, 0x522E, 0x520E, 0x520E, 0x4A0E, 0x622F, 0x6A50,
-    0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x49EE, 0x49EE, 0x4A0E, 0x41CE, 0x29AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x41EE, 0x520E, 0x5A2F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x6A4F, 0x6A6F, 0x6A6F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x5A2F,
-    0x41EE, 0x41EE, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x29AD, 0x29AD,
-    0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x41EE,
-    0x41EE, 0x5A0E, 0x726F, 0x6A4F, 0x6A6F, 0x6A6F, 0x6A4F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x4A0E,
-    0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31CD, 0x41EE, 0x49EE, 0x41EE, 0x41EE, 0x41EE, 0x41EE,
-    0x49EE, 0x41EE, 0x49EE, 0x39CE, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x31CD, 0x49EE, 0x41EE, 0x41EE, 0x624F, 0x6A4F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x5A2F, 0x4A0E, 0x520E, 0x520E, 0x520E, 0x520E, 0x520E, 0x41EE,
-    0x298D, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x31CD, 0x41EE, 0x41EE,
-    0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x29AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x29AD,
-    0x31AD, 0x39CD, 0x39CE, 0x39CD, 0x39CD, 0x39CD, 0x39CD, 0x5A4F,
-    0x6A6F, 0x6A4F, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4F, 0x624F,
-    0x6A4F, 0x624F, 0x6A4F, 0x6A4F, 0x5A2F, 0x5A2F, 0x522F, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x29AD, 0x29AD, 0x31AD, 0x29AD,
-    0x31CD, 0x31AD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD,
-    0x31CD, 0x41EE, 0x624F, 0x6A50, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A50, 0x5A2F, 0x39CD, 0x39CD, 0x39CD, 0x39CD,
-    0x39CD, 0x39CD, 0x29AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x29AD, 0x31CD, 0x39CD, 0x39CD, 0x39CD, 0x39CD, 0x39CD,
-    0x39CD, 0x4A0E, 0x6A70, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x5A2F, 0x5A2F, 0x5A4F,
-    0x41ED, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x29AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x29CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x29AD, 0x31AD, 0x39CD, 0x39CD, 0x39CD, 0x4A0E, 0x6A6F, 0x6A4F,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD,
-    0x31AD, 0x5A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x49EE, 0x31AD, 0x31AD, 0x31CD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x41CD, 0x624F, 0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x6A4F, 0x520E, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x520E, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A50,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x624F, 0x622F, 0x624F, 0x624F, 0x5A2F, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x39CD, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x622F, 0x622F,
-    0x624F, 0x624F, 0x41EE, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD, 0x31CD,
-    0x31CD, 0x31AD, 0x29AD, 0x41EE, 0x626F, 0x624F, 0x624F, 0x624F,
-    0x41EE, 0x29AD, 0x31CD, 0x31CD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x522F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A50, 0x4A0E, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x29AD, 0x39CD, 0x6270, 0x624F, 0x6A6F, 0x41EE, 0x298D,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x298D, 0x41EE, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x5A2F, 0x31AD, 0x29AD, 0x31AD, 0x29AD,
-    0x39CD, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F,
-    0x5A2F, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x41CE,
-    0x624F, 0x622F, 0x622F, 0x6A4F, 0x622F, 0x6A2F, 0x622F, 0x624F,
-    0x6A4F, 0x6A4F, 0x624F, 0x49EE, 0x298D, 0x29AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD,
-    0x298D, 0x520E, 0x5A2F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x624F, 0x41EE, 0x298C, 0x29AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x29CD, 0x31AD, 0x31AD, 0x31AD, 0x5A2F, 0x6A70, 0x6A6F, 0x6A6F,
-    0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x5A2F, 0x520E, 0x522F,
-    0x5A2F, 0x5A2F, 0x5A2F, 0x49EE, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x31AD, 0x41CD, 0x6A4F, 0x726F, 0x624F, 0x5A2F,
-    0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x41EE, 0x29AD, 0x31AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x522F, 0x5A2F,
-    0x5A2F, 0x622F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A2F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x624F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F,
-    0x5A2F, 0x6A4F, 0x6A4F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x6A4F, 0x6A4F,
-    0x624F, 0x522F, 0x522F, 0x31AD, 0x298D, 0x298D, 0x298D, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x41EE, 0x622F,
-    0x624F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x622F, 0x6A4F, 0x622F, 0x520E, 0x4A0E, 0x31AD, 0x29AD,
-    0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x39CD, 0x522F,
-    0x520E, 0x624F, 0x6A70, 0x6A6F, 0x624F, 0x6A4F, 0x624F, 0x624F,
-    0x6A4F, 0x622F, 0x520E, 0x4A0E, 0x31AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x39CD, 0x49EE, 0x41EE, 0x49EE,
-    0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x7A8F, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF,
-    0x92AF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF,
-    0x92CF, 0x724F, 0x6A50, 0x520E, 0x39CD, 0x520E, 0x520E, 0x520E,
-    0x520E, 0x520E, 0x520E, 0x520E, 0x622F, 0x622F, 0x622F, 0x6A2F,
-    0x622F, 0x622F, 0x6A50, 0x6A4F, 0x5A2F, 0x520E, 0x520E, 0x520E,
-    0x4A0E, 0x520E, 0x520E, 0x520E, 0x520E, 0x520E, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A2F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x82AF, 0x92CF, 0x92CF, 0x92CF, 0x92CF,
-    0x92CF, 0x92CF, 0x7A6F, 0x5A2F, 0x6A4F, 0x92CF, 0x92CF, 0x726F,
-    0x622F, 0x6A2F, 0x622F, 0x6A4F, 0x6A4F, 0x624F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x520E, 0x4A0E, 0x520E, 0x520E, 0x4A0E,
-    0x31AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD,
-    0x29AD, 0x29AD, 0x31AD, 0x4A0E, 0x520E, 0x520E, 0x520E, 0x520E,
-    0x49EE, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x29AD, 0x31AD, 0x4A0E, 0x520E,
-    0x520E, 0x520E, 0x520E, 0x520E, 0x520E, 0x4A0E, 0x5A2F, 0x6A4F,
-    0x622F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x6A2F, 0x622F, 0x6A2F, 0x6A4F, 0x624F, 0x49EE, 0x41EE,
-    0x49EE, 0x39CE, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x39CD, 0x522F,
-    0x520E, 0x520E, 0x4A0E, 0x5A2F, 0x6A70, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x624F, 0x6A4F, 0x624F, 0x49EE, 0x41EE, 0x41EE, 0x41EE,
-    0x41EE, 0x41EE, 0x41EE, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x4A0E, 0x82AF, 0x92CF, 0x8AAF, 0x828F, 0x828F, 0x828F, 0x828F,
-    0xA2EF, 0xBB4F, 0xB32F, 0xB32F, 0xB32E, 0xB32E, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xB32E, 0xB32E, 0xB32E,
-    0xB32F, 0x92AF, 0x6A4F, 0x520F, 0x520F, 0x6230, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x6A2F, 0x9B0E, 0xA30E, 0xA30E, 0xA30E,
-    0xA30E, 0x9B0E, 0x6A2F, 0x622F, 0x620F, 0x622F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x7A8F,
-    0x82AF, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x82AF,
-    0x828F, 0x828F, 0x828F, 0xAB0F, 0xB32E, 0xB32E, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0x9ACF, 0x828F, 0x92AF, 0xB32F, 0xB32F, 0x726F,
-    0x620F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x624F, 0x624F, 0x622F, 0x624F, 0x6A4F, 0x624F, 0x6A4F, 0x6A50,
-    0x49EE, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x41EE,
-    0x49EE, 0x41EE, 0x49EE, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x622F, 0x41EE, 0x41EE, 0x49EE, 0x31CD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x39CD, 0x41EE, 0x49EE, 0x624F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x622F,
-    0x624F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F, 0x624F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x520E, 0x39AD, 0x39CD, 0x39CD, 0x31AD, 0x29AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD,
-    0x29AD, 0x29AD, 0x298D, 0x39CD, 0x5A4F, 0x5A2F, 0x5A2F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A50, 0x41EE, 0x39CD, 0x39CD, 0x39CD, 0x39CD,
-    0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x298C, 0x82CF, 0x9B0F, 0xA2EE, 0xBB2F, 0xB32F, 0xBB2F, 0xBB4F,
-    0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xB30E, 0xB30E, 0xB30E, 0xAB0F,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xB30F, 0xAB0E, 0xB30E, 0xB30E, 0xAB0E,
-    0xAB0E, 0xB32F, 0x9ACE, 0x828E, 0x8AAE, 0x828E, 0x828E, 0x828E,
-    0x828E, 0x828E, 0x828E, 0x8AAD, 0xEC2D, 0xFC6D, 0xFC4C, 0xFC4C,
-    0xFC6D, 0xF44D, 0x92CD, 0x828D, 0x8AAE, 0x724E, 0x620F, 0x622F,
-    0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x622F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F, 0x622F,
-    0x624F, 0x622F, 0x622F, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x6A4F, 0x7A6F, 0x7A6F, 0x726E, 0xA30F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xAB0E, 0xB30E, 0xAB0F, 0xB30E,
-    0xB30E, 0xB30E, 0xB32E, 0xB32F, 0xB32F, 0xB30E, 0xB32F, 0x828E,
-    0x7A6F, 0x724F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x6A2F,
-    0x6A2F, 0x6A2F, 0x622F, 0x622F, 0x622F, 0x624F, 0x622F, 0x522F,
-    0x5A2F, 0x39CD, 0x29AD, 0x31AD, 0x31AD, 0x31CD, 0x39CD, 0x622F,
-    0x6A4F, 0x6A4F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x6A4F, 0x6A4F, 0x6A4F, 0x49EE, 0x39CD, 0x39CD, 0x39CD,
-    0x39CD, 0x39CD, 0x39CD, 0x4A0E, 0x6A6F, 0x6A4F, 0x6A2F, 0x622F,
-    0x6A2F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x624F, 0x622F, 0x622F, 0x6A4F, 0x7A6F, 0x7A6F,
-    0x624F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x39CD, 0x31AD, 0x31CD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AC, 0x5A2E,
-    0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x624F, 0x6A2F, 0x6A2F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x39CD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x318D, 0x296C, 0x5A0D, 0xAB2F, 0xA30F, 0xA30F, 0xA30F,
-    0xAB0F, 0xB32E, 0xB30E, 0xAB2F, 0xB30F, 0xB32F, 0xB30E, 0xB30E,
-    0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB32E,
-    0xB32E, 0xAB0E, 0xD3AE, 0xF42E, 0xEC0E, 0xF42D, 0xF42D, 0xF42D,
-    0xF42D, 0xF42D, 0xF42D, 0xF42D, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42D, 0xFC4D, 0xBB4D, 0x6A2E, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x82AF, 0xB34F, 0xB32F, 0xB32F, 0xB32F,
-    0xB30F, 0xB30F, 0xB30F, 0xB30F, 0xB30F, 0xB30F, 0xB30F, 0xB30F,
-    0xB32F, 0xB32F, 0xB30E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB32E, 0xB30F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB34F, 0x92CF, 0x6A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A2F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A4F, 0x5A2E, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x39CD, 0x624F, 0x6A4F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x624F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A2F, 0x6A2F,
-    0x6A2F, 0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x724F, 0x6A2F, 0x8AAF, 0xB32F, 0xB32F,
-    0x622F, 0x624F, 0x624F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x624F, 0x49EE,
-    0x298D, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x298D, 0x49EE, 0x624F, 0x5A2F, 0x622F, 0x622F, 0x622F,
-    0x6A4F, 0x6A2F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x624F, 0x6A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A2F,
-    0x622F, 0x622F, 0x622F, 0x624F, 0x522E, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31CD, 0x31CD, 0x31AD, 0x31CD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x29AD, 0x31CD, 0x39CD, 0x41CD, 0x41CD, 0x39AC,
-    0x7AAE, 0xB34F, 0xAB2F, 0xAB0E, 0xAB0E, 0xB30E, 0xB30E, 0xB30E,
-    0xB32F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB2E, 0xB30E, 0xB32E,
-    0xB30E, 0xB30E, 0xB32E, 0xB32E, 0xC34D, 0xF42D, 0xF40D, 0xF42D,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xCB8E, 0x6A0E,
-    0x6A2F, 0x6A2E, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x6A4F, 0x622E, 0x8ACF, 0xAB2F, 0xAB0E, 0xB30E, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xB32E, 0xB32F,
-    0xB32F, 0xB30F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB30F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB2F, 0x828F, 0x620E,
-    0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F, 0x622F, 0x622F,
-    0x622F, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F,
-    0x6A2F, 0x6A2F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622E,
-    0x7A6E, 0xAB2F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xB30E, 0xB30E,
-    0xA30F, 0x724F, 0x622F, 0x6A4F, 0x6A2F, 0x6A2F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x6A4F, 0x622F,
-    0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F,
-    0x5A2F, 0x5A2F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x624F, 0x622F, 0x624F, 0x6A4F, 0x622F, 0x5A2F, 0x5A2F, 0x5A2F,
-    0x39CD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x298D,
-    0x31AD, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F, 0x4A0E, 0x298D,
-    0x298D, 0x29AD, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31AD,
-    0x41ED, 0x49ED, 0x622D, 0xB32F, 0xB32F, 0xB32F, 0xBB4F, 0x9AEF,
-    0x726E, 0x726F, 0x726E, 0x726F, 0x724E, 0x92AE, 0xB32F, 0xAB0E,
-    0xB30E, 0xB32E, 0xB32E, 0xAB0E, 0xB32E, 0xC34E, 0xC34E, 0xBB2D,
-    0xDBCD, 0xFC4C, 0xF42C, 0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF40D, 0xD3CD,
-    0xD3CE, 0xDBEE, 0x8ACF, 0x59EF, 0x622F, 0x624F, 0x6A4F, 0x6A2F,
-    0x6A4F, 0x622F, 0x6A4E, 0x9B0F, 0xA30F, 0x724F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x7A6F, 0xA30F, 0x9AEF,
-    0x9B0F, 0x9AEF, 0xAB0F, 0xB32F, 0xAB0F, 0xAB0F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xAB0E, 0xB32F, 0xB34F,
-    0xB32F, 0xAB0E, 0xB32F, 0xAB0F, 0xAB0E, 0xB30E, 0xB32E, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xA30F, 0x9AEF,
-    0x9AEF, 0x92EF, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A4F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F, 0x622F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x5A0F, 0x82AF, 0x9AEF,
-    0xA2EF, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0x9AEF, 0x726F, 0x622F, 0x6A4F, 0x6A4F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A2F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A2F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A4F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x622F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x5A2E, 0x4A0E, 0x520E, 0x520E, 0x4A0E, 0x520E, 0x520E, 0x4A0E,
-    0x520E, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F, 0x622F, 0x51EE,
-    0x520E, 0x31AD, 0x29AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD,
-    0x29AD, 0x298D, 0x39AD, 0x828F, 0x828F, 0x828F, 0x82AF, 0x726F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x724F, 0x92AE, 0xB32E,
-    0xB32E, 0xB32E, 0xB30E, 0xB30E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xBB4E, 0xD3AE, 0xCB8E, 0xD38D, 0xF42C, 0xFC2C, 0xFC2C, 0xFC2C,
-    0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC4C,
-    0xFC4C, 0xFC6D, 0xD3CD, 0xBB8E, 0xA32E, 0x620E, 0x622F, 0x622F,
-    0x620F, 0x724F, 0x9ACE, 0xB32F, 0xB32F, 0x9ACF, 0x92CF, 0x92CF,
-    0x92CF, 0x92AF, 0x92CF, 0x92CF, 0x8ACF, 0x9AEF, 0xB32F, 0xB32F,
-    0xB32F, 0xB32E, 0xB32F, 0xB32F, 0xAB2F, 0xAB0F, 0xB30F, 0xB30F,
-    0xB32F, 0xB32F, 0xBB4F, 0xBB4F, 0xB34F, 0xBB4F, 0x828E, 0x5A0D,
-    0x726D, 0xB34F, 0xB34F, 0xB34F, 0xB34F, 0xB32F, 0xAB0E, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB0F, 0xB32E, 0xB32E,
-    0xB32E, 0xAB2F, 0x92CF, 0x92CF, 0x92CF, 0x828F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x620F, 0x8AAF,
-    0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0x724F, 0x5A2F, 0x622F,
-    0x624F, 0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F,
-    0x622F, 0x622F, 0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x6A2F, 0x622F,
-    0x5A2F, 0x726F, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0xA30F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0x9ACF, 0x726F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x624F, 0x828F, 0x828F, 0x828F, 0x828F,
-    0x828F, 0x828F, 0x828F, 0x82AF, 0x726F, 0x622F, 0x622F, 0x624F,
-    0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A2F, 0x6A2F, 0x622F, 0x624F, 0x624F, 0x624F, 0x6A4F,
-    0x6A4F, 0x4A0E, 0x41EE, 0x39EE, 0x29AD, 0x31CD, 0x31AD, 0x29AD,
-    0x39CE, 0x49EE, 0x49EE, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x6A4F, 0x92CF,
-    0x92AE, 0xAB0E, 0xB32E, 0xB32F, 0xB32E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB32E, 0xAB2E, 0xB32E, 0xD3AE, 0xDBAD, 0xDBAD, 0xDBAD,
-    0xDBAD, 0xDBAD, 0xDBAD, 0xDBAD, 0xDBCD, 0xDBAD, 0xDBAD, 0xDBAD,
-    0xDBAD, 0xDBAD, 0xDBCD, 0xE3ED, 0xC38E, 0x828E, 0x828F, 0x828F,
-    0x7A6E, 0x92CE, 0xB32F, 0xAB0E, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB0E, 0xAB0F,
-    0xAB2F, 0xAB0E, 0xAB0F, 0xAB2F, 0xB32F, 0xB32E, 0xAB0F, 0xB32F,
-    0xBB2F, 0xA2EE, 0x7A8E, 0x7A8E, 0x7A8E, 0x82AE, 0x49ED, 0x196C,
-    0x39CD, 0x7A8E, 0x7A8E, 0x7A8E, 0x7A6E, 0x92CE, 0xBB4F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xAB0E, 0xAB0E,
-    0xB30E, 0xAB2E, 0xB32F, 0xB32F, 0xB34F, 0xA2EF, 0x828F, 0x828F,
-    0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0xAB0F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB34F, 0x92CF, 0x82AF, 0x7A8F,
-    0x622F, 0x624F, 0x622F, 0x6A2F, 0x6A4F, 0x6A2F, 0x622F, 0x6A4F,
-    0x828F, 0x828F, 0x726F, 0x622F, 0x624F, 0x622F, 0x620F, 0x7A6F,
-    0x828F, 0x92CE, 0xB34F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xB32F, 0xB32F, 0xB32F,
-    0xB32E, 0xAB0F, 0xB32F, 0x9AEF, 0x726E, 0x726F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x624F, 0x6A4F, 0x622F, 0x622F, 0x726F,
-    0x7A6F, 0x726F, 0x726F, 0x7A6E, 0xAB2F, 0xB32F, 0xB32F, 0xB32E,
-    0xB32F, 0xB32E, 0xB32F, 0xB34F, 0x92CF, 0x724F, 0x726F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A2F,
-    0x6A2F, 0x6A2F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x624F, 0x624F, 0x6A6F, 0x5A2F, 0x39CD, 0x39CD, 0x39CE, 0x39CD,
-    0x520E, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x620F, 0x92CF, 0xA2EF, 0x9AEF, 0xA2EF, 0xB32E, 0xB30E, 0xB30E,
-    0xB32E, 0xB32E, 0xB32F, 0xB32F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAAEE, 0xAB0E, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB30F, 0xAB0E, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB0F, 0xAB2F,
-    0xAB2F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB2E, 0xAB2F, 0xAB2F, 0xAB2F,
-    0xAB2F, 0xAB0F, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB32F, 0x9AEE,
-    0x9AEF, 0x6A4E, 0x216C, 0x29AD, 0x29AC, 0x298C, 0x29AD, 0x31CD,
-    0x31AD, 0x298C, 0x298C, 0x298C, 0x216C, 0x520D, 0x92EF, 0x92CE,
-    0xAB2F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30E, 0xB30E,
-    0xAB2F, 0xAB2F, 0xAB0F, 0xAB2F, 0xAB2F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB0E,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB2F, 0xAB2F, 0xA30F, 0xA310, 0x82AF,
-    0x622F, 0x624F, 0x624F, 0x622F, 0x624F, 0x6A4F, 0x7A6F, 0x7A6E,
-    0xAB2F, 0xB32F, 0x8AAF, 0x726E, 0x726F, 0x726F, 0x724E, 0xA2EF,
-    0xB32F, 0xB32F, 0xAB0E, 0xAB2F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB2F, 0x724F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A2E, 0xA30F,
-    0xB32F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB2E, 0xB32E, 0xB30E, 0xB30E,
-    0xB32E, 0xB30E, 0xB30E, 0xB32F, 0xB32F, 0xB32F, 0xA2EF, 0x6A2E,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x726F, 0xAB2F, 0xAB0F, 0xB32E,
-    0xB32E, 0xB32E, 0xB32F, 0xB32E, 0xB32F, 0xB32F, 0xB30F, 0xB30F,
-    0xB30E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0F, 0xB32F, 0xB32F, 0xAB2F, 0xAB2F, 0xAB2F,
-    0xB32F, 0xB32F, 0xB32F, 0xAB0E, 0xAB0F, 0xA30F, 0xA30F, 0xA30F,
-    0xA30F, 0xA30F, 0xAB0F, 0xAB0F, 0xAB0F, 0xB30E, 0xA32F, 0x49ED,
-    0x298C, 0x31AD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x31CD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x298C, 0x39AC,
-    0xA30F, 0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xB32E, 0xB30E, 0xB32F,
-    0xAB2F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB2E, 0xB32E, 0xB30E,
-    0xB30E, 0xB32E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0F, 0xAB0E, 0xAB0E,
-    0xB30F, 0xAB0F, 0xB30F, 0xB30E, 0xB32F, 0x7A6E, 0x6A2E, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x622E, 0x82AF, 0xB32F, 0xAB2F,
-    0xB30E, 0xAB0E, 0xB32E, 0xB32F, 0xAB2F, 0xAB2F, 0xAB2F, 0xAB0E,
-    0xAB0E, 0xAB0F, 0xAB2F, 0xAB2F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E,
-    0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB30E, 0xB32F, 0xAB2F, 0x726F,
-    0x622F, 0x624F, 0x622F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x6A4F, 0x622E, 0x92CF, 0xAB2F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB2F,
-    0xAB0E, 0xAB0E, 0xAB2E, 0xAB0E, 0xB32E, 0xB32E, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB32E, 0xB32F, 0xAB0F, 0xB30F, 0xAB0E, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB2F, 0xA30F, 0x6A2E, 0x6A2F,
-    0x6A2F, 0x622F, 0x7A6E, 0xAB2F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB2F, 0x726E, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x624F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x622F, 0x622F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0xA30F,
-    0xB34F, 0xAB2F, 0xB32F, 0xB32F, 0xB32F, 0xB30E, 0xB30F, 0xB30F,
-    0xB30E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xAB0E, 0xB30F, 0xB30F, 0xAB0E, 0xAB0F, 0xAB0F, 0xB30E,
-    0xB32E, 0xB32F, 0xB32F, 0xB30F, 0xB32F, 0xAB2F, 0xB32F, 0xB32F,
-    0xB32E, 0xB32E, 0xB32F, 0xB34F, 0x8AAF, 0x6A2F, 0x6A4F, 0x6A2F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x7A8F, 0xAB2F, 0x49ED, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x29AD, 0x31AD, 0x31AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x39CD,
-    0xA32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xB32F, 0xB32F, 0xB32E,
-    0xB32F, 0xB32F, 0xB32E, 0xB32E, 0xB30E, 0xB32E, 0xB30E, 0xB30E,
-    0xB32F, 0xB30E, 0xB32E, 0xB30E, 0xAB2E, 0xB32E, 0xAB0E, 0xB32E,
-    0xB30E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xAB0E, 0xB30E,
-    0xB30F, 0xAB0F, 0xAB0F, 0xB30F, 0xB30F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xA30F, 0xAB0F, 0xB30E, 0xAB0E,
-    0xB30E, 0xB30E, 0xB30E, 0xAB0E, 0xB30E, 0xB30E, 0xB30E, 0xAB0F,
-    0xAB0E, 0xAB0E, 0xB30F, 0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB30E, 0xB30F, 0xB30F, 0xB30F, 0xB32F, 0xB30E,
-    0xB32E, 0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0x724F,
-    0x622F, 0x624F, 0x6A4F, 0x6A2F, 0x622F, 0x622F, 0x622F, 0x828F,
-    0xA30F, 0xA2EF, 0xA2EF, 0x9AEF, 0x9AEF, 0x9AEF, 0x9AEF, 0x9AEF,
-    0xA2EF, 0x9B0F, 0xAB0F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB30F, 0xB32E, 0xB30E, 0xB32E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xB32E, 0xB32E, 0xB32F, 0xAB2F, 0xAB0F, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xA30F, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA30F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xAB0F, 0x7A6F, 0x5A2F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A2E, 0x9AEF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0x9AEF, 0x622E, 0x5A2F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x624F, 0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A2F, 0x724E, 0xA2EE, 0xAB0E, 0xAAEE, 0xAB0E,
-    0xB30E, 0xAB0E, 0xB30F, 0xAB0E, 0xB30E, 0xB30E, 0xAB0E, 0xB32F,
-    0xAAEE, 0xAB0E, 0xAAEE, 0xAB0E, 0xAB0E, 0xAAEE, 0xB30E, 0xAB0E,
-    0xB30E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAAEE, 0xAB0F, 0xAB0F, 0xA2EE,
-    0xBB4E, 0xE40F, 0x8A8E, 0x726F, 0x6A4F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x6A4F, 0x520E, 0x39CD, 0x41EE, 0x520D, 0x31AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x49ED, 0x9B0F, 0xB32F, 0xAB0E, 0xAB0E, 0xAAEE, 0xAB0E, 0xAB0E,
-    0xAAEE, 0xAB0E, 0xAB0E, 0xAB0E, 0xB30F, 0xAAEE, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAAEE,
-    0xB30F, 0xAB0E, 0xAB0E, 0xB30E, 0xAB0E, 0xB30F, 0xB32F, 0xAAEE,
-    0xAB0E, 0xB30F, 0xB30F, 0xB30E, 0xAAEE, 0xB30E, 0xB30F, 0xB30E,
-    0xB30F, 0xAB0E, 0xB32E, 0xB30E, 0xB30E, 0xAB0E, 0xAAEE, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xB32F, 0xB30E, 0xB30E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0F, 0xAB0F, 0xAB0E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xAAEE, 0xB30E, 0xB30E, 0xB30E, 0xAB0E, 0xAAEE, 0xB30F,
-    0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xAB2F, 0x9AEF,
-    0x726F, 0x622F, 0x622F, 0x622F, 0x8ACF, 0x92CF, 0x92AF, 0xA2EF,
-    0xB32E, 0xB30E, 0xB32E, 0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB2F, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xCBAD, 0xDBCD, 0xDBCD,
-    0xD3AE, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0F, 0xB32E, 0xB32E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xA2EF, 0x92CF, 0x8AAF, 0x622F,
-    0x622F, 0x82AF, 0x92CF, 0x92CF, 0x92CF, 0x92CF, 0xB32F, 0xB32E,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0x92CE, 0x92CF, 0x726F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x726F, 0x92EF, 0x92CF, 0xAB4F,
-    0x9AEE, 0x92CE, 0xAB4E, 0x8AAE, 0xCBCE, 0xBB2E, 0xCB8E, 0xCBAE,
-    0xBB2E, 0xDBEE, 0xB32E, 0xD3CE, 0xC36E, 0xC36E, 0xD3CE, 0xB30E,
-    0xD3CE, 0xB32E, 0xCB8E, 0xC38E, 0xB32E, 0xD3CE, 0xB30E, 0xD3CE,
-    0xC36E, 0xC36E, 0xD3CE, 0xB30E, 0xD3CE, 0xB32E, 0xBB2E, 0xCB8E,
-    0xC36E, 0x9B0E, 0x6A4F, 0x622F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x6A4F, 0x49EE, 0x31AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD,
-    0x298D, 0x298D, 0x298D, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x29AD, 0x520D, 0xA30E, 0xC38F, 0xBB4E, 0xDBEE, 0xB32E, 0xCB8E,
-    0xDBEE, 0xCB8E, 0xB32F, 0xCB8E, 0xB30E, 0xCBCE, 0xBB4E, 0xBB6E,
-    0xCBCE, 0xB32E, 0xCBEE, 0xB32E, 0xCBAE, 0xC38E, 0xB32E, 0xD3CE,
-    0xB30E, 0xCBCE, 0xC36E, 0xC36E, 0xD3EE, 0xB30E, 0xB30E, 0xCBCE,
-    0xC36E, 0xAAEE, 0xB30F, 0xB30E, 0xD3CE, 0xBB2E, 0xAB0F, 0xB30F,
-    0xBB4E, 0xD3EE, 0xB32E, 0xB32F, 0xAB0E, 0xBB6E, 0xCBAE, 0xAAEE,
-    0xB30F, 0xAAEE, 0xCBAE, 0xCBAE, 0xAB0E, 0xB32F, 0xB30E, 0xCBCE,
-    0xC36E, 0xAB0E, 0xAB0F, 0xB32E, 0xD3CE, 0xBB4E, 0xB30E, 0xB30F,
-    0xBB4E, 0xD3EE, 0xB32E, 0xB30F, 0xAB0E, 0xBB6E, 0xCBCE, 0xB30E,
-    0xAB0E, 0xAB0F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xB34F,
-    0x9ACF, 0x828F, 0x828F, 0x8AAE, 0xB32F, 0xB30E, 0xCB8E, 0xC36E,
-    0xB32E, 0xCBAE, 0xB32E, 0xB30E, 0xB32F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB2F, 0xAB2F, 0xB32F, 0xB32E, 0xCB8E, 0xCB8D,
-    0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xEC2D, 0xFC4D, 0xFC4D,
-    0xEC2D, 0xCB8D, 0xCB8D, 0xCB8E, 0xBB4E, 0xAAEE, 0xB32E, 0xCB8E,
-    0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8E, 0xB30E, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0E, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xBB4F, 0xAB0F, 0x828F,
-    0x828F, 0xAB0F, 0xBB4F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E,
-    0xAB0E, 0xAB0F, 0xAB0F, 0xAB0F, 0xB32F, 0xB32F, 0x92CF, 0x828F,
-    0x8AAF, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x828F,
-    0x828F, 0x828F, 0x828F, 0x828F, 0x92CF, 0xB32F, 0xB32E, 0xD3CE,
-    0xC36E, 0xC34E, 0xDBCE, 0xB30E, 0xD3CE, 0xBB2E, 0xCB8E, 0xCB8E,
-    0xB32E, 0xD3EE, 0xB30E, 0xCBAE, 0xBB4E, 0xBB4E, 0xCBAE, 0xAAEE,
-    0xCBAE, 0xB30E, 0xC36E, 0xC36E, 0xB30E, 0xD3CE, 0xB30E, 0xCBAE,
-    0xBB4E, 0xBB4E, 0xCBAE, 0xB30E, 0xD3CE, 0xBB4E, 0xA30E, 0xAB2E,
-    0x9AEE, 0x5A0E, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x49EE, 0x41CE, 0x41EE, 0x41EE, 0x41EE, 0x41EE, 0x41EE,
-    0x41EE, 0x41EE, 0x41EE, 0x41EE, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31CD, 0x298D, 0x624D, 0x82CE, 0x7A8E, 0x9B2E, 0x7A8D, 0x8ACE,
-    0x9B2D, 0x8ACE, 0x828E, 0xC38F, 0xBB2E, 0xD3CE, 0xC36E, 0xC36E,
-    0xD3EE, 0xB32E, 0xD3EE, 0xBB2E, 0xD3CE, 0xCB8E, 0xAB0E, 0xCBAE,
-    0xAAEE, 0xCB8E, 0xBB4E, 0xC36E, 0xCBCE, 0xB30E, 0xAB0E, 0xCBCE,
-    0xC36E, 0xAAEE, 0xAAEF, 0xB30E, 0xCBAE, 0xB32E, 0xAB0F, 0xB30F,
-    0xBB4E, 0xCBCE, 0xB34E, 0xAB0F, 0xAB0F, 0xBB4E, 0xCB8E, 0xAAEE,
-    0xAB0E, 0xAAEE, 0xC38E, 0xC3AE, 0xAB0E, 0xAB0F, 0xB30E, 0xCBCE,
-    0xC36E, 0xAB0F, 0xAB0F, 0xB30E, 0xCBAE, 0xBB2E, 0xAB0F, 0xAB0F,
-    0xBB2E, 0xCBCE, 0xB32E, 0xB30F, 0xAB0E, 0xBB6E, 0xCBAE, 0xB2EE,
-    0xBB6E, 0xC36E, 0xB32E, 0xB32E, 0xB32E, 0xB32F, 0xB32F, 0xAB0E,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32E, 0xAB0E, 0xD3CE, 0xCBAE,
-    0xBB2E, 0xDC0E, 0xB32E, 0xAB0F, 0xAB2F, 0xBB4E, 0xBB4E, 0xB32E,
-    0xC36E, 0xB32E, 0xBB4E, 0xBB6E, 0xB32E, 0xCB8D, 0xF42D, 0xFC2C,
-    0xFC4C, 0xFC4C, 0xFC4D, 0xFC4C, 0xFC4D, 0xF42D, 0xF42C, 0xF42C,
-    0xFC2C, 0xFC4D, 0xFC4C, 0xFC4D, 0xDBCD, 0xBB4E, 0xD38D, 0xFC4D,
-    0xFC4D, 0xF44D, 0xFC4D, 0xF44D, 0xFC4C, 0xF42D, 0xC36D, 0xC34E,
-    0xC36E, 0xC34E, 0xC34E, 0xBB4E, 0xB30E, 0xAB0F, 0xB30F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB2F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB0F, 0xB30F, 0xAB0F,
-    0xBB4E, 0xC36E, 0xC36E, 0xC34E, 0xC34E, 0xBB4E, 0xC36E, 0xBB6F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xAB0E, 0xAB0E, 0xAAEE,
-    0xAAEE, 0xAAEE, 0xAAEE, 0xAB0F, 0xAAEE, 0xAB0F, 0xBB2E, 0xB32E,
-    0xB32E, 0xBB4E, 0xB30E, 0xBB2E, 0xB30E, 0xB30E, 0xB30E, 0xAAEE,
-    0xB30E, 0xAAEE, 0xB30E, 0xB30E, 0xB30E, 0xBB2E, 0xB30E, 0xBB2E,
-    0xB30E, 0xB30E, 0xB32E, 0xAB0E, 0xB32E, 0xA30E, 0x7A6F, 0x59EE,
-    0x620E, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x6A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x41CD, 0x39CD, 0x39CD, 0x31CD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x298D, 0x296D, 0x298D, 0x296C, 0x298D, 0x298D,
-    0x298D, 0x296D, 0x39AD, 0x7A8F, 0x8AAF, 0x8AAE, 0x8AAE, 0x8AAE,
-    0x8AAE, 0x8ACF, 0x8AAE, 0x8AAE, 0x8A8E, 0x9ACE, 0xB30E, 0xB30D,
-    0xB2EE, 0xB30D, 0xB30E, 0xB32E, 0xBB4E, 0xB32F, 0xC36E, 0xBB4E,
-    0xB30E, 0xB32E, 0xBB2E, 0xAAEE, 0xB30E, 0xAAEE, 0xBB2E, 0xBB6E,
-    0xB32E, 0xBB4E, 0xB32E, 0xBB6E, 0xB34E, 0xB32E, 0xB32D, 0xB30E,
-    0xBB4E, 0xB30E, 0xB30E, 0xB32E, 0xB32E, 0xBB6E, 0xB32F, 0xBB4E,
-    0xB32E, 0xB32E, 0xBB4E, 0xB30E, 0xBB2E, 0xB30E, 0xBB2E, 0xBB4E,
-    0xB30E, 0xBB2E, 0xB30E, 0xBB4E, 0xB32E, 0xB32E, 0xBB2E, 0xB2EE,
-    0xF44D, 0xF44D, 0xCB8E, 0xAB0E, 0xB32E, 0xB32F, 0xB32F, 0xB30F,
-    0xB32F, 0xB32F, 0xAB2F, 0xB32F, 0xAB2F, 0xB32F, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xB32F, 0xB32F, 0xAB0F, 0xCBAE, 0xE40E, 0xB32E,
-    0xEC4E, 0xBB4E, 0xD3CE, 0xDBCE, 0xBB2E, 0xF44E, 0xF40D, 0xEC0D,
-    0xEC0D, 0xEC0D, 0xEC0D, 0xEC0D, 0xEC0D, 0xEC0D, 0xF40D, 0xF42D,
-    0xF40D, 0xF40D, 0xEC2D, 0xF42C, 0xF44C, 0xF44D, 0xF44D, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF44D, 0xF44D, 0xF42D, 0xF42D, 0xBB4D, 0xBB2E, 0xBB2E, 0xB32E,
-    0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB32F, 0xB30F,
-    0xB30F, 0xB30F, 0xB30F, 0xB32E, 0xBB2E, 0xBB2E, 0xBB4E, 0xB30E,
-    0xDBCD, 0xFC4D, 0xF42D, 0xF42D, 0xF42D, 0xF44D, 0xFC4D, 0xDBCD,
-    0xB30E, 0xB30F, 0xAB0E, 0xAB0F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0F,
-    0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB30E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB32E, 0xB32E, 0xBB2E, 0xBB2E, 0xB30E, 0xDC0E, 0xD3EE,
-    0xBB6E, 0xEC8F, 0xB30E, 0xE42F, 0xCB8E, 0xC36E, 0xE40E, 0xB2EE,
-    0xE42E, 0xBB2E, 0xD3CE, 0xD3EF, 0xBB4E, 0xEC4F, 0xB30E, 0xE42E,
-    0xC38E, 0xBB6E, 0xDC0F, 0xAB0E, 0xDC2F, 0x82AE, 0x622F, 0x624F,
-    0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x624F, 0x6A2F, 0x6A2F, 0x622F, 0x622F, 0x624F, 0x622F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x520E,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31CD, 0x31AD, 0x31CD,
-    0x31CD, 0x31AD, 0x31AD, 0x298D, 0x318D, 0x31AD, 0x31AC, 0x31AD,
-    0x31AD, 0x31AD, 0x39AD, 0x39AD, 0x318D, 0x6A4E, 0xB34F, 0xDC2F,
-    0xAB0E, 0xD40F, 0xC38E, 0xC38E, 0xE44F, 0xBB2E, 0xE44E, 0xF48E,
-    0xC38E, 0xC38E, 0xDC0E, 0xB30E, 0xE44E, 0xB30E, 0xCBCE, 0xD3EE,
-    0xBB4E, 0xEC6F, 0xB32E, 0xE44F, 0xC38E, 0xC3AE, 0xE44E, 0xB30D,
-    0xE42E, 0xB32E, 0xD3CE, 0xD3EE, 0xBB2E, 0xE46E, 0xB32E, 0xDC2E,
-    0xCB8E, 0xC38E, 0xDC2E, 0xB30E, 0xEC4E, 0xBB2E, 0xCBCE, 0xD3CE,
-    0xBB2E, 0xE44E, 0xB30E, 0xE42E, 0xC38E, 0xC38E, 0xDC0E, 0xB2EE,
-    0xF46D, 0xCB8D, 0xAB0E, 0xB32E, 0xAB0E, 0xAB0E, 0xB32F, 0xB30F,
-    0xB32F, 0xB32F, 0xB32E, 0xB32F, 0xB32F, 0xB32F, 0xB30F, 0xAB2F,
-    0xAB2F, 0xAB0E, 0xB32F, 0xAB0E, 0xB32F, 0xB32E, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB30E, 0xB30E, 0xAB0E, 0xB32D, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB32D, 0xB32E, 0xB30D, 0xB32D, 0xB30D, 0xB30D,
-    0xB32E, 0xB30D, 0xBB2D, 0xE40D, 0xFC4D, 0xF44D, 0xF42C, 0xF44D,
-    0xF42C, 0xF44D, 0xF42C, 0xF42C, 0xF42D, 0xF42C, 0xFC4D, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40D, 0xEC0D, 0xF42D, 0xD3AD,
-    0xAB0E, 0xB32E, 0xB30E, 0xB30E, 0xAB0E, 0xAB0E, 0xB30E, 0xB30E,
-    0xB30E, 0xB30E, 0xAB0E, 0xC36D, 0xF42D, 0xEC0D, 0xF42D, 0xEC2D,
-    0xF42D, 0xF42C, 0xF42D, 0xF42D, 0xF42C, 0xF44D, 0xF42D, 0xF44D,
-    0xE40E, 0xAAEE, 0xB30F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xB34E,
-    0xE40E, 0xF44E, 0xEC2E, 0xEC2E, 0xEC2E, 0xEC0D, 0xEC2D, 0xEC0D,
-    0xEC0D, 0xEC2E, 0xEC0D, 0xEC2E, 0xEC0D, 0xF44E, 0xCB8E, 0xB30E,
-    0xB32E, 0xB32E, 0xB32F, 0xB32E, 0xB30E, 0xB30E, 0xB30E, 0xB30E,
-    0xB2ED, 0xAAEE, 0xB30E, 0xB32E, 0xB32F, 0xB32E, 0xB30E, 0xB30E,
-    0x8A8E, 0x6A2F, 0x724E, 0x6A4E, 0x724E, 0x6A4F, 0x622F, 0x622F,
-    0x624F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x5A2F, 0x622F, 0x624F, 0x5A2F,
-    0x31AD, 0x29AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x31AD, 0x31AD, 0x29AD, 0x31AD, 0x5A2F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x5A0F, 0x59EE, 0x5A0E,
-    0x59EE, 0x59EE, 0x7A4E, 0xB2EE, 0xB30E, 0xB30E, 0xBB4E, 0xB32E,
-    0xB32E, 0xB32E, 0xB30E, 0xB30E, 0xB30D, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB30E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB30E, 0xB30E,
-    0xB30D, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30D, 0xB30E, 0xB32E,
-    0xB30E, 0xB30E, 0xB30E, 0xB30F, 0xB32E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB32E, 0xB30F, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E,
-    0xB32D, 0xDC0E, 0xC38E, 0xBB4E, 0xEC2E, 0xDC0E, 0xAB0E, 0xB32F,
-    0xAB0E, 0xAB0E, 0xB32F, 0xAB0E, 0xB32F, 0xAB0E, 0xB30F, 0xAB0E,
-    0xBB4E, 0xE42F, 0xB2EE, 0xDBEF, 0xC36E, 0xC36E, 0xDC0F, 0xB30E,
-    0xE42F, 0xB32E, 0xCBAE, 0xCBAE, 0xB30E, 0xDC0F, 0xAAED, 0xDC0F,
-    0xC36E, 0xC36E, 0xDC0F, 0xAAED, 0xE42F, 0xB30D, 0xCBAE, 0xCBAE,
-    0xB30D, 0xE42F, 0xAAED, 0xEC2E, 0xD3AD, 0xD3AD, 0xEC4E, 0xBB2D,
-    0xF46E, 0xC32C, 0xDBCD, 0xE3CD, 0xC32D, 0xF44E, 0xBB2C, 0xEC0D,
-    0xFC4C, 0xF44C, 0xFC4D, 0xF42C, 0xFC2C, 0xF42C, 0xF42C, 0xEC0D,
-    0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED,
-    0xE3ED, 0xE3ED, 0xE3ED, 0xEC0D, 0xF42C, 0xF42C, 0xF42C, 0xF44C,
-    0xFC4D, 0xFC4D, 0xEC0D, 0xBB2C, 0xF46E, 0xC36D, 0xDBED, 0xE3ED,
-    0xC34D, 0xE40F, 0xAAED, 0xDBEF, 0xC36E, 0xC36E, 0xDBEF, 0xB30D,
-    0xF46E, 0xC34C, 0xE40D, 0xE40D, 0xC36D, 0xF44E, 0xBB0C, 0xEC2E,
-    0xD38D, 0xD38D, 0xEC2E, 0xBB2C, 0xF46E, 0xC34D, 0xD3CE, 0xD3CE,
-    0xB30E, 0xE42F, 0xAAEE, 0xDC0F, 0xC36E, 0xBB4E, 0xDBEE, 0xAAED,
-    0xE40E, 0xBB2E, 0xD3CE, 0xD3EF, 0xBB4F, 0xE44F, 0xBB4E, 0xE42F,
-    0x92EE, 0x5A0F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A2F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x624F, 0x624F,
-    0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x5A2F, 0x522F, 0x5A2F, 0x5A2F, 0x4A0E, 0x318D, 0x29AD, 0x298D,
-    0x41EE, 0x5A2F, 0x5A2F, 0x5A2F, 0x622F, 0x622F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A6F, 0x59EF, 0x8ACE, 0xC3CF, 0x8A8E,
-    0xC3EF, 0x9AEE, 0xBB8F, 0xCBAE, 0xB30D, 0xE44F, 0xB30E, 0xDC2F,
-    0xC38E, 0xC36E, 0xDC0F, 0xB2EE, 0xE42F, 0xB30E, 0xCB8E, 0xCBAE,
-    0xB30E, 0xDC2F, 0xB2EE, 0xDBEF, 0xC36E, 0xC36E, 0xDC0F, 0xAAED,
-    0xE44F, 0xB30E, 0xCBCE, 0xD3CE, 0xB30E, 0xE42F, 0xAAED, 0xDC0F,
-    0xC36E, 0xC34E, 0xDC0F, 0xB30E, 0xE44F, 0xB32E, 0xCBAE, 0xD3CE,
-    0xB30E, 0xE42F, 0xAAED, 0xDC0F, 0xC36E, 0xC36E, 0xDC0E, 0xAACE,
-    0xD3AE, 0xCBAE, 0xD3AE, 0xEC2D, 0xEC2D, 0xC36D, 0xD3EE, 0xB30E,
-    0xCBAE, 0xCBAE, 0xB32E, 0xD3EF, 0xAB0E, 0xD3CE, 0xBB4E, 0xBB4E,
-    0xDBEE, 0xCB8E, 0xD3CE, 0xCB8E, 0xD3AE, 0xD3AE, 0xCB8E, 0xDBCE,
-    0xCB8E, 0xD3CE, 0xCB8E, 0xCB8E, 0xD3CE, 0xCB6D, 0xDBCE, 0xCB8E,
-    0xD3CE, 0xD3CE, 0xCB8E, 0xDBEE, 0xCB8D, 0xD3CE, 0xCB8D, 0xCB6D,
-    0xD3AE, 0xCB6D, 0xDBEE, 0xCB6D, 0xD3AE, 0xD3AE, 0xCB8D, 0xD3EE,
-    0xC36D, 0xD3CE, 0xCB8D, 0xCB8D, 0xD3AE, 0xC34D, 0xD3CE, 0xCB6D,
-    0xEC0D, 0xE3ED, 0xD38C, 0xFC4D, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xFC4D, 0xF42C, 0xFC4D, 0xFC4C, 0xF42C, 0xFC4D,
-    0xF42C, 0xFC4D, 0xFC2D, 0xFC2C, 0xFC2C, 0xF42C, 0xFC4D, 0xFC4D,
-    0xDBCD, 0xC36D, 0xC38E, 0xD3CE, 0xCB8E, 0xD3CE, 0xCB8E, 0xCB8E,
-    0xD3CE, 0xC36D, 0xDBCE, 0xCB6D, 0xD3AE, 0xCBAE, 0xCB8E, 0xD3CE,
-    0xC36D, 0xD3AE, 0xCB8D, 0xCB8D, 0xD3AE, 0xC36D, 0xD3CE, 0xC36D,
-    0xCB8D, 0xCB8D, 0xC36D, 0xD3AE, 0xC34D, 0xD3AE, 0xCBAE, 0xCBAE,
-    0xD3CE, 0xC36D, 0xD3CE, 0xCB8D, 0xD3AE, 0xD38E, 0xCB6D, 0xD3CE,
-    0xCB8E, 0xBB2E, 0xCB8E, 0xAB2E, 0x7A6F, 0x930F, 0x826F, 0x92EF,
-    0x7A8F, 0x622F, 0x6A2F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x624F,
-    0x6A4F, 0x624F, 0x622F, 0x5A0F, 0x5A0F, 0x5A0F, 0x5A0F, 0x5A0F,
-    0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x5A0F, 0x5A0F, 0x5A0F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x520E, 0x520E, 0x49EE,
-    0x5A2F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x5A0F, 0x5A0F,
-    0x622F, 0x5A0F, 0x624F, 0x5A0F, 0x930F, 0xC3AE, 0xD3AD, 0xDBEE,
-    0xCB8E, 0xC36E, 0xC34E, 0xCB8E, 0xD3CE, 0xCB8D, 0xD3CE, 0xCB8D,
-    0xCBCE, 0xD3CE, 0xCBAE, 0xD3CE, 0xCB6D, 0xD3CE, 0xCB8E, 0xCB8E,
-    0xD3CE, 0xCB6D, 0xD3CE, 0xCB8E, 0xD3CE, 0xCBCE, 0xCBAE, 0xD3EE,
-    0xCB8D, 0xD3CE, 0xCB8D, 0xCBAD, 0xD3CE, 0xCB6D, 0xD3CE, 0xCB8D,
-    0xCBAE, 0xD3AE, 0xCB8D, 0xD3CE, 0xCB8D, 0xD3CE, 0xCBAE, 0xCBAE,
-    0xD3CE, 0xC36D, 0xD3CE, 0xCB8D, 0xD3AE, 0xD3AE, 0xCB8D, 0xDBCE,
-    0xFC6D, 0xD3AD, 0xCB8E, 0xEC2E, 0xEC2D, 0xCB8D, 0xDBEE, 0xCBAE,
-    0xD3CE, 0xD3CE, 0xCBAE, 0xD3CE, 0xCB8D, 0xD3CE, 0xD3AE, 0xD3AE,
-    0xD3CE, 0xCB8E, 0xD3CE, 0xCB8E, 0xD3AE, 0xD3AE, 0xCB8E, 0xDBCE,
-    0xCB6D, 0xDBCE, 0xCB8E, 0xCB8E, 0xD3AE, 0xCB6D, 0xD3CE, 0xCB6D,
-    0xD3CE, 0xD3CE, 0xCBAE, 0xDBEE, 0xCB8D, 0xD3AE, 0xCB6D, 0xCB8D,
-    0xD3CE, 0xC36D, 0xD3CE, 0xCB8E, 0xD3CE, 0xD3CE, 0xCBAE, 0xDBEE,
-    0xC36D, 0xD3CE, 0xCBAD, 0xD38D, 0xD3CE, 0xCB6D, 0xDBCE, 0xCB8D,
-    0xD3AD, 0xD3AE, 0xCB8D, 0xDBCD, 0xF42D, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42D, 0xDBCD, 0xF44D, 0xE3ED, 0xE3ED, 0xF42D, 0xDBAD,
-    0xF44D, 0xDBCD, 0xEC0D, 0xEC0D, 0xDBCD, 0xF44D, 0xD3AD, 0xF44D,
-    0xCB8D, 0xB32E, 0xD3CE, 0xDBEE, 0xCB8D, 0xDBEE, 0xCB8E, 0xCB8D,
-    0xD3CE, 0xC36D, 0xDBCE, 0xCB6D, 0xD3AE, 0xD3AE, 0xCB8D, 0xD3CE,
-    0xCB6D, 0xD3AE, 0xCB8D, 0xCB8D, 0xD3CE, 0xCB8D, 0xDBEE, 0xCB8D,
-    0xD3AE, 0xD3AE, 0xCB8D, 0xD3CE, 0xC36D, 0xD3CE, 0xD3AD, 0xCB8E,
-    0xD3CE, 0xC36D, 0xDBCE, 0xCB8D, 0xCBAE, 0xCBAE, 0xCB6D, 0xD3CE,
-    0xCBAE, 0xB32E, 0xCB8F, 0xAB2E, 0x724F, 0x7A4F, 0x7A6F, 0x826E,
-    0x6A2F, 0x5A10, 0x622F, 0x620F, 0x620F, 0x620F, 0x620F, 0x622F,
-    0x622F, 0x622F, 0x92EE, 0x9AEE, 0x9AEE, 0x9AEE, 0x9AEE, 0x9AEE,
-    0x828E, 0x622F, 0x5A2F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x5A2F, 0x622E, 0x9AEE, 0x9AED, 0xA30E, 0x82AE,
-    0x5A2F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x622F, 0x622F, 0x622F, 0x624F, 0x5A0F, 0x8AEE, 0x92EE,
-    0x828E, 0x9B0E, 0x826E, 0x930E, 0xCBCE, 0xDBEE, 0xCBAE, 0xDBEE,
-    0xC38E, 0xBB4E, 0xBB4E, 0xCBAE, 0xD3CE, 0xC36D, 0xD3CE, 0xCB8D,
-    0xD3CE, 0xD3CE, 0xCB8E, 0xDBEE, 0xCB8E, 0xD3CE, 0xCB8E, 0xCB8E,
-    0xD3AE, 0xCB6D, 0xD3CE, 0xCB6D, 0xD3AE, 0xD3AE, 0xCB8E, 0xD3EE,
-    0xCB8D, 0xD3CE, 0xCB8E, 0xCB8E, 0xD3CE, 0xC36D, 0xD3EE, 0xCB6D,
-    0xD3AE, 0xD3AE, 0xCB6D, 0xD3CE, 0xC36D, 0xD3CE, 0xCBAE, 0xCBAE,
-    0xD3CE, 0xCB8E, 0xDBCE, 0xCB8E, 0xD3AE, 0xD3AE, 0xCB6D, 0xDBCE,
-    0xF42C, 0xFC6D, 0xD3AD, 0xD3AD, 0xFC6D, 0xE42E, 0xBB4D, 0xDC0F,
-    0xC38E, 0xCB8E, 0xDC0E, 0xBB2D, 0xE42F, 0xC34D, 0xDBEE, 0xDBEE,
-    0xC34D, 0xEC4F, 0xBB2D, 0xE40E, 0xCB8D, 0xCB8D, 0xE42E, 0xBB2D,
-    0xE42F, 0xC34D, 0xD3AE, 0xD3CE, 0xC34D, 0xE42E, 0xBB2D, 0xE40E,
-    0xCB8E, 0xD3AE, 0xE42F, 0xC32D, 0xEC4F, 0xC34D, 0xDBCE, 0xCBAE,
-    0xB32D, 0xEC4F, 0xBB0D, 0xE42E, 0xCBAD, 0xCB8D, 0xE42E, 0xBB2D,
-    0xEC4F, 0xC34D, 0xD3CE, 0xDBEE, 0xBB2D, 0xE42E, 0xBB0C, 0xE40E,
-    0xD3AD, 0xCB8D, 0xDC0E, 0xBB4D, 0xE3ED, 0xF42C, 0xEBED, 0xEC0D,
-    0xF42D, 0xE3ED, 0xBB2D, 0xE40E, 0xCB8D, 0xCBAD, 0xE40E, 0xBB2D,
-    0xE40E, 0xBB4D, 0xD3CE, 0xD3CE, 0xBB4D, 0xE42E, 0xBB2C, 0xDBCE,
-    0xCBAD, 0xD3CE, 0xE42F, 0xBB4D, 0xE44F, 0xBB4D, 0xD3AE, 0xD3CE,
-    0xC34D, 0xE42F, 0xBB2D, 0xE40E, 0xCB8D, 0xCB8D, 0xE40E, 0xBB2D,
-    0xE42E, 0xBB2D, 0xD3CE, 0xD3CE, 0xC34D, 0xEC6F, 0xBB2D, 0xE40E,
-    0xCB8D, 0xCB8D, 0xDC0E, 0xBB0C, 0xE44F, 0xC34D, 0xD3CE, 0xDBEE,
-    0xC32D, 0xE44F, 0xBB0C, 0xDC0E, 0xCB8D, 0xCB8D, 0xDC0E, 0xBB2D,
-    0xEC6F, 0xCB8E, 0xDC0E, 0xDC0E, 0xCB6E, 0xCB8E, 0xCB6E, 0xDBAE,
-    0xA30E, 0x828E, 0x82AE, 0x828E, 0x82AE, 0x828E, 0x82AE, 0x82AE,
-    0x828E, 0x92AD, 0xEC4E, 0xFC6D, 0xFC4D, 0xFC4D, 0xFC4D, 0xF42D,
-    0xC36D, 0x92CD, 0x82AE, 0x8AAE, 0x82AE, 0x82AE, 0x82AE, 0x8AAE,
-    0x82AE, 0x82AE, 0x828E, 0x92AD, 0xEC2D, 0xFC2C, 0xFC6D, 0xCBAD,
-    0x726E, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x6A2F, 0x6A4F, 0x6A4F,
-    0x624F, 0x622F, 0x6A2F, 0x7A6F, 0x7A6F, 0x7A8E, 0xCBCE, 0xDC0E,
-    0xC34D, 0xE42E, 0xBB4D, 0xE44F, 0xCBAE, 0xCBAE, 0xE44F, 0xBB4D,
-    0xE44F, 0xC36D, 0xD3EE, 0xD3CE, 0xBB2D, 0xE42E, 0xBB0C, 0xDC0E,
-    0xCB8D, 0xCB8D, 0xE42F, 0xBB2D, 0xE44F, 0xC34D, 0xD3CE, 0xD3CE,
-    0xBB2D, 0xE42E, 0xBB0D, 0xDC0E, 0xCB8D, 0xCB8E, 0xDC2E, 0xBB2D,
-    0xE44F, 0xC34D, 0xD3EE, 0xD3CE, 0xC34D, 0xE44F, 0xBB0D, 0xDC0E,
-    0xCB8D, 0xCB8D, 0xE42F, 0xBB2D, 0xE44F, 0xC34D, 0xD3CE, 0xDBEE,
-    0xC34D, 0xE42F, 0xBB2D, 0xDC0E, 0xCBAE, 0xCB8E, 0xDC0E, 0xBB0D,
-    0xF42C, 0xF42C, 0xF42D, 0xFC4D, 0xE40D, 0xBB2D, 0xEC4F, 0xBB2D,
-    0xDBED, 0xDBCD, 0xBB2D, 0xE44F, 0xB2EC, 0xE42E, 0xC36D, 0xC36E,
-    0xE42F, 0xBB0D, 0xEC4F, 0xBB2D, 0xD3CE, 0xD3CE, 0xBB2D, 0xEC4F,
-    0xB2EC, 0xE42E, 0xCB8D, 0xC36D, 0xE42F, 0xB2EC, 0xEC6F, 0xBB2D,
-    0xD3CE, 0xD3CE, 0xBB4D, 0xEC4F, 0xB30D, 0xE42F, 0xCB8E, 0xAAEE,
-    0xAB0E, 0xB32D, 0xE42F, 0xB32D, 0xD3CE, 0xDBCE, 0xBB2C, 0xEC4F,
-    0xB30C, 0xE44F, 0xCB8D, 0xCB8D, 0xE44F, 0xB30C, 0xEC4F, 0xBB2D,
-    0xD3CE, 0xDBEE, 0xBB2D, 0xEC4F, 0xB30D, 0xE40E, 0xCB6D, 0xCB8D,
-    0xE40E, 0xB30D, 0xEC4F, 0xBB2D, 0xDBEF, 0xD3EE, 0xBB4D, 0xEC6F,
-    0xB2EC, 0xE40E, 0xC38D, 0xC38E, 0xE44F, 0xB30C, 0xEC4E, 0xBB2D,
-    0xD3CE, 0xDBEE, 0xBB4D, 0xEC6F, 0xB30C, 0xDC0E, 0xCBAD, 0xC36D,
-    0xE42F, 0xB30C, 0xEC4F, 0xBB2D, 0xD3CE, 0xD3CE, 0xBB4D, 0xEC4F,
-    0xB30C, 0xE42E, 0xC36D, 0xCB8D, 0xE42E, 0xB30C, 0xEC6F, 0xBB4D,
-    0xD3CE, 0xD3CE, 0xBB2C, 0xE44F, 0xB2EC, 0xE42F, 0xCB8D, 0xC36D,
-    0xE42E, 0xB30C, 0xE44F, 0xBB0C, 0xD3CE, 0xD3EE, 0xBB2D, 0xEC6F,
-    0xB30D, 0xE42F, 0xCBAE, 0xCB6D, 0xF46E, 0xF42D, 0xEC2D, 0xF42D,
-    0xEC2D, 0xEC2D, 0xF44D, 0xF42D, 0xEC2D, 0xF44D, 0xEC2D, 0xEC2D,
-    0xF44D, 0xEC2E, 0xF42D, 0xEC0D, 0xF40D, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xF44D, 0xF44D, 0xF44D, 0xF44D, 0xF44D, 0xF44D, 0xF44D,
-    0xF44D, 0xF42D, 0xF42D, 0xF42D, 0xF40C, 0xF40C, 0xEC0D, 0xEC4E,
-    0xC3CF, 0x622E, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x624F, 0x622F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x724F, 0x828E, 0xB34F, 0xAB0E, 0xE44F, 0xC36E, 0xC36D,
-    0xDC0E, 0xB2CC, 0xE42E, 0xB30D, 0xD3EE, 0xDBEE, 0xBB4D, 0xEC8F,
-    0xB30D, 0xE44F, 0xCB8D, 0xC36D, 0xE42F, 0xB2EC, 0xEC4F, 0xBB0C,
-    0xD3CE, 0xD3CE, 0xBB2D, 0xEC6F, 0xB2ED, 0xE42F, 0xCBAD, 0xC36D,
-    0xE42F, 0xB2EC, 0xE44F, 0xBB0D, 0xD3EE, 0xD3EE, 0xBB2D, 0xEC6F,
-    0xB2EC, 0xE44F, 0xC36D, 0xCB8D, 0xE42F, 0xB2EC, 0xE44F, 0xBB2D,
-    0xD3CE, 0xD3CE, 0xBB2D, 0xE46F, 0xB2ED, 0xE42F, 0xCB8D, 0xCB8D,
-    0xE42F, 0xB30D, 0xEC4F, 0xBB2D, 0xD3EE, 0xD3EE, 0xBB2D, 0xF46E,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF44D, 0xEC2D, 0xBB2D, 0xE3ED,
-    0xF42D, 0xF42D, 0xDBCD, 0xB32D, 0xEC6F, 0xBB2D, 0xD3CE, 0xDBEE,
-    0xC34D, 0xEC6F, 0xB30D, 0xE42F, 0xCB8E, 0xCB6E, 0xE42F, 0xBB0D,
-    0xEC6F, 0xBB4D, 0xD3CE, 0xDBEE, 0xC34D, 0xEC4F, 0xB30D, 0xE40E,
-    0xCB6E, 0xCB8E, 0xE42E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xAB0F,
-    0xAB2E, 0xAB2F, 0xB32E, 0xB32E, 0xAB0E, 0xD3AE, 0xE42E, 0xBB2D,
-    0xEC4F, 0xBB4D, 0xDBEE, 0xDBEE, 0xBB2D, 0xEC6F, 0xBB2C, 0xE42F,
-    0xC38D, 0xCB8E, 0xE42F, 0xB30D, 0xEC4F, 0xBB2D, 0xDBEE, 0xD3CE,
-    0xBB4D, 0xEC6F, 0xB30C, 0xE42F, 0xC36D, 0xCB8E, 0xE42F, 0xB2EC,
-    0xEC4F, 0xBB2C, 0xD3CE, 0xD3EE, 0xBB4D, 0xEC4F, 0xB2EC, 0xE40E,
-    0xCB8D, 0xCB8D, 0xE42F, 0xB30D, 0xEC4F, 0xBB4D, 0xD3CE, 0xDBEE,
-    0xBB4D, 0xEC4F, 0xB30D, 0xE42E, 0xC38D, 0xCB8D, 0xDC0E, 0xB2ED,
-    0xEC6F, 0xBB4D, 0xDBEE, 0xD3EE, 0xBB4D, 0xEC4F, 0xB30C, 0xE42F,
-    0xC38D, 0xC36D, 0xE44E, 0xB30C, 0xEC4F, 0xBB2D, 0xD3CE, 0xD3CE,
-    0xBB2D, 0xEC4F, 0xBB0C, 0xE42E, 0xC38D, 0xCB8E, 0xE42F, 0xBB2D,
-    0xEC6F, 0xBB2D, 0xDBEE, 0xDC0F, 0xBB4D, 0xEC4E, 0xB2EC, 0xEC0D,
-    0xCB4D, 0xC34D, 0xFC4D, 0xF42D, 0xB2EC, 0xEC2E, 0xCB6D, 0xCB4D,
-    0xEC4E, 0xB2EC, 0xEC4E, 0xBB2C, 0xD3AD, 0xFC4D, 0xF42D, 0xF42D,
-    0xF42C, 0xF44D, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xD3AD, 0x9ACE,
-    0x724E, 0x6A4F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F,
-    0x8AAF, 0xC3AF, 0xDC0F, 0xB2ED, 0xE44F, 0xBB2D, 0xDBEE, 0xD3CE,
-    0xBB2D, 0xE44F, 0xB2EC, 0xE40E, 0xC36D, 0xCB8E, 0xE42F, 0xB30D,
-    0xEC8F, 0xBB4D, 0xDBEE, 0xD3EE, 0xBB2D, 0xE44F, 0xB2EC, 0xDC0E,
-    0xCB8D, 0xCB8D, 0xE44F, 0xB30D, 0xEC6F, 0xBB2D, 0xD3EE, 0xDBEE,
-    0xBB2D, 0xEC4F, 0xB2ED, 0xE42F, 0xC36D, 0xCB8D, 0xE42F, 0xB2ED,
-    0xEC6F, 0xBB2D, 0xD3EE, 0xD3CE, 0xBB2D, 0xEC4F, 0xB30C, 0xE42F,
-    0xCB8E, 0xCB6D, 0xE44F, 0xBB0D, 0xEC4F, 0xBB2D, 0xD3EE, 0xD3CE,
-    0xBB2D, 0xEC6F, 0xBB0C, 0xE44F, 0xCB8E, 0xCB8E, 0xE42F, 0xB2ED,
-    0xFD70, 0xF46D, 0xF42C, 0xF42D, 0xF42C, 0xF42C, 0xE3ED, 0xF42D,
-    0xF42C, 0xF42C, 0xF40C, 0xDBCD, 0xC34D, 0xDC0E, 0xCB8E, 0xCBAE,
-    0xDC0E, 0xBB4D, 0xE42F, 0xC36D, 0xD3CE, 0xD3CE, 0xBB4D, 0xDBEE,
-    0xBB4D, 0xDC0E, 0xD3AE, 0xCB8E, 0xDBEE, 0xBB4D, 0xE40E, 0xCB6E,
-    0xAB0E, 0xB32E, 0xBB4E, 0xAB0E, 0xB32E, 0xB32F, 0xB32F, 0xB32F,
-    0xB32F, 0xB32F, 0xAB2F, 0xB32F, 0xAB0E, 0xBB2E, 0xBB6E, 0xB30E,
-    0xC36E, 0xDC0E, 0xCB8D, 0xCBAE, 0xE42F, 0xC34D, 0xE42F, 0xC36D,
-    0xD3CE, 0xD3CE, 0xC34D, 0xE42E, 0xBB2D, 0xDBEF, 0xCB8E, 0xCB8E,
-    0xDC0E, 0xBB2D, 0xE42F, 0xC36D, 0xD3CE, 0xD38D, 0xC34D, 0xE42F,
-    0xBB4D, 0xDC0E, 0xCB8D, 0xCB8D, 0xDC0E, 0xC34D, 0xE42F, 0xC36D,
-    0xD3CE, 0xD3CE, 0xBB4D, 0xE40E, 0xC34D, 0xDC2F, 0xCBAE, 0xCB8E,
-    0xDBEE, 0xBB4D, 0xE44F, 0xBB4D, 0xD3EE, 0xD3CE, 0xC36D, 0xE42E,
-    0xBB2D, 0xDC0E, 0xCBAE, 0xCBAE, 0xDC0E, 0xBB4D, 0xE40E, 0xC36D,
-    0xD3CE, 0xD3CE, 0xC36D, 0xE42E, 0xBB4D, 0xDC0E, 0xCB8D, 0xCB8D,
-    0xDC0E, 0xBB2D, 0xE42F, 0xC34D, 0xD3CE, 0xD3CE, 0xC36D, 0xE42F,
-    0xBB4D, 0xDC0E, 0xCB8E, 0xCBAE, 0xDC2F, 0xBB4D, 0xE42F, 0xBB2D,
-    0xD3CE, 0xD3CE, 0xB32E, 0xC36E, 0xE42F, 0xBB4D, 0xD3CE, 0xD3CE,
-    0xBB4D, 0xE44F, 0xB30D, 0xDC0F, 0xCB8E, 0xD3AD, 0xF44E, 0xBB2C,
-    0xF48E, 0xCB6D, 0xDBCD, 0xFC4D, 0xF42C, 0xFC2D, 0xF40C, 0xFC2D,
-    0xFC2D, 0xF42C, 0xF42D, 0xF42C, 0xF42C, 0xFC4D, 0xCB6D, 0xA2EE,
-    0x8ACF, 0x5A0E, 0x624F, 0x620F, 0x622F, 0x622F, 0x620F, 0x622F,
-    0x5A0F, 0x622F, 0x620E, 0x828F, 0xA30F, 0x9ACE, 0x9AEF, 0x92AE,
-    0xCBAE, 0xD3EE, 0xC36D, 0xE44F, 0xBB2D, 0xDBEE, 0xCB6D, 0xCB8E,
-    0xDC2F, 0xBB2D, 0xE40E, 0xBB2D, 0xD3CE, 0xD3AE, 0xC36D, 0xE42E,
-    0xBB4D, 0xDC2F, 0xCBAE, 0xCBAE, 0xDC2E, 0xBB2D, 0xE42E, 0xC34D,
-    0xD3CE, 0xD3CE, 0xBB4D, 0xE42F, 0xBB4D, 0xDC0F, 0xCBAE, 0xCB8E,
-    0xDC0F, 0xBB2D, 0xDC2F, 0xC34D, 0xD3CE, 0xD3CE, 0xC34D, 0xE42F,
-    0xBB2D, 0xDC0E, 0xCB8E, 0xCB8D, 0xDC0E, 0xC32D, 0xE42F, 0xC34D,
-    0xD3CE, 0xD3EE, 0xC34D, 0xE42F, 0xBB4D, 0xDC0E, 0xCB8D, 0xCB8D,
-    0xDC0E, 0xBB2D, 0xE42F, 0xC36D, 0xD3CE, 0xD3CE, 0xC34D, 0xEC2E,
-    0xFDF1, 0xFD70, 0xF46D, 0xF40C, 0xF42C, 0xF42C, 0xFC2C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42D, 0xD3CD, 0xCB8E, 0xD3AE, 0xD3AE,
-    0xCBAE, 0xD3AE, 0xCBAE, 0xD3CE, 0xCBAE, 0xCB8E, 0xDBCD, 0xF44D,
-    0xDBCD, 0xCB8E, 0xD3CE, 0xD3CE, 0xCBAE, 0xD3AE, 0xCB8E, 0xB30E,
-    0xAAEE, 0xAB0E, 0xAB0E, 0xAB2E, 0xB32E, 0xB32E, 0xB32F, 0xAB2F,
-    0xAB0F, 0xAB0E, 0xAB0F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAAEE, 0xAB0F,
-    0xAAEE, 0xC36E, 0xD3AE, 0xCBAE, 0xD3CE, 0xD3CE, 0xCBAE, 0xD3CE,
-    0xCBAE, 0xCB8E, 0xD3AE, 0xCB6D, 0xD3CE, 0xD3CE, 0xD3CE, 0xD3CE,
-    0xCBAE, 0xD3CE, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xD3AE, 0xCB8E,
-    0xD3AE, 0xCB8E, 0xD3CE, 0xD3AE, 0xCB8D, 0xD3AE, 0xCBAE, 0xD3EE,
-    0xCBAE, 0xCB8D, 0xCB8D, 0xCB8D, 0xD3CE, 0xCBAE, 0xCBAD, 0xCBAD,
-    0xC38E, 0xD3CE, 0xCB8E, 0xD3AE, 0xCB8E, 0xCBAE, 0xD3CE, 0xCB8D,
-    0xD3AE, 0xCBAD, 0xD3CE, 0xD3CE, 0xCB8D, 0xD3AD, 0xCB8E, 0xD3CE,
-    0xCBAD, 0xCBAD, 0xCBAD, 0xCB8E, 0xD3CE, 0xCBAE, 0xCBAE, 0xCB8E,
-    0xCBAE, 0xD3CE, 0xCB8E, 0xD3AE, 0xCB8E, 0xCB8E, 0xCBAE, 0xC38E,
-    0xD3AD, 0xCB8E, 0xCBAE, 0xCB8E, 0xCB8D, 0xD3CE, 0xC36E, 0xCBAD,
-    0xD3CE, 0xCBAE, 0xD3CE, 0xD3CE, 0xCB8E, 0xD3CE, 0xCBAE, 0xCBAE,
-    0xD3CE, 0xCBAE, 0xCBCE, 0xCB8D, 0xCB8D, 0xCB8D, 0xCBAE, 0xDC0E,
-    0xCBAE, 0xD3CE, 0xCB8D, 0xDBCD, 0xEC0D, 0xC32C, 0xF42D, 0xD38C,
-    0xDBCC, 0xFC2C, 0xFC2C, 0xF42D, 0xCB8D, 0xC36D, 0xD3AD, 0xC36E,
-    0xAB0E, 0xB38F, 0x92AE, 0xB38E, 0xA30E, 0x9AEE, 0xB36F, 0x928E,
-    0xB36E, 0x92CE, 0xA32E, 0xBB6E, 0xBB4E, 0xD40E, 0xB32E, 0xD3AE,
-    0xCB8D, 0xCB8E, 0xD3CE, 0xC38E, 0xD3CE, 0xCB8E, 0xD3AE, 0xD3CE,
-    0xCBAE, 0xD3CE, 0xCB6D, 0xCB8D, 0xCB8D, 0xCB8E, 0xD3AE, 0xC38D,
-    0xD3AE, 0xCBAE, 0xD3CE, 0xD3CE, 0xCBAE, 0xD3CE, 0xCB8E, 0xD3CE,
-    0xCB8D, 0xCBAD, 0xD3CE, 0xC36D, 0xD3CE, 0xCB8D, 0xD3CE, 0xDBEE,
-    0xD3CE, 0xDBCE, 0xCB8D, 0xD3AE, 0xCBAE, 0xCBAE, 0xD3AE, 0xCB8E,
-    0xD3CE, 0xCBAD, 0xD3AE, 0xD3AE, 0xCBAE, 0xD3CE, 0xCB8E, 0xD3CE,
-    0xCBAE, 0xCBAE, 0xD3CE, 0xCBAD, 0xD3CE, 0xCBAE, 0xD3CE, 0xD3AE,
-    0xCBAD, 0xD3CE, 0xCB8E, 0xD3CE, 0xD3AE, 0xCBAE, 0xD3CE, 0xCB6D,
-    0xFDD0, 0xFE11, 0xFD4F, 0xF48D, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC4D, 0xD38D, 0xE40D, 0xE40D,
-    0xCB8C, 0xF46E, 0xCB6D, 0xF44D, 0xDBCD, 0xDBAD, 0xFC6D, 0xEC2D,
-    0xDC0E, 0xC36D, 0xD3AE, 0xCBAE, 0xD38D, 0xF46E, 0xAAEE, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xBB4E,
-    0xCBAE, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D, 0xCB8D,
-    0xCB8D, 0xC36D, 0xEC0D, 0xEC0D, 0xC36D, 0xD3EE, 0xC36D, 0xF44E,
-    0xE3ED, 0xCB8D, 0xD3CE, 0xC36D, 0xDC0E, 0xB32E, 0xCBAE, 0xCBAE,
-    0xAB0E, 0xD3EE, 0xC34D, 0xF42D, 0xD3AD, 0xC36D, 0xCBAE, 0xC36D,
-    0xFC6D, 0xD38D, 0xD3AE, 0xCBCE, 0xD3AD, 0xF46E, 0xC36D, 0xD3EE,
-    0xCB8D, 0xDBAD, 0xF42D, 0xCB6D, 0xD3EE, 0xC36D, 0xE40D, 0xE42D,
-    0xC38D, 0xD3EE, 0xC38D, 0xF44D, 0xD3CD, 0xCBAE, 0xD3CE, 0xCB6D,
-    0xF46E, 0xD3AD, 0xCBAE, 0xD3CE, 0xD3AD, 0xF44D, 0xCB6D, 0xD3CE,
-    0xC38D, 0xDBED, 0xF46E, 0xC36D, 0xD3EE, 0xC36D, 0xE40D, 0xE40D,
-    0xC36D, 0xD3EE, 0xC36D, 0xEC4E, 0xDBCD, 0xD3CD, 0xEC2D, 0xC36D,
-    0xF44D, 0xCB8D, 0xE40D, 0xE3ED, 0xCB6D, 0xF44D, 0xCB4C, 0xF44D,
-    0xCB8E, 0xCB6E, 0xFC8D, 0xF44D, 0xC34D, 0xD3EE, 0xCB8E, 0xDBED,
-    0xF46D, 0xC36D, 0xD3EE, 0xC34D, 0xE3ED, 0xE40D, 0xC36D, 0xDC0F,
-    0xCB8D, 0xF46D, 0xE3ED, 0xC36D, 0xCBAD, 0xC34D, 0xD3AD, 0xC36D,
-    0xDBCD, 0xFC2C, 0xF42C, 0xF42D, 0xCB8D, 0xC34D, 0xE3ED, 0xEC0D,
-    0xCB6D, 0xDBCE, 0xCBAE, 0xDC0E, 0xD3AE, 0xCB8D, 0xD3AE, 0xCB6E,
-    0xDC0E, 0xBB4E, 0xCB8E, 0xCB8E, 0xB32E, 0xDC0E, 0xB32E, 0xD3CE,
-    0xCBAD, 0xC36D, 0xD3AE, 0xC36D, 0xD3EE, 0xCB6E, 0xE42E, 0xE42E,
-    0xCB6E, 0xDBEE, 0xC36D, 0xEC2D, 0xD3AD, 0xCB8E, 0xD3CE, 0xCB6D,
-    0xF46E, 0xCB8D, 0xD3CE, 0xD3CE, 0xCB8E, 0xDC2F, 0xC36D, 0xDC0E,
-    0xCBAE, 0xCB8D, 0xDBEE, 0xCB6D, 0xDBEE, 0xCB8D, 0xC3AE, 0xAB4F,
-    0x92CE, 0xCBCF, 0xCB8E, 0xDC0E, 0xCB8D, 0xCBAE, 0xD3EE, 0xC36D,
-    0xD3EE, 0xC34D, 0xD3AE, 0xD3CE, 0xCB6D, 0xDBEE, 0xC34D, 0xD3EE,
-    0xCBAD, 0xCB8E, 0xDC0E, 0xC36D, 0xDC0E, 0xCB8D, 0xD3CE, 0xD3CE,
-    0xCB8D, 0xDC0E, 0xC36D, 0xD3EE, 0xD3AE, 0xCB8E, 0xD3CE, 0xC36D,
-    0xFDD0, 0xFDD0, 0xFE11, 0xFD6F, 0xF46D, 0xF48D, 0xF48D, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC4C, 0xF42C, 0xF42C,
-    0xFC4C, 0xF42C, 0xFC4C, 0xF42C, 0xF44C, 0xFC4C, 0xF42C, 0xEC2D,
-    0xBB2D, 0xEC2E, 0xD3AD, 0xCB6D, 0xFC6D, 0xEC2D, 0xC36E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xBB4E, 0xBB4E, 0xBB4E, 0xBB4E, 0xD3CD,
-    0xFC6D, 0xFC4C, 0xFC4C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC4C, 0xFC4C,
-    0xFC4C, 0xFC4C, 0xFC2C, 0xFC4C, 0xEC2D, 0xBB2D, 0xF44D, 0xFC4C,
-    0xF42D, 0xD3CE, 0xC36D, 0xE42F, 0xAB0E, 0xB32E, 0xAB0E, 0xAB0E,
-    0xAB2E, 0xAB0E, 0xE3EE, 0xF40C, 0xFC6D, 0xDBCD, 0xBB4D, 0xFC6D,
-    0xF42C, 0xEC2E, 0xC36D, 0xCB8D, 0xF44E, 0xF42D, 0xEC4E, 0xBB4D,
-    0xD3AD, 0xF42D, 0xF42D, 0xE40E, 0xBB2D, 0xDBEE, 0xEC2D, 0xF44D,
-    0xDC0E, 0xBB4D, 0xE42E, 0xF42D, 0xEC2D, 0xD3AD, 0xC36D, 0xEC2E,
-    0xF42D, 0xEC4E, 0xC36D, 0xCB8D, 0xEC4E, 0xF42D, 0xEC2E, 0xBB4D,
-    0xCBAD, 0xEC2D, 0xF44D, 0xE42E, 0xBB2D, 0xDBEE, 0xF44D, 0xF42D,
-    0xDBEE, 0xBB2D, 0xE40E, 0xF44D, 0xEC0D, 0xEC2D, 0xEC2D, 0xE40D,
-    0xF42D, 0xEC0D, 0xEC0D, 0xEC0D, 0xEBED, 0xF40C, 0xEC0D, 0xF44D,
-    0xD3AD, 0xD3AD, 0xF42D, 0xE3ED, 0xFC8E, 0xC36D, 0xDBED, 0xF44D,
-    0xE40D, 0xF46D, 0xB30D, 0xE40D, 0xEC0D, 0xEC0D, 0xEC2D, 0xBB2D,
-    0xF46E, 0xEC0D, 0xF44D, 0xDBCD, 0xC34C, 0xF44D, 0xBB2C, 0xEC0D,
-    0xFC4C, 0xF42C, 0xF42C, 0xF42C, 0xFC4C, 0xFC4C, 0xFC2C, 0xFC4C,
-    0xEC0D, 0xBB0C, 0xF44E, 0xC36D, 0xDBCD, 0xE3CD, 0xBB0D, 0xDBEE,
-    0xAAEE, 0xAB0F, 0xAB0E, 0xAAEE, 0xAB0F, 0xAAEE, 0xB32F, 0xAAEE,
-    0xDBEE, 0xDBED, 0xBB2D, 0xE42F, 0xBB2D, 0xDBEE, 0xEC2D, 0xF44D,
-    0xDBEE, 0xBB2D, 0xE44E, 0xEC2D, 0xEC2D, 0xD3AD, 0xBB0D, 0xE40E,
-    0xF42D, 0xEC4E, 0xC36D, 0xCB8E, 0xE44F, 0xBB2D, 0xE46F, 0xBB4D,
-    0xD3EE, 0xDBEE, 0xBB2D, 0xD40F, 0x9A8D, 0xCBCF, 0x92EE, 0x5A0F,
-    0x624F, 0x6A4E, 0xD430, 0xAB0E, 0xD3EE, 0xE40E, 0xBB2D, 0xE44F,
-    0xBB0C, 0xEC4E, 0xC36D, 0xCB6D, 0xF44E, 0xBB2C, 0xFC8E, 0xCB6D,
-    0xD3CE, 0xD3CE, 0xBB2D, 0xE44F, 0xBB0C, 0xE40E, 0xCB8D, 0xCB8D,
-    0xDC2E, 0xBB2D, 0xE44F, 0xC34D, 0xD3CE, 0xDBEE, 0xBB2D, 0xEC6E,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDD1, 0xF48D,
-    0xF42C, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42D, 0xF42C, 0xF42C, 0xF42D, 0xF42C, 0xF42C, 0xF44D, 0xC34D,
-    0xB30E, 0xB30E, 0xC34D, 0xF44D, 0xF42C, 0xF42C, 0xF42D, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF44D, 0xF42C, 0xFC4C,
-    0xCB6D, 0xCBAE, 0xE42F, 0xAB0E, 0xB32E, 0xB32E, 0xB32E, 0xB32F,
-    0xB32E, 0xAB2E, 0xAB0D, 0xDBED, 0xEC2D, 0xEC2D, 0xEC2D, 0xEC0D,
-    0xF44D, 0xBB2C, 0xDBCD, 0xDBED, 0xBB2C, 0xF44E, 0xB30C, 0xEC2E,
-    0xCB8D, 0xCB8D, 0xEC0D, 0xBB0C, 0xF44E, 0xBB2C, 0xD3AD, 0xDBCD,
-    0xBB4D, 0xF46E, 0xBB2C, 0xEC0D, 0xCB6D, 0xCB8D, 0xE40E, 0xB2EC,
-    0xEC4E, 0xBB2C, 0xDBED, 0xDBCD, 0xBB2C, 0xF44D, 0xB30C, 0xEC2E,
-    0xCB8D, 0xCB6D, 0xE42D, 0xB30C, 0xF44E, 0xBB2C, 0xDBAD, 0xDBCD,
-    0xBB2C, 0xF46E, 0xBB0C, 0xEC0D, 0xCB6D, 0xCB6D, 0xEC2E, 0xB2ED,
-    0xEC2D, 0xBB0C, 0xDBAD, 0xDBAD, 0xBB0C, 0xF42D, 0xBAEC, 0xE40D,
-    0xF44D, 0xF44D, 0xE3ED, 0xBB0C, 0xF44D, 0xF44D, 0xF44D, 0xD3AD,
-    0xBB2C, 0xF44D, 0xF42D, 0xF44D, 0xCB6C, 0xCB6C, 0xFC4D, 0xF42D,
-    0xF44D, 0xC32C, 0xDBAD, 0xFC4D, 0xF42C, 0xF42C, 0xF42D, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF44D, 0xF42C, 0xF44D, 0xF42D, 0xEC2D, 0xDBEE, 0xAAEE,
-    0xB30E, 0xB30F, 0xB32E, 0xBB2E, 0xB32E, 0xB32E, 0xB32E, 0xB32E,
-    0xDBED, 0xFC4D, 0xE3ED, 0xB2EC, 0xEC2E, 0xBB0C, 0xDBAD, 0xDBCD,
-    0xC34D, 0xF46E, 0xB30D, 0xEC2E, 0xCB6D, 0xCB4D, 0xE40D, 0xB2CC,
-    0xEC2D, 0xBB0C, 0xDBCD, 0xDBCD, 0xBB2C, 0xEC6E, 0xB30D, 0xE42E,
-    0xC36D, 0xC36D, 0xCBEF, 0x6A0E, 0x6A2F, 0x620E, 0x6A2F, 0x6A50,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x620F, 0xB34E, 0xF44E, 0xDBCD, 0xB2ED,
-    0xDC0E, 0xE40E, 0xBB6E, 0xBB6E, 0xEC2E, 0xE40E, 0xEC0D, 0xFC6D,
-    0xCB6D, 0xCB6D, 0xE40E, 0xB2EC, 0xF44E, 0xC32C, 0xDBCD, 0xDBCD,
-    0xBB2D, 0xEC4E, 0xB2EC, 0xEC2E, 0xD38D, 0xCB6D, 0xEC2E, 0xAAED,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDB0,
-    0xFDD0, 0xF50E, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42D,
-    0xEC2D, 0xF42D, 0xF42D, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF44D, 0xD3CD, 0xB30E, 0xB30E, 0xB30E, 0xAB0E, 0xB30E, 0xAB0E,
-    0xAB0E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xBB4D,
-    0xEC2D, 0xF42D, 0xF40D, 0xF42D, 0xF42D, 0xF42D, 0xEC2D, 0xF42D,
-    0xF44D, 0xF42D, 0xF44D, 0xEC2D, 0xF42D, 0xEC4D, 0xF44D, 0xF44D,
-    0xEC4D, 0xF42D, 0xEC2D, 0xF42D, 0xF42D, 0xF42D, 0xF42D, 0xEC2D,
-    0xF44D, 0xEC2D, 0xEC2D, 0xEC2D, 0xEC2D, 0xF42D, 0xEC4D, 0xF44D,
-    0xF44D, 0xF44D, 0xF44D, 0xEC4E, 0xF44D, 0xEC2D, 0xF42D, 0xEC2D,
-    0xEC2D, 0xF44D, 0xEC4E, 0xF42D, 0xF44D, 0xEC4D, 0xF44D, 0xEC4E,
-    0xF44D, 0xEC2D, 0xF42D, 0xF42D, 0xF44D, 0xF44D, 0xEC2D, 0xF42D,
-    0xF42D, 0xF44D, 0xF44D, 0xF44D, 0xF44D, 0xF44D, 0xF42D, 0xF42D,
-    0xF42D, 0xF42D, 0xF44D, 0xF44C, 0xF44D, 0xF44D, 0xF42C, 0xF42D,
-    0xF42C, 0xF42D, 0xF42D, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xFC4D, 0xCB8D, 0xB30E, 0xB32E, 0xB30F,
-    0xB30F, 0xAAEE, 0xD3AD, 0xF44D, 0xEC2D, 0xF40D, 0xF42D, 0xEC0D,
-    0xF44D, 0xF44D, 0xF42D, 0xEC2D, 0xF42C, 0xEC0D, 0xF40C, 0xF42D,
-    0xEC2D, 0xF44D, 0xEC4E, 0xF44D, 0xF44D, 0xEC2D, 0xEC0C, 0xEC0D,
-    0xF40C, 0xEC2D, 0xF46D, 0xF46E, 0xEC4E, 0xF44D, 0xEC4E, 0xEC4E,
-    0xF46E, 0xBB8F, 0x6A2E, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A2F,
-    0x6A4F, 0x6A4F, 0x6A50, 0x6A50, 0x6A2F, 0xA30E, 0xF44E, 0xDBEF,
-    0x7A6E, 0x724F, 0x6A4F, 0x724F, 0x724E, 0x7A6E, 0xBB4E, 0xEC0D,
-    0xEC2D, 0xEC2D, 0xF42D, 0xEC2D, 0xF44D, 0xEC4E, 0xF44D, 0xF44D,
-    0xEC4E, 0xF44D, 0xEC2E, 0xF42D, 0xF42D, 0xEC2D, 0xF42D, 0xEC2E,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF1, 0xFDB0, 0xFD90, 0xFD6F, 0xF42C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xEC2D, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE40D,
-    0xD3CE, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xB32E, 0xAB0E, 0xB32E,
-    0xF44D, 0xFC6D, 0xFC4D, 0xDBAD, 0xC34C, 0xEC2D, 0xBB2C, 0xEC2D,
-    0xD3AD, 0xD38C, 0xEC0D, 0xBB2C, 0xF44D, 0xC36D, 0xDBED, 0xDBED,
-    0xC36C, 0xF42D, 0xBB2C, 0xEC0D, 0xD38C, 0xD3AD, 0xEC2D, 0xBB4C,
-    0xF42D, 0xC34C, 0xDBCD, 0xDBCD, 0xC34C, 0xEC2D, 0xBB2C, 0xEC2D,
-    0xD3AD, 0xD38D, 0xEC2D, 0xBB2C, 0xEC2D, 0xC32C, 0xDBAD, 0xDBCD,
-    0xC32C, 0xEC2D, 0xBB2C, 0xEC0D, 0xD3AD, 0xD3AD, 0xEC4E, 0xBB4D,
-    0xBB6E, 0xBB6E, 0xBB4D, 0xBB6D, 0xC36E, 0xBB6E, 0xBB4D, 0xEC2D,
-    0xD3AD, 0xD38D, 0xEC0D, 0xBB2C, 0xF44D, 0xC34C, 0xDBCD, 0xDBCD,
-    0xC34C, 0xEC2D, 0xBB2C, 0xEC2D, 0xD3AD, 0xD3AD, 0xEC0D, 0xBB0C,
-    0xEC0D, 0xCB6C, 0xDBAD, 0xFC4C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xC34D, 0xAB0D, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xD3CD, 0xF42D, 0xF42C, 0xF42C, 0xFC2C, 0xF42C, 0xFC4C,
-    0xCB6D, 0xD38D, 0xEC0D, 0xBB2D, 0xEC2D, 0xC32C, 0xDBAC, 0xDBAC,
-    0xC34C, 0xEC4D, 0xC34D, 0xEC4E, 0xCBAD, 0xD3AD, 0xEC2E, 0xBB2C,
-    0xF44D, 0xA30D, 0x828E, 0x8AAE, 0x8AAE, 0x828E, 0x8AAE, 0x8AAE,
-    0x8AAE, 0x7A8F, 0x622F, 0x6A4F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A2F,
-    0x6A2F, 0x6A4F, 0x6A4F, 0x6A50, 0x622F, 0x726F, 0x828E, 0x828E,
-    0x6A2F, 0x622F, 0x622F, 0x624F, 0x622F, 0x6A4F, 0x7A6E, 0xE40E,
-    0xD3AD, 0xCB8D, 0xEC2E, 0xBB2C, 0xEC2D, 0xC34C, 0xDBCD, 0xDBED,
-    0xC36D, 0xEC2D, 0xBB4C, 0xEC0D, 0xCB8D, 0xCB8D, 0xEC2D, 0xBB2D,
-    0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDF1, 0xFDF1, 0xFDF0, 0xF52F, 0xF52F, 0xF52E, 0xF52F,
-    0xF4CE, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF4EE,
-    0xF52F, 0xF52F, 0xF4EE, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF44C, 0xFC4C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC4C,
-    0xF42C, 0xDBCD, 0xDBCD, 0xDBCD, 0xBB4E, 0xAAEE, 0xAB0E, 0xAB0E,
-    0xC36E, 0xC36D, 0xE3ED, 0xEBED, 0xD38C, 0xF40D, 0xD38C, 0xEC0D,
-    0xE3ED, 0xE3CD, 0xEC2D, 0xD3AC, 0xF44D, 0xDBCD, 0xEC0D, 0xE40D,
-    0xD3AC, 0xF42D, 0xD38D, 0xEC0D, 0xDBCD, 0xE3ED, 0xF42D, 0xD3AC,
-    0xF42D, 0xD3AC, 0xEBED, 0xEBED, 0xDBAC, 0xF42D, 0xD3AD, 0xEC2D,
-    0xE3ED, 0xDBCD, 0xEC2D, 0xD38D, 0xF42D, 0xDBAC, 0xEC0D, 0xEC2D,
-    0xDBCD, 0xF44D, 0xDBAD, 0xF44D, 0xCB8D, 0xB30E, 0xC38E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAAEE, 0xC36E,
-    0xB32E, 0xCB8E, 0xF44D, 0xDBAD, 0xF42D, 0xDBCD, 0xE3ED, 0xEBEC,
-    0xDBAC, 0xF42D, 0xD3AD, 0xEC2D, 0xE3ED, 0xE3ED, 0xF42D, 0xD38C,
-    0xF40D, 0xDBAC, 0xE3EC, 0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xDBCD, 0xD3AD, 0xDBAD, 0xDBCD, 0xDBCD,
-    0xDBAD, 0xF42C, 0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xDBCD, 0xE3CD, 0xEC0D, 0xD3AD, 0xF42D, 0xD3AD, 0xE3CC, 0xE3CC,
-    0xD38D, 0xF42D, 0xD3AD, 0xF46D, 0xEC4E, 0xC38E, 0x9AEE, 0x8AAE,
-    0x9B0E, 0x6A4F, 0x620F, 0x622F, 0x620F, 0x620F, 0x620F, 0x620F,
-    0x622F, 0x622F, 0x6A4F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F,
-    0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F, 0x6A2F, 0x622F, 0x622F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A4F, 0x622F, 0x92EE,
-    0x8AAE, 0x8A8E, 0xAB2E, 0xDBCD, 0xFC6D, 0xE3ED, 0xF42D, 0xF42D,
-    0xDBAD, 0xF42D, 0xD3AD, 0xEC2D, 0xDBCD, 0xDBCD, 0xEC0D, 0xCB8D,
-    0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFE11,
-    0xFDB0, 0xF4CE, 0xF4EE, 0xF4EE, 0xF4CE, 0xF4EE, 0xF4AD, 0xF40C,
-    0xF42C, 0xF46D, 0xF4CD, 0xF4EE, 0xF4CE, 0xF4CE, 0xF4CE, 0xFDB0,
-    0xFDF1, 0xFDF1, 0xFDB0, 0xF4CE, 0xF4CE, 0xF44C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xFC4C, 0xFC2C, 0xFC4C, 0xDBCD, 0xC36D, 0xCB8D, 0xCB8D,
-    0xC36D, 0xC36D, 0xE3ED, 0xFC4C, 0xFC2C, 0xF40C, 0xFC2C, 0xF42C,
-    0xFC2C, 0xFC4C, 0xF42C, 0xFC4C, 0xF42C, 0xFC4D, 0xFC4C, 0xFC2C,
-    0xFC2C, 0xF40C, 0xFC2C, 0xF42C, 0xFC2C, 0xFC2C, 0xF42C, 0xFC4C,
-    0xF42C, 0xFC4C, 0xF42C, 0xFC2C, 0xFC4C, 0xF42C, 0xFC4C, 0xF42C,
-    0xFC2C, 0xFC2C, 0xF42C, 0xFC2C, 0xF42C, 0xFC4D, 0xE3ED, 0xD3AD,
-    0xDBEE, 0xDBCD, 0xDBED, 0xDBCD, 0xBB6E, 0xAB0E, 0xAB0E, 0xAB2E,
-    0xAB2E, 0xAB2E, 0xAB0E, 0xAB2E, 0xAB2E, 0xAB2E, 0xAB0E, 0xAB0E,
-    0xAAEE, 0xC34E, 0xDBCD, 0xE3ED, 0xF44D, 0xFC6C, 0xF42C, 0xF42C,
-    0xFC2C, 0xF42C, 0xFC2C, 0xF40C, 0xFC2C, 0xFC2C, 0xF42C, 0xFC2C,
-    0xF40C, 0xFC2C, 0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C,
-    0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xFC2C, 0xFC4C, 0xF42C, 0xFC4D, 0xFC4C, 0xFC4C, 0xFC2C, 0xFC2C,
-    0xFC4C, 0xFC2C, 0xFC4D, 0xC36D, 0xBB8E, 0x930F, 0x5A0F, 0x624F,
-    0x5A0F, 0x622F, 0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F,
-    0x6A4F, 0x6A2F, 0x6A4F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F,
-    0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A4F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x6A2F, 0x6A2F, 0x6A2F, 0x620F,
-    0x620F, 0x620F, 0x724E, 0xBB8E, 0xBB4D, 0xBB6E, 0xB34E, 0xD3AD,
-    0xFC4D, 0xF42C, 0xFC4C, 0xF42C, 0xFC2C, 0xFC2C, 0xF42C, 0xFC4C,
-    0xFDD1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFE11, 0xFDB0, 0xF48D,
-    0xF42C, 0xFD0E, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD1, 0xFDF1, 0xFDF1, 0xF48D, 0xF40C, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xFC4C, 0xFC4C, 0xFC4C,
-    0xFC4C, 0xFC4C, 0xFC2C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xD38D, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAAEE, 0xAB0E, 0xAB0E, 0xAB2E, 0xAB2E, 0xAB0E,
-    0xAB0E, 0xAB2E, 0xAB2E, 0xAB2E, 0xAB2E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAAEE, 0xAB0E, 0xDBEE, 0xE3CD, 0xEC0D, 0xF42C,
-    0xF42C, 0xF42C, 0xF46D, 0xF48D, 0xF48D, 0xF48D, 0xF48D, 0xF48D,
-    0xF48D, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42C, 0xFC2C, 0xFC2C, 0xF42D, 0xE3ED, 0xE3ED, 0xE3CD, 0xE3CD,
-    0xDBCD, 0xE3CD, 0xDBED, 0x826D, 0x6A0E, 0x6A4F, 0x6A50, 0x6A50,
-    0x7A8F, 0x7A6F, 0x7A6F, 0x724F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A2F,
-    0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x622F, 0x622F, 0x6A4F, 0x7A6F,
-    0x7A6F, 0x7A6F, 0x7A6F, 0x724F, 0x622F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A0D, 0xAB0D,
-    0xFC4D, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF40C,
-    0xFDF0, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1,
-    0xEC8C, 0xFD8F, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xF4AD, 0xF42C, 0xF44C,
-    0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C,
-    0xF40C, 0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C,
-    0xF44C, 0xF42D, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC4C, 0xE3ED,
-    0xB32E, 0xBB4E, 0xB32E, 0xAB2F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0F,
-    0xAB2F, 0xAB2F, 0xAB2E, 0xAB2E, 0xB32E, 0xB32E, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB30D, 0xB2ED, 0xDBAD, 0xFC4C,
-    0xF40C, 0xF46D, 0xFDD0, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD0, 0xFDD1,
-    0xFDF1, 0xF4AE, 0xF42C, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF44C, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42D, 0xEC2D, 0xF42D, 0xEC0D, 0xB32E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB2F, 0xB34F, 0x92EF, 0x6A4F, 0x7A6F,
-    0xAB50, 0xB32F, 0xB34F, 0x92CF, 0x6A2E, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x622F,
-    0x6A2F, 0x6A2F, 0x6A2F, 0x6A2F, 0x6A4F, 0x6A2F, 0x7A6F, 0xB32F,
-    0xB32F, 0xAB2F, 0xB32F, 0x92CF, 0x6A2E, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x724F, 0x6A4E, 0x7A8F, 0xB34F, 0xB34F, 0xB32F, 0xD3CE, 0xF44D,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xFDF0, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDB0, 0xFDD0,
-    0xFD4F, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF4AD, 0xFDD0, 0xFDB0, 0xFDB0, 0xFDD1, 0xF4AD, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF4CD, 0xFDD0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0,
-    0xFDB0, 0xFD90, 0xF44D, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42D, 0xEC0D, 0xB30D, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xBB4D, 0xF42D, 0xEC0C, 0xEC0C,
-    0xEC0D, 0xEC0D, 0xEC0C, 0xEC0C, 0xEC0D, 0xEC0D, 0xF42C, 0xF40C,
-    0xF46D, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD1, 0xFD2F, 0xF40B, 0xF40C, 0xF40C, 0xFD4F,
-    0xFDD0, 0xFD6F, 0xF48D, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42D, 0xFC4D,
-    0xCB8D, 0xB32E, 0xBB4E, 0xB34E, 0xB32E, 0xB32F, 0xAB2F, 0xAB2F,
-    0xAB2E, 0xAB2E, 0xAB2E, 0xAB0E, 0xAB0E, 0xAB0F, 0xAB0F, 0xAB2F,
-    0xB32E, 0xB32E, 0xB30E, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0E, 0xAB2F, 0x828F, 0x620F,
-    0x6A2F, 0x6A2F, 0x6A2F, 0x620E, 0x8AAF, 0xAB2F, 0xAB0E, 0xB30E,
-    0xB30E, 0xB30E, 0xAB0E, 0xAB0E, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xB32E, 0xB30E, 0xAAEE, 0xD3AD, 0xFC2C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF0, 0xFE11, 0xFD90, 0xF48D, 0xF48D, 0xF48D,
-    0xF48D, 0xF52E, 0xFE11, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF1,
-    0xFDD0, 0xFD6F, 0xFD6F, 0xFD6F, 0xFD6F, 0xFD6F, 0xFD6F, 0xFD4F,
-    0xF42C, 0xF40B, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF3EB, 0xFD0E,
-    0xFDB0, 0xFDD1, 0xFDB0, 0xF46D, 0xF46D, 0xF46D, 0xF44C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C,
-    0xF40B, 0xF3EB, 0xF40C, 0xF3EB, 0xF44C, 0xFD90, 0xFD90, 0xFD90,
-    0xFD70, 0xFDB0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFD90, 0xFD90, 0xF48D, 0xF3EB, 0xF40B, 0xF40B,
-    0xF3EB, 0xF40B, 0xF40B, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xF40C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xFC2C, 0xF42C, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED,
-    0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xEC0C, 0xF42C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF50E, 0xFDB0,
-    0xFDB0, 0xFE11, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF0, 0xFDF0, 0xFDF1, 0xFDB0, 0xFD6F, 0xFD6F, 0xFD6F, 0xFDB0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFD90, 0xFD90, 0xF46D, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xFC2C, 0xF40D, 0xC32D, 0xBB0D,
-    0xB30E, 0xAB0F, 0xAB0F, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB2E, 0xAB2E, 0xB32E, 0xB32E, 0xB32E,
-    0xB30E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB30E,
-    0xB32E, 0xAB2E, 0xB32E, 0xAB2E, 0xAB2E, 0xB32E, 0xA30F, 0x9AEF,
-    0x9AEF, 0x9AEF, 0x9AEF, 0x9AEF, 0xAB0E, 0xB32E, 0xB30E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xB32E, 0xB32E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xDBED, 0xE3ED, 0xEC0C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xFC6D,
-    0xF5D0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF1, 0xFDD0, 0xFDF0, 0xFDF1, 0xFE11, 0xF50E, 0xF4CD, 0xF4CE,
-    0xF4CE, 0xF4CD, 0xF4CD, 0xF4CD, 0xF4CE, 0xF4CD, 0xF4CE, 0xF4CE,
-    0xF4CD, 0xF4CD, 0xF4CE, 0xF4CE, 0xF48D, 0xF40C, 0xF40C, 0xF42C,
-    0xF3EB, 0xF42C, 0xF4AD, 0xF4CE, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0,
-    0xFD2F, 0xFD0F, 0xFD2F, 0xFD2F, 0xFD2F, 0xFD2F, 0xFD2F, 0xFDD0,
-    0xFD4F, 0xF4CE, 0xF4AD, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF40B, 0xF3EB, 0xF48D, 0xFD2F, 0xFD2F,
-    0xFD2F, 0xFD2E, 0xFD2E, 0xFD2E, 0xFD4F, 0xFE11, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF1, 0xFDF1, 0xFDF0, 0xFD6F, 0xFD0E, 0xFD2E, 0xFD2E,
-    0xFD4F, 0xFD4F, 0xFD6F, 0xF4CE, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF40B, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C,
-    0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF48D, 0xF4EE,
-    0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4EE,
-    0xFDF1, 0xFE11, 0xFDF1, 0xFE11, 0xFE11, 0xFE11, 0xFE11, 0xFDF0,
-    0xFDF1, 0xFD8F, 0xF4CE, 0xF4CE, 0xF4CE, 0xF44C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xFC4C, 0xFC4C,
-    0xF42C, 0xFC2C, 0xDBAC, 0xC32D, 0xD38D, 0xF42D, 0xDBAD, 0xD3AD,
-    0xDBAD, 0xDBAD, 0xDBAD, 0xDBAD, 0xDBAD, 0xDBAD, 0xDBCD, 0xDBCD,
-    0xDBCD, 0xDBCD, 0xDBCE, 0xB32E, 0xAAEE, 0xAB0E, 0xB30E, 0xB32E,
-    0xB30E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xAB2E, 0xAB0E, 0xAB0F,
-    0xAB0E, 0xAB0E, 0xAB2E, 0xAB2E, 0xAB0E, 0xAB0E, 0xB32E, 0xB32E,
-    0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32E, 0xB32F, 0xB32E,
-    0xAB0E, 0xAB2E, 0xAB2E, 0xAB0E, 0xAAEE, 0xB30E, 0xD3CE, 0xDBCD,
-    0xDBAD, 0xDBAD, 0xDBAD, 0xDBCD, 0xF42C, 0xFC2C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xFC4D, 0xDBEC, 0x7A28,
-    0xFE31, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFDB0, 0xF50E, 0xF50E, 0xF42C, 0xF3EB, 0xF40B,
-    0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40B,
-    0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF3EB, 0xF40B, 0xF40C, 0xF40B,
-    0xF48D, 0xF4CE, 0xF4AD, 0xF4CE, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFE11, 0xFE11, 0xFE11, 0xFDF1, 0xFD4F,
-    0xF44C, 0xF3EB, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF4CD, 0xF4CE, 0xF54F, 0xFE11, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xF570, 0xFD50, 0xFD70, 0xF4CE, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF4CE, 0xF4EE, 0xF46C, 0xF40C,
-    0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF3EB,
-    0xF40B, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40B, 0xF40C,
-    0xF50E, 0xF52F, 0xF50E, 0xF52E, 0xF52E, 0xF52E, 0xF52E, 0xFD0E,
-    0xF52E, 0xF4AD, 0xF3EB, 0xF40C, 0xF40B, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xE3ED, 0xD38D, 0xD3AD,
-    0xF40C, 0xFC2C, 0xDBCD, 0xC34D, 0xD38D, 0xF42C, 0xFC4C, 0xFC4C,
-    0xFC4C, 0xFC4C, 0xFC4C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C,
-    0xFC4C, 0xFC2C, 0xFC4D, 0xD3AD, 0xCB8D, 0xBB4E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0F, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB2E, 0xB32E, 0xB32E, 0xB32E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB32E, 0xB30E, 0xB30E, 0xB32E, 0xB32E, 0xB30E, 0xAB0F,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xBB2E, 0xCB8D, 0xCB8D, 0xF42D, 0xFC2C,
-    0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xFC4D, 0xE3EC, 0x8A89, 0x30E5,
-    0xBC8E, 0xED90, 0xFDF1, 0xFDD1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFD90, 0xF46C, 0xF46C, 0xF48D, 0xF48D, 0xF46C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF44C, 0xF48D, 0xF48D, 0xF48D, 0xF46C,
-    0xFD6F, 0xFE11, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xFDB0, 0xFD6F, 0xFD70, 0xFD2F, 0xF42C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF40C, 0xF40C, 0xF40C, 0xFD2E, 0xFDD0, 0xFDF1, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDD1,
-    0xF4AD, 0xF48D, 0xF48D, 0xF46D, 0xF48D, 0xF48D, 0xF46D, 0xF48D,
-    0xF48D, 0xF48D, 0xF48D, 0xF48D, 0xFD6F, 0xFD90, 0xF48D, 0xF3EB,
-    0xF40B, 0xF40B, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40C, 0xF40C,
-    0xF40B, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xDBCD, 0xBB0D, 0xC32C,
-    0xEC0C, 0xF40C, 0xF42C, 0xFC4D, 0xFC4C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xFC4D, 0xE3ED, 0xBB4D, 0xC34E,
-    0xC34D, 0xC34D, 0xC34E, 0xC34D, 0xBB4E, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB2E, 0xB32E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB32E, 0xB30E, 0xAB0E, 0xAB0E, 0xAB0E, 0xB32E, 0xC34E,
-    0xC34E, 0xC34E, 0xBB4D, 0xD3AD, 0xFC4D, 0xFC2C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xDBEC, 0x8248, 0x30C5, 0x4127,
-    0x0004, 0xC4AF, 0xFE31, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFD2F,
-    0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C,
-    0xF42C, 0xF44C, 0xF42C, 0xF4EE, 0xFDF1, 0xFDF0, 0xFDD1, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0, 0xFDB0,
-    0xFDD0, 0xFDB0, 0xFDD0, 0xF50E, 0xF40B, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C,
-    0xF44C, 0xF44C, 0xF44C, 0xEC0B, 0xF52E, 0xFDF1, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD1, 0xFDD0, 0xFDD0,
-    0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDD1, 0xFDF1, 0xFDD0, 0xEC6C, 0xEC2B, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC2D, 0xF42D,
-    0xF42C, 0xF42C, 0xF42C, 0xFC4D, 0xE3ED, 0xB30D, 0xB32E, 0xB32E,
-    0xB32E, 0xB30E, 0xB32E, 0xB32E, 0xB30E, 0xB32E, 0xB32E, 0xB30E,
-    0xB30E, 0xB30E, 0xB32E, 0xB32E, 0xB32E, 0xB30E, 0xC36D, 0xF42D,
-    0xF42C, 0xF42D, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF44D, 0x7A28, 0x30C5, 0x3927, 0x1846,
-    0x1066, 0xC4F0, 0xFE32, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0,
-    0xFDB0, 0xFDB0, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFD90, 0xEC4C,
-    0xF44C, 0xF44C, 0xEC4C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40B, 0xF4CD, 0xFDF1, 0xFDD0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0,
-    0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFD2E,
-    0xF42B, 0xF44C, 0xF44C, 0xF42C, 0xFD4F, 0xFE11, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0, 0xFDB0,
-    0xFDB0, 0xFDB0, 0xFDB0, 0xFDD1, 0xF4EE, 0xF40C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF44D, 0xF44D, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xEC2D, 0xEC0D, 0xF42D,
-    0xCB8D, 0xAB0E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E, 0xB30E,
-    0xB30E, 0xB32D, 0xE40D, 0xEC0D, 0xEC0C, 0xEC0D, 0xEC0C, 0xF42C,
-    0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF40C, 0xF44D, 0x7A27, 0x61C6, 0x7248, 0x59E8, 0x1046,
-    0x214A, 0x31AA, 0xC4CF, 0xFE72, 0xF5B0, 0xFDD0, 0xFDD0, 0xFDD1,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD1, 0xFDF1, 0xFDF0, 0xFDD1, 0xFDD0, 0xFD6F,
-    0xFD6F, 0xFD6F, 0xFD6F, 0xFD6F, 0xFD8F, 0xFD8F, 0xFD90, 0xFD90,
-    0xFD6F, 0xFDB0, 0xFE11, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF0, 0xFDF0, 0xFE11, 0xFE11, 0xFE11, 0xF4EE, 0xF46C, 0xF44C,
-    0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF46C, 0xF52F, 0xFE11, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xF4CE, 0xF48D, 0xF48D, 0xF48D,
-    0xF48D, 0xF48D, 0xF48D, 0xF46D, 0xF52F, 0xFDB0, 0xFD90, 0xFD90,
-    0xFD90, 0xF46D, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF3EB, 0xF4CE, 0xFD90,
-    0xFD6F, 0xFD6F, 0xFD8F, 0xFD6F, 0xFD90, 0xF4EE, 0xF3EB, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40B, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF40C, 0xF40C, 0xFC2C, 0xFC6D, 0xE40E, 0x826D, 0x620B, 0xDC0D,
-    0xFC8D, 0xFC4D, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC4C,
-    0xEC0D, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED, 0xE3ED,
-    0xE3ED, 0xEBED, 0xF42C, 0xF42C, 0xFC2C, 0xF42C, 0xF42C, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xFC6D, 0xF42D, 0x9AC8, 0x7227, 0x7227, 0x59A6, 0x20A6, 0x1066,
-    0x216B, 0x112A, 0x41EA, 0xAC2D, 0xFE72, 0xFE11, 0xFDD0, 0xF5D0,
-    0xFDD0, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xFDF0, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDB0, 0xF4AD, 0xF4CD, 0xF48D,
-    0xFD6F, 0xFD8F, 0xF48D, 0xF4AD, 0xF4AD, 0xF40C, 0xF3EB, 0xF42C,
-    0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF44C, 0xF4CD, 0xF4CD,
-    0xF4CE, 0xF4AD, 0xFD6F, 0xFDF1, 0xFDF1, 0xFDF1, 0xFE11, 0xFD2F,
-    0xF4CE, 0xF4EE, 0xF4CE, 0xF4CD, 0xF42C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF48D, 0xF4EE, 0xF4CD, 0xF4CD,
-    0xF4CE, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40B, 0xF40B,
-    0xF40B, 0xF3EB, 0xF44C, 0xFD2F, 0xFD2F, 0xF50F, 0xFD90, 0xFE11,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFE11, 0xFDB0, 0xF52F, 0xFD2F,
-    0xFD2F, 0xF44C, 0xF3EB, 0xF40B, 0xF3EB, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40B, 0xF4EE, 0xFD4F, 0xF52F,
-    0xF52E, 0xFD2E, 0xFD2F, 0xF44C, 0xF3EC, 0xF42C, 0xF44C, 0xF42C,
-    0xF3EB, 0xFC2C, 0xAB0B, 0x724B, 0x6A4C, 0x49AD, 0x212B, 0x5A2B,
-    0x6A4B, 0xAB4C, 0xFCAD, 0xFC4D, 0xFC6D, 0xFC6D, 0xFC6D, 0xFC6C,
-    0xFC4C, 0xFC4C, 0xFC6C, 0xF42C, 0xF42C, 0xF40C, 0xF40B, 0xF42C,
-    0xF40C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF40C, 0xF42C, 0xF40C,
-    0xF42C, 0xFC2C, 0xF40C, 0xFC2C, 0xF40C, 0xFC2C, 0xFC0C, 0xFC0C,
-    0xFC2C, 0xF40C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xFC4D, 0xDBCB,
-    0xAAE9, 0xA309, 0x7226, 0x7226, 0x7A67, 0x4966, 0x0826, 0x1066,
-    0x194B, 0x218B, 0x0046, 0x3126, 0xA40D, 0xAC0C, 0xFE11, 0xFE31,
-    0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDD1, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDB0, 0xF4CD, 0xF4CE, 0xF4AD,
-    0xFD8F, 0xFD8F, 0xF48D, 0xF4AD, 0xF4AD, 0xF4CE, 0xF46D, 0xF3EC,
-    0xF44C, 0xF4EE, 0xF4EE, 0xF4EE, 0xF44D, 0xF3EB, 0xF3EB, 0xF3EB,
-    0xF3EB, 0xF3CB, 0xF48D, 0xF50E, 0xF50E, 0xF50E, 0xF50E, 0xF50F,
-    0xF44C, 0xF3EB, 0xF40B, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42B, 0xF40B, 0xF40B, 0xF3EB,
-    0xF3EB, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF4CE, 0xF4EE,
-    0xF4CE, 0xF4CD, 0xF50E, 0xFE11, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFE11, 0xF52E, 0xF4EE, 0xF50E, 0xF4CE, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF46D, 0xF4EE, 0xF4EE, 0xF4EE, 0xFDB0, 0xFE11, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xF50E, 0xF4CE, 0xF4AD, 0xF40C, 0xF42C,
-    0xF4AD, 0xFC6D, 0x6A4A, 0x08AA, 0x418C, 0x6A8D, 0x296B, 0x214B,
-    0x10EA, 0x49EB, 0xA34C, 0x9B0B, 0x9B0C, 0x9B0C, 0x9AEC, 0x9AEC,
-    0x9B0C, 0x9B0C, 0x9B0B, 0xE40D, 0xFC4C, 0xF48D, 0xF4AD, 0xF40C,
-    0xF4EE, 0xF42C, 0xF48D, 0xF4AD, 0xF42C, 0xF4EE, 0xF40C, 0xF4CE,
-    0xF46D, 0xF46D, 0xF4CE, 0xF42C, 0xF4CE, 0xF42C, 0xF48D, 0xF48E,
-    0xF44C, 0xF4CE, 0xF40C, 0xF4CE, 0xF46D, 0xF46D, 0xF4CE, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xFC4D, 0xDBCB, 0x9AC8,
-    0x6A26, 0x7226, 0x7A47, 0x7227, 0x7A67, 0x5187, 0x0846, 0x1066,
-    0x194A, 0x196B, 0x18E8, 0x0866, 0x0004, 0x1065, 0xB48F, 0xC4AE,
-    0xE550, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFE11, 0xFDF1, 0xFE11,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFE11, 0xFE11, 0xFE11, 0xF52E, 0xF46C,
-    0xF50E, 0xFE11, 0xFDF1, 0xFE11, 0xF52E, 0xF46D, 0xF48D, 0xF48D,
-    0xF48D, 0xF48D, 0xF48C, 0xF46C, 0xF46C, 0xF46C, 0xEC6C, 0xFDD1,
-    0xF52F, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF40C,
-    0xF48D, 0xF48D, 0xF48D, 0xF48D, 0xF48D, 0xF4AD, 0xFDF1, 0xFE11,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFDB0, 0xFD90, 0xFD2F, 0xF40C, 0xF46D, 0xF48D,
-    0xF48D, 0xF52F, 0xFE11, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE11, 0xFD70, 0xF48D, 0xF4CE,
-    0xFDD1, 0xDC4E, 0x51EA, 0x316B, 0x930D, 0xABAF, 0x318B, 0x39AD,
-    0x298C, 0x192A, 0x110A, 0x10EA, 0x10EA, 0x10EA, 0x10EA, 0x10EA,
-    0x110A, 0x110A, 0x10E9, 0xA34D, 0xCBAC, 0xDC6E, 0xFD90, 0xEC8D,
-    0xFD90, 0xF4AD, 0xF52F, 0xF52F, 0xF4CD, 0xFD90, 0xF48D, 0xFD70,
-    0xF4EE, 0xF4EE, 0xFD70, 0xF4AD, 0xFDB0, 0xF4AD, 0xF52F, 0xF54F,
-    0xF4CD, 0xFDB0, 0xF4AD, 0xFD70, 0xF4EE, 0xF4EE, 0xFD6F, 0xF48D,
-    0xF40C, 0xF46D, 0xF44C, 0xF44C, 0xF48D, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xE40C, 0x9AC8, 0x7226,
-    0x7A67, 0x7A47, 0x7A47, 0x7A47, 0x6A27, 0x3927, 0x1046, 0x1066,
-    0x194B, 0x194A, 0x196B, 0x1909, 0x1086, 0x1067, 0x1046, 0x0004,
-    0x8B4C, 0xF5F1, 0xF5B0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0,
-    0xFDF1, 0xFD4F, 0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C,
-    0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF46C,
-    0xFDD0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xF4CE, 0xEC0B, 0xF42C, 0xF44C, 0xFDD0, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD1,
-    0xDCAF, 0x51EB, 0x18C9, 0x624B, 0xBBCE, 0xA36D, 0x318B, 0x296C,
-    0x214B, 0x194B, 0x214B, 0x214B, 0x194B, 0x194B, 0x214B, 0x214B,
-    0x214B, 0x214B, 0x216B, 0x214B, 0x10EA, 0x7A8B, 0xFD0E, 0xFDB1,
-    0xEC6C, 0xFD70, 0xF4CE, 0xECCD, 0xFDB0, 0xEC6D, 0xFDD1, 0xECAD,
-    0xF54F, 0xF52F, 0xEC8C, 0xFDD1, 0xEC8D, 0xFDB0, 0xF4EE, 0xF4EE,
-    0xFDB0, 0xEC6C, 0xFDD1, 0xECAD, 0xF52F, 0xF54F, 0xEC8D, 0xFDB0,
-    0xEC6C, 0xFD90, 0xF4EE, 0xF4CE, 0xFDB0, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0x9287, 0x7226, 0x7A67,
-    0x7A47, 0x7A47, 0x7A47, 0x7267, 0x3906, 0x0826, 0x1066, 0x1046,
-    0x194B, 0x194B, 0x194A, 0x194B, 0x1909, 0x1066, 0x1066, 0x1086,
-    0x0844, 0x82EA, 0xFE52, 0xFDF1, 0xFE11, 0xFE11, 0xFE11, 0xFDF1,
-    0xFDB0, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDB0, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDB0, 0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDB0, 0xF5B0, 0xFDD0, 0xE571,
-    0x398A, 0x18EA, 0x72AD, 0xB3CE, 0xB38D, 0xA36D, 0x296A, 0x192A,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192A, 0x398C, 0x39AC,
-    0x192A, 0x214B, 0x194B, 0x214B, 0x10EA, 0x7B4E, 0xFDF2, 0xDC0C,
-    0xFDB1, 0xEC6C, 0xF54F, 0xFD70, 0xECAD, 0xFDF1, 0xEC6C, 0xFDB0,
-    0xF4EE, 0xF4CE, 0xFDB0, 0xEC6C, 0xFDD1, 0xECAD, 0xF54F, 0xF54F,
-    0xECAD, 0xFDD1, 0xEC6C, 0xFD90, 0xF4EE, 0xF4EE, 0xFD90, 0xEC6C,
-    0xFDD1, 0xEC8D, 0xF52F, 0xF54F, 0xEC8D, 0xFDB0, 0xEC2C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40B, 0xF42D, 0x92A8, 0x7227, 0x7A47,
-    0x7A47, 0x7A47, 0x7A67, 0x30E6, 0x1066, 0x1066, 0x1066, 0x1046,
-    0x194A, 0x194A, 0x194A, 0x196B, 0x190A, 0x0846, 0x1066, 0x1066,
-    0x1886, 0x4167, 0x6A28, 0x61E8, 0x4167, 0x4188, 0x3947, 0x8B6C,
-    0xFEB3, 0xFE31, 0xFE52, 0xFDF0, 0xFDD0, 0xFDF1, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFE31,
-    0xFE31, 0xFE31, 0xFE32, 0xFE11, 0xF5D0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xFE31, 0xFE31, 0xFE32, 0xFDF1, 0xFDD0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE31, 0xDD0F, 0x49EA,
-    0x192A, 0x7ACD, 0xB3CE, 0xBBCE, 0xBBCD, 0xB3AE, 0x296A, 0x192A,
-    0x194A, 0x194A, 0x194B, 0x194B, 0x194B, 0x39AC, 0x51EE, 0x41AD,
-    0x194A, 0x194B, 0x192B, 0x194B, 0x192B, 0x31AB, 0x4A0B, 0x5A0A,
-    0xECEE, 0xFD90, 0xECEF, 0xF4EE, 0xFD90, 0xEC8D, 0xFD90, 0xF4CE,
-    0xF52F, 0xF52F, 0xF4AD, 0xFD90, 0xEC8D, 0xFD70, 0xF50E, 0xF4EE,
-    0xFD70, 0xEC8D, 0xFDB0, 0xF4AD, 0xF54F, 0xF52F, 0xF4AD, 0xFDB0,
-    0xEC8D, 0xFD90, 0xF4EE, 0xF4EE, 0xFD70, 0xEC8D, 0xFD90, 0xF46C,
-    0xF52F, 0xF50F, 0xF44C, 0xFD2F, 0x9AC9, 0x38E5, 0x5186, 0x7A67,
-    0x7A47, 0x7A47, 0x8288, 0x28E6, 0x1046, 0x1066, 0x1066, 0x1066,
-    0x216B, 0x196B, 0x194A, 0x194B, 0x192A, 0x10C8, 0x0846, 0x0845,
-    0x1886, 0x1885, 0x1865, 0x30C6, 0x2085, 0x2086, 0x1866, 0x4168,
-    0x6AAB, 0x626A, 0x6249, 0xE590, 0xFE31, 0xF5D0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0,
-    0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xF5D0, 0xFE11, 0xED91, 0xA38E,
-    0xA3AF, 0x8B8E, 0x732E, 0xB46F, 0xFE51, 0xF5D0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE11, 0xFE51,
-    0xED91, 0x936E, 0x7B2D, 0x62AC, 0xCCF0, 0xFE31, 0xFDB0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD1, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDF1, 0xC46F, 0xA38E, 0x830D, 0x10C9,
-    0x190A, 0x9B4D, 0xC3EE, 0xBBCE, 0xA38D, 0x520B, 0x214A, 0x192A,
-    0x194A, 0x194A, 0x194B, 0x194B, 0x194B, 0x49CD, 0x49CD, 0x296B,
-    0x194A, 0x194B, 0x194B, 0x194B, 0x194B, 0x192A, 0x10EA, 0x212A,
-    0x6A6B, 0xC42E, 0xFD70, 0xFD2F, 0xECEE, 0xF54F, 0xF4EE, 0xF52F,
-    0xF50E, 0xF50E, 0xF52F, 0xF50E, 0xF54F, 0xF50E, 0xF52F, 0xF52F,
-    0xF50E, 0xF52F, 0xF4EE, 0xF54F, 0xF50E, 0xF50E, 0xF52F, 0xF4EE,
-    0xF54F, 0xF4EE, 0xF52F, 0xF50E, 0xF4EE, 0xF52F, 0xF4EE, 0xF54F,
-    0xF52F, 0xF50F, 0xF50F, 0x9B4A, 0x3106, 0x1025, 0x4966, 0x7A67,
-    0x7A47, 0x7247, 0x4146, 0x1886, 0x1046, 0x1066, 0x1066, 0x1067,
-    0x10E9, 0x194A, 0x194B, 0x194A, 0x194B, 0x194A, 0x10A7, 0x10A7,
-    0x0866, 0x0825, 0x1866, 0x4147, 0x4147, 0x4147, 0x4147, 0x30E7,
-    0x1025, 0x1045, 0x1025, 0x72CB, 0xD530, 0xFE31, 0xF5D0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFE31, 0xED91, 0xABCF, 0x61ED,
-    0x620E, 0x31AD, 0x194D, 0x528D, 0xCD10, 0xFE11, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE11, 0xDD30, 0xCCB0,
-    0xB410, 0x59CD, 0x190B, 0x00A9, 0x62CD, 0xD550, 0xFE31, 0xFDD0,
-    0xFDD1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDD1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xF5D0, 0xFE52, 0xA3AF, 0x59AD, 0x51CD, 0x192A,
-    0x190A, 0x930D, 0xBBED, 0xC40E, 0x9B6E, 0x110A, 0x192B, 0x192A,
-    0x192A, 0x194A, 0x194B, 0x194B, 0x192B, 0x49CD, 0x398C, 0x192A,
-    0x194B, 0x194B, 0x194B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B,
-    0x110A, 0x59CA, 0x9B8E, 0xCCAF, 0xF50E, 0xF54F, 0xECCE, 0xF54F,
-    0xF50E, 0xF50E, 0xF54F, 0xF4EE, 0xFD6F, 0xF4EE, 0xF52F, 0xF52F,
-    0xF4EE, 0xFD4F, 0xF4EE, 0xF54F, 0xF50E, 0xF50E, 0xF54F, 0xF4EE,
-    0xFD6F, 0xF4EE, 0xF54F, 0xF52F, 0xF4EE, 0xF54F, 0xF4EE, 0xF52F,
-    0xF50E, 0xE4AE, 0xC42D, 0x61E6, 0x1046, 0x0805, 0x4966, 0x7A67,
-    0x7A47, 0x6A27, 0x1046, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046,
-    0x0845, 0x1909, 0x196B, 0x194A, 0x194A, 0x194A, 0x194B, 0x216B,
-    0x10C8, 0x0846, 0x1866, 0x3907, 0x3926, 0x3926, 0x3906, 0x4947,
-    0x5187, 0x4127, 0x4967, 0x1024, 0x6249, 0xDD50, 0xFDF0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xDD10, 0xDD31, 0xABCF, 0x61ED, 0x726E,
-    0x6A4E, 0x4A0E, 0x41EE, 0x31AD, 0x4A4D, 0xD531, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xE550, 0x8B0E, 0x61ED,
-    0x6A2E, 0x520D, 0x216B, 0x216B, 0x08EA, 0x5A6C, 0xD551, 0xFDF1,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDD0, 0xFDF1, 0xE591, 0x9B8F, 0x6A2E, 0x5A2D, 0x192A,
-    0x190A, 0x930C, 0xBBEE, 0xABAE, 0x7AED, 0x214A, 0x194B, 0x192B,
-    0x192B, 0x192A, 0x192A, 0x194B, 0x214B, 0x49CD, 0x318C, 0x192A,
-    0x192B, 0x194B, 0x192B, 0x296B, 0x214B, 0x192B, 0x192B, 0x194B,
-    0x216B, 0x194B, 0x08A9, 0x62AC, 0xE571, 0xEC6C, 0xFDB1, 0xECAD,
-    0xF54F, 0xF54F, 0xECAD, 0xFDD1, 0xECAD, 0xFD90, 0xF50E, 0xF4EE,
-    0xFD70, 0xEC8D, 0xFDB0, 0xECAD, 0xFD4F, 0xF54F, 0xECAD, 0xFDB0,
-    0xEC8D, 0xFD90, 0xF4EE, 0xF50E, 0xFD90, 0xECAD, 0xFD90, 0xF4CE,
-    0xF50F, 0xBC0C, 0x69C5, 0x59C7, 0x1866, 0x2086, 0x51A6, 0x7A67,
-    0x7A47, 0x6A27, 0x1886, 0x1046, 0x1066, 0x1066, 0x1867, 0x20A7,
-    0x0846, 0x1909, 0x196B, 0x194A, 0x194B, 0x194B, 0x194A, 0x194A,
-    0x194B, 0x10E8, 0x0846, 0x1066, 0x3926, 0x4126, 0x3906, 0x51A7,
-    0x6A28, 0x3906, 0x3926, 0x4968, 0x1045, 0x5209, 0xEDF1, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xF5D0, 0xED91, 0xEDB2, 0x82CD, 0x61CD, 0x6A2E, 0x6A4E, 0x6A4E,
-    0x6A2E, 0x6A4E, 0x5A2E, 0x420E, 0x31CE, 0x31AB, 0xD551, 0xFDD1,
-    0xFDD0, 0xFDD0, 0xF5D0, 0xED91, 0xED91, 0x82AD, 0x620D, 0x726F,
-    0x5A2E, 0x192A, 0x194B, 0x194B, 0x216C, 0x110A, 0x4A2B, 0xE591,
-    0xF5D0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF1, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xEDB1, 0xE591, 0xE591, 0xEDB1, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF1, 0x8AEE, 0x620E, 0x726E, 0x5A0D, 0x192A,
-    0x190A, 0x8B0C, 0xC40E, 0x7AAC, 0x10E9, 0x214B, 0x192B, 0x194B,
-    0x192B, 0x192B, 0x192A, 0x212B, 0x49CD, 0x59EE, 0x318C, 0x192B,
-    0x194B, 0x194B, 0x212A, 0x5A0E, 0x39AC, 0x192A, 0x194B, 0x194B,
-    0x192B, 0x194B, 0x216B, 0x110A, 0x4A0B, 0xEDB2, 0xE44C, 0xFD90,
-    0xECEE, 0xF4EE, 0xFDB1, 0xEC6C, 0xFDD1, 0xEC8D, 0xF54F, 0xF54F,
-    0xEC8D, 0xFDD1, 0xEC6C, 0xFD90, 0xF4CE, 0xF4EE, 0xFD90, 0xEC6C,
-    0xFDD1, 0xEC8D, 0xF54F, 0xF54F, 0xECAD, 0xFDF1, 0xE44C, 0xFDB1,
-    0xA38B, 0x7206, 0x61E8, 0x1046, 0x1047, 0x61E7, 0x7A67, 0x7247,
-    0x7247, 0x61E7, 0x1866, 0x1046, 0x1066, 0x1046, 0x20A6, 0x4147,
-    0x0845, 0x1929, 0x196B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194A,
-    0x196B, 0x10E9, 0x0846, 0x1066, 0x3927, 0x4126, 0x3906, 0x3906,
-    0x4966, 0x7249, 0x4126, 0x4127, 0x28C6, 0x0825, 0x49A8, 0xFDD1,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xF5D0, 0xFE11,
-    0xDD31, 0x726D, 0x728E, 0x6A4E, 0x6A2E, 0x622E, 0x620E, 0x6A4E,
-    0x6A2E, 0x6A4E, 0x49EE, 0x29AD, 0x31CD, 0x29AD, 0x31AB, 0xCD10,
-    0xFE31, 0xFE11, 0xDD51, 0x726C, 0x726D, 0x6A4E, 0x724E, 0x51ED,
-    0x214B, 0x214B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x39AA,
-    0xEDB2, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF2, 0x6AEE, 0x420E, 0x420E, 0x6AEE, 0xFE12,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFE12, 0x8B2F, 0x620E, 0x726E, 0x5A0D, 0x192A,
-    0x190A, 0x8B0C, 0xC3EE, 0x7AAC, 0x190A, 0x214B, 0x192B, 0x214B,
-    0x194B, 0x192B, 0x192B, 0x212A, 0x49AD, 0x51CE, 0x316C, 0x192A,
-    0x194B, 0x212A, 0x5A0D, 0x6A4E, 0x398C, 0x192B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x41CA, 0xF5B2, 0xEC6C,
-    0xF52F, 0xF54F, 0xEC6C, 0xFDB0, 0xEC4B, 0xFD70, 0xECAD, 0xF4EE,
-    0xFD90, 0xEC6C, 0xFDD1, 0xEC8D, 0xFD4F, 0xF52F, 0xEC8D, 0xFDD1,
-    0xEC4C, 0xFD90, 0xF4EE, 0xF4EE, 0xFD90, 0xEC4C, 0xFDD2, 0x9B29,
-    0x7227, 0x5186, 0x1865, 0x1067, 0x1026, 0x61E7, 0x7A67, 0x7A47,
-    0x61E7, 0x1865, 0x1046, 0x1066, 0x1046, 0x20A7, 0x4127, 0x4127,
-    0x0846, 0x0866, 0x1909, 0x196B, 0x194A, 0x194A, 0x194A, 0x194B,
-    0x194B, 0x194A, 0x18E9, 0x1046, 0x1866, 0x3106, 0x4126, 0x3906,
-    0x4126, 0x5167, 0x6A08, 0x4947, 0x3906, 0x1845, 0x4168, 0xFE73,
-    0xFDD0, 0xFDB0, 0xFE31, 0xD4F0, 0x7AAD, 0x934E, 0xFDF2, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xF5D0, 0xFDF1, 0xFE52, 0xD4F0,
-    0x7A8D, 0x6A4E, 0x6A2E, 0x6A2E, 0x724E, 0x520E, 0x41CD, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x624E, 0x41EE, 0x298D, 0x298D, 0x216C, 0x4A4D,
-    0x7AED, 0x8B0E, 0x82EE, 0x6A4E, 0x6A2E, 0x6A4E, 0x726F, 0x49ED,
-    0x110A, 0x194B, 0x194B, 0x192B, 0x194B, 0x194B, 0x192B, 0x194B,
-    0x420B, 0xDD71, 0xFE31, 0xFDB0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1,
-    0xFDF0, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDD0,
-    0xFDF1, 0xF5D2, 0x7B0E, 0x3A0F, 0x31EF, 0x31EF, 0x3A0F, 0x6AEE,
-    0xF5F2, 0xFE52, 0xFDF1, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xED70, 0x930D, 0x6A4E, 0x6A2E, 0x726F, 0x622E, 0x192A,
-    0x212A, 0x8B0D, 0xC3ED, 0x728C, 0x10E9, 0x212B, 0x194B, 0x192A,
-    0x49CD, 0x49CD, 0x192A, 0x214B, 0x49CD, 0x316B, 0x212A, 0x192B,
-    0x296B, 0x5A0D, 0x6A2E, 0x726F, 0x41AC, 0x192A, 0x194B, 0x194B,
-    0x192B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x522B, 0xE551,
-    0xFD4F, 0xF52F, 0xFDD1, 0xF4CE, 0xFDD1, 0xFCEE, 0xFD4F, 0xF50F,
-    0xECCE, 0xFDB0, 0xEC8D, 0xFD90, 0xF4EE, 0xF50E, 0xFD90, 0xEC8D,
-    0xFD90, 0xECAD, 0xF54F, 0xF52F, 0xF4CE, 0xFD91, 0x9B49, 0x7247,
-    0x7A67, 0x51A7, 0x0826, 0x1866, 0x59C7, 0x7A47, 0x7A47, 0x7A67,
-    0x6207, 0x1046, 0x1046, 0x1046, 0x1046, 0x20A7, 0x4147, 0x4127,
-    0x0846, 0x0825, 0x10E8, 0x216B, 0x194A, 0x194A, 0x194A, 0x194B,
-    0x194A, 0x196B, 0x192A, 0x0846, 0x0846, 0x1866, 0x28C6, 0x4126,
-    0x3906, 0x4106, 0x7248, 0x4946, 0x3906, 0x30E6, 0x3927, 0x830B,
-    0xED90, 0xFE31, 0xCCCF, 0x82EE, 0x620E, 0x6A2E, 0x9B6E, 0xED90,
-    0xFE11, 0xF5D0, 0xFDD0, 0xFE11, 0xFE31, 0xBC2F, 0xA3AF, 0x8B0F,
-    0x620E, 0x6A4E, 0x6A4E, 0x724F, 0x5A0E, 0x39CD, 0x39CD, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x726F, 0x520E, 0x218D, 0x298D, 0x29AD, 0x194C,
-    0x49CD, 0x6A2E, 0x6A2E, 0x6A4E, 0x726E, 0x5A2E, 0x41AC, 0x318C,
-    0x298C, 0x192A, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x110A, 0x524C, 0xCD10, 0xFE52, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xFDF1, 0xFDD0, 0xFDD0, 0xFE11,
-    0xF591, 0x9BAF, 0x5A4F, 0x39EF, 0x31EF, 0x3A0F, 0x39EF, 0x31EF,
-    0x7B70, 0x836F, 0xD531, 0xFE51, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xF5D1, 0x6A2C, 0x620E, 0x6A4E, 0x5A0D, 0x318C, 0x214A,
-    0x7ACD, 0xAB8D, 0xC40E, 0x7ACC, 0x10E9, 0x212B, 0x192B, 0x41AC,
-    0x6A4E, 0x51ED, 0x192A, 0x214B, 0x296B, 0x192A, 0x192A, 0x192A,
-    0x316B, 0x726E, 0x6A4E, 0x49CC, 0x294B, 0x192B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x10EA, 0x5AAD,
-    0x6AAC, 0x6A8B, 0x730D, 0x6A4B, 0x732E, 0x624B, 0xC42D, 0xFD90,
-    0xF50F, 0xF4EE, 0xF54F, 0xF4EE, 0xF52F, 0xF52F, 0xF50E, 0xF52F,
-    0xF50E, 0xF52F, 0xF50E, 0xFD2F, 0xECEE, 0xA38A, 0x7226, 0x7A67,
-    0x5186, 0x28C6, 0x0846, 0x1046, 0x7248, 0x7A67, 0x7A67, 0x61E7,
-    0x28C6, 0x1046, 0x1046, 0x1046, 0x0846, 0x2086, 0x4127, 0x4127,
-    0x0846, 0x0845, 0x10E9, 0x216B, 0x194A, 0x194B, 0x194B, 0x194B,
-    0x194A, 0x194B, 0x1909, 0x0846, 0x1046, 0x0826, 0x28C6, 0x4127,
-    0x3907, 0x4126, 0x6A27, 0x59A6, 0x4126, 0x4127, 0x30E6, 0x1865,
-    0xF5D1, 0xDD30, 0x82EE, 0x61ED, 0x724E, 0x6A2E, 0x61ED, 0xA3AF,
-    0xED70, 0xFE31, 0xF5B1, 0xBC4F, 0xBC70, 0x7A8E, 0x61ED, 0x6A2E,
-    0x6A4E, 0x6A4E, 0x6A4E, 0x5A2E, 0x39CD, 0x298D, 0x39CD, 0x6A2E,
-    0x6A2E, 0x724F, 0x622E, 0x39CD, 0x218D, 0x298D, 0x218C, 0x39CD,
-    0x622E, 0x724E, 0x6A4E, 0x6A4E, 0x624E, 0x39CD, 0x190A, 0x214C,
-    0x31EF, 0x192A, 0x192B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x216B, 0x10EA, 0x5AAC, 0xC4EF, 0xFE31, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFE11, 0xF5B1,
-    0xB430, 0x6A6E, 0x7AD0, 0x626F, 0x420F, 0x39EF, 0x3A0F, 0x3A0F,
-    0x31CF, 0x298E, 0x732F, 0xCD11, 0xFE11, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xED70, 0xB40F, 0x724D, 0x620E, 0x6A4E, 0x49CC, 0x110A, 0x214A,
-    0xABCF, 0xBC0E, 0x932D, 0x49EB, 0x190A, 0x192B, 0x190A, 0x5A0D,
-    0x7A8F, 0x49ED, 0x192A, 0x194B, 0x192A, 0x192A, 0x192A, 0x110A,
-    0x296B, 0x6A4E, 0x726F, 0x294B, 0x110A, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x110A,
-    0x110A, 0x110A, 0x10EA, 0x110A, 0x10EA, 0x090A, 0x51EA, 0xC44E,
-    0xFDB0, 0xF4EE, 0xF570, 0xF4EE, 0xF50E, 0xF50E, 0xF4EE, 0xF54F,
-    0xECEE, 0xFD90, 0xFCEE, 0xE48E, 0xABCB, 0x69E5, 0x7A47, 0x59C7,
-    0x20A6, 0x0826, 0x1886, 0x4126, 0x7227, 0x7A47, 0x8287, 0x5187,
-    0x0806, 0x1066, 0x1046, 0x1046, 0x1886, 0x30E6, 0x4127, 0x4127,
-    0x0846, 0x0845, 0x10C8, 0x194A, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194A, 0x194B, 0x1929, 0x0846, 0x1046, 0x0846, 0x20A6, 0x3906,
-    0x3906, 0x4106, 0x7227, 0x7A88, 0x51A7, 0x3907, 0x3907, 0x3106,
-    0xBCAF, 0x6A6C, 0x59CD, 0x726E, 0x6A2E, 0x6A2E, 0x726E, 0x61ED,
-    0xABCF, 0xE571, 0xC490, 0x61ED, 0x61ED, 0x6A2E, 0x6A4E, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x6A4F, 0x39CD, 0x29AD, 0x31AD, 0x49EE, 0x6A2E,
-    0x6A2E, 0x624E, 0x41CD, 0x216C, 0x298D, 0x298D, 0x31AC, 0x622E,
-    0x6A4E, 0x6A4E, 0x6A4E, 0x622E, 0x522E, 0x296B, 0x212B, 0x29AD,
-    0x31EE, 0x192A, 0x192B, 0x192B, 0x194B, 0x194B, 0x192B, 0x194B,
-    0x194B, 0x216B, 0x08CA, 0x524C, 0xD571, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xED90, 0xED91, 0xBC50,
-    0x728E, 0x82EF, 0x7ACF, 0x72D0, 0x524F, 0x31EF, 0x3A0F, 0x3A0F,
-    0x3A0F, 0x3A30, 0x29AF, 0x62CF, 0xDD71, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE11,
-    0xDCF0, 0x59CC, 0x6A2E, 0x6A2E, 0x6A2E, 0x49CC, 0x192B, 0x398B,
-    0x9B6E, 0xC42F, 0x5A2B, 0x10C9, 0x212A, 0x192A, 0x294A, 0x59ED,
-    0x6A2E, 0x41CC, 0x192A, 0x194B, 0x192B, 0x192B, 0x192A, 0x192B,
-    0x39AC, 0x6A4E, 0x5A0D, 0x398C, 0x214B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x214B, 0x214B, 0x214B, 0x214B, 0x214B, 0x216B, 0x110A, 0x520B,
-    0xCC6E, 0xD531, 0xE42C, 0xFDB0, 0xF4CD, 0xF4CD, 0xFD6F, 0xEC4C,
-    0xFDF2, 0xD42C, 0xD40C, 0xA34A, 0x61C5, 0x7247, 0x61E7, 0x1886,
-    0x1046, 0x1046, 0x28A6, 0x8288, 0x7A67, 0x7A47, 0x8287, 0x51A7,
-    0x1046, 0x1066, 0x1066, 0x1046, 0x28C7, 0x4127, 0x4127, 0x4127,
-    0x0866, 0x0866, 0x0845, 0x10C8, 0x216B, 0x194B, 0x194B, 0x194B,
-    0x194A, 0x196B, 0x192A, 0x0866, 0x1046, 0x1066, 0x0846, 0x20A6,
-    0x3927, 0x4106, 0x6A07, 0x7A68, 0x59C7, 0x4127, 0x4127, 0x3907,
-    0x1045, 0x0825, 0x416A, 0x724E, 0x6A2E, 0x6A4E, 0x6A4E, 0x6A4E,
-    0x6A4E, 0x6A2D, 0x6A2D, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x6A4F, 0x39CE, 0x298D, 0x41EE, 0x6A4F, 0x6A2E,
-    0x622E, 0x39AD, 0x216C, 0x298D, 0x298D, 0x298D, 0x624E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x5A2E, 0x31CD, 0x522F, 0x214B, 0x29AD, 0x3A30,
-    0x31EE, 0x192A, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x216B, 0x110A, 0x41EA, 0xEDD2, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD1, 0xC44F, 0x8B0E, 0x7ACF,
-    0x82EF, 0x7AEF, 0x7AF0, 0x4A2F, 0x31EF, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x320F, 0x3A0F, 0x3A10, 0x31CF, 0x5A8D, 0xEDB2, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD1, 0xFDD1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1,
-    0xCCD0, 0x620D, 0x6A2E, 0x6A2E, 0x6A2E, 0x41AC, 0x316B, 0x6A6F,
-    0x7A6E, 0xB3CF, 0x5A4C, 0x190A, 0x194A, 0x212A, 0x622E, 0x724E,
-    0x418C, 0x192A, 0x194B, 0x192B, 0x192B, 0x192B, 0x192A, 0x39AC,
-    0x724F, 0x622E, 0x212A, 0x49CD, 0x318C, 0x192A, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x214B, 0x214B,
-    0x192A, 0x2129, 0x9AEA, 0xE4EF, 0xF52F, 0xF48C, 0xEC8C, 0xFDB1,
-    0xECCE, 0x9B09, 0x7206, 0x6A27, 0x6A07, 0x59E7, 0x1865, 0x1046,
-    0x1066, 0x1046, 0x28C6, 0x7267, 0x7A47, 0x7A47, 0x7A67, 0x4987,
-    0x1046, 0x1066, 0x1066, 0x1066, 0x28C6, 0x4127, 0x4127, 0x4127,
-    0x0866, 0x0866, 0x0845, 0x10C8, 0x194B, 0x194B, 0x194A, 0x194B,
-    0x194B, 0x194A, 0x194A, 0x192A, 0x1066, 0x1046, 0x0846, 0x1886,
-    0x30E6, 0x3906, 0x3906, 0x6A07, 0x7A68, 0x59C7, 0x3906, 0x3907,
-    0x1066, 0x0825, 0x416B, 0x6A4E, 0x6A2E, 0x6A4E, 0x6A4E, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A4E, 0x624F, 0x39AD, 0x29AD, 0x298D, 0x41CD, 0x6A4F, 0x622E,
-    0x318C, 0x216C, 0x216C, 0x39CE, 0x4A2F, 0x298C, 0x624F, 0x6A4E,
-    0x6A4E, 0x5A0E, 0x31AE, 0x29AE, 0x214B, 0x192A, 0x29AE, 0x3A30,
-    0x31EE, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x39CA, 0xE592, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xF5B0, 0xBBEE, 0xABCF, 0x932F, 0x7ACF,
-    0x7AEF, 0x7AF0, 0x4A0E, 0x39EF, 0x3A0F, 0x3A0F, 0x320F, 0x320F,
-    0x320F, 0x3A0F, 0x3A0F, 0x3A0F, 0x31EF, 0x526E, 0xEDB2, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xF5D0, 0xFE31, 0xC470,
-    0x6A2C, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x5A0D, 0x51EE, 0x6A4E,
-    0x6A4E, 0x398B, 0x214A, 0x214B, 0x194B, 0x214A, 0x622E, 0x724E,
-    0x39AC, 0x192A, 0x194B, 0x192B, 0x194B, 0x192A, 0x49CC, 0x6A4E,
-    0x6A2E, 0x622E, 0x212A, 0x49AD, 0x318C, 0x192A, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x214A, 0x214A, 0xA3CD, 0xFDF0, 0xFDF1, 0xF591,
-    0x8AA8, 0x7A47, 0x7A68, 0x4987, 0x1045, 0x1866, 0x1066, 0x1066,
-    0x0826, 0x3926, 0x7268, 0x7A47, 0x7247, 0x7A67, 0x4126, 0x1046,
-    0x1066, 0x1066, 0x1046, 0x30E7, 0x4127, 0x4127, 0x4126, 0x4126,
-    0x0866, 0x0866, 0x0845, 0x10C8, 0x216B, 0x194A, 0x194A, 0x194A,
-    0x194B, 0x194B, 0x194B, 0x194A, 0x1066, 0x1046, 0x0846, 0x20A6,
-    0x3927, 0x3926, 0x3906, 0x6A08, 0x7A88, 0x61C7, 0x3906, 0x3926,
-    0x30E6, 0x1866, 0x1867, 0x416B, 0x726F, 0x6A4E, 0x6A4E, 0x6A2E,
-    0x5A2E, 0x624E, 0x724E, 0x6A2E, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A4E,
-    0x622E, 0x39AD, 0x29AD, 0x298D, 0x41EE, 0x624F, 0x622F, 0x31AD,
-    0x216C, 0x298D, 0x216C, 0x214C, 0x39CD, 0x624F, 0x6A4E, 0x726F,
-    0x520E, 0x31AD, 0x31CE, 0x29AD, 0x194B, 0x192B, 0x29AE, 0x3A30,
-    0x31EE, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x192A, 0x192A, 0x194A, 0x192B, 0x192A, 0x39CA, 0xDD50,
-    0xFE31, 0xFDB0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xFE11, 0xFDF1, 0xB3CF, 0x82CE, 0x7AAF, 0x626F,
-    0x420F, 0x4A2E, 0x6AAF, 0x6AAF, 0x4A4F, 0x31EF, 0x320F, 0x320F,
-    0x320F, 0x3A0F, 0x3A0F, 0x3A0F, 0x31EF, 0x31EF, 0x5A8E, 0xDD71,
-    0xFE72, 0xFE11, 0xF5D0, 0xF5D0, 0xF5B0, 0xFE51, 0xBC4F, 0x726E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x622E, 0x6A2E,
-    0x6A6F, 0x294B, 0x192B, 0x192B, 0x296B, 0x5A2E, 0x6A2E, 0x724E,
-    0x39AC, 0x190A, 0x192A, 0x192B, 0x194B, 0x110A, 0x49CC, 0x726F,
-    0x5A0D, 0x294B, 0x318C, 0x51EE, 0x318C, 0x192A, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x112B, 0x31AB, 0x522B, 0x49EB, 0x520A,
-    0x6A07, 0x7A67, 0x4966, 0x1866, 0x1046, 0x1046, 0x1046, 0x1066,
-    0x0826, 0x4146, 0x8287, 0x7A47, 0x7247, 0x7A67, 0x3926, 0x0826,
-    0x1066, 0x1046, 0x1066, 0x3907, 0x4127, 0x3927, 0x4127, 0x4127,
-    0x0866, 0x0866, 0x0845, 0x0866, 0x10E8, 0x196B, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194B, 0x194A, 0x0846, 0x1046, 0x0846, 0x1866,
-    0x28C6, 0x4147, 0x4127, 0x5187, 0x6A07, 0x59C7, 0x38E6, 0x3906,
-    0x4127, 0x1866, 0x20A7, 0x51A9, 0x7249, 0x722A, 0x722B, 0x92EE,
-    0x728E, 0x41AC, 0x49CC, 0x726F, 0x6A4E, 0x6A4E, 0x724E, 0x5A2E,
-    0x39CD, 0x298D, 0x29AD, 0x41CD, 0x622F, 0x5A0E, 0x39AD, 0x218D,
-    0x298D, 0x10C9, 0x396B, 0x520D, 0x520D, 0x5A2E, 0x726F, 0x4A0E,
-    0x4A0E, 0x41EF, 0x298E, 0x298D, 0x194B, 0x192B, 0x29CE, 0x3A30,
-    0x31EE, 0x192A, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x192A, 0x29AD, 0x216B, 0x192A, 0x194B, 0x192B, 0x110A, 0x524B,
-    0xC4EF, 0xFE52, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFE11, 0xFE11, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0,
-    0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE11, 0xFE31,
-    0xFE31, 0xF590, 0xCC6F, 0xABCF, 0x8B0F, 0x728F, 0x7ACF, 0x5A6F,
-    0x39EF, 0x628F, 0x7ACF, 0x8310, 0x5A6F, 0x31EF, 0x3A0F, 0x320F,
-    0x320F, 0x320F, 0x31EF, 0x31EF, 0x39EF, 0x3A0F, 0x31CF, 0x7330,
-    0x7B6F, 0xB46F, 0xFE51, 0xFDF0, 0xFE31, 0xC46F, 0x7AAE, 0x6A2E,
-    0x726F, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E, 0x622E,
-    0x316B, 0x190A, 0x296B, 0x39AD, 0x49ED, 0x728F, 0x6A4E, 0x724E,
-    0x39AC, 0x110A, 0x192B, 0x192B, 0x192A, 0x41AC, 0x622E, 0x5A0D,
-    0x296B, 0x192A, 0x214B, 0x318C, 0x216B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x216B,
-    0x196B, 0x194B, 0x194B, 0x216B, 0x196C, 0x112B, 0x2929, 0x51A7,
-    0x7A68, 0x4967, 0x1886, 0x1046, 0x1066, 0x1046, 0x1066, 0x1066,
-    0x0826, 0x3926, 0x8287, 0x7A47, 0x7247, 0x7A67, 0x3926, 0x0826,
-    0x1066, 0x1046, 0x1066, 0x3107, 0x4127, 0x4127, 0x3907, 0x20A6,
-    0x0866, 0x0866, 0x0866, 0x0845, 0x0866, 0x10E9, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194A, 0x10C8, 0x1066, 0x1046, 0x0846,
-    0x1066, 0x30E6, 0x4127, 0x3906, 0x59C7, 0x61E7, 0x4126, 0x4126,
-    0x3927, 0x28C7, 0x28C7, 0x3907, 0x51A7, 0x7248, 0x7229, 0x92CC,
-    0x826C, 0x49AA, 0x398A, 0x49ED, 0x6A4E, 0x724E, 0x622E, 0x39CD,
-    0x298D, 0x29AD, 0x298D, 0x49EE, 0x49EE, 0x31AD, 0x214C, 0x190A,
-    0x18EA, 0x3927, 0x4168, 0x498B, 0x418B, 0x41CD, 0x520E, 0x39CD,
-    0x420E, 0x39EE, 0x298D, 0x298D, 0x194B, 0x192B, 0x29CE, 0x3A30,
-    0x31EE, 0x192A, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x192A, 0x320F, 0x31CE, 0x214B, 0x192A, 0x192B, 0x214B, 0x08C9,
-    0x5A8C, 0xCD10, 0xFE31, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFE11, 0xFDF0, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF0, 0xFDF1, 0xDCF0, 0xDD10, 0xFDD1, 0xFE11, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDF0, 0xFDF1, 0xCCD0, 0xC4B0,
-    0xD4F0, 0xCC90, 0x932F, 0x728E, 0x728F, 0x7ACF, 0x6A8F, 0x420E,
-    0x420E, 0x82F0, 0x7ACF, 0x628F, 0x422F, 0x31EF, 0x3A0F, 0x320F,
-    0x320F, 0x320F, 0x31EF, 0x320F, 0x31EF, 0x3A0F, 0x3A0F, 0x31EF,
-    0x218E, 0x5AAF, 0xB470, 0xBC70, 0xA42F, 0x728E, 0x6A4F, 0x5A2E,
-    0x49CC, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x620D, 0x41AC,
-    0x294A, 0x294B, 0x398C, 0x51EE, 0x49ED, 0x49ED, 0x6A4E, 0x726E,
-    0x39AC, 0x110A, 0x192B, 0x192B, 0x192A, 0x5A2D, 0x7A8F, 0x49ED,
-    0x110A, 0x194B, 0x192A, 0x192A, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x214B, 0x18E9,
-    0x18E9, 0x194B, 0x216B, 0x190A, 0x18C9, 0x2928, 0x59E7, 0x7A67,
-    0x4967, 0x1866, 0x1046, 0x1066, 0x1046, 0x1066, 0x1046, 0x2087,
-    0x2086, 0x4966, 0x7A67, 0x7247, 0x7247, 0x8287, 0x4126, 0x0826,
-    0x1066, 0x1066, 0x1046, 0x3107, 0x4127, 0x4127, 0x30E7, 0x0826,
-    0x0866, 0x0866, 0x0846, 0x0846, 0x0846, 0x0846, 0x18E9, 0x194A,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x196B, 0x10A8, 0x1066, 0x1046,
-    0x1046, 0x1046, 0x30E7, 0x3906, 0x51A7, 0x61E7, 0x4967, 0x30E6,
-    0x4127, 0x4147, 0x28C7, 0x1046, 0x20A7, 0x6A29, 0x7229, 0x7209,
-    0x720A, 0x7A4A, 0x6A2A, 0x398A, 0x5A2E, 0x6A6F, 0x41ED, 0x298D,
-    0x31AD, 0x29AD, 0x298D, 0x318C, 0x212A, 0x190A, 0x212A, 0x28E7,
-    0x28C6, 0x7A88, 0x4967, 0x0805, 0x1087, 0x296C, 0x216C, 0x4A0F,
-    0x39CE, 0x218D, 0x29AE, 0x29AE, 0x214B, 0x192B, 0x298D, 0x3A0F,
-    0x31EE, 0x192A, 0x192A, 0x192B, 0x192B, 0x192B, 0x194B, 0x194A,
-    0x192B, 0x31EE, 0x3A30, 0x31CE, 0x194B, 0x194A, 0x194B, 0x216B,
-    0x10EA, 0x524C, 0xDD71, 0xFDF1, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xF5B1, 0xED90, 0xFDF1, 0xFDF0, 0xFDF0,
-    0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0,
-    0xF5D1, 0xD4F1, 0x932F, 0x82EF, 0xAC30, 0xE571, 0xFE11, 0xFDD0,
-    0xFDD0, 0xFDF1, 0xED90, 0xDD10, 0xDD30, 0xD4F1, 0x7ACE, 0x728F,
-    0x82EF, 0x8B0F, 0x7ACF, 0x7ACF, 0x7AAF, 0x6AAF, 0x420E, 0x31CE,
-    0x522E, 0x7ACF, 0x7ACF, 0x420E, 0x31EF, 0x3A0F, 0x320F, 0x320F,
-    0x320F, 0x320F, 0x31EF, 0x320F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x3A10, 0x31EF, 0x31CE, 0x4A50, 0x318C, 0x624E, 0x6A6F, 0x39AC,
-    0x398B, 0x6A6E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x51ED, 0x1909,
-    0x41CD, 0x49CE, 0x49CD, 0x51CD, 0x49CD, 0x212A, 0x624E, 0x726E,
-    0x39AC, 0x192A, 0x192B, 0x192A, 0x192A, 0x5A0D, 0x6A4E, 0x41CC,
-    0x192A, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x190A, 0x190A, 0x18C9, 0x1866,
-    0x28C6, 0x2109, 0x212A, 0x1067, 0x1045, 0x4966, 0x7247, 0x4987,
-    0x1026, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1886, 0x30E7,
-    0x4147, 0x61E7, 0x7A67, 0x7A47, 0x7247, 0x59E7, 0x28E6, 0x0846,
-    0x1066, 0x1066, 0x1886, 0x3907, 0x4127, 0x3907, 0x28C7, 0x1046,
-    0x0866, 0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x1909,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194A, 0x196B, 0x10C8, 0x1046,
-    0x1066, 0x1046, 0x1046, 0x28C6, 0x3906, 0x4126, 0x30E6, 0x1046,
-    0x3927, 0x4127, 0x4147, 0x30E7, 0x2086, 0x4947, 0x6A09, 0x6A09,
-    0x7229, 0x7249, 0x7A69, 0x726A, 0x39AA, 0x5A2E, 0x41ED, 0x298D,
-    0x29AD, 0x29AD, 0x298D, 0x18A8, 0x1046, 0x1046, 0x28E6, 0x7A88,
-    0x7A88, 0x8288, 0x4987, 0x20A6, 0x20A6, 0x1086, 0x216C, 0x420F,
-    0x39CE, 0x29AD, 0x29AE, 0x29AE, 0x216C, 0x214B, 0x192B, 0x29AD,
-    0x31EF, 0x192A, 0x192B, 0x192B, 0x192A, 0x192A, 0x194B, 0x194B,
-    0x192B, 0x31EE, 0x3A10, 0x3A0F, 0x31EF, 0x192B, 0x194B, 0x194B,
-    0x216B, 0x192B, 0x4A2B, 0xEDD2, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDF0, 0xFDD0, 0xFDF0, 0xFDF0, 0xFDD0, 0xFDF0,
-    0xFDD0, 0xFDD0, 0xFE11, 0xCCB0, 0xA38E, 0xF5D1, 0xFDD0, 0xFDD0,
-    0xFDD0, 0xFDF0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF1,
-    0xD4F0, 0x82CE, 0x8B10, 0x524F, 0x29AE, 0x836F, 0xF5F1, 0xFDD0,
-    0xFDD0, 0xF5F1, 0xAC0F, 0x728D, 0x7AAE, 0x7AAE, 0x7ACF, 0x7AEF,
-    0x7ACF, 0x7ACF, 0x7ACF, 0x7ACF, 0x7AD0, 0x420F, 0x31CE, 0x524E,
-    0x7ACF, 0x7AAF, 0x7ACF, 0x420F, 0x31EF, 0x3A0F, 0x320F, 0x320F,
-    0x320F, 0x320F, 0x320F, 0x320F, 0x320F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x39EF, 0x3A0F, 0x3A0F, 0x420F, 0x72AF, 0x726F, 0x316C, 0x398C,
-    0x726F, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x5A0D, 0x212A,
-    0x41AD, 0x49CD, 0x41AD, 0x5A0D, 0x5A2D, 0x212A, 0x624E, 0x726F,
-    0x39AC, 0x192A, 0x192B, 0x192A, 0x192A, 0x5A0E, 0x49AC, 0x212A,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x192A, 0x192A, 0x1066, 0x1046, 0x0825, 0x4987,
-    0x7268, 0x28A6, 0x1866, 0x1047, 0x4147, 0x7248, 0x51A7, 0x0825,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1886, 0x4147, 0x4126,
-    0x61E7, 0x7A67, 0x7A47, 0x7A67, 0x7A67, 0x20A6, 0x0826, 0x1066,
-    0x1046, 0x1866, 0x3927, 0x4127, 0x4127, 0x28C6, 0x1046, 0x1066,
-    0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x1929, 0x0867,
-    0x10E9, 0x196B, 0x194A, 0x194B, 0x194A, 0x196B, 0x10C8, 0x1046,
-    0x1066, 0x1046, 0x1046, 0x1046, 0x28C6, 0x4147, 0x3906, 0x1066,
-    0x1066, 0x3907, 0x4147, 0x4127, 0x3907, 0x4126, 0x4106, 0x3906,
-    0x59C7, 0x7A68, 0x7268, 0x7248, 0x7269, 0x3989, 0x212A, 0x298C,
-    0x31CE, 0x18E9, 0x1088, 0x1887, 0x0825, 0x30E6, 0x7248, 0x7A47,
-    0x7A47, 0x7A47, 0x7A68, 0x59E7, 0x28C5, 0x1086, 0x298C, 0x29AD,
-    0x29AD, 0x29AE, 0x29AE, 0x29AE, 0x31EF, 0x31CE, 0x31CE, 0x31EF,
-    0x31EE, 0x192A, 0x192B, 0x194A, 0x192A, 0x194B, 0x194B, 0x194B,
-    0x192A, 0x31EE, 0x3A10, 0x3A10, 0x31EF, 0x192B, 0x194B, 0x194B,
-    0x194B, 0x214B, 0x214B, 0x39CA, 0xE5B1, 0xFDF0, 0xFDB0, 0xFDD0,
-    0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0,
-    0xFDF1, 0xF5D1, 0xFE11, 0xBC50, 0x620D, 0x82ED, 0xF5F2, 0xFDF0,
-    0xF5D0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFE11, 0xCCB0,
-    0x8AEE, 0x8AEF, 0x8B10, 0x524F, 0x3A0F, 0x3A0F, 0x730E, 0xFDF2,
-    0xFDF2, 0x9B8E, 0x7ACF, 0x7AEF, 0x7ACF, 0x7ACF, 0x7ACF, 0x7ACF,
-    0x7AAF, 0x7ACF, 0x7ACF, 0x7ACF, 0x7AF0, 0x420F, 0x524F, 0x7ACF,
-    0x7AAF, 0x7AAF, 0x7ACF, 0x420F, 0x31EF, 0x320F, 0x320F, 0x320F,
-    0x31EF, 0x320F, 0x320F, 0x320F, 0x320F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x320F, 0x3A0F, 0x41EE, 0x51EE, 0x624E, 0x398B, 0x190A, 0x41AC,
-    0x726F, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A4E, 0x5A0D, 0x210A,
-    0x49CD, 0x49CD, 0x620E, 0x51EC, 0x1909, 0x214A, 0x622E, 0x724F,
-    0x39AC, 0x190A, 0x194B, 0x192B, 0x190A, 0x51ED, 0x6A4F, 0x41CD,
-    0x192A, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x18E9, 0x1067, 0x1067, 0x1066, 0x0825, 0x4166, 0x7A88,
-    0x6A27, 0x30C6, 0x30E7, 0x28A6, 0x59C7, 0x59C7, 0x1046, 0x1067,
-    0x1066, 0x1066, 0x1067, 0x1067, 0x1887, 0x3907, 0x4106, 0x6A07,
-    0x7A67, 0x7A47, 0x7A67, 0x7A68, 0x7A88, 0x28C6, 0x0847, 0x1067,
-    0x1046, 0x1866, 0x3907, 0x4127, 0x4127, 0x28E7, 0x1046, 0x1066,
-    0x0845, 0x0845, 0x0846, 0x0846, 0x0846, 0x0846, 0x0886, 0x1909,
-    0x194A, 0x194A, 0x194A, 0x194B, 0x194A, 0x196B, 0x10C8, 0x1046,
-    0x1066, 0x1066, 0x1046, 0x1046, 0x1066, 0x30E6, 0x3907, 0x1046,
-    0x1067, 0x1866, 0x30E7, 0x4127, 0x30E6, 0x1865, 0x3907, 0x3907,
-    0x4147, 0x4967, 0x4946, 0x4946, 0x4946, 0x3927, 0x3928, 0x28E8,
-    0x1088, 0x1067, 0x1067, 0x0846, 0x4167, 0x7247, 0x7227, 0x7247,
-    0x7247, 0x7A67, 0x59A6, 0x4126, 0x30E6, 0x1046, 0x1088, 0x298D,
-    0x29CE, 0x29AD, 0x29AD, 0x29AE, 0x31EF, 0x298D, 0x214C, 0x29AE,
-    0x3A10, 0x31CE, 0x192B, 0x192A, 0x192A, 0x194B, 0x194B, 0x192B,
-    0x192B, 0x214B, 0x31CE, 0x3A30, 0x31EF, 0x192B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x192B, 0x192A, 0x39CA, 0xD50F, 0xFE51, 0xFDF1,
-    0xFDB0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDF0, 0xFE31,
-    0xBC4F, 0x8AED, 0x82CE, 0x7AAE, 0x6A2E, 0x6A4E, 0x82ED, 0xED71,
-    0xFE11, 0xF5D0, 0xFDD0, 0xFDD0, 0xFDF1, 0xFE31, 0xCC8F, 0x932E,
-    0x8AEF, 0x82EF, 0x522E, 0x3A0F, 0x3A0F, 0x320F, 0x422F, 0x6AEF,
-    0x934F, 0x7ACE, 0x7ACF, 0x7ACF, 0x7AEF, 0x7ACF, 0x41ED, 0x6A8F,
-    0x7AAF, 0x7AAF, 0x7ACF, 0x7AD0, 0x4A2E, 0x31EF, 0x5A6F, 0x7ACF,
-    0x7AAF, 0x72CF, 0x4A0E, 0x39EF, 0x31EF, 0x31EF, 0x320F, 0x31EF,
-    0x320F, 0x320F, 0x320F, 0x320F, 0x320F, 0x320F, 0x3A0F, 0x3A0F,
-    0x31CF, 0x5A6E, 0xA36F, 0x6A6E, 0x294A, 0x10E9, 0x398C, 0x624E,
-    0x6A4E, 0x6A4E, 0x6A4E, 0x726F, 0x726F, 0x51ED, 0x316B, 0x39AC,
-    0x51CD, 0x59ED, 0x398B, 0x214A, 0x190A, 0x212B, 0x6A4E, 0x726F,
-    0x39AC, 0x192A, 0x194B, 0x214B, 0x51ED, 0x6A2E, 0x49AC, 0x214A,
-    0x192B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x196B,
-    0x18E9, 0x1067, 0x1067, 0x1046, 0x0825, 0x4167, 0x7268, 0x6207,
-    0x4126, 0x3906, 0x3906, 0x59C7, 0x8288, 0x51A7, 0x0826, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1046, 0x2086, 0x4127, 0x38E6, 0x6A07,
-    0x8287, 0x8287, 0x6207, 0x20A6, 0x28C6, 0x1866, 0x1066, 0x1066,
-    0x1046, 0x1866, 0x3907, 0x4127, 0x28C6, 0x1866, 0x1066, 0x1066,
-    0x10A8, 0x10E8, 0x0886, 0x0846, 0x0846, 0x0846, 0x0845, 0x1087,
-    0x192A, 0x196B, 0x194A, 0x194A, 0x194A, 0x196B, 0x10C8, 0x1046,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1866, 0x28C7, 0x30E7,
-    0x1066, 0x0846, 0x28C7, 0x4127, 0x3906, 0x20A6, 0x2086, 0x3906,
-    0x4127, 0x3906, 0x3906, 0x3906, 0x3906, 0x4107, 0x4127, 0x3906,
-    0x20A6, 0x1046, 0x1066, 0x1046, 0x28C6, 0x59C7, 0x7A67, 0x7247,
-    0x7247, 0x7A67, 0x4966, 0x30E6, 0x3907, 0x28C7, 0x1066, 0x18C9,
-    0x298C, 0x29CE, 0x298D, 0x298D, 0x216C, 0x31CE, 0x298D, 0x29AD,
-    0x3A30, 0x31EF, 0x194B, 0x192A, 0x192A, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x192A, 0x29AE, 0x3A30, 0x3A0F, 0x29CE, 0x192B, 0x194B,
-    0x194B, 0x192A, 0x192A, 0x194B, 0x10EA, 0x526C, 0x62AC, 0xA40E,
-    0xFE72, 0xFDD0, 0xFDD0, 0xFDD0, 0xFDB0, 0xFE11, 0xEDB1, 0x9BAE,
-    0x7AAE, 0x620D, 0x620E, 0x6A2E, 0x6A4E, 0x6A4E, 0x620D, 0x932E,
-    0xE551, 0xFE11, 0xFDD0, 0xFDD1, 0xBC2F, 0xBC30, 0x934F, 0x82CF,
-    0x8B0F, 0x6A8F, 0x39EF, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A10, 0x39EF,
-    0x6A8F, 0x7AAF, 0x7ACF, 0x7ACF, 0x72CF, 0x524F, 0x31CE, 0x6A8F,
-    0x7ACF, 0x7AAF, 0x728F, 0x4A2F, 0x31EF, 0x29CF, 0x5A6F, 0x7AEF,
-    0x72AF, 0x4A2F, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x320F,
-    0x31EF, 0x320F, 0x320F, 0x320F, 0x320F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x39EF, 0x82EE, 0xAB8E, 0x39AC, 0x190A, 0x296B, 0x59ED, 0x6A4E,
-    0x6A2E, 0x6A4E, 0x726F, 0x418C, 0x5A2E, 0x51ED, 0x210A, 0x49CE,
-    0x49CD, 0x51EE, 0x296B, 0x110A, 0x192B, 0x192A, 0x316B, 0x622E,
-    0x41AC, 0x110A, 0x110A, 0x212A, 0x622E, 0x726F, 0x398C, 0x110A,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x18E9,
-    0x1067, 0x1046, 0x1067, 0x1886, 0x4147, 0x7247, 0x61E7, 0x4126,
-    0x38E6, 0x3906, 0x38E6, 0x7A68, 0x61E7, 0x28A6, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1046, 0x1887, 0x30E7, 0x3906, 0x61E7, 0x7A88,
-    0x6A07, 0x5187, 0x4147, 0x0826, 0x0826, 0x1046, 0x1067, 0x1066,
-    0x1046, 0x1866, 0x3907, 0x4127, 0x20A6, 0x0846, 0x1066, 0x1067,
-    0x08A7, 0x194A, 0x10A7, 0x0825, 0x0846, 0x0846, 0x0846, 0x0825,
-    0x1087, 0x1909, 0x194B, 0x194A, 0x194A, 0x196B, 0x10A8, 0x1066,
-    0x10C8, 0x10A8, 0x1046, 0x1046, 0x1066, 0x1046, 0x1866, 0x30E7,
-    0x1066, 0x1046, 0x2086, 0x30E7, 0x4127, 0x3927, 0x1046, 0x3107,
-    0x4127, 0x3926, 0x3906, 0x4106, 0x4106, 0x3907, 0x3906, 0x4126,
-    0x3907, 0x20A6, 0x1066, 0x1066, 0x0826, 0x20A6, 0x59A7, 0x7A67,
-    0x7247, 0x7A47, 0x5186, 0x38E6, 0x4126, 0x3927, 0x1867, 0x1047,
-    0x18A9, 0x214B, 0x298D, 0x298D, 0x194B, 0x31CE, 0x29AD, 0x29AE,
-    0x3A30, 0x31EF, 0x192B, 0x192A, 0x192A, 0x194A, 0x194B, 0x194B,
-    0x194B, 0x218D, 0x31EF, 0x3A30, 0x3A30, 0x3A10, 0x298D, 0x194B,
-    0x192A, 0x194A, 0x192B, 0x194B, 0x214B, 0x110A, 0x08CA, 0x420C,
-    0xBCAF, 0xFE32, 0xFE11, 0xFDF1, 0xFE11, 0xED70, 0xABEF, 0x61ED,
-    0x6A2E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x61ED,
-    0x934F, 0xE551, 0xF5D1, 0xC46F, 0x8ACE, 0x82AE, 0x8AEF, 0x930F,
-    0x82CF, 0x420F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A10, 0x422F,
-    0x72CF, 0x7ACF, 0x7ACF, 0x82CF, 0x6AAF, 0x39EE, 0x4A2F, 0x5A6F,
-    0x72AF, 0x7ACF, 0x6A8F, 0x31CE, 0x31EF, 0x4A2F, 0x6A8F, 0x82EF,
-    0x6AAF, 0x31EE, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x320F,
-    0x320F, 0x320F, 0x320F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A10, 0x31EF,
-    0x626E, 0xAB8E, 0x932D, 0x190A, 0x190A, 0x49ED, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x51ED, 0x39AC, 0x49CC, 0x39AC, 0x316B, 0x520E,
-    0x398C, 0x398C, 0x294B, 0x192A, 0x192A, 0x192A, 0x316B, 0x622E,
-    0x398C, 0x212A, 0x39AC, 0x41AC, 0x6A4E, 0x59ED, 0x316B, 0x192A,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x192B, 0x18E9, 0x18E9, 0x1067,
-    0x1046, 0x1067, 0x1047, 0x1866, 0x7A88, 0x6A07, 0x4126, 0x38E6,
-    0x3906, 0x3906, 0x4966, 0x59A7, 0x28E7, 0x0826, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x28C6, 0x4147, 0x5186, 0x7A68, 0x6A07,
-    0x4947, 0x38E6, 0x30E7, 0x1066, 0x3127, 0x1887, 0x1047, 0x1067,
-    0x1067, 0x1066, 0x3907, 0x4127, 0x20A6, 0x1046, 0x1067, 0x1066,
-    0x0866, 0x1909, 0x10C8, 0x0846, 0x0846, 0x1087, 0x0846, 0x0846,
-    0x0846, 0x10C8, 0x196B, 0x194B, 0x194A, 0x196B, 0x10A7, 0x10A8,
-    0x218B, 0x194A, 0x1087, 0x1066, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x1066, 0x0846, 0x1886, 0x3907, 0x30E7, 0x1886, 0x28E7,
-    0x3907, 0x3926, 0x3907, 0x3906, 0x3906, 0x4106, 0x4106, 0x3906,
-    0x4126, 0x3927, 0x1866, 0x1046, 0x1066, 0x1046, 0x2086, 0x6207,
-    0x7247, 0x7A67, 0x61C7, 0x4126, 0x4126, 0x3906, 0x1866, 0x1067,
-    0x2085, 0x2908, 0x298D, 0x298D, 0x216C, 0x214C, 0x214B, 0x298D,
-    0x320F, 0x31EF, 0x216C, 0x192B, 0x192A, 0x194B, 0x192B, 0x194B,
-    0x194B, 0x3A0F, 0x3A10, 0x31EF, 0x3A10, 0x3A0F, 0x3A30, 0x298D,
-    0x194B, 0x192A, 0x192B, 0x192B, 0x194B, 0x214B, 0x216B, 0x190B,
-    0x31AA, 0xC4F1, 0xD510, 0xD4F0, 0xDD31, 0xA3AF, 0x59CC, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x6A2E, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A2E, 0x724E,
-    0x59ED, 0x9B8F, 0xCCF1, 0x7A6D, 0x8AEF, 0x8AEF, 0x8AEF, 0x82EF,
-    0x6AAF, 0x39EF, 0x3A10, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x72AF, 0x7ACF, 0x7ACF, 0x7ACF, 0x5A70, 0x39EE, 0x6AB0, 0x522F,
-    0x628F, 0x72AF, 0x524F, 0x31CE, 0x420E, 0x72AF, 0x7AEF, 0x72CF,
-    0x628F, 0x3A0F, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x320F,
-    0x31EF, 0x31EF, 0x320F, 0x31EF, 0x31EF, 0x3A0F, 0x3A10, 0x4A2F,
-    0x934E, 0xC3EF, 0x82EE, 0x190A, 0x190A, 0x520D, 0x6A4E, 0x6A2E,
-    0x622E, 0x49ED, 0x18E9, 0x626F, 0x41AC, 0x212B, 0x5A0E, 0x626E,
-    0x214A, 0x192A, 0x192A, 0x192B, 0x192A, 0x212A, 0x622E, 0x726F,
-    0x398B, 0x398C, 0x726F, 0x5A0D, 0x5A0D, 0x294B, 0x192A, 0x192B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x192A, 0x18E9, 0x1046, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1867, 0x30E6, 0x6A28, 0x4946, 0x3906, 0x3906,
-    0x3906, 0x4946, 0x6A27, 0x20A6, 0x0826, 0x1867, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x20A7, 0x30E6, 0x4946, 0x7A68, 0x6A07, 0x4126,
-    0x3907, 0x4127, 0x30E7, 0x1866, 0x7249, 0x28E7, 0x0847, 0x1067,
-    0x1067, 0x1866, 0x3907, 0x4127, 0x20A6, 0x1046, 0x1067, 0x1066,
-    0x194A, 0x0867, 0x10E9, 0x18E9, 0x0887, 0x192A, 0x0866, 0x0845,
-    0x18E9, 0x216B, 0x194A, 0x194A, 0x194A, 0x196B, 0x10A8, 0x10A7,
-    0x194A, 0x194A, 0x216B, 0x10A8, 0x1046, 0x1066, 0x1046, 0x1046,
-    0x1046, 0x1066, 0x1066, 0x1066, 0x1046, 0x1066, 0x28E7, 0x1046,
-    0x28C6, 0x4127, 0x3926, 0x3906, 0x4107, 0x4106, 0x4107, 0x3927,
-    0x3906, 0x3906, 0x1866, 0x1066, 0x1066, 0x1066, 0x1046, 0x1865,
-    0x6207, 0x7A47, 0x8288, 0x61E7, 0x3906, 0x3907, 0x1867, 0x0826,
-    0x5186, 0x6229, 0x316B, 0x298D, 0x216C, 0x216C, 0x216C, 0x214B,
-    0x216C, 0x3A0F, 0x3A0F, 0x216C, 0x192A, 0x194B, 0x194B, 0x194B,
-    0x192B, 0x31EF, 0x218D, 0x216C, 0x3A10, 0x3A0F, 0x3A0F, 0x3A10,
-    0x218C, 0x192A, 0x192A, 0x192A, 0x194B, 0x194B, 0x214B, 0x214B,
-    0x216B, 0x212A, 0x51EC, 0x5A0D, 0x622D, 0x6A2E, 0x6A4E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A4E, 0x6A2E,
-    0x6A4E, 0x724E, 0x726D, 0x82CE, 0x8ACE, 0x8AEF, 0x8AEF, 0x6A8F,
-    0x31EF, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x31EF, 0x420F,
-    0x72AF, 0x7AAF, 0x7ACF, 0x5A6F, 0x31CF, 0x420F, 0x72B0, 0x7AF0,
-    0x7AF0, 0x5A4F, 0x29AE, 0x39EE, 0x72B0, 0x7ACF, 0x7ACF, 0x628F,
-    0x31CE, 0x3A0F, 0x39EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x320F,
-    0x31EF, 0x320F, 0x31EF, 0x3A0F, 0x420F, 0x3A0F, 0x39EE, 0x9B6F,
-    0xCC2F, 0xA34E, 0x5A0E, 0x212B, 0x212B, 0x5A0D, 0x6A2E, 0x6A2E,
-    0x51ED, 0x1909, 0x190A, 0x5A2E, 0x39AC, 0x39AC, 0x726F, 0x624E,
-    0x214B, 0x194B, 0x194B, 0x192B, 0x192A, 0x212A, 0x5A0D, 0x6A4E,
-    0x318C, 0x39AC, 0x622E, 0x190A, 0x192A, 0x192B, 0x192B, 0x192B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x18C9, 0x1046, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1047, 0x28C6, 0x7248, 0x4126, 0x4127, 0x4106, 0x38E6,
-    0x4946, 0x7248, 0x6A27, 0x20A6, 0x1047, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x30C7, 0x4107, 0x4966, 0x6A28, 0x3906, 0x3907,
-    0x4127, 0x30E7, 0x20A7, 0x1866, 0x5A08, 0x28C6, 0x1047, 0x1067,
-    0x1067, 0x1066, 0x3907, 0x4127, 0x20A6, 0x1046, 0x1066, 0x1066,
-    0x0025, 0x192A, 0x10A7, 0x10A8, 0x192A, 0x0846, 0x0846, 0x0846,
-    0x0846, 0x10C8, 0x196B, 0x194A, 0x194A, 0x194A, 0x194A, 0x10C8,
-    0x1087, 0x194B, 0x194B, 0x194B, 0x10A8, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x30E7, 0x20A6, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046,
-    0x28C6, 0x4127, 0x3906, 0x3906, 0x3926, 0x3926, 0x3926, 0x3906,
-    0x3926, 0x3906, 0x1866, 0x1066, 0x1066, 0x1046, 0x1067, 0x1067,
-    0x1866, 0x61E7, 0x8288, 0x61C7, 0x30C6, 0x20A7, 0x1067, 0x0826,
-    0x4966, 0x7A67, 0x59E8, 0x1087, 0x216C, 0x216C, 0x214B, 0x192B,
-    0x216C, 0x39EF, 0x3A0F, 0x216B, 0x192A, 0x194B, 0x194B, 0x194B,
-    0x192B, 0x320F, 0x29AD, 0x214C, 0x29AD, 0x3A0F, 0x320F, 0x3A0F,
-    0x216C, 0x190A, 0x192A, 0x194B, 0x214B, 0x214B, 0x194B, 0x194B,
-    0x214B, 0x214B, 0x214A, 0x212A, 0x520D, 0x726F, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A4E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x724E, 0x82AE, 0x828E, 0x82CF, 0x8B0F, 0x628F,
-    0x31EF, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x320F, 0x420F, 0x72AF,
-    0x7AAF, 0x7ACF, 0x524F, 0x31EF, 0x422F, 0x72D0, 0x72CF, 0x72CF,
-    0x7AF0, 0x5A6F, 0x29CE, 0x39EE, 0x72AF, 0x7AAF, 0x7ACF, 0x628F,
-    0x31EF, 0x3A0F, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF,
-    0x31EF, 0x3A0F, 0x31CE, 0x6AAE, 0x9B90, 0x49EE, 0xA38F, 0xBBEE,
-    0xC40E, 0xA36F, 0x5A0E, 0x212A, 0x212B, 0x5A0E, 0x6A4E, 0x6A2E,
-    0x51ED, 0x190A, 0x190A, 0x5A0D, 0x396B, 0x398B, 0x726F, 0x622E,
-    0x214B, 0x194B, 0x192B, 0x192B, 0x192B, 0x212A, 0x622E, 0x316B,
-    0x110A, 0x41AC, 0x624F, 0x192A, 0x192B, 0x192A, 0x192B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x214B, 0x10C8, 0x1046, 0x1067, 0x1067, 0x1067, 0x1867,
-    0x0826, 0x3107, 0x6A28, 0x4106, 0x4127, 0x3906, 0x4127, 0x3906,
-    0x4946, 0x7247, 0x4146, 0x1866, 0x1046, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x30E7, 0x38E6, 0x5187, 0x6A28, 0x4126, 0x4107, 0x4127,
-    0x20A6, 0x1046, 0x1067, 0x1067, 0x1886, 0x1066, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x3927, 0x2086, 0x1046, 0x1066, 0x1066, 0x1066,
-    0x192A, 0x0887, 0x10E9, 0x10E9, 0x0887, 0x192A, 0x0846, 0x0846,
-    0x0845, 0x10A8, 0x196B, 0x194B, 0x194A, 0x194A, 0x196B, 0x10C8,
-    0x0866, 0x216B, 0x194B, 0x196B, 0x10C8, 0x1046, 0x1066, 0x1046,
-    0x1046, 0x30E7, 0x4127, 0x20A7, 0x1046, 0x1066, 0x1046, 0x1046,
-    0x1866, 0x28C6, 0x4126, 0x3926, 0x3927, 0x3926, 0x3926, 0x3906,
-    0x4106, 0x3907, 0x1866, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1886, 0x59A7, 0x7A68, 0x5187, 0x1886, 0x1067, 0x0826,
-    0x4987, 0x7A87, 0x7227, 0x59C8, 0x18C8, 0x1067, 0x296C, 0x31EF,
-    0x31CE, 0x31EF, 0x31EF, 0x31EF, 0x216C, 0x192B, 0x194B, 0x194B,
-    0x194B, 0x214B, 0x31CE, 0x29AD, 0x214B, 0x3A2F, 0x320F, 0x31EF,
-    0x31CE, 0x31CE, 0x29AD, 0x192B, 0x194B, 0x192B, 0x31CE, 0x420F,
-    0x31CD, 0x192A, 0x194A, 0x192A, 0x214B, 0x49CC, 0x6A4E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x724E, 0x82AE, 0x828E, 0x8AEF, 0x626E, 0x39EE,
-    0x39EF, 0x39EF, 0x3A0F, 0x3A10, 0x31EF, 0x4A2F, 0x72D0, 0x82EF,
-    0x82CF, 0x522E, 0x39EF, 0x31EF, 0x3A0F, 0x526F, 0x7ACF, 0x7AF0,
-    0x5A6F, 0x39EF, 0x31CF, 0x31CE, 0x72AF, 0x7ACF, 0x5A4E, 0x39EF,
-    0x39EF, 0x39EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x31EF,
-    0x3A0F, 0x29AE, 0x72CF, 0xA34E, 0x6A4E, 0x49ED, 0xB3AE, 0xC3EE,
-    0x9B2E, 0x724E, 0x6A2E, 0x520E, 0x212B, 0x5A0D, 0x6A4E, 0x724E,
-    0x5A0D, 0x190A, 0x190A, 0x5A0D, 0x5A0D, 0x5A0D, 0x6A4E, 0x622E,
-    0x214B, 0x194B, 0x194B, 0x192B, 0x192A, 0x190A, 0x622E, 0x294B,
-    0x398C, 0x49CD, 0x296B, 0x194B, 0x192B, 0x192B, 0x192B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x214B, 0x10C8, 0x1066, 0x1046, 0x1046, 0x1066, 0x1067, 0x0806,
-    0x4147, 0x6208, 0x4125, 0x3906, 0x3906, 0x4127, 0x2886, 0x3907,
-    0x7A68, 0x7268, 0x2086, 0x1046, 0x1066, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x28A6, 0x5187, 0x7247, 0x6A27, 0x4947, 0x4127, 0x20A6,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1047,
-    0x1866, 0x3907, 0x2086, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066,
-    0x10A8, 0x10E9, 0x10C8, 0x10C8, 0x10E9, 0x10A8, 0x0846, 0x0846,
-    0x0846, 0x10A8, 0x216B, 0x194A, 0x194A, 0x194A, 0x194B, 0x192A,
-    0x10C9, 0x10C8, 0x216B, 0x216B, 0x10C8, 0x1046, 0x1067, 0x1046,
-    0x1046, 0x30E7, 0x4147, 0x3907, 0x20A7, 0x1046, 0x1046, 0x1046,
-    0x0846, 0x20A6, 0x4127, 0x3926, 0x3926, 0x4126, 0x3906, 0x3906,
-    0x4106, 0x3907, 0x1866, 0x1046, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x1046, 0x20A6, 0x59C7, 0x61E7, 0x1025, 0x1067, 0x1046,
-    0x20A6, 0x5187, 0x7A67, 0x7227, 0x30E6, 0x28A6, 0x18C8, 0x296C,
-    0x3A10, 0x31EF, 0x39EF, 0x3A10, 0x298D, 0x192A, 0x194B, 0x192B,
-    0x194B, 0x192A, 0x29CE, 0x29CE, 0x192A, 0x218C, 0x31EF, 0x31EF,
-    0x31EF, 0x3A10, 0x31EE, 0x192B, 0x194B, 0x192B, 0x298C, 0x39EF,
-    0x4230, 0x29AD, 0x192A, 0x192A, 0x192A, 0x214A, 0x49AC, 0x6A4E,
-    0x6A2E, 0x6A2E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x6A4E, 0x726E, 0x724E, 0x930F, 0x5A6F, 0x31CF,
-    0x39EF, 0x39EF, 0x3A0F, 0x31EF, 0x524F, 0x7AF0, 0x8310, 0x524F,
-    0x524F, 0x39EF, 0x31EF, 0x31EF, 0x3A0F, 0x628F, 0x7AF0, 0x628F,
-    0x3A0F, 0x31EF, 0x3A0F, 0x5A4F, 0x72AF, 0x7ACF, 0x4A0E, 0x29AE,
-    0x31EF, 0x31EF, 0x39EF, 0x31EF, 0x3A0F, 0x3A0F, 0x3A0F, 0x320F,
-    0x31CE, 0x6AAE, 0x930E, 0x7A8D, 0x622D, 0x8B0D, 0xB3AD, 0xC40E,
-    0x8ACE, 0x59EE, 0x6A4E, 0x726F, 0x51ED, 0x622E, 0x724E, 0x5A0D,
-    0x316B, 0x192A, 0x190A, 0x59ED, 0x724E, 0x6A2E, 0x6A2E, 0x624E,
-    0x214B, 0x192B, 0x194B, 0x192B, 0x296B, 0x51ED, 0x6A4E, 0x212A,
-    0x49AC, 0x49ED, 0x110A, 0x194B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x216B, 0x190A, 0x10A8, 0x18A8,
-    0x18A8, 0x1067, 0x1046, 0x1066, 0x1066, 0x1067, 0x0826, 0x4167,
-    0x5187, 0x59A7, 0x59C7, 0x38E6, 0x4127, 0x28C7, 0x3927, 0x6A07,
-    0x7268, 0x3106, 0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1046, 0x4967, 0x7227, 0x8287, 0x6207, 0x28A6, 0x20A7, 0x1066,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1047, 0x2087,
-    0x30E7, 0x20A7, 0x1046, 0x1046, 0x1046, 0x1066, 0x1066, 0x0846,
-    0x10A8, 0x10E9, 0x10C8, 0x10C8, 0x10E9, 0x10A7, 0x0846, 0x0846,
-    0x0846, 0x1087, 0x1909, 0x196B, 0x194A, 0x194A, 0x194A, 0x196B,
-    0x192A, 0x10A8, 0x10C8, 0x194B, 0x190A, 0x1087, 0x1046, 0x1066,
-    0x1046, 0x20A7, 0x3106, 0x4127, 0x30E7, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x1886, 0x30E6, 0x4127, 0x4126, 0x3906, 0x3906, 0x3906,
-    0x4106, 0x3906, 0x1066, 0x1046, 0x1066, 0x1066, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x0826, 0x20C6, 0x4987, 0x3107, 0x1066, 0x1067,
-    0x0826, 0x30E6, 0x7A67, 0x6A07, 0x4126, 0x4127, 0x28A6, 0x20E8,
-    0x31AD, 0x3A10, 0x3A0F, 0x3A10, 0x31CE, 0x216C, 0x192B, 0x192A,
-    0x192B, 0x192A, 0x31CE, 0x29CE, 0x110A, 0x192A, 0x31EF, 0x3A0F,
-    0x31EF, 0x3A10, 0x31CE, 0x192B, 0x192B, 0x192B, 0x192B, 0x216C,
-    0x31EE, 0x4230, 0x298D, 0x192A, 0x192A, 0x192A, 0x214A, 0x49ED,
-    0x6A4E, 0x724E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E,
-    0x6A4E, 0x6A2E, 0x6A2E, 0x6A4E, 0x728F, 0x72AF, 0x4A4F, 0x31EF,
-    0x39EF, 0x39EF, 0x39EF, 0x4A2F, 0x72CF, 0x7AF0, 0x526F, 0x31EF,
-    0x31EF, 0x31EF, 0x31EF, 0x31EF, 0x420F, 0x72B0, 0x5A6F, 0x3A0F,
-    0x320F, 0x31EF, 0x422F, 0x7ACF, 0x7AAF, 0x7ACF, 0x626E, 0x5A4E,
-    0x524F, 0x31EF, 0x31EF, 0x39EF, 0x31EF, 0x31EF, 0x31EF, 0x3A0F,
-    0x628E, 0xB3AE, 0xAB6D, 0x622D, 0x620C, 0xC3EE, 0xBBCD, 0xA34D,
-    0x726E, 0x620E, 0x622E, 0x49AC, 0x6A6E, 0x6A4E, 0x726E, 0x49CC,
-    0x10E9, 0x192A, 0x110A, 0x51ED, 0x6A2E, 0x6A2E, 0x620D, 0x41AC,
-    0x212B, 0x192B, 0x194B, 0x192B, 0x318C, 0x6A6F, 0x49AC, 0x316B,
-    0x59ED, 0x49CD, 0x192A, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x18E9, 0x18E9, 0x18A8, 0x1046, 0x1046,
-    0x1046, 0x1046, 0x1067, 0x1067, 0x1067, 0x1046, 0x3927, 0x59C7,
-    0x59A7, 0x5186, 0x59E7, 0x5187, 0x3107, 0x0826, 0x51A7, 0x7248,
-    0x3927, 0x0846, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1046,
-    0x3106, 0x6A27, 0x8287, 0x6A27, 0x3907, 0x0846, 0x1047, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1047, 0x20A7,
-    0x28C7, 0x1046, 0x1066, 0x1066, 0x1046, 0x1046, 0x1866, 0x3927,
-    0x216B, 0x0887, 0x10C8, 0x10E9, 0x0887, 0x190A, 0x08A7, 0x0866,
-    0x0846, 0x0845, 0x0866, 0x1909, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194B, 0x194B, 0x0867, 0x10E9, 0x216B, 0x192A, 0x1067, 0x1067,
-    0x1067, 0x0846, 0x28C6, 0x4127, 0x30E7, 0x1866, 0x1046, 0x1046,
-    0x1046, 0x1046, 0x1866, 0x3107, 0x3926, 0x3926, 0x3926, 0x3906,
-    0x4106, 0x3906, 0x2086, 0x1066, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1046, 0x20A6, 0x59E8, 0x1886, 0x1067,
-    0x1046, 0x3927, 0x7A67, 0x6A07, 0x3906, 0x3906, 0x3926, 0x30E6,
-    0x2908, 0x31CE, 0x3A10, 0x3A10, 0x3A30, 0x29AE, 0x192A, 0x192A,
-    0x192B, 0x192A, 0x31CE, 0x31CE, 0x110A, 0x192A, 0x29CD, 0x3A0F,
-    0x3A10, 0x3A10, 0x31EE, 0x192B, 0x192B, 0x192B, 0x194B, 0x192A,
-    0x214B, 0x31EE, 0x3A0F, 0x216C, 0x192A, 0x192A, 0x192A, 0x192A,
-    0x520D, 0x5A0D, 0x622E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E, 0x8B10, 0x4A2F, 0x31EF, 0x3A0F,
-    0x31EF, 0x31EF, 0x31EE, 0x72AF, 0x82EF, 0x6AAF, 0x422F, 0x3A0F,
-    0x3A0F, 0x3A0F, 0x3A0F, 0x31EF, 0x3A0F, 0x5A6F, 0x420E, 0x3A0F,
-    0x3A0F, 0x3A0F, 0x5A6F, 0x7AD0, 0x6A8F, 0x626F, 0x6A8F, 0x7ACF,
-    0x6AB0, 0x31EF, 0x31EF, 0x31EF, 0x4A4F, 0x628F, 0x5A6F, 0x522E,
-    0xA36F, 0xB3AE, 0xBBED, 0x932D, 0x726C, 0xB3AD, 0xA36D, 0x6A2D,
-    0x620E, 0x620E, 0x49CD, 0x314A, 0x624E, 0x6A4E, 0x6A6E, 0x520D,
-    0x296B, 0x212B, 0x294A, 0x5A0D, 0x6A2E, 0x6A2E, 0x51ED, 0x10EA,
-    0x192B, 0x192B, 0x194B, 0x214B, 0x41AC, 0x624E, 0x292A, 0x5A0D,
-    0x622E, 0x398C, 0x192A, 0x192A, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x190A, 0x190A, 0x1087, 0x1046, 0x1047, 0x1067, 0x1066,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1066, 0x28C6, 0x6208, 0x4145,
-    0x59C7, 0x59E7, 0x4945, 0x6208, 0x1866, 0x1866, 0x61E7, 0x5187,
-    0x0826, 0x1087, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066, 0x28E6,
-    0x7248, 0x7A67, 0x6A27, 0x3927, 0x0826, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066,
-    0x1046, 0x1066, 0x1066, 0x1066, 0x1046, 0x1866, 0x3926, 0x8288,
-    0x194B, 0x216B, 0x0887, 0x10A8, 0x192A, 0x0046, 0x194A, 0x1087,
-    0x0845, 0x0845, 0x0845, 0x0866, 0x192A, 0x194A, 0x194A, 0x194B,
-    0x194B, 0x194B, 0x216B, 0x0887, 0x10C8, 0x216B, 0x190A, 0x1066,
-    0x1067, 0x1046, 0x28C7, 0x3927, 0x3927, 0x3907, 0x1866, 0x1046,
-    0x1046, 0x1046, 0x1046, 0x1066, 0x3107, 0x3907, 0x3906, 0x3926,
-    0x3926, 0x3926, 0x4127, 0x1886, 0x1046, 0x1066, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x1067, 0x1067, 0x1067, 0x1046, 0x1066, 0x1067,
-    0x1046, 0x3107, 0x7247, 0x6A07, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3907, 0x2908, 0x31CE, 0x3A10, 0x3A10, 0x29AD, 0x190A, 0x192A,
-    0x194A, 0x192A, 0x31CE, 0x31CE, 0x192A, 0x192A, 0x192A, 0x31CE,
-    0x3A10, 0x3A10, 0x31EF, 0x214B, 0x214B, 0x194B, 0x192B, 0x192A,
-    0x192A, 0x192A, 0x31EF, 0x3A0F, 0x218C, 0x194B, 0x214B, 0x214B,
-    0x214B, 0x192A, 0x41ED, 0x624E, 0x622E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E, 0x7AF0, 0x4A4F, 0x320F, 0x3A0F,
-    0x31EF, 0x31EF, 0x39EE, 0x728F, 0x82CF, 0x82F0, 0x72F0, 0x3A0F,
-    0x3A0F, 0x3A0F, 0x3A0F, 0x320F, 0x31EF, 0x39EE, 0x6AD0, 0x4A2F,
-    0x31EF, 0x5270, 0x7B10, 0x6AD0, 0x31AD, 0x298D, 0x298D, 0x298D,
-    0x298D, 0x31CF, 0x39EF, 0x39EE, 0x82EE, 0xBC0F, 0xA36E, 0x6A2D,
-    0x722D, 0xAB8E, 0xBBCD, 0xB3AD, 0xBBCE, 0xAB8E, 0x620D, 0x620E,
-    0x622E, 0x41AC, 0x314A, 0x6A6E, 0x6A2E, 0x6A4E, 0x6A4E, 0x726E,
-    0x5A2E, 0x212A, 0x624E, 0x6A2E, 0x6A2E, 0x6A4E, 0x5A0D, 0x192A,
-    0x192A, 0x192A, 0x192A, 0x39AC, 0x6A6E, 0x6A4E, 0x6A4E, 0x6A4E,
-    0x398B, 0x110A, 0x192B, 0x192A, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x190A, 0x1046, 0x1046, 0x1066, 0x1067, 0x1067, 0x1066, 0x1066,
-    0x1067, 0x1067, 0x1067, 0x1046, 0x28C6, 0x6A68, 0x38E5, 0x6228,
-    0x5186, 0x4966, 0x6228, 0x1045, 0x1026, 0x59C7, 0x7268, 0x4987,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066, 0x28C6, 0x7268,
-    0x6A07, 0x7248, 0x3106, 0x0826, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1866, 0x1046, 0x4146, 0x82A8, 0x7A47,
-    0x194B, 0x194B, 0x194B, 0x10C8, 0x0887, 0x192A, 0x0866, 0x1909,
-    0x10A7, 0x0825, 0x1086, 0x1929, 0x0866, 0x192A, 0x196B, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x194B, 0x10A8, 0x10A8, 0x192A, 0x0846,
-    0x1046, 0x1066, 0x1046, 0x20A6, 0x4127, 0x3926, 0x3927, 0x1886,
-    0x1046, 0x1046, 0x1046, 0x1066, 0x1066, 0x1046, 0x28E6, 0x4127,
-    0x3926, 0x3927, 0x4127, 0x1866, 0x28C7, 0x30E7, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x1066, 0x1067, 0x1066, 0x1066,
-    0x1067, 0x1046, 0x30E6, 0x6A27, 0x3905, 0x3906, 0x3906, 0x3926,
-    0x4106, 0x3907, 0x1088, 0x31AE, 0x3A10, 0x298D, 0x192A, 0x192A,
-    0x194A, 0x192A, 0x29AD, 0x3A30, 0x31CE, 0x192B, 0x194B, 0x194B,
-    0x29CE, 0x3A30, 0x3A10, 0x3A10, 0x3A0F, 0x216C, 0x192A, 0x192A,
-    0x192A, 0x192B, 0x31CE, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x3A0F, 0x216B, 0x212A, 0x212A, 0x318B, 0x6A4E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x6A4E, 0x624E, 0x420E, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x320F, 0x3A0F, 0x72CF, 0x82CF, 0x82EF, 0x626F, 0x39EE, 0x3A0F,
-    0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F, 0x3A0F,
-    0x3A10, 0x31CE, 0x298C, 0x29AC, 0x298D, 0x298D, 0x298D, 0x216C,
-    0x216C, 0x298D, 0x5A0E, 0x930F, 0x8AEE, 0x722D, 0x82AD, 0xB3EF,
-    0xB3CE, 0xBBEE, 0xBBCD, 0xBBEE, 0xA36E, 0x620C, 0x620D, 0x6A2E,
-    0x316B, 0x398B, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A4E, 0x6A4E, 0x724E,
-    0x5A0D, 0x214A, 0x624E, 0x6A2E, 0x6A2E, 0x6A2E, 0x520D, 0x190A,
-    0x192B, 0x190A, 0x41AC, 0x6A4E, 0x6A4E, 0x624E, 0x622E, 0x6A4E,
-    0x39AC, 0x112A, 0x192B, 0x192A, 0x192A, 0x194B, 0x10C8, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x1066, 0x1066, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x0826, 0x3927, 0x6A48, 0x4105, 0x6A68, 0x4125,
-    0x59C6, 0x51A7, 0x1045, 0x1067, 0x0825, 0x59E7, 0x4166, 0x1046,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x0846, 0x3106, 0x6A48, 0x6A28,
-    0x2085, 0x1866, 0x1866, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x1067, 0x1067, 0x1066, 0x1046,
-    0x1046, 0x1066, 0x3907, 0x3906, 0x59C7, 0x7A67, 0x7A67, 0x7A67,
-    0x194B, 0x194A, 0x194B, 0x194A, 0x10E9, 0x0887, 0x1909, 0x0887,
-    0x10C8, 0x10C8, 0x0845, 0x1087, 0x192A, 0x10A8, 0x1909, 0x216B,
-    0x194A, 0x196B, 0x194A, 0x196B, 0x192A, 0x10C8, 0x0887, 0x1909,
-    0x1066, 0x1046, 0x0826, 0x20A6, 0x4127, 0x3926, 0x3927, 0x1866,
-    0x1046, 0x1046, 0x1046, 0x1066, 0x1066, 0x1046, 0x1866, 0x1886,
-    0x1886, 0x2086, 0x3927, 0x1886, 0x1066, 0x28C6, 0x28C7, 0x0846,
-    0x1046, 0x1046, 0x1067, 0x1067, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1066, 0x1046, 0x20A6, 0x6A27, 0x61E7, 0x4126, 0x3906, 0x3906,
-    0x3926, 0x3906, 0x3107, 0x1087, 0x39ED, 0x3A2E, 0x192A, 0x192B,
-    0x194A, 0x194B, 0x194B, 0x29CE, 0x31EF, 0x192B, 0x194B, 0x192A,
-    0x29CE, 0x4230, 0x3A30, 0x3A10, 0x3A10, 0x214B, 0x192A, 0x192A,
-    0x192A, 0x192A, 0x214B, 0x214B, 0x31CE, 0x3A30, 0x3A30, 0x3A10,
-    0x3A0F, 0x31EF, 0x31EE, 0x216C, 0x1909, 0x296B, 0x316B, 0x5A2E,
-    0x728F, 0x522E, 0x31AC, 0x420F, 0x31EF, 0x31EF, 0x3A0F, 0x3A0F,
-    0x320F, 0x420F, 0x8310, 0x8B10, 0x626E, 0x39EE, 0x31EF, 0x31EF,
-    0x320F, 0x3A0F, 0x3A0F, 0x3A30, 0x320F, 0x216C, 0x216C, 0x216C,
-    0x216C, 0x216C, 0x216C, 0x218C, 0x216C, 0x218C, 0x194C, 0x522D,
-    0x8B2E, 0x59ED, 0x622E, 0x6A2D, 0x61ED, 0x7A8D, 0xABAE, 0xBBEE,
-    0xBBEE, 0xBBCD, 0xC40E, 0xA36E, 0x622D, 0x59EE, 0x622E, 0x314B,
-    0x41AB, 0x622D, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E, 0x724E,
-    0x520D, 0x212A, 0x624E, 0x6A2E, 0x6A4E, 0x51CC, 0x212A, 0x192A,
-    0x192A, 0x10E9, 0x49CC, 0x51ED, 0x398B, 0x6A4E, 0x6A6E, 0x39AC,
-    0x214B, 0x192A, 0x192A, 0x192A, 0x194B, 0x10C8, 0x1066, 0x1066,
-    0x1066, 0x1067, 0x1067, 0x1066, 0x1067, 0x1066, 0x1067, 0x1067,
-    0x1087, 0x0826, 0x4167, 0x59E7, 0x5186, 0x6A28, 0x4125, 0x6208,
-    0x4966, 0x1885, 0x0826, 0x1045, 0x5A08, 0x3106, 0x1866, 0x1047,
-    0x1067, 0x1067, 0x1067, 0x1047, 0x3927, 0x6A27, 0x6A27, 0x20A6,
-    0x1066, 0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066, 0x1046,
-    0x1885, 0x49C6, 0x6A27, 0x7227, 0x7A47, 0x7A67, 0x7A66, 0x7A67,
-    0x194A, 0x194A, 0x194A, 0x196B, 0x194A, 0x10C8, 0x194B, 0x10E8,
-    0x194A, 0x10E8, 0x0825, 0x0846, 0x10A8, 0x18E9, 0x10A8, 0x10E9,
-    0x194A, 0x08A8, 0x194A, 0x194B, 0x196B, 0x1929, 0x10E9, 0x194B,
-    0x18E9, 0x18E9, 0x1087, 0x1066, 0x28C6, 0x3927, 0x3927, 0x30E6,
-    0x1886, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x1046,
-    0x1046, 0x1046, 0x20A6, 0x1866, 0x1046, 0x1866, 0x28C6, 0x28E7,
-    0x1046, 0x28C7, 0x1887, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x0846, 0x20C6, 0x7267, 0x7247, 0x4126, 0x3906, 0x4126,
-    0x3926, 0x3926, 0x4127, 0x28A6, 0x28E8, 0x212A, 0x192B, 0x194B,
-    0x192A, 0x194B, 0x192A, 0x29AD, 0x320F, 0x192B, 0x192B, 0x192B,
-    0x216C, 0x298D, 0x29AD, 0x3A10, 0x39EF, 0x31CE, 0x216C, 0x192A,
-    0x192B, 0x192A, 0x192A, 0x192A, 0x216C, 0x29AD, 0x29AD, 0x3A30,
-    0x3A10, 0x3A10, 0x3A10, 0x31EE, 0x29AD, 0x298C, 0x192A, 0x318B,
-    0x39AC, 0x298C, 0x216C, 0x320F, 0x31EF, 0x31EF, 0x31EF, 0x3A0F,
-    0x3A0F, 0x3A0F, 0x526F, 0x5A6F, 0x420E, 0x31EF, 0x31EF, 0x31EF,
-    0x320F, 0x3A30, 0x31CE, 0x29AD, 0x298D, 0x214B, 0x214B, 0x214B,
-    0x214C, 0x192B, 0x192B, 0x216C, 0x4A0E, 0x520E, 0x49EE, 0x6A6D,
-    0x8ACE, 0x6A2D, 0x61ED, 0x8AED, 0x8B0D, 0xA36D, 0xBBEE, 0xBBCE,
-    0xBBEE, 0xC42E, 0xA36E, 0x726E, 0x5A0E, 0x622E, 0x316B, 0x41AB,
-    0x620D, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E,
-    0x622E, 0x51ED, 0x6A4E, 0x724E, 0x726F, 0x49ED, 0x110A, 0x192B,
-    0x192A, 0x398B, 0x622E, 0x49CC, 0x294A, 0x6A6F, 0x41AC, 0x214B,
-    0x192A, 0x192B, 0x192B, 0x192A, 0x10A8, 0x1066, 0x1046, 0x1066,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x0826, 0x4167, 0x51A7, 0x59A7, 0x59C7, 0x51A6, 0x59C7, 0x4987,
-    0x20A6, 0x0806, 0x2086, 0x49A7, 0x4167, 0x1886, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x0846, 0x51A8, 0x6A27, 0x28E6, 0x1046,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1046, 0x1046, 0x0826, 0x28C6,
-    0x49C6, 0x3983, 0x7267, 0x8267, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x196B, 0x194A, 0x196B,
-    0x196B, 0x1909, 0x10A7, 0x0866, 0x10A8, 0x1909, 0x10C8, 0x10A8,
-    0x10E9, 0x10A7, 0x10C8, 0x192A, 0x194A, 0x194A, 0x196B, 0x194A,
-    0x194B, 0x196B, 0x1909, 0x1067, 0x1866, 0x4147, 0x3927, 0x4127,
-    0x20A6, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1046, 0x1046, 0x1066, 0x1046, 0x1866, 0x30E7,
-    0x1066, 0x28C7, 0x28C7, 0x1886, 0x1046, 0x1046, 0x1067, 0x1066,
-    0x1046, 0x1046, 0x18A6, 0x49A7, 0x7247, 0x59C7, 0x3907, 0x28C7,
-    0x30E7, 0x3906, 0x3906, 0x4127, 0x28A6, 0x28E7, 0x39AA, 0x192A,
-    0x194B, 0x194B, 0x194B, 0x218C, 0x29AD, 0x192B, 0x192A, 0x192B,
-    0x192B, 0x192A, 0x194B, 0x31CE, 0x3A0F, 0x3A30, 0x298D, 0x192A,
-    0x194B, 0x192A, 0x192A, 0x192B, 0x192A, 0x192A, 0x194B, 0x31CE,
-    0x31CE, 0x3A0F, 0x3A10, 0x3A10, 0x3A30, 0x3A10, 0x29AD, 0x298D,
-    0x298D, 0x216B, 0x194B, 0x29AD, 0x29AD, 0x31EF, 0x3A0F, 0x3A0F,
-    0x3A0F, 0x3A0F, 0x320F, 0x31EF, 0x39EF, 0x31EF, 0x31EF, 0x31EF,
-    0x29AD, 0x29CD, 0x216C, 0x194B, 0x194B, 0x216C, 0x214B, 0x192B,
-    0x112B, 0x39AB, 0x5A4C, 0x41AC, 0x6A4E, 0x724E, 0x724E, 0x6A4E,
-    0x620E, 0x6A2D, 0x82AD, 0xB3AD, 0xC40D, 0xBBEE, 0xBBED, 0xBBCE,
-    0x9B2E, 0x9B4E, 0x728E, 0x59EE, 0x5A2E, 0x41CC, 0x316B, 0x622D,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A4E, 0x726E, 0x726E, 0x520D, 0x51ED, 0x39AC, 0x192A, 0x192B,
-    0x110A, 0x59ED, 0x5A0D, 0x316B, 0x214B, 0x49ED, 0x192A, 0x192A,
-    0x192B, 0x194B, 0x192B, 0x18C9, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1047, 0x1046,
-    0x3927, 0x61E7, 0x51A6, 0x51A6, 0x59E7, 0x5186, 0x59E8, 0x2086,
-    0x0826, 0x1866, 0x30E6, 0x4987, 0x1046, 0x1046, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1047, 0x3927, 0x3927, 0x0826, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x20A6, 0x3906, 0x3106, 0x59C7,
-    0x6A66, 0x2943, 0x7267, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x194B, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x10E9, 0x0866, 0x212A, 0x1087, 0x10E9, 0x18E9,
-    0x10A7, 0x192A, 0x0867, 0x1909, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x196B, 0x1909, 0x18A7, 0x30E7, 0x30E6, 0x3927,
-    0x28C6, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1046, 0x1046, 0x1066, 0x1066, 0x1046,
-    0x1066, 0x1046, 0x28A7, 0x28C7, 0x1866, 0x1886, 0x1066, 0x1046,
-    0x1046, 0x1066, 0x1046, 0x1066, 0x51A7, 0x7248, 0x4987, 0x18A7,
-    0x20A7, 0x3907, 0x3906, 0x3906, 0x3906, 0x5187, 0x59E8, 0x3169,
-    0x212A, 0x194B, 0x194B, 0x192A, 0x192A, 0x192B, 0x192B, 0x192B,
-    0x194B, 0x194B, 0x194A, 0x194B, 0x31CE, 0x3A10, 0x29AD, 0x194B,
-    0x192A, 0x192A, 0x192A, 0x192B, 0x192B, 0x192B, 0x194B, 0x192A,
-    0x192B, 0x29CE, 0x31EE, 0x31EF, 0x3A0F, 0x31EE, 0x39EF, 0x39EF,
-    0x422F, 0x39EE, 0x216B, 0x216B, 0x192A, 0x29AD, 0x31CE, 0x31CE,
-    0x31EE, 0x3A0F, 0x3A2F, 0x3A0F, 0x3A0F, 0x320F, 0x31EF, 0x29AD,
-    0x192A, 0x190A, 0x192B, 0x194B, 0x194B, 0x196B, 0x298C, 0x420C,
-    0x318B, 0x624C, 0x9B4F, 0x6A2D, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A4E, 0x82AD, 0xBBEE, 0xBBED, 0xAB6D, 0x9B4D, 0xA36D, 0x9B2D,
-    0x59ED, 0x59EE, 0x620E, 0x5A2E, 0x41CC, 0x316B, 0x6A4E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x5A0D, 0x214B, 0x190A, 0x192B, 0x194B, 0x192B,
-    0x294B, 0x5A0D, 0x396B, 0x10E9, 0x192A, 0x110A, 0x192A, 0x192A,
-    0x194B, 0x194B, 0x18E9, 0x1046, 0x1066, 0x1046, 0x1866, 0x1866,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1866, 0x30E6,
-    0x7248, 0x5186, 0x59E7, 0x59E7, 0x4946, 0x5A08, 0x1865, 0x1046,
-    0x1866, 0x28C7, 0x30E7, 0x0826, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1046, 0x1046, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1886, 0x2086, 0x4987, 0x7247, 0x7A67, 0x7A67,
-    0x6226, 0x2963, 0x5A06, 0x7246, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x194B, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x196B, 0x10E9, 0x0846, 0x1066, 0x0846, 0x1909, 0x10A8, 0x10A8,
-    0x192A, 0x0866, 0x192A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x196B, 0x190A, 0x0846, 0x1046, 0x30E7,
-    0x4127, 0x30E6, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1866, 0x1866, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1066, 0x1066, 0x1046, 0x20A6, 0x4127, 0x3907, 0x1866, 0x1046,
-    0x1066, 0x1066, 0x1066, 0x1067, 0x1046, 0x51A7, 0x7248, 0x49A8,
-    0x20A6, 0x3907, 0x3906, 0x3906, 0x3906, 0x38E6, 0x4946, 0x6A49,
-    0x20C7, 0x212B, 0x192B, 0x192A, 0x192A, 0x192A, 0x192B, 0x192B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x29CE, 0x3A30, 0x29AE,
-    0x192A, 0x192A, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x192A, 0x298C, 0x31EF, 0x192B, 0x192B, 0x190A,
-    0x298D, 0x420F, 0x420F, 0x3A0F, 0x214B, 0x192A, 0x192B, 0x192A,
-    0x214B, 0x320F, 0x320F, 0x320F, 0x3A0F, 0x3A0F, 0x29CD, 0x192A,
-    0x192A, 0x192B, 0x192B, 0x214B, 0x214B, 0x296C, 0x6A8F, 0xB410,
-    0x8B0F, 0x61ED, 0x620D, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x82AD, 0xBC0F, 0xB3EE, 0xBBEF, 0x82AD, 0x59CD, 0x61ED, 0x61ED,
-    0x5A0E, 0x5A0E, 0x622E, 0x39AC, 0x296B, 0x6A6F, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x622E, 0x212A, 0x192B, 0x214B, 0x194B, 0x192B, 0x214B,
-    0x624E, 0x6A4E, 0x318B, 0x110A, 0x192A, 0x192A, 0x192A, 0x192A,
-    0x192A, 0x18E9, 0x1067, 0x1067, 0x1067, 0x1046, 0x30E7, 0x30E7,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1047, 0x20C7, 0x6A68,
-    0x4105, 0x7268, 0x4947, 0x4147, 0x6208, 0x0825, 0x1067, 0x1046,
-    0x30E7, 0x30E7, 0x1046, 0x1067, 0x1067, 0x1067, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1867,
-    0x1866, 0x20A6, 0x3907, 0x4946, 0x7247, 0x7247, 0x7246, 0x7A47,
-    0x6226, 0x2943, 0x2143, 0x6226, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194B, 0x194B, 0x190A, 0x0866, 0x192A, 0x0867, 0x10E9, 0x10E9,
-    0x0887, 0x192A, 0x0045, 0x1929, 0x196B, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x194B, 0x192A, 0x1067, 0x1046,
-    0x28E6, 0x4127, 0x28E7, 0x1046, 0x1046, 0x1066, 0x1066, 0x1066,
-    0x1046, 0x1866, 0x3927, 0x4147, 0x20A6, 0x1046, 0x1066, 0x1046,
-    0x1046, 0x1066, 0x1046, 0x20A6, 0x4127, 0x3926, 0x3907, 0x1866,
-    0x1046, 0x1066, 0x1066, 0x1066, 0x1067, 0x1886, 0x1865, 0x3946,
-    0x51C8, 0x1866, 0x3927, 0x3906, 0x3906, 0x4106, 0x4126, 0x4926,
-    0x6A29, 0x20C7, 0x10E9, 0x214B, 0x192A, 0x192A, 0x192A, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192A, 0x29CD, 0x3A30,
-    0x31CE, 0x192A, 0x192B, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B,
-    0x194B, 0x192B, 0x192B, 0x192B, 0x216C, 0x420F, 0x420F, 0x212B,
-    0x192B, 0x214B, 0x296C, 0x4230, 0x420F, 0x216C, 0x192A, 0x192A,
-    0x192A, 0x194B, 0x214B, 0x194B, 0x31EE, 0x31CE, 0x194A, 0x194A,
-    0x192A, 0x192A, 0x190A, 0x398B, 0x6A4E, 0x624E, 0x726E, 0x726E,
-    0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x620D, 0x82AD,
-    0xBC0E, 0xBC0F, 0x726D, 0x6A4D, 0x6A2D, 0x620D, 0x620E, 0x620E,
-    0x59EE, 0x620E, 0x39AC, 0x192A, 0x318C, 0x6A4E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x622E, 0x212A, 0x192B, 0x194B, 0x194B, 0x192B, 0x214B,
-    0x6A4F, 0x398C, 0x192A, 0x192A, 0x192A, 0x192A, 0x192A, 0x192A,
-    0x18C8, 0x1046, 0x1047, 0x1067, 0x1047, 0x30E7, 0x4147, 0x28C7,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1046, 0x1866, 0x4125,
-    0x7268, 0x4967, 0x1886, 0x1886, 0x1886, 0x1067, 0x1046, 0x3107,
-    0x28E7, 0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x1046, 0x1046, 0x1066, 0x30E7,
-    0x4127, 0x3907, 0x4946, 0x7A67, 0x7A47, 0x7A67, 0x7247, 0x7A47,
-    0x6226, 0x2943, 0x2943, 0x6226, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x2169, 0x5A68, 0x2989,
-    0x194B, 0x196B, 0x194B, 0x192A, 0x1087, 0x10A7, 0x0866, 0x10C8,
-    0x1908, 0x0866, 0x1909, 0x0887, 0x10E9, 0x196B, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x194B, 0x194B, 0x192A, 0x192A,
-    0x18A7, 0x20A6, 0x3107, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1067, 0x1886, 0x3907, 0x3907, 0x20A6, 0x1046, 0x1046,
-    0x1046, 0x1046, 0x0846, 0x20A6, 0x4127, 0x3906, 0x3907, 0x3907,
-    0x2087, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x1886,
-    0x20A6, 0x1066, 0x1886, 0x3907, 0x4126, 0x4106, 0x4106, 0x4106,
-    0x4946, 0x59C8, 0x2907, 0x0846, 0x10A8, 0x214B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192A, 0x29AD, 0x3A30,
-    0x3A0F, 0x31CE, 0x192B, 0x192B, 0x192B, 0x192B, 0x192B, 0x192B,
-    0x194B, 0x192B, 0x194B, 0x192A, 0x216C, 0x4A2F, 0x212B, 0x39CD,
-    0x296C, 0x298C, 0x39EE, 0x212B, 0x420F, 0x420F, 0x298C, 0x192A,
-    0x192A, 0x192A, 0x214B, 0x214B, 0x216C, 0x214B, 0x190A, 0x212A,
-    0x51ED, 0x51ED, 0x51ED, 0x5A0D, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x620D, 0x59ED, 0x8ACD,
-    0xB3CE, 0x726D, 0x622E, 0x620E, 0x622E, 0x622E, 0x622E, 0x622E,
-    0x622E, 0x396B, 0x212B, 0x192A, 0x296B, 0x6A4E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x724F, 0x6A2E, 0x6A2E, 0x6A0E, 0x6A2E,
-    0x5A0E, 0x294B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x318C, 0x214B, 0x192A, 0x110A, 0x190A, 0x10A7, 0x0846, 0x1087,
-    0x0825, 0x28A6, 0x49A8, 0x1867, 0x3107, 0x4127, 0x28C7, 0x1066,
-    0x1066, 0x1066, 0x1067, 0x1067, 0x0826, 0x30E6, 0x6A07, 0x61E7,
-    0x30E6, 0x1886, 0x1066, 0x1046, 0x1046, 0x1046, 0x3107, 0x20A7,
-    0x1866, 0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1046,
-    0x1067, 0x1046, 0x2086, 0x30C6, 0x30C6, 0x30C6, 0x28C6, 0x3907,
-    0x3906, 0x5167, 0x7247, 0x7A67, 0x7A67, 0x7A47, 0x8287, 0x6206,
-    0x3163, 0x2944, 0x0863, 0x6227, 0x82A7, 0x7A67, 0x7A67, 0x7A67,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x194B, 0x2169, 0x7AC7, 0x39A9,
-    0x194B, 0x194B, 0x196B, 0x194B, 0x0845, 0x18E9, 0x10E9, 0x10C8,
-    0x10C8, 0x10E8, 0x10A7, 0x10E8, 0x10C8, 0x10E9, 0x196B, 0x194A,
-    0x194B, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194B, 0x196B,
-    0x1109, 0x18C7, 0x1886, 0x1046, 0x1046, 0x1066, 0x1067, 0x1066,
-    0x1066, 0x1067, 0x1046, 0x3107, 0x4147, 0x3927, 0x20A6, 0x1046,
-    0x1046, 0x28C7, 0x1886, 0x1046, 0x28C6, 0x4127, 0x3926, 0x4147,
-    0x20A6, 0x1046, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046,
-    0x1046, 0x1066, 0x0846, 0x1886, 0x30E6, 0x4127, 0x4106, 0x4106,
-    0x38E6, 0x4967, 0x3906, 0x20A6, 0x20A6, 0x1087, 0x10A8, 0x10A8,
-    0x192A, 0x216C, 0x196B, 0x196B, 0x194A, 0x192A, 0x216B, 0x298C,
-    0x218C, 0x29AD, 0x31EE, 0x216C, 0x192B, 0x192B, 0x192B, 0x192B,
-    0x194B, 0x192B, 0x192B, 0x192A, 0x214B, 0x318C, 0x39CD, 0x296C,
-    0x318C, 0x318C, 0x296B, 0x318D, 0x298C, 0x298D, 0x216C, 0x192B,
-    0x192A, 0x192A, 0x192A, 0x192A, 0x110A, 0x296B, 0x520D, 0x51ED,
-    0x6A4E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x620D, 0x932F, 0x7A8D, 0x6A2D,
-    0x7AAD, 0x59ED, 0x622E, 0x5A0E, 0x5A0E, 0x49ED, 0x398C, 0x398C,
-    0x316B, 0x192A, 0x110A, 0x294B, 0x51ED, 0x6A4E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x724E, 0x622E, 0x398B, 0x622E, 0x6A2E, 0x6A4E, 0x59ED,
-    0x294B, 0x190A, 0x192B, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B,
-    0x112B, 0x190B, 0x41AA, 0x5A29, 0x49C9, 0x1025, 0x49A7, 0x1865,
-    0x30E6, 0x4987, 0x3106, 0x28C7, 0x4127, 0x4147, 0x28E7, 0x1067,
-    0x1066, 0x0826, 0x1067, 0x0826, 0x3107, 0x6207, 0x7A67, 0x7248,
-    0x1066, 0x0846, 0x1067, 0x1047, 0x1867, 0x30E7, 0x28A7, 0x1067,
-    0x1047, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x0846, 0x1047, 0x1047, 0x1067, 0x30E7,
-    0x28A7, 0x28A6, 0x5187, 0x51A7, 0x38E6, 0x38E6, 0x61E7, 0x4106,
-    0x4966, 0x7227, 0x8287, 0x7A67, 0x7A66, 0x8267, 0x59E5, 0x3164,
-    0x2963, 0x2964, 0x0824, 0x1084, 0x51C6, 0x8287, 0x7A67, 0x7A67,
-    0x194A, 0x194A, 0x194B, 0x194A, 0x194B, 0x298A, 0x7AC7, 0x31A9,
-    0x194B, 0x194A, 0x194B, 0x194A, 0x10C8, 0x10C8, 0x192A, 0x192A,
-    0x10A8, 0x10C8, 0x0887, 0x10C8, 0x10C8, 0x10A8, 0x10E9, 0x196B,
-    0x194B, 0x194B, 0x194A, 0x194A, 0x194A, 0x194B, 0x194B, 0x194A,
-    0x196B, 0x10E9, 0x0846, 0x18C8, 0x10C8, 0x1067, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x28A7, 0x28C6, 0x3106, 0x3927, 0x20A6,
-    0x1046, 0x28C7, 0x28C6, 0x1866, 0x1046, 0x28C6, 0x3907, 0x4127,
-    0x30E6, 0x1886, 0x1046, 0x1066, 0x1066, 0x1067, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x20A7, 0x1046, 0x28C7, 0x4127, 0x4106, 0x3906,
-    0x3906, 0x38E6, 0x3906, 0x4127, 0x3906, 0x1886, 0x0845, 0x0846,
-    0x10A8, 0x18E9, 0x10E9, 0x10E9, 0x194A, 0x194B, 0x192A, 0x192A,
-    0x192A, 0x192B, 0x31CE, 0x216C, 0x192B, 0x192B, 0x192B, 0x194B,
-    0x192B, 0x192A, 0x192B, 0x192B, 0x192B, 0x192B, 0x39EE, 0x318C,
-    0x318C, 0x316C, 0x294B, 0x39AD, 0x192A, 0x190A, 0x192A, 0x192A,
-    0x214B, 0x41AC, 0x398B, 0x398C, 0x398B, 0x51ED, 0x726F, 0x724E,
-    0x6A4E, 0x6A2E, 0x6A4E, 0x5A0D, 0x49AC, 0x6A2E, 0x6A0E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x9B4F, 0x7AAE, 0x59ED,
-    0x61ED, 0x620E, 0x5A0E, 0x51EE, 0x41AD, 0x296C, 0x192B, 0x192A,
-    0x398C, 0x212A, 0x294B, 0x49CC, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A4E,
-    0x724E, 0x622E, 0x41CC, 0x418B, 0x622E, 0x724E, 0x5A0E, 0x316B,
-    0x190A, 0x192B, 0x192B, 0x192B, 0x192B, 0x192A, 0x192A, 0x192A,
-    0x398A, 0x3969, 0x6A48, 0x7A68, 0x5187, 0x4147, 0x5187, 0x4146,
-    0x5187, 0x4147, 0x28A6, 0x3927, 0x3927, 0x3107, 0x20C7, 0x1067,
-    0x1887, 0x3948, 0x1046, 0x28C6, 0x61E7, 0x7A67, 0x6A27, 0x4967,
-    0x1866, 0x1047, 0x1047, 0x1047, 0x1867, 0x28E7, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x3927, 0x28E7, 0x28C7, 0x4147, 0x4147,
-    0x61E8, 0x4947, 0x59A7, 0x5187, 0x38E6, 0x5187, 0x59C7, 0x5186,
-    0x6A07, 0x8287, 0x7A47, 0x7A67, 0x7A67, 0x8287, 0x6205, 0x3984,
-    0x2983, 0x2984, 0x0844, 0x20C5, 0x59E6, 0x7A67, 0x7A67, 0x7A67,
-    0x194A, 0x194A, 0x194A, 0x196B, 0x194A, 0x2128, 0x6267, 0x41E8,
-    0x216A, 0x194B, 0x194B, 0x194A, 0x216B, 0x0887, 0x10C8, 0x196B,
-    0x1909, 0x0866, 0x1909, 0x0887, 0x10E8, 0x18E9, 0x0887, 0x192A,
-    0x194B, 0x194B, 0x194A, 0x194A, 0x194A, 0x194A, 0x192A, 0x194A,
-    0x196B, 0x18E9, 0x10A8, 0x216B, 0x216B, 0x18C8, 0x1067, 0x1066,
-    0x1067, 0x1066, 0x1067, 0x1046, 0x0846, 0x1886, 0x3907, 0x30E7,
-    0x2086, 0x1046, 0x28A7, 0x30E7, 0x1866, 0x1046, 0x3907, 0x4127,
-    0x4147, 0x30E7, 0x1866, 0x1067, 0x1066, 0x1066, 0x1046, 0x1066,
-    0x1046, 0x1866, 0x4127, 0x28A6, 0x28C6, 0x3907, 0x4106, 0x3906,
-    0x3906, 0x4106, 0x4106, 0x3926, 0x4126, 0x3927, 0x1886, 0x0866,
-    0x0846, 0x0846, 0x0846, 0x0866, 0x1909, 0x1909, 0x192A, 0x194B,
-    0x194B, 0x194B, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B,
-    0x192B, 0x192B, 0x192B, 0x192B, 0x192B, 0x194B, 0x192A, 0x39EE,
-    0x316C, 0x296B, 0x39AD, 0x10E9, 0x192A, 0x296B, 0x316B, 0x296B,
-    0x41AC, 0x726F, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A4E, 0x6A4E, 0x624E, 0x41CC, 0x396B, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A4E, 0x620D, 0x620D, 0x622E,
-    0x620D, 0x49CD, 0x41AD, 0x39AD, 0x294B, 0x192A, 0x214B, 0x318C,
-    0x5A2E, 0x398C, 0x49CD, 0x6A4E, 0x622E, 0x6A2E, 0x6A2E, 0x5A0D,
-    0x5A0D, 0x41AC, 0x398B, 0x726F, 0x6A2E, 0x622E, 0x318B, 0x112A,
-    0x194B, 0x192B, 0x192A, 0x192B, 0x192B, 0x192B, 0x192B, 0x3169,
-    0x6A27, 0x7247, 0x7247, 0x4967, 0x38E6, 0x6A28, 0x28A5, 0x51A7,
-    0x4966, 0x38E5, 0x4967, 0x3906, 0x3927, 0x20C6, 0x1066, 0x1866,
-    0x3907, 0x6A49, 0x30C5, 0x6207, 0x7A67, 0x6A27, 0x4987, 0x0825,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1046, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x3906, 0x6207, 0x59C7, 0x61C7, 0x6A28, 0x5166,
-    0x7248, 0x5167, 0x38E7, 0x4106, 0x5187, 0x6A28, 0x4125, 0x6A27,
-    0x7A87, 0x7A47, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x8A87, 0x6A46,
-    0x39A4, 0x3184, 0x1083, 0x49C6, 0x7267, 0x7A67, 0x7A67, 0x7A67,
-    0x194B, 0x194B, 0x194B, 0x196B, 0x1109, 0x0843, 0x3964, 0x6A87,
-    0x41E9, 0x192B, 0x196B, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x0846, 0x190A, 0x10C8, 0x10A8, 0x192A, 0x0846,
-    0x194A, 0x194B, 0x194A, 0x194A, 0x194A, 0x192A, 0x0866, 0x1909,
-    0x194A, 0x194A, 0x194A, 0x194B, 0x194B, 0x216B, 0x10C8, 0x1066,
-    0x1067, 0x1066, 0x1066, 0x1067, 0x1066, 0x1066, 0x1046, 0x1046,
-    0x3107, 0x1886, 0x1026, 0x20A6, 0x30E7, 0x1866, 0x3907, 0x4127,
-    0x4127, 0x4127, 0x30E7, 0x1046, 0x1066, 0x1066, 0x1046, 0x1066,
-    0x1046, 0x1866, 0x38E7, 0x4127, 0x20A6, 0x20A6, 0x4127, 0x3906,
-    0x3906, 0x4106, 0x4106, 0x3926, 0x3926, 0x3926, 0x3927, 0x1886,
-    0x0846, 0x1046, 0x1046, 0x0846, 0x0846, 0x0845, 0x10C8, 0x214B,
-    0x194B, 0x194B, 0x194B, 0x192B, 0x192B, 0x192A, 0x194A, 0x194B,
-    0x194B, 0x192B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192A,
-    0x39AD, 0x39AD, 0x18E9, 0x214A, 0x212A, 0x5A0D, 0x6A4E, 0x6A4E,
-    0x6A4E, 0x6A2E, 0x6A2E, 0x6A0E, 0x6A2E, 0x6A0E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x398C, 0x398C, 0x6A6F, 0x6A2E, 0x620D, 0x622E,
-    0x620D, 0x620E, 0x6A2E, 0x6A2E, 0x622E, 0x6A4E, 0x622E, 0x622E,
-    0x49CD, 0x190A, 0x190A, 0x190A, 0x192A, 0x192A, 0x316C, 0x624F,
-    0x292A, 0x520D, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A0E, 0x622E, 0x294A,
-    0x18E9, 0x398C, 0x6A4E, 0x6A2E, 0x622E, 0x294B, 0x192A, 0x194B,
-    0x192B, 0x192B, 0x192B, 0x194B, 0x214B, 0x212A, 0x3169, 0x6A48,
-    0x6A26, 0x7267, 0x3906, 0x3906, 0x6A49, 0x3085, 0x7269, 0x38E6,
-    0x4966, 0x59C7, 0x30E6, 0x3906, 0x3906, 0x20A6, 0x0846, 0x4147,
-    0x6208, 0x30C5, 0x7268, 0x7A47, 0x7247, 0x4167, 0x0825, 0x1067,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1887, 0x1866, 0x1866,
-    0x1866, 0x1865, 0x6A28, 0x4145, 0x61E7, 0x61E7, 0x4946, 0x7A89,
-    0x4106, 0x4127, 0x4106, 0x61E7, 0x7248, 0x4105, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A87,
-    0x6A87, 0x3184, 0x2965, 0x0023, 0x4166, 0x7A67, 0x7A67, 0x7A67,
-    0x194B, 0x194B, 0x196B, 0x1109, 0x0866, 0x1064, 0x7267, 0x3987,
-    0x194A, 0x196B, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x0887, 0x10C8, 0x216B, 0x190A, 0x0846,
-    0x194B, 0x194B, 0x194A, 0x194A, 0x194A, 0x192A, 0x1067, 0x1046,
-    0x18E9, 0x194B, 0x194A, 0x194B, 0x194B, 0x194B, 0x194B, 0x18E9,
-    0x1046, 0x1067, 0x1066, 0x1066, 0x1066, 0x1066, 0x1067, 0x1067,
-    0x1066, 0x1046, 0x1046, 0x1066, 0x1066, 0x1046, 0x1866, 0x3107,
-    0x4127, 0x3926, 0x4127, 0x30E7, 0x1066, 0x1046, 0x1066, 0x1066,
-    0x1066, 0x1067, 0x1066, 0x3107, 0x3907, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x4106, 0x3906, 0x4126, 0x3926, 0x3926, 0x3926, 0x3927,
-    0x1886, 0x0846, 0x1046, 0x0846, 0x1066, 0x1046, 0x1066, 0x1067,
-    0x1067, 0x1087, 0x192B, 0x192A, 0x192A, 0x192A, 0x192A, 0x194B,
-    0x194B, 0x192B, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B, 0x192A,
-    0x212A, 0x190A, 0x294A, 0x622E, 0x620D, 0x620D, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A0E, 0x6A2E, 0x6A2E, 0x620E,
-    0x6A4F, 0x312A, 0x49ED, 0x49ED, 0x314B, 0x624F, 0x2109, 0x5A0D,
-    0x398B, 0x396B, 0x6A4E, 0x622E, 0x622E, 0x6A6F, 0x41AC, 0x212A,
-    0x214B, 0x192A, 0x192A, 0x192B, 0x110A, 0x398C, 0x5A2E, 0x292A,
-    0x5A2E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E, 0x61ED, 0x292A, 0x110A,
-    0x41AC, 0x622E, 0x6A2E, 0x622E, 0x294B, 0x192B, 0x192B, 0x192A,
-    0x192B, 0x194B, 0x194B, 0x192B, 0x3169, 0x6A47, 0x6A48, 0x4125,
-    0x6A48, 0x2884, 0x4946, 0x59A8, 0x38C5, 0x7269, 0x38C5, 0x61E8,
-    0x51A7, 0x30E6, 0x3906, 0x3906, 0x3106, 0x1866, 0x0805, 0x3106,
-    0x7A67, 0x7247, 0x7247, 0x7A88, 0x4147, 0x1046, 0x1066, 0x1046,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x1066, 0x1067, 0x1046, 0x6229, 0x51A7, 0x4967,
-    0x6A48, 0x4125, 0x3905, 0x6A27, 0x4966, 0x51A6, 0x6A48, 0x4126,
-    0x4127, 0x3906, 0x61E7, 0x8287, 0x7A67, 0x7A47, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A47, 0x8287, 0x51C5, 0x2963,
-    0x31A4, 0x3184, 0x0864, 0x0845, 0x0024, 0x3104, 0x8287, 0x7A47,
-    0x194B, 0x194B, 0x216B, 0x10E8, 0x0005, 0x1044, 0x7AA7, 0x6A67,
-    0x3189, 0x112A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194B, 0x194B, 0x192A, 0x10C8, 0x10E9, 0x194B, 0x192A,
-    0x0867, 0x192A, 0x196B, 0x194A, 0x194A, 0x194A, 0x192A, 0x1066,
-    0x1046, 0x18E9, 0x216B, 0x194B, 0x194B, 0x194B, 0x196B, 0x18E9,
-    0x1046, 0x1067, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1046, 0x1067, 0x1046, 0x1046, 0x1066, 0x1046, 0x1046, 0x3107,
-    0x4127, 0x3906, 0x3926, 0x3926, 0x30E6, 0x1866, 0x1046, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1866, 0x30E6, 0x4126, 0x3906, 0x3926,
-    0x3906, 0x3906, 0x3906, 0x4106, 0x4107, 0x4127, 0x3926, 0x4126,
-    0x3906, 0x20A6, 0x0825, 0x1066, 0x1046, 0x1046, 0x1046, 0x1066,
-    0x1066, 0x0866, 0x1087, 0x0866, 0x0866, 0x10C8, 0x214B, 0x194B,
-    0x194B, 0x31EE, 0x3A0F, 0x29AD, 0x194B, 0x194B, 0x190A, 0x49CC,
-    0x5A0D, 0x520D, 0x5A0D, 0x6A2E, 0x6A2E, 0x6A2E, 0x6A0E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x726E, 0x6A2E, 0x724E, 0x49CC, 0x396B, 0x622E,
-    0x292A, 0x51ED, 0x398C, 0x41AC, 0x520E, 0x294A, 0x522E, 0x316B,
-    0x418C, 0x5A0D, 0x620D, 0x620D, 0x6A4E, 0x41AC, 0x214B, 0x192B,
-    0x192B, 0x192B, 0x192B, 0x110A, 0x398C, 0x49CD, 0x396C, 0x51ED,
-    0x6A4E, 0x6A2E, 0x726F, 0x51ED, 0x396B, 0x6A4E, 0x212A, 0x110A,
-    0x51ED, 0x59ED, 0x294B, 0x294B, 0x192B, 0x192B, 0x192B, 0x192B,
-    0x192A, 0x192B, 0x192A, 0x49C9, 0x7288, 0x6A27, 0x4966, 0x6A48,
-    0x2884, 0x4987, 0x4126, 0x4126, 0x6208, 0x4926, 0x6208, 0x5167,
-    0x4126, 0x3906, 0x3906, 0x3106, 0x1866, 0x0825, 0x3926, 0x6227,
-    0x7247, 0x7247, 0x7A88, 0x4147, 0x1867, 0x1067, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1066, 0x3947, 0x59E8, 0x28C6, 0x6229, 0x5186, 0x6207, 0x6207,
-    0x5166, 0x7227, 0x6A07, 0x7247, 0x6A27, 0x59C6, 0x4146, 0x3906,
-    0x38E6, 0x61E7, 0x7A67, 0x8267, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A47, 0x7A87, 0x5206,
-    0x2963, 0x2964, 0x0844, 0x0004, 0x3126, 0x6A47, 0x7A67, 0x7A67,
-    0x194B, 0x194B, 0x196B, 0x192A, 0x10E9, 0x1909, 0x3105, 0x6A46,
-    0x6247, 0x3189, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x218B, 0x10A8, 0x10A8, 0x216B, 0x10C8,
-    0x1909, 0x10A7, 0x1909, 0x194A, 0x194A, 0x194A, 0x194A, 0x1909,
-    0x1067, 0x1067, 0x18E9, 0x194B, 0x194B, 0x194A, 0x194B, 0x192A,
-    0x10C8, 0x1046, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1067, 0x1046, 0x28C7, 0x20A7, 0x1046, 0x1046, 0x1046, 0x1886,
-    0x3106, 0x4127, 0x4127, 0x3926, 0x3927, 0x30E6, 0x1886, 0x1046,
-    0x1067, 0x1066, 0x1066, 0x1046, 0x1886, 0x30E6, 0x4127, 0x3906,
-    0x3906, 0x4106, 0x4126, 0x4126, 0x4106, 0x4127, 0x4126, 0x3906,
-    0x4126, 0x3906, 0x20A6, 0x0846, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1046, 0x0845, 0x20A6, 0x28A6, 0x18A6, 0x10A8, 0x10C8,
-    0x10C8, 0x210A, 0x210A, 0x212A, 0x194B, 0x214B, 0x49CD, 0x620D,
-    0x6A2E, 0x724E, 0x726E, 0x6A2E, 0x6A4E, 0x6A2E, 0x6A2E, 0x6A2E,
-    0x6A2E, 0x6A4E, 0x398B, 0x624E, 0x51ED, 0x398B, 0x41CD, 0x316B,
-    0x41AC, 0x316B, 0x41AC, 0x41AC, 0x39AC, 0x51ED, 0x5A0E, 0x49CD,
-    0x5A0D, 0x6A2E, 0x622D, 0x622E, 0x398C, 0x212B, 0x192B, 0x194B,
-    0x192B, 0x190A, 0x190A, 0x398C, 0x622E, 0x49AD, 0x212A, 0x726F,
-    0x398B, 0x624E, 0x520D, 0x41AC, 0x49ED, 0x398C, 0x214B, 0x192A,
-    0x316B, 0x296B, 0x110A, 0x192A, 0x192B, 0x192B, 0x192A, 0x110A,
-    0x294A, 0x5A08, 0x51E8, 0x7267, 0x51A6, 0x5187, 0x59C7, 0x4106,
-    0x5187, 0x4126, 0x4966, 0x5187, 0x5166, 0x59C7, 0x59C7, 0x4127,
-    0x3906, 0x4127, 0x3107, 0x2086, 0x1046, 0x0826, 0x51A7, 0x7A87,
-    0x7247, 0x7247, 0x4147, 0x1867, 0x1047, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x0846, 0x1066, 0x0806,
-    0x3927, 0x59E7, 0x5186, 0x6A28, 0x59C7, 0x6A28, 0x61E7, 0x59C7,
-    0x6A07, 0x7A87, 0x7A67, 0x7A47, 0x8287, 0x6A27, 0x3965, 0x3145,
-    0x59C6, 0x7A47, 0x8267, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A46, 0x7A67, 0x59E5, 0x3164,
-    0x2143, 0x2944, 0x0023, 0x3126, 0x7A87, 0x8AA7, 0x7A67, 0x82A7,
-    0x194B, 0x196B, 0x196B, 0x196B, 0x192A, 0x10E8, 0x0004, 0x2904,
-    0x6226, 0x5208, 0x112A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194B, 0x194B, 0x10E9, 0x10C8, 0x1909, 0x10C8,
-    0x18E8, 0x10A7, 0x1109, 0x194A, 0x194A, 0x194A, 0x194A, 0x196B,
-    0x190A, 0x1067, 0x1087, 0x216B, 0x194B, 0x194A, 0x194A, 0x196B,
-    0x192A, 0x10A7, 0x1046, 0x10A8, 0x1087, 0x1046, 0x1066, 0x1066,
-    0x1066, 0x1046, 0x28C7, 0x28E7, 0x20A6, 0x20A7, 0x20A7, 0x1046,
-    0x1886, 0x28C6, 0x30E6, 0x4127, 0x3927, 0x4127, 0x30E7, 0x1886,
-    0x1046, 0x1066, 0x1046, 0x1066, 0x1046, 0x1886, 0x30E6, 0x4127,
-    0x3926, 0x4126, 0x4126, 0x4126, 0x4107, 0x3906, 0x4106, 0x3926,
-    0x3906, 0x4127, 0x3906, 0x2086, 0x1046, 0x1046, 0x1066, 0x1066,
-    0x1046, 0x1046, 0x1046, 0x3107, 0x4147, 0x30E6, 0x1866, 0x0846,
-    0x1046, 0x0846, 0x0825, 0x1086, 0x10E8, 0x18E8, 0x418B, 0x620D,
-    0x724E, 0x5A0D, 0x49CC, 0x6A4E, 0x49AC, 0x622E, 0x51CC, 0x51CC,
-    0x622E, 0x41AC, 0x39AC, 0x41CD, 0x41AC, 0x41AC, 0x49CD, 0x316B,
-    0x41AC, 0x396B, 0x41AC, 0x398C, 0x398C, 0x5A2E, 0x5A0D, 0x6A4E,
-    0x6A4E, 0x6A4E, 0x620D, 0x41AC, 0x190A, 0x192A, 0x192B, 0x192A,
-    0x214B, 0x41CD, 0x39AC, 0x622E, 0x59ED, 0x398C, 0x41AC, 0x41AC,
-    0x398B, 0x49CC, 0x296B, 0x316C, 0x49ED, 0x190A, 0x194B, 0x194B,
-    0x192A, 0x192A, 0x192A, 0x192A, 0x192B, 0x192A, 0x3189, 0x41A9,
-    0x51E8, 0x7A67, 0x7A67, 0x7A87, 0x5186, 0x5166, 0x61C7, 0x4126,
-    0x59A7, 0x4126, 0x51A7, 0x51A7, 0x4946, 0x59C7, 0x3906, 0x4127,
-    0x4127, 0x3927, 0x28C7, 0x1046, 0x1067, 0x0826, 0x4966, 0x7A87,
-    0x6A27, 0x4966, 0x1046, 0x1047, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x0846, 0x1866, 0x3947, 0x20A6, 0x3106,
-    0x4987, 0x59C7, 0x5186, 0x6207, 0x5186, 0x6A08, 0x61C7, 0x69E6,
-    0x82A7, 0x7A67, 0x7A67, 0x7A87, 0x61E6, 0x61E6, 0x5A06, 0x2964,
-    0x7267, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x51C5, 0x3984,
-    0x41A4, 0x3164, 0x0043, 0x3946, 0x49A6, 0x6206, 0x8288, 0x61C7,
-    0x196B, 0x196B, 0x194A, 0x1109, 0x08A7, 0x0003, 0x1084, 0x0023,
-    0x3965, 0x41E8, 0x192A, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194B, 0x194B, 0x298A, 0x218B, 0x10E9, 0x0887, 0x1929,
-    0x0866, 0x10E8, 0x192A, 0x194A, 0x194A, 0x194A, 0x194B, 0x194B,
-    0x196B, 0x190A, 0x10A8, 0x192A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x1087, 0x192A, 0x18E9, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1046, 0x20A7, 0x4147, 0x4127, 0x4127, 0x20A6,
-    0x1046, 0x0846, 0x1066, 0x3107, 0x3927, 0x3927, 0x3948, 0x30E7,
-    0x1866, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1866, 0x3107,
-    0x4126, 0x4106, 0x4127, 0x4127, 0x4126, 0x4106, 0x4106, 0x3926,
-    0x3906, 0x3906, 0x4106, 0x3907, 0x1886, 0x1046, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1046, 0x28C7, 0x3907, 0x4127, 0x3907, 0x1866,
-    0x1066, 0x1066, 0x1066, 0x1046, 0x0846, 0x0846, 0x0825, 0x416B,
-    0x6A2E, 0x51ED, 0x316B, 0x520E, 0x314B, 0x49ED, 0x316B, 0x396B,
-    0x49CC, 0x292A, 0x522E, 0x316B, 0x49CD, 0x49CD, 0x314B, 0x520E,
-    0x292A, 0x49CD, 0x398B, 0x398C, 0x49ED, 0x418C, 0x624E, 0x6A4E,
-    0x5A2E, 0x5A0E, 0x41CC, 0x110A, 0x192A, 0x192B, 0x192B, 0x214B,
-    0x398C, 0x5A0E, 0x6A4F, 0x5A0E, 0x316B, 0x398C, 0x51ED, 0x292A,
-    0x51ED, 0x316B, 0x212A, 0x192B, 0x192A, 0x194B, 0x194B, 0x194B,
-    0x192B, 0x194B, 0x192B, 0x192A, 0x316A, 0x2129, 0x5A08, 0x7A67,
-    0x6A06, 0x7247, 0x61E7, 0x7247, 0x7268, 0x51A7, 0x5146, 0x6A28,
-    0x4106, 0x6A28, 0x5187, 0x4946, 0x6208, 0x30C5, 0x3907, 0x30E7,
-    0x30E7, 0x28E7, 0x1887, 0x1067, 0x1067, 0x1886, 0x59C6, 0x7247,
-    0x4167, 0x0825, 0x1047, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x20A7, 0x28C6, 0x3106, 0x6228, 0x5186, 0x6207,
-    0x4986, 0x5186, 0x6A28, 0x4125, 0x7AA8, 0x5186, 0x6A07, 0x82A7,
-    0x7A67, 0x7A67, 0x7A67, 0x6A27, 0x4945, 0x61C6, 0x6A47, 0x2944,
-    0x7267, 0x7A66, 0x7A66, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x6A07, 0x7247, 0x7A67, 0x8287,
-    0x6A47, 0x2943, 0x0864, 0x0004, 0x0004, 0x28E6, 0x6228, 0x4947,
-    0x196B, 0x216B, 0x08A7, 0x0887, 0x1109, 0x0844, 0x49E6, 0x3985,
-    0x2944, 0x2147, 0x194B, 0x194A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194B, 0x194A, 0x6AA8, 0x4209, 0x112B, 0x1909, 0x0846,
-    0x192A, 0x0866, 0x10C8, 0x194A, 0x194A, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x196B, 0x1909, 0x1066, 0x194A, 0x196B, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x196B, 0x18E9, 0x1046, 0x1066,
-    0x1067, 0x1067, 0x1047, 0x20A7, 0x3927, 0x3906, 0x3906, 0x3927,
-    0x20A6, 0x1046, 0x1066, 0x1866, 0x3907, 0x3129, 0x212A, 0x3128,
-    0x30E7, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1866,
-    0x3907, 0x4126, 0x4106, 0x4126, 0x3926, 0x3926, 0x4127, 0x3926,
-    0x3926, 0x3906, 0x3906, 0x3906, 0x3927, 0x1886, 0x1046, 0x1046,
-    0x1046, 0x1066, 0x1066, 0x0846, 0x28C6, 0x4127, 0x3907, 0x3907,
-    0x1066, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1067, 0x0846,
-    0x416B, 0x6A4F, 0x51ED, 0x292A, 0x624F, 0x314A, 0x49CC, 0x49CD,
-    0x292A, 0x5A4F, 0x210A, 0x5A2E, 0x398C, 0x396B, 0x520E, 0x2109,
-    0x5A2E, 0x290A, 0x41AC, 0x41AC, 0x292A, 0x622E, 0x622D, 0x6A4E,
-    0x39AC, 0x190A, 0x192B, 0x192A, 0x192A, 0x192B, 0x190A, 0x41AC,
-    0x5A2E, 0x210A, 0x5A4E, 0x294A, 0x49CD, 0x49ED, 0x292A, 0x5A2E,
-    0x20E9, 0x51ED, 0x39AC, 0x190A, 0x214B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x192B, 0x2949, 0x7269, 0x51A7, 0x6208, 0x59A6,
-    0x4125, 0x6A48, 0x3905, 0x6207, 0x4966, 0x5166, 0x6A48, 0x40E5,
-    0x7269, 0x4126, 0x59A7, 0x61E8, 0x30C5, 0x3906, 0x3906, 0x1866,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1866, 0x59E8, 0x7268, 0x4147,
-    0x0825, 0x1067, 0x1047, 0x1046, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1887, 0x1066, 0x51C8, 0x82A8, 0x61E7, 0x3905, 0x6A48, 0x4145,
-    0x61E7, 0x6207, 0x4945, 0x7A67, 0x7A67, 0x8287, 0x8287, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x4945, 0x61E7, 0x8287, 0x6226, 0x3164,
-    0x6A27, 0x7A67, 0x7A66, 0x7A66, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7247, 0x3905, 0x6207, 0x7267, 0x7247,
-    0x6226, 0x2943, 0x0864, 0x0044, 0x0865, 0x0845, 0x28E5, 0x82E9,
-    0x196B, 0x196B, 0x196B, 0x10C8, 0x0024, 0x0044, 0x0843, 0x49E5,
-    0x6266, 0x39A7, 0x190A, 0x192A, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x196B, 0x194A, 0x6AA8, 0x4A08, 0x112A, 0x194A, 0x194A,
-    0x192A, 0x194A, 0x10A7, 0x10C8, 0x216B, 0x194B, 0x194B, 0x194B,
-    0x196B, 0x1909, 0x1066, 0x1067, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x196B, 0x18E9, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x20A6, 0x4127, 0x3926, 0x3926,
-    0x3906, 0x3907, 0x3907, 0x3927, 0x3927, 0x1886, 0x10A8, 0x1888,
-    0x1066, 0x1066, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1866, 0x3907, 0x4127, 0x3906, 0x3926, 0x4106, 0x4107, 0x3926,
-    0x3926, 0x3926, 0x3906, 0x3906, 0x3906, 0x3907, 0x2086, 0x0846,
-    0x1066, 0x1066, 0x1066, 0x0846, 0x28C6, 0x4127, 0x3907, 0x3906,
-    0x3907, 0x1865, 0x0846, 0x1066, 0x1066, 0x1066, 0x1066, 0x0846,
-    0x416B, 0x418B, 0x294A, 0x522E, 0x20E9, 0x520E, 0x398B, 0x398C,
-    0x522E, 0x210A, 0x5A2F, 0x292A, 0x41AC, 0x41AC, 0x292A, 0x5A2E,
-    0x210A, 0x51EE, 0x316B, 0x316B, 0x49ED, 0x2109, 0x622E, 0x318C,
-    0x192A, 0x194B, 0x194B, 0x192B, 0x194B, 0x110A, 0x41CD, 0x41CC,
-    0x292A, 0x5A4F, 0x212A, 0x522E, 0x398B, 0x398B, 0x5A2E, 0x2109,
-    0x5A2E, 0x316B, 0x190A, 0x192B, 0x192B, 0x194B, 0x194B, 0x194B,
-    0x194B, 0x192B, 0x2949, 0x6249, 0x4125, 0x7268, 0x5987, 0x59A7,
-    0x6A28, 0x3905, 0x6A48, 0x4126, 0x51A7, 0x59C7, 0x4126, 0x6208,
-    0x4106, 0x6A08, 0x5186, 0x3906, 0x3106, 0x1046, 0x1066, 0x1066,
-    0x1066, 0x1067, 0x1067, 0x1866, 0x6A49, 0x30E6, 0x1866, 0x1866,
-    0x1067, 0x1047, 0x1046, 0x1067, 0x1046, 0x1046, 0x1046, 0x1866,
-    0x4168, 0x3927, 0x6A48, 0x6A07, 0x4945, 0x7288, 0x4125, 0x6A07,
-    0x7A67, 0x7A47, 0x7247, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x8287,
-    0x8287, 0x7A87, 0x4945, 0x7227, 0x8287, 0x7A87, 0x6A66, 0x39A4,
-    0x0843, 0x59E6, 0x8287, 0x7A66, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x8287, 0x7227, 0x4105, 0x7268, 0x4145, 0x59C6, 0x6246,
-    0x2963, 0x2964, 0x0843, 0x18E4, 0x2105, 0x49A7, 0x7269, 0x4126,
-    0x194B, 0x194B, 0x194A, 0x196B, 0x1109, 0x0024, 0x0024, 0x2944,
-    0x3184, 0x41A5, 0x6A47, 0x5A08, 0x214A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x0045, 0x6247, 0x4208, 0x112A, 0x194A, 0x194A,
-    0x194A, 0x0887, 0x10E8, 0x10E9, 0x10A8, 0x216B, 0x194B, 0x194A,
-    0x196B, 0x18E9, 0x1046, 0x1066, 0x1087, 0x192A, 0x196B, 0x194A,
-    0x194A, 0x194A, 0x194B, 0x194A, 0x194B, 0x194B, 0x18E9, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1066, 0x2086, 0x3927, 0x4126,
-    0x3926, 0x4127, 0x4127, 0x4127, 0x3926, 0x3107, 0x1887, 0x10A8,
-    0x1909, 0x1046, 0x1046, 0x1066, 0x1066, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1866, 0x30E6, 0x4127, 0x4126, 0x3906, 0x3906, 0x4127,
-    0x3927, 0x3926, 0x3926, 0x3926, 0x3906, 0x4126, 0x1886, 0x0846,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x28C6, 0x4127, 0x3906,
-    0x3906, 0x3906, 0x1886, 0x0846, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1886, 0x18E8, 0x214A, 0x316B, 0x51ED, 0x314A, 0x49CD, 0x41CD,
-    0x316B, 0x520E, 0x292A, 0x49CD, 0x398B, 0x398B, 0x520D, 0x296B,
-    0x5A2E, 0x318C, 0x49CD, 0x41CC, 0x314B, 0x49ED, 0x294B, 0x192A,
-    0x192A, 0x194B, 0x194B, 0x194B, 0x110A, 0x49ED, 0x398C, 0x398C,
-    0x51ED, 0x294A, 0x520E, 0x316B, 0x41CC, 0x49CD, 0x316B, 0x520E,
-    0x316B, 0x212B, 0x192A, 0x192A, 0x192B, 0x192B, 0x110A, 0x192B,
-    0x294A, 0x49A9, 0x6208, 0x4946, 0x6A48, 0x4946, 0x61E7, 0x6A08,
-    0x5186, 0x6A08, 0x4146, 0x38E6, 0x4126, 0x4147, 0x4107, 0x4127,
-    0x4127, 0x4967, 0x4147, 0x28C6, 0x1866, 0x1066, 0x1046, 0x1066,
-    0x1066, 0x1026, 0x2086, 0x6A49, 0x61E7, 0x20A7, 0x1047, 0x1067,
-    0x1067, 0x1066, 0x1067, 0x0805, 0x4167, 0x51A7, 0x3906, 0x6A49,
-    0x4126, 0x6A28, 0x59C6, 0x59C6, 0x6A27, 0x5186, 0x6A27, 0x7A67,
-    0x7A67, 0x7A67, 0x7A66, 0x7A66, 0x7A67, 0x7A67, 0x8287, 0x6A27,
-    0x4946, 0x5166, 0x7247, 0x7A67, 0x8287, 0x5A05, 0x3983, 0x41E5,
-    0x0003, 0x6207, 0x8287, 0x7A67, 0x7A67, 0x7A67, 0x8287, 0x7A67,
-    0x8287, 0x6A07, 0x5166, 0x7268, 0x5146, 0x6A27, 0x51C6, 0x2943,
-    0x2143, 0x2963, 0x0863, 0x0024, 0x41A6, 0x6207, 0x5166, 0x7268,
-    0x196B, 0x194B, 0x196B, 0x1109, 0x0886, 0x0024, 0x0004, 0x10C3,
-    0x1925, 0x2968, 0x41C8, 0x39A9, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194B, 0x214A, 0x3146, 0x6A86, 0x41C8, 0x110A, 0x194A, 0x194A,
-    0x194A, 0x10E9, 0x10A8, 0x10C9, 0x10E9, 0x10A8, 0x194B, 0x194B,
-    0x196B, 0x18E9, 0x1046, 0x1046, 0x1046, 0x10A7, 0x192A, 0x196B,
-    0x194A, 0x194B, 0x194A, 0x194A, 0x194B, 0x196B, 0x192A, 0x1046,
-    0x1067, 0x1066, 0x1066, 0x1066, 0x1046, 0x1046, 0x2086, 0x3907,
-    0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x2908, 0x10C8,
-    0x10A8, 0x18E9, 0x18E8, 0x1066, 0x1046, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x1046, 0x1886, 0x20A6, 0x28C6, 0x4127, 0x4127, 0x20A6,
-    0x30E6, 0x4127, 0x3906, 0x3926, 0x3906, 0x3906, 0x3906, 0x20A6,
-    0x0826, 0x0846, 0x1066, 0x1066, 0x1046, 0x1066, 0x20A6, 0x3906,
-    0x3906, 0x3906, 0x30E6, 0x1886, 0x0846, 0x1066, 0x1066, 0x1066,
-    0x0846, 0x1066, 0x10C8, 0x214B, 0x316B, 0x41CC, 0x41AC, 0x41AC,
-    0x49CD, 0x396B, 0x41AC, 0x398B, 0x212A, 0x212A, 0x316B, 0x192A,
-    0x318C, 0x192A, 0x318C, 0x296B, 0x190A, 0x318B, 0x190A, 0x192A,
-    0x192A, 0x194B, 0x194B, 0x192A, 0x49ED, 0x418C, 0x41AC, 0x41AC,
-    0x398B, 0x41AC, 0x396B, 0x41CC, 0x41AC, 0x398C, 0x49CD, 0x39AC,
-    0x192B, 0x192B, 0x192B, 0x192A, 0x192B, 0x192A, 0x49EA, 0x3149,
-    0x51E9, 0x61E7, 0x5187, 0x6208, 0x59A7, 0x61E7, 0x59C7, 0x4967,
-    0x4126, 0x51A7, 0x3906, 0x3906, 0x28C6, 0x1866, 0x28A6, 0x51A8,
-    0x28A6, 0x2087, 0x20A7, 0x1887, 0x1046, 0x1067, 0x1066, 0x1046,
-    0x0806, 0x28C7, 0x51A8, 0x3927, 0x20A7, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x0825, 0x4167, 0x51A6, 0x59C6, 0x61E7, 0x5186,
-    0x6207, 0x8287, 0x7247, 0x7A47, 0x8287, 0x6A06, 0x8287, 0x7A67,
-    0x7A66, 0x7A66, 0x7A66, 0x7A66, 0x7A66, 0x7A67, 0x61E6, 0x3925,
-    0x3906, 0x6A07, 0x8287, 0x8267, 0x8267, 0x7266, 0x5225, 0x3164,
-    0x0844, 0x1884, 0x61E6, 0x6A27, 0x5186, 0x7A87, 0x5185, 0x7A68,
-    0x61E6, 0x5186, 0x6A07, 0x59A6, 0x61E7, 0x51C6, 0x3144, 0x3984,
-    0x5A26, 0x2964, 0x0884, 0x0024, 0x20A5, 0x51A7, 0x59C7, 0x5186,
-    0x10C8, 0x194A, 0x192A, 0x0886, 0x0003, 0x0044, 0x20E5, 0x3144,
-    0x2148, 0x112C, 0x192B, 0x192B, 0x194B, 0x194A, 0x194B, 0x194A,
-    0x194A, 0x214A, 0x3145, 0x6245, 0x5A07, 0x2969, 0x194A, 0x194A,
-    0x194A, 0x216B, 0x18E9, 0x10A8, 0x18E9, 0x10C9, 0x194B, 0x194B,
-    0x194B, 0x1909, 0x1087, 0x1046, 0x1066, 0x1046, 0x10A8, 0x192A,
-    0x196B, 0x194B, 0x194A, 0x194A, 0x194B, 0x194B, 0x192A, 0x18C8,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x1066, 0x2086, 0x3906,
-    0x4127, 0x4107, 0x4127, 0x4126, 0x4127, 0x3906, 0x3148, 0x1909,
-    0x1087, 0x10E8, 0x194A, 0x18E9, 0x10C9, 0x10C8, 0x10A8, 0x1046,
-    0x1046, 0x1066, 0x1046, 0x0846, 0x1066, 0x30C6, 0x4127, 0x28A6,
-    0x20A6, 0x30E6, 0x4126, 0x3906, 0x3906, 0x3906, 0x4126, 0x4126,
-    0x3927, 0x3107, 0x1046, 0x0846, 0x1046, 0x1066, 0x20A6, 0x3906,
-    0x3906, 0x3906, 0x4127, 0x30E6, 0x1886, 0x1066, 0x0866, 0x1046,
-    0x1046, 0x1045, 0x1066, 0x18E9, 0x294A, 0x41CD, 0x41AC, 0x418C,
-    0x41AC, 0x314B, 0x41AC, 0x316B, 0x192A, 0x212A, 0x318B, 0x192A,
-    0x39AC, 0x214B, 0x110A, 0x192A, 0x192A, 0x110A, 0x192A, 0x192A,
-    0x192B, 0x192B, 0x214B, 0x41AC, 0x49ED, 0x39AC, 0x41AC, 0x41AC,
-    0x396B, 0x41AC, 0x316B, 0x41AC, 0x398C, 0x398C, 0x41CC, 0x190A,
-    0x192B, 0x194B, 0x192B, 0x112B, 0x214A, 0x41A9, 0x59C7, 0x51A7,
-    0x59C7, 0x59C7, 0x5186, 0x59E7, 0x5186, 0x61E7, 0x4966, 0x3906,
-    0x4147, 0x30E6, 0x28C7, 0x28C7, 0x1866, 0x1066, 0x30E6, 0x3947,
-    0x1066, 0x1047, 0x1067, 0x1067, 0x1067, 0x1067, 0x0846, 0x28E6,
-    0x3106, 0x4166, 0x4167, 0x0805, 0x1047, 0x1067, 0x1047, 0x1047,
-    0x1047, 0x2086, 0x3927, 0x59A7, 0x59C7, 0x51C7, 0x59C7, 0x5166,
-    0x7A67, 0x8287, 0x6246, 0x6246, 0x8287, 0x8287, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A66, 0x7A66, 0x8287, 0x59A6, 0x4125,
-    0x59C6, 0x8287, 0x7A67, 0x7A67, 0x8287, 0x7266, 0x5226, 0x41C5,
-    0x0844, 0x18A5, 0x4966, 0x59A6, 0x5186, 0x59A6, 0x5186, 0x59C7,
-    0x51A6, 0x59A7, 0x61E7, 0x61C6, 0x82A8, 0x59E6, 0x49A5, 0x6A26,
-    0x7A87, 0x3184, 0x0864, 0x0024, 0x20C5, 0x5186, 0x59C7, 0x5166,
-    0x0025, 0x1109, 0x10C9, 0x0045, 0x0024, 0x0844, 0x3985, 0x5A26,
-    0x41C8, 0x216A, 0x194B, 0x194B, 0x194A, 0x194B, 0x194A, 0x194A,
-    0x194A, 0x1908, 0x0002, 0x51C5, 0x7A86, 0x49C8, 0x112A, 0x194A,
-    0x194B, 0x194A, 0x216B, 0x190A, 0x1088, 0x192B, 0x196B, 0x194B,
-    0x194A, 0x196A, 0x1929, 0x1086, 0x1066, 0x1066, 0x1046, 0x10A7,
-    0x192A, 0x194B, 0x194B, 0x194A, 0x194B, 0x194B, 0x194B, 0x194B,
-    0x10A7, 0x1066, 0x1066, 0x1066, 0x1046, 0x1066, 0x3107, 0x3927,
-    0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x3907, 0x2929,
-    0x1929, 0x0887, 0x194B, 0x194B, 0x194B, 0x198C, 0x192A, 0x1087,
-    0x1087, 0x1066, 0x1046, 0x1046, 0x1046, 0x1046, 0x30E7, 0x4147,
-    0x20A6, 0x1866, 0x3907, 0x3926, 0x3906, 0x3926, 0x3906, 0x4967,
-    0x6A48, 0x6A28, 0x28C6, 0x1066, 0x0846, 0x20A6, 0x4127, 0x3906,
-    0x3906, 0x3926, 0x3906, 0x4127, 0x3907, 0x1886, 0x1886, 0x1066,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x418C, 0x210A, 0x41CC, 0x41AC,
-    0x292A, 0x51ED, 0x2909, 0x49CD, 0x398C, 0x398C, 0x520E, 0x212A,
-    0x5A2E, 0x318B, 0x192A, 0x192B, 0x192B, 0x192B, 0x192A, 0x192A,
-    0x192B, 0x192B, 0x398C, 0x520E, 0x294A, 0x520E, 0x398C, 0x398C,
-    0x51ED, 0x290A, 0x520D, 0x314A, 0x41AC, 0x41CD, 0x110A, 0x194B,
-    0x192B, 0x192B, 0x214A, 0x294A, 0x4189, 0x6208, 0x4146, 0x6208,
-    0x5186, 0x5186, 0x6207, 0x4925, 0x6A28, 0x4146, 0x3926, 0x3926,
-    0x30E7, 0x20A7, 0x1046, 0x1046, 0x1046, 0x28C7, 0x3927, 0x0825,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1867, 0x28A6, 0x6207,
-    0x7247, 0x3946, 0x0805, 0x1066, 0x1046, 0x1047, 0x20C7, 0x28C7,
-    0x2087, 0x5167, 0x7A68, 0x4966, 0x59C7, 0x59E7, 0x4945, 0x7A87,
-    0x7A47, 0x8287, 0x41C4, 0x39A4, 0x8287, 0x7A66, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A66, 0x7A67, 0x6A07, 0x6207, 0x7247,
-    0x7A67, 0x7A67, 0x7A67, 0x8287, 0x7247, 0x51C5, 0x49E4, 0x72C7,
-    0x0844, 0x49A7, 0x4986, 0x5186, 0x6207, 0x4125, 0x6A28, 0x5186,
-    0x59C7, 0x59A7, 0x5166, 0x7A88, 0x7A67, 0x7A67, 0x7A87, 0x7A87,
-    0x6A46, 0x39A4, 0x0844, 0x0004, 0x3966, 0x59C7, 0x4125, 0x6A47,
-    0x0887, 0x0867, 0x110A, 0x08C8, 0x0003, 0x0024, 0x0003, 0x4185,
-    0x7266, 0x51E8, 0x214A, 0x196B, 0x194B, 0x194B, 0x194A, 0x194A,
-    0x192A, 0x0865, 0x0002, 0x51C6, 0x6226, 0x3168, 0x194A, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x196B, 0x192A, 0x0866, 0x192A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x194A, 0x1067, 0x1066, 0x1067, 0x1066,
-    0x1087, 0x194A, 0x194A, 0x194B, 0x194B, 0x194B, 0x194A, 0x194A,
-    0x194A, 0x10A7, 0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x30E7,
-    0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x3927, 0x4106, 0x3128,
-    0x194A, 0x196B, 0x194B, 0x1088, 0x10EA, 0x196B, 0x194A, 0x194A,
-    0x194A, 0x1087, 0x1046, 0x1046, 0x1046, 0x1066, 0x1046, 0x3107,
-    0x28C6, 0x1026, 0x1866, 0x3907, 0x3906, 0x3926, 0x3926, 0x38E6,
-    0x4126, 0x6A27, 0x6A28, 0x20A6, 0x0826, 0x18A6, 0x3906, 0x3906,
-    0x4126, 0x4126, 0x3926, 0x3906, 0x3906, 0x3907, 0x3907, 0x1886,
-    0x1046, 0x1046, 0x1046, 0x1066, 0x1066, 0x192A, 0x1909, 0x314B,
-    0x49CD, 0x18E9, 0x520E, 0x294B, 0x41CD, 0x49ED, 0x190A, 0x192A,
-    0x190A, 0x192A, 0x192B, 0x192B, 0x192B, 0x192B, 0x212B, 0x192B,
-    0x192A, 0x41AC, 0x51ED, 0x210A, 0x624F, 0x314B, 0x49CD, 0x49ED,
-    0x294A, 0x5A2E, 0x2109, 0x49ED, 0x318B, 0x110A, 0x192A, 0x192A,
-    0x194B, 0x212A, 0x3969, 0x6208, 0x6A28, 0x4125, 0x6A48, 0x4945,
-    0x61E7, 0x59E7, 0x4126, 0x6A28, 0x3906, 0x3907, 0x3927, 0x28C6,
-    0x0846, 0x1066, 0x1067, 0x1046, 0x28C7, 0x28C7, 0x0846, 0x1067,
-    0x1066, 0x1066, 0x1067, 0x1067, 0x1067, 0x1887, 0x6A28, 0x7248,
-    0x30E6, 0x0825, 0x1067, 0x1046, 0x1066, 0x1025, 0x59C8, 0x6208,
-    0x4966, 0x7AA9, 0x4925, 0x7268, 0x51A6, 0x5186, 0x7A87, 0x7A46,
-    0x7A66, 0x8287, 0x49C4, 0x41A4, 0x8287, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7267, 0x3905, 0x59C6, 0x7A67,
-    0x7247, 0x7247, 0x7247, 0x7A87, 0x3925, 0x4165, 0x82C7, 0x6246,
-    0x1064, 0x0003, 0x4986, 0x6207, 0x4945, 0x7268, 0x40E5, 0x7248,
-    0x3946, 0x3926, 0x7A89, 0x4925, 0x7A88, 0x5986, 0x6207, 0x5A26,
-    0x39A4, 0x39A4, 0x0863, 0x0044, 0x0003, 0x2905, 0x6207, 0x30A4,
-    0x0024, 0x116A, 0x1108, 0x0024, 0x0024, 0x0044, 0x0044, 0x0003,
-    0x4165, 0x7287, 0x5208, 0x110A, 0x10EA, 0x194B, 0x194A, 0x194A,
-    0x194A, 0x1929, 0x0023, 0x0022, 0x4185, 0x6A68, 0x49C9, 0x194A,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194A, 0x192A, 0x0866, 0x1909,
-    0x196B, 0x194A, 0x194A, 0x192A, 0x1067, 0x1046, 0x1067, 0x1067,
-    0x1067, 0x1087, 0x194A, 0x194B, 0x194A, 0x194A, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x10C7, 0x1046, 0x1066, 0x1046, 0x1067, 0x1066,
-    0x30C7, 0x4127, 0x3927, 0x4127, 0x3927, 0x3926, 0x4127, 0x3127,
-    0x2149, 0x194B, 0x0867, 0x194B, 0x10C9, 0x10A8, 0x196B, 0x194A,
-    0x194A, 0x194A, 0x1087, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046,
-    0x28C7, 0x28C7, 0x0846, 0x1866, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x4146, 0x6A28, 0x6A27, 0x1885, 0x0826, 0x1046, 0x2086, 0x4127,
-    0x4127, 0x4127, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x1886, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046, 0x10C8, 0x192A,
-    0x192A, 0x192A, 0x214B, 0x194B, 0x214B, 0x214B, 0x194B, 0x192A,
-    0x192A, 0x192A, 0x192A, 0x192B, 0x192B, 0x214B, 0x624F, 0x294B,
-    0x41CD, 0x49CD, 0x314A, 0x5A0E, 0x20E9, 0x520E, 0x398C, 0x398C,
-    0x5A2E, 0x212A, 0x5A0E, 0x294B, 0x192A, 0x192A, 0x192A, 0x192B,
-    0x190A, 0x5A09, 0x7A88, 0x61C7, 0x5166, 0x7268, 0x4105, 0x6208,
-    0x51A7, 0x3926, 0x4126, 0x3906, 0x1866, 0x1066, 0x1066, 0x1066,
-    0x1046, 0x1066, 0x1046, 0x3908, 0x28A7, 0x1046, 0x1067, 0x1066,
-    0x1046, 0x1067, 0x1067, 0x1067, 0x1047, 0x1866, 0x6A49, 0x30E6,
-    0x1046, 0x1067, 0x1067, 0x1066, 0x28A5, 0x59C7, 0x4966, 0x59A7,
-    0x7268, 0x4925, 0x7A88, 0x5146, 0x61C6, 0x7A67, 0x7A66, 0x7A67,
-    0x7A66, 0x8287, 0x41C4, 0x41A4, 0x82A8, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x4945, 0x6207, 0x7247, 0x7A67,
-    0x6A27, 0x38E5, 0x7267, 0x3105, 0x4986, 0x7A87, 0x6226, 0x1063,
-    0x0004, 0x28E6, 0x3106, 0x5187, 0x6A28, 0x38E5, 0x7268, 0x59A7,
-    0x20A5, 0x2085, 0x5987, 0x7248, 0x4125, 0x7268, 0x4966, 0x2904,
-    0x39C4, 0x39A4, 0x3184, 0x0884, 0x0004, 0x1064, 0x3926, 0x7268,
-    0x0024, 0x10E8, 0x08A7, 0x0024, 0x0024, 0x0004, 0x0024, 0x2905,
-    0x18A4, 0x2905, 0x5A28, 0x39A9, 0x0865, 0x1909, 0x194B, 0x196B,
-    0x192A, 0x0865, 0x0002, 0x41A5, 0x41C7, 0x3189, 0x296A, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194A, 0x194A, 0x1909, 0x0886,
-    0x10E8, 0x196A, 0x194A, 0x194A, 0x192A, 0x1087, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1087, 0x1087, 0x1909, 0x196B, 0x194A, 0x194A,
-    0x194A, 0x194A, 0x194A, 0x18C8, 0x1046, 0x1066, 0x1066, 0x1047,
-    0x1866, 0x28C6, 0x4127, 0x3926, 0x3926, 0x3926, 0x3927, 0x4127,
-    0x3107, 0x10A8, 0x192A, 0x10A8, 0x10E9, 0x10C8, 0x0887, 0x196B,
-    0x194A, 0x194A, 0x192A, 0x18C8, 0x1046, 0x1067, 0x1066, 0x1046,
-    0x1866, 0x1866, 0x1046, 0x1866, 0x3927, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x4966, 0x6A27, 0x6207, 0x28C6, 0x0826, 0x1066, 0x2086,
-    0x3907, 0x4126, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x20A6, 0x0846, 0x1046, 0x1066, 0x1046, 0x1066, 0x1087,
-    0x10A7, 0x1909, 0x194B, 0x194B, 0x194A, 0x194A, 0x194B, 0x192A,
-    0x316B, 0x318C, 0x214B, 0x192B, 0x194B, 0x214B, 0x318C, 0x214B,
-    0x294B, 0x398C, 0x398B, 0x294A, 0x51ED, 0x398C, 0x214B, 0x214B,
-    0x298C, 0x192B, 0x296B, 0x212B, 0x192A, 0x192A, 0x192A, 0x190A,
-    0x6229, 0x8288, 0x59A6, 0x51A7, 0x61E7, 0x4966, 0x6A28, 0x5186,
-    0x4127, 0x4147, 0x3927, 0x1886, 0x1066, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x1046, 0x30E7, 0x28A7, 0x1866, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x1067, 0x0826, 0x2086, 0x59E9, 0x30E7, 0x1867,
-    0x1067, 0x1067, 0x0826, 0x1046, 0x6207, 0x4946, 0x59C7, 0x61C7,
-    0x5166, 0x7247, 0x8287, 0x7227, 0x7A47, 0x8287, 0x7A67, 0x7A67,
-    0x7A67, 0x5A05, 0x3183, 0x18E3, 0x30E5, 0x8287, 0x7A66, 0x8287,
-    0x7A67, 0x8287, 0x7247, 0x5165, 0x7247, 0x7A47, 0x8287, 0x61E6,
-    0x4966, 0x6A48, 0x4165, 0x5A07, 0x7247, 0x8267, 0x6A46, 0x2924,
-    0x0024, 0x0024, 0x0004, 0x20A5, 0x51A7, 0x6A48, 0x4966, 0x5188,
-    0x20C5, 0x1885, 0x4947, 0x5186, 0x61E7, 0x51E6, 0x3165, 0x3184,
-    0x3184, 0x0863, 0x2984, 0x2124, 0x0884, 0x0024, 0x1885, 0x5187,
-    0x0024, 0x0845, 0x10A6, 0x0885, 0x0844, 0x2905, 0x0824, 0x3985,
-    0x49C5, 0x3967, 0x3189, 0x2927, 0x0023, 0x1109, 0x216B, 0x1108,
-    0x0865, 0x0023, 0x20E3, 0x39A6, 0x216A, 0x112B, 0x196B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194A, 0x194A, 0x194A, 0x10E8,
-    0x1909, 0x194A, 0x194B, 0x194B, 0x196B, 0x1909, 0x18E9, 0x10A8,
-    0x1046, 0x1067, 0x1046, 0x1046, 0x1087, 0x1909, 0x196B, 0x194A,
-    0x194A, 0x194A, 0x194B, 0x192A, 0x18C8, 0x1067, 0x1067, 0x1067,
-    0x1046, 0x1866, 0x28C6, 0x4127, 0x4127, 0x3927, 0x4127, 0x4127,
-    0x3907, 0x28E7, 0x18C8, 0x1909, 0x10E8, 0x10A7, 0x10C7, 0x10A7,
-    0x194A, 0x194B, 0x196B, 0x194A, 0x10C8, 0x1067, 0x1066, 0x1046,
-    0x1046, 0x1046, 0x1046, 0x1066, 0x2086, 0x3906, 0x4106, 0x3906,
-    0x3906, 0x3906, 0x5186, 0x5187, 0x4967, 0x28E7, 0x0826, 0x1046,
-    0x3927, 0x4127, 0x4126, 0x3926, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x4127, 0x3907, 0x28C7, 0x28A6, 0x0845, 0x0825, 0x0846, 0x1046,
-    0x1046, 0x1087, 0x10C8, 0x194A, 0x194B, 0x194B, 0x192A, 0x192A,
-    0x216B, 0x296B, 0x214B, 0x192A, 0x192B, 0x194B, 0x192B, 0x194B,
-    0x192B, 0x214B, 0x294B, 0x190A, 0x39AC, 0x212B, 0x192A, 0x194B,
-    0x192A, 0x194B, 0x192B, 0x192A, 0x192B, 0x192A, 0x2949, 0x59E9,
-    0x5187, 0x5186, 0x59C7, 0x59C7, 0x51A6, 0x59C7, 0x51A7, 0x4127,
-    0x28C6, 0x20A6, 0x2087, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x1066, 0x28C7, 0x4127, 0x1886, 0x1046, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x0826, 0x20C6, 0x4987, 0x3107, 0x1066, 0x1046,
-    0x0826, 0x28C7, 0x59C7, 0x51A7, 0x7A67, 0x61C6, 0x7227, 0x6A27,
-    0x61C6, 0x8287, 0x7A67, 0x8287, 0x8267, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x41C4, 0x2122, 0x3144, 0x6207, 0x7A87, 0x82A7, 0x61A6,
-    0x7247, 0x7247, 0x59A6, 0x6A27, 0x5986, 0x7A68, 0x61E6, 0x51A6,
-    0x61E7, 0x59A6, 0x51E6, 0x49C5, 0x6A46, 0x6A46, 0x49C4, 0x39A4,
-    0x0823, 0x2906, 0x1064, 0x28C5, 0x6A28, 0x59C6, 0x51C6, 0x4147,
-    0x20A6, 0x0824, 0x1885, 0x4106, 0x7267, 0x39A4, 0x39C5, 0x3164,
-    0x18A3, 0x2104, 0x10C4, 0x10A4, 0x0864, 0x0024, 0x0024, 0x1065,
-    0x0024, 0x08C7, 0x10E7, 0x0065, 0x0864, 0x2105, 0x0044, 0x2125,
-    0x6266, 0x5209, 0x00EA, 0x0045, 0x0004, 0x10A7, 0x192A, 0x1929,
-    0x0866, 0x0044, 0x2104, 0x3986, 0x41E9, 0x298A, 0x194B, 0x194B,
-    0x194B, 0x196B, 0x196B, 0x196A, 0x194A, 0x194A, 0x194A, 0x196B,
-    0x196B, 0x196B, 0x194B, 0x194B, 0x194B, 0x196B, 0x196B, 0x192A,
-    0x10A7, 0x1067, 0x1066, 0x1066, 0x1046, 0x1087, 0x1909, 0x196B,
-    0x194A, 0x194A, 0x194A, 0x196B, 0x192A, 0x1046, 0x1067, 0x1067,
-    0x1046, 0x1046, 0x1866, 0x28C6, 0x28C6, 0x3927, 0x4127, 0x4127,
-    0x4127, 0x4147, 0x20A6, 0x18C8, 0x10A7, 0x10E9, 0x192A, 0x1087,
-    0x18E9, 0x194B, 0x196B, 0x196B, 0x192A, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x1066, 0x1046, 0x1046, 0x1046, 0x20A6, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x3906, 0x38E6, 0x4967, 0x4967, 0x3107, 0x3107,
-    0x28C6, 0x20A6, 0x20A6, 0x20A6, 0x28C6, 0x4126, 0x4127, 0x4127,
-    0x4127, 0x4127, 0x4127, 0x3906, 0x20A6, 0x20A6, 0x1066, 0x1046,
-    0x1066, 0x1066, 0x1046, 0x10C8, 0x10E9, 0x10E9, 0x194A, 0x194B,
-    0x192A, 0x192B, 0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192B,
-    0x194B, 0x194B, 0x192B, 0x192B, 0x112A, 0x192A, 0x192A, 0x192B,
-    0x194B, 0x194B, 0x192B, 0x41AB, 0x2929, 0x2929, 0x59E8, 0x59C7,
-    0x4146, 0x3906, 0x5187, 0x5187, 0x4146, 0x59C7, 0x3906, 0x30E7,
-    0x1886, 0x0846, 0x1046, 0x1046, 0x1046, 0x1046, 0x0846, 0x1066,
-    0x28A6, 0x4127, 0x28C6, 0x1867, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1886, 0x3926, 0x3927, 0x0005, 0x0826, 0x30E7,
-    0x3907, 0x59A7, 0x8AA7, 0x8287, 0x7A66, 0x7A67, 0x7A67, 0x7A67,
-    0x7A87, 0x7A67, 0x7A67, 0x8267, 0x8287, 0x8287, 0x8267, 0x8287,
-    0x7A67, 0x6A46, 0x3143, 0x2923, 0x6207, 0x7A87, 0x61E6, 0x59A7,
-    0x61C7, 0x61E7, 0x59C7, 0x6A07, 0x59A6, 0x61C7, 0x59C7, 0x59C7,
-    0x61E7, 0x5987, 0x51C6, 0x49A5, 0x49C5, 0x41A4, 0x3163, 0x18A3,
-    0x0023, 0x2905, 0x3926, 0x4987, 0x6A07, 0x61E7, 0x51E6, 0x4166,
-    0x1885, 0x0824, 0x28C5, 0x4126, 0x51A7, 0x39A4, 0x41E5, 0x3164,
-    0x10A3, 0x2104, 0x0024, 0x0024, 0x0024, 0x1085, 0x20E6, 0x20A5,
-    0x0866, 0x114B, 0x08A7, 0x0004, 0x0024, 0x0024, 0x0024, 0x0884,
-    0x3985, 0x49E8, 0x2128, 0x0003, 0x0024, 0x0845, 0x10A7, 0x192A,
-    0x10E8, 0x0024, 0x0004, 0x3965, 0x7287, 0x6248, 0x296A, 0x194A,
-    0x194B, 0x1109, 0x192A, 0x194A, 0x194A, 0x194A, 0x194A, 0x196B,
-    0x194A, 0x194A, 0x196B, 0x194B, 0x194B, 0x194B, 0x194A, 0x196B,
-    0x192A, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046, 0x1067, 0x192A,
-    0x194A, 0x194A, 0x194A, 0x194B, 0x192A, 0x1087, 0x1067, 0x1046,
-    0x1087, 0x1087, 0x1046, 0x1046, 0x1046, 0x30E7, 0x4127, 0x4127,
-    0x4127, 0x4127, 0x4127, 0x1865, 0x10A7, 0x192A, 0x194A, 0x194B,
-    0x1087, 0x18E9, 0x194B, 0x216B, 0x192A, 0x1087, 0x1087, 0x1887,
-    0x1066, 0x1046, 0x1046, 0x1046, 0x1047, 0x0826, 0x28C6, 0x4127,
-    0x3906, 0x3906, 0x4126, 0x4127, 0x3906, 0x4946, 0x61E8, 0x51A7,
-    0x1866, 0x1886, 0x20A6, 0x1065, 0x1046, 0x30E7, 0x30E7, 0x4127,
-    0x4127, 0x3907, 0x3906, 0x3906, 0x30E7, 0x3107, 0x1886, 0x1046,
-    0x1066, 0x1066, 0x1066, 0x1046, 0x0845, 0x1087, 0x1909, 0x1109,
-    0x190A, 0x190A, 0x190A, 0x190A, 0x190A, 0x190A, 0x194B, 0x194B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192A, 0x192A, 0x192B,
-    0x192B, 0x192A, 0x3149, 0x6A29, 0x4967, 0x4966, 0x6A08, 0x38E6,
-    0x4967, 0x4147, 0x3906, 0x4126, 0x3927, 0x28C6, 0x3107, 0x1866,
-    0x1046, 0x1066, 0x1066, 0x1047, 0x1046, 0x1886, 0x1866, 0x28C6,
-    0x4127, 0x3907, 0x1046, 0x1047, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1046, 0x3127, 0x28E7, 0x0825, 0x28C6, 0x28A5, 0x6A07,
-    0x82A8, 0x8287, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x8267, 0x7A47, 0x7A47, 0x8287, 0x7227,
-    0x7A67, 0x6A47, 0x3164, 0x0882, 0x1884, 0x5A07, 0x4125, 0x6A48,
-    0x59A6, 0x59C7, 0x7268, 0x5146, 0x7268, 0x5166, 0x61E7, 0x6207,
-    0x5166, 0x7288, 0x4105, 0x6A48, 0x51E6, 0x3124, 0x2924, 0x0022,
-    0x0024, 0x0003, 0x3106, 0x59C8, 0x5186, 0x7AA8, 0x4985, 0x4986,
-    0x18A4, 0x1064, 0x4147, 0x4146, 0x2924, 0x41A5, 0x3964, 0x2124,
-    0x2104, 0x0003, 0x0024, 0x0044, 0x0024, 0x18A5, 0x4987, 0x4967,
-    0x192A, 0x0046, 0x0024, 0x0044, 0x0025, 0x0044, 0x0044, 0x0024,
-    0x0004, 0x3966, 0x5A07, 0x0023, 0x0024, 0x0885, 0x0845, 0x0024,
-    0x0024, 0x0024, 0x0844, 0x0003, 0x3945, 0x7AA8, 0x5A28, 0x1929,
-    0x194A, 0x0044, 0x10C7, 0x216B, 0x194A, 0x1929, 0x194A, 0x216B,
-    0x10C8, 0x10C8, 0x216B, 0x194B, 0x194B, 0x194B, 0x194B, 0x196B,
-    0x192A, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x1066,
-    0x192A, 0x194A, 0x194A, 0x194B, 0x196B, 0x214B, 0x1067, 0x1046,
-    0x18E9, 0x1909, 0x1046, 0x1066, 0x1066, 0x1046, 0x28C7, 0x4127,
-    0x3927, 0x3926, 0x3906, 0x4127, 0x2086, 0x1087, 0x194A, 0x194B,
-    0x216B, 0x1088, 0x18C9, 0x216B, 0x194B, 0x196B, 0x194A, 0x3128,
-    0x20A6, 0x1066, 0x1886, 0x1866, 0x1886, 0x1866, 0x30E6, 0x4127,
-    0x3906, 0x3907, 0x3926, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x6208, 0x7268, 0x4987, 0x1045, 0x1066, 0x1046, 0x30E7,
-    0x3927, 0x3906, 0x3906, 0x3906, 0x1865, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x1046,
-    0x1066, 0x1066, 0x1046, 0x1046, 0x1046, 0x1066, 0x192A, 0x192A,
-    0x192B, 0x194B, 0x194B, 0x194B, 0x194B, 0x192B, 0x192A, 0x192A,
-    0x18E9, 0x20A7, 0x7249, 0x38E6, 0x51A7, 0x6208, 0x3906, 0x4147,
-    0x3927, 0x3927, 0x3927, 0x3927, 0x30E7, 0x1046, 0x1046, 0x1046,
-    0x1067, 0x1067, 0x1067, 0x1047, 0x1046, 0x3907, 0x4147, 0x3927,
-    0x3906, 0x3107, 0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1866, 0x1866, 0x30E6, 0x7A68, 0x7A67, 0x7A67,
-    0x7A47, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A47, 0x7A67, 0x5186, 0x59A6, 0x7268, 0x4925,
-    0x7A88, 0x3105, 0x18C4, 0x18E4, 0x0824, 0x20A5, 0x6A68, 0x4125,
-    0x6207, 0x6A07, 0x4945, 0x7AA9, 0x4925, 0x7268, 0x59A6, 0x59A7,
-    0x7248, 0x4105, 0x7268, 0x4125, 0x61E7, 0x4186, 0x0822, 0x2964,
-    0x0023, 0x0024, 0x1044, 0x4967, 0x7268, 0x4925, 0x7A88, 0x4146,
-    0x1064, 0x0004, 0x0024, 0x20E5, 0x49C5, 0x49C5, 0x20E3, 0x0002,
-    0x0042, 0x0843, 0x0024, 0x0024, 0x0044, 0x0024, 0x0865, 0x3107,
-    0x0046, 0x18E9, 0x0887, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x1884, 0x4186, 0x0023, 0x0024, 0x0865, 0x0886,
-    0x0024, 0x0024, 0x18C4, 0x39C5, 0x20E5, 0x0824, 0x1065, 0x10A7,
-    0x196A, 0x0044, 0x10C7, 0x216B, 0x1109, 0x0045, 0x194B, 0x218C,
-    0x0887, 0x0887, 0x216B, 0x194B, 0x196B, 0x194B, 0x194B, 0x194A,
-    0x194A, 0x192A, 0x1066, 0x1046, 0x1066, 0x1046, 0x1046, 0x1066,
-    0x1067, 0x1067, 0x1909, 0x196B, 0x194B, 0x192A, 0x1066, 0x1046,
-    0x1046, 0x10A8, 0x194A, 0x192A, 0x1067, 0x1066, 0x1866, 0x1866,
-    0x2086, 0x3927, 0x3927, 0x3927, 0x3927, 0x28C7, 0x1046, 0x1088,
-    0x194B, 0x216B, 0x10A8, 0x10A8, 0x216B, 0x194A, 0x0846, 0x28E7,
-    0x3927, 0x51A7, 0x6207, 0x61E7, 0x6207, 0x61E7, 0x6207, 0x59C7,
-    0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x4126, 0x3906, 0x4967, 0x6A48, 0x5A08, 0x1046, 0x0825,
-    0x28C6, 0x4127, 0x3906, 0x3906, 0x3906, 0x3907, 0x28C7, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x20A7, 0x3928, 0x3927,
-    0x3928, 0x1887, 0x1046, 0x1066, 0x1066, 0x1066, 0x1067, 0x1066,
-    0x18E9, 0x196B, 0x194B, 0x194B, 0x194B, 0x192B, 0x194B, 0x10C9,
-    0x1885, 0x6228, 0x38E6, 0x4147, 0x4147, 0x4126, 0x3927, 0x4127,
-    0x4127, 0x2907, 0x1886, 0x1066, 0x1066, 0x1066, 0x1067, 0x1066,
-    0x1066, 0x1067, 0x1046, 0x1866, 0x3927, 0x4127, 0x4127, 0x4127,
-    0x30E6, 0x1066, 0x1066, 0x1047, 0x1047, 0x1067, 0x1067, 0x1067,
-    0x1066, 0x1026, 0x4987, 0x7A88, 0x7247, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x8287,
-    0x7227, 0x4945, 0x7AA8, 0x4925, 0x61E7, 0x61E7, 0x5165, 0x82C9,
-    0x4105, 0x7AA8, 0x4185, 0x0004, 0x18A5, 0x6A48, 0x38E5, 0x6A48,
-    0x5186, 0x59A6, 0x7A88, 0x4925, 0x7AA9, 0x5146, 0x6A08, 0x6207,
-    0x4946, 0x7288, 0x4105, 0x6A28, 0x5187, 0x30E5, 0x3964, 0x2123,
-    0x0043, 0x0004, 0x3966, 0x59E8, 0x5187, 0x82A8, 0x4946, 0x3927,
-    0x1865, 0x0864, 0x18E5, 0x3164, 0x41A4, 0x41A4, 0x41A4, 0x39A5,
-    0x39C5, 0x3985, 0x0043, 0x0024, 0x0024, 0x0024, 0x1085, 0x3107,
-    0x0867, 0x0866, 0x0045, 0x0024, 0x0024, 0x0024, 0x0003, 0x3145,
-    0x18C4, 0x0003, 0x0003, 0x1064, 0x0023, 0x0024, 0x0865, 0x0886,
-    0x0044, 0x18E4, 0x2103, 0x41E5, 0x5A26, 0x3105, 0x0004, 0x0887,
-    0x0045, 0x0003, 0x10C7, 0x218B, 0x1929, 0x0025, 0x194B, 0x218C,
-    0x0886, 0x0887, 0x218C, 0x194B, 0x194B, 0x194B, 0x194A, 0x196A,
-    0x1929, 0x10A8, 0x192A, 0x192A, 0x10A7, 0x1046, 0x1066, 0x1046,
-    0x1046, 0x1067, 0x1067, 0x18E9, 0x216B, 0x194B, 0x190A, 0x1066,
-    0x1046, 0x1066, 0x10C8, 0x196B, 0x192A, 0x1087, 0x1046, 0x1046,
-    0x1066, 0x1886, 0x1866, 0x3907, 0x4147, 0x4147, 0x28C7, 0x1046,
-    0x1088, 0x1087, 0x18E9, 0x194A, 0x196B, 0x194A, 0x1909, 0x1086,
-    0x1045, 0x3926, 0x7268, 0x6A47, 0x6A07, 0x6A07, 0x6A27, 0x6A07,
-    0x61E7, 0x59C7, 0x3906, 0x3906, 0x3906, 0x3906, 0x3926, 0x3926,
-    0x3906, 0x3906, 0x3906, 0x4127, 0x4967, 0x4947, 0x59C7, 0x59E8,
-    0x28E6, 0x20A6, 0x4127, 0x3906, 0x3907, 0x4107, 0x3906, 0x30E7,
-    0x30E7, 0x28A7, 0x1887, 0x1066, 0x1066, 0x1066, 0x1886, 0x1887,
-    0x1866, 0x1067, 0x1066, 0x1066, 0x1066, 0x1066, 0x1046, 0x1046,
-    0x18E9, 0x216C, 0x192A, 0x1088, 0x1088, 0x3149, 0x20C8, 0x3107,
-    0x6208, 0x3106, 0x30E6, 0x4947, 0x4127, 0x3927, 0x4147, 0x3927,
-    0x1886, 0x1887, 0x1067, 0x1067, 0x1066, 0x1067, 0x1067, 0x1066,
-    0x1066, 0x1046, 0x1866, 0x30E7, 0x4127, 0x4147, 0x28E7, 0x1886,
-    0x1886, 0x1066, 0x1066, 0x1067, 0x1067, 0x1046, 0x0826, 0x1046,
-    0x59C8, 0x6207, 0x7247, 0x8287, 0x7A67, 0x7A67, 0x7A67, 0x7A67,
-    0x7A67, 0x7A67, 0x7A87, 0x7A67, 0x8287, 0x7A67, 0x8AA7, 0x6207,
-    0x3947, 0x7268, 0x5166, 0x6A28, 0x5186, 0x51A6, 0x6A48, 0x5166,
-    0x7268, 0x5205, 0x18E4, 0x0005, 0x1064, 0x4125, 0x6A48, 0x4965,
-    0x61E7, 0x61E7, 0x5166, 0x7268, 0x4986, 0x7248, 0x61C7, 0x59A6,
-    0x6207, 0x4945, 0x6A48, 0x4966, 0x51A6, 0x7247, 0x6226, 0x2943,
-    0x0023, 0x0024, 0x1064, 0x1065, 0x1865, 0x4987, 0x3907, 0x1065,
-    0x0024, 0x18C4, 0x3184, 0x2963, 0x2943, 0x41A4, 0x3144, 0x1904,
-    0x2944, 0x2124, 0x0023, 0x0004, 0x20C6, 0x20C6, 0x0024, 0x0865,
-    0x1087, 0x0025, 0x0024, 0x0024, 0x0024, 0x0864, 0x3145, 0x49E5,
-    0x18A3, 0x1084, 0x3105, 0x0004, 0x0866, 0x0044, 0x0044, 0x0045,
-    0x0044, 0x1084, 0x1084, 0x1083, 0x5206, 0x6A87, 0x2925, 0x1066,
-    0x4187, 0x0843, 0x10C8, 0x194A, 0x0886, 0x0045, 0x194B, 0x216B,
-    0x0886, 0x0045, 0x10E8, 0x196B, 0x216B, 0x196B, 0x196B, 0x196B,
-    0x1108, 0x0045, 0x194B, 0x196B, 0x192A, 0x10A7, 0x1066, 0x18E9,
-    0x1067, 0x1046, 0x1046, 0x1067, 0x10A8, 0x10A8, 0x216B, 0x1909,
-    0x1087, 0x1026, 0x1066, 0x10E8, 0x216B, 0x190A, 0x18E9, 0x10A7,
-    0x1046, 0x1046, 0x1046, 0x2086, 0x20A6, 0x30E7, 0x4968, 0x28E7,
-    0x1046, 0x1046, 0x1087, 0x10A8, 0x10C8, 0x196B, 0x194B, 0x10E9,
-    0x10C9, 0x20E8, 0x30E6, 0x3927, 0x6A28, 0x7247, 0x6A27, 0x6A27,
-    0x6A27, 0x6A27, 0x59C7, 0x3906, 0x3906, 0x4127, 0x3926, 0x3906,
-    0x3906, 0x3906, 0x3927, 0x3907, 0x3906, 0x3906, 0x5187, 0x5187,
-    0x3106, 0x28C6, 0x3927, 0x3907, 0x3907, 0x3907, 0x3907, 0x4127,
-    0x3907, 0x28A7, 0x18A6, 0x1886, 0x1066, 0x1066, 0x1087, 0x1887,
-    0x28E7, 0x1866, 0x0846, 0x1046, 0x1046, 0x1066, 0x1066, 0x1066,
-    0x10A7, 0x18C8, 0x10A8, 0x1046, 0x1046, 0x20A7, 0x1866, 0x30E6,
-    0x51C8, 0x30E6, 0x3907, 0x3927, 0x4127, 0x30E7, 0x20A6, 0x20A6,
-    0x1046, 0x1046, 0x1066, 0x1067, 0x1067, 0x1067, 0x1066, 0x1067,
-    0x1066, 0x1887, 0x30E7, 0x4127, 0x4127, 0x28E7, 0x1886, 0x1046,
-    0x1067, 0x1067, 0x1066, 0x1046, 0x0806, 0x20A6, 0x4987, 0x4986,
-    0x7A67, 0x82A7, 0x8287, 0x8287, 0x8287, 0x7A67, 0x82A8, 0x5986,
-    0x6A27, 0x6A06, 0x5186, 0x7A88, 0x5166, 0x7A67, 0x6A27, 0x3147,
-    0x1907, 0x59C7, 0x6A07, 0x59A6, 0x59C6, 0x59C7, 0x51A6, 0x61E7,
-    0x6226, 0x4205, 0x10C4, 0x0005, 0x0844, 0x5186, 0x5186, 0x59C7,
-    0x59A6, 0x59A6, 0x6207, 0x51C7, 0x3188, 0x49A7, 0x61E7, 0x61C7,
-    0x5186, 0x59E7, 0x51A7, 0x59C6, 0x6A26, 0x82A7, 0x6A26, 0x18A3,
-    0x0024, 0x0024, 0x0004, 0x1885, 0x3106, 0x1065, 0x3927, 0x1065,
-    0x0004, 0x10C5, 0x2124, 0x18C3, 0x51E6, 0x3964, 0x2944, 0x2104,
-    0x0864, 0x0884, 0x18E4, 0x0844, 0x1065, 0x20C6, 0x18A5, 0x0024,
-    0x1067, 0x0866, 0x0045, 0x0024, 0x0024, 0x0864, 0x3165, 0x41C5,
-    0x20E3, 0x3944, 0x6206, 0x20E5, 0x0866, 0x0025, 0x0024, 0x0024,
-    0x0044, 0x0024, 0x0024, 0x20C4, 0x3144, 0x6246, 0x6247, 0x0824,
-    0x7288, 0x18A4, 0x0887, 0x10A7, 0x0004, 0x0045, 0x10C8, 0x192A,
-    0x0886, 0x0004, 0x0866, 0x196B, 0x10E8, 0x194A, 0x10E8, 0x1929,
-    0x1929, 0x0024, 0x194A, 0x196B, 0x196B, 0x1929, 0x10E8, 0x218B,
-    0x10E9, 0x10C8, 0x10A8, 0x1046, 0x1046, 0x10A8, 0x10E9, 0x196B,
-    0x1909, 0x1087, 0x1046, 0x1046, 0x18E9, 0x196B, 0x198B, 0x1929,
-    0x1087, 0x1046, 0x1046, 0x1046, 0x1046, 0x1887, 0x3107, 0x30E7,
-    0x28C7, 0x1866, 0x1046, 0x1046, 0x1066, 0x18E8, 0x194A, 0x196B,
-    0x218B, 0x190A, 0x0867, 0x1046, 0x4167, 0x4967, 0x59E7, 0x7247,
-    0x6A27, 0x6A47, 0x7267, 0x59A6, 0x4126, 0x3906, 0x3906, 0x3907,
-    0x3906, 0x3907, 0x3907, 0x3907, 0x3907, 0x3906, 0x38E6, 0x38E6,
-    0x3907, 0x4107, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907,
-    0x30E6, 0x1886, 0x1887, 0x1886, 0x20A7, 0x20A7, 0x1887, 0x1887,
-    0x30E7, 0x28C7, 0x20A6, 0x2086, 0x1866, 0x1046, 0x1066, 0x1066,
-    0x1046, 0x1046, 0x1066, 0x1066, 0x1066, 0x1046, 0x1046, 0x1886,
-    0x20A6, 0x28C7, 0x28C7, 0x28C7, 0x28C7, 0x2086, 0x0846, 0x1046,
-    0x1066, 0x1066, 0x1066, 0x1067, 0x1066, 0x1066, 0x1067, 0x1067,
-    0x0846, 0x20A7, 0x4127, 0x3906, 0x30C7, 0x1866, 0x1047, 0x1067,
-    0x1067, 0x1067, 0x1046, 0x3107, 0x3906, 0x51A6, 0x82A8, 0x8287,
-    0x7A87, 0x7A67, 0x8287, 0x7247, 0x6A07, 0x82A8, 0x6A07, 0x59A7,
-    0x59C7, 0x59A6, 0x5186, 0x59C7, 0x5186, 0x59C7, 0x61E7, 0x3967,
-    0x2127, 0x51A7, 0x6A07, 0x5186, 0x61E7, 0x61E7, 0x59C6, 0x7267,
-    0x41C4, 0x2144, 0x18E4, 0x20E4, 0x20C5, 0x4146, 0x51A6, 0x6207,
-    0x59A6, 0x51A6, 0x6207, 0x4986, 0x2147, 0x4167, 0x61E7, 0x61E7,
-    0x5186, 0x6227, 0x59C6, 0x7267, 0x82A6, 0x7266, 0x51E5, 0x18E3,
-    0x0023, 0x0024, 0x0003, 0x18A5, 0x3126, 0x1885, 0x28E7, 0x0845,
-    0x0025, 0x0865, 0x18C5, 0x4165, 0x6A47, 0x3144, 0x39A4, 0x3144,
-    0x0003, 0x0044, 0x31A4, 0x1084, 0x0003, 0x18A5, 0x3947, 0x1885,
-    0x1067, 0x1066, 0x0045, 0x0024, 0x0024, 0x0024, 0x0003, 0x3164,
-    0x49E5, 0x41A5, 0x51A5, 0x6206, 0x20C5, 0x0845, 0x0044, 0x0044,
-    0x0024, 0x0044, 0x0024, 0x41A6, 0x18A3, 0x1883, 0x49E6, 0x28C4,
-    0x7287, 0x20A4, 0x0004, 0x0024, 0x0045, 0x0025, 0x0004, 0x2148,
-    0x10A6, 0x0004, 0x0886, 0x196B, 0x0004, 0x1929, 0x0886, 0x0865,
-    0x10E8, 0x0024, 0x10E8, 0x1109, 0x192A, 0x196B, 0x196A, 0x1909,
-    0x196B, 0x196B, 0x10E8, 0x0866, 0x10A8, 0x192A, 0x0887, 0x10E8,
-    0x194A, 0x192A, 0x1087, 0x1088, 0x1046, 0x18E9, 0x1909, 0x192A,
-    0x1929, 0x1067, 0x1066, 0x1066, 0x1066, 0x1046, 0x1046, 0x1046,
-    0x3107, 0x1886, 0x1046, 0x1046, 0x1046, 0x1046, 0x1909, 0x192A,
-    0x194A, 0x196B, 0x214B, 0x10A8, 0x1088, 0x0826, 0x3106, 0x59C7,
-    0x51A6, 0x51A7, 0x59C7, 0x7A68, 0x61C7, 0x4946, 0x4146, 0x3906,
-    0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3906,
-    0x3906, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3906,
-    0x30E6, 0x1066, 0x1086, 0x1866, 0x28E7, 0x28C7, 0x1046, 0x1066,
-    0x1046, 0x28E7, 0x4127, 0x4127, 0x3107, 0x1886, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1067, 0x1066, 0x1066,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1067, 0x1066, 0x1067, 0x1067, 0x1887,
-    0x1887, 0x20A6, 0x30E7, 0x28E7, 0x1046, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x28C6, 0x7248, 0x82A8, 0x7A87, 0x7A67, 0x7267,
-    0x6A07, 0x7A67, 0x7A67, 0x61C7, 0x5166, 0x7268, 0x5166, 0x7248,
-    0x59C7, 0x59A6, 0x6A28, 0x4145, 0x6A48, 0x4966, 0x6A07, 0x49E8,
-    0x2147, 0x6A68, 0x4945, 0x7268, 0x61C7, 0x59C6, 0x7AA8, 0x6206,
-    0x31C4, 0x0862, 0x20C4, 0x3164, 0x3145, 0x20A5, 0x7269, 0x5186,
-    0x61E7, 0x61E7, 0x4925, 0x6228, 0x1106, 0x5208, 0x59A6, 0x59A6,
-    0x6A48, 0x4966, 0x7267, 0x7AA6, 0x7266, 0x51E5, 0x2963, 0x2104,
-    0x0023, 0x0004, 0x0024, 0x0003, 0x1063, 0x4187, 0x20A6, 0x1085,
-    0x0865, 0x0004, 0x18A5, 0x7AA8, 0x5186, 0x4165, 0x51E5, 0x3965,
-    0x0843, 0x0044, 0x2124, 0x0864, 0x0004, 0x1064, 0x3106, 0x4147,
-    0x1087, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x3144,
-    0x41C5, 0x20E4, 0x1863, 0x6246, 0x5A27, 0x10A5, 0x0865, 0x0865,
-    0x0024, 0x0024, 0x0024, 0x0002, 0x0822, 0x0002, 0x18A3, 0x72A8,
-    0x72A8, 0x28C4, 0x0024, 0x0045, 0x0024, 0x0024, 0x0003, 0x6268,
-    0x3966, 0x0004, 0x0886, 0x194A, 0x0044, 0x1909, 0x08A7, 0x0003,
-    0x0024, 0x0024, 0x0024, 0x0845, 0x2128, 0x298A, 0x10E8, 0x0004,
-    0x1109, 0x196B, 0x0886, 0x0886, 0x1109, 0x0025, 0x192A, 0x0045,
-    0x10C7, 0x196B, 0x196B, 0x194A, 0x1087, 0x1066, 0x0846, 0x10A8,
-    0x194A, 0x192A, 0x1087, 0x1067, 0x1067, 0x1066, 0x1066, 0x1046,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x18E9, 0x194B, 0x194B, 0x196B, 0x196B, 0x1087, 0x0846, 0x0846,
-    0x0846, 0x1046, 0x1046, 0x59E8, 0x7A68, 0x7A67, 0x6A27, 0x4126,
-    0x3907, 0x3907, 0x3907, 0x3907, 0x3906, 0x3907, 0x3907, 0x3926,
-    0x3906, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907,
-    0x30E6, 0x1866, 0x1886, 0x1886, 0x1066, 0x1046, 0x1067, 0x1066,
-    0x1066, 0x1046, 0x28C7, 0x3927, 0x3927, 0x3927, 0x1866, 0x1066,
-    0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1067, 0x1067, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1067, 0x1067, 0x1066, 0x1066, 0x1067, 0x1087, 0x1887, 0x28C7,
-    0x4148, 0x30E7, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x28A6, 0x7A68, 0x8287, 0x7A67, 0x7247, 0x7A67, 0x7247,
-    0x4105, 0x6A48, 0x5186, 0x59A7, 0x7A88, 0x4925, 0x82C9, 0x5166,
-    0x6A28, 0x6207, 0x4125, 0x7289, 0x4125, 0x6A28, 0x51A6, 0x2906,
-    0x1128, 0x1927, 0x7AA9, 0x5145, 0x6A27, 0x6A28, 0x5166, 0x7AC8,
-    0x2103, 0x2944, 0x18C3, 0x0002, 0x1064, 0x5A08, 0x30C5, 0x7269,
-    0x51A6, 0x5166, 0x6A48, 0x30E5, 0x1948, 0x28E6, 0x6207, 0x6228,
-    0x4946, 0x7AC9, 0x4125, 0x7268, 0x4145, 0x20E3, 0x2964, 0x0003,
-    0x0024, 0x0024, 0x0004, 0x1084, 0x3165, 0x3145, 0x28C6, 0x3147,
-    0x18A5, 0x0024, 0x1065, 0x3927, 0x4126, 0x7287, 0x5206, 0x3984,
-    0x3164, 0x0024, 0x0024, 0x0024, 0x0024, 0x0003, 0x0844, 0x3926,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0023,
-    0x0023, 0x20C4, 0x5A07, 0x6227, 0x1064, 0x0024, 0x0044, 0x0024,
-    0x0024, 0x0024, 0x0002, 0x41A6, 0x6A67, 0x3945, 0x0002, 0x0843,
-    0x0823, 0x6268, 0x3966, 0x0004, 0x0024, 0x0024, 0x0003, 0x5A06,
-    0x3145, 0x0004, 0x0045, 0x0045, 0x0044, 0x0044, 0x0024, 0x0024,
-    0x0024, 0x0044, 0x0044, 0x1908, 0x6289, 0x5A69, 0x10E7, 0x0024,
-    0x0024, 0x192A, 0x08C7, 0x0025, 0x0045, 0x0045, 0x194A, 0x0045,
-    0x10C7, 0x196B, 0x1109, 0x0045, 0x1929, 0x192A, 0x192A, 0x194A,
-    0x194A, 0x194B, 0x194A, 0x194B, 0x10C8, 0x1046, 0x1046, 0x1046,
-    0x1066, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x1067, 0x1067, 0x10A8, 0x194B, 0x194A, 0x192A, 0x194A, 0x10C8,
-    0x0846, 0x1067, 0x1067, 0x1066, 0x51A7, 0x7A88, 0x7247, 0x6207,
-    0x3906, 0x38E6, 0x3906, 0x3907, 0x3907, 0x3907, 0x3907, 0x3926,
-    0x3906, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907, 0x3907,
-    0x3906, 0x3907, 0x3907, 0x1866, 0x1046, 0x1066, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1066, 0x2086, 0x4127, 0x3907, 0x3907,
-    0x2086, 0x1046, 0x1066, 0x1067, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1067, 0x1067, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066, 0x1066,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x1066, 0x28C7, 0x4988, 0x4167,
-    0x3927, 0x20A7, 0x1046, 0x1067, 0x1066, 0x1046, 0x1046, 0x0826,
-    0x28C6, 0x7A88, 0x7A67, 0x82A8, 0x59A6, 0x59A6, 0x7268, 0x4105,
-    0x7268, 0x4125, 0x59E7, 0x5A08, 0x4167, 0x7A89, 0x4925, 0x7268,
-    0x61C7, 0x59A7, 0x6A69, 0x2926, 0x7268, 0x4925, 0x61C7, 0x5A28,
-    0x0908, 0x1948, 0x3926, 0x7268, 0x5186, 0x59A6, 0x7288, 0x3925,
-    0x6246, 0x3984, 0x3184, 0x2925, 0x0844, 0x3926, 0x7268, 0x5166,
-    0x61E7, 0x6207, 0x4105, 0x4146, 0x1148, 0x3147, 0x4146, 0x4147,
-    0x4147, 0x4966, 0x7AA8, 0x5187, 0x4987, 0x49C6, 0x2944, 0x0003,
-    0x0004, 0x0024, 0x0024, 0x0024, 0x0023, 0x0823, 0x3106, 0x1064,
-    0x0024, 0x0024, 0x0044, 0x0845, 0x3946, 0x41A5, 0x39A4, 0x39A5,
-    0x3164, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x1086, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0003, 0x2925,
-    0x0844, 0x20C5, 0x5A07, 0x20A4, 0x51C7, 0x1064, 0x0004, 0x0044,
-    0x0024, 0x0043, 0x3145, 0x1062, 0x41A5, 0x72A7, 0x5A26, 0x6247,
-    0x6227, 0x28E4, 0x0844, 0x0024, 0x0024, 0x0024, 0x0003, 0x5A27,
-    0x2905, 0x0004, 0x0045, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0045, 0x0045, 0x5A07, 0x5206, 0x0044, 0x0024,
-    0x0025, 0x194B, 0x10C8, 0x0024, 0x0024, 0x0044, 0x10E8, 0x0044,
-    0x10C7, 0x216B, 0x1108, 0x0023, 0x0045, 0x1929, 0x216B, 0x196B,
-    0x194B, 0x194B, 0x194B, 0x194B, 0x194A, 0x1929, 0x10C8, 0x0825,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1066, 0x1066, 0x1047,
-    0x1046, 0x1046, 0x1067, 0x1087, 0x1066, 0x192A, 0x198B, 0x196B,
-    0x1909, 0x1066, 0x1067, 0x1067, 0x1886, 0x4167, 0x7A88, 0x7247,
-    0x6207, 0x6207, 0x4126, 0x30C7, 0x3907, 0x3906, 0x3907, 0x3907,
-    0x3906, 0x3906, 0x3907, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x3907, 0x3107, 0x1886, 0x1046, 0x1066, 0x1066,
-    0x1066, 0x1067, 0x1066, 0x1066, 0x1066, 0x1886, 0x1866, 0x3927,
-    0x20A7, 0x1046, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1066, 0x1067, 0x1066, 0x1066, 0x1046, 0x0846, 0x0846, 0x1046,
-    0x30E7, 0x3107, 0x3107, 0x3107, 0x3107, 0x3908, 0x3947, 0x49C6,
-    0x2906, 0x1067, 0x1066, 0x0846, 0x0825, 0x4987, 0x59E7, 0x59E7,
-    0x59C7, 0x5966, 0x82A8, 0x3987, 0x5A08, 0x6A07, 0x5166, 0x7268,
-    0x4145, 0x6207, 0x51A6, 0x2926, 0x1148, 0x3988, 0x6A48, 0x59C7,
-    0x6208, 0x6A28, 0x3967, 0x1128, 0x4146, 0x6A27, 0x59C7, 0x3126,
-    0x1128, 0x2148, 0x6A68, 0x5186, 0x61E7, 0x5A07, 0x4186, 0x6A26,
-    0x7AA7, 0x2904, 0x0843, 0x0843, 0x0024, 0x1084, 0x6228, 0x5187,
-    0x5187, 0x4966, 0x3906, 0x3926, 0x1148, 0x3147, 0x4126, 0x4126,
-    0x4126, 0x4126, 0x4987, 0x3906, 0x38E6, 0x3145, 0x3184, 0x3985,
-    0x3985, 0x0864, 0x0004, 0x18A4, 0x3125, 0x28E5, 0x3926, 0x0864,
-    0x0024, 0x0024, 0x1084, 0x3986, 0x3184, 0x39C4, 0x2104, 0x0843,
-    0x0843, 0x0023, 0x2924, 0x0843, 0x0004, 0x0024, 0x0024, 0x0024,
-    0x0845, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x2925, 0x49E5,
-    0x4185, 0x20E4, 0x1084, 0x0843, 0x7267, 0x51C6, 0x1884, 0x0024,
-    0x0024, 0x0024, 0x18A3, 0x3965, 0x2904, 0x28E4, 0x3145, 0x3945,
-    0x82E7, 0x6206, 0x20C4, 0x0004, 0x0044, 0x0024, 0x0004, 0x51E6,
-    0x6247, 0x2905, 0x0003, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0844, 0x0003, 0x49A5, 0x41A5, 0x0002, 0x0024,
-    0x0025, 0x0887, 0x0066, 0x0024, 0x0024, 0x0024, 0x0045, 0x0024,
-    0x10E8, 0x1909, 0x0865, 0x0024, 0x0023, 0x0886, 0x08A7, 0x10E9,
-    0x196B, 0x196B, 0x194A, 0x196B, 0x10C8, 0x10C8, 0x194A, 0x10C8,
-    0x0845, 0x10C8, 0x18E9, 0x18E9, 0x18C8, 0x1046, 0x1067, 0x1066,
-    0x1067, 0x1067, 0x1046, 0x1046, 0x1046, 0x10A7, 0x10C8, 0x18C9,
-    0x18A8, 0x1066, 0x1067, 0x1067, 0x1046, 0x1886, 0x3927, 0x3906,
-    0x3926, 0x6A27, 0x6207, 0x51A7, 0x51A7, 0x51A7, 0x3907, 0x30E8,
-    0x3908, 0x4127, 0x3907, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3907, 0x3907, 0x3907, 0x4127, 0x3907, 0x20A7, 0x1046, 0x1066,
-    0x1066, 0x1066, 0x1066, 0x1067, 0x1066, 0x1046, 0x1046, 0x20A7,
-    0x1887, 0x1047, 0x1046, 0x1046, 0x1046, 0x1047, 0x1067, 0x1066,
-    0x1067, 0x1066, 0x1067, 0x1046, 0x20A7, 0x30E7, 0x28C7, 0x28C7,
-    0x4127, 0x4147, 0x30E7, 0x20A7, 0x20A7, 0x20A7, 0x18A7, 0x41E6,
-    0x2106, 0x0827, 0x18A7, 0x49A7, 0x51A7, 0x4986, 0x3966, 0x4166,
-    0x59A6, 0x61E7, 0x51A7, 0x1928, 0x3188, 0x6A07, 0x6207, 0x59C6,
-    0x59C7, 0x4986, 0x59C7, 0x39A7, 0x0928, 0x1928, 0x7288, 0x4987,
-    0x4987, 0x6A07, 0x59E7, 0x1107, 0x30E6, 0x5186, 0x6A07, 0x41A8,
-    0x1128, 0x1948, 0x41C8, 0x4166, 0x59A6, 0x4186, 0x3146, 0x8AE7,
-    0x8AE7, 0x1084, 0x20C5, 0x3145, 0x0003, 0x0024, 0x18A5, 0x1885,
-    0x30E5, 0x4126, 0x4126, 0x3927, 0x1948, 0x1948, 0x3147, 0x4126,
-    0x3926, 0x3926, 0x30C5, 0x59E7, 0x5A07, 0x41A4, 0x2944, 0x18C4,
-    0x18C4, 0x0844, 0x0004, 0x0844, 0x20C4, 0x4146, 0x4147, 0x1064,
-    0x0024, 0x0024, 0x0844, 0x20C4, 0x41C5, 0x2904, 0x0023, 0x0843,
-    0x18C4, 0x0003, 0x39A5, 0x3164, 0x0864, 0x0004, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x3145, 0x2924,
-    0x49C5, 0x4185, 0x1064, 0x0824, 0x3925, 0x49A6, 0x18A4, 0x0004,
-    0x0024, 0x0024, 0x0003, 0x3145, 0x3965, 0x1064, 0x0003, 0x0003,
-    0x4165, 0x51C6, 0x20E5, 0x0004, 0x0044, 0x0024, 0x0024, 0x49C6,
-    0x5A06, 0x4986, 0x28E4, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044,
-    0x0044, 0x0044, 0x0024, 0x20E4, 0x5A26, 0x5A26, 0x20C4, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0003,
-    0x10E8, 0x10E8, 0x0003, 0x0024, 0x0024, 0x0024, 0x0004, 0x08A7,
-    0x196B, 0x10E8, 0x194A, 0x10E8, 0x0024, 0x0866, 0x196B, 0x194A,
-    0x0025, 0x192A, 0x196B, 0x196B, 0x194B, 0x10C8, 0x1067, 0x1046,
-    0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x1067, 0x1066, 0x1066, 0x1066, 0x1046, 0x0826, 0x0846,
-    0x0826, 0x3927, 0x4967, 0x59C7, 0x7267, 0x6A47, 0x51A7, 0x3909,
-    0x28E8, 0x30E7, 0x3907, 0x30E7, 0x3907, 0x30E7, 0x3907, 0x3907,
-    0x4127, 0x4107, 0x4107, 0x3927, 0x3907, 0x20A7, 0x1046, 0x1066,
-    0x1067, 0x1066, 0x1066, 0x1067, 0x1066, 0x1066, 0x1047, 0x1046,
-    0x1046, 0x1887, 0x28C7, 0x28C6, 0x28C7, 0x1866, 0x1066, 0x1066,
-    0x1067, 0x1067, 0x1067, 0x1046, 0x20A7, 0x30E7, 0x3106, 0x4187,
-    0x28E7, 0x28C7, 0x1886, 0x1086, 0x18C6, 0x0867, 0x0867, 0x41C6,
-    0x3966, 0x20A7, 0x3927, 0x82A8, 0x61E7, 0x5186, 0x2106, 0x2126,
-    0x59A6, 0x6207, 0x5186, 0x1948, 0x3187, 0x69E7, 0x6A28, 0x5186,
-    0x6A07, 0x5186, 0x61E7, 0x41C7, 0x0928, 0x1948, 0x4987, 0x4987,
-    0x2947, 0x3987, 0x5208, 0x1107, 0x3126, 0x4966, 0x6A08, 0x41E8,
-    0x1148, 0x1149, 0x1108, 0x49A7, 0x4946, 0x28E6, 0x3146, 0x5A26,
-    0x82C6, 0x49C5, 0x41A5, 0x3145, 0x0004, 0x0024, 0x0004, 0x0844,
-    0x28E5, 0x4147, 0x4126, 0x3947, 0x1949, 0x1169, 0x2947, 0x4126,
-    0x3926, 0x3906, 0x5186, 0x6226, 0x5A45, 0x49E4, 0x2944, 0x0004,
-    0x0004, 0x0024, 0x0044, 0x0004, 0x0024, 0x20C5, 0x20C5, 0x0844,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x51E6, 0x1063, 0x0843, 0x2104,
-    0x3164, 0x18C3, 0x2104, 0x2924, 0x2104, 0x1084, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0004, 0x0003,
-    0x20E4, 0x51E6, 0x49E6, 0x10A4, 0x1063, 0x0003, 0x0004, 0x0024,
-    0x0024, 0x0024, 0x0044, 0x0843, 0x59E6, 0x6226, 0x1084, 0x0024,
-    0x0003, 0x1043, 0x0844, 0x0024, 0x0024, 0x0044, 0x0024, 0x51E6,
-    0x3945, 0x3104, 0x41A6, 0x0003, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0044, 0x0024, 0x3986, 0x5A05, 0x72A6, 0x6A87, 0x0024,
-    0x0045, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0003,
-    0x10C7, 0x10C7, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x08A7,
-    0x10E9, 0x0024, 0x194A, 0x0045, 0x0003, 0x0865, 0x1109, 0x192A,
-    0x0045, 0x10C8, 0x194A, 0x194B, 0x196B, 0x196B, 0x10A8, 0x1087,
-    0x1087, 0x1087, 0x1087, 0x1046, 0x1046, 0x1046, 0x1066, 0x1067,
-    0x1067, 0x1066, 0x1046, 0x1066, 0x1066, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x1046, 0x0826, 0x28C6, 0x59E7, 0x59C7, 0x59E8, 0x3928,
-    0x1887, 0x20A8, 0x3109, 0x20C8, 0x3908, 0x28C8, 0x28C8, 0x30E8,
-    0x30E7, 0x30E7, 0x30E7, 0x30E7, 0x1886, 0x1046, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066,
-    0x1046, 0x20A7, 0x3927, 0x3907, 0x3907, 0x1886, 0x1046, 0x1067,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1066, 0x0826, 0x18A5, 0x49E6,
-    0x1066, 0x0867, 0x0846, 0x2106, 0x39C6, 0x0867, 0x10A7, 0x41C6,
-    0x41A7, 0x4187, 0x6207, 0x6A47, 0x4946, 0x6A27, 0x3187, 0x3187,
-    0x6207, 0x4925, 0x6A28, 0x1948, 0x4209, 0x6A07, 0x5986, 0x7A88,
-    0x5165, 0x6248, 0x4986, 0x2106, 0x1149, 0x1148, 0x3987, 0x49A6,
-    0x2147, 0x1927, 0x2947, 0x1128, 0x3106, 0x6A48, 0x49C7, 0x1927,
-    0x1969, 0x1169, 0x1148, 0x3987, 0x3946, 0x3946, 0x3985, 0x41A5,
-    0x7AA6, 0x7AC6, 0x3145, 0x0003, 0x0024, 0x0864, 0x0844, 0x3106,
-    0x4126, 0x4126, 0x4126, 0x3927, 0x1949, 0x1169, 0x3147, 0x4126,
-    0x4146, 0x4965, 0x7286, 0x49A4, 0x2903, 0x3164, 0x3164, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0004, 0x0004, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x3165, 0x18A3, 0x2104, 0x3984,
-    0x3164, 0x2965, 0x0024, 0x0003, 0x18E4, 0x2105, 0x0024, 0x0044,
-    0x0024, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0844, 0x0044,
-    0x0004, 0x20E4, 0x49E6, 0x41C5, 0x49C5, 0x1083, 0x0023, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x41A6, 0x7266, 0x82C6, 0x6226, 0x0023,
-    0x0003, 0x5A28, 0x3945, 0x0003, 0x0044, 0x0024, 0x0024, 0x41A6,
-    0x72A8, 0x49A5, 0x0002, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0003, 0x20E4, 0x6246, 0x5A47, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0025,
-    0x0024, 0x0044, 0x1909, 0x0865, 0x0024, 0x0003, 0x0066, 0x194B,
-    0x0045, 0x0004, 0x10E9, 0x216B, 0x194B, 0x194B, 0x194B, 0x194A,
-    0x194A, 0x194A, 0x1909, 0x1066, 0x1067, 0x1066, 0x1066, 0x1067,
-    0x1066, 0x1046, 0x1046, 0x1066, 0x1046, 0x1066, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1066, 0x1046, 0x1066, 0x1046, 0x1066,
-    0x1066, 0x1867, 0x20C9, 0x28C8, 0x3908, 0x2087, 0x1046, 0x1046,
-    0x1066, 0x1046, 0x1046, 0x1046, 0x1046, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1066, 0x1046, 0x1046, 0x1046, 0x1046, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x1067, 0x1067, 0x1066, 0x20C5, 0x41C5,
-    0x1086, 0x1067, 0x0866, 0x2106, 0x39A6, 0x1086, 0x4187, 0x51C7,
-    0x2147, 0x39A7, 0x7248, 0x4925, 0x7AA9, 0x51A6, 0x2147, 0x1127,
-    0x3986, 0x7288, 0x3925, 0x1928, 0x0908, 0x41C8, 0x7288, 0x4925,
-    0x82A8, 0x3186, 0x2146, 0x2967, 0x1149, 0x1948, 0x6A88, 0x3167,
-    0x1128, 0x3167, 0x4166, 0x1148, 0x3947, 0x4126, 0x3127, 0x1948,
-    0x1169, 0x1169, 0x1148, 0x1148, 0x1927, 0x51E6, 0x7AC7, 0x7AA7,
-    0x82E7, 0x20A3, 0x2904, 0x2925, 0x0844, 0x3947, 0x3926, 0x3926,
-    0x3926, 0x3926, 0x4126, 0x3927, 0x1949, 0x1149, 0x3167, 0x4126,
-    0x49A6, 0x6A86, 0x49C4, 0x41A4, 0x18A3, 0x18A2, 0x2103, 0x0023,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0844, 0x0844, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0023, 0x2124, 0x3164, 0x3164,
-    0x2924, 0x18C4, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0023, 0x3985, 0x1084,
-    0x0003, 0x0823, 0x0843, 0x1063, 0x3984, 0x3984, 0x3985, 0x2104,
-    0x0004, 0x0044, 0x0044, 0x0003, 0x49A5, 0x8B07, 0x5A26, 0x0003,
-    0x0003, 0x0001, 0x49C6, 0x49C7, 0x0004, 0x0844, 0x0044, 0x0865,
-    0x20E4, 0x49C5, 0x5A27, 0x0023, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0003, 0x1904, 0x41E6, 0x3125, 0x0003, 0x0044,
-    0x0024, 0x0024, 0x0024, 0x0044, 0x0044, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024, 0x0886, 0x196B,
-    0x0045, 0x0004, 0x10E9, 0x1109, 0x0045, 0x194A, 0x194B, 0x194A,
-    0x194B, 0x10C7, 0x0845, 0x194A, 0x194B, 0x1087, 0x1046, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1867,
-    0x1067, 0x1867, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1066, 0x1066, 0x1067, 0x1067, 0x1867, 0x1066, 0x1047, 0x1066,
-    0x1066, 0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066,
-    0x1066, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1066, 0x1067, 0x1046, 0x20E6, 0x41E5, 0x39A5,
-    0x1085, 0x1087, 0x0866, 0x20E5, 0x31C6, 0x2127, 0x6A68, 0x3167,
-    0x1128, 0x2127, 0x5166, 0x7A89, 0x4946, 0x4986, 0x2167, 0x0928,
-    0x1107, 0x18E6, 0x3126, 0x1928, 0x0929, 0x1148, 0x2147, 0x4126,
-    0x7AA8, 0x39A6, 0x1927, 0x1948, 0x1149, 0x1148, 0x1948, 0x1148,
-    0x1149, 0x2947, 0x3946, 0x1928, 0x3947, 0x4126, 0x2127, 0x1148,
-    0x1169, 0x1149, 0x1169, 0x1169, 0x2968, 0x3946, 0x3146, 0x3965,
-    0x41C4, 0x3164, 0x3984, 0x20E3, 0x0003, 0x0844, 0x3106, 0x3947,
-    0x4127, 0x3926, 0x4126, 0x3927, 0x1949, 0x1149, 0x3167, 0x4946,
-    0x4146, 0x4966, 0x28E5, 0x1084, 0x4186, 0x49A5, 0x2923, 0x2944,
-    0x0824, 0x0004, 0x0024, 0x0024, 0x1065, 0x3947, 0x3927, 0x0844,
-    0x0024, 0x0024, 0x0863, 0x3985, 0x3985, 0x3984, 0x41C5, 0x2904,
-    0x1083, 0x39A5, 0x0023, 0x0024, 0x0024, 0x0044, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0864, 0x2124, 0x18A4, 0x18C4,
-    0x2104, 0x2924, 0x3165, 0x2924, 0x0843, 0x0843, 0x1084, 0x0864,
-    0x0024, 0x0024, 0x0024, 0x3986, 0x3124, 0x1883, 0x1084, 0x0843,
-    0x51E6, 0x6226, 0x3125, 0x0844, 0x0024, 0x0024, 0x0024, 0x18E4,
-    0x49C5, 0x49A5, 0x1063, 0x0024, 0x0024, 0x0044, 0x0045, 0x0024,
-    0x0004, 0x0844, 0x2104, 0x10A3, 0x3165, 0x5A26, 0x49C6, 0x0003,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0045, 0x0866,
-    0x0045, 0x0004, 0x10E9, 0x10E9, 0x0024, 0x196B, 0x194A, 0x192A,
-    0x196B, 0x10C7, 0x0045, 0x218C, 0x196B, 0x192A, 0x190A, 0x10A8,
-    0x0826, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046, 0x1046,
-    0x1046, 0x1046, 0x1046, 0x1066, 0x1867, 0x1067, 0x1066, 0x1066,
-    0x1066, 0x1066, 0x1067, 0x1067, 0x1067, 0x1066, 0x1066, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067, 0x1067,
-    0x1067, 0x1067, 0x1067, 0x1067, 0x1046, 0x2106, 0x4A05, 0x41C5,
-    0x31A6, 0x0845, 0x3127, 0x41C7, 0x1906, 0x1948, 0x2967, 0x41C7,
-    0x2167, 0x39A8, 0x7247, 0x5166, 0x7268, 0x4187, 0x1948, 0x0929,
-    0x2168, 0x5207, 0x3125, 0x1948, 0x0949, 0x1128, 0x2988, 0x7288,
-    0x7246, 0x3985, 0x39C6, 0x31C8, 0x1149, 0x1149, 0x1148, 0x1149,
-    0x1149, 0x1949, 0x2148, 0x3147, 0x3926, 0x4126, 0x3927, 0x2147,
-    0x1149, 0x1149, 0x1169, 0x1969, 0x2148, 0x3147, 0x3126, 0x2924,
-    0x0842, 0x0843, 0x2924, 0x49E5, 0x3145, 0x0024, 0x0865, 0x0845,
-    0x28E6, 0x4146, 0x4126, 0x3926, 0x1948, 0x1149, 0x1948, 0x3147,
-    0x4946, 0x4946, 0x6A47, 0x4186, 0x5A07, 0x49E5, 0x2943, 0x3164,
-    0x0023, 0x51E6, 0x2925, 0x0004, 0x0044, 0x1064, 0x4147, 0x1885,
-    0x0003, 0x1063, 0x3164, 0x41A5, 0x41A4, 0x41C5, 0x20E3, 0x18A4,
-    0x3185, 0x41E5, 0x3164, 0x0864, 0x0024, 0x0044, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0864, 0x18C4, 0x0023, 0x3165,
-    0x2104, 0x2104, 0x41A4, 0x3164, 0x2104, 0x2104, 0x1064, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x20E5, 0x3985, 0x3165, 0x10A4, 0x0023,
-    0x28E4, 0x2904, 0x4186, 0x4186, 0x20C5, 0x0004, 0x0024, 0x0843,
-    0x5A26, 0x6227, 0x1865, 0x28E6, 0x28C6, 0x0024, 0x0004, 0x1064,
-    0x18A5, 0x0003, 0x1084, 0x2125, 0x39A5, 0x5A05, 0x6226, 0x3945,
-    0x0003, 0x1885, 0x28C5, 0x20A5, 0x28C6, 0x20A6, 0x0024, 0x0004,
-    0x1885, 0x1885, 0x0004, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0004, 0x0025, 0x0025, 0x0024, 0x0004,
-    0x0004, 0x0024, 0x0886, 0x0865, 0x0024, 0x08A7, 0x194A, 0x196B,
-    0x10E8, 0x0065, 0x0845, 0x10C8, 0x192A, 0x112B, 0x3169, 0x4988,
-    0x4987, 0x4987, 0x4987, 0x49A7, 0x51A7, 0x49A7, 0x5187, 0x5187,
-    0x51A7, 0x51A7, 0x51C7, 0x3107, 0x0826, 0x1047, 0x0846, 0x0846,
-    0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x0846, 0x0846,
-    0x0846, 0x0846, 0x0826, 0x0846, 0x0846, 0x0847, 0x0846, 0x0846,
-    0x0846, 0x0847, 0x0846, 0x0826, 0x0846, 0x0846, 0x0846, 0x0847,
-    0x0847, 0x0846, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847, 0x0847,
-    0x0846, 0x0846, 0x0846, 0x0826, 0x20C6, 0x3986, 0x49E5, 0x4A26,
-    0x2966, 0x41A7, 0x6227, 0x6A67, 0x39A7, 0x1927, 0x3186, 0x49E6,
-    0x2967, 0x2188, 0x51E8, 0x61E7, 0x59C7, 0x3146, 0x1928, 0x1149,
-    0x1968, 0x41C7, 0x3946, 0x1948, 0x0949, 0x0949, 0x2988, 0x7267,
-    0x7A87, 0x3984, 0x3985, 0x31A7, 0x1148, 0x1149, 0x1148, 0x1149,
-    0x1149, 0x1149, 0x1948, 0x3946, 0x4146, 0x3947, 0x4146, 0x3147,
-    0x1149, 0x1149, 0x1169, 0x1949, 0x2148, 0x3127, 0x4145, 0x5A25,
-    0x49C5, 0x0823, 0x0843, 0x20E4, 0x18C4, 0x0024, 0x0004, 0x0004,
-    0x20C6, 0x4946, 0x3926, 0x2128, 0x1149, 0x1149, 0x0949, 0x2148,
-    0x3927, 0x3926, 0x7247, 0x5A07, 0x3125, 0x20E3, 0x2943, 0x1083,
-    0x0002, 0x6A66, 0x3965, 0x0004, 0x0024, 0x0024, 0x18A5, 0x0844,
-    0x18A4, 0x3984, 0x41C5, 0x41A5, 0x41A5, 0x20E4, 0x0023, 0x18A4,
-    0x41C5, 0x18C3, 0x39C5, 0x10A4, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x18C4,
-    0x2104, 0x18C3, 0x18E3, 0x3164, 0x20E4, 0x2924, 0x1084, 0x0024,
-    0x0044, 0x0024, 0x0004, 0x0003, 0x2905, 0x3986, 0x10A4, 0x0824,
-    0x28E5, 0x28E4, 0x51E7, 0x6228, 0x3926, 0x1064, 0x0023, 0x1063,
-    0x3124, 0x51C6, 0x51C7, 0x3927, 0x4147, 0x20A6, 0x1065, 0x28C6,
-    0x3907, 0x1885, 0x0004, 0x20E5, 0x3165, 0x41A5, 0x59E5, 0x5A06,
-    0x3904, 0x3906, 0x4127, 0x4127, 0x4127, 0x4127, 0x1885, 0x1865,
-    0x3106, 0x3106, 0x1885, 0x1885, 0x1885, 0x1885, 0x1885, 0x1885,
-    0x1885, 0x1885, 0x1885, 0x18A5, 0x0845, 0x0845, 0x18A6, 0x18A5,
-    0x1885, 0x0044, 0x0004, 0x0024, 0x0024, 0x0004, 0x08A7, 0x08A7,
-    0x1086, 0x0845, 0x0025, 0x0845, 0x3989, 0x39A9, 0x51C7, 0x6A06,
-    0x7246, 0x7246, 0x7A46, 0x7A46, 0x7A66, 0x7A66, 0x7A46, 0x7A46,
-    0x7A66, 0x7A46, 0x8266, 0x59C6, 0x30E6, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x3906, 0x3926, 0x3926, 0x3926, 0x3926, 0x3906,
-    0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3926, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x3906, 0x3906, 0x3906, 0x3926, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x3926, 0x3906, 0x3906, 0x3926, 0x3926, 0x3906,
-    0x3906, 0x3926, 0x3906, 0x3106, 0x49A6, 0x5A46, 0x4A06, 0x31A7,
-    0x1107, 0x39C8, 0x6267, 0x7AA6, 0x6247, 0x1906, 0x5226, 0x49E5,
-    0x2987, 0x1128, 0x2967, 0x7A87, 0x5186, 0x2126, 0x1128, 0x1148,
-    0x1149, 0x1128, 0x2147, 0x1128, 0x1129, 0x1148, 0x1948, 0x4186,
-    0x7287, 0x41A4, 0x18E4, 0x20E5, 0x3187, 0x1149, 0x1149, 0x1149,
-    0x1149, 0x1169, 0x1948, 0x3147, 0x2947, 0x2147, 0x2947, 0x2148,
-    0x1149, 0x1949, 0x2148, 0x2148, 0x2127, 0x3947, 0x6A46, 0x8B47,
-    0x6265, 0x20E4, 0x0023, 0x0004, 0x0004, 0x0024, 0x18A5, 0x1885,
-    0x20E7, 0x3147, 0x2948, 0x1149, 0x1149, 0x2148, 0x1948, 0x2128,
-    0x4167, 0x51C7, 0x59C6, 0x3106, 0x18A5, 0x2104, 0x2924, 0x0002,
-    0x2904, 0x6A86, 0x3145, 0x0004, 0x0044, 0x0024, 0x0024, 0x0004,
-    0x18C4, 0x2924, 0x2924, 0x39A4, 0x2904, 0x0003, 0x0843, 0x3164,
-    0x3985, 0x0003, 0x18E4, 0x0864, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0864, 0x0003,
-    0x2104, 0x2104, 0x1083, 0x3985, 0x0863, 0x0004, 0x0024, 0x0044,
-    0x0024, 0x0044, 0x20C4, 0x0844, 0x0003, 0x0003, 0x0004, 0x0844,
-    0x5A07, 0x6A87, 0x4986, 0x30E6, 0x3926, 0x3106, 0x0003, 0x3165,
-    0x10A3, 0x3964, 0x82E7, 0x4146, 0x4107, 0x4107, 0x4107, 0x3906,
-    0x3906, 0x30E7, 0x0824, 0x0004, 0x18C4, 0x41C5, 0x51C6, 0x4965,
-    0x6A47, 0x4946, 0x38E6, 0x3906, 0x3906, 0x3906, 0x4127, 0x4127,
-    0x4127, 0x4126, 0x4127, 0x4127, 0x4107, 0x4107, 0x4106, 0x4107,
-    0x4107, 0x4107, 0x4106, 0x4127, 0x2085, 0x2085, 0x4947, 0x4127,
-    0x4127, 0x1865, 0x1044, 0x1064, 0x1044, 0x1044, 0x0823, 0x0803,
-    0x20A5, 0x28C6, 0x1045, 0x1885, 0x6A47, 0x7247, 0x6ACA, 0x6AEB,
-    0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA, 0x6AEA,
-    0x6AEA, 0x6AEA, 0x6AEA, 0x730A, 0x732B, 0x732B, 0x732B, 0x732B,
-    0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B,
-    0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B,
-    0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B,
-    0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x732B, 0x7B2B,
-    0x7AEA, 0x7A67, 0x7A67, 0x7A67, 0x7A67, 0x7287, 0x5A47, 0x2147,
-    0x1928, 0x1927, 0x5A07, 0x7287, 0x41C7, 0x1127, 0x39C6, 0x39C6,
-    0x2168, 0x0928, 0x2967, 0x6A46, 0x6A86, 0x39A6, 0x2967, 0x2168,
-    0x1948, 0x29A8, 0x2988, 0x2987, 0x1968, 0x1948, 0x3146, 0x3166,
-    0x7287, 0x3984, 0x10A3, 0x1085, 0x3147, 0x2148, 0x2148, 0x2148,
-    0x1948, 0x1948, 0x2148, 0x3147, 0x1947, 0x1948, 0x1948, 0x1948,
-    0x1948, 0x2148, 0x3947, 0x3127, 0x3146, 0x5A06, 0x8307, 0x5206,
-    0x2923, 0x3164, 0x18C4, 0x0844, 0x0024, 0x0024, 0x2906, 0x4147,
-    0x2948, 0x1148, 0x1149, 0x1149, 0x1148, 0x2947, 0x2927, 0x2927,
-    0x59A7, 0x72A8, 0x5A07, 0x1884, 0x2925, 0x41A5, 0x20E4, 0x1882,
-    0x72A6, 0x8B06, 0x3124, 0x0004, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0004, 0x0844, 0x2965, 0x0003, 0x0843, 0x3144, 0x41E5,
-    0x2925, 0x0024, 0x0004, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0844, 0x3165, 0x1084,
-    0x0003, 0x10A4, 0x39A5, 0x39A4, 0x39A5, 0x1084, 0x0024, 0x0044,
-    0x0024, 0x0864, 0x6288, 0x18C4, 0x0023, 0x0844, 0x0024, 0x0024,
-    0x0003, 0x3164, 0x49A6, 0x3927, 0x3106, 0x28E5, 0x0023, 0x2924,
-    0x3984, 0x5A25, 0x8AE6, 0x7AA7, 0x4167, 0x3947, 0x3947, 0x4168,
-    0x3147, 0x0865, 0x0865, 0x0024, 0x2105, 0x20E3, 0x1882, 0x7267,
-    0x4965, 0x4167, 0x4188, 0x3968, 0x3968, 0x3967, 0x3968, 0x3968,
-    0x4168, 0x4168, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968, 0x3968,
-    0x3968, 0x3968, 0x3968, 0x4168, 0x4188, 0x4168, 0x3968, 0x3968,
-    0x3968, 0x4188, 0x41A8, 0x41A8, 0x41A8, 0x4188, 0x3968, 0x3968,
-    0x3968, 0x3988, 0x3988, 0x41A8, 0x6289, 0x6268, 0x6BF1, 0x6D17,
-    0x6CF6, 0x64F6, 0x64F6, 0x64F6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D5, 0x64B5, 0x64D5, 0x64B5, 0x64D5,
-    0x64D5, 0x64D6, 0x64D5, 0x64D5, 0x64B5, 0x64D5, 0x64D5, 0x64D6,
-    0x64D5, 0x64D5, 0x64D6, 0x64D6, 0x64D6, 0x5CD6, 0x5CD6, 0x64D6,
-    0x64D5, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64B6, 0x5CB6, 0x5CB6,
-    0x64B6, 0x64B6, 0x5CB6, 0x64B5, 0x6CB4, 0x6CB4, 0x6C94, 0x6CB4,
-    0x73F0, 0x7246, 0x7246, 0x7246, 0x7247, 0x7A67, 0x7A67, 0x7288,
-    0x2947, 0x6268, 0x82A7, 0x5207, 0x1907, 0x1948, 0x1947, 0x1947,
-    0x1947, 0x1927, 0x2966, 0x6A66, 0x6A66, 0x6A67, 0x7267, 0x41E7,
-    0x3187, 0x72A7, 0x6A66, 0x7AA7, 0x41E8, 0x2147, 0x51C6, 0x7AA7,
-    0x7286, 0x3964, 0x2944, 0x20E5, 0x1085, 0x4147, 0x4127, 0x3927,
-    0x3927, 0x3927, 0x3927, 0x3927, 0x3927, 0x3927, 0x3927, 0x3927,
-    0x3927, 0x3947, 0x3947, 0x3106, 0x59E7, 0x82C7, 0x5A06, 0x0023,
-    0x3145, 0x3144, 0x3165, 0x18E4, 0x0004, 0x0024, 0x0004, 0x28C6,
-    0x3927, 0x2927, 0x1948, 0x1948, 0x1948, 0x1928, 0x3127, 0x4126,
-    0x4126, 0x4126, 0x3964, 0x3985, 0x3985, 0x20C4, 0x0863, 0x39A4,
-    0x72A5, 0x7AE6, 0x2924, 0x0003, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0023, 0x3985, 0x5205, 0x2924,
-    0x0003, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0844, 0x2944, 0x3164,
-    0x1084, 0x0003, 0x10A3, 0x3185, 0x0843, 0x0023, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0844, 0x0003, 0x41C6, 0x49C6, 0x0003, 0x0045,
-    0x0024, 0x3165, 0x740E, 0x4ACC, 0x0002, 0x0844, 0x0023, 0x3165,
-    0x39A4, 0x5205, 0x82C6, 0x72A7, 0x6C73, 0x6CD5, 0x6CD5, 0x74F5,
-    0x74F6, 0x6CB5, 0x3ACE, 0x0885, 0x0003, 0x1083, 0x39A4, 0x7286,
-    0x6A66, 0x6C32, 0x6CF6, 0x6CD5, 0x6CD5, 0x6CD5, 0x6CD5, 0x6CD5,
-    0x6CF5, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CF5, 0x6CF6, 0x6CF6, 0x6CF6,
-    0x6CF6, 0x6CF6, 0x6CF6, 0x6CD5, 0x6CD5, 0x6CD5, 0x6CD5, 0x6CD5,
-    0x6CF6, 0x6CF6, 0x6CD5, 0x6CD5, 0x6CF5, 0x6CF5, 0x6CD5, 0x6CD5,
-    0x6CD5, 0x64D5, 0x64B5, 0x64B5, 0x6CD5, 0x7516, 0x4392, 0x2A90,
-    0x2AB1, 0x2AB1, 0x2AB1, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0,
-    0x2A90, 0x22B0, 0x22B0, 0x22B0, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0,
-    0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0, 0x2AB0,
-    0x2AB0, 0x2A90, 0x2A90, 0x2AB0, 0x2AB0, 0x22B0, 0x22B0, 0x2290,
-    0x2290, 0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2A8F,
-    0x2A8F, 0x2A6F, 0x2A6F, 0x326E, 0x6A89, 0x7288, 0x6A88, 0x7288,
-    0x7267, 0x7A47, 0x7A67, 0x7A46, 0x7A47, 0x7A67, 0x7A66, 0x7A67,
-    0x7267, 0x7A67, 0x7A67, 0x7267, 0x7247, 0x6A47, 0x6A47, 0x6A27,
-    0x6A27, 0x6A27, 0x6A27, 0x7246, 0x7266, 0x7266, 0x7266, 0x7267,
-    0x7267, 0x7A66, 0x7A66, 0x7A66, 0x7267, 0x7267, 0x7266, 0x7266,
-    0x20E3, 0x2944, 0x10A4, 0x18A5, 0x4167, 0x4126, 0x4126, 0x4126,
-    0x3926, 0x3927, 0x3926, 0x3926, 0x3926, 0x3926, 0x3926, 0x3927,
-    0x3927, 0x3926, 0x3927, 0x3906, 0x3926, 0x4126, 0x3926, 0x3146,
-    0x0844, 0x0824, 0x0843, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x1086, 0x4147, 0x4147, 0x4147, 0x4147, 0x4126,
-    0x3926, 0x3925, 0x3164, 0x3984, 0x10A3, 0x10A4, 0x3184, 0x39A4,
-    0x82E6, 0x4184, 0x1903, 0x10A4, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0023, 0x39A5, 0x49C4, 0x5205, 0x3145,
-    0x0004, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0863, 0x3164,
-    0x3185, 0x18A4, 0x0003, 0x1083, 0x3145, 0x3985, 0x10A4, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x1084, 0x2104, 0x2925, 0x0024,
-    0x0044, 0x0002, 0x2A0B, 0x3311, 0x196A, 0x0003, 0x0024, 0x0864,
-    0x18E4, 0x5205, 0x72C8, 0x322C, 0x32D0, 0x2AF0, 0x3311, 0x3311,
-    0x3332, 0x3B32, 0x1108, 0x0044, 0x0003, 0x1083, 0x3184, 0x3A07,
-    0x5B2D, 0x4351, 0x3332, 0x3332, 0x3312, 0x3311, 0x3311, 0x3312,
-    0x3332, 0x3332, 0x3312, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332,
-    0x3332, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332,
-    0x3332, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332, 0x3332,
-    0x3312, 0x3312, 0x3311, 0x32F1, 0x2AD1, 0x2AD1, 0x2270, 0x222F,
-    0x222F, 0x222F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F,
-    0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F,
-    0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A0F, 0x1A0F, 0x1A0F,
-    0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x2250, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x224F, 0x1A0F, 0x2A0D, 0x5A29, 0x6228,
-    0x5A48, 0x5A28, 0x5A28, 0x6208, 0x7206, 0x7205, 0x7205, 0x7205,
-    0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7205,
-    0x7A25, 0x7225, 0x7226, 0x7226, 0x7226, 0x7225, 0x7205, 0x7205,
-    0x7205, 0x7205, 0x7205, 0x7205, 0x7205, 0x7225, 0x7225, 0x7225,
-    0x7225, 0x7225, 0x7226, 0x7225, 0x7225, 0x7225, 0x7A46, 0x7266,
-    0x0842, 0x0043, 0x0044, 0x0004, 0x1864, 0x6206, 0x61E6, 0x61E6,
-    0x61C6, 0x61C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6, 0x59C6,
-    0x59C6, 0x59C5, 0x59C5, 0x59C6, 0x59C6, 0x59A5, 0x59A5, 0x51E6,
-    0x3144, 0x2924, 0x3985, 0x20E5, 0x0004, 0x0024, 0x0024, 0x20C5,
-    0x30E6, 0x28C5, 0x28A5, 0x40E6, 0x38E6, 0x38E6, 0x38E5, 0x4125,
-    0x59E6, 0x6A67, 0x3163, 0x39A4, 0x1083, 0x1084, 0x3184, 0x3163,
-    0x82E6, 0x7AE7, 0x39A4, 0x0883, 0x0004, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0004, 0x0844, 0x39A5, 0x49E5, 0x5205, 0x2924, 0x0843,
-    0x0024, 0x0004, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x1084,
-    0x18A4, 0x18C4, 0x10A4, 0x0003, 0x18A4, 0x18E4, 0x0864, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0044, 0x0004, 0x0864, 0x18C4, 0x0024,
-    0x0023, 0x3945, 0x2107, 0x08E9, 0x08C7, 0x0024, 0x0024, 0x0004,
-    0x2945, 0x6A85, 0x6288, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x2250,
-    0x1A0E, 0x08C8, 0x0025, 0x0004, 0x10A4, 0x2103, 0x3184, 0x5268,
-    0x2A8F, 0x2270, 0x224F, 0x2250, 0x2250, 0x2250, 0x1A2F, 0x224F,
-    0x2250, 0x2250, 0x222F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F,
-    0x1A0F, 0x1A0F, 0x1A0F, 0x1A30, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F,
-    0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F, 0x1A0F,
-    0x1A0F, 0x1A0F, 0x19EF, 0x1A0F, 0x4BD3, 0x4C14, 0x5434, 0x5435,
-    0x5434, 0x5434, 0x5434, 0x5434, 0x5434, 0x5434, 0x5434, 0x5414,
-    0x5414, 0x5414, 0x5414, 0x5434, 0x5414, 0x5414, 0x5434, 0x5434,
-    0x5434, 0x5434, 0x5414, 0x5414, 0x5434, 0x5434, 0x5414, 0x5414,
-    0x4C14, 0x4C14, 0x4C14, 0x4C14, 0x5434, 0x3B52, 0x1A0F, 0x222F,
-    0x1A2F, 0x222F, 0x1A0F, 0x3311, 0x5455, 0x5433, 0x7431, 0x7430,
-    0x7430, 0x7430, 0x7430, 0x7410, 0x7410, 0x6C10, 0x6C10, 0x6C10,
-    0x6C10, 0x6C10, 0x7430, 0x7451, 0x7451, 0x6C31, 0x7431, 0x7431,
-    0x7451, 0x7451, 0x7451, 0x7451, 0x7451, 0x7451, 0x7431, 0x6C31,
-    0x6C31, 0x6C31, 0x6C31, 0x6C31, 0x7431, 0x7431, 0x7451, 0x7451,
-    0x7451, 0x7451, 0x7451, 0x7451, 0x7451, 0x6C11, 0x73AE, 0x6246,
-    0x4184, 0x2104, 0x0023, 0x1108, 0x53B0, 0x7431, 0x7431, 0x7431,
-    0x7431, 0x7431, 0x6C31, 0x7431, 0x6C31, 0x6C31, 0x6C31, 0x6C31,
-    0x6C31, 0x6C31, 0x7431, 0x7431, 0x7451, 0x7472, 0x5B6E, 0x18A3,
-    0x41A4, 0x5A45, 0x3144, 0x20E4, 0x2905, 0x0024, 0x0024, 0x1085,
-    0x1063, 0x31C9, 0x63D1, 0x5BB0, 0x63D1, 0x63D1, 0x63D1, 0x5AEC,
-    0x5A05, 0x41A4, 0x3184, 0x18C3, 0x18C4, 0x2924, 0x41C4, 0x72C6,
-    0x8B27, 0x5A45, 0x2964, 0x1904, 0x10A4, 0x0024, 0x0024, 0x0024,
-    0x20E5, 0x3985, 0x3165, 0x2924, 0x49E5, 0x2924, 0x0844, 0x0003,
-    0x0844, 0x2925, 0x0844, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024,
-    0x0004, 0x1084, 0x2944, 0x18A3, 0x1084, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x0024, 0x0044,
-    0x0003, 0x5A26, 0x3964, 0x1062, 0x1063, 0x0024, 0x0024, 0x0004,
-    0x20E4, 0x5A25, 0x72C7, 0x4A6B, 0x2A6F, 0x2270, 0x2270, 0x220E,
-    0x1129, 0x0003, 0x0024, 0x10A4, 0x2964, 0x39A4, 0x5205, 0x7AE8,
-    0x2A4E, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A90, 0x3B93, 0x2AD1,
-    0x2270, 0x2270, 0x2AB0, 0x43B3, 0x43B3, 0x43B3, 0x43B3, 0x43B3,
-    0x43B3, 0x43B3, 0x43B3, 0x3B31, 0x4392, 0x4BF4, 0x4BF3, 0x4BF4,
-    0x4BF3, 0x4BF3, 0x4BF3, 0x4BF4, 0x4BF3, 0x4BD3, 0x4BD3, 0x4BD3,
-    0x4BF3, 0x4BF3, 0x43D3, 0x43D3, 0x75B8, 0x7DF9, 0x7DF8, 0x7DF8,
-    0x7DF8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8,
-    0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8,
-    0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8,
-    0x7DD8, 0x7DD8, 0x7DD8, 0x7DD8, 0x7DF9, 0x64D6, 0x4392, 0x43B3,
-    0x4392, 0x4392, 0x3B92, 0x4BF3, 0x5475, 0x5455, 0x4C55, 0x4C55,
-    0x4C55, 0x4C35, 0x4C35, 0x4C35, 0x4C35, 0x4C35, 0x4C35, 0x4C55,
-    0x4C35, 0x4C55, 0x4C55, 0x4BF3, 0x43D3, 0x43D3, 0x43D3, 0x43D3,
-    0x43D3, 0x43D3, 0x43D3, 0x43D3, 0x4BF3, 0x43F3, 0x43B2, 0x43B2,
-    0x43B2, 0x43B2, 0x43D3, 0x43B2, 0x43B2, 0x43B2, 0x43D2, 0x43D3,
-    0x43D3, 0x43D3, 0x43D3, 0x43B3, 0x4BF2, 0x6431, 0x73CD, 0x6A65,
-    0x41A4, 0x2924, 0x0023, 0x1969, 0x5414, 0x43B2, 0x43B2, 0x43B2,
-    0x43B2, 0x43B2, 0x43B2, 0x43B2, 0x43B2, 0x43B2, 0x43B2, 0x43B2,
-    0x43B2, 0x43B3, 0x43B2, 0x4BB2, 0x4392, 0x4BD2, 0x5B6E, 0x2904,
-    0x51E5, 0x41A4, 0x20E4, 0x3144, 0x41C5, 0x0024, 0x0024, 0x0003,
-    0x0024, 0x21CB, 0x4BD3, 0x43B2, 0x4BF3, 0x4BD2, 0x5474, 0x536D,
-    0x41A3, 0x49A4, 0x20E3, 0x0002, 0x18C4, 0x3184, 0x3984, 0x5A26,
-    0x8307, 0x5205, 0x2124, 0x18E4, 0x10A4, 0x0024, 0x0024, 0x0024,
-    0x20E5, 0x3985, 0x2945, 0x0843, 0x49E6, 0x1063, 0x0003, 0x0864,
-    0x20E4, 0x2125, 0x0044, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024,
-    0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0864,
-    0x0864, 0x1083, 0x18C4, 0x2124, 0x2924, 0x0864, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x0044, 0x0024, 0x0024,
-    0x0023, 0x20E4, 0x3984, 0x49E5, 0x3165, 0x0024, 0x1084, 0x10A4,
-    0x0863, 0x20C3, 0x5A27, 0x62CA, 0x2A6E, 0x2270, 0x2290, 0x116A,
-    0x0003, 0x08C7, 0x0024, 0x2125, 0x2124, 0x41C5, 0x82E7, 0x72A7,
-    0x426C, 0x2A6F, 0x2270, 0x2270, 0x2270, 0x2AB0, 0x5496, 0x3312,
-    0x2270, 0x2250, 0x32F1, 0x5CD6, 0x5CB6, 0x5CD6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CD6, 0x4BF3, 0x64B5, 0x7558, 0x6D37, 0x6D37,
-    0x6D37, 0x6D37, 0x6D37, 0x6D37, 0x6D37, 0x6D37, 0x6D37, 0x6D37,
-    0x6D37, 0x6D37, 0x6D37, 0x6517, 0x5CD6, 0x5CD6, 0x5CD6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x5CD6, 0x64B6, 0x64B6, 0x5CB6,
-    0x64D6, 0x64D6, 0x5CD6, 0x64D6, 0x64D6, 0x64D6, 0x5CD6, 0x64D6,
-    0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x64B6, 0x5CB6, 0x5CB6,
-    0x64D6, 0x64B6, 0x64B6, 0x64D6, 0x5CB6, 0x64D6, 0x64D6, 0x5CD6,
-    0x5CD6, 0x5CB6, 0x6516, 0x4BD3, 0x1A2F, 0x2250, 0x2250, 0x224F,
-    0x224F, 0x222F, 0x222F, 0x222F, 0x222F, 0x224F, 0x224F, 0x224F,
-    0x224F, 0x224F, 0x224F, 0x118B, 0x094A, 0x094A, 0x0909, 0x094A,
-    0x08E8, 0x092A, 0x114B, 0x094A, 0x0909, 0x092A, 0x094A, 0x0909,
-    0x08E9, 0x08E8, 0x0909, 0x094A, 0x0909, 0x08E8, 0x0909, 0x0909,
-    0x0909, 0x092A, 0x116B, 0x0909, 0x1928, 0x4A07, 0x6266, 0x6287,
-    0x18C3, 0x1084, 0x0845, 0x0046, 0x08C8, 0x00C8, 0x092A, 0x08E8,
-    0x08E8, 0x08E8, 0x0909, 0x0909, 0x0909, 0x0909, 0x08E9, 0x0909,
-    0x0909, 0x092A, 0x116B, 0x0909, 0x1907, 0x3986, 0x6A45, 0x5A05,
-    0x6A45, 0x28C3, 0x2904, 0x3985, 0x2904, 0x0024, 0x0024, 0x0065,
-    0x1109, 0x114A, 0x08E9, 0x0909, 0x0929, 0x08E9, 0x21EA, 0x3208,
-    0x3164, 0x6288, 0x2105, 0x1063, 0x2103, 0x3164, 0x2123, 0x20A3,
-    0x7AC6, 0x7B07, 0x39A5, 0x0884, 0x0004, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0004, 0x0004, 0x0844, 0x3185, 0x18C4, 0x0863, 0x18E4,
-    0x2104, 0x0003, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x2104,
-    0x2964, 0x18E4, 0x0023, 0x0023, 0x0023, 0x0023, 0x0844, 0x0044,
-    0x0024, 0x0044, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0843, 0x0023, 0x2104, 0x41C5, 0x2924, 0x0023, 0x3185, 0x3184,
-    0x39A4, 0x18C3, 0x10A5, 0x328E, 0x2A6E, 0x226F, 0x2290, 0x116A,
-    0x08A6, 0x2A2D, 0x0044, 0x0023, 0x0023, 0x3124, 0x6A66, 0x6A86,
-    0x72A7, 0x326D, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2250, 0x2250, 0x2250, 0x2250, 0x2250,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2250, 0x224F, 0x2270, 0x2250, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2250, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x224F, 0x224F,
-    0x224F, 0x224F, 0x2270, 0x2290, 0x2A90, 0x2290, 0x2A90, 0x2290,
-    0x2A70, 0x2A70, 0x2270, 0x2270, 0x2290, 0x2A90, 0x2A90, 0x2A91,
-    0x2A90, 0x2A90, 0x2270, 0x2A90, 0x2AD1, 0x222E, 0x118B, 0x2A70,
-    0x0949, 0x222E, 0x2AB1, 0x220E, 0x114A, 0x118B, 0x2A91, 0x11AC,
-    0x114A, 0x112A, 0x19AB, 0x2A90, 0x116A, 0x114A, 0x114A, 0x114A,
-    0x114A, 0x118B, 0x2A91, 0x116A, 0x1107, 0x1947, 0x21A8, 0x29A8,
-    0x39C6, 0x4A06, 0x18E5, 0x0005, 0x0045, 0x08A7, 0x2A6F, 0x118B,
-    0x1129, 0x114A, 0x116A, 0x116A, 0x114A, 0x114A, 0x116A, 0x116A,
-    0x116A, 0x118B, 0x2AB1, 0x116A, 0x5207, 0x82E7, 0x5A26, 0x1062,
-    0x5A05, 0x5A46, 0x20E4, 0x0003, 0x0024, 0x0024, 0x0024, 0x1129,
-    0x116B, 0x116B, 0x116B, 0x116A, 0x116A, 0x116A, 0x116A, 0x198A,
-    0x21AB, 0x322C, 0x5ACC, 0x49E6, 0x41A4, 0x3164, 0x3163, 0x72C7,
-    0x7AE6, 0x41A3, 0x39A5, 0x2125, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0044, 0x0044, 0x0044, 0x0044, 0x0043, 0x2944, 0x39A5, 0x18E4,
-    0x0003, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044,
-    0x0024, 0x1084, 0x2944, 0x2924, 0x2924, 0x2924, 0x3164, 0x18E4,
-    0x0024, 0x0044, 0x0044, 0x0044, 0x0044, 0x0024, 0x0024, 0x0844,
-    0x51E6, 0x6246, 0x2905, 0x0024, 0x0844, 0x0024, 0x0844, 0x0003,
-    0x20E3, 0x5205, 0x72A6, 0x7AC7, 0x72E9, 0x326E, 0x224F, 0x2A6F,
-    0x21CC, 0x0024, 0x0024, 0x0003, 0x2925, 0x6A86, 0x6A66, 0x2986,
-    0x326D, 0x2A6F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2A90, 0x2A90, 0x2A90, 0x2A70, 0x2A90, 0x2A90, 0x2290,
-    0x2A90, 0x2290, 0x2A90, 0x2290, 0x2290, 0x2290, 0x2290, 0x2A90,
-    0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2290, 0x2270,
-    0x2290, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2A70,
-    0x2A90, 0x2A70, 0x2A90, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2290, 0x2290, 0x2A90, 0x2A70, 0x2A70,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2A70, 0x2A70, 0x2290, 0x2290, 0x2270, 0x2290, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x226F, 0x2290, 0x2290, 0x2270, 0x224F,
-    0x0929, 0x222E, 0x2A91, 0x2270, 0x220E, 0x116B, 0x2291, 0x2AB1,
-    0x19CD, 0x0929, 0x118B, 0x2A90, 0x224F, 0x2270, 0x19AC, 0x0909,
-    0x118B, 0x2A90, 0x2AB1, 0x094A, 0x41C7, 0x6266, 0x6266, 0x6287,
-    0x10A3, 0x39A5, 0x18E5, 0x0004, 0x08A7, 0x2A6F, 0x2290, 0x226F,
-    0x226F, 0x2270, 0x224F, 0x114A, 0x114A, 0x112A, 0x222F, 0x222F,
-    0x112A, 0x116B, 0x2A8F, 0x5249, 0x72A6, 0x49A5, 0x1883, 0x49E6,
-    0x49E6, 0x1062, 0x2924, 0x2925, 0x0004, 0x0024, 0x0024, 0x0045,
-    0x00A7, 0x21ED, 0x32B0, 0x114A, 0x114A, 0x116A, 0x0929, 0x31E8,
-    0x5A48, 0x0885, 0x39A5, 0x39A4, 0x41A4, 0x3984, 0x2104, 0x20C3,
-    0x72A6, 0x72C6, 0x39C4, 0x2124, 0x18E4, 0x0024, 0x0044, 0x0044,
-    0x0044, 0x0044, 0x0024, 0x0043, 0x2944, 0x3184, 0x18C3, 0x0003,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x0024,
-    0x0044, 0x0044, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0844, 0x1083, 0x1083, 0x2944, 0x3164, 0x18C3, 0x0023,
-    0x0024, 0x0024, 0x0044, 0x0024, 0x0024, 0x0044, 0x0024, 0x0044,
-    0x18A4, 0x18C4, 0x0864, 0x0024, 0x0024, 0x0024, 0x0003, 0x20E4,
-    0x20E3, 0x31C7, 0x5ACB, 0x4A6A, 0x428B, 0x224E, 0x2270, 0x19CD,
-    0x0886, 0x0024, 0x0024, 0x0024, 0x0864, 0x2924, 0x6245, 0x5247,
-    0x224F, 0x1A50, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2250, 0x2250, 0x2270, 0x2A90, 0x2270, 0x1A4F, 0x1A4F,
-    0x224F, 0x224F, 0x222F, 0x222F, 0x224F, 0x224F, 0x224F, 0x224F,
-    0x224F, 0x224F, 0x224F, 0x224F, 0x224F, 0x224F, 0x1A2F, 0x1A2F,
-    0x1A2F, 0x1A2F, 0x1A2F, 0x2250, 0x2270, 0x2270, 0x2270, 0x2230,
-    0x2250, 0x2250, 0x224F, 0x2250, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x224F, 0x1A2F, 0x1A2F, 0x224F, 0x2250, 0x2250, 0x2250, 0x2250,
-    0x2270, 0x2270, 0x2250, 0x222F, 0x1A2F, 0x224F, 0x2270, 0x2270,
-    0x2250, 0x2270, 0x2290, 0x2270, 0x2250, 0x1A2F, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2AB1, 0x5496, 0x5CB6, 0x54B6, 0x54B6,
-    0x5496, 0x5495, 0x5495, 0x5C96, 0x3B72, 0x2290, 0x2AB0, 0x2270,
-    0x19CD, 0x1A0F, 0x222F, 0x2250, 0x19ED, 0x0909, 0x1A50, 0x2272,
-    0x118C, 0x116B, 0x2270, 0x2270, 0x2270, 0x2A91, 0x19CD, 0x0909,
-    0x118B, 0x2A91, 0x2A91, 0x118B, 0x1947, 0x31E9, 0x62A9, 0x7AE6,
-    0x49C5, 0x18C4, 0x0024, 0x0025, 0x0024, 0x08A6, 0x226F, 0x2A91,
-    0x2290, 0x2AB1, 0x2270, 0x114A, 0x112A, 0x0909, 0x222F, 0x224F,
-    0x112A, 0x116A, 0x2A6F, 0x3AAD, 0x3A6C, 0x5269, 0x51E6, 0x0863,
-    0x0863, 0x2104, 0x49E5, 0x3145, 0x0004, 0x0024, 0x0024, 0x0024,
-    0x0887, 0x112A, 0x116B, 0x116A, 0x116A, 0x114A, 0x222C, 0x3A6A,
-    0x41A4, 0x3144, 0x39A4, 0x41C4, 0x20E4, 0x0843, 0x18C3, 0x5A45,
-    0x7AC6, 0x49E4, 0x3164, 0x2964, 0x2964, 0x2104, 0x0024, 0x0024,
-    0x0024, 0x0004, 0x0844, 0x2924, 0x3184, 0x3164, 0x2924, 0x2924,
-    0x2105, 0x0023, 0x2925, 0x2944, 0x1084, 0x0004, 0x0044, 0x0024,
-    0x0004, 0x0004, 0x0024, 0x0044, 0x0044, 0x0044, 0x0024, 0x0044,
-    0x0044, 0x0024, 0x0024, 0x0023, 0x1083, 0x1083, 0x18C4, 0x2104,
-    0x18C4, 0x0024, 0x0004, 0x18C4, 0x0884, 0x0004, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0023, 0x3185,
-    0x20E4, 0x0885, 0x2167, 0x62CA, 0x62CB, 0x5AAA, 0x29AA, 0x0087,
-    0x0024, 0x0044, 0x0044, 0x0024, 0x10A4, 0x2944, 0x49C4, 0x4A05,
-    0x5AAA, 0x5ACB, 0x3A8E, 0x2270, 0x2A70, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2250,
-    0x2AD1, 0x4C34, 0x5434, 0x32F1, 0x2250, 0x3332, 0x5455, 0x4C34,
-    0x4C34, 0x4C34, 0x4C14, 0x4C34, 0x4C34, 0x4C34, 0x4C34, 0x4C34,
-    0x4C34, 0x4C34, 0x4C34, 0x4C34, 0x4C34, 0x4C34, 0x4C34, 0x4C14,
-    0x4C14, 0x4C14, 0x4C34, 0x2AD1, 0x2270, 0x2270, 0x2AF1, 0x5435,
-    0x5434, 0x4C34, 0x5455, 0x3B93, 0x2250, 0x2270, 0x2270, 0x224F,
-    0x3B52, 0x4C34, 0x4C14, 0x4C35, 0x5435, 0x4C34, 0x5455, 0x4393,
-    0x2250, 0x2270, 0x224F, 0x3B93, 0x43F4, 0x3332, 0x2250, 0x2AB1,
-    0x4BF4, 0x2AD1, 0x2270, 0x2270, 0x2AB0, 0x43B3, 0x2290, 0x2270,
-    0x2270, 0x2290, 0x2290, 0x2AB1, 0x3BB3, 0x43B3, 0x3BB3, 0x3B93,
-    0x3B93, 0x3BB3, 0x3BB3, 0x43B3, 0x32F1, 0x2270, 0x2270, 0x2290,
-    0x4BF4, 0x4C14, 0x43F4, 0x4BF4, 0x43D3, 0x43B2, 0x4C35, 0x4C55,
-    0x4392, 0x43D3, 0x4C15, 0x2270, 0x2270, 0x2A91, 0x19CD, 0x0908,
-    0x116A, 0x2A90, 0x2A91, 0x116B, 0x118B, 0x2270, 0x3A8E, 0x49E5,
-    0x18A3, 0x2925, 0x1085, 0x0004, 0x0065, 0x19CC, 0x2270, 0x2290,
-    0x2290, 0x2AB1, 0x224F, 0x114A, 0x19ED, 0x1A0E, 0x2270, 0x222F,
-    0x114A, 0x116A, 0x2290, 0x2291, 0x4B0E, 0x7309, 0x5205, 0x2924,
-    0x20E3, 0x3984, 0x3144, 0x0864, 0x0004, 0x0024, 0x0024, 0x0024,
-    0x08A7, 0x08E9, 0x0909, 0x116B, 0x114A, 0x092A, 0x1989, 0x29A6,
-    0x3164, 0x41C5, 0x39A5, 0x2104, 0x20C5, 0x3145, 0x5A25, 0x8B06,
-    0x8306, 0x41A4, 0x2943, 0x2103, 0x18E4, 0x3185, 0x2104, 0x0044,
-    0x1084, 0x2104, 0x2104, 0x2964, 0x1083, 0x2924, 0x39A4, 0x2944,
-    0x10A4, 0x0044, 0x18A4, 0x3184, 0x3144, 0x10A4, 0x0024, 0x0024,
-    0x3145, 0x3945, 0x1084, 0x0004, 0x0024, 0x0044, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x1083, 0x1083, 0x2924, 0x39C4,
-    0x2944, 0x0024, 0x1084, 0x3164, 0x2104, 0x1083, 0x1083, 0x0004,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x18E4,
-    0x1084, 0x0023, 0x20C3, 0x49A5, 0x4964, 0x7A86, 0x5A06, 0x18A4,
-    0x0024, 0x0044, 0x0044, 0x0024, 0x2104, 0x3164, 0x18E3, 0x3164,
-    0x5A45, 0x8B07, 0x52CD, 0x1A70, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2AD1, 0x5434, 0x5455, 0x32F1, 0x224F, 0x3332, 0x5455, 0x4C34,
-    0x5435, 0x4C35, 0x4C34, 0x4C34, 0x4C34, 0x4C34, 0x5435, 0x5435,
-    0x5435, 0x5455, 0x5455, 0x5455, 0x4C55, 0x4C35, 0x4C35, 0x4C35,
-    0x4C34, 0x4C34, 0x4C34, 0x2AB0, 0x2270, 0x2270, 0x2AD1, 0x5455,
-    0x5455, 0x4C35, 0x5455, 0x3B93, 0x2270, 0x2270, 0x2270, 0x224F,
-    0x3B52, 0x4C34, 0x4C34, 0x4C55, 0x4C35, 0x5435, 0x5455, 0x3B73,
-    0x2270, 0x2270, 0x226F, 0x3B72, 0x43F4, 0x3311, 0x222F, 0x2AB1,
-    0x4BF4, 0x2AD1, 0x2270, 0x2250, 0x2AB0, 0x43B3, 0x2290, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2290, 0x2270, 0x2250, 0x224F, 0x222F,
-    0x2250, 0x2270, 0x2270, 0x2230, 0x2250, 0x2270, 0x2270, 0x2290,
-    0x4BF4, 0x4C14, 0x4C14, 0x4C14, 0x4C34, 0x5455, 0x4C35, 0x5455,
-    0x4BF3, 0x4BF3, 0x43F4, 0x2290, 0x2270, 0x2A91, 0x11AC, 0x0929,
-    0x19ED, 0x2A90, 0x2A91, 0x19ED, 0x2250, 0x42F0, 0x52AA, 0x39A5,
-    0x18A3, 0x41C5, 0x20E4, 0x0003, 0x0865, 0x21CC, 0x2AB1, 0x2AB1,
-    0x2290, 0x2AB1, 0x222E, 0x0929, 0x2270, 0x2A91, 0x2AB1, 0x220E,
-    0x116A, 0x21CB, 0x328F, 0x4AEE, 0x5289, 0x4A05, 0x41A5, 0x3144,
-    0x5A25, 0x6245, 0x2903, 0x0863, 0x1084, 0x0024, 0x0025, 0x0024,
-    0x0866, 0x0087, 0x00A8, 0x198B, 0x4229, 0x4A49, 0x39C6, 0x3984,
-    0x3164, 0x18C3, 0x39A5, 0x0863, 0x20C3, 0x6A65, 0x8306, 0x4184,
-    0x49C6, 0x2124, 0x39C4, 0x3186, 0x0865, 0x18E4, 0x2104, 0x0024,
-    0x1084, 0x2104, 0x2104, 0x2944, 0x1083, 0x2944, 0x2944, 0x1084,
-    0x0004, 0x0044, 0x0004, 0x10A4, 0x3184, 0x2924, 0x0004, 0x0044,
-    0x6A86, 0x72A7, 0x3144, 0x0863, 0x0864, 0x0024, 0x0024, 0x0864,
-    0x1064, 0x0864, 0x0864, 0x1083, 0x3164, 0x3984, 0x3184, 0x3984,
-    0x2944, 0x1083, 0x3164, 0x3164, 0x3164, 0x3984, 0x2944, 0x0863,
-    0x1064, 0x1084, 0x0844, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0004, 0x18C4, 0x3164, 0x0862, 0x1883, 0x4185, 0x6247, 0x3146,
-    0x0003, 0x0024, 0x0024, 0x0024, 0x20E4, 0x18C3, 0x0843, 0x2965,
-    0x2943, 0x5A46, 0x52AA, 0x42AE, 0x428D, 0x3A8E, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x1A2F, 0x1A4F, 0x2270, 0x2290, 0x2270, 0x1A2F, 0x222F,
-    0x222F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F, 0x1A2F,
-    0x1A2F, 0x224F, 0x1A4F, 0x1A4F, 0x1A2F, 0x1A30, 0x1A2F, 0x1A2F,
-    0x1A2F, 0x1A2F, 0x1A0F, 0x2250, 0x2270, 0x2AB1, 0x2AF1, 0x2250,
-    0x2250, 0x1A2F, 0x1A2F, 0x2250, 0x2270, 0x2270, 0x2250, 0x2270,
-    0x222F, 0x1A2F, 0x1A2F, 0x2250, 0x2AD1, 0x2250, 0x2291, 0x2AB1,
-    0x2270, 0x2270, 0x2270, 0x22B0, 0x2270, 0x2290, 0x2AD1, 0x2270,
-    0x2AD1, 0x2290, 0x2AB1, 0x2AB0, 0x2270, 0x22B0, 0x2270, 0x2270,
-    0x2270, 0x2AD1, 0x2AF1, 0x2270, 0x2290, 0x2270, 0x2AD1, 0x2AD1,
-    0x2270, 0x2290, 0x2270, 0x2AF1, 0x2AB1, 0x2270, 0x2270, 0x2270,
-    0x1A2F, 0x1A0F, 0x1A0F, 0x1A2F, 0x1A2F, 0x1A4F, 0x1A2F, 0x224F,
-    0x19EE, 0x1A0E, 0x2270, 0x2291, 0x2270, 0x2A91, 0x19CC, 0x19CC,
-    0x2AB1, 0x2A70, 0x2A90, 0x2AB1, 0x32B0, 0x62CB, 0x82E6, 0x72A6,
-    0x49C5, 0x3164, 0x1083, 0x0004, 0x0004, 0x0004, 0x19CD, 0x2290,
-    0x2A91, 0x2290, 0x224F, 0x116B, 0x226F, 0x2270, 0x2A90, 0x222F,
-    0x19CC, 0x3AAE, 0x3A6C, 0x6B4B, 0x3186, 0x20C3, 0x3986, 0x1883,
-    0x51E6, 0x6A66, 0x49C4, 0x3164, 0x18E4, 0x0024, 0x0024, 0x0024,
-    0x0004, 0x0844, 0x2105, 0x39E8, 0x8B47, 0x7B06, 0x41C5, 0x3984,
-    0x3984, 0x1063, 0x2924, 0x0843, 0x3964, 0x72C5, 0x5A26, 0x0002,
-    0x2105, 0x3165, 0x5226, 0x4208, 0x10C7, 0x0004, 0x0004, 0x0024,
-    0x0024, 0x0004, 0x0843, 0x2124, 0x2944, 0x2944, 0x1084, 0x0004,
-    0x0044, 0x0024, 0x0044, 0x0004, 0x18C4, 0x18C4, 0x0024, 0x0024,
-    0x3143, 0x3143, 0x3164, 0x3984, 0x2944, 0x0843, 0x0843, 0x2924,
-    0x3984, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3184, 0x3164,
-    0x3184, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3984, 0x18C4, 0x0024, 0x0844, 0x0844, 0x0044, 0x0044,
-    0x0024, 0x18C3, 0x3184, 0x41A4, 0x82E8, 0x28C3, 0x0822, 0x1043,
-    0x1064, 0x0864, 0x0044, 0x0004, 0x18E4, 0x2104, 0x0844, 0x0864,
-    0x2944, 0x2943, 0x6245, 0x8B27, 0x8B07, 0x7AE8, 0x3A6D, 0x2A6E,
-    0x326E, 0x2A6F, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2290, 0x2270, 0x2270, 0x2270, 0x2290, 0x2270,
-    0x2290, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2290, 0x2290, 0x2291, 0x2291,
-    0x2290, 0x2270, 0x2270, 0x2270, 0x2250, 0x3B72, 0x4C35, 0x2290,
-    0x2A90, 0x2A90, 0x2A90, 0x2A90, 0x2290, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2A70, 0x2AB1, 0x4C35, 0x2AD0, 0x43B3, 0x43D4,
-    0x2270, 0x2291, 0x2270, 0x4C35, 0x3B73, 0x3352, 0x43F4, 0x22B0,
-    0x4C34, 0x22B0, 0x3B93, 0x3B73, 0x2AD1, 0x4C35, 0x22B0, 0x2A90,
-    0x2270, 0x3373, 0x4C14, 0x2270, 0x2290, 0x226F, 0x3BB3, 0x43B3,
-    0x2270, 0x2290, 0x226F, 0x43F4, 0x3B73, 0x2290, 0x2A90, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2290, 0x2290, 0x2270, 0x2270,
-    0x2270, 0x2A91, 0x2270, 0x2290, 0x2290, 0x2A70, 0x2270, 0x2270,
-    0x2270, 0x2A90, 0x2A90, 0x2270, 0x52CC, 0x7AE7, 0x7AE7, 0x72A7,
-    0x0862, 0x0002, 0x0023, 0x0024, 0x0025, 0x0046, 0x0045, 0x222E,
-    0x2AB1, 0x2270, 0x2290, 0x2290, 0x2290, 0x2290, 0x2270, 0x2290,
-    0x2A90, 0x2A90, 0x2AB0, 0x2270, 0x6AEA, 0x59C4, 0x20A3, 0x6247,
-    0x0843, 0x3144, 0x41C5, 0x2104, 0x0003, 0x0844, 0x0024, 0x0024,
-    0x0023, 0x3144, 0x8307, 0x8306, 0x8B06, 0x3104, 0x0023, 0x20E3,
-    0x5A45, 0x49E6, 0x0863, 0x0043, 0x5206, 0x5225, 0x1903, 0x2944,
-    0x7AE6, 0x8347, 0x3164, 0x18C4, 0x18E5, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144, 0x3144, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3984, 0x3964, 0x3964, 0x3964, 0x3143,
-    0x3143, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3964, 0x3164, 0x3144, 0x3144, 0x3144, 0x2944, 0x0843,
-    0x18C4, 0x3184, 0x3164, 0x4184, 0x7AA7, 0x7267, 0x6A46, 0x7267,
-    0x7267, 0x6A47, 0x0863, 0x0044, 0x0043, 0x18E3, 0x3184, 0x2964,
-    0x2943, 0x72C7, 0x5A24, 0x51E4, 0x8B07, 0x82C6, 0x7AE8, 0x7AC8,
-    0x82E8, 0x5ACB, 0x224F, 0x2A6F, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2290, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2290, 0x2270, 0x2270, 0x2270, 0x2250, 0x2270, 0x224F,
-    0x2270, 0x2270, 0x2270, 0x2290, 0x2270, 0x2290, 0x2270, 0x3352,
-    0x43F4, 0x2290, 0x4C14, 0x2290, 0x3352, 0x3B72, 0x2290, 0x43D4,
-    0x2270, 0x4C14, 0x3332, 0x3332, 0x43D4, 0x226F, 0x4C35, 0x2AB0,
-    0x3B72, 0x3BB3, 0x2AD1, 0x4C34, 0x228F, 0x43D3, 0x3311, 0x3311,
-    0x4414, 0x22B0, 0x4C35, 0x2AF1, 0x3BB4, 0x3BB3, 0x2AD1, 0x4414,
-    0x228F, 0x3BB3, 0x2B11, 0x3311, 0x43D4, 0x22B0, 0x4C35, 0x2AB1,
-    0x3BB3, 0x3BB3, 0x2AD0, 0x4C14, 0x2290, 0x43D4, 0x3311, 0x3311,
-    0x43F4, 0x226F, 0x4C15, 0x2AF1, 0x3BB3, 0x3B93, 0x22B0, 0x4BF4,
-    0x226F, 0x43D4, 0x3332, 0x2250, 0x2270, 0x224F, 0x2270, 0x224F,
-    0x2270, 0x2270, 0x2270, 0x2A90, 0x2290, 0x2270, 0x2290, 0x2290,
-    0x2270, 0x2A90, 0x2A90, 0x2A90, 0x328F, 0x3AAE, 0x324C, 0x0843,
-    0x18C4, 0x3164, 0x1083, 0x0003, 0x08A7, 0x32B0, 0x2270, 0x2A90,
-    0x2A91, 0x2290, 0x2290, 0x2290, 0x2290, 0x2290, 0x2290, 0x2270,
-    0x2290, 0x2290, 0x2290, 0x2270, 0x62A9, 0x9306, 0x7AC7, 0x49A4,
-    0x41C5, 0x1084, 0x0843, 0x0023, 0x1064, 0x3985, 0x0844, 0x0003,
-    0x5206, 0x41C5, 0x1882, 0x82E6, 0x82E6, 0x82E7, 0x6A86, 0x6245,
-    0x49E5, 0x0823, 0x0024, 0x0024, 0x10A4, 0x1903, 0x3183, 0x6AC6,
-    0x6286, 0x2903, 0x49C4, 0x4A05, 0x10C3, 0x0003, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3164, 0x3964, 0x3984, 0x3964, 0x3925, 0x7ACA, 0xABED,
-    0x7AC9, 0x2902, 0x2923, 0x3144, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3964, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x2924,
-    0x2944, 0x3184, 0x3964, 0x3964, 0x4184, 0x4184, 0x4184, 0x41A4,
-    0x41A4, 0x41A4, 0x6266, 0x3143, 0x51E5, 0x7AC7, 0x72A6, 0x72A6,
-    0x72A6, 0x8AE7, 0x7AA6, 0x7286, 0x82E6, 0x82C6, 0x8AC6, 0x8AC6,
-    0x8AE6, 0x82E7, 0x72C9, 0x6AEA, 0x2A6F, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2290, 0x2290, 0x2290, 0x2290, 0x2AF1, 0x4BF4, 0x224F, 0x3B93,
-    0x2AF1, 0x2AF1, 0x43D4, 0x2290, 0x4414, 0x22B0, 0x3B73, 0x3BB3,
-    0x2B11, 0x4C35, 0x2AD1, 0x43D4, 0x3331, 0x3311, 0x3B93, 0x22B0,
-    0x43F4, 0x3311, 0x3B93, 0x3B93, 0x2AF0, 0x43F4, 0x2AF1, 0x43F4,
-    0x3352, 0x3352, 0x43D3, 0x2AB0, 0x43D3, 0x2AD0, 0x3B72, 0x3352,
-    0x2AF1, 0x4C14, 0x2AF1, 0x43F4, 0x3352, 0x3352, 0x43D4, 0x22B0,
-    0x43D3, 0x2AD0, 0x3352, 0x3332, 0x2AF1, 0x4C15, 0x2AF1, 0x43F4,
-    0x3352, 0x3352, 0x3B93, 0x22B0, 0x43D4, 0x2AD0, 0x3B72, 0x3B52,
-    0x2AD0, 0x43F4, 0x2AD1, 0x43D4, 0x3B52, 0x3332, 0x43F4, 0x2AD1,
-    0x4C14, 0x2AF1, 0x3B93, 0x3B73, 0x226F, 0x43B3, 0x1A4F, 0x3BB3,
-    0x2AD1, 0x2AD1, 0x3BB3, 0x2270, 0x2250, 0x43D4, 0x2B12, 0x2B12,
-    0x43F4, 0x2250, 0x2A91, 0x2290, 0x1A70, 0x4AEE, 0x62EA, 0x2924,
-    0x3184, 0x2943, 0x49C5, 0x3985, 0x0024, 0x10E8, 0x2AB0, 0x2291,
-    0x2290, 0x2A90, 0x2A90, 0x2A90, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2A8F, 0x6AEA, 0x72E9, 0x8328, 0x5A05, 0x20C3, 0x4A05,
-    0x5205, 0x1084, 0x0004, 0x18A4, 0x49E5, 0x41C5, 0x0844, 0x0024,
-    0x1064, 0x3965, 0x72A7, 0x8307, 0x82C6, 0x82E6, 0x7AC6, 0x49A5,
-    0x0864, 0x0024, 0x0024, 0x0024, 0x0843, 0x2943, 0x6285, 0x7B06,
-    0x18A2, 0x5226, 0x5245, 0x3183, 0x2923, 0x18E4, 0x0003, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3163, 0x3163, 0x3164, 0x4165, 0x4147, 0x6209, 0x9B6C,
-    0xB40D, 0x7AA9, 0x7AE9, 0x3964, 0x2943, 0x3984, 0x3164, 0x3964,
-    0x3964, 0x3964, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3144,
-    0x2943, 0x2943, 0x3144, 0x3143, 0x2943, 0x2943, 0x3164, 0x3164,
-    0x3164, 0x3143, 0x51E5, 0x39A4, 0x49C4, 0x7286, 0x9327, 0x9307,
-    0x9327, 0x8B07, 0x8B07, 0x8B07, 0x8AE7, 0x82C6, 0x82C6, 0x8AE6,
-    0x8AE6, 0x8AE6, 0x8AE6, 0x8AE7, 0x62CA, 0x62CB, 0x62CA, 0x428D,
-    0x1A50, 0x1A70, 0x2250, 0x1A50, 0x2270, 0x2270, 0x2270, 0x2270,
-    0x2270, 0x2270, 0x2270, 0x2270, 0x22B1, 0x3352, 0x3B72, 0x3331,
-    0x3352, 0x3352, 0x3352, 0x3BB3, 0x3352, 0x3B93, 0x3352, 0x3B73,
-    0x3B93, 0x3352, 0x3B93, 0x3B52, 0x3B52, 0x3352, 0x3331, 0x3352,
-    0x3331, 0x3B72, 0x3331, 0x3352, 0x3B72, 0x3352, 0x3B93, 0x3352,
-    0x3B73, 0x3B73, 0x3332, 0x3352, 0x3311, 0x3352, 0x3332, 0x3352,
-    0x3B93, 0x3352, 0x3B93, 0x3373, 0x3B93, 0x3B73, 0x3352, 0x3B93,
-    0x3332, 0x3332, 0x3352, 0x3332, 0x3B73, 0x3B73, 0x3B93, 0x3B73,
-    0x3B93, 0x3B72, 0x3331, 0x3B72, 0x3332, 0x3352, 0x3331, 0x3332,
-    0x3352, 0x3352, 0x3B93, 0x3B72, 0x3B73, 0x3B73, 0x3352, 0x3B93,
-    0x3352, 0x3B93, 0x3352, 0x3352, 0x3372, 0x2B11, 0x3B72, 0x3332,
-    0x3352, 0x3352, 0x2AD1, 0x2290, 0x3B93, 0x3353, 0x3B93, 0x3BB3,
-    0x3372, 0x3BB3, 0x2290, 0x42EE, 0x5B0C, 0x4A48, 0x3163, 0x3984,
-    0x41E4, 0x5205, 0x4184, 0x20E4, 0x0003, 0x0003, 0x08C7, 0x224F,
-    0x2AB1, 0x2271, 0x2271, 0x2271, 0x2270, 0x52CC, 0x62CA, 0x62CB,
-    0x5ACB, 0x6AEA, 0x9B88, 0x7AA5, 0x49A4, 0x2924, 0x2904, 0x20C4,
-    0x18C4, 0x0864, 0x0024, 0x1084, 0x2904, 0x18C4, 0x0044, 0x0045,
-    0x0004, 0x1084, 0x3144, 0x28E3, 0x7286, 0x82E6, 0x51C5, 0x1084,
-    0x0004, 0x0044, 0x0844, 0x0004, 0x2924, 0x5A45, 0x6285, 0x4A04,
-    0x5205, 0x41C5, 0x20E3, 0x18E3, 0x3164, 0x2964, 0x18E4, 0x0844,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x41A4, 0x5A25, 0x51E5, 0x4126, 0x4126, 0x38E6, 0x5187,
-    0x932B, 0xC44E, 0xC44E, 0x7AC9, 0x41A5, 0x3163, 0x3984, 0x3164,
-    0x3163, 0x3164, 0x3144, 0x3143, 0x3144, 0x3164, 0x3164, 0x49C4,
-    0x59E5, 0x51E5, 0x49C4, 0x49A4, 0x49C5, 0x51C5, 0x3984, 0x3143,
-    0x3144, 0x3164, 0x3143, 0x3984, 0x3143, 0x41A4, 0x6266, 0x6245,
-    0x6245, 0x6245, 0x6225, 0x5A25, 0x6245, 0x82E6, 0x8AE6, 0x8AE6,
-    0x8AE6, 0x8AE6, 0x8B07, 0x8B07, 0x9327, 0x9326, 0x9B26, 0x7B08,
-    0x52CC, 0x52CC, 0x52AC, 0x52AC, 0x3A8E, 0x2270, 0x2290, 0x2B11,
-    0x2B11, 0x3332, 0x3353, 0x3353, 0x3353, 0x3332, 0x3BB3, 0x3311,
-    0x3352, 0x3352, 0x2B11, 0x3B93, 0x2B12, 0x3B73, 0x3332, 0x3372,
-    0x3B93, 0x3332, 0x43B4, 0x3332, 0x3B72, 0x3352, 0x2B11, 0x3B93,
-    0x2AF1, 0x3B72, 0x3331, 0x3332, 0x3BB3, 0x3332, 0x43D4, 0x3332,
-    0x3B73, 0x3B93, 0x3311, 0x3B72, 0x2AF1, 0x3B72, 0x3332, 0x3332,
-    0x3B93, 0x3332, 0x43D4, 0x3352, 0x3B73, 0x3352, 0x3312, 0x3B93,
-    0x3312, 0x3B73, 0x3352, 0x3352, 0x3B93, 0x3311, 0x3BB3, 0x3332,
-    0x3B93, 0x3B73, 0x3332, 0x3BB3, 0x2B11, 0x3B72, 0x3311, 0x3331,
-    0x3B73, 0x3312, 0x3BB3, 0x3352, 0x3B73, 0x3B73, 0x3332, 0x43D4,
-    0x3332, 0x3B73, 0x3332, 0x3332, 0x3B73, 0x2AF1, 0x3373, 0x2AF1,
-    0x3332, 0x3332, 0x2AD0, 0x2AD1, 0x3B73, 0x3332, 0x3B73, 0x3B73,
-    0x3332, 0x43B3, 0x3352, 0x4B6F, 0x7B8B, 0x5205, 0x0882, 0x3164,
-    0x2904, 0x3985, 0x18A4, 0x0003, 0x0024, 0x0024, 0x0003, 0x1109,
-    0x3A6C, 0x52CC, 0x52AC, 0x4AAC, 0x4AAC, 0x7AE8, 0x92E6, 0x8AE6,
-    0x9306, 0x8B06, 0x51E5, 0x2904, 0x0003, 0x0843, 0x20E5, 0x0004,
-    0x0004, 0x0004, 0x0024, 0x0024, 0x0004, 0x0004, 0x0024, 0x0024,
-    0x0844, 0x0004, 0x0003, 0x3944, 0x7A86, 0x8B07, 0x3104, 0x0003,
-    0x0044, 0x0024, 0x0004, 0x20E4, 0x3964, 0x5204, 0x5A45, 0x41A3,
-    0x6266, 0x3144, 0x18C3, 0x2924, 0x2944, 0x18E4, 0x1905, 0x0844,
-    0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0024, 0x0024,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x49E5, 0x7AC7, 0x8AE7, 0x51A5, 0x4986, 0x4146, 0x38E5,
-    0x4966, 0x9B6C, 0x9B4B, 0xBC4E, 0x8309, 0x4184, 0x3164, 0x3984,
-    0x49C4, 0x41C4, 0x41A4, 0x41A4, 0x4184, 0x3164, 0x3164, 0x6226,
-    0x7267, 0x6A26, 0x6A26, 0x7286, 0x7A86, 0x7AA7, 0x5A05, 0x4184,
-    0x3984, 0x3164, 0x3964, 0x3964, 0x3964, 0x3164, 0x3144, 0x3144,
-    0x3144, 0x3144, 0x3143, 0x3143, 0x49C4, 0x82C7, 0x82C6, 0x82C6,
-    0x82C7, 0x7AA6, 0x7A87, 0x7A87, 0x7A87, 0x7A87, 0x7AA7, 0x7AA7,
-    0x82C7, 0x82A7, 0x7A86, 0x7A66, 0x4A2A, 0x224F, 0x2B31, 0x3BF4,
-    0x43F4, 0x4351, 0x4330, 0x4351, 0x4B92, 0x4C76, 0x2B11, 0x4C14,
-    0x3352, 0x3352, 0x4434, 0x22B0, 0x4C55, 0x2AF1, 0x3BB3, 0x3BD3,
-    0x2B11, 0x4C75, 0x2AF1, 0x4415, 0x3372, 0x3372, 0x4414, 0x22B0,
-    0x4414, 0x2AD0, 0x3BB3, 0x3B93, 0x2B12, 0x4C75, 0x2AD1, 0x4C35,
-    0x3373, 0x3372, 0x4414, 0x22B0, 0x4434, 0x2AF1, 0x3BD3, 0x3BB3,
-    0x2AF1, 0x4C55, 0x22D0, 0x4414, 0x3352, 0x3332, 0x43F4, 0x22D1,
-    0x4C55, 0x2B12, 0x3BD3, 0x3BB3, 0x2AF1, 0x4434, 0x22B0, 0x43F4,
-    0x3372, 0x3372, 0x4414, 0x2AD1, 0x4C55, 0x2AD0, 0x3BB3, 0x3BB3,
-    0x2AD0, 0x4C35, 0x2AB0, 0x4C35, 0x3373, 0x3352, 0x4C35, 0x2AD1,
-    0x4C55, 0x2AF1, 0x3372, 0x3BB3, 0x2AF1, 0x4C55, 0x22D1, 0x43F4,
-    0x3332, 0x3331, 0x4434, 0x3352, 0x2290, 0x4414, 0x3332, 0x3352,
-    0x4C34, 0x2AD1, 0x4C13, 0x6B6D, 0x6288, 0x39C5, 0x2964, 0x2964,
-    0x1083, 0x0003, 0x0004, 0x0024, 0x0024, 0x0024, 0x20C5, 0x1883,
-    0x6226, 0x9327, 0x8AE6, 0x8B06, 0x8AE6, 0x82E6, 0x82E7, 0x82E7,
-    0x8AE6, 0x82C7, 0x20C3, 0x18A4, 0x20C4, 0x20C4, 0x1883, 0x0024,
-    0x0024, 0x0864, 0x0844, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0024, 0x0044, 0x2904, 0x72C7, 0x6A65, 0x7286, 0x3124, 0x0843,
-    0x0024, 0x0024, 0x1883, 0x6266, 0x4183, 0x3983, 0x72A5, 0x6A85,
-    0x3963, 0x41A4, 0x49E4, 0x41C4, 0x2104, 0x0045, 0x0045, 0x0865,
-    0x0844, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
-    0x0044, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0044, 0x0864,
-    0x3164, 0x3164, 0x3964, 0x3964, 0x3964, 0x3964, 0x3164, 0x3164,
-    0x3964, 0x3164, 0x4184, 0x7AC7, 0x7AC7, 0x82E7, 0x59E6, 0x4125,
-    0x4146, 0x3926, 0x3906, 0x932B, 0xC44F, 0x8B0A, 0x3123, 0x4184,
-    0x7287, 0x7AA7, 0x7AA7, 0x82C8, 0x6A67, 0x3144, 0x3946, 0x4126,
-    0x4126, 0x3906, 0x4145, 0x6A47, 0x7247, 0x7247, 0x7267, 0x7A87,
-    0x6A27, 0x3926, 0x4126, 0x4126, 0x4126, 0x4146, 0x4147, 0x4127,
-    0x4126, 0x3946, 0x3145, 0x49A5, 0x7247, 0x6A27, 0x6A27, 0x6A27,
-    0x7247, 0x59A6, 0x3906, 0x4106, 0x3906, 0x4106, 0x4106, 0x4126,
-    0x4126, 0x4106, 0x4126, 0x3947, 0x3126, 0x326C, 0x4414, 0x3BF3,
-    0x43F3, 0x31C9, 0x3146, 0x3947, 0x3A0A, 0x4C75, 0x4C55, 0x4C54,
-    0x4434, 0x43F4, 0x43F3, 0x43F3, 0x3BD3, 0x43F4, 0x4414, 0x4434,
-    0x4455, 0x4434, 0x4414, 0x4434, 0x4434, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434, 0x4434,
-    0x4414, 0x4414, 0x4434, 0x4434, 0x4414, 0x4414, 0x4434, 0x4434,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4435, 0x4434, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4434, 0x4434, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434, 0x4434, 0x4434,
-    0x4434, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414,
-    0x4414, 0x4414, 0x43F4, 0x3BF4, 0x4414, 0x3BF4, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4413, 0x734A, 0x4184, 0x18E3, 0x2123, 0x2964,
-    0x39A5, 0x10A4, 0x0024, 0x0024, 0x0004, 0x0864, 0x72C8, 0x8B07,
-    0x8B07, 0x8AE6, 0x8AE6, 0x8AE6, 0x8AE6, 0x82C6, 0x82E6, 0x82E6,
-    0x82E6, 0x8AE6, 0x8B07, 0x8B07, 0x8B07, 0x8B07, 0x6A46, 0x0023,
-    0x0023, 0x3985, 0x20E4, 0x0004, 0x0844, 0x0844, 0x0844, 0x0844,
-    0x0023, 0x20E4, 0x39A4, 0x3163, 0x3164, 0x3143, 0x3984, 0x2904,
-    0x0023, 0x1064, 0x72A6, 0x7AC5, 0x7AA5, 0x7286, 0x6245, 0x6245,
-    0x72A6, 0x7AC6, 0x49C4, 0x2943, 0x2124, 0x0885, 0x1086, 0x3128,
-    0x18A5, 0x0843, 0x0844, 0x0024, 0x0024, 0x0844, 0x0863, 0x0844,
-    0x0024, 0x0024, 0x0024, 0x0024, 0x0844, 0x0024, 0x1084, 0x3184,
-    0x3926, 0x3926, 0x3926, 0x3926, 0x3926, 0x3926, 0x3964, 0x3984,
-    0x3984, 0x3164, 0x3164, 0x3964, 0x3143, 0x7287, 0x8AE8, 0x8AE8,
-    0x6248, 0x0865, 0x1085, 0x51A7, 0x8ACA, 0xA36C, 0x7A8A, 0x3925,
-    0x4126, 0x4126, 0x4146, 0x4946, 0x4146, 0x4126, 0x4127, 0x4147,
-    0x4126, 0x3906, 0x3906, 0x3905, 0x38E5, 0x38E5, 0x38E5, 0x3905,
-    0x3906, 0x3906, 0x3906, 0x38E6, 0x3906, 0x3906, 0x38E6, 0x38E6,
-    0x38E6, 0x30E6, 0x3125, 0x3905, 0x38E6, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x3906,
-    0x3906, 0x3906, 0x3906, 0x6C32, 0x7536, 0x6D16, 0x6D37, 0x6D57,
-    0x6D57, 0x7536, 0x7516, 0x7536, 0x7557, 0x7598, 0x7577, 0x7DB8,
-    0x3B71, 0x096B, 0x11AC, 0x11AC, 0x11AC, 0x11CC, 0x1A4F, 0x3332,
-    0x4455, 0x4414, 0x2290, 0x3BD3, 0x4434, 0x4434, 0x3BD3, 0x2290,
-    0x43F4, 0x4414, 0x4434, 0x3352, 0x22B0, 0x4434, 0x4414, 0x4454,
-    0x2B11, 0x2B11, 0x4C55, 0x4434, 0x4454, 0x2AD0, 0x3B72, 0x4454,
-    0x4414, 0x43F4, 0x2290, 0x3BB3, 0x4414, 0x4414, 0x3BB3, 0x2290,
-    0x4414, 0x4434, 0x4454, 0x3372, 0x22B0, 0x4434, 0x3C13, 0x4434,
-    0x2B11, 0x2AF1, 0x4434, 0x4414, 0x4435, 0x22D1, 0x3372, 0x4455,
-    0x4414, 0x43F4, 0x2270, 0x3BB3, 0x4434, 0x4434, 0x3BD3, 0x2290,
-    0x4414, 0x4434, 0x4455, 0x3372, 0x22D0, 0x4414, 0x4414, 0x4435,
-    0x2AF1, 0x2AF1, 0x4435, 0x3BF4, 0x3BF4, 0x4414, 0x4413, 0x4414,
-    0x4414, 0x4413, 0x4413, 0x536F, 0x732A, 0x7308, 0x39C6, 0x10A4,
-    0x41C5, 0x3164, 0x3144, 0x18C4, 0x0004, 0x0024, 0x0843, 0x7286,
-    0x9347, 0x8B07, 0x8AE6, 0x8AE6, 0x8AE6, 0x8AE6, 0x82E6, 0x8AE6,
-    0x82E7, 0x82E7, 0x82E6, 0x82E6, 0x82E6, 0x8AE6, 0x7286, 0x3144,
-    0x3164, 0x41A5, 0x18A4, 0x1083, 0x3164, 0x3144, 0x3144, 0x3144,
-    0x3144, 0x3164, 0x3984, 0x3984, 0x3964, 0x3964, 0x3964, 0x3144,
-    0x4184, 0x6A86, 0x7AC5, 0x7AC6, 0x82E6, 0x51E5, 0x0843, 0x18A3,
-    0x7286, 0x49A3, 0x3143, 0x3164, 0x2944, 0x2124, 0x10A6, 0x0865,
-    0x49C6, 0x82E7, 0x5206, 0x0003, 0x0003, 0x5A06, 0x82E7, 0x49A6,
-    0x0003, 0x0844, 0x0024, 0x0004, 0x20E4, 0x3164, 0x3164, 0x3164,
-    0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4126, 0x3946, 0x3946,
-    0x3946, 0x3946, 0x3946, 0x3946, 0x3925, 0x4966, 0x51A6, 0x59C7,
-    0x51A7, 0x3127, 0x3127, 0x4147, 0x5187, 0x59A8, 0x5187, 0x4126,
-    0x4126, 0x38C5, 0x30C5, 0x38C5, 0x38C5, 0x38C5, 0x38E5, 0x30A5,
-    0x5B2E, 0x7CF5, 0x7494, 0x6C74, 0x6C73, 0x6453, 0x6C74, 0x6C74,
-    0x6C74, 0x6C73, 0x6C74, 0x6C73, 0x6C73, 0x6C73, 0x6C73, 0x6C73,
-    0x6C73, 0x6C73, 0x6C74, 0x6C74, 0x6C74, 0x6C74, 0x6C74, 0x6C74,
-    0x6C74, 0x6C74, 0x6C74, 0x6C73, 0x6473, 0x6474, 0x6C74, 0x6C73,
-    0x6C74, 0x6C74, 0x6C73, 0x32AE, 0x1A0B, 0x220B, 0x19EB, 0x19CA,
-    0x19CB, 0x19EB, 0x19CB, 0x226E, 0x3B93, 0x3B73, 0x3311, 0x3332,
-    0x2270, 0x2AB0, 0x3BB3, 0x3372, 0x3B92, 0x3B72, 0x3B93, 0x3BD3,
-    0x4434, 0x4414, 0x3BB3, 0x4414, 0x4434, 0x4434, 0x4414, 0x3BB3,
-    0x4414, 0x4434, 0x4434, 0x3BF4, 0x3BB3, 0x4414, 0x4414, 0x4434,
-    0x3BD3, 0x3BD3, 0x4434, 0x4434, 0x4434, 0x3BD3, 0x43F4, 0x4434,
-    0x4414, 0x4414, 0x3BB3, 0x43F4, 0x4414, 0x4414, 0x43F4, 0x3BB3,
-    0x4414, 0x4434, 0x4434, 0x43F4, 0x3BD3, 0x4414, 0x4414, 0x4434,
-    0x3BD3, 0x3BD3, 0x4414, 0x4414, 0x4434, 0x3BD3, 0x43F4, 0x4434,
-    0x4414, 0x4414, 0x3B93, 0x43F3, 0x4414, 0x4414, 0x4414, 0x3BB3,
-    0x4434, 0x4434, 0x4414, 0x43F4, 0x3BB3, 0x4414, 0x4414, 0x4414,
-    0x3BD3, 0x3BD3, 0x4414, 0x4414, 0x4414, 0x4414, 0x43D2, 0x636D,
-    0x734A, 0x734A, 0x734A, 0x7B6A, 0x8308, 0x51E5, 0x0864, 0x0004,
-    0x0843, 0x0863, 0x0843, 0x0024, 0x0024, 0x0024, 0x0003, 0x18A4,
-    0x18A3, 0x4985, 0x9327, 0x8B07, 0x9307, 0x9307, 0x9327, 0x7286,
-    0x41A4, 0x41A4, 0x4184, 0x41A4, 0x41A4, 0x41A4, 0x41A4, 0x3984,
-    0x3984, 0x18A3, 0x0003, 0x1083, 0x3984, 0x3163, 0x3164, 0x3143,
-    0x3143, 0x3143, 0x3143, 0x3963, 0x7286, 0x7286, 0x7266, 0x6A66,
-    0x6A86, 0x7285, 0x72A6, 0x28E4, 0x1044, 0x2904, 0x41C5, 0x6225,
-    0x7AC6, 0x4184, 0x2943, 0x3164, 0x3164, 0x3164, 0x1085, 0x4A07,
-    0x7AE7, 0x8AE6, 0x7286, 0x5A05, 0x6246, 0x82C7, 0x9327, 0x6246,
-    0x18C4, 0x0023, 0x2104, 0x2924, 0x3144, 0x3964, 0x3164, 0x3164,
-    0x4127, 0x4127, 0x4127, 0x4126, 0x4126, 0x4126, 0x4127, 0x4127,
-    0x4127, 0x4106, 0x38C5, 0x38C5, 0x38C5, 0x30C5, 0x30C5, 0x38C5,
-    0x38E5, 0x40E5, 0x40E5, 0x38E5, 0x38C5, 0x30A5, 0x30C5, 0x38C5,
-    0x30C5, 0x530D, 0x63D0, 0x5BB0, 0x5BB0, 0x5BB0, 0x5BB0, 0x5BB0,
-    0x434F, 0x3B0F, 0x3B0F, 0x3B0F, 0x330F, 0x330F, 0x330F, 0x330F,
-    0x330F, 0x330F, 0x330F, 0x330F, 0x330F, 0x32EF, 0x32EF, 0x32EF,
-    0x32EF, 0x32EF, 0x32EF, 0x330F, 0x330F, 0x330F, 0x330F, 0x330F,
-    0x32EE, 0x32CE, 0x32CE, 0x32CE, 0x32CE, 0x32CE, 0x32CE, 0x32CE,
-    0x32CE, 0x32EF, 0x32EF, 0x116A, 0x08E8, 0x00E8, 0x0908, 0x19CC,
-    0x11CC, 0x11CD, 0x11CC, 0x1A0E, 0x22D1, 0x3393, 0x2B52, 0x3352,
-    0x3373, 0x3BD4, 0x4455, 0x4434, 0x4434, 0x4435, 0x4434, 0x4434,
-    0x4414, 0x4434, 0x4434, 0x4434, 0x4434, 0x4434, 0x4434, 0x4434,
-    0x4434, 0x4434, 0x4414, 0x4434, 0x4434, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4434, 0x4414, 0x4434, 0x4434, 0x4434, 0x4434, 0x4434,
-    0x4414, 0x4414, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434, 0x4434, 0x4414,
-    0x4414, 0x4414, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434,
-    0x4434, 0x4414, 0x4414, 0x4434, 0x4434, 0x4414, 0x4414, 0x3C14,
-    0x4435, 0x4435, 0x3C14, 0x3C14, 0x4414, 0x5B8E, 0x6B4B, 0x7B07,
-    0x8AE6, 0x8AE6, 0x8AE6, 0x6224, 0x49C4, 0x3164, 0x2104, 0x51E6,
-    0x5206, 0x0843, 0x1064, 0x10A4, 0x0004, 0x0024, 0x18E4, 0x18C4,
-    0x1083, 0x2103, 0x51E5, 0x51E4, 0x5A05, 0x5A05, 0x5A25, 0x49E5,
-    0x3143, 0x3143, 0x3144, 0x3143, 0x3144, 0x3164, 0x3163, 0x3964,
-    0x3164, 0x20E3, 0x18C4, 0x2103, 0x2943, 0x2943, 0x2923, 0x5205,
-    0x6245, 0x6225, 0x6225, 0x6A45, 0x82C7, 0x8AC6, 0x82C6, 0x82C6,
-    0x7AC6, 0x7AA6, 0x7AC6, 0x51E5, 0x49A5, 0x5205, 0x6265, 0x7AC6,
-    0x3963, 0x3163, 0x2943, 0x3184, 0x3164, 0x18C5, 0x1086, 0x3146,
-    0x3945, 0x51C5, 0x8AE7, 0x8AE7, 0x6225, 0x5205, 0x5205, 0x49C4,
-    0x3144, 0x20E3, 0x3164, 0x3984, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x3906,
-    0x38E5, 0x49C9, 0x5B0E, 0x52ED, 0x52ED, 0x52ED, 0x52ED, 0x52ED,
-    0x530D, 0x530E, 0x530D, 0x52ED, 0x52ED, 0x52ED, 0x52ED, 0x52ED,
-    0x52ED, 0x4B90, 0x4BD1, 0x4BB1, 0x43B1, 0x4BB1, 0x43B1, 0x4BF2,
-    0x220B, 0x00E7, 0x0928, 0x0928, 0x0928, 0x0928, 0x0928, 0x0928,
-    0x0928, 0x0928, 0x0908, 0x0908, 0x0908, 0x0908, 0x0908, 0x0908,
-    0x0908, 0x0908, 0x0108, 0x0108, 0x0108, 0x0108, 0x0108, 0x00E7,
-    0x0949, 0x098B, 0x098B, 0x098B, 0x098B, 0x096A, 0x096A, 0x0908,
-    0x00A6, 0x00C7, 0x00C7, 0x0909, 0x11AB, 0x11ED, 0x1A2E, 0x2AF2,
-    0x2AF1, 0x2AF1, 0x2AF2, 0x22D1, 0x2B12, 0x4434, 0x4434, 0x4434,
-    0x4434, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434,
-    0x4434, 0x4434, 0x4434, 0x4434, 0x4434, 0x4414, 0x4414, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3C34, 0x4414, 0x53B0,
-    0x638E, 0x5B8E, 0x5BAE, 0x5BAE, 0x638E, 0x7B08, 0x8AE6, 0x82E6,
-    0x82E7, 0x82E6, 0x8307, 0x5205, 0x5204, 0x5A25, 0x6A85, 0x9347,
-    0x6246, 0x18A3, 0x2104, 0x2944, 0x1064, 0x10A3, 0x3164, 0x2963,
-    0x41C4, 0x51E5, 0x41A4, 0x49C4, 0x49C4, 0x49C4, 0x3984, 0x3143,
-    0x3164, 0x3143, 0x3143, 0x3143, 0x3143, 0x3143, 0x3163, 0x3163,
-    0x5205, 0x5A25, 0x5A25, 0x5A25, 0x51E5, 0x51E4, 0x51C4, 0x7AA6,
-    0x8AE7, 0x8AE7, 0x8AE7, 0x8AE7, 0x82C6, 0x82C6, 0x82A6, 0x82A6,
-    0x82C6, 0x7AA6, 0x51E4, 0x5205, 0x5225, 0x5245, 0x5225, 0x3165,
-    0x0863, 0x10A3, 0x2123, 0x2944, 0x18C5, 0x0045, 0x0866, 0x0025,
-    0x0004, 0x20C4, 0x6245, 0x5A25, 0x3163, 0x3143, 0x3163, 0x3164,
-    0x3164, 0x3984, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x4A2A, 0x422A, 0x422A, 0x422A, 0x422A, 0x420A, 0x420A, 0x422A,
-    0x41E9, 0x530E, 0x64D5, 0x6494, 0x6494, 0x6494, 0x5C94, 0x5C94,
-    0x5C94, 0x5C94, 0x5C94, 0x5C94, 0x5C94, 0x5C94, 0x6494, 0x6494,
-    0x64B5, 0x19EB, 0x00E7, 0x0908, 0x0907, 0x0907, 0x0908, 0x0908,
-    0x0948, 0x1189, 0x1189, 0x1189, 0x1189, 0x118A, 0x1169, 0x0949,
-    0x0949, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x118A, 0x11CB, 0x11CB, 0x11CB, 0x11AB, 0x118B,
-    0x1A4E, 0x2AF1, 0x2AD1, 0x2AF2, 0x2AF1, 0x22D1, 0x2AF1, 0x1A2E,
-    0x096A, 0x118A, 0x118A, 0x096A, 0x1A6F, 0x2B12, 0x22F1, 0x22D1,
-    0x22B1, 0x22B1, 0x2AF1, 0x2B12, 0x2B32, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4434, 0x4434, 0x4435, 0x4C13, 0x5BD0, 0x5BAF, 0x7B09,
-    0x8AC6, 0x8AE6, 0x8AE6, 0x8AE6, 0x8AE6, 0x8AE6, 0x8B07, 0x8AE6,
-    0x82E6, 0x82E6, 0x82E7, 0x8B07, 0x9327, 0x8B27, 0x8B07, 0x82C6,
-    0x3963, 0x3984, 0x49C4, 0x49C4, 0x49E5, 0x49C4, 0x41A4, 0x3963,
-    0x6245, 0x82E7, 0x82C6, 0x82C7, 0x7AA6, 0x82C7, 0x6245, 0x49C4,
-    0x49C4, 0x41A4, 0x4183, 0x3963, 0x41A4, 0x49C5, 0x49E5, 0x5205,
-    0x9348, 0xA369, 0x9328, 0x9307, 0x8AE7, 0x8AE7, 0x8AE7, 0x82C6,
-    0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82A6, 0x82A6,
-    0x82A6, 0x7AA6, 0x3143, 0x2103, 0x2103, 0x3144, 0x3165, 0x0044,
-    0x0045, 0x0004, 0x18C4, 0x18E4, 0x0025, 0x0045, 0x0025, 0x0864,
-    0x0844, 0x18C3, 0x3143, 0x3143, 0x3164, 0x3164, 0x3964, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x6D16, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CD6, 0x64F6, 0x64D5,
-    0x6D16, 0x3B2F, 0x0107, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948,
-    0x0948, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948, 0x0948,
-    0x0948, 0x1169, 0x1189, 0x1189, 0x1169, 0x1169, 0x1169, 0x1189,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x08E8, 0x0086,
-    0x00C7, 0x1169, 0x1169, 0x1149, 0x1149, 0x1149, 0x1149, 0x1149,
-    0x1169, 0x096A, 0x1A4E, 0x2AF1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22B0, 0x22B0, 0x22B1, 0x22B1, 0x22B1, 0x22B1, 0x22B0, 0x22B0,
-    0x22B0, 0x22B0, 0x22B1, 0x22D1, 0x22D1, 0x22B1, 0x22D1, 0x22D1,
-    0x22F1, 0x22D1, 0x3B93, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4414, 0x4434, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414,
-    0x4BF2, 0x4BF2, 0x53F2, 0x4BF2, 0x5B8E, 0x7AE7, 0x82E7, 0x82E7,
-    0x82E7, 0x82E7, 0x82E7, 0x82E7, 0x82E7, 0x8AE7, 0x8AE7, 0x8AE6,
-    0x8AE6, 0x8AE6, 0x8AE6, 0x8AE6, 0x82E6, 0x82E6, 0x82E6, 0x82E6,
-    0x82E7, 0x82E7, 0x82E7, 0x8AE7, 0x82E7, 0x82C7, 0x82C7, 0x82C7,
-    0x7AA6, 0x7AA6, 0x7AA6, 0x7AA6, 0x7AA6, 0x82A6, 0x82C6, 0x82C6,
-    0x82C6, 0x82E7, 0x82C7, 0x7285, 0x9B69, 0xB40C, 0xB3EC, 0xB3ED,
-    0xB3ED, 0xB40E, 0x934A, 0x82A6, 0x82E7, 0x82C6, 0x82C6, 0x82C6,
-    0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6,
-    0x82C6, 0x82A6, 0x7AA6, 0x7286, 0x7AC7, 0x49C6, 0x0004, 0x0845,
-    0x0045, 0x0045, 0x0044, 0x0045, 0x0845, 0x0865, 0x0845, 0x2924,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x11AA, 0x11AA, 0x11AA, 0x11AA, 0x11AA, 0x11AA, 0x11AA, 0x11AA,
-    0x11AA, 0x1189, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1189,
-    0x08E8, 0x00A6, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x0086, 0x00A6, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x1A4E, 0x22F1, 0x22D1, 0x22B1, 0x22D1, 0x22B1, 0x22B1,
-    0x22D1, 0x22D1, 0x22B1, 0x22B0, 0x22B0, 0x22B0, 0x22B0, 0x22B0,
-    0x2290, 0x2290, 0x2290, 0x22B0, 0x22B1, 0x22D1, 0x22B1, 0x22D1,
-    0x43F4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x3C14, 0x3BF4, 0x4414, 0x43F4, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434,
-    0x4C34, 0x4C34, 0x4434, 0x4434, 0x4414, 0x4414, 0x4414, 0x4BF2,
-    0x7309, 0x7AC7, 0x8308, 0x6267, 0x3144, 0x4984, 0x82E7, 0x8AE7,
-    0x82E7, 0x72A7, 0x7287, 0x8307, 0x8307, 0x8307, 0x8B07, 0x8B07,
-    0x8B07, 0x8B07, 0x8B07, 0x8AE7, 0x82E6, 0x82E7, 0x82E6, 0x82E6,
-    0x82E6, 0x82C6, 0x7AA6, 0x82A6, 0x82E7, 0x82E7, 0x82C6, 0x82C6,
-    0x82C6, 0x82C6, 0x7AC6, 0x7AA6, 0x82A6, 0x82A6, 0x82A6, 0x82A6,
-    0x82C6, 0x82C6, 0xABCB, 0xABAB, 0xABAB, 0xB3EC, 0x9B4B, 0x4966,
-    0x59A8, 0x28E6, 0x20A6, 0x59E7, 0x8AE7, 0x82C6, 0x82C6, 0x82C6,
-    0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x82C6,
-    0x82C6, 0x82C6, 0x7AC6, 0x4184, 0x3963, 0x20E4, 0x0024, 0x0845,
-    0x0845, 0x0024, 0x0024, 0x0024, 0x0864, 0x3185, 0x3165, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x1149, 0x1149, 0x1149, 0x1149, 0x1149, 0x1149, 0x1149, 0x1169,
-    0x1148, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1169, 0x1189, 0x0969, 0x00C7, 0x00C7, 0x00C7,
-    0x00A7, 0x0087, 0x0087, 0x0087, 0x0086, 0x0087, 0x0087, 0x0066,
-    0x08E8, 0x2A8F, 0x00A7, 0x0086, 0x00A6, 0x0086, 0x0087, 0x00A7,
-    0x0087, 0x228F, 0x22F2, 0x22B1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22B1, 0x2B11, 0x4C34, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x43F4, 0x4414, 0x2AF1, 0x22B0, 0x22B1, 0x22F1, 0x3BD4,
-    0x4414, 0x4434, 0x4414, 0x4414, 0x4414, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BD3, 0x5CB5, 0x7557,
-    0x7536, 0x7536, 0x7536, 0x6D36, 0x7557, 0x5CD5, 0x3BF4, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x6516, 0x4C34, 0x3BF4, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x3BF4, 0x3BF3, 0x5391, 0x41A9, 0x3147, 0x3968,
-    0x3967, 0x31A9, 0x64D5, 0x64F6, 0x6D57, 0x5BF2, 0x3988, 0x41C9,
-    0x4966, 0x4965, 0x5186, 0x4166, 0x49A5, 0x8307, 0x9327, 0x8B07,
-    0x8B27, 0x6A46, 0x4146, 0x5186, 0x5186, 0x5186, 0x5186, 0x51A6,
-    0x51A6, 0x51A6, 0x5186, 0x7247, 0x7A66, 0x7246, 0x7A87, 0x8B07,
-    0x8AE7, 0x82C6, 0xA36A, 0x7AA9, 0x30E5, 0x4146, 0x8B07, 0x8B07,
-    0x82C6, 0x82A6, 0x82C6, 0x7AA6, 0x82A6, 0x7A86, 0x82A6, 0x7AC6,
-    0x8AE7, 0xABCB, 0xBC4D, 0xBC2D, 0xBC2D, 0x930A, 0x3926, 0x1884,
-    0x1865, 0x28C6, 0x30E6, 0x59C6, 0x8AE7, 0x82C6, 0x82C6, 0x82C6,
-    0x82C6, 0x82C6, 0x82C6, 0x82C6, 0x8AE7, 0x8B07, 0x82C6, 0x8AE7,
-    0x7AA6, 0x4184, 0x4184, 0x3164, 0x3164, 0x3144, 0x2924, 0x2924,
-    0x2103, 0x72CA, 0x8B2C, 0x8B4C, 0x7AEB, 0x2945, 0x10A4, 0x3164,
-    0x3984, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1189, 0x1189, 0x0928, 0x08E7, 0x08E7, 0x08E7,
-    0x08E8, 0x08E7, 0x08E7, 0x08E8, 0x08E8, 0x0087, 0x0087, 0x0087,
-    0x00A7, 0x00A7, 0x0087, 0x0086, 0x0908, 0x00C7, 0x116A, 0x1A0E,
-    0x19CD, 0x118B, 0x00A7, 0x00A7, 0x00A7, 0x0086, 0x0086, 0x0066,
-    0x0065, 0x0909, 0x1A2E, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22B1, 0x22F1, 0x3393, 0x3372, 0x3372, 0x3372, 0x3372,
-    0x3372, 0x3372, 0x3372, 0x22F1, 0x2290, 0x2AF1, 0x3BD4, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4C34, 0x6D16, 0x6516, 0x6D16,
-    0x6D16, 0x6D16, 0x6D16, 0x6D16, 0x6D16, 0x6D16, 0x64D5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5475, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3C14,
-    0x3C14, 0x3BF4, 0x4434, 0x5CF6, 0x7557, 0x64F6, 0x5CD6, 0x5475,
-    0x3BF4, 0x43F4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x5CD6,
-    0x6516, 0x64F6, 0x64F6, 0x64D5, 0x6CB4, 0x63B0, 0x638F, 0x6BD0,
-    0x6BD0, 0x63F1, 0x7536, 0x7577, 0x63D1, 0x49C9, 0x38C5, 0x38C5,
-    0x30A5, 0x30C5, 0x30A5, 0x30C5, 0x4125, 0x61C5, 0x59A5, 0x59A5,
-    0x59A5, 0x4925, 0x30A5, 0x38C5, 0x38C5, 0x38C5, 0x38C5, 0x38C5,
-    0x38C5, 0x38C5, 0x38C5, 0x5166, 0x51A7, 0x5186, 0x5186, 0x59C6,
-    0x59E6, 0x59C6, 0x6A28, 0x59C8, 0x30C6, 0x3106, 0x3966, 0x51A6,
-    0x8B2A, 0xA389, 0x82C6, 0x82C6, 0x82A6, 0x82C6, 0x61E6, 0x59E5,
-    0x9328, 0xBC2E, 0x7249, 0x6A49, 0x7269, 0x51A7, 0x30E5, 0x51A6,
-    0x5186, 0x61E6, 0x6A07, 0x7A66, 0x8AE6, 0x8AE7, 0x8AE7, 0x8AE6,
-    0x8AE6, 0x8AE6, 0x8AE6, 0x82C6, 0x59C6, 0x51A6, 0x7A86, 0x7AA6,
-    0x49C5, 0x3164, 0x3144, 0x3164, 0x3143, 0x2902, 0x41A4, 0x8309,
-    0x82E9, 0xABEC, 0xC46F, 0xB3ED, 0x6209, 0x0884, 0x0045, 0x10A5,
-    0x3164, 0x3984, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x3164, 0x3164, 0x3164, 0x3184, 0x3164, 0x3164, 0x3164, 0x3164,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169,
-    0x1169, 0x1169, 0x0928, 0x0928, 0x00C7, 0x0087, 0x0086, 0x0087,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x0087, 0x00C8, 0x096A, 0x096A, 0x118B, 0x1A4F, 0x2312,
-    0x22B1, 0x096B, 0x00C8, 0x00A7, 0x00A7, 0x0086, 0x00C7, 0x118B,
-    0x118B, 0x0949, 0x1A0E, 0x22D1, 0x22B1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22D1, 0x22B1, 0x22B0, 0x22B0, 0x22B0, 0x2290, 0x2290,
-    0x2290, 0x2290, 0x2290, 0x2290, 0x2AF1, 0x3BB3, 0x4435, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4C55, 0x6D16, 0x6516, 0x6516,
-    0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x6CF6, 0x6D16, 0x4C54, 0x3BF4,
-    0x3C14, 0x3C14, 0x3C14, 0x3C14, 0x3BF4, 0x3C14, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x43F4, 0x3BF4, 0x4434, 0x54B5, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5CD5, 0x7577, 0x6D56, 0x7577, 0x7597, 0x6516,
-    0x5475, 0x5495, 0x4414, 0x3BF4, 0x3BF4, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x5CD6,
-    0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x5CF6, 0x6517, 0x5474, 0x5413,
-    0x5413, 0x5413, 0x5495, 0x5CD6, 0x4B2F, 0x39EA, 0x4A8C, 0x52ED,
-    0x52ED, 0x52CD, 0x52CD, 0x52CD, 0x52ED, 0x4ACD, 0x4ACD, 0x4AED,
-    0x4ACD, 0x4ACD, 0x52ED, 0x52ED, 0x52ED, 0x52ED, 0x52ED, 0x52ED,
-    0x52ED, 0x530D, 0x5B0E, 0x4167, 0x38C5, 0x38E5, 0x38C5, 0x30C5,
-    0x30C5, 0x30C5, 0x38C5, 0x3906, 0x4147, 0x4147, 0x1886, 0x30C6,
-    0x6A4A, 0x82C9, 0x6206, 0x6A26, 0x6206, 0x6206, 0x4125, 0x4125,
-    0x6A27, 0x728A, 0x3906, 0x38E6, 0x38E6, 0x38E6, 0x4146, 0x6207,
-    0x61E7, 0x59C6, 0x7266, 0x8AE7, 0x82A6, 0x6A26, 0x6A26, 0x6A26,
-    0x6A27, 0x6A26, 0x6A26, 0x61E6, 0x3905, 0x30E6, 0x59C6, 0x59E6,
-    0x3124, 0x3965, 0x3984, 0x3123, 0x51E6, 0x6247, 0x7AA8, 0xC42E,
-    0xBC2E, 0xBC2E, 0x934C, 0x6A29, 0x30E5, 0x1065, 0x0866, 0x0045,
-    0x18C5, 0x3144, 0x3984, 0x3964, 0x3164, 0x3164, 0x3164, 0x3984,
-    0x3984, 0x3984, 0x3984, 0x3964, 0x3164, 0x3184, 0x3164, 0x3164,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1148,
-    0x0928, 0x0928, 0x0928, 0x1128, 0x0928, 0x1169, 0x1149, 0x0928,
-    0x0948, 0x0928, 0x00A6, 0x0086, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0087, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x0086, 0x0929, 0x22D1, 0x120D, 0x22D1, 0x22F1, 0x22D1,
-    0x22D1, 0x226F, 0x00C8, 0x00A7, 0x00A7, 0x0086, 0x08E8, 0x228F,
-    0x226F, 0x22D0, 0x22D1, 0x22B1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22B1, 0x22B1, 0x22B1, 0x22D1, 0x3BB3, 0x4435, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4434, 0x4434, 0x4434, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4C54, 0x4C54, 0x4C54, 0x5495, 0x7597, 0x7577, 0x7577,
-    0x7577, 0x7577, 0x7577, 0x6D56, 0x7556, 0x6D56, 0x6D56, 0x7556,
-    0x7577, 0x7577, 0x4C74, 0x4C54, 0x4C74, 0x4434, 0x3BF4, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF3, 0x4414, 0x22AF, 0x11CC,
-    0x11ED, 0x1A0D, 0x3BD3, 0x3BF4, 0x4414, 0x4455, 0x4C95, 0x6D37,
-    0x5CD6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CD6, 0x5CD6,
-    0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6,
-    0x5CD6, 0x5CD6, 0x64F6, 0x4ACD, 0x4209, 0x422A, 0x420A, 0x422A,
-    0x422A, 0x4A6B, 0x49A9, 0x4106, 0x4126, 0x4127, 0x4127, 0x4127,
-    0x3906, 0x38E6, 0x3907, 0x3906, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x38E6, 0x38E5, 0x4126, 0x4126, 0x4127, 0x4126, 0x3906, 0x38E6,
-    0x30C5, 0x28A5, 0x51A6, 0x7287, 0x6207, 0x38E6, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x38E6, 0x38E6, 0x4126, 0x4126, 0x3906, 0x4106,
-    0x4126, 0x4126, 0x4146, 0x49A6, 0x934B, 0xC46F, 0xABED, 0x932B,
-    0x932B, 0x9B6C, 0x59C8, 0x30E6, 0x4147, 0x3927, 0x0865, 0x0866,
-    0x0046, 0x10A5, 0x2945, 0x2924, 0x3144, 0x3144, 0x2924, 0x2924,
-    0x2924, 0x2924, 0x2924, 0x3164, 0x3164, 0x3164, 0x3965, 0x3965,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x00C7,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x0086, 0x0948, 0x08E7, 0x0087,
-    0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00C7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x0086, 0x0929, 0x22B0, 0x22B1, 0x22B1, 0x22B1, 0x22F1,
-    0x1A6F, 0x00A8, 0x00A8, 0x00A7, 0x00A7, 0x00A7, 0x0086, 0x0066,
-    0x0086, 0x1A2E, 0x22D1, 0x22B1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22B1,
-    0x22B1, 0x22B1, 0x22D1, 0x3BD3, 0x4434, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414, 0x4434, 0x4434,
-    0x4434, 0x6D36, 0x7577, 0x7557, 0x7557, 0x6D56, 0x7556, 0x7576,
-    0x7556, 0x7557, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56,
-    0x7557, 0x7556, 0x7557, 0x7556, 0x7577, 0x5CD5, 0x4414, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434,
-    0x4435, 0x4434, 0x4414, 0x4414, 0x4414, 0x43F4, 0x4414, 0x3BD3,
-    0x226F, 0x224F, 0x1A6F, 0x1A4F, 0x1A4F, 0x1A4F, 0x1A4F, 0x1A2F,
-    0x1A4F, 0x2270, 0x2270, 0x2270, 0x224F, 0x224F, 0x224F, 0x224F,
-    0x224F, 0x224F, 0x1A2F, 0x5C74, 0x6D16, 0x6CF5, 0x64F6, 0x6CF6,
-    0x6CF6, 0x7D77, 0x532E, 0x3947, 0x4188, 0x3967, 0x3947, 0x3967,
-    0x4147, 0x4127, 0x4127, 0x4127, 0x4127, 0x4126, 0x4126, 0x4126,
-    0x4126, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126, 0x4126, 0x4126,
-    0x4126, 0x4126, 0x4106, 0x3906, 0x4106, 0x4126, 0x4126, 0x4126,
-    0x4106, 0x4106, 0x4106, 0x4126, 0x4106, 0x4126, 0x4126, 0x4126,
-    0x4126, 0x4126, 0x30C6, 0x934D, 0xB40E, 0xABCD, 0x8B2B, 0x38E5,
-    0x38E5, 0x38E5, 0x3906, 0x3927, 0x3927, 0x3907, 0x0866, 0x0866,
-    0x0866, 0x1066, 0x1065, 0x1085, 0x3106, 0x3126, 0x18A5, 0x0865,
-    0x1065, 0x1065, 0x1065, 0x3145, 0x3964, 0x3945, 0x4127, 0x3927,
-    0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x1169, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x0086, 0x116A, 0x226E, 0x0087, 0x00A7, 0x00A7,
-    0x0066, 0x1129, 0x19EC, 0x0108, 0x0109, 0x012A, 0x0109, 0x11CC,
-    0x2312, 0x228F, 0x00A7, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00C8,
-    0x228F, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22B1, 0x22D1, 0x22B1,
-    0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22B1, 0x22D1, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x43F4, 0x4C54, 0x7557,
-    0x6D56, 0x7556, 0x6D56, 0x7556, 0x7556, 0x7557, 0x7556, 0x7556,
-    0x7556, 0x7557, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7557, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D36,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x43F4, 0x4414, 0x43F4, 0x43F4, 0x3BF4, 0x43F4, 0x22B0,
-    0x2250, 0x2290, 0x2290, 0x2270, 0x2270, 0x2290, 0x2290, 0x2290,
-    0x2270, 0x2270, 0x2270, 0x118A, 0x0949, 0x11EB, 0x19EB, 0x19EB,
-    0x118A, 0x00E7, 0x4B70, 0x7D57, 0x6CD6, 0x6CD5, 0x64D5, 0x7516,
-    0x4A6C, 0x30C5, 0x3926, 0x3926, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x38E6, 0x30E6, 0x30E6, 0x38E6, 0x3906, 0x3906, 0x3906, 0x3906,
-    0x3906, 0x3906, 0x3906, 0x3906, 0x38E6, 0x30E6, 0x30E6, 0x30E6,
-    0x30E6, 0x3906, 0x4126, 0x4126, 0x4127, 0x4127, 0x4127, 0x4126,
-    0x4127, 0x4127, 0x4127, 0x4947, 0x4947, 0x4947, 0x4147, 0x4127,
-    0x4127, 0x18A6, 0x0865, 0x0865, 0x1066, 0x0866, 0x0845, 0x28E6,
-    0x3907, 0x3906, 0x3907, 0x3907, 0x1065, 0x0845, 0x28C6, 0x3927,
-    0x3927, 0x3927, 0x3927, 0x3926, 0x3926, 0x3926, 0x4127, 0x4126,
-    0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00C7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0087,
-    0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x0066, 0x11AB, 0x2AD0, 0x0087, 0x00A7, 0x00A7,
-    0x0086, 0x00C7, 0x00C7, 0x0086, 0x1A4E, 0x228F, 0x1A6F, 0x2290,
-    0x22F1, 0x22F1, 0x228F, 0x0908, 0x0087, 0x00A7, 0x00A7, 0x00C8,
-    0x0109, 0x1A6F, 0x22D1, 0x22B1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22B0, 0x22B0, 0x2290,
-    0x22D1, 0x3BD4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x3BF3, 0x5495, 0x6D16, 0x6D16, 0x7576,
-    0x7556, 0x7557, 0x6D57, 0x7556, 0x7556, 0x7557, 0x7557, 0x7557,
-    0x7557, 0x7557, 0x7557, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56,
-    0x6516, 0x4434, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BB3,
-    0x3BB3, 0x3BB3, 0x3BB3, 0x3BB3, 0x3BB3, 0x3BB3, 0x3BB3, 0x3BB3,
-    0x3BB3, 0x3B93, 0x3BB3, 0x3B92, 0x3BB2, 0x2A8E, 0x00A6, 0x00C7,
-    0x00A7, 0x0066, 0x1129, 0x19CB, 0x19AA, 0x19AA, 0x3310, 0x2AF1,
-    0x4BD2, 0x6C93, 0x6473, 0x6C94, 0x6C94, 0x6C74, 0x6C93, 0x6C94,
-    0x6C94, 0x6474, 0x6473, 0x6C74, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x6C94, 0x6CB4, 0x6CB4, 0x6CB4, 0x6C94, 0x6C94, 0x6C94, 0x6C94,
-    0x74F5, 0x5B4E, 0x3084, 0x38E5, 0x38C5, 0x38C5, 0x38C5, 0x38C5,
-    0x38C5, 0x38C5, 0x38E5, 0x3906, 0x4126, 0x3926, 0x4126, 0x4127,
-    0x4126, 0x3907, 0x3107, 0x3107, 0x30E7, 0x30E7, 0x30E6, 0x3906,
-    0x4127, 0x4126, 0x4126, 0x4126, 0x3106, 0x3107, 0x3927, 0x4127,
-    0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x3927,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0086, 0x0087, 0x00A7,
-    0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0087, 0x0066, 0x00A7,
-    0x0087, 0x00A7, 0x00A7, 0x00E8, 0x092A, 0x0067, 0x0067, 0x0087,
-    0x00A7, 0x0066, 0x00A7, 0x222E, 0x2B11, 0x22F1, 0x22F1, 0x22F1,
-    0x1A6F, 0x0929, 0x118A, 0x00C7, 0x0087, 0x00A7, 0x0909, 0x1A4F,
-    0x11ED, 0x2290, 0x22D1, 0x22B1, 0x22B1, 0x22B1, 0x22B1, 0x22B1,
-    0x22D1, 0x22D1, 0x22B1, 0x22B1, 0x22B0, 0x3372, 0x3393, 0x3373,
-    0x3393, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x43F4, 0x3BF4, 0x5495, 0x6D36, 0x7577, 0x7556, 0x7556,
-    0x7557, 0x7557, 0x7557, 0x7556, 0x7556, 0x7557, 0x7557, 0x7557,
-    0x7557, 0x6D57, 0x6D37, 0x6D36, 0x7557, 0x7557, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7557, 0x7556, 0x6D56, 0x6D56, 0x6D56,
-    0x7577, 0x5CD6, 0x54B6, 0x4C75, 0x33D4, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x33D4, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434,
-    0x4414, 0x4434, 0x4434, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4435, 0x224D, 0x19CB, 0x116A, 0x0086, 0x00A7,
-    0x00A7, 0x0087, 0x0066, 0x0025, 0x0004, 0x0004, 0x00C8, 0x1A4E,
-    0x3352, 0x43D3, 0x3BB3, 0x43D3, 0x43D3, 0x43D4, 0x43F4, 0x3B92,
-    0x32EF, 0x2AEF, 0x2ACF, 0x2A6D, 0x2A4C, 0x2A6D, 0x2A6D, 0x2A6D,
-    0x2A6D, 0x2A6D, 0x2A6D, 0x2A6D, 0x2A6D, 0x2A6D, 0x2A6D, 0x2A6D,
-    0x2A6D, 0x4B2F, 0x6C12, 0x63F2, 0x63F2, 0x63D1, 0x63D1, 0x63D1,
-    0x63F1, 0x63F2, 0x63B0, 0x4168, 0x38A5, 0x38E5, 0x38C5, 0x38E5,
-    0x4126, 0x4147, 0x4147, 0x4147, 0x4127, 0x4147, 0x4127, 0x4127,
-    0x3927, 0x3927, 0x4127, 0x4126, 0x4127, 0x4147, 0x4126, 0x4127,
-    0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127, 0x4127,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0087, 0x114A, 0x08E8, 0x0087,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0087, 0x0909, 0x118A, 0x0087,
-    0x00A7, 0x00A7, 0x0066, 0x00C8, 0x11AC, 0x11AC, 0x118B, 0x00C8,
-    0x0087, 0x0909, 0x19EC, 0x1A2E, 0x11CC, 0x228F, 0x22D1, 0x22D1,
-    0x226F, 0x0949, 0x0066, 0x0066, 0x00A7, 0x0087, 0x00E9, 0x1A2E,
-    0x2312, 0x22F2, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22B1, 0x22B1, 0x22D1, 0x3352, 0x2B52, 0x4414, 0x4435, 0x4434,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x5495, 0x4C75, 0x6D37, 0x6D57, 0x6D56, 0x7556, 0x7557,
-    0x7557, 0x7557, 0x7557, 0x7557, 0x7557, 0x7557, 0x7557, 0x7557,
-    0x6D57, 0x8556, 0xAD94, 0xA595, 0x7556, 0x6D57, 0x7556, 0x7557,
-    0x7556, 0x7556, 0x7557, 0x7557, 0x7557, 0x6D56, 0x6D56, 0x7556,
-    0x7D36, 0xA575, 0xADB5, 0x9D54, 0x8CB3, 0x94D3, 0x8CD3, 0x8CD3,
-    0x94F3, 0x6C94, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BD4, 0x3BF4,
-    0x43F4, 0x4414, 0x4435, 0x2A8E, 0x00A7, 0x0066, 0x08E7, 0x00C7,
-    0x00A7, 0x00A7, 0x0086, 0x1128, 0x2A4D, 0x222D, 0x19EC, 0x3B92,
-    0x2AF1, 0x1A2F, 0x1A4F, 0x1A4F, 0x1A70, 0x1A70, 0x1A91, 0x1A4F,
-    0x11CC, 0x11CC, 0x11CC, 0x0045, 0x0003, 0x0025, 0x0046, 0x0045,
-    0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045, 0x0045,
-    0x0005, 0x19CB, 0x53F3, 0x4BB1, 0x4BB1, 0x4BB2, 0x4BB2, 0x4BD2,
-    0x4BB2, 0x4BD2, 0x6D36, 0x534F, 0x52AC, 0x52CD, 0x52CD, 0x52CD,
-    0x3927, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6,
-    0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6,
-    0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6, 0x38E6,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x0087, 0x00A7, 0x08E8, 0x226F, 0x19CC, 0x00C8,
-    0x0087, 0x00A7, 0x0087, 0x00A7, 0x0066, 0x118B, 0x222D, 0x0086,
-    0x0087, 0x0086, 0x00A7, 0x1A0D, 0x2B32, 0x2290, 0x226F, 0x08E9,
-    0x0067, 0x118B, 0x226E, 0x00E9, 0x00E8, 0x1A4E, 0x22F1, 0x22D1,
-    0x22F1, 0x22F1, 0x094A, 0x0929, 0x00C7, 0x00E8, 0x0929, 0x012A,
-    0x22B1, 0x22D1, 0x22D1, 0x22B1, 0x22D1, 0x22D1, 0x22B1, 0x22B1,
-    0x22F1, 0x2AF1, 0x2B32, 0x4435, 0x4434, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x5C75, 0x9596, 0x9575, 0x9575, 0x9575, 0x8556, 0x6D57, 0x6D57,
-    0x7557, 0x7557, 0x7557, 0x7557, 0x7556, 0x7556, 0x7557, 0x6D56,
-    0x7D55, 0xBD93, 0xFE12, 0xF5F3, 0x9D54, 0x7556, 0x6D57, 0x7557,
-    0x7557, 0x7557, 0x7557, 0x7557, 0x7556, 0x7556, 0x6D56, 0x6D56,
-    0x8D35, 0xC593, 0xD5B3, 0xD5D3, 0xDDD3, 0xDDF4, 0xDDF4, 0xD5D3,
-    0xDE14, 0x9D55, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4434, 0x4C75, 0x4C55, 0x4C54, 0x4C54, 0x4C54, 0x4C34,
-    0x4414, 0x4414, 0x4414, 0x4C96, 0x2ACF, 0x0928, 0x08E7, 0x08E7,
-    0x0087, 0x00A7, 0x0045, 0x21CB, 0x53F3, 0x43D3, 0x4C76, 0x4455,
-    0x3352, 0x22D0, 0x2AD1, 0x2AD1, 0x22B1, 0x22B1, 0x22B1, 0x22D1,
-    0x2AF1, 0x2AF1, 0x2AF1, 0x118A, 0x1149, 0x0909, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00C7, 0x0087, 0x0046, 0x00A8, 0x00C8, 0x0066, 0x0025, 0x0026,
-    0x0025, 0x0065, 0x32CE, 0x5433, 0x5C53, 0x5453, 0x5C74, 0x6473,
-    0x4A4B, 0x4A0A, 0x4A0A, 0x420A, 0x420A, 0x4A0A, 0x4A0A, 0x4A0A,
-    0x420A, 0x420A, 0x4A0A, 0x4A0A, 0x4A2A, 0x4A2A, 0x4A2A, 0x4A2A,
-    0x4A0A, 0x4A2A, 0x4A2A, 0x4A0A, 0x4A2A, 0x4A0A, 0x420A, 0x4A0A,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x0087, 0x00C8, 0x224E, 0x228F, 0x22D0, 0x19EC,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00C8, 0x00C8, 0x00A8, 0x00C7,
-    0x0087, 0x0066, 0x19AB, 0x2B11, 0x1A6F, 0x0087, 0x00A7, 0x00A8,
-    0x00A7, 0x0087, 0x092A, 0x2B12, 0x2AF1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22D1, 0x22B0, 0x2AD0, 0x0949, 0x116A, 0x2AF1, 0x2AF1,
-    0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x3393, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x84B3, 0xF613, 0xF5F2, 0xF5F2, 0xFE12, 0xC5B3, 0x7535, 0x7D56,
-    0x7556, 0x6D57, 0x7557, 0x7557, 0x7557, 0x7557, 0x7557, 0x7536,
-    0xC5B3, 0xFDF2, 0xFDD1, 0xFDD1, 0xF5F2, 0x9D74, 0x7556, 0x7557,
-    0x7557, 0x7557, 0x7556, 0x7557, 0x7556, 0x7557, 0x7556, 0x7D56,
-    0x7D35, 0x7D35, 0x7535, 0x7536, 0x7536, 0x7515, 0x7535, 0x7536,
-    0x6D35, 0x6D36, 0x6D16, 0x4C54, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x3BF4, 0x5495, 0x7597, 0x7557, 0x7557, 0x7557, 0x7597, 0x64D6,
-    0x3BF4, 0x4414, 0x4414, 0x4414, 0x4C75, 0x32EF, 0x0086, 0x00A6,
-    0x0086, 0x0086, 0x0086, 0x0086, 0x0045, 0x00C7, 0x43D3, 0x4434,
-    0x43F4, 0x4414, 0x4414, 0x4414, 0x22D1, 0x22B1, 0x22D1, 0x22D1,
-    0x22D1, 0x22D1, 0x22D1, 0x2B11, 0x3B72, 0x222D, 0x0066, 0x00A7,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x0087, 0x0929, 0x2AF1, 0x2B12, 0x094A, 0x00A8, 0x00E8,
-    0x00C8, 0x0086, 0x0065, 0x08E7, 0x0907, 0x0927, 0x0927, 0x1169,
-    0x6CB4, 0x6CD6, 0x6CD5, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CD6, 0x6CD6,
-    0x6CD6, 0x6CD6, 0x6CD6, 0x6CF6, 0x6CD6, 0x6CD6, 0x6CD5, 0x6CD6,
-    0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CD6, 0x6CD6, 0x6CF6,
-    0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00C7, 0x1A2E, 0x22D0, 0x1A8F, 0x1A4E,
-    0x1A2D, 0x0087, 0x00A7, 0x0087, 0x19EC, 0x2B11, 0x22F1, 0x228F,
-    0x00A7, 0x0086, 0x00A6, 0x11AB, 0x2AF1, 0x228F, 0x00C8, 0x00A7,
-    0x0087, 0x118C, 0x2B32, 0x2B12, 0x22F1, 0x22F1, 0x22F1, 0x22D1,
-    0x22F1, 0x22D1, 0x0929, 0x00A7, 0x00A7, 0x00A6, 0x00A7, 0x00C8,
-    0x22B0, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22F1, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x43F4, 0x4414, 0x4414, 0x43F3, 0x7536, 0x6D36, 0x9D34,
-    0xF5F2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xF5D2, 0xEDF2, 0xDDD3,
-    0x7D35, 0x6D36, 0x7556, 0x7557, 0x7557, 0x7557, 0x7536, 0xCDB3,
-    0xFDF2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xF5F2, 0xA574, 0x6D36,
-    0x7556, 0x7556, 0x7557, 0x7556, 0x7557, 0x6D56, 0x8D55, 0xE5F3,
-    0xEDD2, 0xEDF3, 0xA574, 0x6D16, 0x7536, 0x7556, 0x7556, 0x7556,
-    0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x4414, 0x43F4, 0x43F4, 0x43F4,
-    0x43F4, 0x43F4, 0x43F4, 0x4414, 0x4414, 0x4413, 0x4413, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4C34, 0x3B30, 0x0066,
-    0x0086, 0x0086, 0x00A7, 0x0066, 0x0928, 0x43D3, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x43F4, 0x3BF4, 0x4414, 0x3373,
-    0x22B1, 0x22D1, 0x2B12, 0x094A, 0x00C8, 0x00C8, 0x0087, 0x00A7,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7,
-    0x0066, 0x0949, 0x2AD0, 0x22D1, 0x22F1, 0x22D1, 0x22B0, 0x2AD1,
-    0x222D, 0x0065, 0x00A6, 0x1128, 0x1148, 0x1148, 0x1168, 0x1168,
-    0x1189, 0x08C7, 0x0928, 0x11A9, 0x1148, 0x08C7, 0x08C7, 0x08C7,
-    0x08C7, 0x0928, 0x1189, 0x1169, 0x1189, 0x08E7, 0x08A6, 0x08C7,
-    0x08C7, 0x08C7, 0x08C7, 0x08C7, 0x08C7, 0x08C7, 0x08C7, 0x08C7,
-    0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x00A7, 0x0086, 0x00C8, 0x226F, 0x22B0, 0x2B11, 0x2B32, 0x224E,
-    0x08C8, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x11ED, 0x22F1, 0x092A,
-    0x00A8, 0x00A7, 0x00C7, 0x11AB, 0x2B12, 0x22D0, 0x00C8, 0x0087,
-    0x0087, 0x08E9, 0x094A, 0x092A, 0x22D1, 0x22F1, 0x22F1, 0x22F1,
-    0x22F1, 0x22D1, 0x226F, 0x08E8, 0x0086, 0x0066, 0x00A7, 0x1A2E,
-    0x22B1, 0x22D1, 0x22D1, 0x22B1, 0x2AF1, 0x3BD4, 0x4434, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x3C14, 0x4C54, 0x8576, 0x8556, 0x7D56,
-    0x7D56, 0x7D77, 0x8556, 0x7D56, 0x7516, 0x7D76, 0x6D36, 0xA554,
-    0xFDF1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xDDD3, 0xDDD3, 0x9575, 0x6D36, 0x6D57, 0x7535, 0xCDD4, 0xF5D2,
-    0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xEDD2, 0xDDD3,
-    0xBDB4, 0x6D36, 0x6D36, 0x7556, 0x6536, 0x9555, 0xE5D2, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xE5D2, 0xDDD3, 0xBDB4, 0x6D16, 0x7556, 0x7536,
-    0x6D56, 0x6D56, 0x7556, 0x6D56, 0x6D16, 0x64F6, 0x8536, 0x9D75,
-    0x9D75, 0x9D75, 0x9D75, 0x9D75, 0x9D75, 0x9D75, 0x9D75, 0x9575,
-    0x6D16, 0x6D16, 0x7536, 0x5CD5, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x43F4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4C35, 0x224D, 0x08E7, 0x0907, 0x00A6,
-    0x0907, 0x00C7, 0x0066, 0x21EC, 0x4C34, 0x4C55, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x43F4,
-    0x3BD3, 0x3B93, 0x094A, 0x0067, 0x0046, 0x0087, 0x00A7, 0x0087,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x0066,
-    0x19AB, 0x2AD0, 0x22D1, 0x22D1, 0x22D1, 0x22F1, 0x2AF1, 0x2AF1,
-    0x22D0, 0x1A0D, 0x0086, 0x00A6, 0x0928, 0x1168, 0x1148, 0x1148,
-    0x1148, 0x0927, 0x0928, 0x1168, 0x0907, 0x0066, 0x0086, 0x0086,
-    0x0086, 0x0086, 0x00C7, 0x1168, 0x1148, 0x0927, 0x0927, 0x00C7,
-    0x0046, 0x0086, 0x0086, 0x0086, 0x0086, 0x0087, 0x0086, 0x0086,
-    0x098B, 0x118B, 0x08E8, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00A7,
-    0x0066, 0x0909, 0x1A4E, 0x2B12, 0x2B12, 0x11CC, 0x114A, 0x08E8,
-    0x0045, 0x00A7, 0x00A7, 0x0086, 0x114A, 0x22D0, 0x2290, 0x0046,
-    0x00A8, 0x0087, 0x11CB, 0x22D0, 0x22F1, 0x22B0, 0x0087, 0x0086,
-    0x00A8, 0x0087, 0x00C8, 0x1A2E, 0x22F1, 0x22F1, 0x22F1, 0x22F1,
-    0x22F1, 0x22F1, 0x2B12, 0x08E8, 0x0045, 0x0908, 0x1A0D, 0x22D1,
-    0x22D1, 0x22B0, 0x2B52, 0x3BB3, 0x3BD3, 0x4434, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x64B5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x64B5, 0x5CB5, 0x64B5, 0xBDB4, 0xCDB3, 0xC5B3, 0xDDB2,
-    0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xDDD3, 0x9575, 0x7D35, 0xCDB3, 0xFDF2, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1,
-    0xF5F2, 0xC5B3, 0xC5B4, 0x7D35, 0x9575, 0xDDD3, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xF5F2, 0xBDB4, 0x7536, 0x6536,
-    0x6536, 0x6536, 0x6D36, 0x7556, 0x7556, 0x7577, 0x6CF5, 0x6C74,
-    0x6CB4, 0x6CB4, 0x74B4, 0x6CB4, 0x6CB4, 0x6CB4, 0x6CB4, 0x6CB4,
-    0x5475, 0x5495, 0x5495, 0x4C55, 0x4414, 0x4414, 0x4414, 0x4434,
-    0x3BF4, 0x3BD4, 0x3BD4, 0x3BF4, 0x3BF4, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x3310, 0x226D, 0x19EC, 0x0045,
-    0x08C7, 0x00A7, 0x0066, 0x114A, 0x220C, 0x19AB, 0x43F3, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4434, 0x4414, 0x2ACF, 0x2AAF, 0x2AD0, 0x118A, 0x0045, 0x00A7,
-    0x00A7, 0x0087, 0x0087, 0x00A7, 0x0087, 0x0087, 0x0087, 0x0086,
-    0x0908, 0x1A2D, 0x2B12, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D1,
-    0x22F1, 0x2B11, 0x1A2D, 0x00A7, 0x00A7, 0x0928, 0x1148, 0x1148,
-    0x1168, 0x1168, 0x1148, 0x1168, 0x1148, 0x0086, 0x00A7, 0x00A7,
-    0x00A7, 0x00C7, 0x0907, 0x08E7, 0x1148, 0x1168, 0x1168, 0x1148,
-    0x08E7, 0x0086, 0x00A6, 0x00A7, 0x0087, 0x0087, 0x00A7, 0x00A7,
-    0x096A, 0x098B, 0x00E8, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x0066,
-    0x0909, 0x226F, 0x2B52, 0x1A8F, 0x228F, 0x11CC, 0x116A, 0x11AB,
-    0x116A, 0x0086, 0x00A7, 0x0086, 0x116A, 0x2AD0, 0x2311, 0x11AC,
-    0x00A7, 0x0087, 0x118B, 0x228F, 0x2312, 0x22D0, 0x19EC, 0x00C7,
-    0x0086, 0x08E8, 0x1A0D, 0x2B32, 0x22F1, 0x22D1, 0x22D1, 0x22D1,
-    0x22D1, 0x22F1, 0x22F1, 0x19ED, 0x00A7, 0x116A, 0x2AF2, 0x22B0,
-    0x22B0, 0x2B11, 0x3BD3, 0x4455, 0x4434, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x3BF4, 0x3C14, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x43F4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x4414, 0x3C14, 0x4C14, 0x94D3, 0xF5D2, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xDDB2, 0xBD73, 0xFE12, 0xFDD1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFE12, 0xBD73, 0xDDB2, 0xFDF1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDF1, 0xFDF2, 0xAD73, 0xA574,
-    0xA574, 0xAD74, 0x9D75, 0x6D36, 0x6D56, 0x7556, 0x5CD5, 0x4C75,
-    0x4C55, 0x33D4, 0x3BD4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x3BF4,
-    0x6C73, 0x94D3, 0x8CB3, 0x8CB3, 0x8CD3, 0x4C33, 0x3C14, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x43F4, 0x4455, 0x4C96, 0x4BB1, 0x21CB,
-    0x0086, 0x0086, 0x00A6, 0x0066, 0x00A7, 0x1A0C, 0x43F4, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4455, 0x4C75, 0x4C96, 0x3B51, 0x1169, 0x0086,
-    0x00A7, 0x0087, 0x00A7, 0x0087, 0x0087, 0x0087, 0x0087, 0x0066,
-    0x0024, 0x00A7, 0x19ED, 0x22D1, 0x22D1, 0x22D1, 0x22D1, 0x22D0,
-    0x222D, 0x11ED, 0x2B52, 0x1A4E, 0x08E8, 0x00C7, 0x1169, 0x1148,
-    0x1148, 0x1148, 0x1168, 0x1148, 0x08E7, 0x0086, 0x00A7, 0x00A7,
-    0x0087, 0x0907, 0x1168, 0x00C7, 0x1148, 0x1148, 0x1148, 0x1168,
-    0x1148, 0x08C7, 0x0086, 0x0086, 0x00C7, 0x00C7, 0x0087, 0x0087,
-    0x0929, 0x00A7, 0x00A7, 0x00C7, 0x00A7, 0x00A7, 0x00A7, 0x08E8,
-    0x1A0D, 0x2B11, 0x1A8F, 0x11AB, 0x09AB, 0x2AF1, 0x3393, 0x3332,
-    0x222D, 0x0086, 0x00A7, 0x00A7, 0x0045, 0x116B, 0x3394, 0x2B52,
-    0x096B, 0x08E8, 0x0046, 0x094A, 0x2B32, 0x22F1, 0x2AD0, 0x0908,
-    0x0065, 0x1149, 0x2AD0, 0x22D0, 0x2B52, 0x2B52, 0x2B52, 0x2B52,
-    0x2B32, 0x22F1, 0x22F1, 0x2B33, 0x116A, 0x0929, 0x22D1, 0x22B0,
-    0x22F1, 0x3BF4, 0x4434, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4C34, 0x5475, 0x4C75, 0x4C75, 0x4C75, 0x4C75, 0x4C75,
-    0x4C55, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4,
-    0x4475, 0x5C94, 0x9CD2, 0xFE32, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF2, 0xFDF2,
-    0xFDF2, 0xFE11, 0xE5D3, 0x8D55, 0x7556, 0x6D56, 0x7557, 0x7D97,
-    0x6D36, 0x4C54, 0x4C75, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x5C33,
-    0xCD72, 0xFE32, 0xFE12, 0xFE12, 0xFE32, 0x94B2, 0x4413, 0x3BF4,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x3372, 0x32EF, 0x3ACD, 0x3AEF,
-    0x0907, 0x0086, 0x0086, 0x0066, 0x118B, 0x54B7, 0x4435, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x3351, 0x2AEF, 0x3330, 0x2A8E, 0x00C7,
-    0x00A7, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087, 0x1129,
-    0x1169, 0x0928, 0x118A, 0x2B11, 0x2B11, 0x2B11, 0x2B12, 0x2AD0,
-    0x19AA, 0x00E8, 0x228F, 0x2B11, 0x116A, 0x00A7, 0x0928, 0x0928,
-    0x1148, 0x1148, 0x1148, 0x08C7, 0x0066, 0x00A7, 0x00A7, 0x00A7,
-    0x0087, 0x08C7, 0x1148, 0x1168, 0x1148, 0x1148, 0x1148, 0x1148,
-    0x1168, 0x1148, 0x08C7, 0x00A7, 0x0908, 0x08E8, 0x0087, 0x00A7,
-    0x2AD0, 0x0929, 0x0908, 0x0928, 0x00A7, 0x00A7, 0x0087, 0x1A2D,
-    0x11CB, 0x0128, 0x098A, 0x11EC, 0x11CB, 0x22D0, 0x2B73, 0x1A2E,
-    0x0086, 0x00A7, 0x0086, 0x00A7, 0x0086, 0x11AB, 0x2B52, 0x22D0,
-    0x2B32, 0x118B, 0x0087, 0x11AB, 0x2B32, 0x22F1, 0x00E8, 0x0087,
-    0x00A6, 0x0086, 0x0969, 0x2B11, 0x4454, 0x4C95, 0x4C95, 0x4474,
-    0x3BF4, 0x22F1, 0x22F1, 0x2312, 0x094A, 0x114A, 0x2AF1, 0x22D0,
-    0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x3BF4, 0x5495, 0x7D98, 0x7577, 0x7577, 0x7577, 0x7577, 0x7577,
-    0x6D16, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4434, 0x4434, 0x5433,
-    0x4C13, 0x9D13, 0xFE12, 0xF5D1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xEDF2, 0x8D54, 0x7D55, 0x7D56, 0x7556,
-    0x7557, 0x7577, 0x7577, 0x4C54, 0x3BF4, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x53F2, 0xD593,
-    0xFE12, 0xF5D1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFE12, 0x8CB2, 0x43F3,
-    0x4414, 0x4414, 0x4414, 0x4C55, 0x222D, 0x0086, 0x0086, 0x0066,
-    0x0928, 0x00C7, 0x00A7, 0x00A7, 0x118A, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4434, 0x118A, 0x0086, 0x0086, 0x08E7, 0x1A2C,
-    0x00A7, 0x0087, 0x0087, 0x0087, 0x00A7, 0x0087, 0x0087, 0x3B51,
-    0x4C34, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4, 0x4434, 0x3372,
-    0x1A2D, 0x1A0C, 0x00A7, 0x0067, 0x0087, 0x00A7, 0x0086, 0x0086,
-    0x0948, 0x1168, 0x08C7, 0x0086, 0x00A7, 0x00A7, 0x00A7, 0x0087,
-    0x00A7, 0x0087, 0x00C7, 0x1148, 0x1148, 0x1148, 0x1148, 0x1148,
-    0x1148, 0x1148, 0x1168, 0x1169, 0x08E7, 0x0087, 0x00A7, 0x0087,
-    0x00C8, 0x00A7, 0x00A7, 0x00C7, 0x0928, 0x0928, 0x00A7, 0x00C7,
-    0x0066, 0x118A, 0x2B11, 0x22D0, 0x22F1, 0x2B12, 0x2B53, 0x3373,
-    0x2AB0, 0x0087, 0x0086, 0x2A6E, 0x2AF0, 0x2B31, 0x228F, 0x00A7,
-    0x00C8, 0x0087, 0x2A6E, 0x3393, 0x22F1, 0x2312, 0x2B32, 0x0909,
-    0x0045, 0x19CB, 0x4BF3, 0x3BD3, 0x3C14, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x3BF4, 0x2B32, 0x092A, 0x19CC, 0x4435, 0x3BF3,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x43F4, 0x3BF4, 0x4414, 0x3BF4, 0x3BF3, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x43F4, 0x3BF3, 0x5454, 0x7D36, 0x74F5, 0xC5B4,
-    0xEDD3, 0xEDD2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDD1, 0xFDF1, 0xEDF2, 0xEE13, 0xA574, 0x6D36,
-    0x7577, 0x6D56, 0x6D56, 0x4434, 0x3BF4, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x43F4, 0x5413, 0xDDB3, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xF612, 0xA513,
-    0x3BD3, 0x4434, 0x4414, 0x4414, 0x4434, 0x2A6D, 0x0045, 0x08C7,
-    0x1128, 0x00A7, 0x0949, 0x228E, 0x224D, 0x00C7, 0x43D3, 0x4434,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x3BD3, 0x3BB2, 0x43D3, 0x3310, 0x08E8,
-    0x00A7, 0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00A7,
-    0x2ACF, 0x4455, 0x3BF4, 0x3BF4, 0x3C14, 0x3C14, 0x3BF4, 0x3BF4,
-    0x3352, 0x11CB, 0x0087, 0x0087, 0x0087, 0x0929, 0x19AA, 0x0086,
-    0x1148, 0x1148, 0x1148, 0x1148, 0x1148, 0x1149, 0x00A7, 0x00A7,
-    0x0086, 0x08E7, 0x1168, 0x1168, 0x1168, 0x1148, 0x1168, 0x1168,
-    0x1168, 0x1168, 0x1168, 0x00C7, 0x0086, 0x00A7, 0x0087, 0x00A7,
-    0x00A7, 0x00A7, 0x00A7, 0x00C7, 0x0949, 0x0929, 0x00A7, 0x0066,
-    0x11AB, 0x2AF1, 0x2B52, 0x2B52, 0x2B32, 0x2B52, 0x11CC, 0x08E9,
-    0x0909, 0x00A7, 0x0087, 0x00E7, 0x0949, 0x1A6E, 0x3352, 0x228F,
-    0x08C7, 0x0046, 0x2AD0, 0x4455, 0x33B3, 0x33B3, 0x2312, 0x22B0,
-    0x116A, 0x0086, 0x11AA, 0x4414, 0x4414, 0x43F4, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x3BD4, 0x3B92, 0x3BD3, 0x4435, 0x4414,
-    0x3C14, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BF4, 0x4C75,
-    0x6D37, 0x6D37, 0x6D37, 0x6D16, 0x64F6, 0x7D36, 0xA595, 0x9D75,
-    0x9D75, 0x9575, 0x9576, 0x9576, 0xA595, 0xE614, 0xE5F3, 0xFE12,
-    0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xEDD2, 0xA574,
-    0x6536, 0x7557, 0x6D56, 0x6D16, 0x5475, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x33D3, 0x7493, 0xD5B3, 0xD592, 0xFDF1, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDF1, 0xF5D2,
-    0xAD33, 0x3BD3, 0x4414, 0x4414, 0x4414, 0x43D3, 0x2A8E, 0x0046,
-    0x0087, 0x00A8, 0x0066, 0x1A0C, 0x43F4, 0x3310, 0x43F4, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x3C14, 0x3BF4, 0x4455, 0x2AEF, 0x00E7, 0x0928,
-    0x00A7, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00A7, 0x00C8, 0x0026,
-    0x2A8E, 0x4C75, 0x3BF4, 0x4414, 0x4414, 0x3C14, 0x4455, 0x54D7,
-    0x6D58, 0x6CF6, 0x6CB5, 0x196A, 0x0066, 0x00A7, 0x0908, 0x1189,
-    0x1148, 0x1148, 0x1168, 0x1189, 0x1148, 0x00C7, 0x0025, 0x0086,
-    0x0086, 0x00C7, 0x0948, 0x1148, 0x1168, 0x1169, 0x08E7, 0x0086,
-    0x08E7, 0x1168, 0x1168, 0x1148, 0x08C7, 0x0087, 0x00A7, 0x00A6,
-    0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00E8, 0x00C8, 0x00A7, 0x19CC,
-    0x2B32, 0x22AF, 0x1149, 0x114A, 0x0929, 0x22B0, 0x228F, 0x1A0D,
-    0x19CC, 0x00A7, 0x00A7, 0x19EC, 0x224E, 0x22D0, 0x3373, 0x3352,
-    0x00A7, 0x0086, 0x0929, 0x3331, 0x6D37, 0x64F6, 0x5C95, 0x228E,
-    0x0909, 0x1149, 0x2AF0, 0x3BF4, 0x3BF4, 0x43F4, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x43F4, 0x4414, 0x4435, 0x4434, 0x4414, 0x4434,
-    0x5CD6, 0x64F6, 0x4C54, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4C55,
-    0x5CB5, 0x5495, 0x5495, 0x5495, 0x5495, 0x6495, 0x74D4, 0x74D4,
-    0x74B4, 0x74D5, 0x6C94, 0x5C74, 0x6CB4, 0xA574, 0xAD74, 0xA574,
-    0xA574, 0xA554, 0xA554, 0xA554, 0xA554, 0x9D54, 0xD5B2, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xE5D2,
-    0xA594, 0x6D36, 0x6D56, 0x7577, 0x5CB5, 0x43F4, 0x4414, 0x4414,
-    0x3BF4, 0x33B3, 0x7C93, 0xD592, 0xFE11, 0xFDF1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xF5D2, 0xA4F3, 0x43D3, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x3310,
-    0x116A, 0x00A7, 0x21CC, 0x3B92, 0x4414, 0x4435, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x3BF4, 0x3C14, 0x3B72, 0x220C, 0x00C7,
-    0x00A6, 0x0086, 0x0087, 0x0087, 0x00A7, 0x0087, 0x0046, 0x222D,
-    0x3BB3, 0x4435, 0x4414, 0x4414, 0x3BF4, 0x3BF4, 0x2ACF, 0x19EC,
-    0x2A8D, 0x32AE, 0x3ACE, 0x0909, 0x0087, 0x0086, 0x0087, 0x0908,
-    0x1148, 0x1168, 0x0907, 0x08C7, 0x00C7, 0x00C7, 0x5391, 0x1949,
-    0x0065, 0x0086, 0x00C7, 0x1168, 0x0907, 0x1168, 0x1128, 0x08E7,
-    0x0908, 0x1168, 0x1168, 0x1188, 0x08E7, 0x0087, 0x00A7, 0x00A7,
-    0x11AB, 0x00C8, 0x0087, 0x00A7, 0x00A7, 0x0087, 0x00A7, 0x19ED,
-    0x224E, 0x094A, 0x0086, 0x114A, 0x0929, 0x228F, 0x3373, 0x33B4,
-    0x2AF1, 0x0087, 0x00A7, 0x222D, 0x3352, 0x3373, 0x2B32, 0x2B31,
-    0x32AE, 0x08E7, 0x1149, 0x4BB1, 0x7D97, 0x7556, 0x7DB8, 0x118A,
-    0x0005, 0x2A8E, 0x6517, 0x5475, 0x5475, 0x4414, 0x3BF4, 0x3BF4,
-    0x3BF4, 0x43F4, 0x4414, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4434,
-    0x7577, 0x7597, 0x5CD5, 0x4434, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BD4,
-    0x3BF4, 0x33B4, 0x5C33, 0x7C92, 0x84B2, 0xA554, 0xA554, 0xA574,
-    0xA574, 0xA554, 0x9D74, 0x9D74, 0x9D74, 0x9D34, 0xD5B2, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDF1,
-    0xEDD2, 0x9D74, 0x6D36, 0x6D57, 0x5495, 0x43F4, 0x4414, 0x4C14,
-    0x84B3, 0x8492, 0xD572, 0xFDF1, 0xF5D1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xF5F2, 0x94B2, 0x4C13, 0x3BF4, 0x4414, 0x43F4, 0x3310,
-    0x116A, 0x0087, 0x21CB, 0x4392, 0x4434, 0x43F4, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4, 0x3BF4,
-    0x3BF4, 0x3BF4, 0x4414, 0x4C54, 0x4C54, 0x4C75, 0x43F3, 0x224D,
-    0x222C, 0x08E7, 0x0086, 0x0086, 0x0086, 0x00A7, 0x220C, 0x4435,
-    0x4C76, 0x43F4, 0x4414, 0x3BF4, 0x4C54, 0x5495, 0x3B30, 0x2A2C,
-    0x220C, 0x00A7, 0x0005, 0x0067, 0x00A7, 0x0087, 0x0087, 0x0086,
-    0x1148, 0x1168, 0x0908, 0x00A7, 0x0086, 0x08E8, 0x53B1, 0x1948,
-    0x0066, 0x0086, 0x00A6, 0x0928, 0x3AEE, 0x11A9, 0x0927, 0x1148,
-    0x1168, 0x1148, 0x0907, 0x0907, 0x00C7, 0x0087, 0x00A7, 0x00A7,
-    0x3352, 0x11AB, 0x00C7, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0066,
-    0x00E9, 0x00E8, 0x092A, 0x3373, 0x2B73, 0x2B52, 0x22B0, 0x228F,
-    0x1A0D, 0x0087, 0x00A7, 0x00E8, 0x226F, 0x3BB4, 0x3BD3, 0x3BD3,
-    0x7D98, 0x1148, 0x434F, 0x7DD8, 0x6D36, 0x6D56, 0x7557, 0x32CE,
-    0x08A7, 0x328D, 0x85D8, 0x7577, 0x7577, 0x5475, 0x4C34, 0x4C54,
-    0x4C34, 0x3BF4, 0x3BF4, 0x43F4, 0x4414, 0x4C34, 0x5475, 0x5475,
-    0x7557, 0x7556, 0x7577, 0x64F6, 0x4434, 0x4C54, 0x6C73, 0x6C53,
-    0x6C73, 0x5434, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x5C33, 0xC573, 0xFE32, 0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xF5F3, 0x9554, 0x9576, 0x6494, 0x3BF4, 0x3C14, 0x5413,
-    0xEDF3, 0xFE12, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFE13, 0x94D3, 0x4C13, 0x4435, 0x3B72, 0x0046,
-    0x00A7, 0x00A7, 0x0024, 0x1148, 0x3B71, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4434, 0x4C75, 0x4C75, 0x4C75, 0x4C75, 0x4C75, 0x4C75,
-    0x4C75, 0x4C55, 0x4414, 0x4C75, 0x5495, 0x4C95, 0x4C54, 0x43D3,
-    0x5476, 0x118A, 0x0066, 0x00A7, 0x0086, 0x00A7, 0x4371, 0x3B51,
-    0x43F3, 0x5495, 0x4C75, 0x5475, 0x7557, 0x7577, 0x7577, 0x7DD8,
-    0x6D36, 0x32EE, 0x21CB, 0x08C8, 0x0087, 0x0087, 0x0087, 0x00A7,
-    0x1148, 0x1168, 0x1149, 0x0908, 0x0086, 0x00A7, 0x0025, 0x0066,
-    0x00A6, 0x0086, 0x0087, 0x00C7, 0x6433, 0x32CD, 0x2A4C, 0x21EA,
-    0x0948, 0x1148, 0x0086, 0x0086, 0x0087, 0x0087, 0x0087, 0x00A7,
-    0x2B11, 0x3373, 0x11AB, 0x0086, 0x00A7, 0x00A7, 0x00A7, 0x0066,
-    0x226E, 0x226E, 0x00E9, 0x3332, 0x2B12, 0x2B73, 0x11AB, 0x0066,
-    0x00A7, 0x0086, 0x0087, 0x32F0, 0x3373, 0x4C34, 0x7D97, 0x7556,
-    0x7557, 0x1148, 0x3B0F, 0x7D97, 0x6D56, 0x7557, 0x6D56, 0x7DB8,
-    0x2A8D, 0x328D, 0x7DB8, 0x7536, 0x7556, 0x7557, 0x7556, 0x7577,
-    0x6516, 0x43F4, 0x4414, 0x4414, 0x43F4, 0x5C95, 0x7577, 0x7577,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7D36, 0x8D35, 0xEDF3, 0xFDF2,
-    0xFE12, 0xB512, 0x43F3, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x53F2, 0xD593, 0xFDF2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xF5F2, 0xFE13, 0x94D2, 0x4BF2, 0x5413, 0x6412,
-    0xEDB2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xF5D1, 0xFE12, 0x9CF2, 0x4C34, 0x3B92, 0x0928,
-    0x1988, 0x08C6, 0x00A6, 0x0086, 0x1149, 0x4C14, 0x4414, 0x4414,
-    0x3BF4, 0x5495, 0x7D97, 0x7577, 0x7577, 0x7577, 0x7577, 0x7577,
-    0x7577, 0x6D57, 0x4414, 0x3BF4, 0x43F4, 0x4455, 0x3331, 0x0087,
-    0x43B3, 0x116A, 0x0066, 0x00A6, 0x0086, 0x0086, 0x0086, 0x0045,
-    0x4B70, 0x7DB8, 0x7556, 0x7577, 0x7556, 0x7556, 0x6D36, 0x6D36,
-    0x6D16, 0x6CD5, 0x7516, 0x198A, 0x0066, 0x00A7, 0x0087, 0x00A7,
-    0x1148, 0x1189, 0x08E7, 0x0086, 0x0086, 0x0086, 0x00A7, 0x0086,
-    0x0086, 0x0087, 0x0087, 0x00A7, 0x0066, 0x53D2, 0x7D57, 0x4B70,
-    0x0907, 0x1148, 0x00A7, 0x0087, 0x0087, 0x0087, 0x0087, 0x0087,
-    0x2B32, 0x2B52, 0x118B, 0x0066, 0x00A7, 0x0087, 0x0087, 0x0086,
-    0x00A6, 0x00A7, 0x00A8, 0x00C8, 0x00C8, 0x22D0, 0x2B32, 0x3311,
-    0x2A8E, 0x0086, 0x08A7, 0x0066, 0x4370, 0x7D98, 0x7536, 0x7556,
-    0x7D97, 0x198A, 0x432F, 0x7DB8, 0x6D56, 0x7557, 0x7556, 0x6D56,
-    0x6D15, 0x7516, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x6D56, 0x6D36, 0x6D57, 0x4434, 0x5CB5, 0x7577, 0x6D56, 0x7556,
-    0x7556, 0x7556, 0x6D36, 0xA575, 0xEDF2, 0xE5D2, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDF2, 0xB553, 0x43D3, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x43F4, 0x4414, 0x4414, 0x5413,
-    0xD5B3, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF2, 0xFDF2, 0xEDF3, 0xE5F3, 0xE5F3, 0xEDF3,
-    0xF5F2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xF5F2, 0xB574, 0x4C34, 0x43D2,
-    0x32CD, 0x00A6, 0x2A4D, 0x4C14, 0x43D3, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4434, 0x4434, 0x4434, 0x4414, 0x4434, 0x4434,
-    0x4434, 0x4414, 0x4414, 0x4414, 0x43F4, 0x4455, 0x3351, 0x0087,
-    0x08E8, 0x00A7, 0x00A7, 0x00A6, 0x0086, 0x08C7, 0x6C94, 0x64D5,
-    0x6D15, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7536, 0x7597,
-    0x5412, 0x0065, 0x00A6, 0x0065, 0x0045, 0x0066, 0x00A7, 0x00A7,
-    0x1148, 0x1169, 0x08E7, 0x0086, 0x00A6, 0x00A7, 0x00A7, 0x0086,
-    0x0087, 0x0087, 0x0087, 0x0087, 0x00A7, 0x00C7, 0x1148, 0x1168,
-    0x1148, 0x1148, 0x1168, 0x00C7, 0x0087, 0x0087, 0x00A7, 0x00A7,
-    0x2B32, 0x2B73, 0x3332, 0x19CC, 0x0045, 0x00A7, 0x00A6, 0x0045,
-    0x19EC, 0x2B11, 0x22B0, 0x22B0, 0x22B0, 0x2B32, 0x3373, 0x224E,
-    0x00C7, 0x08A7, 0x0066, 0x432F, 0x6D16, 0x7577, 0x7556, 0x7556,
-    0x7D97, 0x1149, 0x432F, 0x7DB8, 0x6D36, 0x7556, 0x6D56, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x6D16, 0x6D36, 0x7577, 0x7556, 0x7556,
-    0x7556, 0xC5D4, 0xE5F3, 0xEDF3, 0xFE12, 0xFDF2, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xF5D2, 0xC553, 0x43F3, 0x33D3, 0x3BD3, 0x3BF4,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x3BD4, 0x5413, 0xD592,
-    0xFDD2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF2, 0xFDF2,
-    0xFDF2, 0xFDF2, 0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF2, 0xFDF2, 0xFDF1,
-    0xFDF1, 0xFDF2, 0xFDF1, 0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF2,
-    0xFDF2, 0xFDF2, 0xFDF2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xF5D2, 0x9534, 0x8D34, 0x8D34, 0x8D34, 0x9534, 0x9534,
-    0x8D34, 0x8D34, 0x8D34, 0x8534, 0xAD73, 0xFE12, 0xFDF1, 0xFDF1,
-    0xFE12, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFE12, 0xC573, 0x4414, 0x3B72,
-    0x08E7, 0x0086, 0x00A7, 0x224D, 0x4C55, 0x43F4, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x43F4,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4435, 0x43D3,
-    0x1169, 0x0908, 0x00A7, 0x0087, 0x0086, 0x00A7, 0x1989, 0x64F5,
-    0x75B8, 0x6D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7557, 0x7557,
-    0x6D16, 0x6494, 0x6494, 0x6474, 0x6CD5, 0x430F, 0x0046, 0x00C7,
-    0x1148, 0x1189, 0x08E7, 0x0086, 0x0086, 0x0025, 0x0025, 0x0086,
-    0x0086, 0x08C7, 0x1148, 0x1148, 0x1149, 0x00A6, 0x0086, 0x00A6,
-    0x08E7, 0x1168, 0x00C7, 0x00A7, 0x0087, 0x00A7, 0x0087, 0x0025,
-    0x3373, 0x1A0D, 0x118B, 0x1A0D, 0x220C, 0x0086, 0x0086, 0x1149,
-    0x118A, 0x228E, 0x33B4, 0x2B73, 0x2B73, 0x2B53, 0x2B32, 0x22B0,
-    0x19AB, 0x0045, 0x0065, 0x5C53, 0x7DB8, 0x7556, 0x7556, 0x7556,
-    0x7D77, 0x53D1, 0x6494, 0x7577, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x6D56, 0x7556, 0x7556, 0x6D36, 0x6D57, 0x6D57, 0x6D57,
-    0x6D57, 0x6D56, 0x6D56, 0x6D57, 0x6556, 0x6536, 0x6537, 0x6537,
-    0x6536, 0x9555, 0xAD74, 0xA554, 0xA554, 0xAD73, 0xF5F2, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF2, 0xB532, 0xAD12, 0xB533, 0x7C93,
-    0x33B4, 0x3BF4, 0x4414, 0x4414, 0x33D4, 0x5C33, 0xC552, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFE12, 0xFDF1, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xF50E, 0xF4AE, 0xF4CE, 0xF4CE, 0xF4CE,
-    0xF4AD, 0xF4AD, 0xF4AD, 0xF4AD, 0xF4AD, 0xF4CE, 0xF4AE, 0xFDB1,
-    0xFE12, 0xFDF1, 0xFDF1, 0xFDF1, 0xF4EE, 0xF4CE, 0xF4CE, 0xF4CE,
-    0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE, 0xF4CE,
-    0xF4AE, 0xF48D, 0xFD70, 0xFDF2, 0xFDF2, 0xFDF2, 0xFDF2, 0xFDF1,
-    0xFDF2, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xF5D2, 0xC593, 0xBD94, 0xBD94, 0xBD94, 0xBD94, 0xBD94,
-    0xBD94, 0xBD94, 0xBD94, 0x8D55, 0x64F5, 0x9D54, 0x9D54, 0x9D54,
-    0x9534, 0xC573, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xEDD2, 0x94F3, 0x2331,
-    0x226D, 0x08E8, 0x198B, 0x3351, 0x4435, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x43F4, 0x4455, 0x43F4, 0x1A0C,
-    0x0928, 0x0928, 0x0928, 0x0908, 0x0087, 0x0025, 0x0004, 0x1969,
-    0x5432, 0x7577, 0x6D56, 0x7556, 0x7556, 0x7557, 0x7557, 0x7577,
-    0x6494, 0x2A2B, 0x2A2C, 0x326C, 0x3AAE, 0x220B, 0x08C7, 0x00C7,
-    0x1169, 0x0908, 0x00C7, 0x0066, 0x1108, 0x430F, 0x4B70, 0x1128,
-    0x0066, 0x00C7, 0x08E8, 0x08E8, 0x0907, 0x0907, 0x00A6, 0x0066,
-    0x00A6, 0x08E7, 0x0908, 0x00A7, 0x00A7, 0x0066, 0x1129, 0x5391,
-    0x22D0, 0x096A, 0x0066, 0x094A, 0x222D, 0x00A7, 0x00A7, 0x19AB,
-    0x00A7, 0x00A7, 0x224E, 0x2B32, 0x2B32, 0x2312, 0x3BB3, 0x4C55,
-    0x4C13, 0x326C, 0x0086, 0x5412, 0x7597, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7DB7, 0x7577, 0x7556, 0x7556, 0x7556, 0x6D56, 0x7556,
-    0x7556, 0x7556, 0x6D56, 0x7556, 0xA594, 0xAD94, 0xAD94, 0xAD94,
-    0xAD94, 0xAD94, 0xAD94, 0xAD94, 0xAD74, 0xA574, 0xA574, 0xA574,
-    0xAD74, 0xA554, 0x9D54, 0xA554, 0xA554, 0xAD73, 0xF5F2, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFE12, 0xD572,
-    0x8CB2, 0x84B3, 0x43F4, 0x3BF4, 0x6433, 0xBD52, 0xFE12, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xFD90, 0xF4EE, 0xF50F, 0xF50F, 0xF52F, 0xF52F, 0xF50F,
-    0xFD2F, 0xFD2F, 0xFD2F, 0xF44C, 0xF3EB, 0xF40B, 0xF40B, 0xF40B,
-    0xF4AE, 0xF4CE, 0xF4AD, 0xF4AD, 0xF48D, 0xF3EB, 0xF3CB, 0xF4CE,
-    0xFD2F, 0xFD2F, 0xFD2F, 0xFD0F, 0xF40C, 0xF40B, 0xF40B, 0xF3EB,
-    0xF3EB, 0xF3EB, 0xF3EB, 0xF3EB, 0xF3EB, 0xF3EB, 0xF3EB, 0xF3EB,
-    0xF4AE, 0xF4CE, 0xFD90, 0xFDB1, 0xF50F, 0xFD2F, 0xF52F, 0xF52F,
-    0xF50F, 0xFD70, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF2, 0xFDF2, 0xFDF2,
-    0xFDF2, 0xFDF1, 0xFE12, 0xFE12, 0xFDF1, 0xFDF1, 0xFE11, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFE11, 0xDDB2, 0x9D34, 0x9D54, 0x9D54, 0x9D34,
-    0x9534, 0xC573, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xE5B1, 0x7452,
-    0x4414, 0x0109, 0x22AF, 0x4C96, 0x43F4, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x3BF4, 0x3BF4, 0x3BF4, 0x4414, 0x3372, 0x224D, 0x2A8D,
-    0x32EE, 0x19EA, 0x1148, 0x08E8, 0x0908, 0x3ACE, 0x328D, 0x29EA,
-    0x5412, 0x7597, 0x6D56, 0x7556, 0x7556, 0x7557, 0x7556, 0x7577,
-    0x6494, 0x21EA, 0x2A0B, 0x0065, 0x0004, 0x0086, 0x0948, 0x00A7,
-    0x0908, 0x00A7, 0x00A7, 0x0066, 0x19AA, 0x8598, 0x4350, 0x1108,
-    0x0087, 0x00A7, 0x0087, 0x00A7, 0x432F, 0x19C9, 0x00A6, 0x0086,
-    0x0086, 0x0087, 0x0928, 0x00C7, 0x00A7, 0x0066, 0x1129, 0x5BF2,
-    0x1A4E, 0x228F, 0x116A, 0x0066, 0x0087, 0x00A7, 0x00A7, 0x0087,
-    0x0909, 0x1129, 0x1169, 0x3332, 0x3B93, 0x3372, 0x5CB5, 0x7D97,
-    0x7577, 0x7D57, 0x08C7, 0x5432, 0x7597, 0x7536, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7557,
-    0x7557, 0x7556, 0x6D57, 0x7D56, 0xD5D3, 0xE5D3, 0xDDD3, 0xDDD3,
-    0xDDD3, 0xDDD3, 0xDDD3, 0xDDD3, 0xDDD3, 0xDDD3, 0xDDD3, 0xDDD3,
-    0xDDB3, 0xFDF1, 0xFDF1, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1,
-    0xFE32, 0xF5F3, 0x7C72, 0x6432, 0xC552, 0xFE12, 0xF5D1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDF1, 0xF52F, 0xF42C, 0xF44C, 0xF44C, 0xF40B, 0xF3EB, 0xF3EB,
-    0xF3EB, 0xF3EB, 0xF3EB, 0xF40B, 0xF40B, 0xF42B, 0xF40B, 0xF42C,
-    0xFD90, 0xFD91, 0xFDD1, 0xFE12, 0xFDD1, 0xF4AD, 0xF48D, 0xF46D,
-    0xF42C, 0xF40B, 0xF40B, 0xF3EB, 0xF40C, 0xF40C, 0xF40B, 0xF40B,
-    0xF40B, 0xF40B, 0xF40B, 0xF46D, 0xF48D, 0xF48D, 0xF48D, 0xF4AE,
-    0xFD70, 0xFD91, 0xFD90, 0xF4CE, 0xF3EB, 0xF40B, 0xF3EB, 0xF40B,
-    0xF3EB, 0xF48D, 0xFD91, 0xFD70, 0xFD70, 0xFD70, 0xFD70, 0xFD70,
-    0xFD70, 0xFD70, 0xF570, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDF1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFE12, 0xFE12, 0xFE12, 0xFE11,
-    0xFE12, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xF5D1, 0xFDD1, 0xF5F2,
-    0x7C52, 0x424B, 0x3B10, 0x3C35, 0x3C14, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x3C14, 0x3BF4, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4C54, 0x4C54, 0x4434, 0x54D6, 0x3B50, 0x21EA, 0x7DB8,
-    0x7DD8, 0x2A8D, 0x00C7, 0x0066, 0x196A, 0x6CD5, 0x7D97, 0x7DB8,
-    0x7577, 0x6D56, 0x7556, 0x7556, 0x6D56, 0x7556, 0x7557, 0x7557,
-    0x7577, 0x7DB8, 0x85D8, 0x328D, 0x218A, 0x1189, 0x0928, 0x00C7,
-    0x0086, 0x00A7, 0x00A7, 0x0066, 0x1149, 0x53D1, 0x1969, 0x00A7,
-    0x0087, 0x00A7, 0x0086, 0x00C7, 0x5C12, 0x21EA, 0x00A6, 0x0086,
-    0x0087, 0x00A7, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x0086, 0x0025,
-    0x3BD3, 0x43F4, 0x19CB, 0x0066, 0x08C7, 0x00A7, 0x00C7, 0x0087,
-    0x2A8F, 0x3BD4, 0x3B73, 0x3BB3, 0x6D36, 0x7557, 0x6D56, 0x6D36,
-    0x7557, 0x7515, 0x08E8, 0x5C33, 0x7D97, 0x6D56, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7557, 0x7557, 0x7557, 0x7557,
-    0x7556, 0x7556, 0x6D56, 0x6D56, 0x6D36, 0x6D16, 0x6D36, 0x7536,
-    0x7536, 0x7536, 0x7536, 0x7D35, 0x7D15, 0x7D15, 0x7D15, 0x7D15,
-    0x7CF4, 0xDDB2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF2, 0xF5F2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xF48D, 0xF42C, 0xF44C,
-    0xF44C, 0xF44C, 0xF44C, 0xF42C, 0xF42C, 0xF44C, 0xF44C, 0xF42C,
-    0xF40B, 0xEBEB, 0xF50E, 0xFDD1, 0xFDB1, 0xFDD1, 0xFDB1, 0xFDD1,
-    0xF4CE, 0xF40B, 0xF42C, 0xF40B, 0xF40B, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xEC0B, 0xFD50, 0xFDF2, 0xFDD1, 0xFDD2, 0xFDB1,
-    0xF44C, 0xF40B, 0xF40B, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF42C,
-    0xEC4C, 0xEC4C, 0xEC4C, 0xFD90, 0xFDD1, 0xFDB1, 0xFDB1, 0xFDB1,
-    0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1,
-    0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB0, 0xFDB1, 0xFDB1, 0xFDB1,
-    0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDD1, 0xFDB1, 0xF5D1,
-    0xF5D2, 0xFE33, 0x94D3, 0x43F3, 0x4C13, 0x4414, 0x4414, 0x4414,
-    0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414, 0x4414,
-    0x4C74, 0x7577, 0x7557, 0x7557, 0x6D56, 0x7557, 0x7557, 0x6516,
-    0x6D16, 0x1989, 0x0066, 0x08C7, 0x0087, 0x00C7, 0x6CF5, 0x7556,
-    0x6D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7577,
-    0x7556, 0x6CF5, 0x6CF5, 0x7516, 0x7D57, 0x432F, 0x00C6, 0x1148,
-    0x00A6, 0x00A7, 0x00A7, 0x00A7, 0x0087, 0x1149, 0x8598, 0x21CB,
-    0x0066, 0x00A7, 0x0086, 0x00A6, 0x0927, 0x1168, 0x11A9, 0x0927,
-    0x0086, 0x00A7, 0x00A7, 0x00A7, 0x00A6, 0x00A7, 0x00A7, 0x00A7,
-    0x3BD3, 0x1169, 0x0065, 0x0086, 0x0087, 0x00A7, 0x08C8, 0x0066,
-    0x224E, 0x3393, 0x3BB3, 0x6D36, 0x6D56, 0x7556, 0x7556, 0x7556,
-    0x7577, 0x7516, 0x00C7, 0x5C33, 0x7D97, 0x6D56, 0x7556, 0x7556,
-    0x6D56, 0x7556, 0x7556, 0x7557, 0x7557, 0x7557, 0x7557, 0x7556,
-    0x7556, 0x7556, 0x7557, 0x7556, 0x6D56, 0x6D57, 0x6D36, 0x6D36,
-    0x6D36, 0x7536, 0x7536, 0xCDD4, 0xEDF3, 0xEDF3, 0xEDF3, 0xEDD3,
-    0xEDD2, 0xF5D1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDB0, 0xFDB0, 0xFDB0,
-    0xFDB0, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB1, 0xFDB0, 0xFDB1, 0xFD90,
-    0xF42C, 0xF40C, 0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C, 0xF44C,
-    0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40B, 0xFD70, 0xFDF1, 0xFDB1,
-    0xFDB1, 0xFDB1, 0xFDB1, 0xF48D, 0xF42C, 0xF44C, 0xF44C, 0xF44C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40B, 0xF42B, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40B, 0xF4EE,
-    0xFDF2, 0xFDD2, 0xFDD1, 0xFDF2, 0xF4EE, 0xF40B, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF44C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF44C, 0xF44C, 0xF44C, 0xF44C,
-    0xF42C, 0xF42C, 0xF42C, 0xEC0C, 0xF50F, 0xFDF2, 0xF5D2, 0xF5F2,
-    0xF5D2, 0xF5D2, 0xE5B2, 0xDDD3, 0xB554, 0x3BF3, 0x3C14, 0x3BF3,
-    0x5CB5, 0x7557, 0x6D36, 0x6D56, 0x6D56, 0x6D57, 0x6D57, 0x6D56,
-    0x6D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x7556, 0x6D16,
-    0x1989, 0x00A6, 0x00A6, 0x00A7, 0x00A7, 0x08E8, 0x7516, 0x7D77,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x7597,
-    0x6453, 0x00C7, 0x08E8, 0x0908, 0x08E8, 0x08C7, 0x00C6, 0x0086,
-    0x0086, 0x0086, 0x00A7, 0x0046, 0x116A, 0x7D57, 0x7D77, 0x19CB,
-    0x0067, 0x00A7, 0x0086, 0x0065, 0x5C33, 0x64D5, 0x6D16, 0x434F,
-    0x00E7, 0x00A7, 0x00A7, 0x00A7, 0x00A6, 0x0086, 0x0086, 0x0066,
-    0x3BD3, 0x3310, 0x32F0, 0x3351, 0x2A8E, 0x0087, 0x00A7, 0x32EF,
-    0x64D6, 0x6D37, 0x64F5, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x5C53, 0x6D16, 0x7577, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7557, 0x7557, 0x7557, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6516, 0xAD94, 0xDDD2,
-    0xD5B2, 0xD5D3, 0xD5B3, 0xF5F2, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF2, 0xFDF2, 0xFDF2,
-    0xFDF1, 0xFDF1, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDF1, 0xFE12, 0xFE12, 0xFE12, 0xFE12, 0xFDD1,
-    0xF42C, 0xF40B, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40B, 0xF46C, 0xF46D, 0xF46C,
-    0xF46C, 0xF46C, 0xF48D, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF44C,
-    0xF48D, 0xF48D, 0xF48D, 0xF48D, 0xF44C, 0xF40B, 0xF40B, 0xF40B,
-    0xF40B, 0xF40B, 0xF40B, 0xF40B, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF40C, 0xF3EB, 0xF3EB, 0xF3EB, 0xF40B, 0xF40B,
-    0xFC2C, 0xFC0C, 0xFC2C, 0xFC0B, 0xBCB0, 0x8D55, 0x9555, 0x9555,
-    0x9575, 0x9555, 0x9575, 0x9575, 0x8555, 0x6516, 0x6516, 0x6516,
-    0x6D36, 0x7576, 0x7576, 0x7576, 0x7576, 0x7576, 0x7577, 0x7576,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7597, 0x5C73, 0x1128,
-    0x00A5, 0x00A5, 0x00A6, 0x0045, 0x0929, 0x6433, 0x1149, 0x6473,
-    0x7D97, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7576,
-    0x7516, 0x5C53, 0x6473, 0x0928, 0x0005, 0x00A6, 0x0907, 0x0086,
-    0x0086, 0x00A7, 0x0045, 0x3AAE, 0x6453, 0x1169, 0x7D57, 0x116A,
-    0x0026, 0x0086, 0x1149, 0x5BD1, 0x19AA, 0x1969, 0x222C, 0x222B,
-    0x0928, 0x00A7, 0x0087, 0x00A7, 0x00A6, 0x0066, 0x1949, 0x6433,
-    0x3BD3, 0x3C15, 0x2AF0, 0x222D, 0x19CB, 0x0086, 0x00A6, 0x21EC,
-    0x328D, 0x53F1, 0x7D97, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7597, 0x7577, 0x7556, 0x7556, 0x6D56, 0x6536,
-    0x6556, 0x6556, 0x6556, 0x6D37, 0x6557, 0x7536, 0xC5B4, 0xCDB3,
-    0xCDD3, 0xC5B3, 0xC5B3, 0xC5B3, 0xC5B3, 0xBD93, 0xE5D2, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFE11,
-    0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1, 0xF50E, 0xF4CE, 0xF4EE,
-    0xF4CE, 0xF4CE, 0xF4CE, 0xF4AE, 0xFD70, 0xFE11, 0xFDF1, 0xFDF1,
-    0xFDF2, 0xFDF1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDD1, 0xF4EE, 0xF4CE, 0xF4EE, 0xF4EE, 0xF4CE, 0xF4AD,
-    0xF40C, 0xF40B, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42B, 0xF40C, 0xF3EB, 0xF3EB, 0xF3EB,
-    0xF3EB, 0xF3EB, 0xF3EB, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF40C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF40B, 0xF40B, 0xF40B, 0xF42C, 0xF42C, 0xF40B, 0xF40B,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF40C, 0xF40C, 0xF46D, 0xF550, 0xF550, 0xF550, 0xFD4F, 0xCCF0,
-    0x9492, 0x9CB2, 0x9CB2, 0x9CB2, 0x7CD4, 0x6536, 0x6536, 0x6537,
-    0x6537, 0x6537, 0x6537, 0x6537, 0x6537, 0x6D57, 0x6D57, 0x6D57,
-    0x6D57, 0x6D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7577, 0x64D5, 0x432F,
-    0x4370, 0x5412, 0x21CA, 0x1989, 0x6474, 0x7577, 0x4370, 0x6CF5,
-    0x7D77, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x7556,
-    0x7577, 0x7DB7, 0x7DB8, 0x5C33, 0x5C12, 0x3A8D, 0x0086, 0x00A6,
-    0x00A6, 0x00A7, 0x0066, 0x1949, 0x3AAE, 0x4B70, 0x7536, 0x6453,
-    0x21CA, 0x0004, 0x1148, 0x7516, 0x0065, 0x0025, 0x00E7, 0x1168,
-    0x0928, 0x0087, 0x0087, 0x0087, 0x00A7, 0x0025, 0x1149, 0x8DF9,
-    0x33B4, 0x3BF5, 0x11AB, 0x0025, 0x0066, 0x0086, 0x00A6, 0x0045,
-    0x0004, 0x2A2C, 0x7DB8, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x6D56, 0x7556, 0x7556, 0x6D56, 0x7D56, 0xA595,
-    0xAD74, 0xAD94, 0xAD74, 0xAD74, 0xAD74, 0xAD74, 0xBD94, 0xC594,
-    0xBD94, 0xDDD3, 0xFE11, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD2, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFE11, 0xFDD1, 0xF52F, 0xFD2F,
-    0xFD2F, 0xFD2F, 0xFD2F, 0xFD2F, 0xFD0F, 0xF44C, 0xF40B, 0xF40B,
-    0xF40B, 0xF3EB, 0xF40B, 0xF3EB, 0xF48D, 0xFD4F, 0xFD2F, 0xFD4F,
-    0xF52F, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1, 0xFD4F, 0xFD2F, 0xFD2F, 0xFD2F,
-    0xFD2F, 0xF50E, 0xF40B, 0xF3EB, 0xF40B, 0xF40C, 0xF40B, 0xF40B,
-    0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xFC2C, 0xFC2C, 0xF42C, 0xF40C, 0xF40B, 0xF42C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xFC2C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C,
-    0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xFC2C, 0xF40C, 0xF40C, 0xF40C,
-    0xF42C, 0xFC2C, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xFC2C, 0xF42C,
-    0xF42C, 0xF42C, 0xFC2C, 0xF40C, 0xF40C, 0xF40B, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xFC2C, 0xF40C, 0xF42C, 0xF42C,
-    0xFC2C, 0xFC0C, 0xF44C, 0xFD50, 0xFD50, 0xFD2F, 0xFDB1, 0xD5D3,
-    0x9575, 0x9D95, 0x9D95, 0x9D75, 0xA574, 0xAD74, 0xAD74, 0xAD74,
-    0xAD74, 0xAD74, 0xAD94, 0xAD94, 0xA574, 0xA574, 0xAD94, 0xAD94,
-    0xAD94, 0x9575, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7577, 0x7D97,
-    0x7597, 0x5C53, 0x1989, 0x1989, 0x6453, 0x7D97, 0x85B8, 0x7D77,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7557, 0x5C12, 0x5BD2, 0x328D, 0x0086, 0x0087,
-    0x0086, 0x00A7, 0x0066, 0x1108, 0x3B0F, 0x7D97, 0x7556, 0x6473,
-    0x21AA, 0x10E7, 0x432F, 0x6CF5, 0x32AD, 0x0907, 0x0907, 0x1168,
-    0x0907, 0x0086, 0x00A7, 0x00A7, 0x0066, 0x1128, 0x3AAD, 0x4B2F,
-    0x4C34, 0x4C55, 0x2AAE, 0x19AA, 0x198A, 0x0086, 0x0086, 0x1989,
-    0x198A, 0x432F, 0x7D97, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x8555, 0xD5D4,
-    0xDDB3, 0xDDB3, 0xDDB3, 0xD5B3, 0xDDB3, 0xD5D3, 0x8D14, 0x8515,
-    0x7D14, 0xB573, 0xFDF2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDF1, 0xFDF1,
-    0xFDF1, 0xFDF1, 0xFDB0, 0xF550, 0xED30, 0xFD4F, 0xF3EB, 0xF3EB,
-    0xE3CC, 0xE3CC, 0xF40C, 0xF40B, 0xF40C, 0xE3EC, 0xEC0C, 0xF42C,
-    0xF42C, 0xF42C, 0xE3ED, 0xF40C, 0xF40B, 0xF40B, 0xEBEC, 0xDBCC,
-    0xEBEC, 0xFD50, 0xFD90, 0xFD70, 0xFD70, 0xFD70, 0xFD4F, 0xFDD1,
-    0xFDB1, 0xFD4F, 0xFD70, 0xFD2F, 0xF42C, 0xE3CC, 0xEC0C, 0xF42B,
-    0xF40B, 0xF40B, 0xDBCC, 0xEC0C, 0xF40C, 0xF42C, 0xF42C, 0xE3ED,
-    0xF42C, 0xF40B, 0xF40B, 0xEBEC, 0xE3EC, 0xF40C, 0xF40C, 0xF42C,
-    0xE3EC, 0xE3EC, 0xF42C, 0xF40C, 0xF40C, 0xE3CC, 0xEBEC, 0xF40C,
-    0xF40C, 0xF40C, 0xE3CC, 0xEC0C, 0xF42C, 0xF42C, 0xEC0C, 0xE3ED,
-    0xF42C, 0xF40C, 0xF42C, 0xEBEC, 0xE3CC, 0xF40C, 0xF40C, 0xF42C,
-    0xE3EC, 0xE3EC, 0xF42C, 0xF42C, 0xF42C, 0xE3ED, 0xEC0D, 0xF42C,
-    0xF40C, 0xF40C, 0xDBCC, 0xEC0C, 0xF40C, 0xF42C, 0xEC0C, 0xE3EC,
-    0xF42C, 0xF42C, 0xF42C, 0xEBEC, 0xE3CC, 0xF42C, 0xF40C, 0xF42C,
-    0xE3EC, 0xE40C, 0xF42C, 0xF40B, 0xF40C, 0xE3AB, 0xEC8E, 0xFD70,
-    0xFD70, 0xFD90, 0xFD90, 0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDD1,
-    0xFDD1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF2, 0xDDB3, 0xD5B4,
-    0xDDD4, 0xA595, 0x6D56, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D36,
-    0x7557, 0x1968, 0x0045, 0x0025, 0x08C7, 0x6453, 0x7536, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7D97, 0x222C, 0x0908, 0x1128, 0x08E7, 0x0087,
-    0x0087, 0x00A7, 0x0045, 0x324C, 0x6CF5, 0x6D16, 0x7577, 0x2A4C,
-    0x0046, 0x328D, 0x85F9, 0x6D56, 0x7DB8, 0x32CD, 0x1168, 0x0948,
-    0x0927, 0x00A6, 0x0086, 0x00A7, 0x0046, 0x2A2C, 0x53B1, 0x0005,
-    0x7577, 0x7557, 0x6D57, 0x7598, 0x5433, 0x0086, 0x0086, 0x5BF2,
-    0x7516, 0x6D16, 0x7557, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D57, 0x7556, 0x7536,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x7536, 0x8D76, 0xEDF2, 0xFDF2,
-    0xF5F2, 0xFDF2, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDB1, 0xFDB1,
-    0xFDB1, 0xFDD1, 0xFCEE, 0xD38C, 0xB32C, 0xF40C, 0xF3EB, 0xFC0C,
-    0xC32C, 0xC34C, 0xFC4C, 0xF40C, 0xF42C, 0xB30C, 0xD38C, 0xFC2C,
-    0xF40C, 0xF40C, 0xB30C, 0xE3ED, 0xF42C, 0xFC2C, 0xE3EC, 0xAAEC,
-    0xEC0C, 0xFCCE, 0xF46D, 0xF40B, 0xF40C, 0xF40C, 0xEBEB, 0xFD70,
-    0xF4EE, 0xF3EB, 0xF40B, 0xF40B, 0xF44C, 0xBB2C, 0xD3AD, 0xFC4D,
-    0xF42C, 0xEC0C, 0xAAEC, 0xE3CC, 0xFC0C, 0xFC2C, 0xE3ED, 0xB2EC,
-    0xF42D, 0xF42C, 0xFC2C, 0xD38C, 0xB30C, 0xF42C, 0xF3EC, 0xFC2C,
-    0xC34C, 0xC34C, 0xFC4C, 0xF40C, 0xF42C, 0xB30C, 0xD38C, 0xFC2C,
-    0xF42C, 0xEC0C, 0xAAEC, 0xE3ED, 0xF42C, 0xFC2C, 0xE3CC, 0xAAEC,
-    0xEC0C, 0xF40C, 0xFC2C, 0xD38D, 0xB2EC, 0xF42C, 0xF40C, 0xFC2C,
-    0xC34C, 0xC34C, 0xFC4C, 0xF42C, 0xFC4D, 0xBB0C, 0xD3AD, 0xFC4C,
-    0xF40C, 0xEC0C, 0xAACC, 0xDBCC, 0xF42C, 0xFC2C, 0xE3CD, 0xB2EC,
-    0xF42D, 0xF42C, 0xFC2C, 0xCB8C, 0xB30C, 0xF42C, 0xF40C, 0xFC4C,
-    0xC34D, 0xC36D, 0xFC4D, 0xF42C, 0xF42C, 0xB32C, 0xD3AC, 0xF40B,
-    0xEBEB, 0xF40C, 0xEC0C, 0xED71, 0xEDF3, 0xEDD2, 0xEDD2, 0xFDB1,
-    0xFDD1, 0xFDB1, 0xFDB1, 0xF5D1, 0xFDD1, 0xEDD2, 0x8D14, 0x7D15,
-    0x8515, 0x7D35, 0x8556, 0x7D56, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56,
-    0x7577, 0x2A2B, 0x0086, 0x08A6, 0x08E7, 0x0928, 0x6D16, 0x7577,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x6D56, 0x6D56, 0x6D15, 0x6D16, 0x8598, 0x4B50, 0x0046, 0x00A7,
-    0x0087, 0x0087, 0x00A7, 0x0045, 0x1128, 0x6D16, 0x6D36, 0x85F9,
-    0x326D, 0x2A0C, 0x7DB8, 0x7556, 0x6D36, 0x7D77, 0x32CD, 0x00E6,
-    0x1148, 0x1128, 0x00A6, 0x0086, 0x00A7, 0x0087, 0x0087, 0x00C8,
-    0x6D56, 0x6D36, 0x7DB8, 0x4BD2, 0x00A7, 0x08A8, 0x00A7, 0x08E7,
-    0x0065, 0x32AD, 0x7D98, 0x6D56, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7557, 0x7556, 0x7556, 0x7556,
-    0x7536, 0x7536, 0x7556, 0x7536, 0x6D56, 0x8555, 0xEDD2, 0xFDD0,
-    0xFDD0, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1, 0xFDD1,
-    0xFDD1, 0xFDD1, 0xFDD1, 0xFDB1, 0xFDF1, 0xFD2F, 0xF40B, 0xF44C,
-    0xF44C, 0xF46D, 0xF44D, 0xF42D, 0xF42D, 0xF42C, 0xF42C, 0xF40C,
-    0xF40C, 0xF42D, 0xF42C, 0xF42C, 0xF42C, 0xEC0C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42D, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xEC0C,
-    0xF42C, 0xF44D, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF40C, 0xF42C,
-    0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42D, 0xF44D, 0xF44D,
-    0xF44D, 0xF42C, 0xF42D, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42D,
-    0xF42C, 0xF44D, 0xF42C, 0xF40C, 0xEC0C, 0xF40C, 0xF40C, 0xF40C,
-    0xF40C, 0xF40C, 0xF42C, 0xFC4D, 0xF42C, 0xF42D, 0xF42D, 0xF44D,
-    0xF44D, 0xF42C, 0xF40D, 0xF40C, 0xF42C, 0xF40C, 0xF40C, 0xEC0C,
-    0xF40C, 0xF42D, 0xF42C, 0xF42C, 0xF42D, 0xF42C, 0xF44D, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42D, 0xF42C, 0xF42D, 0xF42D, 0xF42C,
-    0xF42C, 0xF40C, 0xEC0C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42D,
-    0xF42C, 0xF44D, 0xF42C, 0xF40C, 0xEC0C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42D, 0xF42D, 0xF42C, 0xF44C, 0xF42C, 0xF42D, 0xF40C, 0xF40C,
-    0xF42C, 0xF42C, 0xF46E, 0x9D14, 0x7D56, 0x7D35, 0x9D54, 0xF5F2,
-    0xFDD2, 0xF5D2, 0xF5F2, 0xF5D2, 0xF5D2, 0xF5D2, 0xEDD3, 0xE5D3,
-    0xE5D3, 0xE5D3, 0xE5D3, 0xD5F4, 0x7D56, 0x6D56, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x6D56, 0x7557, 0x21EA, 0x2A0B, 0x7557, 0x74F5, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x6D16, 0x1169, 0x0908, 0x0969, 0x08E8, 0x00A7, 0x0928,
-    0x0087, 0x0087, 0x0065, 0x0045, 0x0045, 0x0907, 0x6CF5, 0x85D8,
-    0x2A0C, 0x220B, 0x85D8, 0x7556, 0x7557, 0x7D98, 0x326C, 0x0085,
-    0x1148, 0x1128, 0x0086, 0x0087, 0x00A7, 0x00A7, 0x00A7, 0x00C7,
-    0x6D36, 0x7597, 0x3B0F, 0x00A7, 0x0067, 0x00A8, 0x0066, 0x0004,
-    0x326D, 0x6CF5, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x7535,
-    0xCDB3, 0xD5B3, 0xD5B3, 0xD5B3, 0xD5B3, 0xDDB3, 0xF5F2, 0xFE12,
-    0xF50E, 0xF44C, 0xF46D, 0xF48D, 0xFDD1, 0xFDF1, 0xFDD1, 0xFDF1,
-    0xFE12, 0xFDD1, 0xF4AD, 0xFC8D, 0xC3CD, 0xCB8D, 0xFC0C, 0xF40B,
-    0xF42C, 0xBB2C, 0xDBCD, 0xFC4C, 0xF42C, 0xF42D, 0xBB0C, 0xE3ED,
-    0xFC2C, 0xFC2C, 0xE3ED, 0xB30C, 0xEC2C, 0xF42C, 0xFC2C, 0xD38C,
-    0xBB2C, 0xF42D, 0xF42C, 0xFC4C, 0xC34C, 0xCB6D, 0xFC6D, 0xFC4C,
-    0xFC4D, 0xC34D, 0xDBCD, 0xFC4C, 0xFC2C, 0xFC2C, 0xFC2C, 0xFC2C,
-    0xFC2C, 0xFC2C, 0xE3CC, 0xB2EC, 0xEC0C, 0xF42C, 0xFC4C, 0xDBCD,
-    0xBB4C, 0xF44D, 0xF40C, 0xFC2C, 0xC34C, 0xC34C, 0xFC2C, 0xF42C,
-    0xF44D, 0xBB4C, 0xDBCD, 0xFC2C, 0xF40C, 0xEBEC, 0xB2EC, 0xE3CC,
-    0xFC0C, 0xFC2C, 0xEBED, 0xBB0C, 0xF42D, 0xFC2C, 0xFC4D, 0xDBCD,
-    0xBB2C, 0xF44D, 0xF40C, 0xFC2C, 0xCB4C, 0xC34C, 0xFC2C, 0xF40C,
-    0xF40C, 0xBB2C, 0xDBAC, 0xFC4C, 0xF42C, 0xEC2D, 0xBB0C, 0xE40D,
-    0xFC2C, 0xFC2C, 0xE3ED, 0xB30C, 0xF42C, 0xF42C, 0xFC2C, 0xD38C,
-    0xBB0C, 0xF42C, 0xF40C, 0xFC2C, 0xCB4C, 0xCB6D, 0xFC6D, 0xF42C,
-    0xFC4D, 0xBB2C, 0xD3AC, 0xFC4C, 0xF40C, 0xEC0C, 0xB30C, 0xE3ED,
-    0xFC2C, 0xFC2C, 0xE3ED, 0xBB2C, 0xF42C, 0xF42C, 0xFC2C, 0xD38C,
-    0xBB2C, 0xEC2D, 0xA32E, 0x74F5, 0x6557, 0x6536, 0x6D36, 0x8D55,
-    0x9575, 0x9575, 0x9575, 0x9575, 0x9575, 0x9575, 0x9575, 0x9575,
-    0x9575, 0x9575, 0x9575, 0x8D96, 0x7577, 0x7577, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x6D36, 0x8619, 0x326C, 0x2A4C, 0x8557, 0x8B50, 0x9371, 0x9391,
-    0x93B1, 0x93B1, 0x93B1, 0x93B1, 0x93B1, 0x9391, 0x93B1, 0x9391,
-    0x9391, 0x9370, 0x7AAE, 0x10E7, 0x0086, 0x00E7, 0x1148, 0x0948,
-    0x00A7, 0x0046, 0x430E, 0x6CD5, 0x6474, 0x6494, 0x6D36, 0x7577,
-    0x6494, 0x6C94, 0x7DB7, 0x7D97, 0x32EE, 0x19CA, 0x08C7, 0x0086,
-    0x00A6, 0x00A6, 0x0086, 0x00A7, 0x00A7, 0x00A7, 0x00A7, 0x0046,
-    0x6D56, 0x6D77, 0x5412, 0x4B70, 0x3AEF, 0x08E8, 0x4330, 0x432F,
-    0x6494, 0x7597, 0x6D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7536, 0xB5B4, 0xCDD3, 0xCDB3, 0xC5B4, 0xCDB3,
-    0xFDF2, 0xFDF2, 0xFDF1, 0xFDF1, 0xFDF1, 0xFDF1, 0xF50F, 0xCC4F,
-    0xDC0D, 0xF3EB, 0xF40C, 0xF42C, 0xF4CE, 0xF4AE, 0xFD90, 0xE531,
-    0xD42F, 0xF4CE, 0xF40C, 0xF40B, 0xDBAC, 0xDBAC, 0xFC2C, 0xFC2C,
-    0xF42C, 0xD3AC, 0xE3ED, 0xFC4C, 0xFC4C, 0xF42D, 0xD3AD, 0xEC0C,
-    0xFC4C, 0xFC4C, 0xEC0C, 0xD3AD, 0xF42C, 0xFC4C, 0xFC4C, 0xE3CC,
-    0xD38C, 0xF42C, 0xFC2C, 0xFC4C, 0xE3ED, 0xCB8E, 0xC36E, 0xC36E,
-    0xC36E, 0xA2EF, 0xB32E, 0xC36E, 0xC34D, 0xC36E, 0xC34E, 0xC36E,
-    0xBB4E, 0xDBCD, 0xF42D, 0xD38C, 0xF40C, 0xFC2C, 0xFC4C, 0xEC0D,
-    0xDBAD, 0xFC4C, 0xFC2C, 0xFC2C, 0xDBAC, 0xDBAC, 0xFC2C, 0xFC2C,
-    0xF44C, 0xD3AD, 0xE40D, 0xFC4C, 0xFC2C, 0xF40C, 0xD36C, 0xEBEC,
-    0xFC0C, 0xFC2C, 0xEC0C, 0xD3AD, 0xF42D, 0xFC4D, 0xFC4D, 0xE40D,
-    0xD3CD, 0xFC4D, 0xFC2C, 0xFC0C, 0xDB8C, 0xDBAC, 0xFC2C, 0xFC2C,
-    0xF40C, 0xD38C, 0xE3EC, 0xFC4C, 0xFC4C, 0xF42D, 0xDBCD, 0xEC2D,
-    0xFC4C, 0xFC4C, 0xEBEC, 0xD38C, 0xF40C, 0xFC2C, 0xFC2C, 0xE3CC,
-    0xD38C, 0xF40C, 0xFC2C, 0xFC2C, 0xDBCC, 0xDBCD, 0xFC4C, 0xFC4C,
-    0xFC4C, 0xDBAD, 0xE3ED, 0xFC4C, 0xFC2C, 0xF40C, 0xD38C, 0xEC0C,
-    0xFC4C, 0xFC4C, 0xEC0D, 0xD3AD, 0xF42C, 0xFC4C, 0xFC4C, 0xE3ED,
-    0xDBAD, 0xF42D, 0xD3EE, 0xCCB0, 0xC4F1, 0xC4D1, 0xC4D1, 0xBCB1,
-    0x8BF1, 0x8BD2, 0x8BD2, 0x8BD2, 0x8BD2, 0x8BD2, 0x8BF2, 0x8BD2,
-    0x83D2, 0x8BD2, 0x8BD2, 0x8BD2, 0x8BF2, 0x8BD1, 0x7CF5, 0x7597,
-    0x7577, 0x7577, 0x7577, 0x7577, 0x7577, 0x7557, 0x7556, 0x7556,
-    0x7577, 0x63F1, 0x1928, 0x326D, 0x7D77, 0x83F2, 0x9AEE, 0xA2AE,
-    0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2EE, 0xA2CE, 0xA2CE,
-    0xA2CE, 0xA2CF, 0xAB50, 0x726C, 0x6A6D, 0x41EB, 0x00C7, 0x08E8,
-    0x00A7, 0x0087, 0x21EB, 0x32AE, 0x2A2C, 0x32AD, 0x6D16, 0x7556,
-    0x7577, 0x85B7, 0x6CD5, 0x2A4C, 0x0928, 0x08E7, 0x08E7, 0x0907,
-    0x0907, 0x08E7, 0x00A6, 0x00A7, 0x0087, 0x0046, 0x0929, 0x4371,
-    0x6D36, 0x9CD2, 0x8D35, 0x7DF9, 0x6473, 0x0908, 0x7D77, 0x7DD8,
-    0x7577, 0x6D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56,
-    0x6D57, 0x6D57, 0x7556, 0xB5B5, 0xCDB4, 0xCD93, 0xF530, 0xFD2F,
-    0xF52F, 0xF50F, 0xF50F, 0xF50F, 0xF50F, 0xF50F, 0xF44C, 0xC36C,
-    0xDBCC, 0xF42C, 0xF40C, 0xF42C, 0xF40C, 0xF3EB, 0xFCCE, 0xE48F,
-    0xD36D, 0xF42C, 0xF42C, 0xF42C, 0xFC2C, 0xFC2C, 0xEBEC, 0xCB6C,
-    0xF40C, 0xFC2C, 0xFC4C, 0xE3ED, 0xD3AD, 0xFC2C, 0xFC4C, 0xFC4C,
-    0xDBCD, 0xDBCD, 0xFC4C, 0xFC4C, 0xF44D, 0xD3AC, 0xE3CC, 0xFC2C,
-    0xFC2C, 0xF40C, 0xCB6C, 0xDBCD, 0xDBED, 0xC36E, 0x9ACF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0x9ACF, 0x9ACF, 0x9ACF, 0x9ACF, 0x9ACF,
-    0x9ACF, 0xB32E, 0xDBED, 0xFC6D, 0xF44C, 0xDBCD, 0xCB8D, 0xE3CD,
-    0xFC4C, 0xF42C, 0xD38D, 0xEBED, 0xFC2C, 0xFC2C, 0xEC0D, 0xD38D,
-    0xF40C, 0xFC4C, 0xFC4D, 0xE3ED, 0xD3AC, 0xF42C, 0xFC2C, 0xFC2C,
-    0xD38C, 0xDB8C, 0xFC2C, 0xFC4C, 0xFC4C, 0xD3AD, 0xE40D, 0xFC6D,
-    0xFC6D, 0xF42D, 0xCB8C, 0xEBEC, 0xFC2C, 0xFC2C, 0xEBEC, 0xCB6C,
-    0xF40C, 0xFC2C, 0xFC4C, 0xE3ED, 0xD3AD, 0xF44D, 0xFC4D, 0xFC4D,
-    0xDBCD, 0xDBCD, 0xFC2C, 0xFC2C, 0xF40C, 0xCB6C, 0xE3AC, 0xFC2C,
-    0xFC2C, 0xF40C, 0xD38D, 0xEC0D, 0xFC4C, 0xFC4C, 0xEC0C, 0xD38D,
-    0xF40C, 0xFC4C, 0xFC4C, 0xE3CC, 0xD38C, 0xF42C, 0xFC2C, 0xFC2C,
-    0xDBAD, 0xDBCD, 0xFC4C, 0xFC4C, 0xF42C, 0xD3AD, 0xE3ED, 0xFC4C,
-    0xFC4C, 0xF42D, 0xDBCD, 0xDBCD, 0xDBAD, 0xDBCD, 0xDBCD, 0xDBAD,
-    0xAACD, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE,
-    0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0xA2CE, 0x93D2, 0x8494,
-    0x8473, 0x8473, 0x8473, 0x8473, 0x8453, 0x7CD5, 0x7556, 0x7536,
-    0x7557, 0x63B1, 0x10E7, 0x2A4C, 0x7DB8, 0x7536, 0x8412, 0x8BD1,
-    0x8BF2, 0x8C12, 0x8C12, 0x8C32, 0x8C32, 0x8C32, 0x8C12, 0x8C33,
-    0x93F1, 0x9AEF, 0x620C, 0x622C, 0x728D, 0x398A, 0x0066, 0x00A7,
-    0x00A7, 0x0087, 0x0025, 0x1086, 0x3928, 0x3969, 0x6D16, 0x7577,
-    0x7556, 0x7D77, 0x6CD5, 0x2A8D, 0x3B0E, 0x11A9, 0x0947, 0x1168,
-    0x1148, 0x08E7, 0x00A6, 0x0086, 0x3169, 0x49AA, 0x524C, 0x8CB5,
-    0x6D36, 0xBC90, 0x94D3, 0x6D77, 0x5412, 0x08E8, 0x6D16, 0x7556,
-    0x7556, 0x7556, 0x6D57, 0x6D56, 0x6D56, 0x6D56, 0x6D57, 0x7D35,
-    0x9534, 0x9535, 0x9534, 0x9514, 0x8CF4, 0x9CB2, 0xDC0D, 0xF40C,
-    0xF40C, 0xF40B, 0xF40B, 0xF40C, 0xF40B, 0xF40B, 0xF42C, 0xF44C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xFC4D, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xE3ED, 0xB30C,
-    0xEBEC, 0xF42C, 0xFC4C, 0xDBAD, 0xBB4C, 0xF44D, 0xF42C, 0xFC4C,
-    0xCB6D, 0xCB6D, 0xFC4C, 0xF42C, 0xF44D, 0xBB2C, 0xD3AC, 0xFC2C,
-    0xF42C, 0xF40C, 0xB2EC, 0xCB8D, 0xB30E, 0x9ACF, 0xA30F, 0xA30F,
-    0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA2EF, 0xAB0E, 0xE3ED, 0xF44D, 0xBB2E, 0xA2CE, 0xD38D,
-    0xFC2C, 0xF42D, 0xBB2D, 0xE3ED, 0xFC2C, 0xF42C, 0xE3ED, 0xB30D,
-    0xEC0D, 0xF42C, 0xFC4C, 0xD3AD, 0xBB4C, 0xFC4D, 0xF40C, 0xFC2C,
-    0xC34C, 0xCB4C, 0xFC2C, 0xF40C, 0xFC4D, 0xC34D, 0xDBCD, 0xFC4C,
-    0xF42C, 0xEC2D, 0xB30C, 0xE3ED, 0xFC2C, 0xFC2C, 0xE3CC, 0xB30C,
-    0xEC0C, 0xFC0C, 0xFC4C, 0xDBCD, 0xBB4D, 0xFC4D, 0xF42C, 0xFC6D,
-    0xCB8D, 0xC36D, 0xFC4C, 0xF40C, 0xF40C, 0xB2EC, 0xD38C, 0xFC2C,
-    0xF42C, 0xEC2D, 0xBB2C, 0xEC0D, 0xFC4C, 0xFC2C, 0xE3ED, 0xB30C,
-    0xEC0D, 0xF40C, 0xFC4C, 0xD3AD, 0xBB2C, 0xF44D, 0xF42C, 0xFC2C,
-    0xC36D, 0xCB6D, 0xF42C, 0xF40C, 0xF44D, 0xBB2D, 0xD3AD, 0xFC4C,
-    0xF42C, 0xE3ED, 0x9ACE, 0x9ACF, 0x9ACE, 0x9ACE, 0x9ACE, 0x9ACE,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2CF,
-    0xA2CE, 0xA2EE, 0xA2CE, 0xA2EF, 0xA2AE, 0x8BF2, 0x7577, 0x6D56,
-    0x6D56, 0x85D8, 0x432F, 0x430F, 0x7DB8, 0x7556, 0x7557, 0x7577,
-    0x7D15, 0x84D5, 0x84F5, 0x84F5, 0x84F5, 0x84F5, 0x84D5, 0x84F5,
-    0x8C73, 0x92CE, 0x3149, 0x00A6, 0x08A6, 0x08A6, 0x00A7, 0x00A7,
-    0x00A7, 0x2129, 0x2929, 0x624C, 0xB391, 0xA370, 0x8494, 0x7CB4,
-    0x74F5, 0x7536, 0x7556, 0x8556, 0x8D36, 0x4A8C, 0x1948, 0x0948,
-    0x0928, 0x00A6, 0x00A7, 0x0066, 0x520B, 0xA32F, 0xAB0F, 0x9AAE,
-    0x6D36, 0x6D36, 0x6D36, 0x7597, 0x5412, 0x08C7, 0x7516, 0x7577,
-    0x7556, 0x7D56, 0x8535, 0x7D35, 0x7D35, 0x7D15, 0x7D15, 0xACB1,
-    0xEC6E, 0xEC8E, 0xE46F, 0xEC8E, 0xEC8F, 0xEC6E, 0xF44D, 0xEC2D,
-    0xF42C, 0xEC0C, 0xF40C, 0xF40C, 0xEC0C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42D,
-    0xF42C, 0xEC0C, 0xEC0C, 0xF42D, 0xF42D, 0xF42C, 0xEC0D, 0xF42C,
-    0xF44D, 0xF42D, 0xF42C, 0xEC0D, 0xEC0D, 0xEC2D, 0xEC2D, 0xEC0D,
-    0xEC0D, 0xEC0D, 0xEC2D, 0xF44D, 0xBB6E, 0x9AEF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA30F, 0xAB0F, 0xAB0E, 0xA2EF, 0xAB0E, 0xA2EE, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAAED, 0xF42D, 0xBB2E, 0xCB8E, 0xF44D,
-    0xEC0C, 0xF42C, 0xEC2D, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xEC2D,
-    0xF40C, 0xEC0C, 0xF42C, 0xF42D, 0xF44D, 0xF42C, 0xEC2D, 0xF42D,
-    0xF42D, 0xF40D, 0xF40C, 0xEBEC, 0xF42C, 0xEC2D, 0xF42D, 0xF42D,
-    0xEC2D, 0xF44C, 0xF44E, 0xF42D, 0xF40C, 0xEC0C, 0xF40C, 0xEC0D,
-    0xF40C, 0xEC0C, 0xF40C, 0xF42D, 0xEC2D, 0xF42C, 0xEC2D, 0xF42D,
-    0xF44D, 0xF44D, 0xF42C, 0xEBED, 0xF40C, 0xEC0D, 0xF40C, 0xF40C,
-    0xEC0D, 0xF42C, 0xF44E, 0xF44D, 0xF42D, 0xF42D, 0xF42C, 0xEC2D,
-    0xF42C, 0xEC0C, 0xF40C, 0xF42D, 0xF44D, 0xF42C, 0xEC2D, 0xF42C,
-    0xF42D, 0xF42D, 0xF40C, 0xF40C, 0xEC0D, 0xF42D, 0xF42D, 0xF42D,
-    0xEC0D, 0xCB8D, 0xAB0E, 0xA2EF, 0xAB0F, 0xAB0E, 0xA2EE, 0xAB0E,
-    0xA2EE, 0xAB0E, 0xAB0E, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA30F, 0xA30F, 0xA2CF, 0x8BD2, 0x7D36, 0x7516,
-    0x7516, 0x7515, 0x7D36, 0x8556, 0x7D36, 0x7D16, 0x7D15, 0x7D16,
-    0x8BB1, 0x9ACE, 0x9B0F, 0x9B0F, 0x9B0F, 0x9B0F, 0x9B0F, 0x9B0F,
-    0x9AEF, 0xA2EF, 0x9B10, 0x3148, 0x31A9, 0x31C9, 0x08E7, 0x00A7,
-    0x0087, 0x7ACE, 0xA391, 0x9B30, 0xA32F, 0x9B0F, 0x9B0F, 0x9ACE,
-    0x7C32, 0x6D36, 0x7515, 0x8BD1, 0x9B2F, 0xAB90, 0x49EB, 0x00E7,
-    0x1148, 0x1148, 0x00A7, 0x00A7, 0x0046, 0x3969, 0x9B0F, 0x92CE,
-    0x6D36, 0x6D36, 0x6D36, 0x7577, 0x5412, 0x08C7, 0x7536, 0x7D56,
-    0x7556, 0xAD33, 0xDC6F, 0xA36E, 0xE46F, 0xA34E, 0xCBEE, 0xD3CD,
-    0xB2EC, 0xF46E, 0xAACC, 0xEC4E, 0xCB8D, 0xCB8D, 0xEC4E, 0xB2CC,
-    0xF44E, 0xB2EC, 0xD38D, 0xDBAD, 0xB30C, 0xF44D, 0xF44D, 0xF42C,
-    0xF42D, 0xF42C, 0xF42C, 0xF42D, 0xF40C, 0xF42C, 0xF40C, 0xF40C,
-    0xF40C, 0xF42C, 0xF42C, 0xF44D, 0xF42C, 0xFC2C, 0xE3ED, 0xB2EC,
-    0xEC2E, 0xB2EC, 0xD38D, 0xD3AD, 0xB30D, 0xEC4E, 0xB30D, 0xE40E,
-    0xCB6D, 0xC34D, 0xEC0E, 0xAAED, 0xAB0E, 0xAB0E, 0xAAEE, 0xAAEE,
-    0xAAEE, 0xAAEE, 0xAAEE, 0xAB0E, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EE,
-    0xA30F, 0xA2CE, 0xD3CE, 0xCBAE, 0xAAED, 0xE44F, 0xAACD, 0xDC0E,
-    0xC36E, 0xC34E, 0xDC2F, 0xAAED, 0xF46E, 0xB30D, 0xD38E, 0xD3AD,
-    0xB2EC, 0xF44E, 0xAACC, 0xEC2E, 0xC34D, 0xC36D, 0xE40D, 0xAAAC,
-    0xEC2D, 0xB2EC, 0xDBCD, 0xD3AD, 0xB2EC, 0xF46E, 0xAAEC, 0xE40E,
-    0xC34D, 0xC32C, 0xE3ED, 0xAAAC, 0xEC0D, 0xB2CC, 0xD38D, 0xDBCD,
-    0xBB0C, 0xF44E, 0xB2EC, 0xEC2E, 0xCB6D, 0xC34D, 0xE40D, 0xAAAC,
-    0xEC2E, 0xB2EC, 0xD3AD, 0xD38D, 0xB2EC, 0xEC2E, 0xAACC, 0xEC2E,
-    0xCB6D, 0xC34D, 0xE40E, 0xAAAC, 0xEC2E, 0xB2EC, 0xD3AD, 0xDBAD,
-    0xB2EC, 0xF44E, 0xAAAC, 0xEC0E, 0xCB6D, 0xC36D, 0xEC0D, 0xAACC,
-    0xF44E, 0xBB2D, 0xD3AD, 0xD3AD, 0xBB2D, 0xEC2D, 0xB2EC, 0xEC0E,
-    0xCB6D, 0xC34D, 0xF42D, 0xEC0D, 0xB2CC, 0xEC0E, 0xCB6D, 0xC34D,
-    0xE40E, 0xAACC, 0xEC4F, 0xB30D, 0xCBAE, 0xD3CE, 0xB30D, 0xE44F,
-    0xA2CD, 0xDC0F, 0xCBAE, 0xB32E, 0xB34F, 0xA2CE, 0xA2EF, 0xA2EE,
-    0xA2EE, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0x9B0F, 0x9B2F, 0x9B2F,
-    0x9B0F, 0x9B2F, 0x9B2F, 0x9B2F, 0x9B50, 0x9B30, 0x9B2F, 0x9B2F,
-    0x9B0F, 0xA2EF, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA30F, 0xA2EF, 0x9AEF, 0x92EF, 0x3188, 0x0105, 0x08E6, 0x0087,
-    0x00A7, 0x08A7, 0x318A, 0x72AE, 0xAB71, 0xA30F, 0xA30F, 0xA2EF,
-    0x9350, 0x93B1, 0x9391, 0x8B2F, 0x3949, 0x82CE, 0x9B50, 0x49EB,
-    0x0086, 0x00A7, 0x00A7, 0x0087, 0x00A6, 0x08A7, 0x10A6, 0x1086,
-    0xCCAF, 0x8CD4, 0xA4B1, 0xACF1, 0x6474, 0x42D0, 0x73B2, 0xCC4F,
-    0xA431, 0x9B90, 0xC38E, 0xE42E, 0xBB0D, 0xDBEE, 0xCB6D, 0xC34D,
-    0xD3EE, 0xB30D, 0xDBEE, 0xBB4D, 0xD3CE, 0xD3CE, 0xC34D, 0xE42E,
-    0xB30D, 0xDBCD, 0xC36D, 0xBB2D, 0xEBED, 0xEC0C, 0xBB2D, 0xEC4E,
-    0xCBAD, 0xD3AD, 0xEC2D, 0xBB2D, 0xF42D, 0xC34D, 0xD3AD, 0xFC4C,
-    0xE3CC, 0xBB2D, 0xF44D, 0xC34D, 0xE3ED, 0xE3ED, 0xC34D, 0xE40E,
-    0xBB2D, 0xDBCE, 0xCB6E, 0xAAEE, 0xA2EF, 0xB32E, 0xA30F, 0xB32E,
-    0xAB0F, 0xAB0E, 0xB32E, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2CF, 0xA2EF, 0x9ACF, 0xAB0E, 0xE42E,
-    0xA2CD, 0xDBEE, 0xCB6D, 0xC34D, 0xDBEE, 0xBB0D, 0xE40E, 0xBB2D,
-    0xD38E, 0xD3AE, 0xBB2D, 0xE42F, 0xBB0D, 0xDBEE, 0xC34D, 0xC36E,
-    0xDBEE, 0xBB0D, 0xE40E, 0xBB2D, 0xD3AE, 0xD3AE, 0xBB2D, 0xDBCE,
-    0xB2EC, 0xDBCE, 0xC34D, 0xC34D, 0xDBEE, 0xBB2D, 0xE40E, 0xBB2D,
-    0xD38E, 0xD38D, 0xBB0D, 0xE3EE, 0xBB0D, 0xDBCD, 0xCB6D, 0xCB6D,
-    0xDBCD, 0xB2ED, 0xE40E, 0xC32D, 0xD3CE, 0xD3CE, 0xBB4D, 0xE40E,
-    0xB30D, 0xDBCE, 0xCB6D, 0xC34D, 0xDBAD, 0xB2EC, 0xE3EE, 0xBB0D,
-    0xD38D, 0xD38D, 0xBB2D, 0xE42E, 0xBB2D, 0xDBEE, 0xCB6D, 0xC36D,
-    0xDBEE, 0xB2ED, 0xDBCE, 0xBB2D, 0xD38E, 0xD3AE, 0xBB0D, 0xDBEE,
-    0xB32D, 0xA2EE, 0xB30E, 0xAB0E, 0xBB2E, 0xFC4D, 0xE40E, 0xC34E,
-    0xA2EE, 0xCB6E, 0xEC0D, 0xBB0D, 0xE40E, 0xBB0D, 0xD3CE, 0xD38D,
-    0xBB2D, 0xEC2E, 0xBB0C, 0xE40E, 0xCB6D, 0xCB6D, 0xDBEE, 0xB30C,
-    0xE40E, 0xBB2D, 0xD3AD, 0xD3AE, 0xAAED, 0xE44F, 0xA2CD, 0xDC0F,
-    0xBB6E, 0x9ACE, 0xA30F, 0x9ACE, 0xA2EF, 0x9ACF, 0xA2EF, 0xA2EF,
-    0x9ACF, 0xA2EF, 0x9ACF, 0x9AEF, 0x9ACF, 0xA2CF, 0xA2EF, 0xA2CF,
-    0xA2CF, 0xA2CF, 0xA2CF, 0xA2CF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA30F, 0xA2EF, 0xA30F, 0x6A4C, 0x6A6C, 0x7AAD, 0x0066,
-    0x00A7, 0x0087, 0x0087, 0x0887, 0x3949, 0xA330, 0x9AEF, 0x9B0F,
-    0x9AEF, 0x9B0F, 0xA30F, 0x92CF, 0x82CF, 0x3149, 0x1908, 0x1108,
-    0x00C7, 0x0087, 0x00A7, 0x0087, 0x0066, 0x0024, 0x10C6, 0x7AEE,
-    0xB512, 0x7D15, 0x9D13, 0x9CD2, 0x8452, 0xB3F0, 0x92CE, 0xEBED,
-    0xC36E, 0xAB4F, 0xD40F, 0xCBAE, 0xD3EE, 0xC38D, 0xCBAE, 0xCB8D,
-    0xC34D, 0xD38D, 0xCB8D, 0xCB8E, 0xC38E, 0xCBAE, 0xD3CE, 0xCB8E,
-    0xD3CE, 0xC34D, 0xCB8D, 0xD38D, 0xD38D, 0xEC2D, 0xAAEE, 0xBB6E,
-    0xB32E, 0xB32E, 0xC36E, 0xA2EE, 0xC36E, 0xA2EE, 0xB30E, 0xC36D,
-    0xBB2D, 0xA2CE, 0xC36E, 0xAAEE, 0xBB4E, 0xBB4E, 0xAAEE, 0xC38E,
-    0xA2CE, 0xBB6E, 0xB32E, 0x9ACF, 0xA2CF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0x9ACF, 0x9ACF, 0x9ACF, 0xA2EF, 0xA2CF, 0xA2EF, 0xB32E,
-    0xBB4E, 0xA2EF, 0xA2CE, 0xD3CF, 0xB32E, 0xB32E, 0xD3CE, 0xC36D,
-    0xD3AE, 0xCB6D, 0xCB8E, 0xD38E, 0xCB8D, 0xD3CE, 0xCB6D, 0xD3AE,
-    0xCB8E, 0xCB8D, 0xD3CE, 0xCB6D, 0xD3CE, 0xCB6D, 0xCB8E, 0xCB8E,
-    0xCB6D, 0xDBCE, 0xCB6D, 0xD3AE, 0xCB8D, 0xCB8D, 0xD3AE, 0xC36D,
-    0xD38D, 0xCB6D, 0xD38D, 0xCB8E, 0xCB8E, 0xDBCE, 0xCB8E, 0xD3AE,
-    0xD38D, 0xD38D, 0xD38D, 0xC36E, 0xA2CE, 0xC36E, 0xB30E, 0xAAEE,
-    0xD38D, 0xD3AD, 0xCB6D, 0xD3CE, 0xD3AE, 0xD3AE, 0xD3CE, 0xCB8E,
-    0xD3AE, 0xCB6D, 0xD38D, 0xD38D, 0xCB4D, 0xCB8D, 0xC34D, 0xD38D,
-    0xCB6D, 0xCB6D, 0xD3AD, 0xCB8E, 0xAB0E, 0xC36E, 0xD3CE, 0xD3AD,
-    0xCB6D, 0xD3AD, 0xCB6D, 0xD3AE, 0xCB8D, 0xCB6D, 0xD3AE, 0xCB6D,
-    0xD3AE, 0xB32E, 0xA2EF, 0xA2EF, 0xAB0E, 0xC36E, 0xCB8E, 0xAB0E,
-    0xA2EF, 0xB32E, 0xCB8E, 0xD3AE, 0xCB6D, 0xD3AE, 0xCB8D, 0xCB6D,
-    0xD3AD, 0xCB6D, 0xD3CE, 0xCB6D, 0xD3AE, 0xD3AD, 0xCB6D, 0xD3AE,
-    0xC34D, 0xD38D, 0xCB6D, 0xCB8D, 0xD3CE, 0xCB8D, 0xD3CE, 0xC36D,
-    0xCBAE, 0xBB6E, 0xAAEE, 0xCBCF, 0xA2CE, 0xC3AE, 0xAB2E, 0xB32E,
-    0xCBAE, 0xA2CE, 0xCBCE, 0xCBAD, 0xD3CE, 0xBB6E, 0x9ACE, 0xA2EF,
-    0x9ACF, 0xA2EF, 0x9ACF, 0x9ACF, 0xA2EF, 0x9AEF, 0xA30F, 0x9AEF,
-    0xA2EF, 0xA30F, 0xA2EF, 0xA2EF, 0x9ACF, 0xA2CF, 0xA2CF, 0x9ACF,
-    0xA2EF, 0x9AEE, 0xA30F, 0x9AEE, 0x9B10, 0x726D, 0x3128, 0x0066,
-    0x0087, 0x0066, 0x5A0A, 0x92EC, 0x7A6B, 0xA30E, 0xCBEF, 0xAB2F,
-    0xBB6E, 0xBB8E, 0xA30E, 0xBBAE, 0x620B, 0x5A0C, 0x624C, 0x39CB,
-    0x00E8, 0x0928, 0x00A7, 0x0066, 0x4189, 0x722C, 0x720C, 0xAB0F,
-    0x8432, 0xA4D2, 0x9492, 0x8C52, 0xBC0F, 0xDBCD, 0xCB6D, 0xC36D,
-    0xC36D, 0xD3CE, 0xD3EE, 0xC38D, 0xDBEE, 0xCB8E, 0xCBAE, 0xCB8D,
-    0xC34D, 0xD3AE, 0xA2CD, 0xC38E, 0xB32E, 0xB32E, 0xCBCE, 0xA2EE,
-    0xD3CE, 0xCB8D, 0xD3CD, 0xC38E, 0xA2EE, 0xCB8E, 0xA30E, 0xA2CF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA30F, 0xA2CE, 0xA2EF, 0xA2CF, 0x9ACF,
-    0xA2CE, 0xA2EF, 0x9ACE, 0xA2EF, 0xA2EF, 0xA2EE, 0xA2EF, 0xA2CF,
-    0xA2EF, 0xA2CF, 0xA2CE, 0xB32E, 0xC36E, 0xAAEE, 0xC38E, 0xAB0E,
-    0xBB4E, 0xBB4E, 0xAAEE, 0xC36E, 0xA2EE, 0xC36E, 0xAB0E, 0xCB8E,
-    0xE40E, 0xAB0E, 0xC38E, 0xD3AE, 0xCBAE, 0xD3AE, 0xD3AE, 0xC34D,
-    0xD3AE, 0xC34D, 0xCB8D, 0xD3AE, 0xCB8D, 0xDBEE, 0xC34D, 0xD3CE,
-    0xCB8D, 0xCB8D, 0xD3CE, 0xC34D, 0xD3CE, 0xC36D, 0xD3AE, 0xD38E,
-    0xC36D, 0xD3CE, 0xCB6D, 0xD3AE, 0xC36E, 0xC36D, 0xCBAE, 0xA2CE,
-    0xD3CE, 0xAAED, 0xC36E, 0xBB6E, 0xAAEE, 0xD3CE, 0xA2EE, 0xCBCE,
-    0xBB4E, 0xB32E, 0xCBAE, 0x9ACE, 0xA2EF, 0x9ACE, 0xA2EF, 0xA2CF,
-    0xAAEE, 0xD3AE, 0xA2CE, 0xCBAE, 0xBB2E, 0xB30E, 0xCBAF, 0xA2CE,
-    0xD3CE, 0xAAEE, 0xC36E, 0xC36E, 0xAACD, 0xCB8E, 0xA2AD, 0xCB8E,
-    0xB30E, 0xB32E, 0xD3CE, 0xA2EE, 0xAB0F, 0xA2EE, 0xC38E, 0xC36E,
-    0xAAEE, 0xD3CE, 0xA2CE, 0xCBAE, 0xB32E, 0xB30E, 0xCBAE, 0xA2CE,
-    0xD3AE, 0xB32E, 0xA2EF, 0xA30F, 0xA2EF, 0xA2EF, 0xA2CE, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xAB0E, 0xCBAE, 0xC34D, 0xD3AD, 0xCB6D, 0xCB8D,
-    0xD3AD, 0xC36D, 0xD3CE, 0xCB6D, 0xD3AD, 0xCBAD, 0xC36D, 0xD3CE,
-    0xC32D, 0xD38D, 0xCB6D, 0xCB6D, 0xD3CE, 0xC36D, 0xD3AE, 0xC36D,
-    0xCB8E, 0xCBAE, 0xCB8E, 0xCBCE, 0xC38D, 0xCBAE, 0xC38E, 0xCB8D,
-    0xCBAE, 0xCB8E, 0xD3AD, 0xEC2D, 0xE3ED, 0xCBAD, 0xBB4E, 0xA2EE,
-    0xC38E, 0xA2EE, 0xB34E, 0xB32E, 0xA2EE, 0xC38E, 0xA30E, 0xBB8F,
-    0xB34F, 0xA2EF, 0xA2EF, 0xA2CE, 0xC36E, 0xA2CE, 0xB30E, 0xB32E,
-    0xA2EE, 0xC38E, 0xA2EE, 0xC3CF, 0x82AC, 0x396A, 0x10E7, 0x08A6,
-    0x0087, 0x0045, 0x49A9, 0xBB6C, 0xE40E, 0xC38E, 0xD42F, 0xAB2F,
-    0xC38E, 0xC38E, 0xAB0D, 0xC3AE, 0x61CA, 0xA350, 0x8AEE, 0x298A,
-    0x00C7, 0x1128, 0x00A7, 0x0066, 0x4189, 0x92AE, 0xB32E, 0xBB6D,
-    0xB30D, 0xE42E, 0xC3AE, 0xC3AE, 0xDC0E, 0xAB0D, 0xDBEE, 0xBB0C,
-    0xCBAD, 0xD38D, 0xBB0D, 0xE42E, 0xB30D, 0xDC2E, 0xBB6E, 0xBB4E,
-    0xDC0E, 0xA2CD, 0xAAEE, 0xA2CE, 0xAAEF, 0xAAEE, 0xA2EE, 0xAB0F,
-    0xA2CE, 0xDC0E, 0xC36E, 0x9ACE, 0xA2EF, 0xA2CE, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA30F, 0xA2EF, 0xC38E, 0xDBEE, 0xAAEE, 0xDC0E, 0xB30E,
-    0xCBAE, 0xCBAE, 0xB30E, 0xDC0E, 0xAAEE, 0xDBCE, 0xBB4E, 0xBB6E,
-    0xDC0E, 0xAB0E, 0xDC2F, 0xAAEE, 0xCBAE, 0xC38E, 0xAAED, 0xE40F,
-    0xA2AD, 0xD3CE, 0xB34E, 0xBB4E, 0xDC0F, 0xA2CD, 0xE42F, 0xAAED,
-    0xCB8E, 0xD3CE, 0xBB0D, 0xE40E, 0xB2EC, 0xDBEE, 0xCB6D, 0xCB6D,
-    0xDBEE, 0xB2EC, 0xE40E, 0xBB2C, 0xC34E, 0xB34E, 0x9ACE, 0xA30F,
-    0x9ACE, 0xA2EF, 0xA2CE, 0xA2CF, 0xA2EF, 0xA2CE, 0xA30F, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EE, 0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA2EF,
-    0xA2EF, 0x9ACE, 0xA2EF, 0xA2CF, 0xAB0E, 0xB32E, 0xB30E, 0xB34E,
-    0xA2EE, 0xA2EF, 0xA2CE, 0xA2CE, 0xA2CF, 0x9AAE, 0xA2EF, 0xA2CE,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xAB0F, 0xA30F, 0xAB0F, 0xA2EE, 0xA2EF,
-    0xA30F, 0xA2CE, 0xA2EF, 0xA2CE, 0xA2EE, 0xA2EE, 0xA2CE, 0xA30F,
-    0xA2EE, 0xA2EF, 0xA30F, 0xA2EF, 0xA2EF, 0xA30F, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA30F, 0xA2EF, 0xA2CE, 0xDC0E, 0xBB0C, 0xD3CD, 0xD3AD,
-    0xBB0D, 0xEC2E, 0xB2EC, 0xDBEE, 0xC36D, 0xC34D, 0xDC0E, 0xB2EC,
-    0xE40E, 0xBB0C, 0xD38D, 0xD3CE, 0xBB0C, 0xE42E, 0xB2EC, 0xDBEE,
-    0xCB6D, 0xC34D, 0xDBEE, 0xB30C, 0xE42E, 0xBB2D, 0xD3AE, 0xD3AD,
-    0xBB2D, 0xE42E, 0xB30D, 0xD3CE, 0xC36D, 0xC36D, 0xDC0E, 0xBB2D,
-    0xE40E, 0xBB4D, 0xD3AE, 0xD3AE, 0xBB4D, 0xE42E, 0xBB2D, 0xDBEE,
-    0xCBAE, 0xAB2E, 0xA2EF, 0xB32E, 0xE3EE, 0xBB2D, 0xCB6D, 0xCB8D,
-    0xBB2D, 0xE42E, 0xB34D, 0xDC4F, 0x7249, 0x51CA, 0x7AEE, 0x08C6,
-    0x0066, 0x20E7, 0x1886, 0x5188, 0xCBAE, 0xDBEE, 0xA30E, 0xA30F,
-    0xA2EF, 0xA2EE, 0xA2EF, 0xA2CF, 0xAB30, 0xAB30, 0x51CA, 0x18E7,
-    0x2128, 0x0086, 0x00A7, 0x00A7, 0x0024, 0x3108, 0xBB6E, 0xD44D,
-    0xEC6E, 0xBB4D, 0xD3EE, 0xD3CE, 0xBB2D, 0xE42F, 0xA2CD, 0xDBED,
-    0xBB2D, 0xBB2D, 0xDBEE, 0xA2AD, 0xE44F, 0xB34E, 0xAAEE, 0xAB0E,
-    0xAAEE, 0xAAEE, 0xAAEE, 0xAAEF, 0xA2EF, 0xA2EF, 0xA30F, 0xA30F,
-    0xA30F, 0xA2EF, 0xA30F, 0xAAEF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EE, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xA2EE, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xAB0E, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EE, 0xA2EE, 0xA2EF, 0xA2EE, 0xA2EF,
-    0xA2EE, 0xA2EE, 0xA2EF, 0xA2EE, 0xA2EF, 0xA2CE, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA30F, 0xA2EE, 0xA30F, 0xA2EF, 0xA2EE, 0xA2EF, 0xA2EE,
-    0xA2EF, 0xA2EE, 0xA2EF, 0xA30F, 0xA2EE, 0xAB0F, 0xA2EE, 0xAB0F,
-    0xA2CE, 0xC36E, 0xE40E, 0xAACD, 0xE44F, 0xB30D, 0xCBAE, 0xD3CE,
-    0xB30D, 0xE42E, 0xAACD, 0xDBEE, 0xBB4E, 0x9ACF, 0xA30F, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA2EF, 0xA2EF, 0xAAEE, 0xA2EE, 0xD3AD, 0xF44D, 0xF44C, 0xEC2D,
-    0xB32E, 0xAB0E, 0xB30E, 0xAB0E, 0xAAEE, 0xAAEE, 0xAAEE, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA2EF, 0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA2EF, 0xA30F,
-    0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA2CE, 0xDC0E, 0xC36E, 0xC36E,
-    0xDC0E, 0xAAED, 0xEC4F, 0xB2ED, 0xD3AE, 0xD3CE, 0xB2ED, 0xE44F,
-    0xAACD, 0xE42F, 0xC36E, 0xBB2D, 0xE40E, 0xA2CD, 0xE44F, 0xB30D,
-    0xCBAE, 0xD3CE, 0xA2EE, 0xDC2F, 0x9ACD, 0xD3EF, 0xB34E, 0xB34E,
-    0xD40F, 0xA2CD, 0xDC2F, 0xAB0D, 0xD3CE, 0xCBAE, 0xAAED, 0xE42E,
-    0xB2EC, 0xDBEE, 0xC34D, 0xC34D, 0xDC0E, 0xAAEC, 0xE42E, 0xBB2D,
-    0xD3AE, 0xCBCE, 0xB32D, 0xE40E, 0xAACC, 0xDBCD, 0xBB2D, 0xBB2D,
-    0xDBCE, 0xAAEC, 0xE42F, 0xAB0C, 0xC3AE, 0xDC30, 0x930E, 0x08E7,
-    0x0065, 0x726C, 0xA330, 0x82AE, 0x826D, 0xA2EE, 0xA30F, 0xA30F,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA32F,
-    0x728D, 0x0085, 0x00A7, 0x00A6, 0x0886, 0x4989, 0xAB2F, 0xA2EE,
-    0xAAED, 0xDC0E, 0xC36E, 0xC36E, 0xE42E, 0xAB0E, 0xAAEE, 0xAAEE,
-    0xAAEE, 0xAAEE, 0xAAEE, 0xA2EE, 0xAAEE, 0xAB0E, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0x828E, 0x622E, 0x6A4E, 0x6A4F,
-    0x6A4F, 0x6A4E, 0x92CF, 0xAB2F, 0xA30F, 0xA30F, 0xA2EF, 0x9ACF,
-    0xCBAD, 0xF42D, 0xEC0C, 0xEC0C, 0xEC2D, 0xB30D, 0xCB8D, 0xF44D,
-    0xEC0D, 0xEC0D, 0xEC0D, 0xEC0D, 0xEC0D, 0xEC2D, 0xD3CD, 0xA2CE,
-    0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE,
-    0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EF, 0xA2EF, 0xA30F,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA2EF, 0xA2EE,
-    0xA2EE, 0xAB0F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA30F, 0xAB0E, 0xAB0E, 0xA2EE, 0xAB0E, 0xAAEE, 0xAAEE, 0xAAEE,
-    0xA2EE, 0xAB0E, 0xA30F, 0xAB0E, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA2EF, 0xAACE, 0xD3AD, 0xE40D, 0xEC0C, 0xF42C, 0xF42C, 0xF42C,
-    0xEC2D, 0xEC0D, 0xEC0C, 0xEC0D, 0xEC0D, 0xEC0C, 0xEC0D, 0xB30D,
-    0xA2CE, 0xA2EF, 0xA30F, 0xA2EF, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA2EF, 0xA2EF, 0xA30F,
-    0xA30F, 0xA2EF, 0xA2EF, 0xA30F, 0xA2EF, 0xAB0E, 0xAB0E, 0xAB0E,
-    0xAB0E, 0xA2EE, 0xAB0E, 0xA2EE, 0xAAEE, 0xAB0E, 0xA2EE, 0xAB0E,
-    0xAB0E, 0xAB0E, 0xAB0E, 0xA30E, 0xAB0E, 0xA2EE, 0xAB0E, 0xA30F,
-    0xAB0F, 0x92AE, 0x6A2E, 0x724E, 0x6A4E, 0x724E, 0x6A4E, 0x6A4E,
-    0x724E, 0x6A4E, 0x724D, 0x9AEF, 0xAB0E, 0xAB0E, 0xA2EF, 0xB30D,
-    0xE42F, 0xAB0D, 0xCBAE, 0xD3CE, 0xB32D, 0xE42F, 0xB30D, 0xE40E,
-    0xC38E, 0xC34D, 0xE3EE, 0xAAED, 0xE42E, 0xB30D, 0xCB8D, 0xD3CE,
-    0xB32D, 0xE42E, 0xAAED, 0xD3EE, 0xCBCF, 0x724C, 0x1907, 0x1989,
-    0x00A7, 0x1086, 0x1886, 0x418B, 0x724D, 0xA2EF, 0xA2EF, 0xA30F,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA2EF, 0xA2CF, 0xAB0F, 0x620B,
-    0x0885, 0x00A6, 0x00A7, 0x0066, 0x5A2C, 0xAB70, 0xA32F, 0xAB2F,
-    0xA2EE, 0xB34E, 0xAB2E, 0xAB0E, 0xB34E, 0xAB0F, 0xA2EE, 0xA2EF,
-    0xA2EF, 0xA2EE, 0xA2EF, 0xAB0F, 0xA2EF, 0xAAEF, 0xAB0F, 0x92CF,
-    0x726E, 0x726F, 0x726F, 0x726F, 0x6A4F, 0x622F, 0x622F, 0x624F,
-    0x6A4F, 0x624F, 0x726F, 0x726F, 0x726F, 0x726F, 0x726F, 0x6A2E,
-    0xC38D, 0xFC6C, 0xFC4C, 0xFC4C, 0xF42C, 0xE3EC, 0xEC0C, 0xF44C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xEC0C, 0xDBED,
-    0xDBED, 0xE3ED, 0xDBED, 0xDBCD, 0xDBED, 0xDBED, 0xDBED, 0xDBED,
-    0xE40D, 0xEC2E, 0xEC0E, 0xEC0E, 0xE40E, 0xB32E, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA30F, 0xA30F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0x9AEF, 0x726F, 0x622E, 0x5A2E, 0x622E, 0x622E, 0x5A2E, 0x622E,
-    0xA2EF, 0xAB0F, 0xA30F, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2CE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0xA2EE, 0x9ACE,
-    0xB30E, 0xE3ED, 0xEC0C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xE3ED,
-    0xB32D, 0x9AAE, 0xA2CE, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA2EF,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA30F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xA30F, 0xA30F,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xA30F, 0xAB0F, 0xA30F, 0x828F,
-    0x6A4E, 0x6A4F, 0x622F, 0x622F, 0x624F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x624F, 0x622F, 0x724F, 0x726E, 0x724F, 0x724E, 0x724E,
-    0x82AE, 0x726E, 0x9AEE, 0xB32E, 0xA2EE, 0xB34E, 0xA2EE, 0xB32E,
-    0xAB0E, 0xAAEE, 0xB32E, 0xA2CE, 0xB32E, 0xA30F, 0xAB2E, 0xB34E,
-    0xAB0E, 0xB32E, 0x9ACE, 0xB32E, 0x59EA, 0x1928, 0x0949, 0x1149,
-    0x00A7, 0x49EC, 0x51ED, 0x6A4D, 0x9AEF, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xA30F, 0xAB30, 0x59EA, 0x0885,
-    0x0045, 0x00A6, 0x00A6, 0x00A7, 0x10C7, 0x59EB, 0xAB50, 0xA30F,
-    0xAB0F, 0xA2EF, 0xA2EF, 0xA2EE, 0xA2EF, 0xAB0E, 0xAB0F, 0xAB0F,
-    0xAB0F, 0xAB0F, 0x9AEF, 0x7A6E, 0x7A6E, 0x7A6E, 0x828E, 0x726F,
-    0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x6A4F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x5A2F,
-    0x82AE, 0xA30D, 0x9AED, 0xAB2D, 0xF44D, 0xFC6C, 0xF44C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xFC4C, 0xFC4C, 0xFC4C, 0xFC4C, 0xFC4C, 0xFC6D,
-    0xC38D, 0x9B0E, 0xA30E, 0xAB2E, 0xCB8E, 0xB32E, 0xA2EF, 0xAB0F,
-    0xA30F, 0xA30F, 0xA30F, 0xA30F, 0xAB0F, 0x92CF, 0x7A8F, 0x7A8F,
-    0x828F, 0xA30F, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F, 0xA30F, 0xA30F,
-    0xAB2F, 0x8AAF, 0x6A4E, 0x726E, 0x726E, 0x726E, 0x724E, 0x724E,
-    0x6A4E, 0x520E, 0x49EE, 0x41EE, 0x49EE, 0x49EE, 0x49EE, 0x49EE,
-    0x726F, 0x6A4E, 0x622E, 0x7A8E, 0x9ACF, 0x9ACF, 0x9ACE, 0xC38D,
-    0xD3CD, 0xD3AD, 0xD3AD, 0xD3AD, 0xD3AD, 0xD3AD, 0xD3AD, 0xD3AD,
-    0xDBCD, 0xFC4C, 0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF44C, 0xFC4C,
-    0xE3ED, 0xDBCD, 0xCB8E, 0xA2EE, 0xAB0F, 0xAB0F, 0xAB0F, 0xAB0F,
-    0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA30F, 0xAB0F, 0xA30F, 0xAB0F, 0xAB0F,
-    0x92AF, 0x7A6F, 0x7A8F, 0x828F, 0x828F, 0x828F, 0x828F, 0x8AAF,
-    0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA30F, 0x9AEF, 0x7A8F,
-    0x7A8F, 0x828F, 0x828F, 0x828F, 0x828F, 0x7A8F, 0x828F, 0x6A4F,
-    0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622E,
-    0x5A2F, 0x5A2E, 0x8AAF, 0xAB0F, 0xA30F, 0xA2EF, 0xA30F, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EE, 0xA30F, 0xA2EF, 0xAB0F, 0xAB0F, 0xA2EF,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0x59EC, 0x1908, 0x00C7, 0x08E8,
-    0x0087, 0x2129, 0x520D, 0x728F, 0x82AF, 0x828F, 0x828F, 0x828F,
-    0x828F, 0x828F, 0x828F, 0x828F, 0x828F, 0x82AF, 0x51EC, 0x49CB,
-    0x520B, 0x0086, 0x00A7, 0x08C7, 0x0045, 0x3169, 0xAB50, 0xA30F,
-    0xA2EF, 0xA2EF, 0xA2EF, 0xAAEF, 0xAB0F, 0xAB0F, 0x92CF, 0x8ACF,
-    0x8ACF, 0x8ACF, 0x828F, 0x5A0E, 0x5A2E, 0x5A2E, 0x5A2E, 0x622F,
-    0x624F, 0x624F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x622F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x622F, 0x622F, 0x5A0F, 0x6A4E, 0xB36E, 0xBB4D, 0xDBED, 0xFC4C,
-    0xFC4C, 0xFC4C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xFC2C, 0xFC2C,
-    0xF42C, 0xFC4C, 0xD3AD, 0xB34D, 0xB36D, 0xB34D, 0xB34E, 0xBB6E,
-    0x7A8E, 0x520F, 0x5A2F, 0x622F, 0x828F, 0x8AAF, 0x8AAF, 0x8AAF,
-    0x8AAF, 0x8AAF, 0x8AAF, 0x8AAF, 0x8ACF, 0x7A8F, 0x5A2E, 0x622F,
-    0x622F, 0x82AF, 0x8ACF, 0x8AAF, 0x8AAF, 0x8AAF, 0x8AAF, 0x8AAF,
-    0x8ACF, 0x726F, 0x51EE, 0x520E, 0x49EE, 0x41CE, 0x41CE, 0x41EE,
-    0x41EE, 0x49EE, 0x49EE, 0x49EE, 0x4A0E, 0x49EE, 0x41EE, 0x49EE,
-    0x41CE, 0x7A8E, 0x8AAD, 0xA2ED, 0xC36D, 0xBB4D, 0xC34D, 0xEC0C,
-    0xFC4C, 0xF44C, 0xF44C, 0xF44C, 0xFC4C, 0xFC4C, 0xFC4C, 0xFC4C,
-    0xFC2C, 0xF40C, 0xF42C, 0xF40C, 0xF40C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF40C, 0xF42C, 0xF42C, 0xF44C, 0xF44D, 0xD3CD, 0xCBAD,
-    0xD3CD, 0xDBED, 0xCBAE, 0xA2EE, 0x8AAE, 0x8AAF, 0x8AAF, 0x8AAF,
-    0x92CF, 0xA30F, 0xA30F, 0xA2EF, 0xA30F, 0xA30F, 0xA30F, 0xA30F,
-    0xA30F, 0xAAEF, 0xAB0F, 0x9AEF, 0x8AAF, 0x8AAF, 0x8AAF, 0x8AAF,
-    0x726F, 0x5A2E, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x7A8F,
-    0xA30F, 0xA2EF, 0xA2EF, 0xA2EF, 0xA30F, 0x9AEF, 0x7A8F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x6A4F, 0x624F, 0x7A8F, 0x92CF, 0x8AAF, 0x8AAF, 0x8AAF, 0x8AAF,
-    0x9ACF, 0xAAEF, 0xA2EF, 0x8AAF, 0x8ACF, 0x8ACF, 0x8ACF, 0x9AEF,
-    0xAB0F, 0xA2EF, 0x8AAE, 0x82AF, 0x726F, 0x49CD, 0x18E9, 0x08A8,
-    0x296B, 0x0087, 0x39AB, 0x6A70, 0x5A2F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A4F, 0x6A4E,
-    0x41CB, 0x0086, 0x00A7, 0x0087, 0x2929, 0x724C, 0xAB30, 0xA30F,
-    0xA2EE, 0xA2EF, 0x9ACF, 0x92CF, 0x9ACF, 0x92CF, 0x6A4F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x622F,
-    0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x6A4F, 0x5A2F, 0x5A0E, 0x5A0E, 0x5A2E, 0x5A2E, 0x5A2E,
-    0x5A2E, 0x624F, 0x6A4F, 0x6A4F, 0x622E, 0x59EE, 0xA32E, 0xD3ED,
-    0xCBAD, 0xD3CC, 0xF42C, 0xF42C, 0xF42C, 0xE3EC, 0xCBAD, 0xD3AD,
-    0xCBAD, 0xD3CD, 0x92CE, 0x59EE, 0x620F, 0x5A0E, 0x620F, 0x620E,
-    0x622F, 0x6A4F, 0x6A4F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622E, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x6A4F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x6A4F, 0x6A6F, 0x624F, 0x622F, 0x49EE, 0x49EE, 0x49EE,
-    0x49EE, 0x49EE, 0x49EE, 0x49EE, 0x49EE, 0x5A2E, 0x7A8D, 0x726D,
-    0x7A6D, 0xDC0D, 0xFC8D, 0xF44C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF40C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xF42C,
-    0xF42C, 0xF42C, 0xEBEC, 0xE3ED, 0xE3ED, 0xCBCE, 0x92CE, 0x8AAF,
-    0x8AAE, 0x8AAE, 0x92AE, 0x92CF, 0x622E, 0x622F, 0x622F, 0x622F,
-    0x6A4F, 0x92EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0xA2EF, 0x92CF,
-    0x92CF, 0x92CF, 0x9ACF, 0x828F, 0x5A0E, 0x622F, 0x622F, 0x622E,
-    0x622F, 0x624F, 0x624F, 0x624F, 0x726F, 0x7A8F, 0x7A6F, 0x8AAF,
-    0xA30F, 0xA2EF, 0x92CF, 0x92CF, 0x92CF, 0x7A8F, 0x5A0E, 0x622F,
-    0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x5A0E, 0x5A0E, 0x520E, 0x520E, 0x5A0E, 0x5A0E, 0x5A0E, 0x5A0E,
-    0x828F, 0x9ACF, 0x8AAF, 0x622E, 0x622F, 0x624F, 0x622E, 0x726F,
-    0x9AEF, 0x8AAF, 0x620E, 0x5A0E, 0x5A0E, 0x6A4F, 0x51ED, 0x08A7,
-    0x4A2E, 0x294A, 0x49CD, 0x6A70, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x6A4F, 0x41AC,
-    0x08A7, 0x00A7, 0x00A7, 0x0066, 0x6A2D, 0xA330, 0x8AAE, 0x92CF,
-    0x9AEF, 0xA2EF, 0x7A8F, 0x622E, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F,
-    0x5A2F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x624F, 0x41CD, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x41CD, 0x624F, 0x622F, 0x6A4F, 0x6A4F, 0x6A2E, 0x6A2E,
-    0x622E, 0x724D, 0xDBEE, 0xE40D, 0xEC2D, 0xAB2E, 0x5A0E, 0x622E,
-    0x622E, 0x622E, 0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x520F, 0x624F, 0x520E, 0x49EE, 0x49EE,
-    0x49EE, 0x49EE, 0x49EE, 0x49EF, 0x49CD, 0x92CC, 0xFC6D, 0xF44D,
-    0xF44D, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40B, 0xF40B, 0xF40C,
-    0xEC0C, 0xE40D, 0xE40D, 0xEC0D, 0xF42C, 0xF42C, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF42C, 0xF40C, 0xEC0C,
-    0xEBED, 0xEC0D, 0xBB4D, 0x9ACE, 0x92CE, 0x6A2E, 0x6A4F, 0x6A4F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x622F, 0x6A4E, 0x92EF, 0xA2EF, 0xA2EF, 0xAB0F, 0x92CF, 0x6A2E,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x6A4F, 0x9B0F, 0xA30F, 0x9B0F, 0x9B0F,
-    0x9AEF, 0x92EF, 0x6A2E, 0x622E, 0x622E, 0x622F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x6A4E, 0x6A4E, 0x6A4E, 0x6A4E, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x5A2F, 0x5A2F, 0x5A2F, 0x5A2F,
-    0x318C, 0x298C, 0x298C, 0x318C, 0x318C, 0x298C, 0x298C, 0x5A0E,
-    0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x622F, 0x622E, 0x622F, 0x622F, 0x622F, 0x622F, 0x49CD, 0x0086,
-    0x10E8, 0x5A2E, 0x6A70, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x624F, 0x622F, 0x622F, 0x6A70,
-    0x520E, 0x08A7, 0x00C8, 0x0087, 0x49AC, 0x5A0E, 0x49ED, 0x6A4F,
-    0x6A4F, 0x6A4E, 0x6A4F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x5A2F, 0x318C, 0x318C, 0x318D, 0x31AD,
-    0x318C, 0x31AC, 0x624F, 0x6A4F, 0x624F, 0x6A4F, 0x5A2F, 0x318C,
-    0x31AC, 0x318C, 0x318C, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x31AC, 0x318C, 0x39AC, 0x624F, 0x6A4F, 0x6A4F, 0x624F,
-    0x624F, 0x624F, 0x724E, 0x724D, 0x724D, 0x6A4E, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x5A2E, 0x318C, 0x31AD, 0x31AC,
-    0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x318C, 0x39AD, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x622E, 0x622E, 0x622E, 0x622E, 0x622E, 0x622E, 0x622E, 0x622E,
-    0x622F, 0x5A2F, 0x41EE, 0x49EE, 0x49EE, 0x49EE, 0x49EE, 0x49EE,
-    0x49EE, 0x49EE, 0x49CE, 0x41AD, 0x9B0D, 0xF44D, 0xF42C, 0xF42C,
-    0xF42C, 0xF42C, 0xF44D, 0xF44C, 0xF44C, 0xF44C, 0xF42C, 0xFC4D,
-    0xA30D, 0x6A2D, 0x724E, 0x7A6D, 0xE42D, 0xF44C, 0xF42D, 0xF42C,
-    0xF42C, 0xF42C, 0xF40C, 0xF40C, 0xF40C, 0xF42C, 0xEC0D, 0xC34D,
-    0x9ACE, 0x9ACE, 0x7A6E, 0x6A2E, 0x6A4F, 0x624F, 0x6A4F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x9AEF, 0xAB0F, 0xA30F, 0xA30F, 0x9B0F,
-    0x6A4F, 0x622F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x622F, 0x6A4E, 0x6A2E, 0x6A4E, 0x6A4E,
-    0x6A4E, 0x6A4F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x5A0E, 0x92EE, 0xBB8E, 0xB36E, 0xAB6F, 0x6A4E, 0x622F,
-    0x6A4F, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x39AD, 0x318C, 0x318D, 0x318D, 0x31AD,
-    0x318D, 0x318D, 0x29AD, 0x31AD, 0x318D, 0x298D, 0x298C, 0x5A2E,
-    0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x6A4F, 0x49ED, 0x0086,
-    0x49ED, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F,
-    0x6A4F, 0x5A4E, 0x08C7, 0x41CC, 0x622F, 0x622F, 0x622F, 0x6A4F,
-    0x622F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x5A2F, 0x39AD, 0x298C, 0x29AD,
-    0x298C, 0x298C, 0x39AD, 0x39AD, 0x39AD, 0x39AD, 0x39AD, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x29AD, 0x298C, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AC, 0x298C, 0x39AD, 0x39AC, 0x520E, 0x6A6F,
-    0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F,
-    0x41CD, 0x39AD, 0x39AD, 0x39CD, 0x31AD, 0x298D, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x29AD, 0x29AD,
-    0x298C, 0x29AD, 0x39AD, 0x39CD, 0x39CD, 0x31AD, 0x296C, 0x418B,
-    0xC3AD, 0xDC0E, 0xD40E, 0xDC0E, 0xDC0E, 0xD3EE, 0xD3EE, 0xD40E,
-    0x92EE, 0x5A0E, 0x5A2F, 0x5A2F, 0x5A2F, 0x622F, 0x520E, 0x49EE,
-    0x49EE, 0x520E, 0xC3CE, 0xD3ED, 0xA30E, 0x828E, 0x82AE, 0x82AE,
-    0x82AE, 0x82AE, 0x82AE, 0x82AE, 0x82AE, 0x82AE, 0x82AE, 0x8AAE,
-    0x726E, 0x622F, 0x622F, 0x622E, 0x82AE, 0x82AE, 0x7A6E, 0xB34D,
-    0xFC8D, 0xFC4C, 0xFC4C, 0xFC4C, 0xFC6C, 0xD3AD, 0x7A6E, 0x7A6E,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x622F, 0x624F, 0x6A4F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x622F, 0x724F, 0x726F, 0x726F, 0x726F, 0x726F,
-    0x6A4F, 0x622F, 0x622F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x622F,
-    0x622E, 0x930E, 0xBB6D, 0xC38D, 0xC38D, 0xC38E, 0xAB4E, 0xB36F,
-    0x828E, 0x5A0E, 0x620F, 0x620F, 0x620E, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x5A2E, 0x520E, 0x520E, 0x39AD, 0x296C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298D, 0x298C, 0x298C, 0x31AC,
-    0x520E, 0x6A6F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x49EE, 0x39AD, 0x318B, 0x0886,
-    0x318C, 0x39AD, 0x39AD, 0x39CD, 0x39AD, 0x39CD, 0x39AD, 0x5A2F,
-    0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x6A70,
-    0x5A0E, 0x1909, 0x0086, 0x49ED, 0x7270, 0x51EE, 0x318C, 0x39AD,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x622F, 0x622F, 0x624F,
-    0x6A4F, 0x5A2E, 0x41CD, 0x41CE, 0x41EE, 0x31AD, 0x298D, 0x29AD,
-    0x29AD, 0x29AD, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298C, 0x39AD, 0x41ED,
-    0x41ED, 0x41CD, 0x41ED, 0x41ED, 0x41ED, 0x41ED, 0x41ED, 0x41CD,
-    0x298C, 0x298C, 0x298D, 0x298C, 0x298C, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x298C, 0x29AD, 0x216C, 0x5A2C, 0xAB6D, 0xAB2C,
-    0xF44D, 0xB34D, 0x9B0D, 0xA30E, 0xA30E, 0xA32E, 0xA30E, 0xA32E,
-    0x7A8E, 0x622F, 0x6A4F, 0x624F, 0x624F, 0x6A4F, 0x622F, 0x5A2F,
-    0x5A0F, 0x622E, 0x9B0E, 0xAB0D, 0x7A6E, 0x5A0F, 0x622F, 0x622F,
-    0x622F, 0x5A2F, 0x5A2F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x5A2F, 0x7A6E,
-    0xA30E, 0x9AED, 0x9AED, 0xA2EE, 0xAB2E, 0x828E, 0x39AD, 0x41CE,
-    0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x49CD, 0x624F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x49EE, 0x41CD, 0x41CD,
-    0x41ED, 0x41EE, 0x41ED, 0x41CD, 0x5A2E, 0x6A4F, 0x624F, 0x624F,
-    0x622E, 0xAB4E, 0xCBAD, 0xC3AE, 0xC3AE, 0xC3AE, 0xC3AE, 0xC3AE,
-    0xAB2E, 0x9B0E, 0x9B2E, 0x9B0E, 0x9B0F, 0x726F, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x624F, 0x622F, 0x5A0E, 0x49EE,
-    0x49EE, 0x49EE, 0x520E, 0x41CD, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x39AD, 0x41ED, 0x41ED, 0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x41CD,
-    0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x31AD, 0x298D, 0x216B, 0x08A7,
-    0x216B, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x39CD,
-    0x41CE, 0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x41CD, 0x41EE,
-    0x39AD, 0x08E8, 0x0086, 0x318B, 0x41EE, 0x39AD, 0x298C, 0x298C,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x520E,
-    0x4A0E, 0x39CD, 0x298C, 0x298C, 0x298C, 0x298D, 0x29AD, 0x29AD,
-    0x298D, 0x29AC, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x298C,
-    0x29AD, 0x298D, 0x298D, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x29AD, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x318D, 0x7A8D, 0xC3AE, 0xBB6E,
-    0xB34E, 0x6A4E, 0x59EE, 0x5A0E, 0x5A0E, 0x5A0E, 0x5A0E, 0x5A0E,
-    0x622F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x6A4F, 0x624F, 0x5A0F, 0x5A0E, 0x622F, 0x624F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x520E, 0x49EE,
-    0x5A2E, 0x6A4F, 0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F,
-    0x622F, 0x622F, 0x622F, 0x51EE, 0x49CE, 0x41AD, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x49EE, 0x51EE,
-    0x49EE, 0x5A2E, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x622F, 0x622F, 0x622F,
-    0x624F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x5A2E, 0x49EE, 0x49EE, 0x49EE, 0x4A0E, 0x31AD, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x41CD, 0x520E, 0x49EE, 0x49EE,
-    0x49EE, 0x8ACE, 0xA30E, 0x9B0E, 0x9AEE, 0x9B0E, 0xC38E, 0xC38D,
-    0xC3AE, 0xB36E, 0x9B0E, 0x9B0E, 0x9B2F, 0x726E, 0x622F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F, 0x6A4F,
-    0x6A4F, 0x6A4F, 0x6A70, 0x520E, 0x298C, 0x318D, 0x29AC, 0x29AC,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x31AD, 0x216B, 0x00A7,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x218C, 0x1149, 0x0086, 0x194A, 0x298C, 0x298C, 0x29AD, 0x29AD,
-    0x624F, 0x6A4F, 0x5A2F, 0x5A2E, 0x5A2E, 0x5A0E, 0x5A2E, 0x31AD,
-    0x298C, 0x298C, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D,
-    0x29AD, 0x298C, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x298D, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD, 0x31AD, 0x318D,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x298D, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x31AD, 0x298C, 0x49EE, 0x5A2E, 0x51CD, 0x51EE,
-    0x51EE, 0x622E, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F,
-    0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x624F,
-    0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x5A2E, 0x5A2F,
-    0x5A2E, 0x5A2E, 0x5A2E, 0x5A2E, 0x5A2E, 0x5A2E, 0x318C, 0x216C,
-    0x41ED, 0x5A2F, 0x520E, 0x5A2E, 0x5A2E, 0x5A2E, 0x5A2E, 0x5A2E,
-    0x5A2E, 0x5A2E, 0x5A2E, 0x39AC, 0x298C, 0x298C, 0x31AD, 0x29AD,
-    0x31AD, 0x29AD, 0x29AD, 0x318D, 0x29AD, 0x29AD, 0x298C, 0x298C,
-    0x298C, 0x39CD, 0x5A2F, 0x5A0E, 0x5A2F, 0x5A2E, 0x5A2E, 0x5A2F,
-    0x5A2F, 0x5A2F, 0x5A0E, 0x622F, 0x6A4F, 0x624F, 0x622F, 0x622F,
-    0x624F, 0x5A2E, 0x5A2E, 0x5A2E, 0x5A0E, 0x5A2E, 0x5A0E, 0x5A2E,
-    0x39CD, 0x298C, 0x298C, 0x298C, 0x298C, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x49CE, 0x51EE, 0x59EE, 0x620F, 0x6A2E, 0xA34F, 0xAB4E,
-    0xAB4E, 0x8ACE, 0x5A0E, 0x622F, 0x5A0F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F, 0x520E,
-    0x520E, 0x520E, 0x522F, 0x41CD, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298D, 0x298D, 0x298C, 0x298C, 0x298D, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x298D, 0x298C, 0x298C, 0x298C, 0x31AD, 0x296B, 0x10E8,
-    0x298C, 0x298C, 0x29AC, 0x298C, 0x298C, 0x298C, 0x298D, 0x298D,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x31AD,
-    0x298C, 0x194A, 0x08C8, 0x216B, 0x31AD, 0x29AD, 0x29AD, 0x29AD,
-    0x622F, 0x624F, 0x41CD, 0x298C, 0x318C, 0x298C, 0x298C, 0x29AD,
-    0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x298D, 0x298C, 0x298C, 0x318C, 0x318C,
-    0x298C, 0x520E, 0x624F, 0x5A2F, 0x622E, 0x622F, 0x5A2F, 0x622E,
-    0x5A2E, 0x622F, 0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x622F, 0x624F, 0x49EE, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x318C, 0x31AD,
-    0x318C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x318C, 0x318D, 0x318D, 0x318D,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x520E, 0x624F, 0x622F, 0x5A2F, 0x5A2F,
-    0x622F, 0x39AD, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x31AD, 0x318D, 0x298C, 0x41CD, 0x622F, 0x622F, 0x6A2F, 0x622E,
-    0x622E, 0x622E, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x5A2E, 0x318C,
-    0x318C, 0x318C, 0x318C, 0x318C, 0x318D, 0x318D, 0x31AC, 0x318D,
-    0x29AD, 0x29AC, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x298C, 0x298C, 0x298D, 0x298D, 0x29AC, 0x29AC,
-    0x298C, 0x298C, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AC, 0x29AC, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x31AC, 0x31AC, 0x318D, 0x298D, 0x318D, 0x29AD, 0x298D, 0x29AC,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x298D, 0x298D,
-    0x29AC, 0x31AC, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x298C, 0x41ED, 0x6A4F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x6A4F, 0x41ED, 0x298C, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x298D, 0x298D, 0x298D, 0x298C, 0x31AD, 0x318D, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x298D,
-    0x29AD, 0x29AD, 0x298C, 0x31AC, 0x31AD, 0x31AD, 0x31AD, 0x31AD,
-    0x318D, 0x31AD, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x298D, 0x29AD, 0x29AD, 0x31AD, 0x39AD, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x622F, 0x622F, 0x624F, 0x624F, 0x624F, 0x624F, 0x622F,
-    0x622F, 0x622F, 0x622F, 0x622F, 0x624F, 0x622F, 0x624F, 0x31AD,
-    0x298C, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298D, 0x298D, 0x298D, 0x298D,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x298C, 0x298D, 0x318D, 0x318D, 0x298D, 0x29AD, 0x29AC, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x298C, 0x31AD, 0x39CD, 0x39AD, 0x39AD, 0x39AD, 0x520E, 0x6A6F,
-    0x5A2F, 0x39AD, 0x39AD, 0x39AD, 0x31AD, 0x298D, 0x29AD, 0x298D,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x29AD,
-    0x298C, 0x29AD, 0x318D, 0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x298D, 0x298D, 0x29AD, 0x298D, 0x298D, 0x39AD, 0x39AD,
-    0x39AD, 0x39AD, 0x39AD, 0x41CD, 0x624F, 0x6A4F, 0x6A6F, 0x520E,
-    0x41CD, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x624F, 0x624F,
-    0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x624F, 0x6A4F, 0x5A4F,
-    0x39CD, 0x298C, 0x31AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x318C, 0x318D, 0x318D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x298C, 0x298C, 0x298C, 0x298C, 0x39CD, 0x49EE,
-    0x41CD, 0x298C, 0x298D, 0x298C, 0x298D, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x41ED, 0x41ED, 0x41EE, 0x39AD,
-    0x31AC, 0x41ED, 0x41CD, 0x41ED, 0x41CD, 0x520E, 0x6A6F, 0x624F,
-    0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x6A4F, 0x624F, 0x49ED, 0x49EE,
-    0x39AD, 0x298C, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AC, 0x318D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298C,
-    0x298C, 0x318D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298C, 0x298C, 0x298C,
-    0x29AD, 0x298C, 0x298C, 0x298C, 0x298C, 0x39AD, 0x520E, 0x49EE,
-    0x4A0E, 0x4A0E, 0x49EE, 0x49EE, 0x4A0E, 0x49EE, 0x298C, 0x298C,
-    0x298C, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AC, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298C, 0x298C, 0x298C,
-    0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x298C, 0x29AD, 0x29AD,
-    0x298D, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AC, 0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AC, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x298D, 0x29AC, 0x29AC, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD, 0x29AD, 0x298D,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x298D, 0x29AD,
-    0x298D, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD,
-    0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD, 0x29AD
-};
-
-#endif // SPRITE_BG_SIERRA_H
@@ -27,16 +27,13 @@
 // Fish sprites (10 species)
 #include "fish_sprites.h"
 
-// Background sprites
-#include "bg_sierra_data.h"
-#include "bg_delta_data.h"
+// Backgrounds are streamed from SD (bg_stream.h), not compiled in
 
 // UI elements (coins, pellets, hearts, buttons)
 #include "ui_sprites.h"
 
-// Visual effects (bubbles, sparkles, splash)
-// TODO: Uncomment when effect sprite data is converted
-// #include "effect_sprites.h"
+// Visual effects (bubbles, sparkles, splash) are loaded from SD
+// (/sprites/effects/, also in the pack), not compiled in
 
 // ============================================================================
 // SPRITE HELPER MACROS
@@ -0,0 +1,60 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// ============================================================================
+// SINGLE-PRODUCER / SINGLE-CONSUMER RING
+// ============================================================================
+//
+// A fixed ring of plain-data items passed from one task to another without
+// a lock: only the producer moves head, only the consumer moves tail. The
+// producer writes the item before publishing head (release) and the
+// consumer reads it only after seeing that head (acquire), so an item is
+// never read half written. Neither side ever blocks; a full ring refuses
+// the push and the producer decides what to drop.
+//
+// Capacity must be a power of two. Head and tail run freely and wrap, so a
+// full ring holds all Capacity items.
+//
+
+template <typename T, uint16_t Capacity>
+struct SpscRing
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    T items[Capacity];
+    std::atomic<uint16_t> head{0}; // Next slot to write (producer)
+    std::atomic<uint16_t> tail{0}; // Next slot to read (consumer)
+
+    // Producer: false if the ring is full
+    bool push(const T &item)
+    {
+        uint16_t h = head.load(std::memory_order_relaxed);
+        if ((uint16_t)(h - tail.load(std::memory_order_acquire)) >= Capacity)
+            return false;
+        items[h & (Capacity - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: false if the ring is empty
+    bool pop(T &item)
+    {
+        uint16_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+            return false;
+        item = items[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Either side: items waiting (a snapshot; the other side may move on)
+    uint16_t size() const
+    {
+        return (uint16_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+    }
+};
+
+#endif // SPSC_RING_H
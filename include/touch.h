@@ -7,6 +7,18 @@
 // ============================================================================
 // TOUCH DATA
 // ============================================================================
+//
+// A sampler task owns the XPT2046. It sleeps until the IRQ line falls (pen
+// down), then reads the controller every TOUCH_SAMPLE_MS until the pen
+// lifts. Readings outside the pressure window are dropped, and positions
+// are the median of the last TOUCH_FILTER_SAMPLES good readings, so one
+// noisy conversion neither starts a press nor makes the point jump.
+//
+// Each press becomes a DOWN, any number of MOVEs and an UP, stamped with
+// the millis() they were sampled at. The events go into a lock-free ring
+// that the update task drains each step (touchPollEvent), so a slow step
+// or frame delays input but never loses it.
+//
 
 struct TouchPoint {
     int16_t x;
@@ -15,6 +27,20 @@ struct TouchPoint {
     bool valid;
 };
 
+enum TouchEventType : uint8_t {
+    TOUCH_DOWN = 0, // Pen down (first filtered position)
+    TOUCH_MOVE,     // Moved at least TOUCH_MOVE_MIN pixels
+    TOUCH_UP        // Pen up (last position seen)
+};
+
+struct TouchEvent {
+    uint8_t type;
+    int16_t x;
+    int16_t y;
+    uint16_t pressure;
+    uint32_t time; // millis() when sampled
+};
+
 // ============================================================================
 // TOUCH FUNCTIONS
 // ============================================================================
@@ -22,20 +48,18 @@ struct TouchPoint {
 // Initialize touch controller
 void touchInit();
 
-// Read current touch state (call once per frame)
-void touchUpdate();
+// Start the sampler task and the pen-down interrupt (call once the display
+// is up: the sampler shares its bus)
+void touchStart();
 
-// Get current touch point (valid only if touched)
-TouchPoint touchGet();
+// Update task: take the oldest queued event (false when there are none)
+bool touchPollEvent(TouchEvent &event);
 
 // Check if screen is currently being touched
 bool touchIsPressed();
 
-// Check if a new tap occurred this frame
-bool touchTapped();
-
-// Get the tap position (only valid if touchTapped() is true)
-TouchPoint touchGetTap();
+// Events lost to a full ring since boot
+uint32_t touchDroppedEvents();
 
 // Calibration (for debug/setup)
 void touchCalibrate();
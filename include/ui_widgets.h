@@ -0,0 +1,65 @@
+#ifndef UI_WIDGETS_H
+#define UI_WIDGETS_H
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include "config.h"
+#include "dirty_rects.h"
+
+// ============================================================================
+// RETAINED UI WIDGETS
+// ============================================================================
+//
+// The HUD is a fixed set of widgets that remember what they show: labels
+// (text), counters (a number between a prefix and a suffix) and buttons
+// (filled box with centered text). Setting a value that didn't change
+// does nothing. A label or counter that did change dirties only the
+// character cells that differ, so coins going from 149 to 150 repaints
+// two digits instead of the whole top bar. A button dirties its box when
+// its colors change.
+//
+// Widgets only decide what gets dirtied. The compositor rebuilds dirty
+// strips from scratch and uiDraw paints every widget overlapping the
+// strip, in the order they were added, so overlaps and full redraws come
+// out right without extra bookkeeping.
+//
+// Text uses the built-in 6x8 font, scaled by size. Each glyph is rendered
+// once per style (size, color, background) into a small sprite with
+// opaque spans; later draws copy spans instead of rasterising the font.
+// A background equal to the color means transparent, as in setTextColor.
+//
+
+typedef uint8_t UiId;
+
+#define UI_NONE 0xFF
+#define UI_MAX_WIDGETS 8
+#define UI_TEXT_MAX 16 // Characters per widget, including the terminator
+#define UI_MAX_FONTS 8 // Glyph styles cached at once
+
+// Set the display glyphs are rendered against and drop every widget
+void uiInit(TFT_eSPI *display);
+
+// Static or changing text with its top-left corner at (x, y)
+UiId uiAddLabel(int16_t x, int16_t y, uint8_t size, uint16_t color, uint16_t bg, const char *text);
+
+// Number drawn as prefix + value + suffix, top-left at (x, y)
+UiId uiAddCounter(int16_t x, int16_t y, uint8_t size, uint16_t color, uint16_t bg,
+                  const char *prefix, const char *suffix);
+
+// Box with a border and text centered in it. Colors come from uiSetColors.
+UiId uiAddButton(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t size, uint16_t border,
+                 const char *text);
+
+void uiSetText(UiId id, const char *text);
+void uiSetValue(UiId id, uint32_t value);
+
+// Button fill and text color
+void uiSetColors(UiId id, uint16_t fill, uint16_t textColor);
+
+void uiSetVisible(UiId id, bool visible);
+
+// Paint every widget overlapping clip (screen space) into dst, with screen
+// (x, y) landing at dst (x + ox, y + oy)
+void uiDraw(TFT_eSprite &dst, int16_t ox, int16_t oy, const DirtyRect &clip);
+
+#endif // UI_WIDGETS_H
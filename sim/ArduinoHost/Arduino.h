@@ -0,0 +1,159 @@
+/*
+ * Arduino.h - Host-native stand-in for the ESP32 Arduino core
+ *
+ * Only the subset of the core that Bass Hole actually uses is provided.
+ * Time is virtual by default: millis()/micros() only advance when the game
+ * calls delay(), so every run of the simulator is bit-for-bit repeatable.
+ * random() is a fixed xorshift generator for the same reason. FreeRTOS
+ * tasks (freertos/task.h) take turns on the virtual clock, so they keep
+ * that guarantee too.
+ */
+
+#ifndef ARDUINO_HOST_H
+#define ARDUINO_HOST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "Print.h"
+
+// ============================================================================
+// CORE TYPES AND CONSTANTS
+// ============================================================================
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+// Interrupt modes
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+// Code placement attributes mean nothing on the host
+#define IRAM_ATTR
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+// Flash is ordinary memory on the host
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+using std::max;
+using std::min;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// ============================================================================
+// TIMING
+// ============================================================================
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+// Pin interrupts fire when the simulator drives an input edge
+// (simSetPinLevel), on the thread that drives it
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+// LEDC PWM (ESP32 core 2.x API); duty is only recorded
+#define SIM_LEDC_CHANNELS 16
+double ledcSetup(uint8_t channel, double freq, uint8_t resolutionBits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+// ============================================================================
+// SERIAL / ESP
+// ============================================================================
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(unsigned long baud);
+    void end() {}
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush();
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap();
+    uint32_t getHeapSize();
+    void restart();
+};
+
+extern EspClass ESP;
+
+// ============================================================================
+// SKETCH ENTRY POINTS (defined in src/main.cpp)
+// ============================================================================
+
+void setup();
+void loop();
+
+// ============================================================================
+// SIMULATOR CONTROL (host only)
+// ============================================================================
+
+// Use the wall clock instead of the virtual clock (non-deterministic).
+// FreeRTOS tasks created afterwards run truly concurrently.
+void simSetRealtime(bool realtime);
+bool simIsRealtime();
+
+// Silence Serial output (for profiling runs)
+void simSetSerialQuiet(bool quiet);
+
+// Drive a GPIO input level from the simulator (e.g. touch IRQ line),
+// running its interrupt handler on a matching edge
+void simSetPinLevel(uint8_t pin, uint8_t level);
+
+// Last duty written to a LEDC channel (backlight)
+uint32_t simLedcDuty(uint8_t channel);
+
+#endif // ARDUINO_HOST_H
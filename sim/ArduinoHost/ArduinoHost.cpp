@@ -0,0 +1,294 @@
+#include "Arduino.h"
+#include "HostScheduler.h"
+#include "esp_timer.h"
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+
+// ============================================================================
+// TIMING
+// ============================================================================
+
+// Virtual clock in microseconds. Starts at 1 s so "now - 0" style checks in
+// the game behave like they do a second after boot on the device.
+static std::atomic<uint64_t> virtualMicros(1000000ULL);
+static std::atomic<bool> realtimeClock(false);
+static const auto bootTime = std::chrono::steady_clock::now();
+
+static uint64_t hostMicros()
+{
+    if (realtimeClock.load(std::memory_order_relaxed))
+    {
+        auto elapsed = std::chrono::steady_clock::now() - bootTime;
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    }
+    return virtualMicros.load(std::memory_order_relaxed);
+}
+
+unsigned long millis()
+{
+    return (unsigned long)(hostMicros() / 1000ULL);
+}
+
+unsigned long micros()
+{
+    return (unsigned long)hostMicros();
+}
+
+static void hostSleep(uint64_t us)
+{
+    if (realtimeClock.load(std::memory_order_relaxed))
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+        return;
+    }
+    // With tasks running, sleeping is also where the other tasks get a turn
+    if (!hostTaskSleep(us))
+        virtualMicros.fetch_add(us, std::memory_order_relaxed);
+}
+
+void delay(unsigned long ms)
+{
+    hostSleep((uint64_t)ms * 1000ULL);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    hostSleep(us);
+}
+
+int64_t esp_timer_get_time()
+{
+    // Always the wall clock: this measures real execution time
+    auto elapsed = std::chrono::steady_clock::now() - bootTime;
+    return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+uint64_t hostClockMicros()
+{
+    return hostMicros();
+}
+
+void hostClockAdvanceTo(uint64_t us)
+{
+    uint64_t now = virtualMicros.load(std::memory_order_relaxed);
+    while (now < us && !virtualMicros.compare_exchange_weak(now, us, std::memory_order_relaxed))
+    {
+    }
+}
+
+void simSetRealtime(bool realtime)
+{
+    realtimeClock.store(realtime, std::memory_order_relaxed);
+}
+
+bool simIsRealtime()
+{
+    return realtimeClock.load(std::memory_order_relaxed);
+}
+
+// ============================================================================
+// RANDOM
+// ============================================================================
+
+// xorshift32 - identical sequence on every host, unlike rand()
+static uint32_t rngState = 0x2545F491;
+
+static uint32_t rngNext()
+{
+    uint32_t x = rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rngState = x;
+    return x;
+}
+
+void randomSeed(unsigned long seed)
+{
+    rngState = seed ? (uint32_t)seed : 0x2545F491;
+}
+
+long random(long howbig)
+{
+    if (howbig <= 0)
+        return 0;
+    return (long)(rngNext() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig)
+{
+    if (howsmall >= howbig)
+        return howsmall;
+    return howsmall + random(howbig - howsmall);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    if (inMax == inMin)
+        return outMin;
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ============================================================================
+// GPIO
+// ============================================================================
+
+#define SIM_PIN_COUNT 40
+
+// Stored inverted so zero-initialisation means HIGH: inputs idle high
+// (pull-ups, released touch IRQ). Atomic because the simulator drives
+// pins from its own thread while tasks read them.
+static std::atomic<uint8_t> pinLevelsLow[SIM_PIN_COUNT];
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    if (pin < SIM_PIN_COUNT)
+        pinLevelsLow[pin].store(val ? 0 : 1, std::memory_order_relaxed);
+}
+
+int digitalRead(uint8_t pin)
+{
+    if (pin >= SIM_PIN_COUNT)
+        return LOW;
+    return pinLevelsLow[pin].load(std::memory_order_relaxed) ? LOW : HIGH;
+}
+
+uint16_t analogRead(uint8_t pin)
+{
+    (void)pin;
+    return 2048; // Mid-scale on the 12-bit ADC
+}
+
+struct SimPinIsr
+{
+    void (*isr)();
+    int mode;
+};
+
+static std::atomic<SimPinIsr *> pinIsrs[SIM_PIN_COUNT];
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode)
+{
+    if (pin < SIM_PIN_COUNT)
+        delete pinIsrs[pin].exchange(new SimPinIsr{isr, mode});
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    if (pin < SIM_PIN_COUNT)
+        delete pinIsrs[pin].exchange(nullptr);
+}
+
+void simSetPinLevel(uint8_t pin, uint8_t level)
+{
+    if (pin >= SIM_PIN_COUNT)
+        return;
+
+    int before = digitalRead(pin);
+    digitalWrite(pin, level);
+    int after = digitalRead(pin);
+
+    const SimPinIsr *handler = pinIsrs[pin].load();
+    if (!handler || before == after)
+        return;
+    if (handler->mode == CHANGE || (handler->mode == FALLING && after == LOW) ||
+        (handler->mode == RISING && after == HIGH))
+        handler->isr();
+}
+
+static std::atomic<uint32_t> ledcDuty[SIM_LEDC_CHANNELS];
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolutionBits)
+{
+    (void)channel;
+    (void)resolutionBits;
+    return freq;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel)
+{
+    (void)pin;
+    (void)channel;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty)
+{
+    if (channel < SIM_LEDC_CHANNELS)
+        ledcDuty[channel].store(duty, std::memory_order_relaxed);
+}
+
+uint32_t simLedcDuty(uint8_t channel)
+{
+    return channel < SIM_LEDC_CHANNELS ? ledcDuty[channel].load(std::memory_order_relaxed) : 0;
+}
+
+// ============================================================================
+// SERIAL / ESP
+// ============================================================================
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static bool serialQuiet = false;
+
+void simSetSerialQuiet(bool quiet)
+{
+    serialQuiet = quiet;
+}
+
+void HardwareSerial::begin(unsigned long baud)
+{
+    (void)baud;
+}
+
+void HardwareSerial::flush()
+{
+    fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (!serialQuiet && c != '\r')
+        fputc(c, stdout);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    if (serialQuiet)
+        return size;
+
+    // println()'s line ending becomes a plain newline. Other buffers go out
+    // untouched: they may be binary (the profiler stream).
+    if (size == 2 && buffer[0] == '\r' && buffer[1] == '\n')
+    {
+        fputc('\n', stdout);
+        return size;
+    }
+    fwrite(buffer, 1, size, stdout);
+    return size;
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    // Fixed value keeps serial logs identical between runs
+    return 200000;
+}
+
+uint32_t EspClass::getHeapSize()
+{
+    return 320000;
+}
+
+void EspClass::restart()
+{
+    exit(0);
+}
@@ -0,0 +1,323 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "HostScheduler.h"
+#include "Arduino.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// TASKS
+// ============================================================================
+//
+// Task 0 is the thread that runs setup()/loop() (the Arduino loopTask). On
+// the virtual clock exactly one task holds the CPU; when it sleeps, the
+// task with the earliest wake time runs next (ties go to the lower index)
+// and the clock jumps forward to that time. With --realtime, tasks are
+// free-running threads and delay() really sleeps.
+//
+
+struct HostTask
+{
+    TaskFunction_t fn;
+    void *param;
+    const char *name;
+    BaseType_t core;
+    uint64_t wakeAt;
+    bool done;
+    uint32_t notify = 0;  // Notification count (ulTaskNotifyTake)
+    bool waiting = false; // Blocked in ulTaskNotifyTake
+};
+
+// Never destroyed: tasks can still be parked on them while the process exits
+static std::mutex &schedMutex = *new std::mutex;
+static std::condition_variable &schedCv = *new std::condition_variable;
+static std::vector<HostTask *> &schedTasks = *new std::vector<HostTask *>;
+
+static std::atomic<bool> schedTurns(false);
+static size_t schedRunning = 0;
+
+static thread_local size_t schedSelf = 0;
+static thread_local BaseType_t schedCore = 1;
+
+// Caller holds schedMutex. Gives the CPU to the earliest-waking task.
+static void schedHandOff()
+{
+    size_t next = SIZE_MAX;
+    for (size_t i = 0; i < schedTasks.size(); i++)
+    {
+        const HostTask *task = schedTasks[i];
+        if (task->done)
+            continue;
+        if (next == SIZE_MAX || task->wakeAt < schedTasks[next]->wakeAt)
+            next = i;
+    }
+    if (next == SIZE_MAX)
+        return;
+
+    hostClockAdvanceTo(schedTasks[next]->wakeAt);
+    schedRunning = next;
+    schedCv.notify_all();
+}
+
+bool hostTaskSleep(uint64_t us)
+{
+    if (!schedTurns.load(std::memory_order_acquire))
+        return false;
+
+    std::unique_lock<std::mutex> lock(schedMutex);
+    size_t self = schedSelf;
+    schedTasks[self]->wakeAt = hostClockMicros() + us;
+    schedHandOff();
+    schedCv.wait(lock, [self] { return schedRunning == self; });
+    return true;
+}
+
+static void schedTaskMain(size_t index)
+{
+    HostTask *task;
+    {
+        std::unique_lock<std::mutex> lock(schedMutex);
+        task = schedTasks[index];
+        schedSelf = index;
+        schedCore = task->core;
+        if (schedTurns.load(std::memory_order_relaxed))
+            schedCv.wait(lock, [index] { return schedRunning == index; });
+    }
+
+    task->fn(task->param);
+    vTaskDelete(nullptr);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                                   void *param, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core)
+{
+    (void)stackDepth;
+    (void)priority;
+
+    std::lock_guard<std::mutex> lock(schedMutex);
+    if (schedTasks.empty())
+        schedTasks.push_back(new HostTask{nullptr, nullptr, "loopTask", 1, 0, false});
+
+    // Runnable at once; on the virtual clock it starts when the creator sleeps
+    HostTask *task = new HostTask{fn, param, name, core, hostClockMicros(), false};
+    size_t index = schedTasks.size();
+    schedTasks.push_back(task);
+    if (!simIsRealtime())
+        schedTurns.store(true, std::memory_order_release);
+
+    std::thread(schedTaskMain, index).detach();
+
+    if (handle)
+        *handle = task;
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *handle)
+{
+    return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t handle)
+{
+    std::unique_lock<std::mutex> lock(schedMutex);
+    HostTask *self = schedTasks.empty() ? nullptr : schedTasks[schedSelf];
+    HostTask *task = handle ? (HostTask *)handle : self;
+    if (!task)
+        return;
+
+    task->done = true;
+    if (task != self)
+        return;
+
+    // Deleting yourself never returns
+    if (schedTurns.load(std::memory_order_relaxed))
+        schedHandOff();
+    schedCv.wait(lock, [] { return false; });
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks * portTICK_PERIOD_MS);
+}
+
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment)
+{
+    *previousWakeTime += increment;
+    int32_t wait = (int32_t)(*previousWakeTime - xTaskGetTickCount());
+    if (wait > 0)
+        vTaskDelay((TickType_t)wait);
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return (TickType_t)(millis() / portTICK_PERIOD_MS);
+}
+
+BaseType_t xPortGetCoreID()
+{
+    return schedCore;
+}
+
+// ============================================================================
+// TASK NOTIFICATIONS
+// ============================================================================
+//
+// On the virtual clock a task waiting for a notification sleeps with its
+// wake time at the timeout (never, for portMAX_DELAY); a give moves it to
+// the current time, so it runs at the next scheduling point.
+//
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+    std::unique_lock<std::mutex> lock(schedMutex);
+    if (schedTasks.empty())
+        return 0;
+    size_t self = schedSelf;
+    HostTask *task = schedTasks[self];
+
+    if (task->notify == 0 && ticksToWait != 0)
+    {
+        bool forever = ticksToWait == portMAX_DELAY;
+        uint64_t timeoutUs = (uint64_t)ticksToWait * portTICK_PERIOD_MS * 1000ULL;
+
+        task->waiting = true;
+        if (schedTurns.load(std::memory_order_acquire))
+        {
+            task->wakeAt = forever ? UINT64_MAX : hostClockMicros() + timeoutUs;
+            schedHandOff();
+            schedCv.wait(lock, [self] { return schedRunning == self; });
+        }
+        else
+        {
+            auto notified = [task] { return task->notify > 0; };
+            if (forever)
+                schedCv.wait(lock, notified);
+            else
+                schedCv.wait_for(lock, std::chrono::microseconds(timeoutUs), notified);
+        }
+        task->waiting = false;
+    }
+
+    uint32_t count = task->notify;
+    if (count)
+        task->notify = clearCountOnExit ? 0 : count - 1;
+    return count;
+}
+
+// Returns whether the task was waiting for it
+static bool hostNotifyGive(TaskHandle_t handle)
+{
+    if (!handle)
+        return false;
+
+    std::lock_guard<std::mutex> lock(schedMutex);
+    HostTask *task = (HostTask *)handle;
+    task->notify++;
+    if (!task->waiting)
+        return false;
+    task->wakeAt = hostClockMicros();
+    schedCv.notify_all();
+    return true;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle)
+{
+    hostNotifyGive(handle);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *higherPriorityTaskWoken)
+{
+    bool woken = hostNotifyGive(handle);
+    if (higherPriorityTaskWoken && woken)
+        *higherPriorityTaskWoken = pdTRUE;
+}
+
+// ============================================================================
+// MUTEXES
+// ============================================================================
+
+// A binary semaphore is a mutex that starts out held and may be given by
+// any task
+struct HostSemaphore
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool held = false;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    return new HostSemaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    HostSemaphore *sem = new HostSemaphore;
+    sem->held = true;
+    return sem;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    delete sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticksToWait)
+{
+    if (!sem)
+        return pdFALSE;
+
+    if (schedTurns.load(std::memory_order_acquire))
+    {
+        // The holder only runs while we sleep, so poll a tick at a time
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(sem->mutex);
+                if (!sem->held)
+                {
+                    sem->held = true;
+                    return pdTRUE;
+                }
+            }
+            if (ticksToWait == 0)
+                return pdFALSE;
+            if (ticksToWait != portMAX_DELAY)
+                ticksToWait--;
+            vTaskDelay(1);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(sem->mutex);
+    auto isFree = [sem] { return !sem->held; };
+    if (ticksToWait == portMAX_DELAY)
+        sem->cv.wait(lock, isFree);
+    else if (!sem->cv.wait_for(lock, std::chrono::milliseconds(ticksToWait * portTICK_PERIOD_MS), isFree))
+        return pdFALSE;
+
+    sem->held = true;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if (!sem)
+        return pdFALSE;
+
+    {
+        std::lock_guard<std::mutex> lock(sem->mutex);
+        if (!sem->held)
+            return pdFALSE;
+        sem->held = false;
+    }
+    sem->cv.notify_one();
+    return pdTRUE;
+}
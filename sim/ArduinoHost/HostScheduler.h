@@ -0,0 +1,21 @@
+/*
+ * HostScheduler.h - Glue between the virtual clock and the task stand-ins
+ *
+ * Internal to the ArduinoHost library.
+ */
+
+#ifndef ARDUINO_HOST_SCHEDULER_H
+#define ARDUINO_HOST_SCHEDULER_H
+
+#include <stdint.h>
+
+// Virtual clock (ArduinoHost.cpp)
+uint64_t hostClockMicros();
+void hostClockAdvanceTo(uint64_t us);
+
+// Sleep the calling task on the virtual clock, letting the other tasks run
+// (FreeRTOSHost.cpp). Returns false if no tasks were created, in which case
+// the caller just advances the clock.
+bool hostTaskSleep(uint64_t us);
+
+#endif // ARDUINO_HOST_SCHEDULER_H
@@ -0,0 +1,94 @@
+#include "Print.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+    {
+        n += write(*buffer++);
+    }
+    return n;
+}
+
+size_t Print::write(const char *str)
+{
+    if (!str)
+        return 0;
+    return write((const uint8_t *)str, strlen(str));
+}
+
+size_t Print::printNumber(unsigned long long n, int base)
+{
+    char buf[8 * sizeof(unsigned long long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+
+    if (base < 2)
+        base = 10;
+
+    do
+    {
+        unsigned digit = (unsigned)(n % base);
+        n /= base;
+        *--str = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    } while (n);
+
+    return write(str);
+}
+
+size_t Print::printSigned(long long n, int base)
+{
+    if (base == 10 && n < 0)
+    {
+        size_t t = print('-');
+        return t + printNumber((unsigned long long)(-n), 10);
+    }
+    return printNumber((unsigned long long)n, base);
+}
+
+size_t Print::print(const char *str) { return write(str); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(unsigned char n, int base) { return printNumber(n, base); }
+size_t Print::print(int n, int base) { return printSigned(n, base); }
+size_t Print::print(unsigned int n, int base) { return printNumber(n, base); }
+size_t Print::print(long n, int base) { return printSigned(n, base); }
+size_t Print::print(unsigned long n, int base) { return printNumber(n, base); }
+size_t Print::print(long long n, int base) { return printSigned(n, base); }
+size_t Print::print(unsigned long long n, int base) { return printNumber(n, base); }
+
+size_t Print::print(double n, int digits)
+{
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", digits, n);
+    return write(buf);
+}
+
+size_t Print::println() { return write("\r\n"); }
+size_t Print::println(const char *str) { return print(str) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(unsigned char n, int base) { return print(n, base) + println(); }
+size_t Print::println(int n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned int n, int base) { return print(n, base) + println(); }
+size_t Print::println(long n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned long n, int base) { return print(n, base) + println(); }
+size_t Print::println(long long n, int base) { return print(n, base) + println(); }
+size_t Print::println(unsigned long long n, int base) { return print(n, base) + println(); }
+size_t Print::println(double n, int digits) { return print(n, digits) + println(); }
+
+size_t Print::printf(const char *format, ...)
+{
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+
+    if (len < 0)
+        return 0;
+    if ((size_t)len >= sizeof(buf))
+        len = sizeof(buf) - 1;
+    return write((const uint8_t *)buf, len);
+}
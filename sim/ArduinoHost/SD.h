@@ -0,0 +1,90 @@
+/*
+ * SD.h - Host-native stand-in for the ESP32 SD library
+ *
+ * The "card" is a directory on the host (sdcard/ in the repo by default), so
+ * the simulator loads exactly the same .raw assets the device does.
+ */
+
+#ifndef ARDUINO_HOST_SD_H
+#define ARDUINO_HOST_SD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <string>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+enum sdcard_type_t
+{
+    CARD_NONE,
+    CARD_MMC,
+    CARD_SD,
+    CARD_SDHC,
+    CARD_UNKNOWN
+};
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class SPIClass;
+
+class File
+{
+public:
+    File() {}
+
+    size_t read(uint8_t *buf, size_t size);
+    int read();
+    size_t write(const uint8_t *buf, size_t size);
+    size_t write(uint8_t c) { return write(&c, 1); }
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    int available() const;
+    void flush();
+    void close();
+
+    const char *name() const;
+
+    operator bool() const;
+
+private:
+    struct Handle;
+    std::shared_ptr<Handle> handle;
+
+    friend class SDFS;
+};
+
+class SDFS
+{
+public:
+    bool begin(uint8_t ssPin = 5, SPIClass *spi = nullptr, uint32_t frequency = 4000000,
+               const char *mountpoint = "/sd", uint8_t maxFiles = 5, bool formatIfEmpty = false);
+    void end();
+
+    sdcard_type_t cardType();
+    uint64_t cardSize();
+    uint64_t totalBytes();
+    uint64_t usedBytes();
+
+    File open(const char *path, const char *mode = FILE_READ, bool create = false);
+    bool exists(const char *path);
+    bool mkdir(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *pathFrom, const char *pathTo);
+    bool rmdir(const char *path);
+};
+
+extern SDFS SD;
+
+// Host directory that backs the simulated card (default "sdcard")
+void simSetSdRoot(const char *dir);
+
+#endif // ARDUINO_HOST_SD_H
@@ -0,0 +1,203 @@
+#include "SD.h"
+#include "SPI.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SPIClass SPI(VSPI);
+SDFS SD;
+
+static std::string sdRoot = "sdcard";
+static bool sdMounted = false;
+
+void simSetSdRoot(const char *dir)
+{
+    sdRoot = dir ? dir : "";
+}
+
+static std::string hostPath(const char *path)
+{
+    std::string p = path ? path : "";
+    if (p.empty() || p[0] != '/')
+        p = "/" + p;
+    return sdRoot + p;
+}
+
+// ============================================================================
+// FILE
+// ============================================================================
+
+struct File::Handle
+{
+    FILE *fp = nullptr;
+    std::string name;
+
+    ~Handle()
+    {
+        if (fp)
+            fclose(fp);
+    }
+};
+
+File::operator bool() const
+{
+    return handle && handle->fp;
+}
+
+size_t File::read(uint8_t *buf, size_t size)
+{
+    if (!*this)
+        return 0;
+    return fread(buf, 1, size, handle->fp);
+}
+
+int File::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::write(const uint8_t *buf, size_t size)
+{
+    if (!*this)
+        return 0;
+    return fwrite(buf, 1, size, handle->fp);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+    if (!*this)
+        return false;
+    int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+    return fseek(handle->fp, (long)pos, whence) == 0;
+}
+
+size_t File::position() const
+{
+    if (!*this)
+        return 0;
+    long pos = ftell(handle->fp);
+    return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const
+{
+    if (!*this)
+        return 0;
+    struct stat st;
+    if (fstat(fileno(handle->fp), &st) != 0)
+        return 0;
+    return (size_t)st.st_size;
+}
+
+int File::available() const
+{
+    size_t total = size();
+    size_t pos = position();
+    return pos < total ? (int)(total - pos) : 0;
+}
+
+void File::flush()
+{
+    if (*this)
+        fflush(handle->fp);
+}
+
+void File::close()
+{
+    handle.reset();
+}
+
+const char *File::name() const
+{
+    return handle ? handle->name.c_str() : "";
+}
+
+// ============================================================================
+// FILESYSTEM
+// ============================================================================
+
+bool SDFS::begin(uint8_t ssPin, SPIClass *spi, uint32_t frequency,
+                 const char *mountpoint, uint8_t maxFiles, bool formatIfEmpty)
+{
+    (void)ssPin;
+    (void)spi;
+    (void)frequency;
+    (void)mountpoint;
+    (void)maxFiles;
+    (void)formatIfEmpty;
+
+    struct stat st;
+    sdMounted = !sdRoot.empty() && stat(sdRoot.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    return sdMounted;
+}
+
+void SDFS::end()
+{
+    sdMounted = false;
+}
+
+sdcard_type_t SDFS::cardType()
+{
+    return sdMounted ? CARD_SDHC : CARD_NONE;
+}
+
+uint64_t SDFS::cardSize()
+{
+    return sdMounted ? 4ULL * 1024 * 1024 * 1024 : 0;
+}
+
+uint64_t SDFS::totalBytes()
+{
+    return cardSize();
+}
+
+uint64_t SDFS::usedBytes()
+{
+    return 0;
+}
+
+File SDFS::open(const char *path, const char *mode, bool create)
+{
+    (void)create;
+    File file;
+    if (!sdMounted)
+        return file;
+
+    std::string mode_ = mode ? mode : FILE_READ;
+    // Binary mode always; the device never translates line endings
+    FILE *fp = fopen(hostPath(path).c_str(), (mode_ + "b").c_str());
+    if (!fp)
+        return file;
+
+    file.handle = std::make_shared<File::Handle>();
+    file.handle->fp = fp;
+    file.handle->name = path;
+    return file;
+}
+
+bool SDFS::exists(const char *path)
+{
+    struct stat st;
+    return sdMounted && stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool SDFS::mkdir(const char *path)
+{
+    return sdMounted && ::mkdir(hostPath(path).c_str(), 0755) == 0;
+}
+
+bool SDFS::remove(const char *path)
+{
+    return sdMounted && ::unlink(hostPath(path).c_str()) == 0;
+}
+
+bool SDFS::rename(const char *pathFrom, const char *pathTo)
+{
+    return sdMounted && ::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+
+bool SDFS::rmdir(const char *path)
+{
+    return sdMounted && ::rmdir(hostPath(path).c_str()) == 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * SPI.h - Host-native stand-in for the ESP32 SPIClass
+ *
+ * There is no bus on the host; devices (TFT, touch, SD) are modelled at the
+ * driver level instead. This only exists so bus setup code compiles.
+ */
+
+#ifndef ARDUINO_HOST_SPI_H
+#define ARDUINO_HOST_SPI_H
+
+#include <stdint.h>
+
+#define FSPI 1
+#define HSPI 2
+#define VSPI 3
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+
+#define SPI_MSBFIRST 1
+#define SPI_LSBFIRST 0
+#ifndef MSBFIRST
+#define MSBFIRST 1
+#endif
+
+class SPISettings
+{
+public:
+    SPISettings() : clock(1000000), bitOrder(MSBFIRST), dataMode(SPI_MODE0) {}
+    SPISettings(uint32_t clockFreq, uint8_t order, uint8_t mode)
+        : clock(clockFreq), bitOrder(order), dataMode(mode) {}
+
+    uint32_t clock;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+class SPIClass
+{
+public:
+    explicit SPIClass(uint8_t spiBus = HSPI) : bus(spiBus), frequency(1000000) {}
+
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1)
+    {
+        (void)sck;
+        (void)miso;
+        (void)mosi;
+        (void)ss;
+    }
+    void end() {}
+
+    void setFrequency(uint32_t freq) { frequency = freq; }
+    uint32_t getFrequency() const { return frequency; }
+
+    void beginTransaction(SPISettings settings) { frequency = settings.clock; }
+    void endTransaction() {}
+
+    uint8_t transfer(uint8_t data)
+    {
+        (void)data;
+        return 0;
+    }
+    uint16_t transfer16(uint16_t data)
+    {
+        (void)data;
+        return 0;
+    }
+
+    uint8_t bus;
+
+private:
+    uint32_t frequency;
+};
+
+extern SPIClass SPI;
+
+#endif // ARDUINO_HOST_SPI_H
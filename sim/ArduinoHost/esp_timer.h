@@ -0,0 +1,18 @@
+/*
+ * esp_timer.h - Host-native stand-in for ESP-IDF's high-resolution timer
+ *
+ * Only esp_timer_get_time() is provided. It reads the host's monotonic
+ * clock (std::chrono::steady_clock), never the simulator's virtual clock:
+ * it is for measuring how long code really takes to run (the profiler),
+ * which the virtual clock cannot see.
+ */
+
+#ifndef ARDUINO_HOST_ESP_TIMER_H
+#define ARDUINO_HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microseconds since boot on the host's monotonic clock
+int64_t esp_timer_get_time();
+
+#endif // ARDUINO_HOST_ESP_TIMER_H
@@ -0,0 +1,36 @@
+/*
+ * freertos/FreeRTOS.h - Host-native stand-in for the ESP-IDF FreeRTOS types
+ *
+ * Only the task, notification and mutex calls Bass Hole uses are provided
+ * (see task.h and semphr.h). Ticks are milliseconds, matching the Arduino
+ * ESP32 default of configTICK_RATE_HZ = 1000.
+ */
+
+#ifndef ARDUINO_HOST_FREERTOS_H
+#define ARDUINO_HOST_FREERTOS_H
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+#define configTICK_RATE_HZ 1000
+#define configMAX_PRIORITIES 25
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((TickType_t)(ms) * configTICK_RATE_HZ) / 1000))
+
+#define tskNO_AFFINITY ((BaseType_t)0x7FFFFFFF)
+
+// Interrupt handlers run on the simulator's thread; the woken task gets
+// the CPU at the next scheduling point anyway
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+#endif // ARDUINO_HOST_FREERTOS_H
@@ -0,0 +1,23 @@
+/*
+ * freertos/semphr.h - Host-native stand-in for FreeRTOS mutexes
+ *
+ * Plain (non-recursive) mutexes and binary semaphores only; there is no
+ * priority inheritance to model on the host.
+ */
+
+#ifndef ARDUINO_HOST_FREERTOS_SEMPHR_H
+#define ARDUINO_HOST_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+struct HostSemaphore;
+typedef HostSemaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary(); // Created empty: the first take waits for a give
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+
+#endif // ARDUINO_HOST_FREERTOS_SEMPHR_H
@@ -0,0 +1,41 @@
+/*
+ * freertos/task.h - Host-native stand-in for the FreeRTOS task API
+ *
+ * Each task is a std::thread. On the virtual clock the tasks take turns:
+ * one runs until it delays, then the task that wakes earliest runs next, so
+ * simulator runs stay bit-for-bit repeatable. With --realtime they run truly
+ * concurrently on the wall clock (for ThreadSanitizer).
+ */
+
+#ifndef ARDUINO_HOST_FREERTOS_TASK_H
+#define ARDUINO_HOST_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+// Stack depth is in bytes, as on ESP-IDF; the host ignores it
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                                   void *param, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core);
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *handle);
+
+// nullptr deletes the calling task (and does not return)
+void vTaskDelete(TaskHandle_t handle);
+
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment);
+TickType_t xTaskGetTickCount();
+
+// Core the calling task was pinned to (loop() runs on core 1)
+BaseType_t xPortGetCoreID();
+
+// Direct-to-task notifications, used as a counting semaphore
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t handle);
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *higherPriorityTaskWoken);
+
+#endif // ARDUINO_HOST_FREERTOS_TASK_H
@@ -0,0 +1,199 @@
+/*
+ * sim_main.cpp - Entry point for the native simulator build
+ *
+ * Plays the part of the Arduino core's main(): runs setup(), then calls
+ * loop() once per frame for a fixed number of frames. Taps and drags can be
+ * scripted from the command line, and the final panel contents can be written out
+ * for bit-for-bit comparison between builds.
+ *
+ * Usage:
+ *   .pio/build/native/program [--frames N] [--seed N] [--sd DIR]
+ *                             [--tap X,Y@FRAME ...] [--drag X,Y,X2,Y2@FRAME ...]
+ *                             [--dump FILE.raw|FILE.ppm] [--quiet] [--realtime]
+ */
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <XPT2046_Touchscreen.h>
+#include <SD.h>
+#include <stdio.h>
+#include <vector>
+
+extern TFT_eSPI tft;
+
+// Frames a scripted finger stays down before lifting
+#define SIM_TAP_HOLD_FRAMES 3
+#define SIM_DRAG_FRAMES 20 // A drag moves evenly from start to end over these
+
+// Mirrors the calibration in src/touch.cpp so scripted taps land on the
+// requested screen pixel after touch.cpp maps them back
+#define SIM_TOUCH_MIN_X 600
+#define SIM_TOUCH_MAX_X 3600
+#define SIM_TOUCH_MIN_Y 500
+#define SIM_TOUCH_MAX_Y 3600
+#define SIM_SCREEN_WIDTH 320
+#define SIM_SCREEN_HEIGHT 240
+
+// TOUCH_IRQ in include/config.h: the panel's pen-down line
+#define SIM_TOUCH_IRQ_PIN 36
+
+// A tap is a drag that stays put
+struct SimTap
+{
+    int16_t x, y;
+    int16_t toX, toY;
+    unsigned long frame;
+    unsigned long hold; // Frames down
+};
+
+static void simUsage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--frames N] [--seed N] [--sd DIR] [--tap X,Y@FRAME]...\n"
+            "          [--drag X,Y,X2,Y2@FRAME]... [--dump FILE.raw|FILE.ppm]\n"
+            "          [--quiet] [--realtime]\n",
+            argv0);
+}
+
+// Inverse of touch.cpp's map(): smallest raw value that maps onto the pixel
+static int16_t simScreenToRaw(int16_t pos, long rawMin, long rawMax, long screenMax)
+{
+    long span = rawMax - rawMin;
+    return (int16_t)(rawMin + (pos * span + screenMax - 1) / screenMax);
+}
+
+static bool simDumpFrame(const char *path)
+{
+    int16_t w = tft.width();
+    int16_t h = tft.height();
+    std::vector<uint16_t> frame((size_t)w * h);
+    tft.simReadFrame(frame.data());
+
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+    {
+        perror(path);
+        return false;
+    }
+
+    size_t len = strlen(path);
+    bool ppm = len > 4 && strcmp(path + len - 4, ".ppm") == 0;
+    if (ppm)
+    {
+        fprintf(fp, "P6\n%d %d\n255\n", w, h);
+        for (uint16_t c : frame)
+        {
+            uint8_t rgb[3] = {
+                (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+                (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                (uint8_t)((c & 0x1F) * 255 / 31)};
+            fwrite(rgb, 1, 3, fp);
+        }
+    }
+    else
+    {
+        // Same layout as the sdcard/ .raw assets: RGB565 little-endian
+        for (uint16_t c : frame)
+        {
+            uint8_t le[2] = {(uint8_t)(c & 0xFF), (uint8_t)(c >> 8)};
+            fwrite(le, 1, 2, fp);
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long frames = 600;
+    unsigned long seed = 0;
+    const char *dumpPath = nullptr;
+    std::vector<SimTap> taps;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (!strcmp(arg, "--frames") && hasValue)
+            frames = strtoul(argv[++i], nullptr, 10);
+        else if (!strcmp(arg, "--seed") && hasValue)
+            seed = strtoul(argv[++i], nullptr, 10);
+        else if (!strcmp(arg, "--sd") && hasValue)
+            simSetSdRoot(argv[++i]);
+        else if (!strcmp(arg, "--dump") && hasValue)
+            dumpPath = argv[++i];
+        else if (!strcmp(arg, "--quiet"))
+            simSetSerialQuiet(true);
+        else if (!strcmp(arg, "--realtime"))
+            simSetRealtime(true);
+        else if (!strcmp(arg, "--tap") && hasValue)
+        {
+            int x, y;
+            unsigned long f;
+            if (sscanf(argv[++i], "%d,%d@%lu", &x, &y, &f) != 3)
+            {
+                simUsage(argv[0]);
+                return 2;
+            }
+            taps.push_back({(int16_t)x, (int16_t)y, (int16_t)x, (int16_t)y, f, SIM_TAP_HOLD_FRAMES});
+        }
+        else if (!strcmp(arg, "--drag") && hasValue)
+        {
+            int x, y, x2, y2;
+            unsigned long f;
+            if (sscanf(argv[++i], "%d,%d,%d,%d@%lu", &x, &y, &x2, &y2, &f) != 5)
+            {
+                simUsage(argv[0]);
+                return 2;
+            }
+            taps.push_back({(int16_t)x, (int16_t)y, (int16_t)x2, (int16_t)y2, f, SIM_DRAG_FRAMES});
+        }
+        else
+        {
+            simUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    randomSeed(seed);
+    simTouchSetIrqPin(SIM_TOUCH_IRQ_PIN);
+    setup();
+    tft.simResetStats();
+
+    unsigned long startMs = millis();
+    for (unsigned long frame = 0; frame < frames; frame++)
+    {
+        for (const SimTap &tap : taps)
+        {
+            if (frame >= tap.frame && frame < tap.frame + tap.hold)
+            {
+                long step = (long)(frame - tap.frame);
+                long span = (long)tap.hold - 1;
+                int16_t x = (int16_t)(tap.x + (tap.toX - tap.x) * step / span);
+                int16_t y = (int16_t)(tap.y + (tap.toY - tap.y) * step / span);
+                simTouchPress(simScreenToRaw(y, SIM_TOUCH_MIN_X, SIM_TOUCH_MAX_X, SIM_SCREEN_HEIGHT),
+                              simScreenToRaw(x, SIM_TOUCH_MIN_Y, SIM_TOUCH_MAX_Y, SIM_SCREEN_WIDTH));
+            }
+            else if (frame == tap.frame + tap.hold)
+            {
+                simTouchRelease();
+            }
+        }
+        loop();
+    }
+
+    Serial.flush();
+    const TFT_SimStats &stats = tft.simStats();
+    fprintf(stderr, "sim: %lu frames, %lu ms game time, %lu windows, %llu pixels (%.1f px/frame), %lu scrolls, backlight %lu/255\n",
+            frames, millis() - startMs, (unsigned long)stats.windows,
+            (unsigned long long)stats.pixels,
+            frames ? (double)stats.pixels / frames : 0.0,
+            (unsigned long)stats.scrolls, (unsigned long)simLedcDuty(0));
+
+    if (dumpPath && !simDumpFrame(dumpPath))
+        return 1;
+
+    return 0;
+}
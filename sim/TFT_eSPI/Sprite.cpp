@@ -0,0 +1,144 @@
+#include "TFT_eSPI.h"
+
+static inline uint16_t swap16(uint16_t v)
+{
+    return (uint16_t)((v >> 8) | (v << 8));
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(0, 0), tft(tft)
+{
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames)
+{
+    (void)frames;
+    if (created())
+        return getPointer();
+    if (w < 1 || h < 1)
+        return nullptr;
+
+    _width = w;
+    _height = h;
+    img.assign((size_t)w * h, 0);
+    return img.data();
+}
+
+void TFT_eSprite::deleteSprite()
+{
+    img.clear();
+    img.shrink_to_fit();
+    _width = 0;
+    _height = 0;
+}
+
+void *TFT_eSprite::setColorDepth(int8_t b)
+{
+    // Only the 16-bit format is modelled
+    (void)b;
+    return getPointer();
+}
+
+void TFT_eSprite::plot(int32_t x, int32_t y, uint16_t color)
+{
+    img[(size_t)y * _width + x] = swap16(color);
+}
+
+uint16_t TFT_eSprite::peek(int32_t x, int32_t y)
+{
+    return swap16(img[(size_t)y * _width + x]);
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+        return;
+    plot(x, y, (uint16_t)color);
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > width())
+        w = width() - x;
+    if (y + h > height())
+        h = height() - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    uint16_t wire = swap16((uint16_t)color);
+    for (int32_t py = y; py < y + h; py++)
+    {
+        std::fill_n(img.begin() + (size_t)py * _width + x, w, wire);
+    }
+}
+
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+        return 0;
+    return peek(x, y);
+}
+
+void TFT_eSprite::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+    int32_t dx = 0, dy = 0, dw = w, dh = h;
+
+    if (x < 0)
+    {
+        dw += x;
+        dx = -x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        dh += y;
+        dy = -y;
+        y = 0;
+    }
+    if (x + dw > width())
+        dw = width() - x;
+    if (y + dh > height())
+        dh = height() - y;
+    if (dw < 1 || dh < 1 || !data)
+        return;
+
+    // swapBytes set: data is native RGB565 and is swapped into wire order
+    for (int32_t py = 0; py < dh; py++)
+    {
+        const uint16_t *src = data + (size_t)(py + dy) * w + dx;
+        uint16_t *dst = img.data() + (size_t)(y + py) * _width + x;
+        for (int32_t px = 0; px < dw; px++)
+            dst[px] = swapBytes ? swap16(src[px]) : src[px];
+    }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+    if (!created())
+        return;
+
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    tft->pushImage(x, y, _width, _height, img.data());
+    tft->setSwapBytes(oldSwap);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y, uint16_t transparent)
+{
+    if (!created())
+        return;
+
+    bool oldSwap = tft->getSwapBytes();
+    tft->setSwapBytes(false);
+    tft->pushImage(x, y, _width, _height, img.data(), transparent);
+    tft->setSwapBytes(oldSwap);
+}
@@ -0,0 +1,766 @@
+#include "TFT_eSPI.h"
+#include "glcdfont.h"
+
+static inline uint16_t swap16(uint16_t v)
+{
+    return (uint16_t)((v >> 8) | (v << 8));
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h)
+    : _width(w), _height(h), rotation(0), swapBytes(false), inverted(false),
+      cursorX(0), cursorY(0), textColor(TFT_WHITE), textBgColor(TFT_WHITE),
+      textSize(1), textWrapX(true), textWrapY(false),
+      winX0(0), winY0(0), winX1(0), winY1(0), winX(0), winY(0),
+      stats(), gram((size_t)TFT_WIDTH * TFT_HEIGHT, 0), lastCommand(0),
+      paramCount(0), scrolling(false), scrollTop(0), scrollArea(TFT_HEIGHT), scrollStart(0),
+      dmaEnabled(false), dmaPending(false), dmaX(0), dmaY(0), dmaW(0), dmaH(0),
+      dmaData(nullptr)
+{
+}
+
+SPIClass &TFT_eSPI::getSPIinstance()
+{
+    static SPIClass spi(HSPI);
+    return spi;
+}
+
+void TFT_eSPI::init(uint8_t tc)
+{
+    (void)tc;
+    rotation = 0;
+    _width = TFT_WIDTH;
+    _height = TFT_HEIGHT;
+    scrolling = false;
+    scrollTop = 0;
+    scrollArea = TFT_HEIGHT;
+    scrollStart = 0;
+}
+
+void TFT_eSPI::setRotation(uint8_t r)
+{
+    rotation = r & 3;
+    if (rotation & 1)
+    {
+        _width = TFT_HEIGHT;
+        _height = TFT_WIDTH;
+    }
+    else
+    {
+        _width = TFT_WIDTH;
+        _height = TFT_HEIGHT;
+    }
+}
+
+void TFT_eSPI::writecommand(uint8_t c)
+{
+    lastCommand = c;
+    paramCount = 0;
+
+    if (c == ILI9341_NORON)
+        scrolling = false;
+}
+
+void TFT_eSPI::writedata(uint8_t d)
+{
+    if (paramCount >= sizeof(params))
+        return;
+    params[paramCount++] = d;
+
+    switch (lastCommand)
+    {
+    case ILI9341_VSCRDEF:
+        if (paramCount == 6)
+        {
+            // Big-endian TFA, VSA, BFA; the panel ignores a definition
+            // that doesn't add up to its height
+            int32_t tfa = (params[0] << 8) | params[1];
+            int32_t vsa = (params[2] << 8) | params[3];
+            int32_t bfa = (params[4] << 8) | params[5];
+            if (tfa + vsa + bfa == TFT_HEIGHT && vsa > 0)
+            {
+                scrollTop = tfa;
+                scrollArea = vsa;
+            }
+        }
+        break;
+
+    case ILI9341_VSCRSADD:
+        if (paramCount == 2)
+        {
+            scrollStart = (params[0] << 8) | params[1];
+            scrolling = true;
+            stats.scrolls++;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+// ============================================================================
+// GRAM ACCESS
+// ============================================================================
+
+// Logical (rotated) coordinates to native portrait GRAM, following the
+// ILI9341 MADCTL settings TFT_eSPI uses for each rotation
+void TFT_eSPI::mapToGram(int32_t x, int32_t y, int32_t &col, int32_t &row)
+{
+    switch (rotation)
+    {
+    case 0: // MX
+        col = TFT_WIDTH - 1 - x;
+        row = y;
+        break;
+    case 1: // MV
+        col = y;
+        row = x;
+        break;
+    case 2: // MY
+        col = x;
+        row = TFT_HEIGHT - 1 - y;
+        break;
+    default: // MX | MY | MV
+        col = TFT_WIDTH - 1 - y;
+        row = TFT_HEIGHT - 1 - x;
+        break;
+    }
+}
+
+void TFT_eSPI::plot(int32_t x, int32_t y, uint16_t color)
+{
+    int32_t col, row;
+    mapToGram(x, y, col, row);
+    gram[(size_t)row * TFT_WIDTH + col] = color;
+}
+
+uint16_t TFT_eSPI::peek(int32_t x, int32_t y)
+{
+    int32_t col, row;
+    mapToGram(x, y, col, row);
+    return gram[(size_t)row * TFT_WIDTH + col];
+}
+
+// GRAM row the panel shows on a native display line. Lines in the scroll
+// area start at scrollStart and wrap within the area; the fixed areas
+// above and below show their own rows.
+int32_t TFT_eSPI::scrollRow(int32_t line)
+{
+    if (!scrolling || line < scrollTop || line >= scrollTop + scrollArea)
+        return line;
+
+    int32_t row = (line - scrollTop) + (scrollStart - scrollTop);
+    row %= scrollArea;
+    if (row < 0)
+        row += scrollArea;
+    return row + scrollTop;
+}
+
+void TFT_eSPI::simReadFrame(uint16_t *out)
+{
+    // Drawing and readPixel address GRAM directly; only what the panel
+    // shows goes through the scroll registers
+    for (int32_t y = 0; y < height(); y++)
+    {
+        for (int32_t x = 0; x < width(); x++)
+        {
+            int32_t col, row;
+            mapToGram(x, y, col, row);
+            *out++ = gram[(size_t)scrollRow(row) * TFT_WIDTH + col];
+        }
+    }
+}
+
+// ============================================================================
+// ADDRESS WINDOW STREAMING
+// ============================================================================
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    setWindow(x, y, x + w - 1, y + h - 1);
+}
+
+void TFT_eSPI::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    winX0 = x0;
+    winY0 = y0;
+    winX1 = x1;
+    winY1 = y1;
+    winX = x0;
+    winY = y0;
+    stats.windows++;
+}
+
+void TFT_eSPI::pushColor(uint16_t color)
+{
+    pushColor(color, 1);
+}
+
+void TFT_eSPI::pushColor(uint16_t color, uint32_t len)
+{
+    while (len--)
+    {
+        if (winX >= 0 && winX < width() && winY >= 0 && winY < height())
+        {
+            plot(winX, winY, color);
+            stats.pixels++;
+        }
+        if (++winX > winX1)
+        {
+            winX = winX0;
+            if (++winY > winY1)
+                winY = winY0;
+        }
+    }
+}
+
+void TFT_eSPI::pushPixels(const void *dataIn, uint32_t len)
+{
+    const uint16_t *data = (const uint16_t *)dataIn;
+    while (len--)
+    {
+        uint16_t color = *data++;
+        pushColor(swapBytes ? color : swap16(color), 1);
+    }
+}
+
+// ============================================================================
+// PRIMITIVES
+// ============================================================================
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color)
+{
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+        return;
+    stats.windows++;
+    stats.pixels++;
+    plot(x, y, (uint16_t)color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color)
+{
+    fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color)
+{
+    fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > width())
+        w = width() - x;
+    if (y + h > height())
+        h = height() - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    stats.windows++;
+    stats.pixels += (uint64_t)w * h;
+    for (int32_t py = y; py < y + h; py++)
+    {
+        for (int32_t px = x; px < x + w; px++)
+        {
+            plot(px, py, (uint16_t)color);
+        }
+    }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= width() || y >= height())
+        return 0;
+    return peek(x, y);
+}
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+    fillRect(0, 0, width(), height(), color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color)
+{
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+{
+    int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int32_t err = dx + dy;
+
+    while (true)
+    {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1)
+            break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+void TFT_eSPI::drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+{
+    drawPixel(x0, y0 + r, color);
+    drawPixel(x0, y0 - r, color);
+    drawPixel(x0 + r, y0, color);
+    drawPixel(x0 - r, y0, color);
+    drawCircleHelper(x0, y0, r, 0x0F, color);
+}
+
+void TFT_eSPI::drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color)
+{
+    int32_t f = 1 - r;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -2 * r;
+    int32_t x = 0;
+    int32_t y = r;
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (cornername & 0x4)
+        {
+            drawPixel(x0 + x, y0 + y, color);
+            drawPixel(x0 + y, y0 + x, color);
+        }
+        if (cornername & 0x2)
+        {
+            drawPixel(x0 + x, y0 - y, color);
+            drawPixel(x0 + y, y0 - x, color);
+        }
+        if (cornername & 0x8)
+        {
+            drawPixel(x0 - y, y0 + x, color);
+            drawPixel(x0 - x, y0 + y, color);
+        }
+        if (cornername & 0x1)
+        {
+            drawPixel(x0 - y, y0 - x, color);
+            drawPixel(x0 - x, y0 - y, color);
+        }
+    }
+}
+
+void TFT_eSPI::fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+{
+    drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void TFT_eSPI::fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color)
+{
+    int32_t f = 1 - r;
+    int32_t ddF_x = 1;
+    int32_t ddF_y = -2 * r;
+    int32_t x = 0;
+    int32_t y = r;
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (cornername & 0x1)
+        {
+            drawFastVLine(x0 + x, y0 - y, 2 * y + 1 + delta, color);
+            drawFastVLine(x0 + y, y0 - x, 2 * x + 1 + delta, color);
+        }
+        if (cornername & 0x2)
+        {
+            drawFastVLine(x0 - x, y0 - y, 2 * y + 1 + delta, color);
+            drawFastVLine(x0 - y, y0 - x, 2 * x + 1 + delta, color);
+        }
+    }
+}
+
+void TFT_eSPI::drawEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint16_t color)
+{
+    if (rx < 2 || ry < 2)
+        return;
+
+    int32_t x, y;
+    int32_t rx2 = rx * rx;
+    int32_t ry2 = ry * ry;
+    int32_t fx2 = 4 * rx2;
+    int32_t fy2 = 4 * ry2;
+    int32_t s;
+
+    for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++)
+    {
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        if (s >= 0)
+        {
+            s += fx2 * (1 - y);
+            y--;
+        }
+        s += ry2 * ((4 * x) + 6);
+    }
+
+    for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++)
+    {
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        if (s >= 0)
+        {
+            s += fy2 * (1 - x);
+            x--;
+        }
+        s += rx2 * ((4 * y) + 6);
+    }
+}
+
+void TFT_eSPI::fillEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint16_t color)
+{
+    if (rx < 2 || ry < 2)
+        return;
+
+    int32_t x, y;
+    int32_t rx2 = rx * rx;
+    int32_t ry2 = ry * ry;
+    int32_t fx2 = 4 * rx2;
+    int32_t fy2 = 4 * ry2;
+    int32_t s;
+
+    for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++)
+    {
+        drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
+        drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+        if (s >= 0)
+        {
+            s += fx2 * (1 - y);
+            y--;
+        }
+        s += ry2 * ((4 * x) + 6);
+    }
+
+    for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++)
+    {
+        drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
+        drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+        if (s >= 0)
+        {
+            s += fy2 * (1 - x);
+            x--;
+        }
+        s += rx2 * ((4 * y) + 6);
+    }
+}
+
+void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+    drawLine(x0, y0, x1, y1, color);
+    drawLine(x1, y1, x2, y2, color);
+    drawLine(x2, y2, x0, y0, color);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color)
+{
+    int32_t a, b, y, last;
+
+    // Sort coordinates by Y order (y2 >= y1 >= y0)
+    if (y0 > y1)
+    {
+        std::swap(y0, y1);
+        std::swap(x0, x1);
+    }
+    if (y1 > y2)
+    {
+        std::swap(y2, y1);
+        std::swap(x2, x1);
+    }
+    if (y0 > y1)
+    {
+        std::swap(y0, y1);
+        std::swap(x0, x1);
+    }
+
+    if (y0 == y2)
+    {
+        a = b = x0;
+        if (x1 < a)
+            a = x1;
+        else if (x1 > b)
+            b = x1;
+        if (x2 < a)
+            a = x2;
+        else if (x2 > b)
+            b = x2;
+        drawFastHLine(a, y0, b - a + 1, color);
+        return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+
+    last = (y1 == y2) ? y1 : y1 - 1;
+
+    for (y = y0; y <= last; y++)
+    {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b)
+            std::swap(a, b);
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+
+    sa = dx12 * (y - y1);
+    sb = dx02 * (y - y0);
+    for (; y <= y2; y++)
+    {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b)
+            std::swap(a, b);
+        drawFastHLine(a, y, b - a + 1, color);
+    }
+}
+
+// ============================================================================
+// IMAGES
+// ============================================================================
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+{
+    int32_t dx = 0, dy = 0, dw = w, dh = h;
+
+    if (x < 0)
+    {
+        dw += x;
+        dx = -x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        dh += y;
+        dy = -y;
+        y = 0;
+    }
+    if (x + dw > width())
+        dw = width() - x;
+    if (y + dh > height())
+        dh = height() - y;
+    if (dw < 1 || dh < 1 || !data)
+        return;
+
+    stats.windows++;
+    stats.pixels += (uint64_t)dw * dh;
+    for (int32_t py = 0; py < dh; py++)
+    {
+        const uint16_t *src = data + (size_t)(py + dy) * w + dx;
+        for (int32_t px = 0; px < dw; px++)
+        {
+            uint16_t color = src[px];
+            plot(x + px, y + py, swapBytes ? color : swap16(color));
+        }
+    }
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent)
+{
+    if (!data)
+        return;
+
+    // Each opaque run is its own address window, as on the real driver
+    for (int32_t py = 0; py < h; py++)
+    {
+        int32_t sy = y + py;
+        if (sy < 0 || sy >= height())
+            continue;
+
+        bool inRun = false;
+        for (int32_t px = 0; px < w; px++)
+        {
+            int32_t sx = x + px;
+            uint16_t color = data[(size_t)py * w + px];
+            color = swapBytes ? color : swap16(color);
+
+            if (color == transparent || sx < 0 || sx >= width())
+            {
+                inRun = false;
+                continue;
+            }
+            if (!inRun)
+            {
+                stats.windows++;
+                inRun = true;
+            }
+            stats.pixels++;
+            plot(sx, sy, color);
+        }
+    }
+}
+
+// ============================================================================
+// DMA
+// ============================================================================
+
+bool TFT_eSPI::initDMA(bool ctrl_cs)
+{
+    (void)ctrl_cs;
+    dmaEnabled = true;
+    return true;
+}
+
+void TFT_eSPI::deInitDMA()
+{
+    dmaWait();
+    dmaEnabled = false;
+}
+
+void TFT_eSPI::dmaWait()
+{
+    if (!dmaPending)
+        return;
+
+    dmaPending = false;
+    bool oldSwap = swapBytes;
+    swapBytes = false;
+    pushImage(dmaX, dmaY, dmaW, dmaH, dmaData);
+    swapBytes = oldSwap;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer)
+{
+    if (!dmaEnabled || !data || w < 1 || h < 1)
+        return;
+
+    // Only one transfer can be queued
+    dmaWait();
+
+    // Like the driver, swapping happens in RAM before the transfer starts:
+    // into buffer if given, otherwise in place
+    if (swapBytes)
+    {
+        uint16_t *dst = buffer ? buffer : data;
+        for (int32_t i = 0; i < w * h; i++)
+            dst[i] = swap16(data[i]);
+        data = dst;
+    }
+    else if (buffer)
+    {
+        memcpy(buffer, data, (size_t)w * h * 2);
+        data = buffer;
+    }
+
+    dmaPending = true;
+    dmaX = x;
+    dmaY = y;
+    dmaW = w;
+    dmaH = h;
+    dmaData = data;
+}
+
+// ============================================================================
+// TEXT
+// ============================================================================
+
+void TFT_eSPI::drawChar(int32_t x, int32_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t size)
+{
+    const uint8_t *glyph = nullptr;
+    if (c >= GLCD_FIRST_CHAR && c <= GLCD_LAST_CHAR)
+        glyph = &glcdFont[(c - GLCD_FIRST_CHAR) * 5];
+
+    bool fillBg = (bg != color);
+
+    for (int8_t i = 0; i < 6; i++)
+    {
+        uint8_t line = (glyph && i < 5) ? glyph[i] : 0;
+        for (int8_t j = 0; j < 8; j++, line >>= 1)
+        {
+            if (line & 0x1)
+            {
+                if (size == 1)
+                    drawPixel(x + i, y + j, color);
+                else
+                    fillRect(x + i * size, y + j * size, size, size, color);
+            }
+            else if (fillBg)
+            {
+                if (size == 1)
+                    drawPixel(x + i, y + j, bg);
+                else
+                    fillRect(x + i * size, y + j * size, size, size, bg);
+            }
+        }
+    }
+}
+
+size_t TFT_eSPI::write(uint8_t c)
+{
+    if (c == '\n')
+    {
+        cursorY += 8 * textSize;
+        cursorX = 0;
+        return 1;
+    }
+    if (c == '\r')
+        return 1;
+
+    if (textWrapX && cursorX + 6 * textSize > width())
+    {
+        cursorY += 8 * textSize;
+        cursorX = 0;
+    }
+    if (textWrapY && cursorY >= height())
+        cursorY = 0;
+
+    drawChar(cursorX, cursorY, c, textColor, textBgColor, textSize);
+    cursorX += 6 * textSize;
+    return 1;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string)
+{
+    return string ? (int16_t)(strlen(string) * 6 * textSize) : 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * TFT_eSPI.h - Host-native stand-in for Bodmer's TFT_eSPI
+ *
+ * Models an ILI9341 as a 240x320 RGB565 GRAM in RAM. Drawing calls go
+ * through the same rotation mapping and byte-order rules as the real
+ * driver (setSwapBytes only affects pushImage/pushPixels), so what the
+ * simulator shows is what the panel would show.
+ *
+ * It also counts address windows and pixels written, which is the host's
+ * proxy for SPI bus time when profiling the render loop.
+ */
+
+#ifndef TFT_ESPI_HOST_H
+#define TFT_ESPI_HOST_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <vector>
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+
+// Common colours (RGB565)
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_MAROON 0x7800
+#define TFT_PURPLE 0x780F
+#define TFT_OLIVE 0x7BE0
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_DARKGREY 0x7BEF
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE 0xFFFF
+#define TFT_ORANGE 0xFDA0
+
+// ILI9341 commands the simulator models
+#define ILI9341_NORON 0x13    // Normal display mode (scrolling off)
+#define ILI9341_VSCRDEF 0x33  // Vertical scroll definition: TFA, VSA, BFA
+#define ILI9341_VSCRSADD 0x37 // Vertical scroll start address: VSP
+
+// Panel activity counters (host profiling aid)
+struct TFT_SimStats
+{
+    uint32_t windows;  // Address windows set (one per drawPixel, fillRect, pushImage...)
+    uint64_t pixels;   // Pixels written to GRAM
+    uint32_t scrolls;  // Vertical scroll start addresses set
+};
+
+class TFT_eSPI : public Print
+{
+public:
+    TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+    virtual ~TFT_eSPI() {}
+
+    void init(uint8_t tc = 0);
+    void begin(uint8_t tc = 0) { init(tc); }
+
+    void setRotation(uint8_t r);
+    uint8_t getRotation() { return rotation; }
+    void invertDisplay(bool i) { inverted = i; }
+
+    // Raw command interface (accepted and ignored unless modelled)
+    void writecommand(uint8_t c);
+    void writedata(uint8_t d);
+
+    virtual int16_t width() { return _width; }
+    virtual int16_t height() { return _height; }
+
+    void setSwapBytes(bool swap) { swapBytes = swap; }
+    bool getSwapBytes() { return swapBytes; }
+
+    // Bus transactions (no-ops on the host)
+    void startWrite() {}
+    void endWrite() {}
+
+    // The SPI instance the driver talks through, for devices sharing its bus
+    static SPIClass &getSPIinstance();
+
+    // Streaming writes into an address window
+    void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+    void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void pushColor(uint16_t color);
+    void pushColor(uint16_t color, uint32_t len);
+    void pushBlock(uint16_t color, uint32_t len) { pushColor(color, len); }
+    void pushPixels(const void *dataIn, uint32_t len);
+
+    // Primitives
+    virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+    virtual void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+    virtual void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+    virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    virtual uint16_t readPixel(int32_t x, int32_t y);
+
+    void fillScreen(uint32_t color);
+    void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+    void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+    void drawCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color);
+    void drawEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint16_t color);
+    void fillEllipse(int16_t x0, int16_t y0, int32_t rx, int32_t ry, uint16_t color);
+    void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+    void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color);
+
+    // Images (16-bit RGB565; byte order follows setSwapBytes)
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+    {
+        pushImage(x, y, w, h, (const uint16_t *)data);
+    }
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data, uint16_t transparent);
+
+    // DMA. A transfer is only latched into GRAM when the next one starts
+    // or on dmaWait(), so touching a buffer that is still "in flight"
+    // shows up as corruption, just as it would on the device.
+    bool initDMA(bool ctrl_cs = false);
+    void deInitDMA();
+    bool dmaBusy() { return dmaPending; }
+    void dmaWait();
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = nullptr);
+
+    uint16_t color565(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+
+    // Text (built-in 6x8 GLCD font only)
+    void setCursor(int16_t x, int16_t y)
+    {
+        cursorX = x;
+        cursorY = y;
+    }
+    int16_t getCursorX() { return cursorX; }
+    int16_t getCursorY() { return cursorY; }
+    void setTextColor(uint16_t color)
+    {
+        textColor = textBgColor = color;
+    }
+    void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false)
+    {
+        (void)bgfill;
+        textColor = fg;
+        textBgColor = bg;
+    }
+    void setTextSize(uint8_t size) { textSize = size > 0 ? size : 1; }
+    void setTextWrap(bool wrapX, bool wrapY = false)
+    {
+        textWrapX = wrapX;
+        textWrapY = wrapY;
+    }
+    int16_t textWidth(const char *string);
+    int16_t fontHeight() { return 8 * textSize; }
+
+    // One built-in font glyph (bg == color draws it transparent)
+    void drawChar(int32_t x, int32_t y, uint8_t c, uint16_t color, uint16_t bg, uint8_t size);
+
+    size_t write(uint8_t c) override;
+    using Print::write;
+
+    // ------------------------------------------------------------------------
+    // Simulator access (host only)
+    // ------------------------------------------------------------------------
+
+    // Copy what the panel currently shows, in the current rotation, as
+    // width() x height() RGB565 pixels (vertical scrolling applied)
+    void simReadFrame(uint16_t *out);
+
+    const TFT_SimStats &simStats() const { return stats; }
+    void simResetStats() { stats = TFT_SimStats(); }
+
+protected:
+    // Write one already-clipped logical pixel (colour as it goes on the wire)
+    virtual void plot(int32_t x, int32_t y, uint16_t color);
+    virtual uint16_t peek(int32_t x, int32_t y);
+
+    void drawCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, uint32_t color);
+    void fillCircleHelper(int32_t x0, int32_t y0, int32_t r, uint8_t cornername, int32_t delta, uint32_t color);
+
+    int16_t _width, _height;
+    uint8_t rotation;
+    bool swapBytes;
+    bool inverted;
+
+    int16_t cursorX, cursorY;
+    uint16_t textColor, textBgColor;
+    uint8_t textSize;
+    bool textWrapX, textWrapY;
+
+    // Address window state for pushColor/pushPixels
+    int32_t winX0, winY0, winX1, winY1;
+    int32_t winX, winY;
+
+    TFT_SimStats stats;
+
+private:
+    // Native portrait GRAM: TFT_WIDTH columns x TFT_HEIGHT rows
+    std::vector<uint16_t> gram;
+    uint8_t lastCommand;
+
+    // Command parameter bytes received since lastCommand
+    uint8_t params[6];
+    uint8_t paramCount;
+
+    // Vertical scrolling, in native GRAM rows: fixed top area, scroll area
+    // and the row shown at its first line
+    bool scrolling;
+    int32_t scrollTop, scrollArea, scrollStart;
+
+    // In-flight DMA transfer (wire-order pixels)
+    bool dmaEnabled;
+    bool dmaPending;
+    int32_t dmaX, dmaY, dmaW, dmaH;
+    const uint16_t *dmaData;
+
+    void mapToGram(int32_t x, int32_t y, int32_t &col, int32_t &row);
+    int32_t scrollRow(int32_t line);
+};
+
+// ============================================================================
+// SPRITES (off-screen RAM canvases, 16-bit only)
+// ============================================================================
+
+// setAttribute ids
+#define CP437_SWITCH 1
+#define UTF8_SWITCH 2
+#define PSRAM_ENABLE 3
+
+// Like the real TFT_eSprite, pixels are stored in wire order (byte-swapped
+// RGB565) so pushSprite can send the buffer as-is. Drawing into a sprite
+// does not touch the panel statistics; only pushSprite does.
+class TFT_eSprite : public TFT_eSPI
+{
+public:
+    explicit TFT_eSprite(TFT_eSPI *tft);
+    ~TFT_eSprite() override { deleteSprite(); }
+
+    void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+    void deleteSprite();
+    bool created() { return !img.empty(); }
+    void *getPointer() { return img.empty() ? nullptr : img.data(); }
+    void *setColorDepth(int8_t b);
+    int8_t getColorDepth() { return 16; }
+    void setAttribute(uint8_t id = 0, uint8_t a = 0)
+    {
+        (void)id;
+        (void)a;
+    }
+
+    int16_t width() override { return created() ? _width : 0; }
+    int16_t height() override { return created() ? _height : 0; }
+
+    void fillSprite(uint32_t color) { fillRect(0, 0, _width, _height, color); }
+
+    void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+    uint16_t readPixel(int32_t x, int32_t y) override;
+
+    // Copy an image into the sprite (byte order follows setSwapBytes)
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data)
+    {
+        pushImage(x, y, w, h, (const uint16_t *)data);
+    }
+
+    // Send the sprite to the panel
+    void pushSprite(int32_t x, int32_t y);
+    void pushSprite(int32_t x, int32_t y, uint16_t transparent);
+
+protected:
+    void plot(int32_t x, int32_t y, uint16_t color) override;
+    uint16_t peek(int32_t x, int32_t y) override;
+
+private:
+    TFT_eSPI *tft;
+    std::vector<uint16_t> img;
+};
+
+#endif // TFT_ESPI_HOST_H
@@ -0,0 +1,72 @@
+#include "XPT2046_Touchscreen.h"
+#include <mutex>
+
+// The simulator presses the panel from its own thread while the game
+// samples it from a task, so the "controller" state sits behind a mutex
+static std::mutex simTouchMutex;
+static uint8_t simIrqPin = 255;
+static bool simPressed = false;
+static TS_Point simPoint;
+
+void simTouchPress(int16_t rawX, int16_t rawY, int16_t z)
+{
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    simPressed = true;
+    simPoint = TS_Point(rawX, rawY, z);
+    if (simIrqPin != 255)
+        simSetPinLevel(simIrqPin, LOW);
+}
+
+void simTouchSetIrqPin(uint8_t pin)
+{
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    simIrqPin = pin;
+}
+
+void simTouchRelease()
+{
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    simPressed = false;
+    if (simIrqPin != 255)
+        simSetPinLevel(simIrqPin, HIGH);
+}
+
+XPT2046_Touchscreen::XPT2046_Touchscreen(uint8_t cspin, uint8_t tirq)
+    : csPin(cspin), tirqPin(tirq), rotation(1)
+{
+}
+
+bool XPT2046_Touchscreen::begin(SPIClass &wspi)
+{
+    (void)wspi;
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    if (tirqPin != 255)
+        simIrqPin = tirqPin;
+    return true;
+}
+
+TS_Point XPT2046_Touchscreen::getPoint()
+{
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    return simPressed ? simPoint : TS_Point(0, 0, 0);
+}
+
+bool XPT2046_Touchscreen::tirqTouched()
+{
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    return simPressed;
+}
+
+bool XPT2046_Touchscreen::touched()
+{
+    std::lock_guard<std::mutex> lock(simTouchMutex);
+    return simPressed;
+}
+
+void XPT2046_Touchscreen::readData(uint16_t *x, uint16_t *y, uint8_t *z)
+{
+    TS_Point p = getPoint();
+    *x = p.x;
+    *y = p.y;
+    *z = p.z > 255 ? 255 : p.z;
+}
@@ -0,0 +1,55 @@
+/*
+ * XPT2046_Touchscreen.h - Host-native stand-in for the XPT2046 driver
+ *
+ * The simulator presses the "panel" with simTouchPress()/simTouchRelease().
+ * While pressed, the IRQ line is held low exactly like the real controller
+ * (a falling edge runs the pin's interrupt handler), so touch.cpp runs its
+ * normal sampling path unchanged. The line is wired whether or not the
+ * driver was given the pin.
+ */
+
+#ifndef XPT2046_TOUCHSCREEN_HOST_H
+#define XPT2046_TOUCHSCREEN_HOST_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+class TS_Point
+{
+public:
+    TS_Point() : x(0), y(0), z(0) {}
+    TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+
+    bool operator==(TS_Point p) { return p.x == x && p.y == y && p.z == z; }
+    bool operator!=(TS_Point p) { return !(*this == p); }
+
+    int16_t x, y, z;
+};
+
+class XPT2046_Touchscreen
+{
+public:
+    XPT2046_Touchscreen(uint8_t cspin, uint8_t tirq = 255);
+
+    bool begin(SPIClass &wspi = SPI);
+    TS_Point getPoint();
+    bool tirqTouched();
+    bool touched();
+    void readData(uint16_t *x, uint16_t *y, uint8_t *z);
+    bool bufferEmpty() { return true; }
+    uint8_t bufferSize() { return 1; }
+    void setRotation(uint8_t n) { rotation = n % 4; }
+
+private:
+    uint8_t csPin, tirqPin, rotation;
+};
+
+// Simulated finger (raw controller units after rotation, as getPoint() reports)
+void simTouchPress(int16_t rawX, int16_t rawY, int16_t z = 1000);
+void simTouchRelease();
+
+// GPIO the controller's IRQ line is wired to (begin() sets it too when the
+// driver is given an IRQ pin)
+void simTouchSetIrqPin(uint8_t pin);
+
+#endif // XPT2046_TOUCHSCREEN_HOST_H
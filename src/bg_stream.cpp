@@ -0,0 +1,269 @@
+#include "bg_stream.h"
+#include "sdcard.h"
+#include <SD.h>
+#include <string.h>
+
+// .qbg file: "BGQ1", uint16 width, uint16 height, uint16 band rows,
+// uint16 bands, uint32 offset[bands + 1], then the compressed bands.
+// All little-endian.
+#define BG_MAGIC "BGQ1"
+#define BG_HEADER 12
+
+// Largest band (rows x width) a file may use: each one fills a cache slot,
+// and a band this size already needs 128 KB per slot
+#define BG_MAX_BAND_PIXELS 0xFFFF
+
+// Codec ops (tools/img2qbg.py has the full description)
+#define BG_OP_INDEX 0x00 // 00iiiiii
+#define BG_OP_DIFF 0x40  // 01rrggbb
+#define BG_OP_LUMA 0x80  // 10gggggg rrrrbbbb
+#define BG_OP_RUN 0xC0   // 11nnnnnn
+#define BG_OP_RGB 0xFE   // 11111110 lo hi
+#define BG_OP_MASK 0xC0
+
+// One decoded band
+struct BgSlot
+{
+    int16_t band;     // -1 while empty
+    uint32_t lastUse; // bgTick at the last hit (LRU)
+    uint16_t *pixels; // bandRows x width
+};
+
+static File bgFile;
+static uint16_t bgW = 0;
+static uint16_t bgH = 0;
+static uint16_t bgBandRows = 0;
+static uint16_t bgBands = 0;
+static uint32_t *bgOffsets = nullptr; // bgBands + 1
+static uint8_t *bgScratch = nullptr;  // Compressed bytes of the largest band
+static BgSlot bgSlots[BG_CACHE_BANDS];
+static uint16_t *bgCache = nullptr; // Pixels of every slot, one block
+static uint32_t bgTick = 0;
+
+static inline uint8_t bgHash(uint16_t c)
+{
+    return (((c >> 11) & 0x1F) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) & 63;
+}
+
+static inline uint16_t bgPack(int16_t r, int16_t g, int16_t b)
+{
+    return ((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F);
+}
+
+bool bgOpen(const char *path)
+{
+    bgClose();
+    if (!sdIsReady())
+        return false;
+
+    bgFile = SD.open(path, FILE_READ);
+    if (!bgFile)
+    {
+#if DEBUG_SERIAL
+        Serial.print("SD: Failed to open ");
+        Serial.println(path);
+#endif
+        return false;
+    }
+
+    uint8_t header[BG_HEADER] = {0};
+    bool ok = bgFile.read(header, sizeof(header)) == sizeof(header) &&
+              memcmp(header, BG_MAGIC, 4) == 0;
+    bgW = header[4] | (header[5] << 8);
+    bgH = header[6] | (header[7] << 8);
+    bgBandRows = header[8] | (header[9] << 8);
+    bgBands = header[10] | (header[11] << 8);
+    ok = ok && bgW > 0 && bgBandRows > 0 && bgBands == (bgH + bgBandRows - 1) / bgBandRows &&
+         (uint32_t)bgBandRows * bgW <= BG_MAX_BAND_PIXELS;
+
+    // Offset table, then the largest band sizes the scratch buffer
+    uint32_t largest = 0;
+    if (ok)
+    {
+        bgOffsets = (uint32_t *)malloc((bgBands + 1) * sizeof(uint32_t));
+        size_t tableBytes = (bgBands + 1) * sizeof(uint32_t);
+        ok = bgOffsets && bgFile.read((uint8_t *)bgOffsets, tableBytes) == tableBytes &&
+             bgOffsets[bgBands] == bgFile.size();
+        for (uint16_t b = 0; ok && b < bgBands; b++)
+        {
+            ok = bgOffsets[b + 1] >= bgOffsets[b];
+            if (ok && bgOffsets[b + 1] - bgOffsets[b] > largest)
+                largest = bgOffsets[b + 1] - bgOffsets[b];
+        }
+    }
+    if (!ok)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Not a background: ");
+        Serial.println(path);
+#endif
+        bgClose();
+        return false;
+    }
+
+    size_t bandPixels = (size_t)bgBandRows * bgW;
+    bgScratch = (uint8_t *)malloc(largest ? largest : 1);
+    bgCache = (uint16_t *)malloc(BG_CACHE_BANDS * bandPixels * sizeof(uint16_t));
+    if (!bgScratch || !bgCache)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to allocate background cache: ");
+        Serial.println(path);
+#endif
+        bgClose();
+        return false;
+    }
+
+    for (uint8_t s = 0; s < BG_CACHE_BANDS; s++)
+    {
+        bgSlots[s].band = -1;
+        bgSlots[s].lastUse = 0;
+        bgSlots[s].pixels = bgCache + s * bandPixels;
+    }
+
+#if DEBUG_SERIAL
+    Serial.print("Background: ");
+    Serial.print(path);
+    Serial.print(" (");
+    Serial.print(bgW);
+    Serial.print("x");
+    Serial.print(bgH);
+    Serial.print(", ");
+    Serial.print(bgOffsets[bgBands]);
+    Serial.println(" bytes)");
+#endif
+
+    return true;
+}
+
+void bgClose()
+{
+    if (bgFile)
+        bgFile.close();
+    free(bgOffsets);
+    free(bgScratch);
+    free(bgCache);
+    bgOffsets = nullptr;
+    bgScratch = nullptr;
+    bgCache = nullptr;
+    bgW = bgH = 0;
+    bgBands = 0;
+}
+
+bool bgIsOpen()
+{
+    return bgCache != nullptr;
+}
+
+uint16_t bgWidth()
+{
+    return bgW;
+}
+
+uint16_t bgHeight()
+{
+    return bgH;
+}
+
+// Read and decode one band into out. Pixels a damaged band doesn't cover
+// are left black.
+static bool bgDecodeBand(uint16_t band, uint16_t *out)
+{
+    uint32_t len = bgOffsets[band + 1] - bgOffsets[band];
+    if (!bgFile.seek(bgOffsets[band]) || bgFile.read(bgScratch, len) != len)
+        return false;
+
+    uint16_t rows = min((uint16_t)(bgH - band * bgBandRows), bgBandRows);
+    uint32_t n = (uint32_t)rows * bgW;
+    uint32_t i = 0;
+    const uint8_t *p = bgScratch;
+    const uint8_t *end = bgScratch + len;
+
+    uint16_t table[64] = {0};
+    uint16_t prev = 0;
+
+    while (i < n && p < end)
+    {
+        uint8_t op = *p++;
+
+        if (op == BG_OP_RGB)
+        {
+            if (end - p < 2)
+                break;
+            prev = p[0] | (p[1] << 8);
+            p += 2;
+        }
+        else if ((op & BG_OP_MASK) == BG_OP_RUN)
+        {
+            uint32_t run = min((uint32_t)(op & 0x3F) + 1, n - i);
+            while (run--)
+                out[i++] = prev;
+            continue;
+        }
+        else if ((op & BG_OP_MASK) == BG_OP_INDEX)
+        {
+            prev = table[op & 0x3F];
+            out[i++] = prev;
+            continue;
+        }
+        else
+        {
+            int16_t r = (prev >> 11) & 0x1F;
+            int16_t g = (prev >> 5) & 0x3F;
+            int16_t b = prev & 0x1F;
+            if ((op & BG_OP_MASK) == BG_OP_DIFF)
+            {
+                r += ((op >> 4) & 3) - 2;
+                g += ((op >> 2) & 3) - 2;
+                b += (op & 3) - 2;
+            }
+            else
+            {
+                if (p >= end)
+                    break;
+                int16_t dg = (op & 0x3F) - 32;
+                uint8_t rb = *p++;
+                r += dg + (rb >> 4) - 8;
+                g += dg;
+                b += dg + (rb & 0x0F) - 8;
+            }
+            prev = bgPack(r, g, b);
+        }
+
+        table[bgHash(prev)] = prev;
+        out[i++] = prev;
+    }
+
+    if (i < n)
+        memset(out + i, 0, (n - i) * sizeof(uint16_t));
+    return true;
+}
+
+const uint16_t *bgRow(int16_t y)
+{
+    if (!bgCache || y < 0 || y >= bgH)
+        return nullptr;
+
+    int16_t band = y / bgBandRows;
+    uint32_t offset = (uint32_t)(y - band * bgBandRows) * bgW;
+    bgTick++;
+
+    BgSlot *victim = &bgSlots[0];
+    for (uint8_t s = 0; s < BG_CACHE_BANDS; s++)
+    {
+        if (bgSlots[s].band == band)
+        {
+            bgSlots[s].lastUse = bgTick;
+            return bgSlots[s].pixels + offset;
+        }
+        if (bgSlots[s].lastUse < victim->lastUse)
+            victim = &bgSlots[s];
+    }
+
+    victim->band = -1;
+    if (!bgDecodeBand(band, victim->pixels))
+        return nullptr;
+    victim->band = band;
+    victim->lastUse = bgTick;
+    return victim->pixels + offset;
+}
@@ -1,89 +1,101 @@
 #include "coins.h"
 #include "game_state.h"
+#include "particles.h"
+#include "spatial_grid.h"
 #include <math.h>
 
-// Coin pool
-Coin coinPool[MAX_COINS];
+// Live coins
+CoinStore coinStore;
+
+// Broadphase for taps and drags
+static SpatialGrid coinGrid;
+static uint16_t coinGridItems[MAX_COINS];
+
+// Coins are drawn up to this far sideways of x (bob)
+#define COIN_BOB_REACH 3
 
 void coinsInit() {
-    for (int i = 0; i < MAX_COINS; i++) {
-        coinPool[i].active = false;
-    }
+    coinStore.clear();
+    gridInit(coinGrid, coinGridItems, MAX_COINS);
 }
 
 void coinsUpdate(unsigned long deltaTime) {
-    unsigned long now = millis();
+    unsigned long now = gameMillis();
+    coinGrid.dirty = true;
 
-    for (int i = 0; i < MAX_COINS; i++) {
-        Coin* coin = &coinPool[i];
-        if (!coin->active) continue;
+    // Float upward slowly (every coin rises at its vy)
+    coinStore.integrate(SIM_DT);
 
-        // Float upward slowly
-        coin->y -= COIN_FLOAT_SPEED;
+    // The last coin moves into a removed row, so only step past survivors
+    for (uint16_t r = 0; r < coinStore.count; ) {
+        Coin* coin = &coinStore.data[r];
 
         // Bob side to side
-        coin->floatOffset += 0.1f;
+        coin->prevFloatOffset = coin->floatOffset;
+        coin->floatOffset += COIN_BOB_SPEED * SIM_DT;
 
         // Check expiration
         if (now - coin->spawnTime > COIN_LIFETIME) {
-            coin->active = false;
+            coinStore.removeRow(r);
 #if DEBUG_SERIAL
             // Serial.println("Coin expired");
 #endif
+            continue;
         }
 
         // Stop at surface
-        if (coin->y < TANK_TOP + COIN_SIZE) {
-            coin->y = TANK_TOP + COIN_SIZE;
+        if (coinStore.y[r] < TANK_TOP + COIN_SIZE) {
+            coinStore.y[r] = TANK_TOP + COIN_SIZE;
         }
-    }
-}
 
-Coin* coinSpawn(float x, float y, uint8_t value) {
-    // Find inactive slot
-    Coin* coin = nullptr;
-    for (int i = 0; i < MAX_COINS; i++) {
-        if (!coinPool[i].active) {
-            coin = &coinPool[i];
-            break;
-        }
+        r++;
     }
+}
 
-    if (!coin) {
+EntityId coinSpawn(float x, float y, uint8_t value) {
+    uint16_t r = coinStore.spawn(x, y);
+    if (r == ENTITY_NONE) {
 #if DEBUG_SERIAL
         Serial.println("Coin pool full!");
 #endif
-        return nullptr;
+        return ENTITY_NONE;
     }
 
-    coin->active = true;
-    coin->x = x;
-    coin->y = y;
+    Coin* coin = &coinStore.data[r];
+    coinStore.vy[r] = -COIN_FLOAT_SPEED;
     coin->value = value;
-    coin->spawnTime = millis();
-    coin->floatOffset = random(100) / 100.0f * 6.28f;  // Random phase
+    coin->spawnTime = gameMillis();
+    coin->floatOffset = gameRandom(100) / 100.0f * 6.28f;  // Random phase
+    coin->prevFloatOffset = coin->floatOffset;
+    coinGrid.dirty = true;
 
-    return coin;
+    return coinStore.id[r];
 }
 
 uint8_t coinCollect(int16_t screenX, int16_t screenY) {
-    // Check each coin
-    for (int i = 0; i < MAX_COINS; i++) {
-        Coin* coin = &coinPool[i];
-        if (!coin->active) continue;
+    const float reach = COIN_SIZE * 2;  // Generous tap target
+
+    // Only coins near the tap (first in id order wins)
+    uint16_t nearby[MAX_COINS];
+    uint16_t n = coinQuery(screenX, screenY, reach + COIN_BOB_REACH, nearby, MAX_COINS);
+
+    for (uint16_t k = 0; k < n; k++) {
+        uint16_t r = coinStore.find(nearby[k]);
+        if (r == ENTITY_NONE) continue;
+        const Coin* coin = &coinStore.data[r];
 
         // Calculate display position (with bob offset)
-        float displayX = coin->x + sinf(coin->floatOffset) * 3;
-        float displayY = coin->y;
+        float displayX = coinStore.x[r] + sinf(coin->floatOffset) * COIN_BOB_REACH;
+        float displayY = coinStore.y[r];
 
         // Check if tap is within coin radius
         float dx = screenX - displayX;
         float dy = screenY - displayY;
-        float dist = sqrtf(dx * dx + dy * dy);
 
-        if (dist < COIN_SIZE * 2) {  // Generous tap target
+        if (dx * dx + dy * dy < reach * reach) {
             uint8_t value = coin->value;
-            coin->active = false;
+            particleEmit(EMIT_COIN_SPARKLE, displayX, displayY);
+            coinStore.removeRow(r);
 
             // Add to game coins
             game.coins += value;
@@ -108,19 +120,24 @@ uint8_t coinCollect(int16_t screenX, int16_t screenY) {
 uint8_t coinCollectRadius(int16_t screenX, int16_t screenY, int16_t radius) {
     uint8_t totalValue = 0;
 
-    for (int i = 0; i < MAX_COINS; i++) {
-        Coin* coin = &coinPool[i];
-        if (!coin->active) continue;
+    uint16_t nearby[MAX_COINS];
+    uint16_t n = coinQuery(screenX, screenY, radius, nearby, MAX_COINS);
 
-        float dx = screenX - coin->x;
-        float dy = screenY - coin->y;
-        float dist = sqrtf(dx * dx + dy * dy);
+    // Ids stay valid while rows shuffle under removeRow
+    for (uint16_t k = 0; k < n; k++) {
+        uint16_t r = coinStore.find(nearby[k]);
+        if (r == ENTITY_NONE) continue;
+        uint8_t value = coinStore.data[r].value;
 
-        if (dist < radius) {
-            totalValue += coin->value;
-            game.coins += coin->value;
-            game.totalCoinsEarned += coin->value;
-            coin->active = false;
+        float dx = screenX - coinStore.x[r];
+        float dy = screenY - coinStore.y[r];
+
+        if (dx * dx + dy * dy < (float)radius * radius) {
+            totalValue += value;
+            game.coins += value;
+            game.totalCoinsEarned += value;
+            particleEmit(EMIT_COIN_SPARKLE, coinStore.x[r], coinStore.y[r]);
+            coinStore.removeRow(r);
         }
     }
 
@@ -131,10 +148,28 @@ uint8_t coinCollectRadius(int16_t screenX, int16_t screenY, int16_t radius) {
     return totalValue;
 }
 
-uint8_t coinGetCount() {
-    uint8_t count = 0;
-    for (int i = 0; i < MAX_COINS; i++) {
-        if (coinPool[i].active) count++;
+uint8_t coinCollectPath(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t radius) {
+    // Circles one radius apart along the segment: the band they cover has
+    // no gaps a coin could slip through
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    uint16_t steps = (uint16_t)ceilf(sqrtf(dx * dx + dy * dy) / radius);
+
+    uint8_t totalValue = 0;
+    for (uint16_t i = 0; i <= steps; i++) {
+        float t = steps ? (float)i / steps : 0.0f;
+        totalValue += coinCollectRadius(x0 + dx * t, y0 + dy * t, radius);
     }
-    return count;
+    return totalValue;
+}
+
+uint16_t coinQuery(float x, float y, float radius, uint16_t* out, uint16_t maxOut) {
+    if (coinGrid.dirty) {
+        gridBuild(coinGrid, coinStore);
+    }
+    return gridQuery(coinGrid, x, y, radius, out, maxOut);
+}
+
+uint8_t coinGetCount() {
+    return coinStore.count;
 }
@@ -0,0 +1,135 @@
+#include "dirty_rects.h"
+
+static DirtyRect rects[DIRTY_MAX_RECTS];
+static uint8_t rectCount = 0;
+static bool fullRedraw = false;
+
+static inline int32_t rectArea(const DirtyRect &r)
+{
+    return (int32_t)r.w * r.h;
+}
+
+static DirtyRect rectUnion(const DirtyRect &a, const DirtyRect &b)
+{
+    int16_t x0 = min(a.x, b.x);
+    int16_t y0 = min(a.y, b.y);
+    int16_t x1 = max((int16_t)(a.x + a.w), (int16_t)(b.x + b.w));
+    int16_t y1 = max((int16_t)(a.y + a.h), (int16_t)(b.y + b.h));
+    return {x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+// Overlapping or sharing an edge
+static inline bool rectTouches(const DirtyRect &a, const DirtyRect &b)
+{
+    return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+           a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+void dirtyReset()
+{
+    rectCount = 0;
+    fullRedraw = false;
+}
+
+void dirtyAddAll()
+{
+    rects[0] = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+    rectCount = 1;
+    fullRedraw = true;
+}
+
+void dirtyAdd(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (fullRedraw)
+        return;
+
+    // Clip to screen
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > SCREEN_WIDTH)
+        w = SCREEN_WIDTH - x;
+    if (y + h > SCREEN_HEIGHT)
+        h = SCREEN_HEIGHT - y;
+    if (w <= 0 || h <= 0)
+        return;
+
+    DirtyRect r = {x, y, w, h};
+
+    // Absorb every rect the new one touches; the grown rect may now touch
+    // ones it missed, so rescan until nothing changes
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (uint8_t i = 0; i < rectCount; i++)
+        {
+            if (rectTouches(r, rects[i]))
+            {
+                r = rectUnion(r, rects[i]);
+                rects[i] = rects[--rectCount];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    // List full: fold into the rect that grows the least
+    if (rectCount == DIRTY_MAX_RECTS)
+    {
+        uint8_t best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for (uint8_t i = 0; i < rectCount; i++)
+        {
+            int32_t growth = rectArea(rectUnion(r, rects[i])) - rectArea(rects[i]);
+            if (growth < bestGrowth)
+            {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        r = rectUnion(r, rects[best]);
+        rects[best] = rects[--rectCount];
+    }
+
+    rects[rectCount++] = r;
+
+    // Past the threshold one full-screen push beats many partial ones
+    if (dirtyArea() * 100 > (uint32_t)SCREEN_WIDTH * SCREEN_HEIGHT * DIRTY_FULL_PERCENT)
+        dirtyAddAll();
+}
+
+void dirtyAdd(const DirtyRect &r)
+{
+    dirtyAdd(r.x, r.y, r.w, r.h);
+}
+
+bool dirtyIsFull()
+{
+    return fullRedraw;
+}
+
+uint8_t dirtyCount()
+{
+    return rectCount;
+}
+
+const DirtyRect &dirtyGet(uint8_t index)
+{
+    return rects[index];
+}
+
+uint32_t dirtyArea()
+{
+    uint32_t area = 0;
+    for (uint8_t i = 0; i < rectCount; i++)
+        area += rectArea(rects[i]);
+    return area;
+}
@@ -2,42 +2,63 @@
 #include "food.h"
 #include "coins.h"
 #include "game_state.h"
+#include "particles.h"
+#include "spatial_grid.h"
 #include <math.h>
 
 // Fish stats table
 const FishStats FISH_DATA[] = {
-    // name,              hunger, coin, speed, stages, cost
-    {"Rainbow Trout",     2,      1,    1.0f,  3,      25},
-    {"Bluegill",          3,      1,    1.3f,  2,      20},
-    {"Smallmouth Bass",   2,      2,    1.0f,  3,      50},
-    {"Channel Catfish",   1,      4,    0.6f,  3,      75},
-    {"Largemouth Bass",   2,      5,    0.8f,  3,      150}
+    // name,              hunger, coin, speed, stages, cost, frames, frame ms
+    {"Rainbow Trout",     2,      1,    1.0f,  3,      25,   4,      200},
+    {"Bluegill",          3,      1,    1.3f,  2,      20,   4,      150},
+    {"Smallmouth Bass",   2,      2,    1.0f,  3,      50,   4,      200},
+    {"Channel Catfish",   1,      4,    0.6f,  3,      75,   4,      300},
+    {"Largemouth Bass",   2,      5,    0.8f,  3,      150,  4,      250}
 };
 
-// Fish pool
-Fish fishPool[MAX_FISH];
-uint8_t fishCount = 0;
+// Live fish
+FishStore fishStore;
 
-// Internal helpers
-static void fishUpdateMovement(Fish* fish, unsigned long deltaTime);
+// Broadphase for taps on fish
+static SpatialGrid fishGrid;
+static uint16_t fishGridItems[MAX_FISH];
+
+// Drawn size per species and growth stage (0: not set, use FISH_WIDTH x
+// FISH_HEIGHT scaled), and the largest half extent of any of them
+static uint16_t fishDrawW[FISH_SPECIES_COUNT][FISH_MAX_STAGES];
+static uint16_t fishDrawH[FISH_SPECIES_COUNT][FISH_MAX_STAGES];
+static float fishReach = FISH_WIDTH / 2.0f * (1.0f + (FISH_MAX_STAGES - 1) * FISH_STAGE_SCALE);
+
+// Fish spawned this game (picks each new fish's colour variant)
+static uint16_t fishSpawnCount = 0;
+
+// Hunting range for fish below half hunger
+#define FISH_SEEK_RADIUS 80.0f
+
+// Internal helpers (by row in fishStore)
+static void fishUpdateMovement(uint16_t row);
 static void fishUpdateHunger(Fish* fish, unsigned long deltaTime);
-static void fishCheckFood(Fish* fish);
-static void fishDropCoin(Fish* fish);
+static void fishCheckFood(uint16_t row);
+static void fishDropCoin(uint16_t row);
 static void fishPickNewTarget(Fish* fish);
 
 void fishInit() {
-    for (int i = 0; i < MAX_FISH; i++) {
-        fishPool[i].active = false;
-    }
-    fishCount = 0;
+    fishStore.clear();
+    gridInit(fishGrid, fishGridItems, MAX_FISH);
+    fishSpawnCount = 0;
 }
 
 void fishUpdate(unsigned long deltaTime) {
-    unsigned long now = millis();
+    unsigned long now = gameMillis();
+    fishGrid.dirty = true;
 
-    for (int i = 0; i < MAX_FISH; i++) {
-        Fish* fish = &fishPool[i];
-        if (!fish->active) continue;
+    // A removal moves the last fish into the row, so only step past
+    // rows that survive
+    for (uint16_t r = 0; r < fishStore.count; ) {
+        Fish* fish = &fishStore.data[r];
+
+        fishStore.prevX[r] = fishStore.x[r];
+        fishStore.prevY[r] = fishStore.y[r];
 
         // Update hunger
         fishUpdateHunger(fish, deltaTime);
@@ -46,7 +67,7 @@ void fishUpdate(unsigned long deltaTime) {
         if (fish->hunger == 0) {
             unsigned long timeSinceLastFed = now - fish->lastFed;
             if (timeSinceLastFed > FISH_STARVE_TIME) {
-                fishRemove(fish);
+                fishStore.removeRow(r);
                 game.fishLost++;
 #if DEBUG_SERIAL
                 Serial.println("Fish starved!");
@@ -56,94 +77,87 @@ void fishUpdate(unsigned long deltaTime) {
         }
 
         // Check for nearby food
-        fishCheckFood(fish);
+        fishCheckFood(r);
 
         // Update movement
-        fishUpdateMovement(fish, deltaTime);
+        fishUpdateMovement(r);
 
         // Drop coins periodically (based on growth stage)
         if (fish->hunger > 50) {  // Only drop coins if not too hungry
             unsigned long coinInterval = 5000 - (fish->growthStage * 1000);  // Faster as they grow
             if (now - fish->lastCoinDrop > coinInterval) {
-                fishDropCoin(fish);
+                fishDropCoin(r);
                 fish->lastCoinDrop = now;
             }
         }
 
-        // Update animation frame
-        if (now - fish->lastFrameTime > 200) {
-            fish->frame = (fish->frame + 1) % 4;
+        // Update animation frame (the renderer wraps it to its sheet)
+        const FishStats* stats = &FISH_DATA[fish->species];
+        if (now - fish->lastFrameTime > stats->frameMs) {
+            fish->frame = (fish->frame + 1) % stats->animFrames;
             fish->lastFrameTime = now;
         }
-    }
-}
 
-Fish* fishSpawn(FishSpecies species, float x, float y) {
-    // Find inactive slot
-    Fish* fish = nullptr;
-    for (int i = 0; i < MAX_FISH; i++) {
-        if (!fishPool[i].active) {
-            fish = &fishPool[i];
-            break;
-        }
+        r++;
     }
+}
 
-    if (!fish) {
+EntityId fishSpawn(FishSpecies species, float x, float y) {
+    uint16_t r = fishStore.spawn(x, y);
+    if (r == ENTITY_NONE) {
 #if DEBUG_SERIAL
         Serial.println("Fish pool full!");
 #endif
-        return nullptr;
+        return ENTITY_NONE;
     }
 
     // Initialize fish
-    fish->active = true;
+    Fish* fish = &fishStore.data[r];
     fish->species = species;
-    fish->x = x;
-    fish->y = y;
-    fish->vx = 0;
-    fish->vy = 0;
     fishPickNewTarget(fish);
 
     fish->growthStage = 0;
     fish->hunger = FISH_HUNGER_MAX;
-    fish->lastFed = millis();
-    fish->lastCoinDrop = millis();
+    fish->lastFed = gameMillis();
+    fish->lastCoinDrop = gameMillis();
 
     fish->frame = 0;
-    fish->facingRight = (random(2) == 0);
-    fish->lastFrameTime = millis();
+    fish->facingRight = (gameRandom(2) == 0);
+    fish->lastFrameTime = gameMillis();
 
-    fish->tint = 0;  // No tint for now
+    // Variants take turns (not gameRandom(), which drives gameplay); the
+    // first fish keeps its art colours
+    fish->tint = fishSpawnCount++ % FISH_TINTS;
 
-    fishCount++;
+    fishGrid.dirty = true;
 
 #if DEBUG_SERIAL
     Serial.print("Spawned: ");
     Serial.println(FISH_DATA[species].name);
 #endif
 
-    return fish;
+    return fishStore.id[r];
 }
 
-void fishRemove(Fish* fish) {
-    if (fish && fish->active) {
-        fish->active = false;
-        fishCount--;
-    }
+void fishRemove(EntityId fish) {
+    fishStore.remove(fish);
 }
 
-void fishFeed(Fish* fish) {
-    if (!fish || !fish->active) return;
+void fishFeed(EntityId id) {
+    uint16_t r = fishStore.find(id);
+    if (r == ENTITY_NONE) return;
+    Fish* fish = &fishStore.data[r];
 
     fish->hunger = FISH_HUNGER_MAX;
-    fish->lastFed = millis();
+    fish->lastFed = gameMillis();
     game.fishFed++;
+    particleEmit(EMIT_FEED_BUBBLES, fishStore.x[r], fishStore.y[r]);
 
     // Check for growth
     const FishStats* stats = &FISH_DATA[fish->species];
     if (fish->growthStage < stats->growthStages - 1) {
         // Random chance to grow when fed
-        if (random(100) < 20) {  // 20% chance
+        if (gameRandom(100) < 20) {  // 20% chance
             fish->growthStage++;
 #if DEBUG_SERIAL
             Serial.print(stats->name);
@@ -154,30 +168,58 @@ void fishFeed(Fish* fish) {
     }
 }
 
-bool fishIsHungry(Fish* fish) {
-    return fish && fish->active && fish->hunger < 30;
+bool fishIsHungry(const Fish* fish) {
+    return fish && fish->hunger < 30;
 }
 
-Fish* fishGetAt(int16_t screenX, int16_t screenY) {
-    // Check from front to back (last drawn = front)
-    for (int i = MAX_FISH - 1; i >= 0; i--) {
-        Fish* fish = &fishPool[i];
-        if (!fish->active) continue;
+void fishSetDrawSize(FishSpecies species, uint8_t stage, uint16_t width, uint16_t height) {
+    if (species >= FISH_SPECIES_COUNT || stage >= FISH_MAX_STAGES) return;
+    fishDrawW[species][stage] = width;
+    fishDrawH[species][stage] = height;
+    fishReach = max(fishReach, max(width, height) / 2.0f);
+}
 
-        // Simple bounding box check
-        float halfW = FISH_WIDTH / 2.0f * (1.0f + fish->growthStage * 0.3f);
-        float halfH = FISH_HEIGHT / 2.0f * (1.0f + fish->growthStage * 0.3f);
+EntityId fishGetAt(int16_t screenX, int16_t screenY) {
+    // Candidates within the largest half extent of any fish
+    uint16_t nearby[MAX_FISH];
+    uint16_t n = fishQuery(screenX, screenY, fishReach, nearby, MAX_FISH);
+
+    // Fish are drawn in row order, so the hit with the highest row is
+    // the one in front
+    uint16_t front = ENTITY_NONE;
+    for (uint16_t k = 0; k < n; k++) {
+        uint16_t r = fishStore.find(nearby[k]);
+        if (r == ENTITY_NONE) continue;
+        if (front != ENTITY_NONE && r < front) continue;
+
+        // Box the fish is drawn in
+        const Fish* fish = &fishStore.data[r];
+        float fx = fishStore.x[r];
+        float fy = fishStore.y[r];
+        float halfW = FISH_WIDTH / 2.0f * fishStageScale(fish->growthStage);
+        float halfH = FISH_HEIGHT / 2.0f * fishStageScale(fish->growthStage);
+        if (fishDrawW[fish->species][fish->growthStage]) {
+            halfW = fishDrawW[fish->species][fish->growthStage] / 2.0f;
+            halfH = fishDrawH[fish->species][fish->growthStage] / 2.0f;
+        }
 
-        if (screenX >= fish->x - halfW && screenX <= fish->x + halfW &&
-            screenY >= fish->y - halfH && screenY <= fish->y + halfH) {
-            return fish;
+        if (screenX >= fx - halfW && screenX <= fx + halfW &&
+            screenY >= fy - halfH && screenY <= fy + halfH) {
+            front = r;
         }
     }
-    return nullptr;
+    return front == ENTITY_NONE ? ENTITY_NONE : fishStore.id[front];
+}
+
+uint16_t fishQuery(float x, float y, float radius, uint16_t* out, uint16_t maxOut) {
+    if (fishGrid.dirty) {
+        gridBuild(fishGrid, fishStore);
+    }
+    return gridQuery(fishGrid, x, y, radius, out, maxOut);
 }
 
 uint8_t fishGetCount() {
-    return fishCount;
+    return fishStore.count;
 }
 
 // ============================================================================
@@ -186,17 +228,23 @@ uint8_t fishGetCount() {
 
 static void fishPickNewTarget(Fish* fish) {
     // Pick random point in tank
-    fish->targetX = random(TANK_LEFT + FISH_WIDTH, TANK_RIGHT - FISH_WIDTH);
-    fish->targetY = random(TANK_TOP + FISH_HEIGHT, TANK_BOTTOM - FISH_HEIGHT);
+    fish->targetX = gameRandom(TANK_LEFT + FISH_WIDTH, TANK_RIGHT - FISH_WIDTH);
+    fish->targetY = gameRandom(TANK_TOP + FISH_HEIGHT, TANK_BOTTOM - FISH_HEIGHT);
 }
 
-static void fishUpdateMovement(Fish* fish, unsigned long deltaTime) {
+static void fishUpdateMovement(uint16_t r) {
+    Fish* fish = &fishStore.data[r];
+    float& x = fishStore.x[r];
+    float& y = fishStore.y[r];
+    float& vx = fishStore.vx[r];
+    float& vy = fishStore.vy[r];
+
     const FishStats* stats = &FISH_DATA[fish->species];
     float speed = FISH_SPEED_MIN + (FISH_SPEED_MAX - FISH_SPEED_MIN) * stats->speedMult;
 
     // Calculate direction to target
-    float dx = fish->targetX - fish->x;
-    float dy = fish->targetY - fish->y;
+    float dx = fish->targetX - x;
+    float dy = fish->targetY - y;
     float dist = sqrtf(dx * dx + dy * dy);
 
     // Pick new target if close enough
@@ -209,24 +257,25 @@ static void fishUpdateMovement(Fish* fish, unsigned long deltaTime) {
     float moveX = (dx / dist) * speed;
     float moveY = (dy / dist) * speed;
 
-    // Apply some smoothing/inertia
-    fish->vx = fish->vx * 0.9f + moveX * 0.1f;
-    fish->vy = fish->vy * 0.9f + moveY * 0.1f;
+    // Apply some smoothing/inertia (same feel at any step rate)
+    static const float steer = 1.0f - expf(-SIM_DT / FISH_STEER_TIME);
+    vx += (moveX - vx) * steer;
+    vy += (moveY - vy) * steer;
 
     // Update position
-    fish->x += fish->vx;
-    fish->y += fish->vy;
+    x += vx * SIM_DT;
+    y += vy * SIM_DT;
 
-    // Update facing direction
-    if (fabsf(fish->vx) > 0.1f) {
-        fish->facingRight = (fish->vx > 0);
+    // Update facing direction (ignore drift under 3 px/s)
+    if (fabsf(vx) > 3.0f) {
+        fish->facingRight = (vx > 0);
     }
 
     // Clamp to tank bounds
     float halfW = FISH_WIDTH / 2.0f;
     float halfH = FISH_HEIGHT / 2.0f;
-    fish->x = constrain(fish->x, TANK_LEFT + halfW, TANK_RIGHT - halfW);
-    fish->y = constrain(fish->y, TANK_TOP + halfH, TANK_BOTTOM - halfH);
+    x = constrain(x, TANK_LEFT + halfW, TANK_RIGHT - halfW);
+    y = constrain(y, TANK_TOP + halfH, TANK_BOTTOM - halfH);
 }
 
 static void fishUpdateHunger(Fish* fish, unsigned long deltaTime) {
@@ -244,23 +293,30 @@ static void fishUpdateHunger(Fish* fish, unsigned long deltaTime) {
     }
 }
 
-static void fishCheckFood(Fish* fish) {
-    extern Food foodPool[];
-
+static void fishCheckFood(uint16_t r) {
+    Fish* fish = &fishStore.data[r];
+    float fx = fishStore.x[r];
+    float fy = fishStore.y[r];
     float eatRadius = FISH_WIDTH / 2.0f + FOOD_SIZE;
+    bool hungry = fish->hunger < 50;
+
+    // Only pellets in reach (id order, so the same pellet wins wherever it is)
+    uint16_t nearby[MAX_FOOD];
+    uint16_t n = foodQuery(fx, fy, hungry ? max(eatRadius, FISH_SEEK_RADIUS) : eatRadius,
+                           nearby, MAX_FOOD);
 
-    for (int i = 0; i < MAX_FOOD; i++) {
-        Food* food = &foodPool[i];
-        if (!food->active) continue;
+    for (uint16_t k = 0; k < n; k++) {
+        uint16_t food = foodStore.find(nearby[k]);
+        if (food == ENTITY_NONE) continue;
 
-        float dx = food->x - fish->x;
-        float dy = food->y - fish->y;
-        float dist = sqrtf(dx * dx + dy * dy);
+        float dx = foodStore.x[food] - fx;
+        float dy = foodStore.y[food] - fy;
+        float distSq = dx * dx + dy * dy;
 
-        if (dist < eatRadius) {
+        if (distSq < eatRadius * eatRadius) {
             // Eat the food!
-            fishFeed(fish);
-            foodRemove(food);
+            fishFeed(fishStore.id[r]);
+            foodRemove(nearby[k]);
 
 #if DEBUG_FISH
             Serial.println("Fish ate food!");
@@ -269,16 +325,17 @@ static void fishCheckFood(Fish* fish) {
         }
 
         // If hungry, swim towards nearest food
-        if (fish->hunger < 50 && dist < 80) {
-            fish->targetX = food->x;
-            fish->targetY = food->y;
+        if (hungry && distSq < FISH_SEEK_RADIUS * FISH_SEEK_RADIUS) {
+            fish->targetX = foodStore.x[food];
+            fish->targetY = foodStore.y[food];
         }
     }
 }
 
-static void fishDropCoin(Fish* fish) {
+static void fishDropCoin(uint16_t r) {
+    const Fish* fish = &fishStore.data[r];
     const FishStats* stats = &FISH_DATA[fish->species];
     uint8_t value = stats->coinValue + fish->growthStage;
 
-    coinSpawn(fish->x, fish->y, value);
+    coinSpawn(fishStore.x[r], fishStore.y[r], value);
 }
@@ -1,67 +1,69 @@
 #include "food.h"
+#include "game_state.h"
+#include "particles.h"
+#include "spatial_grid.h"
 
-// Food pool
-Food foodPool[MAX_FOOD];
+// Live food
+FoodStore foodStore;
+
+// Broadphase for fish looking for food
+static SpatialGrid foodGrid;
+static uint16_t foodGridItems[MAX_FOOD];
 
 void foodInit() {
-    for (int i = 0; i < MAX_FOOD; i++) {
-        foodPool[i].active = false;
-    }
+    foodStore.clear();
+    gridInit(foodGrid, foodGridItems, MAX_FOOD);
 }
 
 void foodUpdate(unsigned long deltaTime) {
-    for (int i = 0; i < MAX_FOOD; i++) {
-        Food* food = &foodPool[i];
-        if (!food->active) continue;
+    foodGrid.dirty = true;
 
-        // Fall down
-        food->y += FOOD_FALL_SPEED;
+    // Fall down (every pellet sinks at its vy)
+    foodStore.integrate(SIM_DT);
 
-        // Remove if reached bottom
-        if (food->y >= TANK_BOTTOM - FOOD_SIZE) {
-            foodRemove(food);
+    // Remove if reached bottom (the last pellet moves into a removed row)
+    for (uint16_t r = 0; r < foodStore.count; ) {
+        if (foodStore.y[r] >= TANK_BOTTOM - FOOD_SIZE) {
+            foodStore.removeRow(r);
 #if DEBUG_SERIAL
             // Serial.println("Food hit bottom");
 #endif
+            continue;
         }
+        r++;
     }
 }
 
-Food* foodDrop(float x, float y) {
-    // Find inactive slot
-    Food* food = nullptr;
-    for (int i = 0; i < MAX_FOOD; i++) {
-        if (!foodPool[i].active) {
-            food = &foodPool[i];
-            break;
-        }
-    }
-
-    if (!food) {
+EntityId foodDrop(float x, float y) {
+    uint16_t r = foodStore.spawn(x, y);
+    if (r == ENTITY_NONE) {
 #if DEBUG_SERIAL
         Serial.println("Food pool full!");
 #endif
-        return nullptr;
+        return ENTITY_NONE;
     }
 
-    food->active = true;
-    food->x = x;
-    food->y = y;
-    food->spawnTime = millis();
+    foodStore.vy[r] = FOOD_FALL_SPEED;
+    foodStore.data[r].spawnTime = gameMillis();
+    foodGrid.dirty = true;
 
-    return food;
+    particleEmit(EMIT_FOOD_SPLASH, x, y);
+    particleEmit(EMIT_FOOD_BUBBLES, x, y);
+
+    return foodStore.id[r];
+}
+
+void foodRemove(EntityId food) {
+    foodStore.remove(food);
 }
 
-void foodRemove(Food* food) {
-    if (food) {
-        food->active = false;
+uint16_t foodQuery(float x, float y, float radius, uint16_t* out, uint16_t maxOut) {
+    if (foodGrid.dirty) {
+        gridBuild(foodGrid, foodStore);
     }
+    return gridQuery(foodGrid, x, y, radius, out, maxOut);
 }
 
 uint8_t foodGetCount() {
-    uint8_t count = 0;
-    for (int i = 0; i < MAX_FOOD; i++) {
-        if (foodPool[i].active) count++;
-    }
-    return count;
+    return foodStore.count;
 }
@@ -2,12 +2,21 @@
 #include "fish.h"
 #include "food.h"
 #include "coins.h"
+#include "particles.h"
 #include "sdcard.h"
+#include "save_state.h"
+#include "save_writer.h"
 
 // Global game data
 GameData game;
 
-void gameStateInit()
+// Game time (ms), advanced only by simulation steps
+static unsigned long gameClock = 0;
+
+// Gameplay generator (xorshift32; never zero)
+static uint32_t rngState = 0x2545F491;
+
+bool gameStateInit()
 {
     game.state = STATE_BOOT;
     game.previousState = STATE_BOOT;
@@ -22,18 +31,18 @@ void gameStateInit()
     game.enemiesDefeated = 0;
     game.bossesDefeated = 0;
 
-    game.lastUpdate = millis();
+    game.lastUpdate = gameClock;
     game.playTime = 0;
 
     game.isPaused = false;
     game.soundEnabled = true;
     game.tutorialComplete = false;
 
+    // Hardware entropy on the ESP32 (random() before randomSeed())
+    gameRandomSetState((uint32_t)random(1, 0x7FFFFFFF));
+
     // Try to load saved game
-    if (sdIsReady() && gameSaveExists())
-    {
-        gameLoad();
-    }
+    return sdIsReady() && gameSaveExists() && gameLoad();
 }
 
 void gameStateChange(GameState newState)
@@ -49,16 +58,19 @@ void gameStateChange(GameState newState)
 #endif
 }
 
-void gameStateUpdate()
+void gameStateUpdate(unsigned long deltaTime)
 {
-    unsigned long now = millis();
-    unsigned long deltaTime = now - game.lastUpdate;
-    game.lastUpdate = now;
-
     if (!game.isPaused && game.state == STATE_PLAYING)
     {
+        gameClock += deltaTime;
         game.playTime += deltaTime;
     }
+    game.lastUpdate = gameClock;
+}
+
+unsigned long gameMillis()
+{
+    return gameClock;
 }
 
 void gameStateReset()
@@ -68,10 +80,11 @@ void gameStateReset()
     game.playTime = 0;
     game.isPaused = false;
 
-    // Reset fish, food, coins
+    // Reset fish, food, coins, effects
     fishInit();
     foodInit();
     coinsInit();
+    particleInit();
 
     // Spawn starting fish
     fishSpawn(FISH_RAINBOW_TROUT, SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2);
@@ -79,54 +92,68 @@ void gameStateReset()
     gameStateChange(STATE_PLAYING);
 }
 
-// ============================================================================
-// SAVE/LOAD
-// ============================================================================
+long gameRandom(long howbig)
+{
+    if (howbig <= 0)
+        return 0;
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (long)(rngState % (uint32_t)howbig);
+}
 
-#define SAVE_MAGIC 0xBA55 // "BASS"
+long gameRandom(long howsmall, long howbig)
+{
+    if (howsmall >= howbig)
+        return howsmall;
+    return howsmall + gameRandom(howbig - howsmall);
+}
 
-struct SaveData
+uint32_t gameRandomState()
 {
-    uint16_t magic;
-    uint32_t coins;
-    uint32_t highScore;
-    uint8_t currentLevel;
-    uint8_t fishUnlocked;
-    uint32_t totalCoinsEarned;
-    uint32_t playTime;
-    bool tutorialComplete;
-    uint8_t checksum;
-};
-
-uint8_t calculateChecksum(const SaveData *data)
+    return rngState;
+}
+
+void gameRandomSetState(uint32_t state)
 {
-    uint8_t sum = 0;
-    const uint8_t *bytes = (const uint8_t *)data;
-    // Sum all bytes except checksum itself
-    for (size_t i = 0; i < sizeof(SaveData) - 1; i++)
-    {
-        sum ^= bytes[i];
-    }
-    return sum;
+    rngState = state ? state : 0x2545F491;
 }
 
+// ============================================================================
+// SAVE/LOAD
+// ============================================================================
+
+// Counts up with every save; the highest valid one on the card is newest
+static uint32_t saveSerial = 0;
+
 bool gameSave()
 {
     if (!sdIsReady())
         return false;
 
-    SaveData data;
-    data.magic = SAVE_MAGIC;
-    data.coins = game.coins;
-    data.highScore = game.highScore;
-    data.currentLevel = game.currentLevel;
-    data.fishUnlocked = game.fishUnlocked;
-    data.totalCoinsEarned = game.totalCoinsEarned;
-    data.playTime = game.playTime;
-    data.tutorialComplete = game.tutorialComplete;
-    data.checksum = calculateChecksum(&data);
-
-    return sdSaveGame(&data, sizeof(SaveData));
+#if DEBUG_SERIAL
+    uint32_t start = micros();
+#endif
+    size_t len = saveEncode(saveWriterBuffer(), SAVE_MAX_BYTES, saveSerial + 1);
+    if (len == 0)
+    {
+#if DEBUG_SERIAL
+        Serial.println("Save: Buffer too small");
+#endif
+        return false;
+    }
+    saveSerial++;
+#if DEBUG_SERIAL
+    Serial.print("Save: ");
+    Serial.print(len);
+    Serial.print(" bytes in ");
+    Serial.print(micros() - start);
+    Serial.println(" us");
+#endif
+
+    // Written by the save writer task, not here
+    saveWriterSubmit(len);
+    return true;
 }
 
 bool gameLoad()
@@ -134,45 +161,55 @@ bool gameLoad()
     if (!sdIsReady())
         return false;
 
-    SaveData data;
-    if (!sdLoadGame(&data, sizeof(SaveData)))
+    // Nothing has been submitted yet, so the writer's buffer is free. Find
+    // the newest whole save: either slot, or a temp file whose rename never
+    // happened.
+    uint8_t *buf = saveWriterBuffer();
+    uint32_t serials[SD_SAVE_SLOTS + 1] = {};
+    int8_t newest = -1;
+    for (uint8_t slot = 0; slot <= SD_SAVE_TEMP; slot++)
     {
-        return false;
+        int32_t len = sdLoadGame(slot, buf, SAVE_MAX_BYTES);
+        if (len > 0 && saveCheck(buf, len, &serials[slot]) &&
+            (newest < 0 || serials[slot] > serials[newest]))
+        {
+            newest = slot;
+        }
     }
-
-    // Validate save
-    if (data.magic != SAVE_MAGIC)
+    if (newest < 0)
     {
 #if DEBUG_SERIAL
-        Serial.println("Save: Invalid magic number");
+        Serial.println("Save: Invalid or corrupt");
 #endif
         return false;
     }
 
-    if (data.checksum != calculateChecksum(&data))
+    int32_t len = sdLoadGame(newest, buf, SAVE_MAX_BYTES);
+    if (len <= 0 || !saveDecode(buf, len))
     {
-#if DEBUG_SERIAL
-        Serial.println("Save: Checksum mismatch");
-#endif
         return false;
     }
 
-    // Load data
-    game.coins = data.coins;
-    game.highScore = data.highScore;
-    game.currentLevel = data.currentLevel;
-    game.fishUnlocked = data.fishUnlocked;
-    game.totalCoinsEarned = data.totalCoinsEarned;
-    game.playTime = data.playTime;
-    game.tutorialComplete = data.tutorialComplete;
+    // The next save overwrites the older slot
+    saveSerial = serials[newest];
+    saveWriterSetNewest(serials[0] >= serials[1] ? 0 : 1);
 
 #if DEBUG_SERIAL
-    Serial.println("Game loaded successfully");
+    Serial.print("Game loaded successfully (");
+    Serial.print(fishStore.count);
+    Serial.print(" fish, slot ");
+    Serial.print(newest == SD_SAVE_TEMP ? 'T' : (char)('A' + newest));
+    Serial.println(")");
 #endif
     return true;
 }
 
 bool gameSaveExists()
 {
-    return sdFileExists("/save/game.dat");
+    for (uint8_t slot = 0; slot <= SD_SAVE_TEMP; slot++)
+    {
+        if (sdSaveExists(slot))
+            return true;
+    }
+    return false;
 }
@@ -0,0 +1,89 @@
+#include "gesture.h"
+#include "touch.h"
+
+enum GesturePhase : uint8_t
+{
+    PHASE_UP = 0,
+    PHASE_PRESSED, // Down, still a tap
+    PHASE_DRAGGING
+};
+
+static uint8_t phase = PHASE_UP;
+static bool pressTaps = false; // This press went out as GESTURE_PRESS
+static int16_t pressX = 0;
+static int16_t pressY = 0;
+static int16_t lastX = 0; // Pen position as of the last gesture
+static int16_t lastY = 0;
+static uint32_t lastPressAt = 0;
+
+bool gesturePoll(Gesture &gesture)
+{
+    TouchEvent event;
+    while (touchPollEvent(event))
+    {
+        gesture = {GESTURE_PRESS, event.x, event.y, lastX, lastY, event.pressure, event.time};
+
+        switch (event.type)
+        {
+        case TOUCH_DOWN:
+            phase = PHASE_PRESSED;
+            pressX = lastX = event.x;
+            pressY = lastY = event.y;
+            pressTaps = event.time - lastPressAt > TOUCH_DEBOUNCE_MS;
+            if (!pressTaps)
+                continue;
+            lastPressAt = event.time;
+            return true;
+
+        case TOUCH_MOVE:
+            if (phase == PHASE_PRESSED)
+            {
+                int32_t dx = event.x - pressX;
+                int32_t dy = event.y - pressY;
+                if (dx * dx + dy * dy < GESTURE_DRAG_MIN * GESTURE_DRAG_MIN)
+                    continue;
+
+                // Segment from where the press was
+                phase = PHASE_DRAGGING;
+                gesture.type = GESTURE_DRAG_START;
+                gesture.fromX = pressX;
+                gesture.fromY = pressY;
+            }
+            else if (phase == PHASE_DRAGGING)
+            {
+                gesture.type = GESTURE_DRAG;
+            }
+            else
+            {
+                continue;
+            }
+            lastX = event.x;
+            lastY = event.y;
+            return true;
+
+        case TOUCH_UP:
+        {
+            bool dragged = phase == PHASE_DRAGGING;
+            bool pressed = phase == PHASE_PRESSED && pressTaps;
+            phase = PHASE_UP;
+            if (!dragged && !pressed)
+                continue;
+            gesture.type = dragged ? GESTURE_RELEASE : GESTURE_TAP;
+            return true;
+        }
+
+        default:
+            continue;
+        }
+    }
+    return false;
+}
+
+bool gestureDragging(int16_t &x, int16_t &y)
+{
+    if (phase != PHASE_DRAGGING)
+        return false;
+    x = lastX;
+    y = lastY;
+    return true;
+}
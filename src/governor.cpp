@@ -0,0 +1,159 @@
+#include "governor.h"
+
+static uint8_t fps = TARGET_FPS;
+static uint32_t calmSince = 0;   // millis() since the scene asked for less than fps
+static uint32_t lastTapAt = 0;   // millis() of the newest tap
+static uint32_t lastTapCount = 0;
+
+static uint8_t backlight = 0;      // Percent, as set on the pin
+static uint32_t backlightAt = 0;   // millis() of the last fade step
+static uint32_t ldrSampleAt = 0;
+static int32_t ldrLevel = GOV_LDR_BRIGHT; // Smoothed LDR reading
+
+// Backlight fades down this many ms per percent; it brightens at once
+#define GOV_FADE_MS_PER_PERCENT 20
+
+static void govSetBacklight(uint8_t percent)
+{
+    backlight = percent;
+#ifdef TFT_BL
+    uint32_t duty = (uint32_t)percent * 255 / 100;
+#if defined(TFT_BACKLIGHT_ON) && TFT_BACKLIGHT_ON == LOW
+    duty = 255 - duty;
+#endif
+    ledcWrite(GOV_BACKLIGHT_CHANNEL, duty);
+#endif
+}
+
+void govInit()
+{
+    fps = TARGET_FPS;
+    calmSince = millis();
+    lastTapAt = millis();
+    lastTapCount = 0;
+
+#ifdef TFT_BL
+    // gfxInit switched the pin on as a plain output; PWM from here on
+    ledcSetup(GOV_BACKLIGHT_CHANNEL, GOV_BACKLIGHT_FREQ, 8);
+    ledcAttachPin(TFT_BL, GOV_BACKLIGHT_CHANNEL);
+#endif
+#if GOV_USE_LDR
+    pinMode(LDR_PIN, INPUT);
+    ldrLevel = analogRead(LDR_PIN);
+#endif
+    govSetBacklight(100);
+    backlightAt = millis();
+    ldrSampleAt = millis();
+
+#if DEBUG_SERIAL
+    Serial.print("Governor: ");
+    Serial.print(GOV_STILL_FPS);
+    Serial.print("-");
+    Serial.print(TARGET_FPS);
+    Serial.println(" fps");
+#endif
+}
+
+// Brightness the room and the idle time call for
+static uint8_t govBacklightTarget(uint32_t now)
+{
+    uint8_t target = 100;
+
+#if GOV_USE_LDR
+    // Smoothed, so a hand over the sensor doesn't flash the screen
+    if (now - ldrSampleAt >= GOV_LDR_SAMPLE_MS)
+    {
+        ldrSampleAt = now;
+        ldrLevel += ((int32_t)analogRead(LDR_PIN) - ldrLevel) / 4;
+    }
+    int32_t level = constrain(ldrLevel, min(GOV_LDR_BRIGHT, GOV_LDR_DARK), max(GOV_LDR_BRIGHT, GOV_LDR_DARK));
+    target = map(level, GOV_LDR_BRIGHT, GOV_LDR_DARK, 100, GOV_BACKLIGHT_MIN);
+#endif
+
+    if (now - lastTapAt >= GOV_DIM_MS)
+        target = (uint16_t)target * GOV_DIM_PERCENT / 100;
+    return target;
+}
+
+static void govUpdateBacklight(uint32_t now)
+{
+    uint8_t target = govBacklightTarget(now);
+
+    if (target >= backlight)
+    {
+        if (target != backlight)
+            govSetBacklight(target);
+        backlightAt = now;
+        return;
+    }
+
+    uint32_t steps = (now - backlightAt) / GOV_FADE_MS_PER_PERCENT;
+    if (steps == 0)
+        return;
+    backlightAt = now;
+    govSetBacklight(backlight - min(steps, (uint32_t)(backlight - target)));
+}
+
+static void govSetFps(uint8_t rate)
+{
+    if (rate == fps)
+        return;
+    fps = rate;
+
+#if DEBUG_SERIAL
+    Serial.print("Governor: ");
+    Serial.print(fps);
+    Serial.println(" fps");
+#endif
+}
+
+void govFrameDone(uint32_t now, uint32_t drawnPixels, uint32_t tapCount)
+{
+    if (tapCount != lastTapCount)
+    {
+        lastTapCount = tapCount;
+        lastTapAt = now;
+    }
+
+    uint8_t want;
+    if (now - lastTapAt < GOV_ACTIVE_MS || drawnPixels >= GOV_BUSY_PIXELS)
+        want = TARGET_FPS;
+    else if (drawnPixels > GOV_QUIET_PIXELS)
+        want = GOV_IDLE_FPS;
+    else
+        want = GOV_STILL_FPS;
+
+    // Up at once; down one level at a time, once the scene has stayed calm
+    if (want >= fps)
+    {
+        calmSince = now;
+        govSetFps(want);
+    }
+    else if (now - calmSince >= GOV_SETTLE_MS)
+    {
+        calmSince = now;
+        govSetFps(fps > GOV_IDLE_FPS ? GOV_IDLE_FPS : GOV_STILL_FPS);
+    }
+
+    govUpdateBacklight(now);
+}
+
+uint16_t govFrameTime()
+{
+    return 1000 / fps;
+}
+
+uint32_t govTapCount()
+{
+    return lastTapCount;
+}
+
+uint8_t govFps()
+{
+    return fps;
+}
+
+uint8_t govBacklight()
+{
+    return backlight;
+}
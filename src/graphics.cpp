@@ -2,6 +2,7 @@
 #include "fish.h"
 #include "food.h"
 #include "coins.h"
+#include "particles.h"
 #include "game_state.h"
 #include "sprites/sprites.h"
 #include "sprites/test_colors.h"
@@ -9,31 +10,182 @@
 #include <math.h>
 #include <string.h>
 #include "sd_sprites.h"
+#include "sprite_anim.h"
+#include "sdcard.h"
+#include "bg_stream.h"
+#include "dirty_rects.h"
+#include "snapshot.h"
+#include "profiler.h"
+#include "ui_widgets.h"
+#include "spi_bus.h"
 
-// Cached background tile from SD card
-static Sprite *bgTile = nullptr;
+// Enable sprite rendering (set to 0 to use old geometric shapes)
+// (Defined before gfxLoadAssets so the loader actually sees it)
+#define USE_SPRITES 1
+
+// Display color inversion - Try both true and false depending on your board
+#define DISPLAY_INVERT true
 
 // Cached Entity Sprites
-static Sprite *sprFish[FISH_SPECIES_COUNT];
+// Colour variants (Fish::tint), built at load; variant 0 draws the art as is
+struct GfxTintDef
+{
+    float r, g, b; // Channel gains
+    float lift;    // Toward white
+    bool swapRB;
+};
+
+static const GfxTintDef GFX_FISH_TINTS[FISH_TINTS] = {
+    {1.0f, 1.0f, 1.0f, 0.0f, false},   // Art colours
+    {1.25f, 1.0f, 0.7f, 0.0f, false},  // Warm
+    {0.7f, 1.0f, 1.3f, 0.0f, false},   // Cool
+    {1.0f, 1.0f, 1.0f, 0.0f, true},    // Exotic (red and blue swapped)
+    {1.3f, 1.15f, 0.4f, 0.0f, false},  // Golden
+    {1.0f, 1.0f, 1.0f, 0.35f, false},  // Pale
+};
+
+static SpriteTint fishTints[FISH_TINTS];
+
+// Fish art per species: [0] as loaded, then one resized copy per growth
+// stage (empty where it didn't fit the budget)
+static SpriteAnim animFish[FISH_SPECIES_COUNT][FISH_MAX_STAGES];
 static Sprite *sprFood = nullptr;
 static Sprite *sprCoin = nullptr;
+static Sprite *sprParticle[PARTICLE_KIND_COUNT];
+
+// Take the sprite from the pack if it has one, else load "<path>.i4"
+// (4bpp indexed) if the card has one, else "<path>.raw"
+static Sprite *gfxLoadSprite(const char *path, uint16_t width, uint16_t height)
+{
+    Sprite *packed = spritePackGet(spritePackFind(path));
+    if (packed)
+        return packed;
+
+    char file[64];
+    snprintf(file, sizeof(file), "%s.i4", path);
+    if (sdFileExists(file))
+        return spriteLoadIndexed(file);
+
+    snprintf(file, sizeof(file), "%s.raw", path);
+    return spriteLoad(file, width, height);
+}
+
+// Art a fish is drawn with: sized for its growth stage if that was built,
+// else full art size
+static const SpriteAnim &gfxFishAnim(FishSpecies species, uint8_t stage)
+{
+    const SpriteAnim &sized = animFish[species][stage];
+    return sized.frameCount ? sized : animFish[species][0];
+}
+
+// Is there a sprite at path (without extension) for gfxLoadSprite to load?
+static bool gfxHasSprite(const char *path)
+{
+    if (spritePackFind(path) != SPRITE_PACK_NONE)
+        return true;
+
+    char file[64];
+    snprintf(file, sizeof(file), "%s.i4", path);
+    if (sdFileExists(file))
+        return true;
+    snprintf(file, sizeof(file), "%s.raw", path);
+    return sdFileExists(file);
+}
+
+// Animation from "<path>_sheet" (frames of frameWidth side by side) if
+// there is one, else a single frame from path. Mirrored frames are
+// cached while the budget lasts.
+static void gfxLoadAnim(SpriteAnim &anim, const char *path, uint16_t frameWidth, uint16_t height,
+                        uint8_t frames)
+{
+    char sheet[48];
+    snprintf(sheet, sizeof(sheet), "%s_sheet", path);
+
+    bool loaded = frames > 1 && gfxHasSprite(sheet) &&
+                  animInit(anim, gfxLoadSprite(sheet, frameWidth * frames, height), frameWidth);
+    if (!loaded)
+        animInit(anim, gfxLoadSprite(path, frameWidth, height), frameWidth);
+    animCacheMirrors(anim);
+}
 
 void gfxLoadAssets()
 {
+    // Tank background art, decoded band by band while compositing
+    if (sdFileExists(TANK_BACKGROUND))
+        bgOpen(TANK_BACKGROUND);
+
 #if USE_SPRITES
+    // For .i4 sprites converted with --shared
+    if (sdFileExists("/sprites/palette.pal"))
+        spriteLoadSharedPalette("/sprites/palette.pal");
+
+    // Every sprite in one read (tools/pack_sprites.py); loose files below
+    // are only opened for sprites the pack doesn't have
+    if (sdFileExists("/assets/pack.bin"))
+        spritePackLoad("/assets/pack.bin");
+
     // Load Fish
-    sprFish[FISH_RAINBOW_TROUT] = spriteLoad("/sprites/fish/fish_r_trout.raw", 48, 20);
-    sprFish[FISH_BLUEGILL] = spriteLoad("/sprites/fish/fish_bluegill.raw", 48, 32);
-    sprFish[FISH_SMALLMOUTH_BASS] = spriteLoad("/sprites/fish/fish_smallmouth.raw", 48, 24);
-    sprFish[FISH_CHANNEL_CATFISH] = spriteLoad("/sprites/fish/fish_channel_cat.raw", 48, 18);
-    sprFish[FISH_LARGEMOUTH_BASS] = spriteLoad("/sprites/fish/fish_l_bass.raw", 48, 22);
+    gfxLoadAnim(animFish[FISH_RAINBOW_TROUT][0], "/sprites/fish/fish_r_trout", 48, 20,
+                FISH_DATA[FISH_RAINBOW_TROUT].animFrames);
+    gfxLoadAnim(animFish[FISH_BLUEGILL][0], "/sprites/fish/fish_bluegill", 48, 32,
+                FISH_DATA[FISH_BLUEGILL].animFrames);
+    gfxLoadAnim(animFish[FISH_SMALLMOUTH_BASS][0], "/sprites/fish/fish_smallmouth", 48, 24,
+                FISH_DATA[FISH_SMALLMOUTH_BASS].animFrames);
+    gfxLoadAnim(animFish[FISH_CHANNEL_CATFISH][0], "/sprites/fish/fish_channel_cat", 48, 18,
+                FISH_DATA[FISH_CHANNEL_CATFISH].animFrames);
+    gfxLoadAnim(animFish[FISH_LARGEMOUTH_BASS][0], "/sprites/fish/fish_l_bass", 48, 22,
+                FISH_DATA[FISH_LARGEMOUTH_BASS].animFrames);
+
+    for (uint8_t t = 1; t < FISH_TINTS; t++)
+    {
+        const GfxTintDef &def = GFX_FISH_TINTS[t];
+        spriteTintBuild(fishTints[t], def.r, def.g, def.b, def.lift, def.swapRB);
+    }
+
+    // Growth stages, smallest first so the budget goes to the common sizes
+    for (uint8_t stage = 1; stage < FISH_MAX_STAGES; stage++)
+    {
+        for (uint8_t s = 0; s < FISH_SPECIES_COUNT; s++)
+        {
+            const SpriteAnim &art = animFish[s][0];
+            if (!art.frameCount || stage >= FISH_DATA[s].growthStages)
+                continue;
+
+            float scale = fishStageScale(stage);
+            if (animScale(animFish[s][stage], art, (uint16_t)(art.frameWidth * scale + 0.5f),
+                          (uint16_t)(art.height * scale + 0.5f)))
+                animCacheMirrors(animFish[s][stage]);
+        }
+    }
+
+    // Taps hit what is on screen
+    for (uint8_t s = 0; s < FISH_SPECIES_COUNT; s++)
+    {
+        for (uint8_t stage = 0; stage < FISH_MAX_STAGES; stage++)
+        {
+            const SpriteAnim &anim = gfxFishAnim((FishSpecies)s, stage);
+            if (anim.frameCount)
+                fishSetDrawSize((FishSpecies)s, stage, anim.frameWidth, anim.height);
+        }
+    }
 
     // Load Items
-    sprFood = spriteLoad("/sprites/ui/ui_pellet.raw", 16, 16);
-    sprCoin = spriteLoad("/sprites/ui/ui_coin_gold.raw", 16, 16);
+    sprFood = gfxLoadSprite("/sprites/ui/ui_pellet", 16, 16);
+    sprCoin = gfxLoadSprite("/sprites/ui/ui_coin_gold", 16, 16);
+
+    // Load Effects
+    sprParticle[PARTICLE_BUBBLE_SM] = gfxLoadSprite("/sprites/effects/effect_bubble_sm", 16, 16);
+    sprParticle[PARTICLE_BUBBLE_MED] = gfxLoadSprite("/sprites/effects/effect_bubble_med", 16, 16);
+    sprParticle[PARTICLE_SPARKLE] = gfxLoadSprite("/sprites/effects/effect_sparkle", 16, 15);
+    sprParticle[PARTICLE_SPLASH] = gfxLoadSprite("/sprites/effects/effect_splash", 16, 14);
 
 #if DEBUG_SERIAL
     Serial.println("Assets loaded from SD Card");
+    Serial.print("Mirrored frames: ");
+    Serial.print(animMirrorBytes());
+    Serial.print(" bytes, growth stages: ");
+    Serial.print(animScaledBytes());
+    Serial.println(" bytes");
 #endif
 #endif
 }
@@ -60,20 +212,213 @@ void gfxLoadAssets()
 //
 // ============================================================================
 
-// Enable sprite rendering (set to 0 to use old geometric shapes)
-#define USE_SPRITES 1
+// TFT display instance
+TFT_eSPI tft = TFT_eSPI();
 
-// Enable background sprite (set to 0 to use gradient)
-#define USE_BACKGROUND_SPRITE 0 // DISABLED for testing core sprites
+// ============================================================================
+// STRIP COMPOSITING
+// ============================================================================
+//
+// The playing screen is built in horizontal strips (SCREEN_WIDTH x
+// GFX_STRIP_HEIGHT RGB565) in RAM: background, food, fish, coins,
+// particles, UI, in that order. Each finished strip is pushed to the panel
+// once, so overlapping entities never flicker and no pixel is sent twice a
+// frame.
+//
+// Only dirty regions are composited. Every frame each pool slot's bounds
+// (real sprite size) are compared with what it last drew; old and new boxes
+// of anything that moved or changed go to the dirty list (dirty_rects.cpp),
+// which merges them. Each merged rect is then composited and pushed strip
+// by strip, rect width x up to GFX_STRIP_HEIGHT rows at a time.
+//
+// While a rect is being composited, the gfxDraw* entity/UI functions draw
+// into the current strip; (stripX, stripY) is the screen position of its
+// top-left pixel and stripW x stripH the part of it that will be pushed.
+//
+// With DMA, two strip buffers ping-pong: the CPU composites strip N+1 while
+// strip N is still going out over SPI. Without DMA (or if the second buffer
+// doesn't fit) each strip is pushed blocking from a single buffer.
+//
+// ============================================================================
 
-// Display color inversion - Try both true and false depending on your board
-#define DISPLAY_INVERT true
+static TFT_eSprite stripBuf[2] = {TFT_eSprite(&tft), TFT_eSprite(&tft)};
+static TFT_eSprite *strip = &stripBuf[0];
+static int16_t stripX = 0;
+static int16_t stripY = 0;
+static int16_t stripW = 0;
+static int16_t stripH = 0;
+static int16_t stripMaxH = 0; // Rows allocated per strip buffer
+static bool stripDma = false;
+static uint32_t frameArea = 0; // Pixels composited by the last gfxDrawFrame
+
+// Does a screen rect overlap the current strip?
+static inline bool stripHit(const DirtyRect &r)
+{
+    return r.x < stripX + stripW && r.x + r.w > stripX &&
+           r.y < stripY + stripH && r.y + r.h > stripY;
+}
 
-// TFT display instance
-TFT_eSPI tft = TFT_eSPI();
+// Snapshot being composited (set for the duration of gfxDrawFrame). The
+// renderer only ever reads entities from here, never the live pools.
+static const GameSnapshot *view = nullptr;
+
+// What a pool slot last put on screen, so only changes get redrawn
+struct GfxDrawn
+{
+    DirtyRect rect;
+    uint16_t key; // Anything besides position that changes the pixels
+    bool shown;
+    bool seen; // Still live this frame (gfxTrackStore scratch)
+};
+
+static GfxDrawn fishDrawn[MAX_FISH];
+static GfxDrawn foodDrawn[MAX_FOOD];
+static GfxDrawn coinDrawn[MAX_COINS];
+static GfxDrawn particleDrawn[MAX_PARTICLES];
+
+// Profiler overlay: phase stats in the top-left corner of the tank
+#define PROF_OVERLAY_X 2
+#define PROF_OVERLAY_Y (TANK_TOP + 2)
+#define PROF_OVERLAY_W (23 * 6 + 4)
+#define PROF_OVERLAY_H ((PROF_PHASE_COUNT + 1) * 8 + 4)
+
+// FPS counter is composited into the top bar while playing (see gfxDrawFPS)
+static bool fpsShown = false;
+static uint16_t fpsValue = 0;
+
+// Top bar and footer widgets (ui_widgets.cpp), in paint order
+static UiId uiCoins = UI_NONE;
+static UiId uiFishLabel = UI_NONE;
+static UiId uiFishCount = UI_NONE;
+static UiId uiFps = UI_NONE;
+static UiId uiBuyButton = UI_NONE;
+
+#define BUY_BUTTON_W 100
+#define BUY_BUTTON_H 30
+
+static void gfxBuildUI()
+{
+    uiInit(&tft);
+
+    // Coins and fish count; the background equal to the color draws the
+    // text transparent over the bar
+    uiCoins = uiAddCounter(5, 10, 2, COLOR_COIN_GOLD, COLOR_COIN_GOLD, "$", "");
+    uiFishLabel = uiAddLabel(SCREEN_WIDTH - 35, 5, 1, COLOR_TEXT, COLOR_TEXT, "FISH");
+    uiFishCount = uiAddCounter(SCREEN_WIDTH - 30, 18, 2, COLOR_TEXT, COLOR_TEXT, "", "");
+    uiFps = uiAddCounter(SCREEN_WIDTH - 35, 2, 1, COLOR_UI_GREEN, COLOR_BLACK, "", "fps");
+    uiSetVisible(uiFps, false);
+
+    char buyText[UI_TEXT_MAX];
+    snprintf(buyText, sizeof(buyText), "BUY $%d", FISH_COST_BASIC);
+    uiBuyButton = uiAddButton((SCREEN_WIDTH - BUY_BUTTON_W) / 2, TANK_BOTTOM + 5,
+                              BUY_BUTTON_W, BUY_BUTTON_H, 2, COLOR_COIN_GOLD, buyText);
+}
+
+// ============================================================================
+// HARDWARE SCROLL
+// ============================================================================
+//
+// The ILI9341 can show its GRAM rotated through a scroll area (VSCRDEF
+// defines the area, VSCRSADD picks the GRAM line shown first). Moving the
+// start line one step slides the whole picture over without sending it
+// again; only the line that wraps around needs new pixels.
+//
+// The panel scrolls along its native rows, which in rotation 1 run along
+// screen x, so the area is the full 320 columns and the tank background
+// drifts sideways. The HUD bars and everything drawn over the water sit
+// in the same area, so each step repaints them where they slid from; the
+// background under them comes back shifted by bgDrift, which is where
+// the panel moved it.
+//
+// Screen x shows panel column (x + scrollX) % SCREEN_WIDTH. Strips and the
+// direct drawing helpers go through gfxPanelX, and the compositor splits a
+// dirty rect that crosses the panel's last column (the seam).
+//
+
+#ifndef ILI9341_VSCRDEF
+#define ILI9341_VSCRDEF 0x33
+#endif
+#ifndef ILI9341_VSCRSADD
+#define ILI9341_VSCRSADD 0x37
+#endif
+
+static int16_t scrollX = 0;  // Panel column shown at screen x = 0
+static uint16_t bgDrift = 0; // Background art columns drifted past
+
+// Panel column a screen column is written to
+static inline int16_t gfxPanelX(int16_t x)
+{
+    x += scrollX;
+    return x >= SCREEN_WIDTH ? x - SCREEN_WIDTH : x;
+}
+
+// Screen x of the panel's column 0 (SCREEN_WIDTH when not scrolled)
+static inline int16_t gfxScrollSeam()
+{
+    return SCREEN_WIDTH - scrollX;
+}
+
+static void gfxScrollSet(int16_t line)
+{
+    scrollX = line;
+    tft.writecommand(ILI9341_VSCRSADD);
+    tft.writedata(line >> 8);
+    tft.writedata(line & 0xFF);
+}
 
-// Sprite for double buffering (optional, uses more RAM)
-// static TFT_eSprite sprite = TFT_eSprite(&tft);
+#if GFX_HW_SCROLL
+static uint32_t scrollStepAt = 0; // millis() of the last step
+
+// One scroll area over all native rows, no fixed areas
+static void gfxScrollDefine()
+{
+    tft.writecommand(ILI9341_VSCRDEF);
+    tft.writedata(0); // TFA
+    tft.writedata(0);
+    tft.writedata(SCREEN_WIDTH >> 8); // VSA
+    tft.writedata(SCREEN_WIDTH & 0xFF);
+    tft.writedata(0); // BFA
+    tft.writedata(0);
+    gfxScrollSet(0);
+}
+
+// Repaint where a drawn entity was, and where the step slid it to
+static void gfxScrollDirty(const GfxDrawn *drawn, uint16_t capacity)
+{
+    for (uint16_t i = 0; i < capacity; i++)
+    {
+        if (drawn[i].shown)
+            dirtyAdd(drawn[i].rect.x - 1, drawn[i].rect.y, drawn[i].rect.w + 1, drawn[i].rect.h);
+    }
+}
+
+// Drift the background one column when a step is due. Runs before
+// tracking, so the drawn rects are still what the panel shows.
+static void gfxScrollStep()
+{
+    uint32_t now = millis();
+    if (!bgIsOpen() || now - scrollStepAt < GFX_SCROLL_STEP_MS)
+        return;
+    scrollStepAt = now;
+
+    bgDrift = (bgDrift + 1) % bgWidth();
+    gfxScrollSet(scrollX + 1 < SCREEN_WIDTH ? scrollX + 1 : 0);
+
+    // The old first column wrapped around to the right edge
+    dirtyAdd(SCREEN_WIDTH - 1, 0, 1, SCREEN_HEIGHT);
+
+    // Everything that doesn't drift with the water
+    dirtyAdd(0, 0, SCREEN_WIDTH, TANK_TOP);
+    dirtyAdd(0, TANK_BOTTOM, SCREEN_WIDTH, SCREEN_HEIGHT - TANK_BOTTOM);
+    gfxScrollDirty(fishDrawn, MAX_FISH);
+    gfxScrollDirty(foodDrawn, MAX_FOOD);
+    gfxScrollDirty(coinDrawn, MAX_COINS);
+    gfxScrollDirty(particleDrawn, MAX_PARTICLES);
+#if DEBUG_PROFILER_OVERLAY
+    dirtyAdd(PROF_OVERLAY_X - 1, PROF_OVERLAY_Y, PROF_OVERLAY_W + 1, PROF_OVERLAY_H);
+#endif
+}
+#endif
 
 void gfxInit()
 {
@@ -114,6 +459,29 @@ void gfxInit()
     // Set final rotation (Landscape 320x240 - Matches Verified CYD Tester)
     tft.setRotation(1);
 
+#if GFX_HW_SCROLL
+    gfxScrollDefine();
+#endif
+
+    // Strip buffers for compositing - halve the height until one fits.
+    // DMA can't read PSRAM, so keep them in internal RAM.
+    for (int i = 0; i < 2; i++)
+    {
+        stripBuf[i].setColorDepth(16);
+        stripBuf[i].setAttribute(PSRAM_ENABLE, false);
+    }
+    for (int16_t h = GFX_STRIP_HEIGHT; h > 0 && !stripBuf[0].created(); h /= 2)
+        stripBuf[0].createSprite(SCREEN_WIDTH, h);
+    stripMaxH = stripBuf[0].created() ? stripBuf[0].height() : 0;
+
+    // Second buffer + DMA for the ping-pong pipeline
+    if (stripMaxH > 0 && stripBuf[1].createSprite(SCREEN_WIDTH, stripMaxH))
+        stripDma = tft.initDMA();
+    if (!stripDma)
+        stripBuf[1].deleteSprite();
+
+    gfxBuildUI();
+
 #if DEBUG_SERIAL
     Serial.println("=== DISPLAY INIT v2025.01.13.A ==="); // Unique identifier for THIS version
     Serial.println("Display initialized");
@@ -130,103 +498,438 @@ void gfxInit()
     Serial.print("Screen ends at Y: ");
     Serial.println(SCREEN_HEIGHT);
     Serial.println("Ghost clear: 4 rotations");
+    Serial.print("Strip buffer: ");
+    Serial.print(SCREEN_WIDTH);
+    Serial.print("x");
+    Serial.print(stripMaxH);
+    Serial.println(stripDma ? " x2 (DMA)" : " (blocking)");
 #endif
 }
 
+uint32_t gfxFrameArea()
+{
+    return frameArea;
+}
+
 void gfxClear(uint16_t color)
 {
+    // Screens drawn straight to the panel expect it unscrolled
+    if (scrollX != 0)
+        gfxScrollSet(0);
     tft.fillScreen(color);
+    dirtyAddAll();
+}
+
+void gfxInvalidate()
+{
+    dirtyAddAll();
+}
+
+void gfxInvalidateRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    dirtyAdd(x, y, w, h);
 }
 
 void gfxBeginFrame()
 {
-    // If using sprite buffering, would create sprite here
+    // DMA transfers need the bus (and CS) held for the whole frame
+    if (stripDma)
+        tft.startWrite();
 }
 
 void gfxEndFrame()
 {
-    // If using sprite buffering, would push sprite to display here
+    // Let the last strip finish before touch gets the bus
+    if (stripDma)
+    {
+        tft.dmaWait();
+        tft.endWrite();
+    }
 }
 
-// ============================================================================
-// GAME RENDERING
-// ============================================================================
+// Between strips: a touch read that is waiting for the bus gets it now.
+// The strip in flight lands first, and the next one waits until touch is
+// done, so the two never share the bus.
+static void gfxBusSlot()
+{
+    if (!busTouchDue())
+        return;
 
-void gfxDrawTank()
+    if (stripDma)
+    {
+        tft.dmaWait();
+        tft.endWrite();
+    }
+    busTouchSlot();
+    if (stripDma)
+        tft.startWrite();
+}
+
+// Send the current strip to its place on screen
+static void gfxPushStrip()
 {
-#if USE_BACKGROUND_SPRITE
-    // Ensure background tile is loaded
-    if (!bgTile)
+    uint16_t *pixels = (uint16_t *)strip->getPointer();
+
+    // Narrow rect: pack its rows together so they go out as one block
+    if (stripW < SCREEN_WIDTH)
     {
-        bgTile = spriteLoad("/backgrounds/water.raw", 32, 32);
+        for (int16_t row = 1; row < stripH; row++)
+            memmove(pixels + row * stripW, pixels + row * SCREEN_WIDTH, stripW * sizeof(uint16_t));
     }
 
-    if (bgTile)
+    // The strip is already in wire byte order
+    bool oldSwap = tft.getSwapBytes();
+    tft.setSwapBytes(false);
+    if (stripDma)
     {
-        // Tiled background rendering (Option A)
-        for (int16_t y = TANK_TOP; y < TANK_BOTTOM; y += 32)
-        {
-            for (int16_t x = TANK_LEFT; x < TANK_RIGHT; x += 32)
-            {
-                // Calculate size to draw (clipping at edges)
-                int16_t drawW = (x + 32 > TANK_RIGHT) ? (TANK_RIGHT - x) : 32;
-                int16_t drawH = (y + 32 > TANK_BOTTOM) ? (TANK_BOTTOM - y) : 32;
-
-                if (drawW == 32 && drawH == 32)
-                {
-                    spriteDraw(bgTile, x, y);
-                }
-                else
-                {
-                    // Manual clip for edges (though pushImage handles it, let's be clean)
-                    tft.setSwapBytes(true);
-                    tft.pushImage(x, y, drawW, drawH, bgTile->data);
-                }
-            }
-        }
+        // Waits for the previous strip, queues this one and returns
+        tft.pushImageDMA(gfxPanelX(stripX), stripY, stripW, stripH, pixels);
     }
     else
     {
-        // Fallback to solid color if SD load fails
-        tft.fillRect(TANK_LEFT, TANK_TOP, TANK_WIDTH, TANK_HEIGHT, COLOR_WATER_MID);
+        tft.pushImage(gfxPanelX(stripX), stripY, stripW, stripH, pixels);
     }
-#else
-    // Draw water gradient (simplified - just solid colors for Phase 1)
-    // Top of tank - lighter blue
-    tft.fillRect(TANK_LEFT, TANK_TOP, TANK_WIDTH, TANK_HEIGHT / 3, COLOR_WATER_LIGHT);
-    // Middle - medium blue
-    tft.fillRect(TANK_LEFT, TANK_TOP + TANK_HEIGHT / 3, TANK_WIDTH, TANK_HEIGHT / 3, COLOR_WATER_MID);
-    // Bottom - darker blue
-    tft.fillRect(TANK_LEFT, TANK_TOP + 2 * TANK_HEIGHT / 3, TANK_WIDTH, TANK_HEIGHT / 3, COLOR_WATER_DEEP);
+    tft.setSwapBytes(oldSwap);
+}
+
+// Hunger, facing, the animation frame and the colour variant change a
+// fish's pixels without moving it (the frame as drawn, so one-frame art
+// never redraws for it)
+static uint16_t gfxFishKey(uint16_t row)
+{
+    const Fish *fish = &view->fish.data[row];
+    uint8_t frame = animFrameIndex(gfxFishAnim(fish->species, fish->growthStage), fish->frame);
+    return (fish->facingRight ? 0x01 : 0) | (fishIsHungry(fish) ? 0x02 : 0) |
+           (fish->species << 2) | (fish->growthStage << 5) | (frame << 7) | (fish->tint << 10);
+}
 
-    // Sand at very bottom
-    tft.fillRect(TANK_LEFT, TANK_BOTTOM - 10, TANK_WIDTH, 10, COLOR_SAND);
+static uint16_t gfxFoodKey(uint16_t)
+{
+    return 0;
+}
+
+// Bigger coins draw bigger
+static uint16_t gfxCoinKey(uint16_t row)
+{
+    return view->coins.data[row].value;
+}
+
+static uint16_t gfxParticleKey(uint16_t row)
+{
+    return view->particles.data[row].kind;
+}
+
+// Screen area the fish in a row of the view covers (sprite + hunger outline)
+static DirtyRect gfxFishBounds(uint16_t row)
+{
+    const Fish *fish = &view->fish.data[row];
+    int16_t fx = (int16_t)view->fish.x[row];
+    int16_t fy = (int16_t)view->fish.y[row];
+
+#if USE_SPRITES
+    const SpriteAnim &anim = gfxFishAnim(fish->species, fish->growthStage);
+    if (anim.frameCount)
+    {
+        return {(int16_t)(fx - anim.frameWidth / 2 - 1), (int16_t)(fy - anim.height / 2 - 1),
+                (int16_t)(anim.frameWidth + 2), (int16_t)(anim.height + 2)};
+    }
 #endif
+
+    // Geometric fallback: body ellipse + outline, tail on either side
+    float scale = fishStageScale(fish->growthStage);
+    int16_t w = (int16_t)(FISH_WIDTH * scale);
+    int16_t h = (int16_t)(FISH_HEIGHT * scale);
+    int16_t rx = w / 2 + w / 3 + 1;
+    int16_t ry = h / 2 + 1;
+    return {(int16_t)(fx - rx), (int16_t)(fy - ry), (int16_t)(rx * 2 + 1), (int16_t)(ry * 2 + 1)};
 }
 
-void gfxDrawFish(Fish *fish)
+static DirtyRect gfxFoodBounds(uint16_t row)
 {
-    if (!fish || !fish->active)
-        return;
+    int16_t fx = (int16_t)view->food.x[row];
+    int16_t fy = (int16_t)view->food.y[row];
 
 #if USE_SPRITES
-    // Sprite-based rendering
-    Sprite *sprite = sprFish[fish->species];
+    if (sprFood)
+    {
+        return {(int16_t)(fx - sprFood->width / 2), (int16_t)(fy - sprFood->height / 2),
+                (int16_t)sprFood->width, (int16_t)sprFood->height};
+    }
+#endif
+
+    return {(int16_t)(fx - FOOD_SIZE), (int16_t)(fy - FOOD_SIZE), FOOD_SIZE * 2 + 1, FOOD_SIZE * 2 + 1};
+}
+
+// Coins bob sideways, so their bounds move every frame
+static DirtyRect gfxCoinBounds(uint16_t row)
+{
+    const Coin *coin = &view->coins.data[row];
+    int16_t cx = (int16_t)(view->coins.x[row] + sinf(coin->floatOffset) * 3);
+    int16_t cy = (int16_t)view->coins.y[row];
+
+#if USE_SPRITES
+    if (sprCoin)
+    {
+        return {(int16_t)(cx - sprCoin->width / 2), (int16_t)(cy - sprCoin->height / 2),
+                (int16_t)sprCoin->width, (int16_t)sprCoin->height};
+    }
+#endif
+
+    int16_t size = COIN_SIZE + (coin->value > 3 ? 2 : 0);
+    return {(int16_t)(cx - size), (int16_t)(cy - size), (int16_t)(size * 2 + 1), (int16_t)(size * 2 + 1)};
+}
+
+// Geometric fallback particles fit in a 9x9 box
+#define GFX_PARTICLE_RADIUS 4
+
+static DirtyRect gfxParticleBounds(uint16_t row)
+{
+    int16_t px = (int16_t)view->particles.x[row];
+    int16_t py = (int16_t)view->particles.y[row];
+
+#if USE_SPRITES
+    Sprite *sprite = sprParticle[view->particles.data[row].kind];
     if (sprite)
     {
-        // Calculate position (center sprite on fish position)
-        int16_t x = (int16_t)fish->x - sprite->width / 2;
-        int16_t y = (int16_t)fish->y - sprite->height / 2;
+        return {(int16_t)(px - sprite->width / 2), (int16_t)(py - sprite->height / 2),
+                (int16_t)sprite->width, (int16_t)sprite->height};
+    }
+#endif
+
+    return {(int16_t)(px - GFX_PARTICLE_RADIUS), (int16_t)(py - GFX_PARTICLE_RADIUS),
+            GFX_PARTICLE_RADIUS * 2 + 1, GFX_PARTICLE_RADIUS * 2 + 1};
+}
+
+// Dirty the old and new boxes of a slot whose pixels changed
+static void gfxTrack(GfxDrawn &drawn, const DirtyRect &rect, uint16_t key)
+{
+    if (drawn.shown && drawn.key == key && drawn.rect.x == rect.x && drawn.rect.y == rect.y &&
+        drawn.rect.w == rect.w && drawn.rect.h == rect.h)
+        return;
+
+    if (drawn.shown)
+        dirtyAdd(drawn.rect);
+    dirtyAdd(rect);
+
+    drawn.rect = rect;
+    drawn.key = key;
+    drawn.shown = true;
+}
+
+// Entity went away: dirty where it was
+static void gfxUntrack(GfxDrawn &drawn)
+{
+    if (!drawn.shown)
+        return;
+
+    dirtyAdd(drawn.rect);
+    drawn.shown = false;
+}
+
+// Track every live row of a view store by id, then untrack the ids that
+// were shown last frame but have no row now
+template <typename Store>
+static void gfxTrackStore(const Store &store, GfxDrawn *drawn, uint16_t capacity,
+                          DirtyRect (*bounds)(uint16_t), uint16_t (*key)(uint16_t))
+{
+    for (uint16_t r = 0; r < store.count; r++)
+    {
+        GfxDrawn &d = drawn[store.id[r]];
+        gfxTrack(d, bounds(r), key(r));
+        d.seen = true;
+    }
+
+    for (uint16_t i = 0; i < capacity; i++)
+    {
+        if (!drawn[i].seen)
+            gfxUntrack(drawn[i]);
+        drawn[i].seen = false;
+    }
+}
+
+// Particles are tracked like the other pools, but only until their boxes
+// add up to PARTICLE_PIXEL_BUDGET. Rows past that are untracked and skipped
+// when drawing (older particles come first, so a new burst is what gets
+// cut), which bounds what effects cost to composite however many are live.
+static void gfxTrackParticles()
+{
+    const ParticleStore &store = view->particles;
+    int32_t budget = PARTICLE_PIXEL_BUDGET;
+
+    for (uint16_t r = 0; r < store.count; r++)
+    {
+        DirtyRect rect = gfxParticleBounds(r);
+        int32_t pixels = (int32_t)rect.w * rect.h;
+        if (pixels > budget)
+            continue;
+
+        budget -= pixels;
+        GfxDrawn &d = particleDrawn[store.id[r]];
+        gfxTrack(d, rect, gfxParticleKey(r));
+        d.seen = true;
+    }
+
+    for (uint16_t i = 0; i < MAX_PARTICLES; i++)
+    {
+        if (!particleDrawn[i].seen)
+            gfxUntrack(particleDrawn[i]);
+        particleDrawn[i].seen = false;
+    }
+}
+
+static void gfxTrackEntities()
+{
+    gfxTrackStore(view->fish, fishDrawn, MAX_FISH, gfxFishBounds, gfxFishKey);
+    gfxTrackStore(view->food, foodDrawn, MAX_FOOD, gfxFoodBounds, gfxFoodKey);
+    gfxTrackStore(view->coins, coinDrawn, MAX_COINS, gfxCoinBounds, gfxCoinKey);
+    gfxTrackParticles();
+}
+
+// Hand the current values to the HUD widgets; each dirties only what it
+// shows differently
+static void gfxTrackUI()
+{
+    uiSetValue(uiCoins, view->game.coins);
+    uiSetValue(uiFishCount, view->fish.count);
+    uiSetValue(uiFps, fpsValue);
+    uiSetVisible(uiFps, fpsShown);
+
+    if (view->game.coins >= FISH_COST_BASIC)
+        uiSetColors(uiBuyButton, COLOR_UI_GREEN, COLOR_BLACK);
+    else
+        uiSetColors(uiBuyButton, tft.color565(80, 80, 80), COLOR_WHITE);
+
+#if DEBUG_PROFILER_OVERLAY
+    static uint32_t shownReport = UINT32_MAX;
+    if (profReportCount() != shownReport)
+        dirtyAdd(PROF_OVERLAY_X, PROF_OVERLAY_Y, PROF_OVERLAY_W, PROF_OVERLAY_H);
+    shownReport = profReportCount();
+#endif
+}
+
+// Composite a screen rect strip by strip and push each strip
+static void gfxCompositeRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t &buf)
+{
+    stripX = x;
+    stripW = w;
+
+    for (stripY = y; stripY < y + h; stripY += stripH)
+    {
+        stripH = min((int16_t)(y + h - stripY), stripMaxH);
+
+        // Composite into the buffer that is not in flight
+        strip = &stripBuf[buf];
+
+        // Layers back to front
+        {
+            PROF_SCOPE(PROF_CLEAR);
+            gfxDrawTank();
+        }
+        {
+            PROF_SCOPE(PROF_DRAW);
+            gfxDrawAllFood();
+            gfxDrawAllFish();
+            gfxDrawAllCoins();
+            gfxDrawAllParticles();
+        }
+        {
+            PROF_SCOPE(PROF_UI);
+            gfxDrawUI();
+#if DEBUG_PROFILER_OVERLAY
+            gfxDrawProfiler();
+#endif
+        }
 
-        // Draw with transparency
-        if (fish->facingRight)
-            spriteDrawTransparentFlip(sprite, x, y);
+        PROF_SCOPE(PROF_PUSH);
+        gfxPushStrip();
+        if (stripDma)
+            buf ^= 1;
+        gfxBusSlot();
+    }
+}
+
+void gfxDrawFrame(const GameSnapshot &snap)
+{
+    if (!stripBuf[0].created())
+        return;
+
+    view = &snap;
+
+    {
+        PROF_SCOPE(PROF_DRAW);
+#if GFX_HW_SCROLL
+        gfxScrollStep();
+#endif
+        gfxTrackEntities();
+        gfxTrackUI();
+    }
+
+    gfxBeginFrame();
+
+    frameArea = dirtyArea();
+    uint8_t buf = 0;
+    int16_t seam = gfxScrollSeam();
+    for (uint8_t r = 0; r < dirtyCount(); r++)
+    {
+        const DirtyRect &rect = dirtyGet(r);
+
+        // A rect across the seam is two windows on the panel
+        if (rect.x < seam && rect.x + rect.w > seam)
+        {
+            gfxCompositeRect(rect.x, rect.y, seam - rect.x, rect.h, buf);
+            gfxCompositeRect(seam, rect.y, rect.x + rect.w - seam, rect.h, buf);
+        }
         else
-            spriteDrawTransparent(sprite, x, y);
+        {
+            gfxCompositeRect(rect.x, rect.y, rect.w, rect.h, buf);
+        }
+    }
+
+    {
+        PROF_SCOPE(PROF_PUSH);
+        gfxEndFrame();
+    }
+
+    dirtyReset();
+    view = nullptr;
+}
+
+// ============================================================================
+// GAME RENDERING
+// ============================================================================
+
+void gfxDrawTank()
+{
+    // Tank rows of the current strip (top bar and footer belong to the UI)
+    gfxRestoreBackground(TANK_LEFT, TANK_TOP, TANK_WIDTH, TANK_HEIGHT);
+}
+
+void gfxDrawFish(uint16_t row)
+{
+    if (row >= view->fish.count)
+        return;
+    const Fish *fish = &view->fish.data[row];
+
+#if USE_SPRITES
+    // Sprite-based rendering
+    const SpriteAnim &anim = gfxFishAnim(fish->species, fish->growthStage);
+    if (anim.frameCount)
+    {
+        // Skip fish outside this strip
+        if (!stripHit(gfxFishBounds(row)))
+            return;
+
+        // Calculate position (center sprite on fish position, strip space)
+        int16_t x = (int16_t)view->fish.x[row] - anim.frameWidth / 2 - stripX;
+        int16_t y = (int16_t)view->fish.y[row] - anim.height / 2 - stripY;
+
+        // Draw with transparency (the art faces left)
+        const SpriteTint *tint = fish->tint ? &fishTints[fish->tint % FISH_TINTS] : nullptr;
+        animDrawTo(*strip, anim, fish->frame, x, y, fish->facingRight, tint);
 
         // Hunger indicator (red outline when hungry)
         if (fishIsHungry(fish))
-            tft.drawRect(x - 1, y - 1, sprite->width + 2, sprite->height + 2, COLOR_UI_RED);
+            strip->drawRect(x - 1, y - 1, anim.frameWidth + 2, anim.height + 2, COLOR_UI_RED);
 
         return; // Successfully drew sprite
     }
@@ -235,12 +938,15 @@ void gfxDrawFish(Fish *fish)
     // Fallback: Geometric Rendering (Always compiled, reachable if USE_SPRITES=0 or sprite is null)
     {
         // Legacy geometric rendering (fallback)
-        float scale = 1.0f + fish->growthStage * 0.3f;
+        float scale = fishStageScale(fish->growthStage);
         int16_t w = (int16_t)(FISH_WIDTH * scale);
         int16_t h = (int16_t)(FISH_HEIGHT * scale);
 
-        int16_t x = (int16_t)fish->x - w / 2;
-        int16_t y = (int16_t)fish->y - h / 2;
+        if (!stripHit(gfxFishBounds(row)))
+            return;
+
+        int16_t fx = (int16_t)view->fish.x[row] - stripX;
+        int16_t fy = (int16_t)view->fish.y[row] - stripY;
 
         // Fish body color based on species
         uint16_t bodyColor;
@@ -266,93 +972,44 @@ void gfxDrawFish(Fish *fish)
         }
 
         // Simple fish shape (ellipse body + triangle tail)
-        tft.fillEllipse(fish->x, fish->y, w / 2, h / 2, bodyColor);
+        strip->fillEllipse(fx, fy, w / 2, h / 2, bodyColor);
 
         // Tail (triangle)
         int16_t tailDir = fish->facingRight ? -1 : 1;
-        int16_t tailX = fish->x + tailDir * (w / 2);
-        tft.fillTriangle(
-            tailX, fish->y,
-            tailX + tailDir * (w / 3), fish->y - h / 3,
-            tailX + tailDir * (w / 3), fish->y + h / 3,
+        int16_t tailX = fx + tailDir * (w / 2);
+        strip->fillTriangle(
+            tailX, fy,
+            tailX + tailDir * (w / 3), fy - h / 3,
+            tailX + tailDir * (w / 3), fy + h / 3,
             bodyColor);
 
         // Eye
-        int16_t eyeX = fish->x + (fish->facingRight ? w / 4 : -w / 4);
-        tft.fillCircle(eyeX, fish->y - h / 6, 2, COLOR_BLACK);
+        int16_t eyeX = fx + (fish->facingRight ? w / 4 : -w / 4);
+        strip->fillCircle(eyeX, fy - h / 6, 2, COLOR_BLACK);
 
         // Hunger indicator (red tint when hungry)
         if (fishIsHungry(fish))
         {
-            tft.drawEllipse(fish->x, fish->y, w / 2 + 1, h / 2 + 1, COLOR_UI_RED);
+            strip->drawEllipse(fx, fy, w / 2 + 1, h / 2 + 1, COLOR_UI_RED);
         }
     }
 }
 
 void gfxDrawAllFish()
 {
-    for (int i = 0; i < MAX_FISH; i++)
+    for (uint16_t r = 0; r < view->fish.count; r++)
     {
-        gfxDrawFish(&fishPool[i]);
+        gfxDrawFish(r);
     }
 }
 
-// Restore background at specific area (dirty rect)
-void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h)
+// Water gradient (3 zones + sand) for a screen rect already clipped to the
+// current strip
+static void gfxFillWater(int16_t x, int16_t y, int16_t w, int16_t h)
 {
-#if USE_BACKGROUND_SPRITE
-    if (!bgTile)
-        return;
-
-    // Clip to tank area
-    if (x < TANK_LEFT)
-    {
-        w -= (TANK_LEFT - x);
-        x = TANK_LEFT;
-    }
-    if (y < TANK_TOP)
-    {
-        h -= (TANK_TOP - y);
-        y = TANK_TOP;
-    }
-    if (x + w > TANK_RIGHT)
-        w = TANK_RIGHT - x;
-    if (y + h > TANK_BOTTOM)
-        h = TANK_BOTTOM - y;
-
     if (w <= 0 || h <= 0)
         return;
 
-    // Tiled restoration
-    tft.setSwapBytes(true);
-    for (int16_t py = 0; py < h; py++)
-    {
-        int16_t screenY = y + py;
-        int16_t tileY = (screenY - TANK_TOP) % 32;
-        if (tileY < 0)
-            tileY += 32;
-
-        int16_t currentX = x;
-        int16_t remainingW = w;
-
-        while (remainingW > 0)
-        {
-            int16_t tileX = (currentX - TANK_LEFT) % 32;
-            if (tileX < 0)
-                tileX += 32;
-
-            int16_t segmentW = 32 - tileX;
-            if (segmentW > remainingW)
-                segmentW = remainingW;
-
-            tft.pushImage(currentX, screenY, segmentW, 1, &bgTile->data[tileY * 32 + tileX]);
-
-            currentX += segmentW;
-            remainingW -= segmentW;
-        }
-    }
-#else
-    // Fallback: fill rect with gradient zones to match gfxDrawTank (3 zones + sand)
     // Zones match gfxDrawTank exactly:
     // 1. Light: 0 to H/3
     // 2. Mid:   H/3 to 2H/3
@@ -366,7 +1023,7 @@ void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h)
     if (y < midY)
     {
         int16_t h_light = (int16_t)min((long)(midY - y), (long)h);
-        tft.fillRect(x, y, w, h_light, COLOR_WATER_LIGHT);
+        strip->fillRect(x - stripX, y - stripY, w, h_light, COLOR_WATER_LIGHT);
     }
 
     // 2. Mid Water (Middle)
@@ -375,7 +1032,7 @@ void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h)
         int16_t y_start = max(y, midY);
         int16_t y_end = min((int16_t)(y + h), deepY);
         if (y_end > y_start)
-            tft.fillRect(x, y_start, w, y_end - y_start, COLOR_WATER_MID);
+            strip->fillRect(x - stripX, y_start - stripY, w, y_end - y_start, COLOR_WATER_MID);
     }
 
     // 3. Deep Water (Bottom)
@@ -384,7 +1041,7 @@ void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h)
         int16_t y_start = max(y, deepY);
         int16_t y_end = min((int16_t)(y + h), sandY);
         if (y_end > y_start)
-            tft.fillRect(x, y_start, w, y_end - y_start, COLOR_WATER_DEEP);
+            strip->fillRect(x - stripX, y_start - stripY, w, y_end - y_start, COLOR_WATER_DEEP);
     }
 
     // 4. Sand (Bottom)
@@ -393,112 +1050,126 @@ void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h)
         int16_t y_start = max(y, sandY);
         int16_t h_sand = (y + h) - y_start;
         if (h_sand > 0)
-            tft.fillRect(x, y_start, w, h_sand, COLOR_SAND);
+            strip->fillRect(x - stripX, y_start - stripY, w, h_sand, COLOR_SAND);
     }
-#endif
 }
 
-// Clear a fish by redrawing the background behind it
-void gfxClearFish(Fish *fish)
+// One row of background art into the current strip from screen column x,
+// starting bgDrift columns into the image and wrapping at its right edge
+static void gfxPushBgRow(const uint16_t *row, int16_t x, int16_t y, int16_t w)
 {
-    if (!fish || !fish->active)
-        return;
-
-    int16_t spriteW, spriteH;
-
-#if USE_SPRITES
-    spriteW = SPRITE_FISH_R_TROUT_WIDTH;
-    spriteH = SPRITE_FISH_R_TROUT_HEIGHT;
-#else
-    float scale = 1.0f + fish->growthStage * 0.3f;
-    spriteW = (int16_t)(FISH_WIDTH * scale);
-    spriteH = (int16_t)(FISH_HEIGHT * scale);
-#endif
-
-    // Calculate position (top-left)
-    int16_t x = (int16_t)fish->x - spriteW / 2;
-    int16_t y = (int16_t)fish->y - spriteH / 2;
-
-    // Add padding to ensure full clear (rounding errors etc)
-    gfxRestoreBackground(x - 2, y - 2, spriteW + 4, spriteH + 4);
-}
-
-void gfxClearAllFish()
-{
-    for (int i = 0; i < MAX_FISH; i++)
+    int16_t src = (x - TANK_LEFT + bgDrift) % bgWidth();
+    while (w > 0)
     {
-        gfxClearFish(&fishPool[i]);
+        int16_t run = min(w, (int16_t)(bgWidth() - src));
+        strip->pushImage(x - stripX, y - stripY, run, 1, row + src);
+        x += run;
+        w -= run;
+        src = 0;
     }
 }
 
-void gfxDrawFood(Food *food)
+// Paint the tank background for a screen rect into the current strip
+void gfxRestoreBackground(int16_t x, int16_t y, int16_t w, int16_t h)
 {
-    if (!food || !food->active)
+    // Only the part inside the current strip
+    if (x < stripX)
+    {
+        w -= (stripX - x);
+        x = stripX;
+    }
+    if (y < stripY)
+    {
+        h -= (stripY - y);
+        y = stripY;
+    }
+    if (x + w > stripX + stripW)
+        w = stripX + stripW - x;
+    if (y + h > stripY + stripH)
+        h = stripY + stripH - y;
+    if (w <= 0 || h <= 0)
         return;
 
-#if USE_SPRITES
-    if (sprFood)
+    // Streamed art from the tank's top-left corner; anything it doesn't
+    // cover keeps the gradient. Drifting art wraps around, so it covers
+    // the whole width.
+    int16_t artW = bgDrift ? TANK_WIDTH : bgWidth();
+    int16_t left = max(x, (int16_t)TANK_LEFT);
+    int16_t top = max(y, (int16_t)TANK_TOP);
+    int16_t right = min((int16_t)(x + w), (int16_t)(TANK_LEFT + artW));
+    int16_t bottom = min((int16_t)(y + h), (int16_t)(TANK_TOP + bgHeight()));
+    if (!bgIsOpen() || right <= left || bottom <= top)
     {
-        int16_t x = (int16_t)food->x - sprFood->width / 2;
-        int16_t y = (int16_t)food->y - sprFood->height / 2;
-        spriteDrawTransparent(sprFood, x, y);
+        gfxFillWater(x, y, w, h);
+        return;
     }
-    else
+
+    strip->setSwapBytes(true);
+    for (int16_t sy = top; sy < bottom; sy++)
     {
-        // Fallback
-        tft.fillCircle((int16_t)food->x, (int16_t)food->y, FOOD_SIZE, COLOR_FOOD_BROWN);
+        const uint16_t *row = bgRow(sy - TANK_TOP);
+        if (row)
+            gfxPushBgRow(row, left, sy, right - left);
+        else
+            gfxFillWater(left, sy, right - left, 1);
     }
-#else
-    // Simple brown circle for food pellet
-    tft.fillCircle((int16_t)food->x, (int16_t)food->y, FOOD_SIZE, COLOR_FOOD_BROWN);
-#endif
+
+    gfxFillWater(x, y, w, top - y);
+    gfxFillWater(x, bottom, w, y + h - bottom);
+    gfxFillWater(x, top, left - x, bottom - top);
+    gfxFillWater(right, top, x + w - right, bottom - top);
 }
 
-void gfxClearFood(Food *food)
+void gfxDrawFood(uint16_t row)
 {
-    if (!food || !food->active)
+    if (row >= view->food.count)
         return;
 
-    // Clear rect around circle
-    int16_t r = FOOD_SIZE + 2; // Padding
+    if (!stripHit(gfxFoodBounds(row)))
+        return;
+
+    int16_t fx = (int16_t)view->food.x[row];
+    int16_t fy = (int16_t)view->food.y[row];
+
 #if USE_SPRITES
     if (sprFood)
-        r = sprFood->width / 2 + 2;
+    {
+        int16_t x = fx - sprFood->width / 2 - stripX;
+        int16_t y = fy - sprFood->height / 2 - stripY;
+        spriteDrawTransparentTo(*strip, sprFood, x, y);
+        return;
+    }
 #endif
-    gfxRestoreBackground((int16_t)food->x - r, (int16_t)food->y - r, r * 2, r * 2);
+
+    // Simple brown circle for food pellet
+    strip->fillCircle(fx - stripX, fy - stripY, FOOD_SIZE, COLOR_FOOD_BROWN);
 }
 
 void gfxDrawAllFood()
 {
-    for (int i = 0; i < MAX_FOOD; i++)
+    for (uint16_t r = 0; r < view->food.count; r++)
     {
-        gfxDrawFood(&foodPool[i]);
+        gfxDrawFood(r);
     }
 }
 
-void gfxClearAllFood()
+void gfxDrawCoin(uint16_t row)
 {
-    for (int i = 0; i < MAX_FOOD; i++)
-    {
-        gfxClearFood(&foodPool[i]);
-    }
-}
+    if (row >= view->coins.count)
+        return;
+    const Coin *coin = &view->coins.data[row];
 
-void gfxDrawCoin(Coin *coin)
-{
-    if (!coin || !coin->active)
+    if (!stripHit(gfxCoinBounds(row)))
         return;
 
-    // Bob animation
-    float displayX = coin->x + sinf(coin->floatOffset) * 3;
+    // Bob animation (strip space)
+    int16_t cx = (int16_t)(view->coins.x[row] + sinf(coin->floatOffset) * 3) - stripX;
+    int16_t cy = (int16_t)view->coins.y[row] - stripY;
 
 #if USE_SPRITES
     if (sprCoin)
     {
-        // Determine offset for bobbing
-        int16_t x = (int16_t)displayX - sprCoin->width / 2;
-        int16_t y = (int16_t)coin->y - sprCoin->height / 2;
-        spriteDrawTransparent(sprCoin, x, y);
+        spriteDrawTransparentTo(*strip, sprCoin, cx - sprCoin->width / 2, cy - sprCoin->height / 2);
         return;
     }
     // Fallthrough to legacy
@@ -508,104 +1179,140 @@ void gfxDrawCoin(Coin *coin)
     int16_t size = COIN_SIZE + (coin->value > 3 ? 2 : 0);
 
     // Gold circle with darker outline
-    tft.fillCircle((int16_t)displayX, (int16_t)coin->y, size, COLOR_COIN_GOLD);
-    tft.drawCircle((int16_t)displayX, (int16_t)coin->y, size, tft.color565(180, 130, 0));
+    strip->fillCircle(cx, cy, size, COLOR_COIN_GOLD);
+    strip->drawCircle(cx, cy, size, tft.color565(180, 130, 0));
 
     // $ symbol for larger coins
     if (coin->value > 2)
     {
-        tft.setTextColor(tft.color565(180, 130, 0));
-        tft.setTextSize(1);
-        tft.setCursor((int16_t)displayX - 2, (int16_t)coin->y - 3);
-        tft.print("$");
+        strip->setTextColor(tft.color565(180, 130, 0));
+        strip->setTextSize(1);
+        strip->setCursor(cx - 2, cy - 3);
+        strip->print("$");
     }
 }
 
 void gfxDrawAllCoins()
 {
-    for (int i = 0; i < MAX_COINS; i++)
+    for (uint16_t r = 0; r < view->coins.count; r++)
     {
-        gfxDrawCoin(&coinPool[i]);
+        gfxDrawCoin(r);
     }
 }
 
-void gfxClearCoin(Coin *coin)
+void gfxDrawParticle(uint16_t row)
 {
-    if (!coin || !coin->active)
+    if (row >= view->particles.count)
+        return;
+
+    // Over the pixel budget this frame
+    if (!particleDrawn[view->particles.id[row]].shown)
+        return;
+
+    if (!stripHit(gfxParticleBounds(row)))
         return;
 
-    // Coins animate (bob left/right) and have variable size
-    // Max size is roughly 10px radius + 3px bob + padding
-    int16_t r = 16;
+    uint8_t kind = view->particles.data[row].kind;
+    int16_t px = (int16_t)view->particles.x[row] - stripX;
+    int16_t py = (int16_t)view->particles.y[row] - stripY;
+
 #if USE_SPRITES
-    if (sprCoin)
-        r = sprCoin->width / 2 + 5; // Extra padding for bob
+    Sprite *sprite = sprParticle[kind];
+    if (sprite)
+    {
+        spriteDrawTransparentTo(*strip, sprite, px - sprite->width / 2, py - sprite->height / 2);
+        return;
+    }
 #endif
-    gfxRestoreBackground((int16_t)coin->x - r, (int16_t)coin->y - r, r * 2, r * 2);
+
+    switch (kind)
+    {
+    case PARTICLE_BUBBLE_SM:
+        strip->drawCircle(px, py, 2, COLOR_WATER_LIGHT);
+        break;
+    case PARTICLE_BUBBLE_MED:
+        strip->drawCircle(px, py, GFX_PARTICLE_RADIUS, COLOR_WATER_LIGHT);
+        break;
+    case PARTICLE_SPARKLE:
+        strip->drawFastHLine(px - 3, py, 7, COLOR_COIN_GOLD);
+        strip->drawFastVLine(px, py - 3, 7, COLOR_COIN_GOLD);
+        break;
+    default:
+        strip->fillCircle(px, py, 2, COLOR_WHITE);
+        break;
+    }
 }
 
-void gfxClearAllCoins()
+void gfxDrawAllParticles()
 {
-    for (int i = 0; i < MAX_COINS; i++)
+    for (uint16_t r = 0; r < view->particles.count; r++)
     {
-        gfxClearCoin(&coinPool[i]);
+        gfxDrawParticle(r);
     }
 }
 
+// Print the FPS counter with its top-left corner at (x, y) of dst
+static void gfxPrintFPS(TFT_eSPI &dst, int16_t x, int16_t y)
+{
+    dst.setTextColor(COLOR_UI_GREEN, COLOR_BLACK);
+    dst.setTextSize(1);
+    dst.setCursor(x, y);
+    dst.print(fpsValue);
+    dst.print("fps");
+}
+
 void gfxDrawUI()
 {
-    // Top bar - black background
-    tft.fillRect(0, 0, SCREEN_WIDTH, TANK_TOP, COLOR_BLACK);
+    // UI lives in the top bar and the footer only
+    if (!stripHit({0, 0, SCREEN_WIDTH, TANK_TOP}) &&
+        !stripHit({0, TANK_BOTTOM, SCREEN_WIDTH, SCREEN_HEIGHT - TANK_BOTTOM}))
+        return;
 
-    // Coin display
-    tft.setTextColor(COLOR_COIN_GOLD);
-    tft.setTextSize(2);
-    tft.setCursor(5, 10);
-    tft.print("$");
-    tft.print(game.coins);
+    // Strip-space origin
+    int16_t ox = -stripX;
+    int16_t oy = -stripY;
 
-    // Fish count - label at top right, count below
-    tft.setTextColor(COLOR_TEXT);
-    tft.setTextSize(1);
-    tft.setCursor(SCREEN_WIDTH - 35, 5);
-    tft.print("FISH");
-    tft.setTextSize(2);
-    tft.setCursor(SCREEN_WIDTH - 30, 18);
-    tft.print(fishGetCount());
-
-    // Bottom bar - footer background
-    tft.fillRect(0, TANK_BOTTOM, SCREEN_WIDTH, SCREEN_HEIGHT - TANK_BOTTOM, COLOR_BLACK);
-
-    // Buy Fish Button - centered
-    int16_t btnWidth = 100;
-    int16_t btnHeight = 30;
-    int16_t btnX = (SCREEN_WIDTH - btnWidth) / 2;
-    int16_t btnY = TANK_BOTTOM + 5;
-
-    // Button background - bright green when affordable, dark when not
-    uint16_t btnColor = game.coins >= FISH_COST_BASIC ? COLOR_UI_GREEN : tft.color565(80, 80, 80);
-    tft.fillRect(btnX, btnY, btnWidth, btnHeight, btnColor);
-    tft.drawRect(btnX, btnY, btnWidth, btnHeight, COLOR_COIN_GOLD);
-
-    // Button text
-    uint16_t textColor = game.coins >= FISH_COST_BASIC ? COLOR_BLACK : COLOR_WHITE;
-    tft.setTextColor(textColor);
-    tft.setTextSize(2);
+    // Bar backgrounds (the strip clips them), then the widgets on top
+    strip->fillRect(ox, oy, SCREEN_WIDTH, TANK_TOP, COLOR_BLACK);
+    strip->fillRect(ox, oy + TANK_BOTTOM, SCREEN_WIDTH, SCREEN_HEIGHT - TANK_BOTTOM, COLOR_BLACK);
+    uiDraw(*strip, ox, oy, {stripX, stripY, stripW, stripH});
+}
+
+void gfxDrawProfiler()
+{
+    if (!stripHit({PROF_OVERLAY_X, PROF_OVERLAY_Y, PROF_OVERLAY_W, PROF_OVERLAY_H}))
+        return;
 
-    char btnText[16];
-    snprintf(btnText, sizeof(btnText), "BUY $%d", FISH_COST_BASIC);
-    int16_t textWidth = strlen(btnText) * 12;
-    tft.setCursor(btnX + (btnWidth - textWidth) / 2, btnY + 7);
-    tft.print(btnText);
+    int16_t x = PROF_OVERLAY_X - stripX;
+    int16_t y = PROF_OVERLAY_Y - stripY;
+    strip->fillRect(x, y, PROF_OVERLAY_W, PROF_OVERLAY_H, COLOR_BLACK);
+    strip->setTextColor(COLOR_UI_GREEN, COLOR_BLACK);
+    strip->setTextSize(1);
+
+    // One row per phase, microseconds per frame
+    char line[32];
+    strip->setCursor(x + 2, y + 2);
+    strip->print("us      min  avg  p99");
+    for (uint8_t p = 0; p < PROF_PHASE_COUNT; p++)
+    {
+        const ProfStats &stats = profGetStats((ProfPhase)p);
+        snprintf(line, sizeof(line), "%-5s%6u%5u%5u", profPhaseName((ProfPhase)p),
+                 stats.min, stats.avg, stats.p99);
+        strip->setCursor(x + 2, y + 2 + (p + 1) * 8);
+        strip->print(line);
+    }
 }
 
-void gfxDrawFPS(uint16_t fps)
+void gfxDrawFPS(uint16_t fps, GameState state)
 {
-    tft.setTextColor(COLOR_UI_GREEN, COLOR_BLACK);
-    tft.setTextSize(1);
-    tft.setCursor(SCREEN_WIDTH - 35, 2);
-    tft.print(fps);
-    tft.print("fps");
+    fpsValue = fps;
+    fpsShown = true;
+
+    // The tank view composites the counter into the top bar (gfxDrawUI)
+    if (state == STATE_PLAYING)
+        return;
+
+    gfxPrintFPS(tft, SCREEN_WIDTH - 35, 2);
 }
 
 // DEBUG: Draw touch crosshair
@@ -615,54 +1322,71 @@ void gfxDrawTouchDebug(int16_t x, int16_t y)
         return;
 
     // Draw crosshair
-    tft.drawLine(x - 10, y, x + 10, y, COLOR_UI_RED);
-    tft.drawLine(x, y - 10, x, y + 10, COLOR_UI_RED);
-    tft.drawCircle(x, y, 5, COLOR_UI_RED);
+    int16_t px = gfxPanelX(x);
+    tft.drawLine(px - 10, y, px + 10, y, COLOR_UI_RED);
+    tft.drawLine(px, y - 10, px, y + 10, COLOR_UI_RED);
+    tft.drawCircle(px, y, 5, COLOR_UI_RED);
 
     // Draw coordinates
     tft.setTextColor(COLOR_UI_RED, COLOR_BLACK);
     tft.setTextSize(1);
     char buf[16];
     snprintf(buf, sizeof(buf), "%d,%d", x, y);
-    tft.setCursor(x + 12, y - 4);
+    tft.setCursor(px + 12, y - 4);
     tft.print(buf);
+
+    // Drawn over the composited screen: repaint it next frame
+    dirtyAdd(x - 10, y - 10, 21, 21);
+    dirtyAdd(x + 12, y - 4, tft.textWidth(buf), 8);
 }
 
 // ============================================================================
 // PRIMITIVES
 // ============================================================================
+//
+// These draw straight to the panel, over whatever the compositor pushed, so
+// each marks its area dirty for the next composited frame. Positions are
+// screen positions; they follow the hardware scroll like strips do.
+//
 
 void gfxFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-    tft.fillRect(x, y, w, h, color);
+    tft.fillRect(gfxPanelX(x), y, w, h, color);
+    dirtyAdd(x, y, w, h);
 }
 
 void gfxDrawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-    tft.drawRect(x, y, w, h, color);
+    tft.drawRect(gfxPanelX(x), y, w, h, color);
+    dirtyAdd(x, y, w, h);
 }
 
 void gfxFillCircle(int16_t x, int16_t y, int16_t r, uint16_t color)
 {
-    tft.fillCircle(x, y, r, color);
+    tft.fillCircle(gfxPanelX(x), y, r, color);
+    dirtyAdd(x - r, y - r, r * 2 + 1, r * 2 + 1);
 }
 
 void gfxDrawCircle(int16_t x, int16_t y, int16_t r, uint16_t color)
 {
-    tft.drawCircle(x, y, r, color);
+    tft.drawCircle(gfxPanelX(x), y, r, color);
+    dirtyAdd(x - r, y - r, r * 2 + 1, r * 2 + 1);
 }
 
 void gfxDrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
 {
-    tft.drawLine(x0, y0, x1, y1, color);
+    int16_t px0 = gfxPanelX(x0);
+    tft.drawLine(px0, y0, px0 + (x1 - x0), y1, color);
+    dirtyAdd(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1);
 }
 
 void gfxDrawText(const char *text, int16_t x, int16_t y, uint16_t color, uint8_t size)
 {
     tft.setTextColor(color);
     tft.setTextSize(size);
-    tft.setCursor(x, y);
+    tft.setCursor(gfxPanelX(x), y);
     tft.print(text);
+    dirtyAdd(x, y, tft.textWidth(text), tft.fontHeight());
 }
 
 // ============================================================================
@@ -9,7 +9,7 @@
  * Core gameplay:
  * - Tap to drop food
  * - Fish eat, grow, drop coins
- * - Tap coins to collect
+ * - Tap coins to collect, or drag across them
  * - Don't let fish starve!
  */
 
@@ -18,28 +18,53 @@
 #include "fish.h"
 #include "food.h"
 #include "game_state.h"
+#include "gesture.h"
+#include "governor.h"
 #include "graphics.h"
+#include "particles.h"
+#include "profiler.h"
+#include "save_writer.h"
 #include "sdcard.h"
+#include "snapshot.h"
+#include "spi_bus.h"
 #include "touch.h"
 #include "sd_sprites.h"
 #include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 // Forward declarations for ESP-IDF/C++ strictness
+void updateTask(void *param);
+bool updateStep(unsigned long deltaTime);
 void handleInput();
+void handleTap(TouchPoint tap);
 void handlePlayingInput(TouchPoint tap);
-void render();
-void renderPlaying();
-void renderGameOver();
+void handleBuy();
+void handleSweep(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void render(const GameSnapshot &snap);
+void renderPlaying(const GameSnapshot &snap);
+void renderGameOver(const GameSnapshot &snap);
 void renderTitle();
 
 // ============================================================================
 // TIMING
 // ============================================================================
+//
+// Two loops run side by side. The update task (core 0) drains the touch
+// events the sampler task queued, handles input and advances the
+// fish/food/coins in fixed SIM_DT steps, then publishes a snapshot.
+// loop() (core 1) draws the newest snapshot, interpolated to the moment it
+// draws, and never touches the live game state. Game speed depends only
+// on the step count, not the frame rate.
+// Every SAVE_AUTOSAVE_MS of play the update task encodes a save, and the
+// save writer task puts it on the SD card.
+//
 
 unsigned long lastFrameTime = 0;
 unsigned long frameCount = 0;
 unsigned long fpsTimer = 0;
 uint16_t currentFPS = 0;
+unsigned long autosaveTimer = 0; // Update task: game time since the last save
 
 // ============================================================================
 // SETUP
@@ -58,7 +83,14 @@ void setup()
   Serial.println();
 #endif
 
-  // Initialize touch FIRST (before display claims SPI bus)
+  // Display and touch share HSPI from different cores
+  busInit();
+
+  // Initialize display first (gives visual feedback, and brings up the
+  // SPI bus touch shares)
+  gfxInit();
+  govInit();
+
   touchInit();
 
 #if DEBUG_SERIAL
@@ -67,9 +99,6 @@ void setup()
   delay(3000); // Give time to read instructions
 #endif
 
-  // Initialize display second (gives visual feedback)
-  gfxInit();
-
   gfxClear(COLOR_BLACK);
   gfxDrawText("BASS HOLE", 60, 140, COLOR_WHITE, 3);
   gfxDrawText("Loading...", 80, 180, COLOR_WATER_LIGHT, 1);
@@ -99,13 +128,17 @@ void setup()
   fishInit();
   foodInit();
   coinsInit();
-  gameStateInit();
+  particleInit();
+  bool restored = gameStateInit();
 
   // Clear splash screen before starting game
   gfxClear(COLOR_BLACK);
 
-  // Start new game
-  gameStateReset();
+  // Carry on with the saved tank, or start a new game
+  if (restored)
+    gameStateChange(STATE_PLAYING);
+  else
+    gameStateReset();
 
 #if DEBUG_SERIAL
   Serial.println("Setup complete!");
@@ -113,67 +146,162 @@ void setup()
   Serial.println(ESP.getFreeHeap());
 #endif
 
+  profInit();
+
+  // First snapshot, so loop() has something to draw straight away
+  snapshotInit();
+  snapshotPublish(micros(), false);
+
   lastFrameTime = millis();
   fpsTimer = millis();
+
+  // Touch events from here on (the sampler shares the bus with the display)
+  touchStart();
+
+  // Saves go to the card from their own task
+  saveWriterStart();
+
+  // Simulation on core 0; this task (loop) keeps rendering on core 1
+  xTaskCreatePinnedToCore(updateTask, "update", UPDATE_TASK_STACK, nullptr,
+                          UPDATE_TASK_PRIORITY, nullptr, UPDATE_TASK_CORE);
 }
 
 // ============================================================================
-// MAIN LOOP
+// UPDATE TASK (core 0)
 // ============================================================================
 
-void loop()
+void updateTask(void *param)
 {
-  unsigned long now = millis();
-  unsigned long deltaTime = now - lastFrameTime;
+  (void)param;
+  uint32_t lastMicros = micros();
+  uint32_t accumulator = 0; // Time owed to the simulation (< SIM_TICK_US between wakes)
+  uint64_t simMicros = 0;   // Simulated time, for whole-ms step deltas
+  unsigned long simMillis = 0;
 
-  // Frame rate limiting
-  if (deltaTime < FRAME_TIME_MS)
+  for (;;)
   {
-    delay(FRAME_TIME_MS - deltaTime);
-    now = millis();
-    deltaTime = now - lastFrameTime;
+    // Sleep until the next step is due
+    vTaskDelay(pdMS_TO_TICKS((SIM_TICK_US - accumulator + 999) / 1000));
+
+    uint32_t now = micros();
+    accumulator += now - lastMicros;
+    lastMicros = now;
+
+    // After a long stall, drop the backlog instead of spiralling
+    if (accumulator > SIM_MAX_STEPS * SIM_TICK_US)
+      accumulator = SIM_MAX_STEPS * SIM_TICK_US;
+
+    uint8_t steps = 0;
+    bool moving = false;
+    while (accumulator >= SIM_TICK_US)
+    {
+      accumulator -= SIM_TICK_US;
+      simMicros += SIM_TICK_US;
+
+      // 16/17 ms deltas that add up exactly, for the millisecond timers
+      unsigned long stepMillis = (unsigned long)(simMicros / 1000);
+      moving = updateStep(stepMillis - simMillis);
+      simMillis = stepMillis;
+      steps++;
+    }
+
+    // Hand the newest step to the renderer, stamped with when it was due
+    if (steps)
+      snapshotPublish(now - accumulator, moving);
   }
-  lastFrameTime = now;
+}
 
-  // Update game state timing
-  gameStateUpdate();
+// One fixed SIM_DT step. Returns true if entities moved.
+bool updateStep(unsigned long deltaTime)
+{
+  // Advance the game clock (gameplay timers run on it, not millis())
+  gameStateUpdate(deltaTime);
 
   // Handle input
-  touchUpdate();
-  handleInput();
-
-  // State transition logic (detect entry to PLAYING)
-  static GameState lastState = STATE_BOOT;
-  if (game.state == STATE_PLAYING && lastState != STATE_PLAYING)
   {
-    // Draw full background ONCE when entering playing state
-    // (Also catches resume from pause)
-    gfxDrawTank();
+    PROF_SCOPE(PROF_INPUT);
+    handleInput();
   }
-  lastState = game.state;
 
   // Update game entities
-  if (game.state == STATE_PLAYING && !game.isPaused)
+  bool moving = game.state == STATE_PLAYING && !game.isPaused;
+  if (moving)
   {
-    // DIRTY RECT RENDERING:
-    // 1. Clear OLD positions (restore background)
-    gfxClearAllFish();
-    gfxClearAllFood();
-    gfxClearAllCoins();
-    // 2. Update physics (positions change)
+    PROF_SCOPE(PROF_SIM);
+
+    // Update physics (positions change)
     fishUpdate(deltaTime);
     foodUpdate(deltaTime);
     coinsUpdate(deltaTime);
+    particleUpdate();
 
     // Check for game over (all fish dead)
     if (fishGetCount() == 0 && game.coins < FISH_COST_BASIC)
     {
       gameStateChange(STATE_GAMEOVER);
     }
+
+    // Autosave: only encodes here, the save writer task does the SD write
+    autosaveTimer += deltaTime;
+    if (autosaveTimer >= SAVE_AUTOSAVE_MS)
+    {
+      autosaveTimer = 0;
+      gameSave();
+    }
+  }
+
+  return moving;
+}
+
+// ============================================================================
+// MAIN LOOP (render, core 1)
+// ============================================================================
+
+void loop()
+{
+  unsigned long now = millis();
+
+  // Frame rate limiting: the governor stretches the frame time while the
+  // tank is quiet. Sleep in full-rate ticks, so a new tap ends the wait at
+  // the next one.
+  unsigned long frameTime = govFrameTime();
+  while (now - lastFrameTime < frameTime)
+  {
+    unsigned long elapsed = now - lastFrameTime;
+    delay(min(frameTime - elapsed, FRAME_TIME_MS - elapsed % FRAME_TIME_MS));
+    now = millis();
+    if (snapshotAcquire().tapCount != govTapCount())
+      break;
   }
+  lastFrameTime = now;
+
+  // Newest state from the update task, entities placed for this instant
+  static GameSnapshot frame;
+  snapshotInterpolate(snapshotAcquire(), micros(), frame);
+  const GameSnapshot &snap = frame;
 
-  // Render
-  render();
+  // State transition logic (detect entry to PLAYING)
+  static GameState lastState = STATE_BOOT;
+  if (snap.game.state == STATE_PLAYING && lastState != STATE_PLAYING)
+  {
+    // Composite the full screen ONCE when entering playing state;
+    // after that only dirty regions are redrawn
+    gfxInvalidate();
+  }
+  lastState = snap.game.state;
+
+  // Render (touch gets the bus between strips, see spi_bus.h)
+  busLock();
+  render(snap);
+  busUnlock();
+
+  // Title and game over repaint whole each frame without changing; only
+  // the tank's redraws count as activity
+  govFrameDone(now, snap.game.state == STATE_PLAYING ? gfxFrameArea() : 0, snap.tapCount);
+
+#if DEBUG_PROFILER
+  profFrameEnd();
+#endif
 
   // FPS calculation
   frameCount++;
@@ -183,13 +311,17 @@ void loop()
     frameCount = 0;
     fpsTimer = now;
 
+#if DEBUG_PROFILER
+    profReport();
+#endif
+
 #if DEBUG_SERIAL && DEBUG_FPS
     Serial.print("FPS: ");
     Serial.print(currentFPS);
     Serial.print(" | Fish: ");
-    Serial.print(fishGetCount());
+    Serial.print(snap.fish.count);
     Serial.print(" | Coins: $");
-    Serial.print(game.coins);
+    Serial.print(snap.game.coins);
     Serial.print(" | Heap: ");
     Serial.println(ESP.getFreeHeap());
 #endif
@@ -200,17 +332,81 @@ void loop()
 // INPUT HANDLING
 // ============================================================================
 
+// Food the current press dropped, until the press turns out to be a tap
+static EntityId pendingFood = ENTITY_NONE;
+
+// The current press is on the BUY button. Spending can't be taken back
+// cleanly, so the purchase waits for the tap to be confirmed.
+static bool pendingBuy = false;
+
 void handleInput()
 {
-  if (!touchTapped())
-    return;
+  // Gestures in everything the touch sampler queued since the last step,
+  // oldest first. Taps act on the press (see gesture.h).
+  Gesture gesture;
+  while (gesturePoll(gesture))
+  {
+    switch (gesture.type)
+    {
+    case GESTURE_PRESS:
+      pendingFood = ENTITY_NONE;
+      pendingBuy = false;
+      handleTap({gesture.x, gesture.y, gesture.pressure, true});
+      break;
+
+    case GESTURE_TAP:
+      pendingFood = ENTITY_NONE;
+      if (pendingBuy && game.state == STATE_PLAYING)
+        handleBuy();
+      pendingBuy = false;
+      break;
+
+    case GESTURE_DRAG_START:
+      // Not a tap after all: the pellet goes (its splash has already
+      // played), and dragging off the BUY button buys nothing
+      if (pendingFood != ENTITY_NONE)
+        foodRemove(pendingFood);
+      pendingFood = ENTITY_NONE;
+      pendingBuy = false;
+      // Fall through - the move from the press point is the first segment
+
+    case GESTURE_DRAG:
+      handleSweep(gesture.fromX, gesture.fromY, gesture.x, gesture.y);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  // Coins drifting into a pen held still mid-drag
+  int16_t penX, penY;
+  if (gestureDragging(penX, penY))
+    handleSweep(penX, penY, penX, penY);
+}
 
-  TouchPoint tap = touchGetTap();
-  if (!tap.valid)
+// Drag: collect the coins along the pen's path
+void handleSweep(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  if (game.state != STATE_PLAYING)
     return;
 
-  // VISUAL DEBUG: Draw circle where tap occurred
-  tft.fillCircle(tap.x, tap.y, 4, TFT_WHITE);
+  uint8_t collected = coinCollectPath(x0, y0, x1, y1, GESTURE_SWEEP_RADIUS);
+#if DEBUG_SERIAL
+  if (collected > 0)
+  {
+    Serial.print("Swept $");
+    Serial.println(collected);
+  }
+#else
+  (void)collected;
+#endif
+}
+
+void handleTap(TouchPoint tap)
+{
+  // Drawn by the renderer (tap marker, touch debug)
+  snapshotNoteTap(tap);
 
   switch (game.state)
   {
@@ -248,9 +444,10 @@ void handlePlayingInput(TouchPoint tap)
   // Check if tap is in tank area
   if (tap.y >= TANK_TOP && tap.y <= TANK_BOTTOM)
   {
-    // Drop food at tap location
-    Food *food = foodDrop(tap.x, tap.y);
-    if (food)
+    // Drop food at tap location (taken back if the press becomes a drag)
+    EntityId food = foodDrop(tap.x, tap.y);
+    pendingFood = food;
+    if (food != ENTITY_NONE)
     {
 #if DEBUG_SERIAL
       Serial.print("Dropped food at ");
@@ -292,30 +489,37 @@ void handlePlayingInput(TouchPoint tap)
       Serial.println("Buy button HIT!");
 #endif
 
-      if (game.coins >= FISH_COST_BASIC)
-      {
-        game.coins -= FISH_COST_BASIC;
+      // Bought when the press turns out to be a tap
+      pendingBuy = true;
+    }
+  }
+}
+
+// Confirmed tap on the BUY button
+void handleBuy()
+{
+  if (game.coins >= FISH_COST_BASIC)
+  {
+    game.coins -= FISH_COST_BASIC;
 
-        // Cycle through unlocked fish
-        static uint8_t nextFishToSpawn = 0;
+    // Cycle through unlocked fish
+    static uint8_t nextFishToSpawn = 0;
 
-        // Simple loop to find next unlocked fish
-        // (For Phase 2 we unlocked all 0x1F so this just cycles 0-4)
-        nextFishToSpawn = (nextFishToSpawn + 1) % FISH_SPECIES_COUNT;
+    // Simple loop to find next unlocked fish
+    // (For Phase 2 we unlocked all 0x1F so this just cycles 0-4)
+    nextFishToSpawn = (nextFishToSpawn + 1) % FISH_SPECIES_COUNT;
 
-        // Spawn the selected fish
-        fishSpawn((FishSpecies)nextFishToSpawn, SCREEN_WIDTH / 2, TANK_TOP + 20);
+    // Spawn the selected fish
+    fishSpawn((FishSpecies)nextFishToSpawn, SCREEN_WIDTH / 2, TANK_TOP + 20);
 
 #if DEBUG_SERIAL
-        Serial.print("Spawned Species ID: ");
-        Serial.println(nextFishToSpawn);
+    Serial.print("Spawned Species ID: ");
+    Serial.println(nextFishToSpawn);
 #endif
 #if DEBUG_SERIAL
-        Serial.print("Bought fish! Remaining coins: $");
-        Serial.println(game.coins);
+    Serial.print("Bought fish! Remaining coins: $");
+    Serial.println(game.coins);
 #endif
-      }
-    }
   }
 }
 
@@ -323,16 +527,16 @@ void handlePlayingInput(TouchPoint tap)
 // RENDERING
 // ============================================================================
 
-void render()
+void render(const GameSnapshot &snap)
 {
-  switch (game.state)
+  switch (snap.game.state)
   {
   case STATE_PLAYING:
-    renderPlaying();
+    renderPlaying(snap);
     break;
 
   case STATE_GAMEOVER:
-    renderGameOver();
+    renderGameOver(snap);
     break;
 
   case STATE_TITLE:
@@ -340,46 +544,31 @@ void render()
     break;
 
   default:
-    renderPlaying();
+    renderPlaying(snap);
     break;
   }
 
 #if DEBUG_FPS
-  gfxDrawFPS(currentFPS);
+  gfxDrawFPS(currentFPS, snap.game.state);
 #endif
 }
 
-void renderPlaying()
+void renderPlaying(const GameSnapshot &snap)
 {
-  // Background drawn via dirty rect restoration or state entry
-  // gfxDrawTank();
-
-  // Draw game entities (order matters for layering)
-  gfxDrawAllFood();
-  gfxDrawAllFish();
-  gfxDrawAllCoins();
-
-  // Draw UI
-  gfxDrawUI();
+  // Dirty regions are composited strip by strip
+  // (layer order: tank, food, fish, coins, UI) and pushed once each
+  gfxDrawFrame(snap);
 
-// DEBUG: Show last tap location
+// DEBUG: Show last tap location for 2 seconds
 #if DEBUG_TOUCH
-  static TouchPoint lastDebugTap = {0, 0, 0, false};
-  static unsigned long lastDebugTime = 0;
-  if (touchTapped())
-  {
-    lastDebugTap = touchGetTap();
-    lastDebugTime = millis();
-  }
-  // Show for 2 seconds
-  if (millis() - lastDebugTime < 2000 && lastDebugTap.valid)
+  if (snap.tap.valid && millis() - snap.tapTime < 2000)
   {
-    gfxDrawTouchDebug(lastDebugTap.x, lastDebugTap.y);
+    gfxDrawTouchDebug(snap.tap.x, snap.tap.y);
   }
 #endif
 }
 
-void renderGameOver()
+void renderGameOver(const GameSnapshot &snap)
 {
   gfxClear(COLOR_BLACK);
 
@@ -388,10 +577,10 @@ void renderGameOver()
   gfxDrawText("Final Score:", 70, 160, COLOR_TEXT, 1);
 
   char scoreText[16];
-  snprintf(scoreText, sizeof(scoreText), "$%lu", game.coins);
+  snprintf(scoreText, sizeof(scoreText), "$%lu", (unsigned long)snap.game.coins);
   gfxDrawText(scoreText, 90, 180, COLOR_COIN_GOLD, 2);
 
-  if (game.coins >= game.highScore)
+  if (snap.game.coins >= snap.game.highScore)
   {
     gfxDrawText("NEW HIGH SCORE!", 50, 220, COLOR_UI_GREEN, 1);
   }
@@ -0,0 +1,103 @@
+#include "particles.h"
+
+// Live particles
+ParticleStore particleStore;
+
+// How one emitter spawns and moves its particles
+struct EmitterDef {
+    uint8_t kind;
+    uint8_t burst;    // Particles per emit
+    uint8_t maxLive;  // Alive at once from this emitter
+    float spreadX;    // vx in +-spreadX (pixels per second)
+    float baseVy;     // vy in baseVy +-spreadY
+    float spreadY;
+    float accelY;     // Pixels per second^2 (negative rises)
+    float drag;       // Fraction of velocity lost per second
+    uint16_t life;    // Steps, plus up to a quarter more
+};
+
+// The budgets add up to at most MAX_PARTICLES, so every emitter always
+// gets its share
+static const EmitterDef EMITTERS[EMIT_COUNT] = {
+    // kind                burst max  spreadX baseVy spreadY accelY drag  life
+    {PARTICLE_SPLASH,      2,    6,   30.0f, -35.0f, 10.0f,  120.0f, 0.0f, 20},  // EMIT_FOOD_SPLASH
+    {PARTICLE_BUBBLE_SM,   3,    15,  10.0f, -15.0f, 8.0f,   -20.0f, 0.5f, 75},  // EMIT_FOOD_BUBBLES
+    {PARTICLE_SPARKLE,     4,    16,  45.0f, -20.0f, 35.0f,  0.0f,   2.0f, 24},  // EMIT_COIN_SPARKLE
+    {PARTICLE_BUBBLE_MED,  2,    10,  8.0f,  -10.0f, 5.0f,   -25.0f, 0.5f, 90},  // EMIT_FEED_BUBBLES
+};
+
+// Alive per emitter (budgets)
+static uint8_t emitterLive[EMIT_COUNT];
+
+// Bubbles pop this far below the surface
+#define PARTICLE_SURFACE_MARGIN 4
+
+// Private xorshift generator: effects don't consume gameRandom()
+static uint32_t particleSeed;
+
+static float particleRandom(float lo, float hi) {
+    particleSeed ^= particleSeed << 13;
+    particleSeed ^= particleSeed >> 17;
+    particleSeed ^= particleSeed << 5;
+    return lo + (hi - lo) * (float)(particleSeed & 0xFFFF) / 65535.0f;
+}
+
+void particleInit() {
+    particleStore.clear();
+    memset(emitterLive, 0, sizeof(emitterLive));
+    particleSeed = 0x9E3779B9;
+}
+
+void particleUpdate() {
+    particleStore.integrate(SIM_DT);
+
+    // The last particle moves into a removed row, so only step past survivors
+    for (uint16_t r = 0; r < particleStore.count; ) {
+        Particle* p = &particleStore.data[r];
+        const EmitterDef* def = &EMITTERS[p->emitter];
+
+        float x = particleStore.x[r];
+        float y = particleStore.y[r];
+        bool gone = p->life == 0 ||
+                    x < TANK_LEFT || x >= TANK_RIGHT ||
+                    y < TANK_TOP + PARTICLE_SURFACE_MARGIN || y >= TANK_BOTTOM;
+        if (gone) {
+            emitterLive[p->emitter]--;
+            particleStore.removeRow(r);
+            continue;
+        }
+
+        p->life--;
+        float keep = 1.0f - def->drag * SIM_DT;
+        particleStore.vx[r] *= keep;
+        particleStore.vy[r] = particleStore.vy[r] * keep + def->accelY * SIM_DT;
+        r++;
+    }
+}
+
+uint8_t particleEmit(ParticleEmitter emitter, float x, float y) {
+    if (emitter >= EMIT_COUNT) return 0;
+    const EmitterDef* def = &EMITTERS[emitter];
+
+    uint8_t spawned = 0;
+    while (spawned < def->burst && emitterLive[emitter] < def->maxLive) {
+        uint16_t r = particleStore.spawn(x, y);
+        if (r == ENTITY_NONE) break;
+
+        Particle* p = &particleStore.data[r];
+        p->kind = def->kind;
+        p->emitter = emitter;
+        p->life = def->life + (uint16_t)particleRandom(0, def->life / 4);
+        particleStore.vx[r] = particleRandom(-def->spreadX, def->spreadX);
+        particleStore.vy[r] = def->baseVy + particleRandom(-def->spreadY, def->spreadY);
+
+        emitterLive[emitter]++;
+        spawned++;
+    }
+
+    return spawned;
+}
+
+uint8_t particleGetCount() {
+    return particleStore.count;
+}
@@ -0,0 +1,139 @@
+#include "profiler.h"
+#include <atomic>
+#include <algorithm>
+
+#define PROF_SYNC0 0xB5
+#define PROF_SYNC1 0x50
+
+static const char *const profNames[PROF_PHASE_COUNT] = {
+    "input", "sim", "clear", "draw", "ui", "push"};
+
+// Time added since the last profFrameEnd (written from both cores)
+static std::atomic<uint32_t> profPending[PROF_PHASE_COUNT];
+
+// Owned by the render loop
+static uint16_t profSamples[PROF_PHASE_COUNT][PROF_WINDOW];
+static uint16_t profNext = 0;   // Ring slot for the next frame
+static uint16_t profFilled = 0; // Valid samples per phase (up to PROF_WINDOW)
+static uint32_t profFrames = 0;
+static ProfStats profStats[PROF_PHASE_COUNT];
+static uint32_t profReports = 0;
+
+void profInit()
+{
+    for (uint8_t p = 0; p < PROF_PHASE_COUNT; p++)
+    {
+        profPending[p].store(0, std::memory_order_relaxed);
+        profStats[p] = {0, 0, 0};
+    }
+    memset(profSamples, 0, sizeof(profSamples));
+    profNext = 0;
+    profFilled = 0;
+    profFrames = 0;
+    profReports = 0;
+}
+
+void profAdd(ProfPhase phase, uint32_t micros)
+{
+    profPending[phase].fetch_add(micros, std::memory_order_relaxed);
+}
+
+void profFrameEnd()
+{
+    for (uint8_t p = 0; p < PROF_PHASE_COUNT; p++)
+    {
+        uint32_t us = profPending[p].exchange(0, std::memory_order_relaxed);
+        profSamples[p][profNext] = (uint16_t)min(us, (uint32_t)0xFFFF);
+    }
+
+    profNext = (profNext + 1) % PROF_WINDOW;
+    if (profFilled < PROF_WINDOW)
+        profFilled++;
+    profFrames++;
+}
+
+// min/avg/p99 of the first n samples (order does not matter)
+static void profComputeStats(const uint16_t *samples, uint16_t n, ProfStats &out)
+{
+    if (n == 0)
+    {
+        out = {0, 0, 0};
+        return;
+    }
+
+    uint16_t sorted[PROF_WINDOW];
+    uint32_t sum = 0;
+    uint16_t lo = 0xFFFF;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        sorted[i] = samples[i];
+        sum += samples[i];
+        lo = min(lo, samples[i]);
+    }
+
+    // Nearest-rank p99: the ceil(0.99 * n)-th smallest sample
+    uint16_t rank = (uint16_t)((n * 99UL + 99) / 100);
+    std::nth_element(sorted, sorted + rank - 1, sorted + n);
+
+    out.min = lo;
+    out.avg = (uint16_t)(sum / n);
+    out.p99 = sorted[rank - 1];
+}
+
+#if DEBUG_PROFILER_STREAM
+static void profSendPacket()
+{
+    uint8_t packet[2 + 1 + 1 + 4 + PROF_PHASE_COUNT * 6 + 1];
+    uint8_t n = 0;
+
+    packet[n++] = PROF_SYNC0;
+    packet[n++] = PROF_SYNC1;
+    packet[n++] = PROF_STREAM_VERSION;
+    packet[n++] = PROF_PHASE_COUNT;
+    for (uint8_t b = 0; b < 4; b++)
+        packet[n++] = (uint8_t)(profFrames >> (b * 8));
+
+    for (uint8_t p = 0; p < PROF_PHASE_COUNT; p++)
+    {
+        const uint16_t fields[3] = {profStats[p].min, profStats[p].avg, profStats[p].p99};
+        for (uint8_t f = 0; f < 3; f++)
+        {
+            packet[n++] = (uint8_t)(fields[f] & 0xFF);
+            packet[n++] = (uint8_t)(fields[f] >> 8);
+        }
+    }
+
+    uint8_t check = 0;
+    for (uint8_t i = 2; i < n; i++)
+        check ^= packet[i];
+    packet[n++] = check;
+
+    Serial.write(packet, n);
+}
+#endif
+
+void profReport()
+{
+    for (uint8_t p = 0; p < PROF_PHASE_COUNT; p++)
+        profComputeStats(profSamples[p], profFilled, profStats[p]);
+    profReports++;
+
+#if DEBUG_PROFILER_STREAM
+    profSendPacket();
+#endif
+}
+
+const ProfStats &profGetStats(ProfPhase phase)
+{
+    return profStats[phase];
+}
+
+const char *profPhaseName(ProfPhase phase)
+{
+    return profNames[phase];
+}
+
+uint32_t profReportCount()
+{
+    return profReports;
+}
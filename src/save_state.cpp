@@ -0,0 +1,500 @@
+#include "save_state.h"
+#include "game_state.h"
+#include "fish.h"
+#include "food.h"
+#include "coins.h"
+#include "particles.h"
+#include <math.h>
+#include <string.h>
+
+#define SAVE_VERSION 1
+#define SAVE_HEADER_BYTES 5    // Magic + version
+#define SAVE_CRC_BYTES 4
+#define SAVE_FIXED_ONE 16.0f   // Positions and speeds: 1/16 pixel
+#define SAVE_PHASE_ONE 1024.0f // Coin bob phase: 1/1024 radian
+
+static const uint8_t SAVE_MAGIC[4] = {'B', 'H', 'S', 'V'};
+
+// Section tags. Never renumber: old saves and old firmware both rely on them.
+enum SaveSection : uint8_t
+{
+    SAVE_END = 0,
+    SAVE_GAME,  // GameData economy, stats and flags
+    SAVE_RNG,   // gameRandom() state
+    SAVE_FISH,  // Fish pool
+    SAVE_FOOD,  // Food pool
+    SAVE_COINS, // Coin pool
+    SAVE_SERIAL // Save counter (u32), to tell the newest of several saves
+};
+
+// SAVE_GAME flags
+#define SAVE_FLAG_SOUND 0x01
+#define SAVE_FLAG_TUTORIAL 0x02
+
+uint32_t saveCrc32(uint32_t crc, const uint8_t *data, size_t len)
+{
+    // Half-byte table: 64 bytes of flash instead of 1 KB, fast enough for a
+    // save this size
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+// ============================================================================
+// WRITER
+// ============================================================================
+
+struct SaveWriter
+{
+    uint8_t *buf;
+    size_t cap;
+    size_t len;
+    bool full; // Something didn't fit: the save is void
+};
+
+static void putByte(SaveWriter &w, uint8_t b)
+{
+    if (w.len < w.cap)
+        w.buf[w.len++] = b;
+    else
+        w.full = true;
+}
+
+static void putVarint(SaveWriter &w, uint32_t v)
+{
+    while (v >= 0x80)
+    {
+        putByte(w, (uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    putByte(w, (uint8_t)v);
+}
+
+static void putSigned(SaveWriter &w, int32_t v)
+{
+    putVarint(w, ((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+}
+
+static void putFixed(SaveWriter &w, float v, float one)
+{
+    putSigned(w, (int32_t)lroundf(v * one));
+}
+
+static void putAge(SaveWriter &w, unsigned long time, unsigned long now)
+{
+    putVarint(w, (uint32_t)(now - time));
+}
+
+// Sections have a 2-byte length, records 1 byte; both are filled in once
+// the contents are written
+static size_t openSection(SaveWriter &w, uint8_t tag)
+{
+    putByte(w, tag);
+    size_t at = w.len;
+    putByte(w, 0);
+    putByte(w, 0);
+    return at;
+}
+
+static void closeSection(SaveWriter &w, size_t at)
+{
+    size_t n = w.len - at - 2;
+    if (w.full || n > 0xFFFF)
+    {
+        w.full = true;
+        return;
+    }
+    w.buf[at] = (uint8_t)n;
+    w.buf[at + 1] = (uint8_t)(n >> 8);
+}
+
+static size_t openRecord(SaveWriter &w)
+{
+    size_t at = w.len;
+    putByte(w, 0);
+    return at;
+}
+
+static void closeRecord(SaveWriter &w, size_t at)
+{
+    size_t n = w.len - at - 1;
+    if (w.full || n > 0xFF)
+    {
+        w.full = true;
+        return;
+    }
+    w.buf[at] = (uint8_t)n;
+}
+
+static void saveWriteSerial(SaveWriter &w, uint32_t serial)
+{
+    size_t at = openSection(w, SAVE_SERIAL);
+    for (uint8_t i = 0; i < 4; i++)
+        putByte(w, (uint8_t)(serial >> (i * 8)));
+    closeSection(w, at);
+}
+
+static void saveWriteGame(SaveWriter &w)
+{
+    size_t at = openSection(w, SAVE_GAME);
+    putVarint(w, game.coins);
+    putVarint(w, game.highScore);
+    putVarint(w, game.currentLevel);
+    putVarint(w, game.fishUnlocked);
+    putVarint(w, game.totalCoinsEarned);
+    putVarint(w, game.fishFed);
+    putVarint(w, game.fishLost);
+    putVarint(w, game.enemiesDefeated);
+    putVarint(w, game.bossesDefeated);
+    putVarint(w, game.playTime);
+    putVarint(w, (game.soundEnabled ? SAVE_FLAG_SOUND : 0) |
+                     (game.tutorialComplete ? SAVE_FLAG_TUTORIAL : 0));
+    closeSection(w, at);
+}
+
+static void saveWriteRng(SaveWriter &w)
+{
+    size_t at = openSection(w, SAVE_RNG);
+    uint32_t state = gameRandomState();
+    for (uint8_t i = 0; i < 4; i++)
+        putByte(w, (uint8_t)(state >> (i * 8)));
+    closeSection(w, at);
+}
+
+static void saveWriteFish(SaveWriter &w, unsigned long now)
+{
+    size_t at = openSection(w, SAVE_FISH);
+    putVarint(w, fishStore.count);
+    for (uint16_t r = 0; r < fishStore.count; r++)
+    {
+        const Fish &fish = fishStore.data[r];
+        size_t rec = openRecord(w);
+        putVarint(w, fish.species);
+        putVarint(w, fish.growthStage);
+        putVarint(w, fish.hunger);
+        putVarint(w, fish.tint);
+        putVarint(w, fish.frame);
+        putVarint(w, fish.facingRight);
+        putFixed(w, fishStore.x[r], SAVE_FIXED_ONE);
+        putFixed(w, fishStore.y[r], SAVE_FIXED_ONE);
+        putFixed(w, fishStore.vx[r], SAVE_FIXED_ONE);
+        putFixed(w, fishStore.vy[r], SAVE_FIXED_ONE);
+        putFixed(w, fish.targetX, SAVE_FIXED_ONE);
+        putFixed(w, fish.targetY, SAVE_FIXED_ONE);
+        putAge(w, fish.lastFed, now);
+        putAge(w, fish.lastFrameTime, now);
+        putAge(w, fish.lastCoinDrop, now);
+        closeRecord(w, rec);
+    }
+    closeSection(w, at);
+}
+
+static void saveWriteFood(SaveWriter &w, unsigned long now)
+{
+    size_t at = openSection(w, SAVE_FOOD);
+    putVarint(w, foodStore.count);
+    for (uint16_t r = 0; r < foodStore.count; r++)
+    {
+        size_t rec = openRecord(w);
+        putFixed(w, foodStore.x[r], SAVE_FIXED_ONE);
+        putFixed(w, foodStore.y[r], SAVE_FIXED_ONE);
+        putFixed(w, foodStore.vx[r], SAVE_FIXED_ONE);
+        putFixed(w, foodStore.vy[r], SAVE_FIXED_ONE);
+        putAge(w, foodStore.data[r].spawnTime, now);
+        closeRecord(w, rec);
+    }
+    closeSection(w, at);
+}
+
+static void saveWriteCoins(SaveWriter &w, unsigned long now)
+{
+    size_t at = openSection(w, SAVE_COINS);
+    putVarint(w, coinStore.count);
+    for (uint16_t r = 0; r < coinStore.count; r++)
+    {
+        const Coin &coin = coinStore.data[r];
+        size_t rec = openRecord(w);
+        putVarint(w, coin.value);
+        putFixed(w, coinStore.x[r], SAVE_FIXED_ONE);
+        putFixed(w, coinStore.y[r], SAVE_FIXED_ONE);
+        putFixed(w, coinStore.vx[r], SAVE_FIXED_ONE);
+        putFixed(w, coinStore.vy[r], SAVE_FIXED_ONE);
+        // The phase only feeds sinf(), and grows without bound
+        putFixed(w, fmodf(coin.floatOffset, 2.0f * (float)M_PI), SAVE_PHASE_ONE);
+        putAge(w, coin.spawnTime, now);
+        closeRecord(w, rec);
+    }
+    closeSection(w, at);
+}
+
+size_t saveEncode(uint8_t *buf, size_t cap, uint32_t serial)
+{
+    SaveWriter w = {buf, cap, 0, false};
+    unsigned long now = gameMillis();
+
+    for (uint8_t i = 0; i < sizeof(SAVE_MAGIC); i++)
+        putByte(w, SAVE_MAGIC[i]);
+    putByte(w, SAVE_VERSION);
+
+    saveWriteSerial(w, serial);
+    saveWriteGame(w);
+    saveWriteRng(w);
+    saveWriteFish(w, now);
+    saveWriteFood(w, now);
+    saveWriteCoins(w, now);
+    putByte(w, SAVE_END);
+
+    uint32_t crc = saveCrc32(0, buf, w.len);
+    for (uint8_t i = 0; i < 4; i++)
+        putByte(w, (uint8_t)(crc >> (i * 8)));
+
+    return w.full ? 0 : w.len;
+}
+
+// ============================================================================
+// READER
+// ============================================================================
+
+// Reads past the end come back as zeros, so a field an older writer didn't
+// have reads as 0
+struct SaveReader
+{
+    const uint8_t *buf;
+    size_t pos;
+    size_t end;
+};
+
+static uint8_t getByte(SaveReader &in)
+{
+    return in.pos < in.end ? in.buf[in.pos++] : 0;
+}
+
+static uint32_t getVarint(SaveReader &in)
+{
+    uint32_t v = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7)
+    {
+        uint8_t b = getByte(in);
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            break;
+    }
+    return v;
+}
+
+static int32_t getSigned(SaveReader &in)
+{
+    uint32_t v = getVarint(in);
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+static float getFixed(SaveReader &in, float one)
+{
+    return getSigned(in) / one;
+}
+
+static unsigned long getTime(SaveReader &in, unsigned long now)
+{
+    return now - getVarint(in);
+}
+
+// The next len bytes as a reader of their own; in moves past them
+static SaveReader getBlock(SaveReader &in, size_t len)
+{
+    SaveReader block = {in.buf, in.pos, min(in.pos + len, in.end)};
+    in.pos = block.end;
+    return block;
+}
+
+static void saveReadGame(SaveReader &in)
+{
+    game.coins = getVarint(in);
+    game.highScore = getVarint(in);
+    game.currentLevel = getVarint(in);
+    game.fishUnlocked = getVarint(in);
+    game.totalCoinsEarned = getVarint(in);
+    game.fishFed = getVarint(in);
+    game.fishLost = getVarint(in);
+    game.enemiesDefeated = getVarint(in);
+    game.bossesDefeated = getVarint(in);
+    game.playTime = getVarint(in);
+    uint32_t flags = getVarint(in);
+    game.soundEnabled = flags & SAVE_FLAG_SOUND;
+    game.tutorialComplete = flags & SAVE_FLAG_TUTORIAL;
+}
+
+static void saveReadRng(SaveReader &in)
+{
+    uint32_t state = 0;
+    for (uint8_t i = 0; i < 4; i++)
+        state |= (uint32_t)getByte(in) << (i * 8);
+    gameRandomSetState(state);
+}
+
+static void saveReadFish(SaveReader &in, unsigned long now)
+{
+    uint32_t count = getVarint(in);
+    for (uint32_t i = 0; i < count && in.pos < in.end; i++)
+    {
+        SaveReader rec = getBlock(in, getByte(in));
+        uint32_t species = getVarint(rec);
+        uint32_t stage = getVarint(rec);
+        uint32_t hunger = getVarint(rec);
+        uint32_t tint = getVarint(rec);
+        uint32_t frame = getVarint(rec);
+        bool facingRight = getVarint(rec);
+        float x = getFixed(rec, SAVE_FIXED_ONE);
+        float y = getFixed(rec, SAVE_FIXED_ONE);
+        if (species >= FISH_SPECIES_COUNT)
+            continue;
+
+        uint16_t r = fishStore.spawn(x, y);
+        if (r == ENTITY_NONE)
+            break;
+
+        Fish &fish = fishStore.data[r];
+        fish.species = (FishSpecies)species;
+        fish.growthStage = min(stage, (uint32_t)FISH_DATA[species].growthStages - 1);
+        fish.hunger = min(hunger, (uint32_t)FISH_HUNGER_MAX);
+        fish.tint = tint % FISH_TINTS;
+        fish.frame = frame;
+        fish.facingRight = facingRight;
+        fishStore.vx[r] = getFixed(rec, SAVE_FIXED_ONE);
+        fishStore.vy[r] = getFixed(rec, SAVE_FIXED_ONE);
+        fish.targetX = getFixed(rec, SAVE_FIXED_ONE);
+        fish.targetY = getFixed(rec, SAVE_FIXED_ONE);
+        fish.lastFed = getTime(rec, now);
+        fish.lastFrameTime = getTime(rec, now);
+        fish.lastCoinDrop = getTime(rec, now);
+    }
+}
+
+static void saveReadFood(SaveReader &in, unsigned long now)
+{
+    uint32_t count = getVarint(in);
+    for (uint32_t i = 0; i < count && in.pos < in.end; i++)
+    {
+        SaveReader rec = getBlock(in, getByte(in));
+        float x = getFixed(rec, SAVE_FIXED_ONE);
+        float y = getFixed(rec, SAVE_FIXED_ONE);
+
+        uint16_t r = foodStore.spawn(x, y);
+        if (r == ENTITY_NONE)
+            break;
+
+        foodStore.vx[r] = getFixed(rec, SAVE_FIXED_ONE);
+        foodStore.vy[r] = getFixed(rec, SAVE_FIXED_ONE);
+        foodStore.data[r].spawnTime = getTime(rec, now);
+    }
+}
+
+static void saveReadCoins(SaveReader &in, unsigned long now)
+{
+    uint32_t count = getVarint(in);
+    for (uint32_t i = 0; i < count && in.pos < in.end; i++)
+    {
+        SaveReader rec = getBlock(in, getByte(in));
+        uint32_t value = getVarint(rec);
+        float x = getFixed(rec, SAVE_FIXED_ONE);
+        float y = getFixed(rec, SAVE_FIXED_ONE);
+
+        uint16_t r = coinStore.spawn(x, y);
+        if (r == ENTITY_NONE)
+            break;
+
+        Coin &coin = coinStore.data[r];
+        coin.value = value;
+        coinStore.vx[r] = getFixed(rec, SAVE_FIXED_ONE);
+        coinStore.vy[r] = getFixed(rec, SAVE_FIXED_ONE);
+        coin.floatOffset = coin.prevFloatOffset = getFixed(rec, SAVE_PHASE_ONE);
+        coin.spawnTime = getTime(rec, now);
+    }
+}
+
+bool saveCheck(const uint8_t *buf, size_t len, uint32_t *serial)
+{
+    if (len < SAVE_HEADER_BYTES + 1 + SAVE_CRC_BYTES)
+        return false;
+    if (memcmp(buf, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0 || buf[4] == 0)
+        return false;
+
+    size_t body = len - SAVE_CRC_BYTES;
+    uint32_t crc = buf[body] | (uint32_t)buf[body + 1] << 8 |
+                   (uint32_t)buf[body + 2] << 16 | (uint32_t)buf[body + 3] << 24;
+    if (saveCrc32(0, buf, body) != crc)
+        return false;
+
+    // Sections must tile the body exactly, ending in SAVE_END
+    uint32_t found = 0;
+    size_t pos = SAVE_HEADER_BYTES;
+    while (pos < body && buf[pos] != SAVE_END)
+    {
+        if (pos + 3 > body)
+            return false;
+        size_t sectionLen = buf[pos + 1] | buf[pos + 2] << 8;
+        if (buf[pos] == SAVE_SERIAL && sectionLen >= 4 && pos + 7 <= body)
+        {
+            found = buf[pos + 3] | (uint32_t)buf[pos + 4] << 8 |
+                    (uint32_t)buf[pos + 5] << 16 | (uint32_t)buf[pos + 6] << 24;
+        }
+        pos += 3 + sectionLen;
+    }
+    if (pos + 1 != body)
+        return false;
+
+    if (serial)
+        *serial = found;
+    return true;
+}
+
+bool saveDecode(const uint8_t *buf, size_t len)
+{
+    if (!saveCheck(buf, len))
+        return false;
+
+    fishInit();
+    foodInit();
+    coinsInit();
+    particleInit();
+
+    unsigned long now = gameMillis();
+    SaveReader in = {buf, SAVE_HEADER_BYTES, len - SAVE_CRC_BYTES - 1};
+    while (in.pos < in.end)
+    {
+        uint8_t tag = getByte(in);
+        uint16_t sectionLen = getByte(in);
+        sectionLen |= getByte(in) << 8;
+        SaveReader section = getBlock(in, sectionLen);
+
+        switch (tag)
+        {
+        case SAVE_GAME:
+            saveReadGame(section);
+            break;
+        case SAVE_RNG:
+            saveReadRng(section);
+            break;
+        case SAVE_FISH:
+            saveReadFish(section, now);
+            break;
+        case SAVE_FOOD:
+            saveReadFood(section, now);
+            break;
+        case SAVE_COINS:
+            saveReadCoins(section, now);
+            break;
+        default:
+            break; // From a newer version
+        }
+    }
+    return true;
+}
@@ -0,0 +1,124 @@
+#include "save_writer.h"
+#include "sdcard.h"
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Low bits: buffer index. SAVE_FRESH: submitted but not yet written.
+#define SAVE_INDEX_MASK 0x03
+#define SAVE_FRESH 0x04
+
+static uint8_t saveBuffers[3][SAVE_MAX_BYTES];
+static size_t saveLens[3];
+
+// Buffer holding the latest submit (shared)
+static std::atomic<uint32_t> savePending(2);
+
+// Owned by the update task
+static uint8_t saveBack = 0;
+
+// Owned by the writer task
+static uint8_t saveFront = 1;
+static uint8_t newestSlot = SD_SAVE_SLOTS - 1; // First save goes to slot 0
+
+static std::atomic<uint32_t> writeCount(0);
+static std::atomic<uint32_t> coalescedCount(0);
+static std::atomic<uint32_t> failureCount(0);
+static TaskHandle_t writerTask = nullptr;
+
+// Write the latest submit, if there is one not yet written
+static void saveWritePending()
+{
+    if (!(savePending.load(std::memory_order_relaxed) & SAVE_FRESH))
+        return;
+
+    // Hand the written buffer back and take the fresh one
+    uint32_t prev = savePending.exchange(saveFront, std::memory_order_acq_rel);
+    saveFront = prev & SAVE_INDEX_MASK;
+
+    uint8_t slot = newestSlot ^ 1;
+#if DEBUG_SERIAL
+    uint32_t start = millis();
+#endif
+    if (!sdSaveGame(slot, saveBuffers[saveFront], saveLens[saveFront]))
+    {
+        // The other slot still holds the last good save
+        failureCount.fetch_add(1, std::memory_order_relaxed);
+#if DEBUG_SERIAL
+        Serial.println("Save: Write failed");
+#endif
+        return;
+    }
+    newestSlot = slot;
+    writeCount.fetch_add(1, std::memory_order_relaxed);
+#if DEBUG_SERIAL
+    Serial.print("Save: Slot ");
+    Serial.print((char)('A' + slot));
+    Serial.print(" written in ");
+    Serial.print(millis() - start);
+    Serial.println(" ms");
+#endif
+}
+
+// Sleeps until a save is submitted, writes it, then sleeps again
+static void saveWriterTask(void *param)
+{
+    (void)param;
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        saveWritePending();
+    }
+}
+
+void saveWriterStart()
+{
+    if (writerTask)
+        return;
+
+    xTaskCreatePinnedToCore(saveWriterTask, "save", SAVE_TASK_STACK, nullptr,
+                            SAVE_TASK_PRIORITY, &writerTask, SAVE_TASK_CORE);
+}
+
+uint8_t *saveWriterBuffer()
+{
+    return saveBuffers[saveBack];
+}
+
+void saveWriterSubmit(size_t len)
+{
+    saveLens[saveBack] = len;
+
+    // Release: the encoded bytes are visible to the writer. Take back
+    // whichever buffer was waiting; if it was never written, this save
+    // replaces it.
+    uint32_t prev = savePending.exchange(saveBack | SAVE_FRESH, std::memory_order_acq_rel);
+    saveBack = prev & SAVE_INDEX_MASK;
+    if (prev & SAVE_FRESH)
+        coalescedCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (writerTask)
+        xTaskNotifyGive(writerTask);
+    else
+        saveWritePending();
+}
+
+void saveWriterSetNewest(uint8_t slot)
+{
+    newestSlot = slot;
+}
+
+uint32_t saveWriterWrites()
+{
+    return writeCount.load(std::memory_order_relaxed);
+}
+
+uint32_t saveWriterCoalesced()
+{
+    return coalescedCount.load(std::memory_order_relaxed);
+}
+
+uint32_t saveWriterFailures()
+{
+    return failureCount.load(std::memory_order_relaxed);
+}
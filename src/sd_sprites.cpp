@@ -3,8 +3,71 @@
 #include "graphics.h"
 #include "config.h"
 #include <Arduino.h>
+#include <SD.h>
 #include <string.h>
 
+// Widest sprite row the flipped draw can mirror in one pass (screen width)
+#define SPRITE_MAX_ROW 320
+
+// .i4 file: "SPI4", uint16 width, uint16 height, uint8 palette entries
+// (0 = shared palette), uint8 reserved, palette (RGB565 LE), then rows of
+// packed indices. All little-endian.
+#define SPRITE_I4_MAGIC "SPI4"
+#define SPRITE_I4_HEADER 10
+
+// Sprite pack (see spritePackLoad)
+#define SPRITE_PACK_MAGIC "BHPK"
+#define SPRITE_PACK_VERSION 1
+#define SPRITE_PACK_HEADER 16
+
+// One table entry, as stored in the file (16 bytes, naturally aligned)
+struct SpritePackEntry
+{
+    uint32_t hash;
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;
+    uint8_t colors;
+    uint16_t reserved;
+    uint32_t offset; // From the start of the data section
+};
+
+// Palette for indexed sprites that don't carry their own
+static uint16_t sharedPalette[SPRITE_PALETTE_SIZE];
+
+// Loaded pack: one block of [Sprite x count][table][data]
+static uint8_t *packBlock = nullptr;
+static Sprite *packSprites = nullptr;
+static const SpritePackEntry *packTable = nullptr;
+static uint16_t packCount = 0;
+
+// Bytes per row of packed 4-bit indices
+static inline uint32_t spriteIndexStride(const Sprite *sprite)
+{
+    return (sprite->width + 1) / 2;
+}
+
+// Palette index of pixel px in a row of packed indices
+static inline uint8_t spriteIndexAt(const uint8_t *row, uint16_t px)
+{
+    uint8_t pair = row[px >> 1];
+    return (px & 1) ? (pair & 0x0F) : (pair >> 4);
+}
+
+static inline bool spriteHasPixels(const Sprite *sprite)
+{
+    return sprite && (sprite->format == SPRITE_FMT_INDEXED4 ? sprite->indices != nullptr
+                                                            : sprite->data != nullptr);
+}
+
+// Color of pixel (px, py), whatever the format (span building only)
+static inline uint16_t spritePixel(const Sprite *sprite, uint16_t px, uint16_t py)
+{
+    if (sprite->format == SPRITE_FMT_INDEXED4)
+        return sprite->palette[spriteIndexAt(sprite->indices + py * spriteIndexStride(sprite), px)];
+    return sprite->data[(uint32_t)py * sprite->width + px];
+}
+
 void spriteInit()
 {
 #if DEBUG_SERIAL
@@ -59,6 +122,17 @@ Sprite *spriteLoad(const char *path, uint16_t width, uint16_t height)
     sprite->height = height;
     sprite->data = buffer;
     sprite->name = strdup(path);
+    sprite->format = SPRITE_FMT_RGB565;
+    sprite->indices = nullptr;
+    sprite->palette = nullptr;
+    sprite->spans = nullptr;
+    sprite->rowSpans = nullptr;
+    sprite->spanKey = SPRITE_KEY_COLOR;
+    sprite->packed = false;
+
+    // Precompute opaque runs so transparent draws don't walk every pixel.
+    // Failure just means draws fall back to building them on demand.
+    spriteBuildSpans(sprite, SPRITE_KEY_COLOR);
 
 #if DEBUG_SERIAL
     Serial.print("Loaded sprite: ");
@@ -73,9 +147,579 @@ Sprite *spriteLoad(const char *path, uint16_t width, uint16_t height)
     return sprite;
 }
 
+Sprite *spriteCreate(uint16_t width, uint16_t height)
+{
+    uint16_t *buffer = (uint16_t *)malloc((size_t)width * height * 2);
+    Sprite *sprite = (Sprite *)malloc(sizeof(Sprite));
+    if (!buffer || !sprite)
+    {
+#if DEBUG_SERIAL
+        Serial.println("Failed to allocate RAM for sprite data");
+#endif
+        free(buffer);
+        free(sprite);
+        return nullptr;
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)width * height; i++)
+        buffer[i] = SPRITE_KEY_COLOR;
+
+    sprite->width = width;
+    sprite->height = height;
+    sprite->data = buffer;
+    sprite->name = nullptr;
+    sprite->format = SPRITE_FMT_RGB565;
+    sprite->indices = nullptr;
+    sprite->palette = nullptr;
+    sprite->spans = nullptr;
+    sprite->rowSpans = nullptr;
+    sprite->spanKey = SPRITE_KEY_COLOR;
+    sprite->packed = false;
+    return sprite;
+}
+
+Sprite *spriteLoadIndexed(const char *path)
+{
+    if (!sdIsReady())
+        return nullptr;
+
+    File file = SD.open(path, FILE_READ);
+    if (!file)
+    {
+#if DEBUG_SERIAL
+        Serial.print("SD: Failed to open ");
+        Serial.println(path);
+#endif
+        return nullptr;
+    }
+
+    uint8_t header[SPRITE_I4_HEADER];
+    if (file.read(header, sizeof(header)) != sizeof(header) ||
+        memcmp(header, SPRITE_I4_MAGIC, 4) != 0 || header[8] > SPRITE_PALETTE_SIZE)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Not an indexed sprite: ");
+        Serial.println(path);
+#endif
+        file.close();
+        return nullptr;
+    }
+
+    uint16_t width = header[4] | (header[5] << 8);
+    uint16_t height = header[6] | (header[7] << 8);
+    uint8_t colors = header[8];
+
+    // One block: own palette (all 16 entries, unused ones black), then indices
+    size_t paletteBytes = colors ? SPRITE_PALETTE_SIZE * sizeof(uint16_t) : 0;
+    size_t indexBytes = (size_t)(width + 1) / 2 * height;
+    uint8_t *block = (uint8_t *)calloc(1, paletteBytes + indexBytes);
+    Sprite *sprite = (Sprite *)malloc(sizeof(Sprite));
+    if (!block || !sprite)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to allocate RAM for sprite data: ");
+        Serial.println(path);
+#endif
+        free(block);
+        free(sprite);
+        file.close();
+        return nullptr;
+    }
+
+    size_t want = colors * sizeof(uint16_t);
+    bool ok = file.read(block, want) == want &&
+              file.read(block + paletteBytes, indexBytes) == indexBytes;
+    file.close();
+    if (!ok)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to read sprite from SD: ");
+        Serial.println(path);
+#endif
+        free(block);
+        free(sprite);
+        return nullptr;
+    }
+
+    sprite->width = width;
+    sprite->height = height;
+    sprite->data = nullptr;
+    sprite->name = strdup(path);
+    sprite->format = SPRITE_FMT_INDEXED4;
+    sprite->indices = block + paletteBytes;
+    sprite->palette = colors ? (const uint16_t *)block : sharedPalette;
+    sprite->spans = nullptr;
+    sprite->rowSpans = nullptr;
+    sprite->spanKey = SPRITE_KEY_COLOR;
+    sprite->packed = false;
+
+    spriteBuildSpans(sprite, SPRITE_KEY_COLOR);
+
+#if DEBUG_SERIAL
+    Serial.print("Loaded sprite: ");
+    Serial.print(path);
+    Serial.print(" (");
+    Serial.print(width);
+    Serial.print("x");
+    Serial.print(height);
+    Serial.println(", 4bpp)");
+#endif
+
+    return sprite;
+}
+
+Sprite *spriteCopyRegion(const Sprite *src, uint16_t x, uint16_t width, bool mirror)
+{
+    if (!spriteHasPixels(src) || width == 0 || x + width > src->width)
+        return nullptr;
+
+    const uint16_t h = src->height;
+    bool indexed = src->format == SPRITE_FMT_INDEXED4;
+    bool ownPalette = indexed && src->palette != sharedPalette;
+
+    // Same block layouts as the loaders, so spriteUnload frees it the same way
+    size_t paletteBytes = ownPalette ? SPRITE_PALETTE_SIZE * sizeof(uint16_t) : 0;
+    size_t pixelBytes = indexed ? (size_t)(width + 1) / 2 * h : (size_t)width * h * 2;
+    uint8_t *block = (uint8_t *)calloc(1, paletteBytes + pixelBytes);
+    Sprite *sprite = (Sprite *)malloc(sizeof(Sprite));
+    if (!block || !sprite)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to allocate RAM for sprite copy: ");
+        Serial.println(src->name ? src->name : "unknown");
+#endif
+        free(block);
+        free(sprite);
+        return nullptr;
+    }
+
+    sprite->width = width;
+    sprite->height = h;
+    sprite->name = nullptr;
+    sprite->format = src->format;
+    sprite->spans = nullptr;
+    sprite->rowSpans = nullptr;
+    sprite->spanKey = src->spanKey;
+    sprite->packed = false;
+
+    if (indexed)
+    {
+        if (ownPalette)
+            memcpy(block, src->palette, paletteBytes);
+        sprite->data = nullptr;
+        sprite->indices = block + paletteBytes;
+        sprite->palette = ownPalette ? (const uint16_t *)block : sharedPalette;
+
+        uint32_t srcStride = spriteIndexStride(src);
+        uint32_t dstStride = spriteIndexStride(sprite);
+        for (uint16_t py = 0; py < h; py++)
+        {
+            const uint8_t *in = src->indices + py * srcStride;
+            uint8_t *out = sprite->indices + py * dstStride;
+            for (uint16_t px = 0; px < width; px++)
+            {
+                uint8_t index = spriteIndexAt(in, x + (mirror ? width - 1 - px : px));
+                out[px >> 1] |= (px & 1) ? index : index << 4;
+            }
+        }
+    }
+    else
+    {
+        sprite->data = (uint16_t *)block;
+        sprite->indices = nullptr;
+        sprite->palette = nullptr;
+
+        for (uint16_t py = 0; py < h; py++)
+        {
+            const uint16_t *in = src->data + (uint32_t)py * src->width + x;
+            uint16_t *out = sprite->data + (uint32_t)py * width;
+            for (uint16_t px = 0; px < width; px++)
+                out[px] = in[mirror ? width - 1 - px : px];
+        }
+    }
+
+    spriteBuildSpans(sprite, sprite->spanKey);
+    return sprite;
+}
+
+// Box-filtered RGB565 pixel (dx, dy) of src scaled to dw x dh: every source
+// pixel the destination pixel covers, weighted by overlap. Mostly
+// transparent coverage stays transparent; the rest averages the opaque
+// pixels only, so the key color never bleeds into edges.
+static uint16_t spriteBoxPixel(const Sprite *src, uint16_t dx, uint16_t dy, uint16_t dw, uint16_t dh)
+{
+    float x0 = (float)dx * src->width / dw, x1 = (float)(dx + 1) * src->width / dw;
+    float y0 = (float)dy * src->height / dh, y1 = (float)(dy + 1) * src->height / dh;
+
+    float r = 0, g = 0, b = 0, opaque = 0, total = 0;
+    for (uint16_t sy = (uint16_t)y0; sy < src->height && sy < y1; sy++)
+    {
+        float wy = min(y1, sy + 1.0f) - max(y0, (float)sy);
+        for (uint16_t sx = (uint16_t)x0; sx < src->width && sx < x1; sx++)
+        {
+            float w = wy * (min(x1, sx + 1.0f) - max(x0, (float)sx));
+            uint16_t c = src->data[(uint32_t)sy * src->width + sx];
+            total += w;
+            if (c == src->spanKey)
+                continue;
+            r += w * ((c >> 11) & 0x1F);
+            g += w * ((c >> 5) & 0x3F);
+            b += w * (c & 0x1F);
+            opaque += w;
+        }
+    }
+
+    if (opaque * 2 < total)
+        return src->spanKey;
+
+    uint16_t c = ((uint16_t)(r / opaque + 0.5f) << 11) | ((uint16_t)(g / opaque + 0.5f) << 5) |
+                 (uint16_t)(b / opaque + 0.5f);
+    return c == src->spanKey ? c ^ 1 : c; // An average that lands on the key stays visible
+}
+
+Sprite *spriteScale(const Sprite *src, uint16_t width, uint16_t height, bool smooth)
+{
+    if (!spriteHasPixels(src) || width == 0 || height == 0)
+        return nullptr;
+
+    // Same block layout as spriteCopyRegion
+    bool indexed = src->format == SPRITE_FMT_INDEXED4;
+    bool ownPalette = indexed && src->palette != sharedPalette;
+    size_t paletteBytes = ownPalette ? SPRITE_PALETTE_SIZE * sizeof(uint16_t) : 0;
+    size_t pixelBytes = indexed ? (size_t)(width + 1) / 2 * height : (size_t)width * height * 2;
+    uint8_t *block = (uint8_t *)calloc(1, paletteBytes + pixelBytes);
+    Sprite *sprite = (Sprite *)malloc(sizeof(Sprite));
+    if (!block || !sprite)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to allocate RAM for scaled sprite: ");
+        Serial.println(src->name ? src->name : "unknown");
+#endif
+        free(block);
+        free(sprite);
+        return nullptr;
+    }
+
+    sprite->width = width;
+    sprite->height = height;
+    sprite->name = nullptr;
+    sprite->format = src->format;
+    sprite->spans = nullptr;
+    sprite->rowSpans = nullptr;
+    sprite->spanKey = src->spanKey;
+    sprite->packed = false;
+
+    if (indexed)
+    {
+        // Indices can't be averaged: nearest neighbour
+        if (ownPalette)
+            memcpy(block, src->palette, paletteBytes);
+        sprite->data = nullptr;
+        sprite->indices = block + paletteBytes;
+        sprite->palette = ownPalette ? (const uint16_t *)block : sharedPalette;
+
+        uint32_t srcStride = spriteIndexStride(src);
+        uint32_t dstStride = spriteIndexStride(sprite);
+        for (uint16_t py = 0; py < height; py++)
+        {
+            const uint8_t *in = src->indices + ((2 * py + 1) * src->height / (2 * height)) * srcStride;
+            uint8_t *out = sprite->indices + py * dstStride;
+            for (uint16_t px = 0; px < width; px++)
+            {
+                uint8_t index = spriteIndexAt(in, (2 * px + 1) * src->width / (2 * width));
+                out[px >> 1] |= (px & 1) ? index : index << 4;
+            }
+        }
+    }
+    else
+    {
+        sprite->data = (uint16_t *)block;
+        sprite->indices = nullptr;
+        sprite->palette = nullptr;
+
+        for (uint16_t py = 0; py < height; py++)
+        {
+            uint16_t *out = sprite->data + (uint32_t)py * width;
+            const uint16_t *in = src->data + ((2 * py + 1) * src->height / (2 * height)) * src->width;
+            for (uint16_t px = 0; px < width; px++)
+            {
+                out[px] = smooth ? spriteBoxPixel(src, px, py, width, height)
+                                 : in[(2 * px + 1) * src->width / (2 * width)];
+            }
+        }
+    }
+
+    spriteBuildSpans(sprite, sprite->spanKey);
+    return sprite;
+}
+
+void spriteSetSharedPalette(const uint16_t *lut)
+{
+    memcpy(sharedPalette, lut, sizeof(sharedPalette));
+}
+
+bool spriteLoadSharedPalette(const char *path)
+{
+    uint16_t lut[SPRITE_PALETTE_SIZE];
+    if (sdReadFile(path, (uint8_t *)lut, sizeof(lut)) != (int32_t)sizeof(lut))
+        return false;
+
+    spriteSetSharedPalette(lut);
+    return true;
+}
+
+// FNV-1a, matching tools/pack_sprites.py
+static uint32_t spriteNameHash(const char *name)
+{
+    uint32_t hash = 2166136261UL;
+    while (*name)
+    {
+        hash ^= (uint8_t)*name++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+bool spritePackLoad(const char *path)
+{
+    spritePackUnload();
+    if (!sdIsReady())
+        return false;
+
+    File file = SD.open(path, FILE_READ);
+    if (!file)
+    {
+#if DEBUG_SERIAL
+        Serial.print("SD: Failed to open ");
+        Serial.println(path);
+#endif
+        return false;
+    }
+
+    uint8_t header[SPRITE_PACK_HEADER] = {0};
+    bool ok = file.read(header, sizeof(header)) == sizeof(header) &&
+              memcmp(header, SPRITE_PACK_MAGIC, 4) == 0 &&
+              (header[4] | (header[5] << 8)) == SPRITE_PACK_VERSION;
+    uint16_t count = header[6] | (header[7] << 8);
+    uint32_t dataBytes = header[8] | (header[9] << 8) | ((uint32_t)header[10] << 16) |
+                         ((uint32_t)header[11] << 24);
+    size_t tableBytes = (size_t)count * sizeof(SpritePackEntry);
+    if (!ok || count == 0 || file.size() != SPRITE_PACK_HEADER + tableBytes + dataBytes)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Not a sprite pack: ");
+        Serial.println(path);
+#endif
+        file.close();
+        return false;
+    }
+
+    // Sprite structs first keep the table and data aligned; the rest of the
+    // file lands behind them in one read
+    size_t spriteBytes = (size_t)count * sizeof(Sprite);
+    uint8_t *block = (uint8_t *)malloc(spriteBytes + tableBytes + dataBytes);
+    if (!block)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to allocate RAM for sprite pack: ");
+        Serial.println(path);
+#endif
+        file.close();
+        return false;
+    }
+
+    ok = file.read(block + spriteBytes, tableBytes + dataBytes) == tableBytes + dataBytes;
+    file.close();
+
+    Sprite *sprites = (Sprite *)block;
+    const SpritePackEntry *table = (const SpritePackEntry *)(block + spriteBytes);
+    uint8_t *data = block + spriteBytes + tableBytes;
+
+    for (uint16_t i = 0; ok && i < count; i++)
+    {
+        const SpritePackEntry &e = table[i];
+        bool indexed = e.format == SPRITE_FMT_INDEXED4;
+        size_t paletteBytes = e.colors * sizeof(uint16_t);
+        size_t pixelBytes = indexed ? (size_t)(e.width + 1) / 2 * e.height
+                                    : (size_t)e.width * e.height * 2;
+
+        if ((e.format != SPRITE_FMT_RGB565 && !indexed) ||
+            (e.colors != 0 && (!indexed || e.colors != SPRITE_PALETTE_SIZE)) ||
+            (e.offset & 3) != 0 || e.offset > dataBytes ||
+            paletteBytes + pixelBytes > dataBytes - e.offset ||
+            (i > 0 && e.hash <= table[i - 1].hash))
+        {
+            ok = false;
+            break;
+        }
+
+        Sprite &sprite = sprites[i];
+        sprite.width = e.width;
+        sprite.height = e.height;
+        sprite.data = indexed ? nullptr : (uint16_t *)(data + e.offset);
+        sprite.name = nullptr;
+        sprite.format = e.format;
+        sprite.indices = indexed ? data + e.offset + paletteBytes : nullptr;
+        sprite.palette = !indexed ? nullptr
+                         : e.colors ? (const uint16_t *)(data + e.offset)
+                                    : sharedPalette;
+        sprite.spans = nullptr;
+        sprite.rowSpans = nullptr;
+        sprite.spanKey = SPRITE_KEY_COLOR;
+        sprite.packed = true;
+    }
+
+    if (!ok)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Bad sprite pack: ");
+        Serial.println(path);
+#endif
+        free(block);
+        return false;
+    }
+
+    packBlock = block;
+    packSprites = sprites;
+    packTable = table;
+    packCount = count;
+
+    for (uint16_t i = 0; i < count; i++)
+        spriteBuildSpans(&packSprites[i], SPRITE_KEY_COLOR);
+
+#if DEBUG_SERIAL
+    Serial.print("Loaded sprite pack: ");
+    Serial.print(path);
+    Serial.print(" (");
+    Serial.print(count);
+    Serial.print(" sprites, ");
+    Serial.print(tableBytes + dataBytes);
+    Serial.println(" bytes)");
+#endif
+
+    return true;
+}
+
+int16_t spritePackFind(const char *name)
+{
+    uint32_t hash = spriteNameHash(name);
+    int32_t lo = 0;
+    int32_t hi = (int32_t)packCount - 1;
+    while (lo <= hi)
+    {
+        int32_t mid = (lo + hi) / 2;
+        if (packTable[mid].hash == hash)
+            return (int16_t)mid;
+        if (packTable[mid].hash < hash)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return SPRITE_PACK_NONE;
+}
+
+Sprite *spritePackGet(int16_t id)
+{
+    if (id < 0 || id >= (int16_t)packCount)
+        return nullptr;
+    return &packSprites[id];
+}
+
+uint16_t spritePackCount()
+{
+    return packCount;
+}
+
+void spritePackUnload()
+{
+    for (uint16_t i = 0; i < packCount; i++)
+    {
+        free(packSprites[i].spans);
+        free(packSprites[i].rowSpans);
+    }
+    free(packBlock);
+    packBlock = nullptr;
+    packSprites = nullptr;
+    packTable = nullptr;
+    packCount = 0;
+}
+
+bool spriteBuildSpans(Sprite *sprite, uint16_t transparentColor)
+{
+    if (!spriteHasPixels(sprite))
+        return false;
+
+    if (sprite->spans && sprite->spanKey == transparentColor)
+        return true;
+
+    const uint16_t w = sprite->width;
+    const uint16_t h = sprite->height;
+
+    // First pass: count runs so the table is a single exact allocation
+    uint32_t count = 0;
+    for (uint16_t py = 0; py < h; py++)
+    {
+        bool inRun = false;
+        for (uint16_t px = 0; px < w; px++)
+        {
+            bool opaque = spritePixel(sprite, px, py) != transparentColor;
+            if (opaque && !inRun)
+                count++;
+            inRun = opaque;
+        }
+    }
+
+    // Offsets are 16-bit; a pathological checkerboard could overflow them
+    if (count > 0xFFFF)
+        return false;
+
+    SpriteSpan *spans = (SpriteSpan *)malloc(count ? count * sizeof(SpriteSpan) : sizeof(SpriteSpan));
+    uint16_t *rowSpans = (uint16_t *)malloc(((uint32_t)h + 1) * sizeof(uint16_t));
+    if (!spans || !rowSpans)
+    {
+#if DEBUG_SERIAL
+        Serial.print("Failed to allocate sprite spans: ");
+        Serial.println(sprite->name ? sprite->name : "unknown");
+#endif
+        free(spans);
+        free(rowSpans);
+        return false;
+    }
+
+    // Second pass: record runs row by row
+    uint16_t n = 0;
+    for (uint16_t py = 0; py < h; py++)
+    {
+        rowSpans[py] = n;
+        uint16_t px = 0;
+        while (px < w)
+        {
+            while (px < w && spritePixel(sprite, px, py) == transparentColor)
+                px++;
+            if (px >= w)
+                break;
+            uint16_t start = px;
+            while (px < w && spritePixel(sprite, px, py) != transparentColor)
+                px++;
+            spans[n].x = start;
+            spans[n].len = px - start;
+            n++;
+        }
+    }
+    rowSpans[h] = n;
+
+    free(sprite->spans);
+    free(sprite->rowSpans);
+    sprite->spans = spans;
+    sprite->rowSpans = rowSpans;
+    sprite->spanKey = transparentColor;
+    return true;
+}
+
 void spriteUnload(Sprite *sprite)
 {
-    if (!sprite)
+    // Packed sprites go with the pack (spritePackUnload)
+    if (!sprite || sprite->packed)
         return;
 
 #if DEBUG_SERIAL
@@ -85,63 +729,247 @@ void spriteUnload(Sprite *sprite)
 
     if (sprite->data)
         free(sprite->data);
+    if (sprite->indices)
+    {
+        // Own palette and indices share one block, palette first
+        bool ownPalette = sprite->palette != sharedPalette;
+        free(ownPalette ? (void *)sprite->palette : (void *)sprite->indices);
+    }
     if (sprite->name)
         free(sprite->name);
+    free(sprite->spans);
+    free(sprite->rowSpans);
     free(sprite);
 }
 
+// Expand len indices starting at pixel px of a packed row through a LUT,
+// optionally right to left (flipped draws)
+static void spriteExpandIndices(uint16_t *out, const uint8_t *row, uint16_t px, uint16_t len,
+                                const uint16_t *lut, bool reverse)
+{
+    if (reverse)
+    {
+        for (uint16_t k = len; k > 0; k--)
+            *out++ = lut[spriteIndexAt(row, px + k - 1)];
+        return;
+    }
+
+    uint16_t k = 0;
+    // Odd start: take the low nibble alone, then whole bytes two at a time
+    if ((px & 1) && k < len)
+        out[k++] = lut[row[px >> 1] & 0x0F];
+    const uint8_t *pair = row + ((px + k) >> 1);
+    for (; k + 1 < len; k += 2, pair++)
+    {
+        out[k] = lut[*pair >> 4];
+        out[k + 1] = lut[*pair & 0x0F];
+    }
+    if (k < len)
+        out[k] = lut[*pair >> 4];
+}
+
 void spriteDraw(Sprite *sprite, int16_t x, int16_t y)
 {
-    if (!sprite || !sprite->data)
+    if (!spriteHasPixels(sprite))
         return;
 
     // Enable byte swapping for raw RGB565 data
     // (verified in CYD tester project as necessary for correct colors)
     tft.setSwapBytes(true);
+
+    if (sprite->format == SPRITE_FMT_INDEXED4)
+    {
+        // Expand row by row; palettes hold the same LE RGB565 as .raw files
+        static uint16_t line[SPRITE_MAX_ROW];
+        if (sprite->width > SPRITE_MAX_ROW)
+            return;
+        uint32_t stride = spriteIndexStride(sprite);
+        tft.startWrite();
+        for (uint16_t py = 0; py < sprite->height; py++)
+        {
+            spriteExpandIndices(line, sprite->indices + py * stride, 0, sprite->width,
+                                sprite->palette, false);
+            tft.pushImage(x, y + py, sprite->width, 1, line);
+        }
+        tft.endWrite();
+        return;
+    }
+
     tft.pushImage(x, y, sprite->width, sprite->height, sprite->data);
 }
 
-void spriteDrawTransparent(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor)
+static inline uint16_t spriteTintPixel(const SpriteTint &tint, uint16_t c)
 {
-    if (!sprite || !sprite->data)
+    return tint.r[c >> 11] | tint.g[(c >> 5) & 0x3F] | tint.b[c & 0x1F];
+}
+
+// One channel value through gain, then lifted toward full
+static uint16_t spriteTintChannel(uint8_t v, float gain, float lift, uint8_t full)
+{
+    float out = min((float)full, v * gain);
+    out += (full - out) * lift;
+    return (uint16_t)(out + 0.5f);
+}
+
+void spriteTintBuild(SpriteTint &tint, float rGain, float gGain, float bGain, float lift, bool swapRB)
+{
+    for (uint8_t v = 0; v < 32; v++)
+    {
+        uint16_t r = spriteTintChannel(v, rGain, lift, 31);
+        uint16_t b = spriteTintChannel(v, bGain, lift, 31);
+        tint.r[v] = swapRB ? r : r << 11;
+        tint.b[v] = swapRB ? b << 11 : b;
+    }
+    for (uint8_t v = 0; v < 64; v++)
+        tint.g[v] = spriteTintChannel(v, gGain, lift, 63) << 5;
+}
+
+// Push every opaque run of the rows that land inside dst. Works for the
+// panel and for TFT_eSprite strips alike (pushImage is resolved statically).
+template <class Target>
+static void spriteDrawSpans(Target &dst, Sprite *sprite, int16_t x, int16_t y, bool flip,
+                            const SpriteTint *tint = nullptr)
+{
+    // Spans mirror around the sprite centre when flipped; each run is
+    // reversed into a line buffer so it can still go out as one burst
+    static uint16_t line[SPRITE_MAX_ROW];
+
+    int16_t first = y < 0 ? -y : 0;
+    int16_t last = min((int32_t)sprite->height, (int32_t)dst.height() - y);
+
+    // Indexed runs expand through the palette into the line buffer. A tint
+    // only recolours the 16 palette entries, so pixels cost the same.
+    if (sprite->format == SPRITE_FMT_INDEXED4)
+    {
+        uint16_t tinted[SPRITE_PALETTE_SIZE];
+        const uint16_t *lut = sprite->palette;
+        if (tint)
+        {
+            for (uint8_t i = 0; i < SPRITE_PALETTE_SIZE; i++)
+                tinted[i] = spriteTintPixel(*tint, sprite->palette[i]);
+            lut = tinted;
+        }
+
+        uint32_t stride = spriteIndexStride(sprite);
+        for (int16_t py = first; py < last; py++)
+        {
+            const uint8_t *row = sprite->indices + py * stride;
+            for (uint16_t i = sprite->rowSpans[py]; i < sprite->rowSpans[py + 1]; i++)
+            {
+                const SpriteSpan &span = sprite->spans[i];
+                spriteExpandIndices(line, row, span.x, span.len, lut, flip);
+                int16_t dx = flip ? sprite->width - span.x - span.len : span.x;
+                dst.pushImage(x + dx, y + py, span.len, 1, line);
+            }
+        }
         return;
+    }
 
-    // Pixel-by-pixel rendering for transparency support
-    // Note: This is slower than pushImage, use sparingly
-    for (int16_t py = 0; py < sprite->height; py++)
+    for (int16_t py = first; py < last; py++)
     {
-        for (int16_t px = 0; px < sprite->width; px++)
+        const uint16_t *row = sprite->data + (uint32_t)py * sprite->width;
+        for (uint16_t i = sprite->rowSpans[py]; i < sprite->rowSpans[py + 1]; i++)
         {
-            uint16_t pixel = sprite->data[py * sprite->width + px];
-            if (pixel != transparentColor)
+            const SpriteSpan &span = sprite->spans[i];
+            if (tint)
+            {
+                // Each pixel goes through the tint's channel tables
+                if (flip)
+                {
+                    const uint16_t *src = row + span.x + span.len - 1;
+                    for (uint16_t k = 0; k < span.len; k++)
+                        line[k] = spriteTintPixel(*tint, *src--);
+                }
+                else
+                {
+                    const uint16_t *src = row + span.x;
+                    for (uint16_t k = 0; k < span.len; k++)
+                        line[k] = spriteTintPixel(*tint, src[k]);
+                }
+                int16_t dx = flip ? sprite->width - span.x - span.len : span.x;
+                dst.pushImage(x + dx, y + py, span.len, 1, line);
+            }
+            else if (flip)
             {
-                // Byte swap for drawPixel (since setSwapBytes only affects pushImage)
-                uint16_t swapped = (pixel >> 8) | (pixel << 8);
-                tft.drawPixel(x + px, y + py, swapped);
+                const uint16_t *src = row + span.x + span.len - 1;
+                for (uint16_t k = 0; k < span.len; k++)
+                    line[k] = *src--;
+                int16_t dx = sprite->width - span.x - span.len;
+                dst.pushImage(x + dx, y + py, span.len, 1, line);
+            }
+            else
+            {
+                dst.pushImage(x + span.x, y + py, span.len, 1, (uint16_t *)(row + span.x));
             }
         }
     }
 }
 
+void spriteDrawTransparent(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor)
+{
+    if (!spriteHasPixels(sprite))
+        return;
+
+    if (sprite->format == SPRITE_FMT_INDEXED4 && sprite->width > SPRITE_MAX_ROW)
+        return;
+
+    if (!spriteBuildSpans(sprite, transparentColor))
+        return;
+
+    // One address window + burst per opaque run; pushImage clips to the screen
+    tft.setSwapBytes(true);
+    tft.startWrite();
+    spriteDrawSpans(tft, sprite, x, y, false);
+    tft.endWrite();
+}
+
 void spriteDrawTransparentFlip(Sprite *sprite, int16_t x, int16_t y, uint16_t transparentColor)
 {
-    if (!sprite || !sprite->data)
+    if (!spriteHasPixels(sprite))
         return;
 
-    // Pixel-by-pixel rendering with X-flip
-    for (int16_t py = 0; py < sprite->height; py++)
+    if (sprite->width > SPRITE_MAX_ROW || !spriteBuildSpans(sprite, transparentColor))
+        return;
+
+    tft.setSwapBytes(true);
+    tft.startWrite();
+    spriteDrawSpans(tft, sprite, x, y, true);
+    tft.endWrite();
+}
+
+void spriteDrawTransparentTo(TFT_eSprite &dst, Sprite *sprite, int16_t x, int16_t y,
+                             bool flip, uint16_t transparentColor)
+{
+    if (!spriteHasPixels(sprite))
+        return;
+
+    // Flipped and indexed runs go through the line buffer
+    if ((flip || sprite->format == SPRITE_FMT_INDEXED4) && sprite->width > SPRITE_MAX_ROW)
+        return;
+
+    if (!spriteBuildSpans(sprite, transparentColor))
+        return;
+
+    // Raw SD data (and palettes) are little-endian RGB565, same as for the panel
+    dst.setSwapBytes(true);
+    spriteDrawSpans(dst, sprite, x, y, flip);
+}
+
+void spriteDrawTintedTo(TFT_eSprite &dst, Sprite *sprite, int16_t x, int16_t y,
+                        const SpriteTint *tint, bool flip)
+{
+    if (!tint)
     {
-        for (int16_t px = 0; px < sprite->width; px++)
-        {
-            // Get pixel from UNFLIPPED data
-            uint16_t pixel = sprite->data[py * sprite->width + px];
-            if (pixel != transparentColor)
-            {
-                // Swap bytes
-                uint16_t swapped = (pixel >> 8) | (pixel << 8);
-                // Draw AT FLIPPED POSITION (width - 1 - px)
-                tft.drawPixel(x + (sprite->width - 1 - px), y + py, swapped);
-            }
-        }
+        spriteDrawTransparentTo(dst, sprite, x, y, flip);
+        return;
     }
+
+    if (!spriteHasPixels(sprite) || sprite->width > SPRITE_MAX_ROW)
+        return;
+
+    if (!spriteBuildSpans(sprite, SPRITE_KEY_COLOR))
+        return;
+
+    dst.setSwapBytes(true);
+    spriteDrawSpans(dst, sprite, x, y, flip, tint);
 }
@@ -129,10 +129,48 @@ bool sdDeleteFile(const char* path) {
 // GAME DATA
 // ============================================================================
 
-bool sdSaveGame(const void* data, size_t len) {
-    return sdWriteFile("/save/game.dat", (const uint8_t*)data, len) == (int32_t)len;
+static const char* const savePaths[SD_SAVE_SLOTS + 1] = {
+    "/save/game_a.dat",
+    "/save/game_b.dat",
+    "/save/game.tmp",  // SD_SAVE_TEMP
+};
+
+bool sdSaveGame(uint8_t slot, const void* data, size_t len) {
+    if (!sdReady || slot >= SD_SAVE_SLOTS) return false;
+
+    const char* tmp = savePaths[SD_SAVE_TEMP];
+    File file = SD.open(tmp, FILE_WRITE);
+    if (!file) {
+#if DEBUG_SERIAL
+        Serial.print("SD: Failed to create ");
+        Serial.println(tmp);
+#endif
+        return false;
+    }
+
+    // Whole and on the card before it takes the slot's name
+    size_t bytesWritten = file.write((const uint8_t*)data, len);
+    file.flush();
+    file.close();
+    if (bytesWritten != len) {
+        SD.remove(tmp);
+        return false;
+    }
+
+    // FAT won't rename over a file. Until the rename lands the slot is
+    // missing, but the temp file is whole and the other slot still is.
+    const char* path = savePaths[slot];
+    if (SD.exists(path)) {
+        SD.remove(path);
+    }
+    return SD.rename(tmp, path);
+}
+
+int32_t sdLoadGame(uint8_t slot, void* data, size_t maxLen) {
+    if (!sdSaveExists(slot)) return -1;
+    return sdReadFile(savePaths[slot], (uint8_t*)data, maxLen);
 }
 
-bool sdLoadGame(void* data, size_t len) {
-    return sdReadFile("/save/game.dat", (uint8_t*)data, len) == (int32_t)len;
+bool sdSaveExists(uint8_t slot) {
+    return slot <= SD_SAVE_TEMP && sdFileExists(savePaths[slot]);
 }
@@ -0,0 +1,131 @@
+#include "snapshot.h"
+#include <atomic>
+
+// Low bits: buffer index. SNAP_FRESH: published but not yet acquired.
+#define SNAP_INDEX_MASK 0x03
+#define SNAP_FRESH 0x04
+
+static GameSnapshot snapBuffers[3];
+
+// Buffer holding the latest publish (shared)
+static std::atomic<uint32_t> snapLatest(2);
+
+// Owned by the update task
+static uint8_t snapBack = 0;
+static TouchPoint snapTap = {0, 0, 0, false};
+static uint32_t snapTapCount = 0;
+static unsigned long snapTapTime = 0;
+static uint32_t snapTick = 0;
+
+// Owned by the render loop
+static uint8_t snapFront = 1;
+
+void snapshotInit()
+{
+    snapBack = 0;
+    snapFront = 1;
+    snapTap = {0, 0, 0, false};
+    snapTapCount = 0;
+    snapTapTime = 0;
+    snapTick = 0;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        memset(&snapBuffers[i], 0, sizeof(GameSnapshot));
+        snapBuffers[i].game = game;
+    }
+    snapLatest.store(2, std::memory_order_release);
+}
+
+void snapshotNoteTap(TouchPoint tap)
+{
+    snapTap = tap;
+    snapTapCount++;
+    snapTapTime = millis();
+}
+
+void snapshotPublish(uint32_t stepMicros, bool moving)
+{
+    GameSnapshot &snap = snapBuffers[snapBack];
+
+    snap.fish.copyLive(fishStore);
+    snap.food.copyLive(foodStore);
+    snap.coins.copyLive(coinStore);
+    snap.particles.copyLive(particleStore);
+    snap.game = game;
+
+    snap.tap = snapTap;
+    snap.tapCount = snapTapCount;
+    snap.tapTime = snapTapTime;
+    snap.tick = ++snapTick;
+    snap.stepMicros = stepMicros;
+    snap.moving = moving;
+
+    // Release: the copies above are visible to whoever acquires this buffer.
+    // Take back whichever buffer was waiting (stale or already drawn).
+    uint32_t prev = snapLatest.exchange(snapBack | SNAP_FRESH, std::memory_order_acq_rel);
+    snapBack = prev & SNAP_INDEX_MASK;
+}
+
+const GameSnapshot &snapshotAcquire()
+{
+    if (snapLatest.load(std::memory_order_relaxed) & SNAP_FRESH)
+    {
+        // Hand the drawn buffer back and take the fresh one
+        uint32_t prev = snapLatest.exchange(snapFront, std::memory_order_acq_rel);
+        snapFront = prev & SNAP_INDEX_MASK;
+    }
+    return snapBuffers[snapFront];
+}
+
+static inline float snapLerp(float from, float to, float t)
+{
+    return from + (to - from) * t;
+}
+
+// Live rows of one store moved from prev toward current by t
+template <typename Store>
+static void snapLerpStore(Store &store, float t)
+{
+    for (uint16_t r = 0; r < store.count; r++)
+    {
+        store.x[r] = snapLerp(store.prevX[r], store.x[r], t);
+        store.y[r] = snapLerp(store.prevY[r], store.y[r], t);
+    }
+}
+
+void snapshotInterpolate(const GameSnapshot &snap, uint32_t nowMicros, GameSnapshot &out)
+{
+    // Only live rows are copied, so this costs what is on screen
+    out.fish.copyLive(snap.fish);
+    out.food.copyLive(snap.food);
+    out.coins.copyLive(snap.coins);
+    out.particles.copyLive(snap.particles);
+    out.game = snap.game;
+    out.tap = snap.tap;
+    out.tapCount = snap.tapCount;
+    out.tapTime = snap.tapTime;
+    out.tick = snap.tick;
+    out.stepMicros = snap.stepMicros;
+    out.moving = snap.moving;
+    if (!snap.moving)
+        return;
+
+    // Fraction of a step since the last one; hold at the newest state if the
+    // next step is late rather than guess ahead
+    int32_t since = (int32_t)(nowMicros - snap.stepMicros);
+    if (since >= (int32_t)SIM_TICK_US)
+        return;
+    float t = since > 0 ? (float)since / SIM_TICK_US : 0.0f;
+
+    snapLerpStore(out.fish, t);
+    snapLerpStore(out.food, t);
+    snapLerpStore(out.coins, t);
+    snapLerpStore(out.particles, t);
+
+    for (uint16_t r = 0; r < out.coins.count; r++)
+    {
+        Coin &coin = out.coins.data[r];
+        coin.floatOffset = snapLerp(coin.prevFloatOffset, coin.floatOffset, t);
+    }
+}
@@ -0,0 +1,48 @@
+#include "spatial_grid.h"
+
+void gridInit(SpatialGrid &grid, uint16_t *items, uint16_t capacity)
+{
+    memset(grid.cellStart, 0, sizeof(grid.cellStart));
+    grid.items = items;
+    grid.capacity = capacity;
+    grid.dirty = true;
+}
+
+uint16_t gridQuery(const SpatialGrid &grid, float x, float y, float radius,
+                   uint16_t *out, uint16_t maxOut)
+{
+    uint16_t first = gridCellOf(x - radius, y - radius);
+    uint16_t last = gridCellOf(x + radius, y + radius);
+    uint16_t col0 = first % GRID_COLS;
+    uint16_t col1 = last % GRID_COLS;
+    uint16_t row0 = first / GRID_COLS;
+    uint16_t row1 = last / GRID_COLS;
+
+    // Id order, so ties resolve the same way whichever cell an entity is in.
+    // Insertion sort as candidates arrive (the runs are short); once out is
+    // full, a smaller id pushes the largest off the end, so a truncated
+    // result is still the lowest ids, in order.
+    uint16_t n = 0;
+    for (uint16_t row = row0; row <= row1; row++)
+    {
+        // Cells of one row are adjacent, so their items are one run
+        uint16_t from = grid.cellStart[row * GRID_COLS + col0];
+        uint16_t to = grid.cellStart[row * GRID_COLS + col1 + 1];
+        for (uint16_t i = from; i < to; i++)
+        {
+            uint16_t v = grid.items[i];
+            if (n == maxOut && (n == 0 || out[n - 1] <= v))
+                continue;
+
+            uint16_t j = n < maxOut ? n++ : n - 1;
+            while (j > 0 && out[j - 1] > v)
+            {
+                out[j] = out[j - 1];
+                j--;
+            }
+            out[j] = v;
+        }
+    }
+
+    return n;
+}
@@ -0,0 +1,98 @@
+#include "spi_bus.h"
+#include "config.h"
+#include <TFT_eSPI.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 40000000
+#endif
+#ifndef SPI_TOUCH_FREQUENCY
+#define SPI_TOUCH_FREQUENCY 2500000
+#endif
+
+static SemaphoreHandle_t busMutex = nullptr;
+static SemaphoreHandle_t slotDone = nullptr; // Touch -> renderer: slot over
+
+static std::atomic<bool> touchWaiting(false); // Touch is blocked on the lock
+static std::atomic<bool> slotOpen(false);     // Touch holds the lock inside a frame
+static std::atomic<uint32_t> slotCount(0);
+static uint32_t lastSlotAt = 0; // Renderer only
+
+void busInit()
+{
+    if (!busMutex)
+        busMutex = xSemaphoreCreateMutex();
+    if (!slotDone)
+        slotDone = xSemaphoreCreateBinary();
+}
+
+SPIClass &busSpi()
+{
+    return TFT_eSPI::getSPIinstance();
+}
+
+void busLock()
+{
+    if (busMutex)
+        xSemaphoreTake(busMutex, portMAX_DELAY);
+}
+
+bool busTryLock()
+{
+    return !busMutex || xSemaphoreTake(busMutex, 0) == pdTRUE;
+}
+
+void busUnlock()
+{
+    if (busMutex)
+        xSemaphoreGive(busMutex);
+}
+
+bool busTouchDue()
+{
+    return touchWaiting.load(std::memory_order_acquire) && millis() - lastSlotAt >= BUS_TOUCH_SLOT_MS;
+}
+
+void busTouchSlot()
+{
+    if (!busMutex)
+        return;
+
+    // Hand the lock to the waiting touch read, then wait for it to say it
+    // is done. The timeout only matters if touch stopped waiting.
+    xSemaphoreTake(slotDone, 0);
+    slotOpen.store(true, std::memory_order_release);
+    xSemaphoreGive(busMutex);
+    if (xSemaphoreTake(slotDone, pdMS_TO_TICKS(BUS_SLOT_TIMEOUT_MS)) == pdTRUE)
+        slotCount.fetch_add(1, std::memory_order_relaxed);
+    xSemaphoreTake(busMutex, portMAX_DELAY);
+    slotOpen.store(false, std::memory_order_relaxed);
+    lastSlotAt = millis();
+}
+
+void busTouchBegin()
+{
+    touchWaiting.store(true, std::memory_order_release);
+    busLock();
+    touchWaiting.store(false, std::memory_order_relaxed);
+
+    // Touch clock; the display's next transaction puts its own back
+    busSpi().setFrequency(SPI_TOUCH_FREQUENCY);
+}
+
+void busTouchEnd()
+{
+    busSpi().setFrequency(SPI_FREQUENCY);
+
+    bool inSlot = slotOpen.exchange(false, std::memory_order_acq_rel);
+    busUnlock();
+    if (inSlot)
+        xSemaphoreGive(slotDone);
+}
+
+uint32_t busTouchSlots()
+{
+    return slotCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,156 @@
+#include "sprite_anim.h"
+#include <string.h>
+
+static uint32_t mirrorBytes = 0;
+static uint32_t scaledBytes = 0;
+
+// RAM a copied frame holds: struct, pixels, span table (an own palette
+// adds 32 bytes, not worth tracking)
+static uint32_t animSpriteBytes(const Sprite *sprite)
+{
+    uint32_t bytes = sizeof(Sprite);
+    if (sprite->format == SPRITE_FMT_INDEXED4)
+        bytes += (uint32_t)(sprite->width + 1) / 2 * sprite->height;
+    else
+        bytes += (uint32_t)sprite->width * sprite->height * 2;
+    if (sprite->rowSpans)
+        bytes += sprite->rowSpans[sprite->height] * sizeof(SpriteSpan) +
+                 (sprite->height + 1) * sizeof(uint16_t);
+    return bytes;
+}
+
+bool animInit(SpriteAnim &anim, Sprite *sheet, uint16_t frameWidth)
+{
+    memset(&anim, 0, sizeof(anim));
+    if (!sheet)
+        return false;
+
+    if (frameWidth == 0 || frameWidth > sheet->width)
+        frameWidth = sheet->width;
+
+    anim.sheet = sheet;
+    anim.frameWidth = frameWidth;
+    anim.height = sheet->height;
+    anim.frameCount = min(sheet->width / frameWidth, ANIM_MAX_FRAMES);
+
+    if (anim.frameCount == 1)
+    {
+        anim.frames[0] = sheet;
+        return true;
+    }
+
+    for (uint8_t f = 0; f < anim.frameCount; f++)
+    {
+        anim.frames[f] = spriteCopyRegion(sheet, f * frameWidth, frameWidth);
+        if (!anim.frames[f])
+        {
+            animFree(anim);
+            return false;
+        }
+    }
+
+#if DEBUG_SERIAL
+    Serial.print("Animation: ");
+    Serial.print(sheet->name ? sheet->name : "unknown");
+    Serial.print(" (");
+    Serial.print(anim.frameCount);
+    Serial.println(" frames)");
+#endif
+
+    return true;
+}
+
+uint8_t animCacheMirrors(SpriteAnim &anim)
+{
+    uint8_t cached = 0;
+    for (uint8_t f = 0; f < anim.frameCount; f++)
+    {
+        if (!anim.mirrored[f])
+        {
+            // A mirror costs what its frame does
+            uint32_t bytes = animSpriteBytes(anim.frames[f]);
+            if (mirrorBytes + bytes > ANIM_MIRROR_BYTES)
+                break;
+
+            anim.mirrored[f] = spriteCopyRegion(anim.frames[f], 0, anim.frameWidth, true);
+            if (!anim.mirrored[f])
+                break;
+            mirrorBytes += animSpriteBytes(anim.mirrored[f]);
+        }
+        cached++;
+    }
+    return cached;
+}
+
+bool animScale(SpriteAnim &out, const SpriteAnim &src, uint16_t frameWidth, uint16_t height)
+{
+    memset(&out, 0, sizeof(out));
+    if (!src.frameCount || frameWidth == 0 || height == 0)
+        return false;
+
+    // Pixels alone decide whether to try; spans are counted once built
+    bool indexed = src.frames[0]->format == SPRITE_FMT_INDEXED4;
+    uint32_t framePixels = indexed ? (uint32_t)(frameWidth + 1) / 2 * height
+                                   : (uint32_t)frameWidth * height * 2;
+    if (scaledBytes + framePixels * src.frameCount > ANIM_SCALED_BYTES)
+        return false;
+
+    out.scaled = true;
+    out.frameWidth = frameWidth;
+    out.height = height;
+    for (uint8_t f = 0; f < src.frameCount; f++)
+    {
+        out.frames[f] = spriteScale(src.frames[f], frameWidth, height, ANIM_SCALE_SMOOTH);
+        if (!out.frames[f])
+        {
+            animFree(out);
+            return false;
+        }
+        out.frameCount = f + 1;
+        scaledBytes += animSpriteBytes(out.frames[f]);
+    }
+    return true;
+}
+
+void animFree(SpriteAnim &anim)
+{
+    for (uint8_t f = 0; f < ANIM_MAX_FRAMES; f++)
+    {
+        if (anim.mirrored[f])
+        {
+            mirrorBytes -= animSpriteBytes(anim.mirrored[f]);
+            spriteUnload(anim.mirrored[f]);
+        }
+        if (anim.frames[f] && anim.frames[f] != anim.sheet)
+        {
+            if (anim.scaled)
+                scaledBytes -= animSpriteBytes(anim.frames[f]);
+            spriteUnload(anim.frames[f]);
+        }
+    }
+    spriteUnload(anim.sheet);
+    memset(&anim, 0, sizeof(anim));
+}
+
+void animDrawTo(TFT_eSprite &dst, const SpriteAnim &anim, uint8_t frame, int16_t x, int16_t y,
+                bool flip, const SpriteTint *tint)
+{
+    if (!anim.frameCount)
+        return;
+
+    uint8_t f = animFrameIndex(anim, frame);
+    if (flip && anim.mirrored[f])
+        spriteDrawTintedTo(dst, anim.mirrored[f], x, y, tint);
+    else
+        spriteDrawTintedTo(dst, anim.frames[f], x, y, tint, flip);
+}
+
+uint32_t animMirrorBytes()
+{
+    return mirrorBytes;
+}
+
+uint32_t animScaledBytes()
+{
+    return scaledBytes;
+}
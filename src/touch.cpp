@@ -1,18 +1,20 @@
 #include "touch.h"
+#include "spi_bus.h"
+#include "spsc_ring.h"
 #include <XPT2046_Touchscreen.h>
 #include <SPI.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
-// Touch controller shares SPI with display (HSPI)
-// Use HSPI explicitly to match TFT pins (12, 13, 14)
-static SPIClass touchSpi(HSPI);
-static XPT2046_Touchscreen touch(TOUCH_CS, TOUCH_IRQ);
+// No IRQ pin for the driver: the sampler owns the pen-down interrupt, and
+// the driver stops reading once its own interrupt handler is replaced
+static XPT2046_Touchscreen touch(TOUCH_CS);
 
-// Touch state
-static TouchPoint currentTouch;
-static TouchPoint lastTap;
-static bool wasTouched = false;
-static bool tapOccurred = false;
-static unsigned long lastTouchTime = 0;
+// Sampler task -> update task
+static SpscRing<TouchEvent, TOUCH_RING_SIZE> touchEvents;
+static std::atomic<uint32_t> touchDropped(0);
+static std::atomic<bool> touchPressed(false);
+static TaskHandle_t samplerTask = nullptr;
 
 // Calibration values for TZT ESP32 CYD 2.4" (verified 2025-01-14)
 // Raw touch ranges: X 600-3600, Y 500-3600
@@ -37,22 +39,15 @@ void touchInit()
     Serial.println(TOUCH_IRQ);
 #endif
 
-    // Initialize custom SPI for HSPI bus (shared with TFT)
-    touchSpi.begin(14, 12, 13, TOUCH_CS); // CLK=14, MISO=12, MOSI=13, SS=33
-
     pinMode(TOUCH_IRQ, INPUT_PULLUP);
     pinMode(TOUCH_CS, OUTPUT);
     digitalWrite(TOUCH_CS, HIGH); // Start with touch disabled
 
-    // Pass custom SPI instance to library
-    touch.begin(touchSpi);
+    // The display's SPI instance: the bus is already up (CLK=14, MISO=12,
+    // MOSI=13), so this only registers the chip select
+    touch.begin(busSpi());
     touch.setRotation(1); // Matches Display Landscape
 
-    currentTouch.valid = false;
-    lastTap.valid = false;
-    wasTouched = false;
-    tapOccurred = false;
-
 #if DEBUG_SERIAL
     Serial.println("Touch configuration applied (Rotation 0, IRQ PULLUP)");
 
@@ -78,102 +73,162 @@ void touchInit()
 #endif
 }
 
-void touchUpdate()
+// ============================================================================
+// SAMPLER TASK
+// ============================================================================
+
+// Pen down: wake the sampler
+static void IRAM_ATTR touchIrq()
+{
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(samplerTask, &woken);
+    if (woken)
+        portYIELD_FROM_ISR();
+}
+
+static void touchPush(uint8_t type, const TouchPoint &point, uint32_t time)
 {
-    tapOccurred = false;
+    TouchEvent event = {type, point.x, point.y, point.pressure, time};
+    if (!touchEvents.push(event))
+        touchDropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+// One controller reading in screen pixels. False if the pressure is
+// outside [TOUCH_MIN_PRESSURE, TOUCH_MAX_PRESSURE).
+static bool touchRead(TouchPoint &point)
+{
+    // Waits for the strip going out if the renderer has the bus
+    busTouchBegin();
+    TS_Point p = touch.getPoint();
+    busTouchEnd();
+
+    if (p.z < TOUCH_MIN_PRESSURE || p.z >= TOUCH_MAX_PRESSURE)
+        return false;
+
+    // Map raw coordinates (Landscape 320x240)
+    // AXES SWAPPED for Landscape (Fixes Anti-Diagonal inversion)
+    // map(p.y, MIN_Y, MAX_Y) -> Screen X
+    // map(p.x, MIN_X, MAX_X) -> Screen Y
+    int16_t mappedX = map(p.y, TOUCH_MIN_Y, TOUCH_MAX_Y, 0, SCREEN_WIDTH);
+    int16_t mappedY = map(p.x, TOUCH_MIN_X, TOUCH_MAX_X, 0, SCREEN_HEIGHT);
+
+    // Clamp to screen
+    point.x = constrain(mappedX, 0, SCREEN_WIDTH - 1);
+    point.y = constrain(mappedY, 0, SCREEN_HEIGHT - 1);
+    point.pressure = p.z;
+    point.valid = true;
+    return true;
+}
 
-    // On CYD, TOUCH_IRQ (36) is LOW when the screen is touched.
-    bool irqTouched = (digitalRead(TOUCH_IRQ) == LOW);
+static int16_t touchMedian(const int16_t *values, uint8_t count)
+{
+    int16_t sorted[TOUCH_FILTER_SAMPLES];
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t j = i;
+        for (; j > 0 && sorted[j - 1] > values[i]; j--)
+            sorted[j] = sorted[j - 1];
+        sorted[j] = values[i];
+    }
+    return sorted[count / 2];
+}
 
-    if (!irqTouched)
+// Sleeps until the pen goes down, follows it at TOUCH_SAMPLE_MS until it
+// lifts, then sleeps again
+static void touchSampleTask(void *param)
+{
+    (void)param;
+    for (;;)
     {
-        if (wasTouched)
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        int16_t xs[TOUCH_FILTER_SAMPLES];
+        int16_t ys[TOUCH_FILTER_SAMPLES];
+        uint8_t filled = 0;
+        uint8_t next = 0;
+        uint8_t good = 0; // Good readings in a row
+        uint8_t bad = 0;  // Bad readings in a row
+        bool down = false;
+        TouchPoint last = {0, 0, 0, false}; // Position of the last event
+
+        // Bad readings before a press is confirmed were a glitch on the
+        // IRQ line; during a press they end it
+        TickType_t wake = xTaskGetTickCount();
+        while (bad < TOUCH_RELEASE_SAMPLES)
         {
-            // Touch released - this is a tap
-            unsigned long now = millis();
-            if (now - lastTouchTime > TOUCH_DEBOUNCE_MS)
+            TouchPoint reading;
+            if (digitalRead(TOUCH_IRQ) != LOW || !touchRead(reading))
+            {
+                bad++;
+                good = 0;
+            }
+            else
             {
-                tapOccurred = true;
-                lastTap = currentTouch;
-                lastTouchTime = now;
+                bad = 0;
+                if (good < TOUCH_PRESS_SAMPLES)
+                    good++;
+
+                xs[next] = reading.x;
+                ys[next] = reading.y;
+                next = (next + 1) % TOUCH_FILTER_SAMPLES;
+                if (filled < TOUCH_FILTER_SAMPLES)
+                    filled++;
+
+                TouchPoint pos = {touchMedian(xs, filled), touchMedian(ys, filled), reading.pressure, true};
+                if (!down && good >= TOUCH_PRESS_SAMPLES)
+                {
+                    down = true;
+                    touchPressed.store(true, std::memory_order_relaxed);
+                    touchPush(TOUCH_DOWN, pos, millis());
+                    last = pos;
 #if DEBUG_TOUCH
-                Serial.println("Touch Released (Tap)");
+                    Serial.printf("Touch Down: X:%d Y:%d (Z:%d)\n", pos.x, pos.y, pos.pressure);
 #endif
+                }
+                else if (down && (abs(pos.x - last.x) >= TOUCH_MOVE_MIN || abs(pos.y - last.y) >= TOUCH_MOVE_MIN))
+                {
+                    touchPush(TOUCH_MOVE, pos, millis());
+                    last = pos;
+                }
             }
-        }
-        currentTouch.valid = false;
-        wasTouched = false;
-        return;
-    }
-
-    // IRQ says touched, read SPI coordinates
-    TS_Point p = touch.getPoint();
 
-    // Filter out obvious noise
-    bool pressureOk = (p.z >= TOUCH_MIN_PRESSURE && p.z < 5000);
-
-#if DEBUG_TOUCH
-    if (pressureOk || p.z > 50)
-    {
-        Serial.print("Raw touch -> X:");
-        Serial.print(p.x);
-        Serial.print(" Y:");
-        Serial.print(p.y);
-        Serial.print(" Z:");
-        Serial.println(p.z);
-    }
-#endif
+            vTaskDelayUntil(&wake, pdMS_TO_TICKS(TOUCH_SAMPLE_MS));
+        }
 
-    if (pressureOk)
-    {
-        // Map raw coordinates (Landscape 320x240)
-        // AXES SWAPPED for Landscape (Fixes Anti-Diagonal inversion)
-        // map(p.y, MIN_Y, MAX_Y) -> Screen X
-        // map(p.x, MIN_X, MAX_X) -> Screen Y
-
-        int16_t mappedX = map(p.y, TOUCH_MIN_Y, TOUCH_MAX_Y, 0, SCREEN_WIDTH);
-        // Note: Check if Y needs inversion (MAX->MIN) depending on visual test
-        // Previously TR->BL implies both swapped.
-        int16_t mappedY = map(p.x, TOUCH_MIN_X, TOUCH_MAX_X, 0, SCREEN_HEIGHT);
-
-        // Clamp to screen
-        mappedX = constrain(mappedX, 0, SCREEN_WIDTH - 1);
-        mappedY = constrain(mappedY, 0, SCREEN_HEIGHT - 1);
-
-        currentTouch.x = mappedX;
-        currentTouch.y = mappedY;
-        currentTouch.pressure = p.z;
-        currentTouch.valid = true;
+        if (down)
+        {
+            touchPush(TOUCH_UP, last, millis());
+            touchPressed.store(false, std::memory_order_relaxed);
 #if DEBUG_TOUCH
-        Serial.printf("Touch Mapped: X:%d Y:%d (Raw: %d,%d, Z:%d)\n", mappedX, mappedY, p.x, p.y, p.z);
+            Serial.println("Touch Released");
 #endif
-        wasTouched = true;
-    }
-    else
-    {
-        currentTouch.valid = false;
-        wasTouched = false;
+        }
     }
 }
 
-TouchPoint touchGet()
+void touchStart()
 {
-    return currentTouch;
+    if (samplerTask)
+        return;
+
+    xTaskCreatePinnedToCore(touchSampleTask, "touch", TOUCH_TASK_STACK, nullptr,
+                            TOUCH_TASK_PRIORITY, &samplerTask, TOUCH_TASK_CORE);
+    attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ), touchIrq, FALLING);
 }
 
-bool touchIsPressed()
+bool touchPollEvent(TouchEvent &event)
 {
-    return currentTouch.valid;
+    return touchEvents.pop(event);
 }
 
-bool touchTapped()
+bool touchIsPressed()
 {
-    return tapOccurred;
+    return touchPressed.load(std::memory_order_relaxed);
 }
 
-TouchPoint touchGetTap()
+uint32_t touchDroppedEvents()
 {
-    return lastTap;
+    return touchDropped.load(std::memory_order_relaxed);
 }
 
 void touchCalibrate()
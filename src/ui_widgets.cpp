@@ -0,0 +1,323 @@
+#include "ui_widgets.h"
+#include "sd_sprites.h"
+#include <string.h>
+
+// Built-in font cell (glyph plus spacing), before scaling
+#define UI_CELL_W 6
+#define UI_CELL_H 8
+
+// Printable ASCII gets cached glyphs
+#define UI_FIRST_CHAR 32
+#define UI_GLYPHS 95
+
+enum UiKind
+{
+    UI_LABEL,
+    UI_COUNTER,
+    UI_BUTTON
+};
+
+struct UiWidget
+{
+    uint8_t kind;
+    int16_t x, y;
+    int16_t w, h; // Buttons only
+    uint8_t size;
+    uint16_t color; // Text
+    uint16_t bg;    // Text background (== color: transparent)
+    uint16_t fill;  // Button box
+    uint16_t border;
+    bool visible;
+    const char *prefix; // Counters
+    const char *suffix;
+    char text[UI_TEXT_MAX];
+};
+
+// Pre-rendered glyphs for one text style
+struct UiFont
+{
+    bool used;
+    uint8_t size;
+    uint16_t color;
+    uint16_t bg;
+    Sprite *glyphs[UI_GLYPHS]; // Rendered on first use
+};
+
+static TFT_eSPI *uiDisplay = nullptr;
+static UiWidget uiWidgets[UI_MAX_WIDGETS];
+static uint8_t uiCount = 0;
+static UiFont uiFonts[UI_MAX_FONTS];
+
+void uiInit(TFT_eSPI *display)
+{
+    uiDisplay = display;
+    uiCount = 0;
+}
+
+// ============================================================================
+// GLYPH CACHE
+// ============================================================================
+
+static UiFont *uiFindFont(uint8_t size, uint16_t color, uint16_t bg)
+{
+    UiFont *unused = nullptr;
+    for (uint8_t f = 0; f < UI_MAX_FONTS; f++)
+    {
+        UiFont &font = uiFonts[f];
+        if (font.used && font.size == size && font.color == color && font.bg == bg)
+            return &font;
+        if (!font.used && !unused)
+            unused = &font;
+    }
+
+    if (!unused)
+        return nullptr;
+
+    unused->used = true;
+    unused->size = size;
+    unused->color = color;
+    unused->bg = bg;
+    memset(unused->glyphs, 0, sizeof(unused->glyphs));
+    return unused;
+}
+
+// Render glyph c of a style: opaque cells keep the background, transparent
+// ones the sprite key
+static Sprite *uiRenderGlyph(const UiFont &font, char c)
+{
+    int16_t w = UI_CELL_W * font.size;
+    int16_t h = UI_CELL_H * font.size;
+    Sprite *glyph = spriteCreate(w, h);
+    if (!glyph)
+        return nullptr;
+
+    TFT_eSprite canvas(uiDisplay);
+    if (!canvas.createSprite(w, h))
+    {
+        spriteUnload(glyph);
+        return nullptr;
+    }
+
+    bool transparent = font.bg == font.color;
+    uint16_t bg = transparent ? SPRITE_KEY_COLOR : font.bg;
+    canvas.fillSprite(bg);
+    canvas.drawChar(0, 0, (uint8_t)c, font.color, bg, font.size);
+    for (int16_t py = 0; py < h; py++)
+        for (int16_t px = 0; px < w; px++)
+            glyph->data[py * w + px] = canvas.readPixel(px, py);
+    canvas.deleteSprite();
+
+    spriteBuildSpans(glyph, SPRITE_KEY_COLOR);
+    return glyph;
+}
+
+static Sprite *uiGlyph(UiFont *font, char c)
+{
+    uint8_t i = (uint8_t)c - UI_FIRST_CHAR;
+    if (!font || i >= UI_GLYPHS)
+        return nullptr;
+    if (!font->glyphs[i])
+        font->glyphs[i] = uiRenderGlyph(*font, c);
+    return font->glyphs[i];
+}
+
+// ============================================================================
+// WIDGETS
+// ============================================================================
+
+static inline int16_t uiCellW(const UiWidget &w)
+{
+    return UI_CELL_W * w.size;
+}
+
+static inline int16_t uiCellH(const UiWidget &w)
+{
+    return UI_CELL_H * w.size;
+}
+
+// Screen position of the first character
+static void uiTextOrigin(const UiWidget &w, int16_t &tx, int16_t &ty)
+{
+    tx = w.x;
+    ty = w.y;
+    if (w.kind == UI_BUTTON)
+    {
+        tx += (w.w - (int16_t)strlen(w.text) * uiCellW(w)) / 2;
+        ty += (w.h - uiCellH(w)) / 2;
+    }
+}
+
+static DirtyRect uiBox(const UiWidget &w)
+{
+    if (w.kind == UI_BUTTON)
+        return {w.x, w.y, w.w, w.h};
+    return {w.x, w.y, (int16_t)(strlen(w.text) * uiCellW(w)), uiCellH(w)};
+}
+
+static UiId uiAdd(const UiWidget &widget)
+{
+    if (uiCount >= UI_MAX_WIDGETS)
+        return UI_NONE;
+
+    uiWidgets[uiCount] = widget;
+    dirtyAdd(uiBox(uiWidgets[uiCount]));
+    return uiCount++;
+}
+
+UiId uiAddLabel(int16_t x, int16_t y, uint8_t size, uint16_t color, uint16_t bg, const char *text)
+{
+    UiWidget w = {};
+    w.kind = UI_LABEL;
+    w.x = x;
+    w.y = y;
+    w.size = size;
+    w.color = color;
+    w.bg = bg;
+    w.visible = true;
+    strncpy(w.text, text, UI_TEXT_MAX - 1);
+    return uiAdd(w);
+}
+
+UiId uiAddCounter(int16_t x, int16_t y, uint8_t size, uint16_t color, uint16_t bg,
+                  const char *prefix, const char *suffix)
+{
+    UiWidget w = {};
+    w.kind = UI_COUNTER;
+    w.x = x;
+    w.y = y;
+    w.size = size;
+    w.color = color;
+    w.bg = bg;
+    w.visible = true;
+    w.prefix = prefix;
+    w.suffix = suffix;
+    snprintf(w.text, UI_TEXT_MAX, "%s0%s", prefix, suffix);
+    return uiAdd(w);
+}
+
+UiId uiAddButton(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t size, uint16_t border,
+                 const char *text)
+{
+    UiWidget b = {};
+    b.kind = UI_BUTTON;
+    b.x = x;
+    b.y = y;
+    b.w = w;
+    b.h = h;
+    b.size = size;
+    b.border = border;
+    b.visible = true;
+    strncpy(b.text, text, UI_TEXT_MAX - 1);
+    return uiAdd(b);
+}
+
+void uiSetText(UiId id, const char *text)
+{
+    if (id >= uiCount)
+        return;
+
+    UiWidget &w = uiWidgets[id];
+    if (strncmp(w.text, text, UI_TEXT_MAX - 1) == 0)
+        return;
+
+    if (w.kind == UI_BUTTON)
+    {
+        strncpy(w.text, text, UI_TEXT_MAX - 1);
+        if (w.visible)
+            dirtyAdd(uiBox(w));
+        return;
+    }
+
+    // Dirty only the cells whose character changed (a shorter text leaves
+    // cells to clear). Touching cells merge in the dirty list.
+    char next[UI_TEXT_MAX] = {0};
+    strncpy(next, text, UI_TEXT_MAX - 1);
+    if (w.visible)
+    {
+        for (uint8_t i = 0; i < UI_TEXT_MAX - 1 && (w.text[i] || next[i]); i++)
+        {
+            if (w.text[i] != next[i])
+                dirtyAdd(w.x + i * uiCellW(w), w.y, uiCellW(w), uiCellH(w));
+        }
+    }
+    memcpy(w.text, next, UI_TEXT_MAX);
+}
+
+void uiSetValue(UiId id, uint32_t value)
+{
+    if (id >= uiCount)
+        return;
+
+    const UiWidget &w = uiWidgets[id];
+    char text[UI_TEXT_MAX];
+    snprintf(text, sizeof(text), "%s%lu%s", w.prefix ? w.prefix : "", (unsigned long)value,
+             w.suffix ? w.suffix : "");
+    uiSetText(id, text);
+}
+
+void uiSetColors(UiId id, uint16_t fill, uint16_t textColor)
+{
+    if (id >= uiCount)
+        return;
+
+    UiWidget &w = uiWidgets[id];
+    if (w.fill == fill && w.color == textColor)
+        return;
+
+    w.fill = fill;
+    w.color = textColor;
+    w.bg = fill; // Text sits on the box
+    if (w.visible)
+        dirtyAdd(uiBox(w));
+}
+
+void uiSetVisible(UiId id, bool visible)
+{
+    if (id >= uiCount || uiWidgets[id].visible == visible)
+        return;
+
+    uiWidgets[id].visible = visible;
+    dirtyAdd(uiBox(uiWidgets[id]));
+}
+
+// ============================================================================
+// DRAWING
+// ============================================================================
+
+static inline bool uiOverlaps(const DirtyRect &a, const DirtyRect &b)
+{
+    return a.x < b.x + b.w && a.x + a.w > b.x && a.y < b.y + b.h && a.y + a.h > b.y;
+}
+
+void uiDraw(TFT_eSprite &dst, int16_t ox, int16_t oy, const DirtyRect &clip)
+{
+    for (uint8_t i = 0; i < uiCount; i++)
+    {
+        const UiWidget &w = uiWidgets[i];
+        if (!w.visible || !uiOverlaps(uiBox(w), clip))
+            continue;
+
+        if (w.kind == UI_BUTTON)
+        {
+            dst.fillRect(w.x + ox, w.y + oy, w.w, w.h, w.fill);
+            dst.drawRect(w.x + ox, w.y + oy, w.w, w.h, w.border);
+        }
+
+        int16_t tx, ty;
+        uiTextOrigin(w, tx, ty);
+        UiFont *font = uiFindFont(w.size, w.color, w.bg);
+
+        for (uint8_t c = 0; w.text[c]; c++)
+        {
+            DirtyRect cell = {(int16_t)(tx + c * uiCellW(w)), ty, uiCellW(w), uiCellH(w)};
+            if (!uiOverlaps(cell, clip))
+                continue;
+
+            Sprite *glyph = uiGlyph(font, w.text[c]);
+            if (glyph)
+                spriteDrawTransparentTo(dst, glyph, cell.x + ox, cell.y + oy);
+            else
+                dst.drawChar(cell.x + ox, cell.y + oy, (uint8_t)w.text[c], w.color, w.bg, w.size);
+        }
+    }
+}
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+"""
+img2i4.py - Convert images to 4bpp palette-indexed sprites (.i4)
+
+Packs a sprite as 4-bit palette indices plus a 16-entry RGB565 palette:
+a quarter of the size of a .raw RGB565 sprite, in RAM and on the card.
+The firmware expands the indices through the palette while drawing
+(spriteLoadIndexed in src/sd_sprites.cpp).
+
+Usage:
+    python img2i4.py fish.png fish.i4                 # Own palette (median cut)
+    python img2i4.py fish.raw fish.i4 --size 48x20    # From an existing .raw
+    python img2i4.py fish.png fish.i4 --palette norcal.hex
+    python img2i4.py fish.png fish.i4 --palette norcal.hex --shared
+    python img2i4.py --palette norcal.hex --write-palette palette.pal
+
+Sprites converted with --shared carry no palette and draw with the shared
+one, loaded at boot from /sprites/palette.pal (see --write-palette). Then
+swapping that one file recolours every sprite.
+
+Transparency: PNG pixels with alpha < 128 and .raw pixels equal to magenta
+(0xF81F) become the key color, which takes one of the 16 palette entries.
+
+Requirements:
+    pip install Pillow   (PNG input only)
+
+Output format (little-endian):
+    "SPI4", uint16 width, uint16 height,
+    uint8 palette entries (0 = uses the shared palette), uint8 reserved,
+    palette entries x uint16 RGB565,
+    height rows of (width + 1) // 2 bytes, left pixel in the high nibble
+"""
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+KEY_COLOR = 0xF81F  # Magenta, SPRITE_KEY_COLOR in the firmware
+PALETTE_SIZE = 16
+
+
+def rgb_to_565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def split_565(c):
+    return (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        print("Error: Pillow library required for PNG input. Install with: pip install Pillow")
+        sys.exit(1)
+
+    img = Image.open(path).convert("RGBA")
+    pixels = []
+    for r, g, b, a in img.getdata():
+        pixels.append(KEY_COLOR if a < 128 else rgb_to_565(r, g, b))
+    return img.width, img.height, pixels
+
+
+def load_raw(path, size):
+    if not size:
+        print("Error: --size WxH is required for .raw input")
+        sys.exit(1)
+    width, height = (int(v) for v in size.lower().split("x"))
+    data = Path(path).read_bytes()
+    if len(data) != width * height * 2:
+        print(f"Error: {path} is {len(data)} bytes, expected {width * height * 2} for {size}")
+        sys.exit(1)
+    return width, height, list(struct.unpack(f"<{width * height}H", data))
+
+
+def load_palette(path):
+    """Hex colors, one per line (same format as dither_tool.py)"""
+    colors = []
+    for line in Path(path).read_text().splitlines():
+        line = line.strip().lstrip("#")
+        if not line or line.startswith(("/", ";")):
+            continue
+        try:
+            colors.append(rgb_to_565(int(line[0:2], 16), int(line[2:4], 16), int(line[4:6], 16)))
+        except ValueError:
+            pass
+    if not colors or len(colors) > PALETTE_SIZE:
+        print(f"Error: {path} needs 1-{PALETTE_SIZE} colors, found {len(colors)}")
+        sys.exit(1)
+    return colors
+
+
+def median_cut(counts, n):
+    """Reduce {rgb565: count} to at most n colors"""
+    boxes = [list(counts.items())]
+    while len(boxes) < n:
+        # Split the box with the widest channel range (weighted by 565 depth)
+        best, best_range, best_ch = None, 0, 0
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            for ch in range(3):
+                vals = [split_565(c)[ch] << (1 if ch != 1 else 0) for c, _ in box]
+                rng = max(vals) - min(vals)
+                if rng > best_range:
+                    best, best_range, best_ch = i, rng, ch
+        if best is None:
+            break
+
+        box = sorted(boxes.pop(best), key=lambda item: split_565(item[0])[best_ch])
+        total = sum(cnt for _, cnt in box)
+        acc, cut = 0, 1
+        for k, (_, cnt) in enumerate(box[:-1]):
+            acc += cnt
+            if acc * 2 >= total:
+                cut = k + 1
+                break
+        boxes += [box[:cut], box[cut:]]
+
+    palette = []
+    for box in boxes:
+        total = sum(cnt for _, cnt in box)
+        avg = [sum(split_565(c)[ch] * cnt for c, cnt in box) / total for ch in range(3)]
+        palette.append((round(avg[0]) << 11) | (round(avg[1]) << 5) | round(avg[2]))
+    return palette
+
+
+def nearest(color, palette):
+    r, g, b = split_565(color)
+    best, best_dist = 0, None
+    for i, p in enumerate(palette):
+        if p == KEY_COLOR:
+            continue
+        pr, pg, pb = split_565(p)
+        # Same eye weighting as dither_tool.py, in 565 units
+        dist = ((r - pr) * 2) ** 2 * 0.299 + (g - pg) ** 2 * 0.587 + ((b - pb) * 2) ** 2 * 0.114
+        if best_dist is None or dist < best_dist:
+            best, best_dist = i, dist
+    return best
+
+
+def build_palette(pixels, fixed):
+    has_key = KEY_COLOR in pixels
+    if fixed:
+        palette = list(fixed)
+        if has_key and KEY_COLOR not in palette:
+            if len(palette) >= PALETTE_SIZE:
+                print("Error: sprite has transparent pixels but the palette has no room for magenta")
+                sys.exit(1)
+            palette.append(KEY_COLOR)
+        return palette
+
+    counts = {}
+    for c in pixels:
+        if c != KEY_COLOR:
+            counts[c] = counts.get(c, 0) + 1
+    room = PALETTE_SIZE - (1 if has_key else 0)
+    palette = list(counts) if len(counts) <= room else median_cut(counts, room)
+    # A quantized color can land on the key by accident; nudge it off
+    palette = [c ^ 0x0020 if c == KEY_COLOR else c for c in palette]
+    if has_key:
+        palette.append(KEY_COLOR)
+    return palette
+
+
+def pack(width, height, pixels, palette):
+    lookup = {}
+    rows = bytearray()
+    for y in range(height):
+        row = []
+        for x in range(width):
+            c = pixels[y * width + x]
+            if c not in lookup:
+                lookup[c] = palette.index(KEY_COLOR) if c == KEY_COLOR else nearest(c, palette)
+            row.append(lookup[c])
+        if width % 2:
+            row.append(0)
+        for x in range(0, len(row), 2):
+            rows.append((row[x] << 4) | row[x + 1])
+    return bytes(rows)
+
+
+def write_pal(path, palette):
+    padded = list(palette) + [0] * (PALETTE_SIZE - len(palette))
+    Path(path).write_bytes(struct.pack(f"<{PALETTE_SIZE}H", *padded))
+    print(f"Wrote {path} ({len(palette)} colors)")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert images to 4bpp indexed sprites (.i4)")
+    parser.add_argument("input", nargs="?", help="Input .png or .raw (RGB565 LE)")
+    parser.add_argument("output", nargs="?", help="Output .i4 (default: input with .i4)")
+    parser.add_argument("--size", help="WxH of a .raw input")
+    parser.add_argument("--palette", help="Fixed palette (hex colors, one per line)")
+    parser.add_argument("--shared", action="store_true",
+                        help="Leave the palette out; draw with /sprites/palette.pal")
+    parser.add_argument("--write-palette", metavar="PAL",
+                        help="Also write the palette as a .pal file (16 x RGB565 LE)")
+    args = parser.parse_args()
+
+    fixed = load_palette(args.palette) if args.palette else None
+    if args.shared and not fixed:
+        parser.error("--shared needs --palette (every sprite must use the same colors)")
+
+    if not args.input:
+        if args.write_palette and fixed:
+            write_pal(args.write_palette, fixed)
+            return
+        parser.error("input is required")
+
+    src = Path(args.input)
+    if src.suffix.lower() == ".raw":
+        width, height, pixels = load_raw(src, args.size)
+    else:
+        width, height, pixels = load_png(src)
+
+    palette = build_palette(pixels, fixed)
+    if args.shared and palette != fixed:
+        print("Error: --shared palette must already contain magenta for transparent sprites")
+        sys.exit(1)
+
+    out = Path(args.output) if args.output else src.with_suffix(".i4")
+    header = b"SPI4" + struct.pack("<HHBB", width, height, 0 if args.shared else len(palette), 0)
+    body = b"" if args.shared else struct.pack(f"<{len(palette)}H", *palette)
+    out.write_bytes(header + body + pack(width, height, pixels, palette))
+
+    raw_size = width * height * 2
+    print(f"Wrote {out} ({width}x{height}, {len(palette)} colors, "
+          f"{out.stat().st_size} bytes vs {raw_size} as RGB565)")
+
+    if args.write_palette:
+        write_pal(args.write_palette, palette)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""
+img2qbg.py - Convert backgrounds to banded, compressed RGB565 (.qbg)
+
+Full-screen art is too big to keep in flash or heap as raw RGB565, so it
+lives on the SD card compressed and is decoded a band of rows at a time
+(src/bg_stream.cpp). Each band is compressed on its own, so any band can
+be decoded without the ones above it.
+
+Usage:
+    python img2qbg.py bg_sierra.png sierra.qbg --fit 320x160
+    python img2qbg.py water.raw water.qbg --size 320x160
+    python img2qbg.py ../include/sprites/bg_sierra_data.h sierra.qbg --fit 320x160
+
+Inputs: .png (needs Pillow), .raw RGB565 LE (needs --size), or a C header
+written by img2code.py. --fit scales the image to cover WxH (bilinear) and
+crops the overflow evenly from both sides.
+
+Codec (QOI-style, on RGB565 channels r5 g6 b5; state resets every band:
+previous pixel 0, 64-entry table of seen colors zeroed):
+    00iiiiii            INDEX  color = table[i]
+    01rrggbb            DIFF   r, g, b += 2-bit deltas - 2 (-2..1)
+    10gggggg rrrrbbbb   LUMA   g += g - 32; r += (g delta) + r - 8; b likewise
+    11nnnnnn            RUN    previous pixel n + 1 times (n < 62)
+    11111110 lo hi      RGB    literal RGB565
+After every pixel: table[(r * 3 + g * 5 + b * 7) % 64] = color.
+
+File format (little-endian):
+    "BGQ1", uint16 width, uint16 height, uint16 band rows, uint16 bands,
+    uint32 offset[bands + 1] (from the start of the file; the last one is
+    the file size), then the compressed bands
+
+A band (band rows x width) holds at most 65535 pixels, the most the
+firmware's band cache takes (BG_MAX_BAND_PIXELS); a 320-wide image can use
+up to 204 band rows.
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_RGB = 0xFE
+
+MAX_BAND_PIXELS = 0xFFFF  # BG_MAX_BAND_PIXELS in src/bg_stream.cpp
+
+
+def split_565(c):
+    return (c >> 11) & 0x1F, (c >> 5) & 0x3F, c & 0x1F
+
+
+def color_hash(c):
+    r, g, b = split_565(c)
+    return (r * 3 + g * 5 + b * 7) % 64
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        print("Error: Pillow library required for PNG input. Install with: pip install Pillow")
+        sys.exit(1)
+
+    img = Image.open(path).convert("RGB")
+    pixels = [((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3) for r, g, b in img.getdata()]
+    return img.width, img.height, pixels
+
+
+def load_raw(path, size):
+    if not size:
+        print("Error: --size WxH is required for .raw input")
+        sys.exit(1)
+    width, height = (int(v) for v in size.lower().split("x"))
+    data = Path(path).read_bytes()
+    if len(data) != width * height * 2:
+        print(f"Error: {path} is {len(data)} bytes, expected {width * height * 2} for {size}")
+        sys.exit(1)
+    return width, height, list(struct.unpack(f"<{width * height}H", data))
+
+
+def load_header(path):
+    """C array from img2code.py (#define ..._WIDTH/_HEIGHT, 0x.... values)"""
+    text = Path(path).read_text()
+    width = int(re.search(r"#define\s+\w+_WIDTH\s+(\d+)", text).group(1))
+    height = int(re.search(r"#define\s+\w+_HEIGHT\s+(\d+)", text).group(1))
+    body = text[text.index("{") + 1:text.rindex("}")]
+    pixels = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{4})", body)]
+    if len(pixels) != width * height:
+        print(f"Error: {path} has {len(pixels)} pixels, expected {width * height}")
+        sys.exit(1)
+    return width, height, pixels
+
+
+def fit(width, height, pixels, size):
+    """Scale to cover size (bilinear, per 565 channel) and center-crop"""
+    out_w, out_h = (int(v) for v in size.lower().split("x"))
+    scale = max(out_w / width, out_h / height)
+    off_x = (width * scale - out_w) / 2
+    off_y = (height * scale - out_h) / 2
+
+    chans = [split_565(c) for c in pixels]
+    out = []
+    for y in range(out_h):
+        sy = min(max((y + 0.5 + off_y) / scale - 0.5, 0), height - 1)
+        y0 = int(sy)
+        y1 = min(y0 + 1, height - 1)
+        fy = sy - y0
+        for x in range(out_w):
+            sx = min(max((x + 0.5 + off_x) / scale - 0.5, 0), width - 1)
+            x0 = int(sx)
+            x1 = min(x0 + 1, width - 1)
+            fx = sx - x0
+            a, b = chans[y0 * width + x0], chans[y0 * width + x1]
+            c, d = chans[y1 * width + x0], chans[y1 * width + x1]
+            px = [round((a[k] * (1 - fx) + b[k] * fx) * (1 - fy) + (c[k] * (1 - fx) + d[k] * fx) * fy)
+                  for k in range(3)]
+            out.append((px[0] << 11) | (px[1] << 5) | px[2])
+    return out_w, out_h, out
+
+
+def encode_band(pixels):
+    out = bytearray()
+    table = [0] * 64
+    prev = 0
+    run = 0
+
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == 62:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        h = color_hash(c)
+        if table[h] == c:
+            out.append(OP_INDEX | h)
+        else:
+            table[h] = c
+            r, g, b = split_565(c)
+            pr, pg, pb = split_565(prev)
+            dr, dg, db = r - pr, g - pg, b - pb
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out.append(OP_RGB)
+                out += struct.pack("<H", c)
+        prev = c
+
+    if run:
+        out.append(OP_RUN | (run - 1))
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert backgrounds to compressed .qbg")
+    parser.add_argument("input", help="Input .png, .raw (RGB565 LE) or img2code.py header")
+    parser.add_argument("output", nargs="?", help="Output .qbg (default: input with .qbg)")
+    parser.add_argument("--size", help="WxH of a .raw input")
+    parser.add_argument("--fit", metavar="WxH", help="Scale and crop to this size (e.g. 320x160)")
+    parser.add_argument("--band-rows", type=int, default=16,
+                        help="Rows per independently decodable band (default 16)")
+    args = parser.parse_args()
+
+    src = Path(args.input)
+    ext = src.suffix.lower()
+    if ext == ".raw":
+        width, height, pixels = load_raw(src, args.size)
+    elif ext == ".h":
+        width, height, pixels = load_header(src)
+    else:
+        width, height, pixels = load_png(src)
+
+    if args.fit:
+        width, height, pixels = fit(width, height, pixels, args.fit)
+
+    rows = args.band_rows
+    if rows < 1 or rows * width > MAX_BAND_PIXELS:
+        print(f"Error: --band-rows {rows} x width {width} is over {MAX_BAND_PIXELS} "
+              f"pixels per band (at most {MAX_BAND_PIXELS // width} rows)")
+        sys.exit(1)
+    bands = [encode_band(pixels[y * width:min(y + rows, height) * width])
+             for y in range(0, height, rows)]
+
+    offset = 12 + 4 * (len(bands) + 1)
+    offsets = []
+    for band in bands:
+        offsets.append(offset)
+        offset += len(band)
+    offsets.append(offset)
+
+    out = Path(args.output) if args.output else src.with_suffix(".qbg")
+    header = b"BGQ1" + struct.pack("<HHHH", width, height, rows, len(bands))
+    out.write_bytes(header + struct.pack(f"<{len(offsets)}I", *offsets) + b"".join(bands))
+
+    raw_size = width * height * 2
+    print(f"Wrote {out} ({width}x{height}, {len(bands)} bands, {offset} bytes, "
+          f"{100 * offset / raw_size:.0f}% of {raw_size} raw)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""
+pack_sprites.py - Pack sprites into one atlas file (/assets/pack.bin)
+
+Loading sprites one file at a time costs a FAT open/close, a malloc and a
+read per sprite. A pack holds every sprite behind a small index table, so
+the firmware loads them all with one open and one sequential read into one
+allocation (spritePackLoad in src/sd_sprites.cpp).
+
+Usage:
+    python pack_sprites.py pack_manifest.txt ../sdcard/assets/pack.bin
+    python pack_sprites.py --list ../sdcard/assets/pack.bin
+    python pack_sprites.py --key 0x0000 old_manifest.txt pack.bin   # Black-keyed .raw files
+
+Manifest: one sprite per line, '#' starts a comment.
+    <name>  <source>  [WxH]
+name    Path the firmware asks for, without extension ("/sprites/ui/ui_coin_gold")
+source  .raw (RGB565 LE, needs WxH), .i4 (from img2i4.py) or .png (needs Pillow),
+        relative to the manifest
+
+.raw pixels in the firmware's key colour (magenta 0xF81F) are transparent.
+Older .raw files from png_to_rgb565.py are keyed black instead; --key 0x0000
+turns that colour into magenta as they are packed.
+
+Pack format (little-endian):
+    header  "BHPK", uint16 version (1), uint16 count, uint32 data bytes, uint32 reserved
+    table   count x { uint32 name hash (FNV-1a), uint16 width, uint16 height,
+                      uint8 format (0 RGB565, 1 4bpp), uint8 palette entries (0 or 16),
+                      uint16 reserved, uint32 data offset }, sorted by hash
+    data    per sprite: RGB565 pixels, or palette + packed indices; 4-byte aligned
+"""
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = b"BHPK"
+VERSION = 1
+FMT_RGB565 = 0
+FMT_INDEXED4 = 1
+PALETTE_SIZE = 16
+KEY_COLOR = 0xF81F
+
+
+def name_hash(name):
+    """FNV-1a, matching spriteNameHash in the firmware"""
+    h = 2166136261
+    for b in name.encode():
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def load_raw(path, size, key=KEY_COLOR):
+    if not size:
+        raise ValueError(f"{path}: .raw needs WxH")
+    width, height = (int(v) for v in size.lower().split("x"))
+    data = path.read_bytes()
+    if len(data) != width * height * 2:
+        raise ValueError(f"{path}: {len(data)} bytes, expected {width * height * 2} for {size}")
+    if key != KEY_COLOR:
+        pixels = struct.unpack(f"<{width * height}H", data)
+        data = struct.pack(f"<{width * height}H", *(KEY_COLOR if c == key else c for c in pixels))
+    return width, height, FMT_RGB565, 0, data
+
+
+def load_i4(path):
+    data = path.read_bytes()
+    if data[:4] != b"SPI4":
+        raise ValueError(f"{path}: not an .i4 sprite")
+    width, height, colors = struct.unpack_from("<HHB", data, 4)
+    palette = data[10:10 + colors * 2]
+    indices = data[10 + colors * 2:]
+    if len(indices) != (width + 1) // 2 * height:
+        raise ValueError(f"{path}: truncated")
+    if colors:
+        # Packs always carry all 16 entries so the blitter can't index past them
+        palette += b"\x00\x00" * (PALETTE_SIZE - colors)
+        colors = PALETTE_SIZE
+    return width, height, FMT_INDEXED4, colors, palette + indices
+
+
+def load_png(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        print("Error: Pillow library required for PNG input. Install with: pip install Pillow")
+        sys.exit(1)
+
+    img = Image.open(path).convert("RGBA")
+    out = bytearray()
+    for r, g, b, a in img.getdata():
+        c = KEY_COLOR if a < 128 else ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+        out += struct.pack("<H", c)
+    return img.width, img.height, FMT_RGB565, 0, bytes(out)
+
+
+def read_manifest(path, key=KEY_COLOR):
+    entries = []
+    for num, line in enumerate(path.read_text().splitlines(), 1):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        fields = line.split()
+        if len(fields) not in (2, 3):
+            raise ValueError(f"{path}:{num}: expected <name> <source> [WxH]")
+        name, source = fields[0], path.parent / fields[1]
+        size = fields[2] if len(fields) == 3 else None
+
+        ext = source.suffix.lower()
+        if ext == ".raw":
+            sprite = load_raw(source, size, key)
+        elif ext == ".i4":
+            sprite = load_i4(source)
+        else:
+            sprite = load_png(source)
+        entries.append((name, sprite))
+    return entries
+
+
+def build_pack(entries):
+    hashes = {}
+    for name, _ in entries:
+        h = name_hash(name)
+        if h in hashes:
+            raise ValueError(f"hash collision: {name} and {hashes[h]} (rename one)")
+        hashes[h] = name
+
+    table = b""
+    data = bytearray()
+    for name, (width, height, fmt, colors, payload) in sorted(entries, key=lambda e: name_hash(e[0])):
+        table += struct.pack("<IHHBBHI", name_hash(name), width, height, fmt, colors, 0, len(data))
+        data += payload
+        data += b"\x00" * (-len(data) % 4)
+
+    header = MAGIC + struct.pack("<HHII", VERSION, len(entries), len(data), 0)
+    return header + table + bytes(data)
+
+
+def list_pack(path):
+    data = Path(path).read_bytes()
+    if data[:4] != MAGIC:
+        print(f"Error: {path} is not a sprite pack")
+        sys.exit(1)
+    version, count, data_bytes, _ = struct.unpack_from("<HHII", data, 4)
+    print(f"{path}: version {version}, {count} sprites, {data_bytes} data bytes")
+    for i in range(count):
+        h, w, ht, fmt, colors, _, offset = struct.unpack_from("<IHHBBHI", data, 16 + i * 16)
+        kind = "4bpp" if fmt == FMT_INDEXED4 else "rgb565"
+        pal = "" if fmt != FMT_INDEXED4 else (" own palette" if colors else " shared palette")
+        print(f"  {i:3}  {h:08x}  {w}x{ht}  {kind}{pal}  @{offset}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack sprites into one atlas file")
+    parser.add_argument("manifest", nargs="?", help="Sprite list (see top of this file)")
+    parser.add_argument("output", nargs="?", help="Output pack (e.g. sdcard/assets/pack.bin)")
+    parser.add_argument("--list", metavar="PACK", help="Print the table of an existing pack")
+    parser.add_argument("--key", type=lambda v: int(v, 0), default=KEY_COLOR,
+                        help="Transparent colour of the .raw sources (default 0xF81F)")
+    args = parser.parse_args()
+
+    if args.list:
+        list_pack(args.list)
+        return
+    if not args.manifest or not args.output:
+        parser.error("manifest and output are required")
+
+    try:
+        entries = read_manifest(Path(args.manifest), args.key)
+        pack = build_pack(entries)
+    except (ValueError, OSError) as e:
+        print(f"Error: {e}")
+        sys.exit(1)
+
+    out = Path(args.output)
+    out.parent.mkdir(parents=True, exist_ok=True)
+    out.write_bytes(pack)
+    print(f"Wrote {out} ({len(entries)} sprites, {len(pack)} bytes)")
+
+
+if __name__ == "__main__":
+    main()
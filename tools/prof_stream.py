@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""
+prof_stream.py - Decode the frame profiler's binary serial stream
+
+With DEBUG_PROFILER_STREAM set in include/config.h, the firmware sends one
+packet of per-phase frame timings (min/avg/p99 over the last PROF_WINDOW
+frames) every second, mixed in with the normal text log. This tool picks
+the packets out and prints one table per packet.
+
+Usage:
+    python prof_stream.py capture.bin             # Saved serial capture
+    python prof_stream.py --port /dev/ttyUSB0     # Live (needs pyserial)
+    .pio/build/native/program | python prof_stream.py -   # Simulator
+
+Packet format (little-endian), see include/profiler.h:
+    0xB5 0x50, uint8 version, uint8 phases, uint32 frame,
+    phases x (uint16 min, uint16 avg, uint16 p99) in microseconds,
+    uint8 XOR of every byte after the sync
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = b"\xb5\x50"
+VERSION = 1
+PHASE_NAMES = ["input", "sim", "clear", "draw", "ui", "push"]
+
+
+def parse_packets(data):
+    """Yield (frame, [(name, min, avg, p99), ...]) for each valid packet"""
+    pos = 0
+    while True:
+        pos = data.find(SYNC, pos)
+        if pos < 0 or pos + 8 > len(data):
+            return
+
+        version, phases = data[pos + 2], data[pos + 3]
+        end = pos + 8 + phases * 6 + 1
+        if version != VERSION or end > len(data):
+            pos += 1
+            continue
+
+        body = data[pos + 2:end - 1]
+        check = 0
+        for b in body:
+            check ^= b
+        if check != data[end - 1]:
+            # Sync bytes inside text or a torn packet
+            pos += 1
+            continue
+
+        frame = struct.unpack_from("<I", data, pos + 4)[0]
+        rows = []
+        for p in range(phases):
+            lo, avg, p99 = struct.unpack_from("<HHH", data, pos + 8 + p * 6)
+            name = PHASE_NAMES[p] if p < len(PHASE_NAMES) else f"#{p}"
+            rows.append((name, lo, avg, p99))
+        yield frame, rows
+        pos = end
+
+
+def print_packet(frame, rows):
+    print(f"frame {frame}")
+    print(f"  {'phase':<6}{'min':>7}{'avg':>7}{'p99':>7}  (us)")
+    for name, lo, avg, p99 in rows:
+        print(f"  {name:<6}{lo:>7}{avg:>7}{p99:>7}")
+    total = sum(row[2] for row in rows)
+    print(f"  {'sum':<6}{'':>7}{total:>7}")
+
+
+def read_live(port, baud):
+    try:
+        import serial
+    except ImportError:
+        print("Error: pyserial required for --port. Install with: pip install pyserial")
+        sys.exit(1)
+
+    buf = b""
+    with serial.Serial(port, baud, timeout=1) as ser:
+        while True:
+            buf += ser.read(256)
+            last = 0
+            for frame, rows in parse_packets(buf):
+                print_packet(frame, rows)
+                last = buf.rfind(SYNC) + 8 + len(rows) * 6 + 1
+            # Keep a tail in case a packet is still arriving
+            buf = buf[max(last, len(buf) - 256):]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the profiler serial stream")
+    parser.add_argument("input", nargs="?", help="Capture file ('-' for stdin)")
+    parser.add_argument("--port", help="Serial port to read live")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.port:
+        read_live(args.port, args.baud)
+        return
+
+    if not args.input:
+        parser.error("give a capture file, '-' or --port")
+
+    if args.input == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.input, "rb") as f:
+            data = f.read()
+
+    count = 0
+    for frame, rows in parse_packets(data):
+        print_packet(frame, rows)
+        count += 1
+    if count == 0:
+        print("No profiler packets found (is DEBUG_PROFILER_STREAM set?)")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()